@@ -4,7 +4,12 @@
 //#include "sw-src/api_pb/api.grpc.pb.h"
 
 #include "sw-src/dataplane/pipeline.h"
+#include "sw-src/dataplane/pipeline_txn.h"
 #include "sw-src/dataplane/physical_layer.h"
+#include "sw-src/dataplane/stage_pipeline.h"
+#include "sw-src/dataplane/phv_pool.h"
+#include "sw-src/dataplane/field_access.h"
+#include "sw-src/dataplane/flow_cache.h"
 
 #include "sw-src/api/dataplane_server.h"
 
@@ -12,8 +17,20 @@
 #include <glog/logging.h>
 #include <unistd.h>
 #include <thread>
+#include <chrono>
+#include <algorithm>
+#include <deque>
+#include <memory>
 
 DEFINE_string(ifconf, "../../sw-src/conf/switch.yml", "Interfaces");
+DEFINE_string(io, "pcap", "Packet I/O backend: pcap, or tpacket for AF_PACKET mmap rings");
+DEFINE_int32(burst, PKT_BURST_MAX, "Max frames received and processed per loop iteration");
+DEFINE_int32(rx_spin, RX_SPIN_DEFAULT, "Empty polling passes before the receiver sleeps in epoll, 0 sleeps at once");
+DEFINE_int32(workers, 0, "Pipeline worker threads, each with its own sockets in a PACKET_FANOUT group; 0 runs one");
+DEFINE_int32(stages, 0, "Split the processors into this many groups, one thread each; overrides -workers");
+DEFINE_int32(stats_interval, 5000, "Milliseconds between stage statistics logs in -stages mode");
+DEFINE_int32(flow_cache, 0, "Entries of the microflow cache in front of the pipeline, per worker; 0 disables it");
+DEFINE_bool(dump_packets, false, "Print every received and emitted frame; slow, for debugging only");
 
 #define PIPE
 
@@ -52,35 +69,41 @@ static void refresh_ipv4_checksum(Buffer packet, uint32_t recv_len) {
     ip_hdr->check = htons(ipv4_header_checksum(reinterpret_cast<const uint8_t *>(ip_hdr), header_len));
 }
 
-PHV * init_phv(uint8_t packet[], uint32_t recv_len, int if_index, Pipeline * pipe) {
-    PHV *phv = new PHV();
-    memcpy(phv->packet, packet, recv_len * sizeof(uint8_t));
-    memset(phv->packet + FRONT_HEADER_LEN, 0, sizeof(uint8_t) * META_LEN);
+/**
+ * zero_copy: the phv works on the frame where it was received, only valid while the
+ * frame is (until the next recv_burst). otherwise the frame is copied into the phv
+ */
+PHV * init_phv(PhvPool & pool, Buffer frame, uint32_t recv_len, int if_index, const PipelinePin & pin, bool zero_copy) {
+    PHV *phv = pool.acquire();
+    phv->pipe = pin.pipe.get();
+    phv->config_epoch = pin.epoch;
+    if(zero_copy) {
+        phv->attach(frame, recv_len);
+    } else {
+        phv->copy_in(frame, recv_len);
+    }
     phv->cur_trans_fd_num = 1;
     phv->cur_state = 0;
     phv->cur_trans_key = 0xffff;
 
     phv->ig_if = if_index;
 
-    int base_offset = FRONT_HEADER_LEN * 8;
-
-    for(auto meta : pipe->get_metadata_header()) {
-        phv->parsed_headers[meta->hdr_id]->hdr_id = meta->hdr_id;
-        phv->parsed_headers[meta->hdr_id]->hdr_len = meta->hdr_len * 8;
-        phv->parsed_headers[meta->hdr_id]->hdr_offset = meta->hdr_offset * 8 + FRONT_HEADER_LEN * 8;
-        LOG(INFO) << "MataData: ";
-        LOG(INFO) << "  header_id: " << phv->parsed_headers[meta->hdr_id]->hdr_id;
-        LOG(INFO) << "  header_len: " << phv->parsed_headers[meta->hdr_id]->hdr_len;
-        LOG(INFO) << "  header_offset: " << phv->parsed_headers[meta->hdr_id]->hdr_offset;
+    for(auto meta : pin.pipe->get_metadata_header()) {
+        phv->meta_headers |= 1u << meta->hdr_id;
+        phv->parsed_headers[meta->hdr_id].hdr_id = meta->hdr_id;
+        phv->parsed_headers[meta->hdr_id].hdr_len = meta->hdr_len * 8;
+        phv->parsed_headers[meta->hdr_id].hdr_offset = meta->hdr_offset * 8;
+        if(FLAGS_dump_packets) {
+            LOG(INFO) << "MataData: ";
+            LOG(INFO) << "  header_id: " << phv->parsed_headers[meta->hdr_id].hdr_id;
+            LOG(INFO) << "  header_len: " << phv->parsed_headers[meta->hdr_id].hdr_len;
+            LOG(INFO) << "  header_offset: " << phv->parsed_headers[meta->hdr_id].hdr_offset;
+        }
     }
 
-//    phv->parsed_headers[31]->hdr_id = 31;
-//    phv->parsed_headers[31]->hdr_offset = FRONT_HEADER_LEN * 8;
-
     // add the standard_metadata.ingress_port to phv
-    FieldInfo ig_if_fd{31, 0, 9};
-    Data data = {9, get_uints(if_index, 9)};
-    modify_phv_with_data(ig_if_fd, data, phv);
+    static const FieldAccessor ig_if_acc(FieldInfo{31, 0, 9});
+    ig_if_acc.write(phv, if_index);
 
 //    int eg_if = 0;
 //    if(if_index == 0) eg_if = 0b10;
@@ -92,112 +115,273 @@ PHV * init_phv(uint8_t packet[], uint32_t recv_len, int if_index, Pipeline * pip
     return phv;
 }
 
-int main(int argc, char *argv[]) {
-
-    google::InitGoogleLogging(argv[0]);
-    gflags::ParseCommandLineFlags(&argc, &argv, true);
-    net_config_init(FLAGS_ifconf);
-
-    auto pipe = new Pipeline(PROC_NUM);
-
-    init_mem();
-
-    std::thread server_thread(api::RunServer, pipe);
-    server_thread.detach();
-
-    static const uint8_t MAC1[] = "\x00\x00\x00\x00\x01\x50";
-    static const uint8_t MAC3[] = "\x00\x00\x00\x00\x02\x50";
-
-    PhysicalLayer phy;
-    FieldInfo fd {31, 9, 9};
-    while(true) {
-        uint8_t packet[BUFSIZ];
-        int if_index;
-        std::cout << "nonononono" << std::endl;
-        uint32_t recv_len = phy.recv_packet(packet, -1, if_index);
-        std::cout << "===== IN PACKET ======\n";
-        std::cout << "Ingress interface index: " << if_index << "\n";
-        std::cout << "Rx length: " << recv_len << "\n";
-        print_packet(packet, recv_len);
-
-        for(int i = 0; i < recv_len; i ++) {
-            if(i % 12 == 0 && i != 0) {
-                std::cout << std::endl;
-            }
-            std::cout << (int)packet[i] << "  ";
+static void dump_bytes(Buffer frame, uint32_t len) {
+    for(int i = 0; i < len; i ++) {
+        if(i % 12 == 0 && i != 0) {
+            std::cout << std::endl;
         }
-        std::cout << std::endl;
+        std::cout << (int)frame[i] << "  ";
+    }
+    std::cout << std::endl;
+}
 
-#ifdef PIPE
-        auto phv = init_phv(packet, recv_len, if_index, pipe);
+// -dump_packets only, these print every byte of every frame
+static void dump_rx_packet(Buffer frame, uint32_t recv_len, int if_index) {
+    std::cout << "===== IN PACKET ======\n";
+    std::cout << "Ingress interface index: " << if_index << "\n";
+    std::cout << "Rx length: " << recv_len << "\n";
+    print_packet(frame, recv_len);
+    dump_bytes(frame, recv_len);
+}
 
-        pipe->execute(phv);
+static void dump_tx_packet(Buffer packet, uint32_t recv_len, int if_index) {
+    std::cout << "===== OUT PACKET ======\n";
+    dump_bytes(packet, recv_len);
+    std::cout << "Egress interface index: " << if_index << "\n";
+    std::cout << "Tx length: " << recv_len << "\n";
+    print_packet(packet, recv_len);
+}
 
-        uint32_t out_port = get_field_value(fd, phv);
-        std::cout << "egress interface port: " << out_port << "\n";
+/**
+ * finish the packet bytes in place once the pipeline is done with the phv.
+ * only touches the phv, so any thread may call it
+ * @return egress port bitmap, 0 drops the packet
+ */
+static uint32_t finish_packet(PHV * phv, uint32_t recv_len) {
+#ifdef PIPE
+    static const FieldAccessor eg_if_acc(FieldInfo{31, 9, 9});
+    auto out_port = (uint32_t) eg_if_acc.read(phv);
+    refresh_ipv4_checksum(phv->packet, recv_len);
+    return out_port;
 #endif
 
 #ifndef PIPE
-        uint32_t out_port = 0;
-        if(if_index == 0) out_port = 2;
-        if(if_index == 1) out_port = 1;
+    if(phv->ig_if == 0) return 2;
+    if(phv->ig_if == 1) return 1;
+    return 0;
 #endif
-        try {
-
-            if (out_port) {
-                std::cout << "===== OUT PACKET ======\n";
-                for (int if_idx = 0; if_idx < glb.num_if; if_idx++) {
-                    if ((out_port >> if_idx) & 1) {
-                        LOG(INFO) << "Emit via " << glb.if_names[if_idx];
-                        static const uint8_t ZERO_MAC[] = "\x00\x00\x00\x00\x00\x00";
-                        if (memcmp(&glb.if_macs[if_idx], ZERO_MAC, sizeof(ether_addr)) != 0) {
+}
+
+// only reads pipeline state, so workers may run it concurrently, each with its own cache (or none)
+static uint32_t run_pipeline(PHV * phv, uint32_t recv_len, FlowCache * cache) {
 #ifdef PIPE
-                            memcpy(packet, phv->packet, recv_len * sizeof(uint8_t));
-                            refresh_ipv4_checksum(packet, recv_len);
-                            print_packet(packet, recv_len);
+    if(cache == nullptr) {
+        phv->pipe->execute(phv);
+    } else if(!cache->lookup(phv)) {
+        phv->pipe->execute(phv);
+        cache->finish(phv);
+    }
 #endif
-                            auto eth_hdr = (ether_header *) packet;
-                            memcpy(eth_hdr->ether_shost, &glb.if_macs[if_idx], sizeof(ether_addr));
+    return finish_packet(phv, recv_len);
+}
+
+/**
+ * queue the processed packet on every port in out_port; the caller flushes once per burst.
+ * the per-port MAC rewrite goes straight into the phv's frame, queue_packet copies it out
+ */
+static void emit_packet(PhysicalLayer & phy, PHV * phv, uint32_t recv_len, uint32_t out_port) {
+    static const uint8_t MAC1[] = "\x00\x00\x00\x00\x01\x50";
+    static const uint8_t MAC3[] = "\x00\x00\x00\x00\x02\x50";
+
+    Buffer packet = phv->packet;
+    try {
+
+        if (out_port) {
+            for (int if_idx = 0; if_idx < glb.num_if; if_idx++) {
+                if ((out_port >> if_idx) & 1) {
+                    static const uint8_t ZERO_MAC[] = "\x00\x00\x00\x00\x00\x00";
+                    if (memcmp(&glb.if_macs[if_idx], ZERO_MAC, sizeof(ether_addr)) != 0) {
+                        auto eth_hdr = (ether_header *) packet;
+                        memcpy(eth_hdr->ether_shost, &glb.if_macs[if_idx], sizeof(ether_addr));
 //                        print_packet(packet, recv_len);
 #ifndef PIPE
-                            if(if_idx == 0) {
-                                memcpy(eth_hdr->ether_dhost, MAC1, sizeof(ether_addr));
-                            } else if(if_idx == 1) {
-                                memcpy(eth_hdr->ether_dhost, MAC3, sizeof(ether_addr));
-                            }
-#endif
-                        }
-
-                    for(int i = 0; i < recv_len; i ++) {
-                        if(i % 12 == 0 && i != 0) {
-                            std::cout << std::endl;
+                        if(if_idx == 0) {
+                            memcpy(eth_hdr->ether_dhost, MAC1, sizeof(ether_addr));
+                        } else if(if_idx == 1) {
+                            memcpy(eth_hdr->ether_dhost, MAC3, sizeof(ether_addr));
                         }
-                        std::cout << (int)packet[i] << "  ";
+#endif
                     }
-                    std::cout << std::endl;
-                        std::cout << "Egress interface index: " << if_idx << "\n";
-                        std::cout << "Tx length: " << recv_len << "\n";
-                        print_packet(packet, recv_len);
-                        phy.send_packet(if_idx, packet, recv_len);
-                        std::cout << "send ok!" << std::endl;
+
+                    if(FLAGS_dump_packets) {
+                        dump_tx_packet(packet, recv_len, if_idx);
                     }
+                    // the frame is copied out here, packet can be rewritten for the next port
+                    phy.queue_packet(if_idx, packet, recv_len);
                 }
-            } else {
-                // standard_metadata.egress_port = 0; is the tag to drop packet
-                LOG(INFO) << "Dropping packet";
-//                break;
             }
+        } else if(FLAGS_dump_packets) {
+            // standard_metadata.egress_port = 0; is the tag to drop packet
+            LOG(INFO) << "Dropping packet";
         }
-        catch (const std::runtime_error &e) {
-                LOG(ERROR) << e.what();
+    }
+    catch (const std::runtime_error &e) {
+            LOG(ERROR) << e.what();
+    }
+}
+
+/**
+ * run to completion on the calling thread: every frame of a burst goes through the pipeline
+ * where it sits in the rx ring and is queued on phy's own tx path, flushed once per burst
+ */
+static void run_to_completion(PhysicalLayer * phy, PipelineHandle * pipes, int burst) {
+    std::unique_ptr<FlowCache> cache;
+    if(FLAGS_flow_cache > 0) {
+        cache.reset(new FlowCache(FLAGS_flow_cache));
+    }
+    PhvPool pool(PHV_POOL_SIZE);
+    Buffer frames[PKT_BURST_MAX];
+    uint32_t lens[PKT_BURST_MAX];
+    int if_indices[PKT_BURST_MAX];
+    while(true) {
+        // frames point into the rx rings (or the pcap copies) until the next recv_burst
+        int n = phy->recv_burst(frames, lens, if_indices, burst, -1);
+        auto pin = pipes->pin();
+        for(int i = 0; i < n; i++) {
+            if(FLAGS_dump_packets) {
+                dump_rx_packet(frames[i], lens[i], if_indices[i]);
+            }
+            auto phv = init_phv(pool, frames[i], lens[i], if_indices[i], pin, true);
+            uint32_t out_port = run_pipeline(phv, lens[i], cache.get());
+            emit_packet(*phy, phv, lens[i], out_port);
+            pool.release(phv);
         }
+        phy->flush_tx();
+    }
+}
+
+/**
+ * share-nothing workers: each one opens its own sockets on every port, and the sockets of a
+ * port form one PACKET_FANOUT_HASH group, so the kernel spreads the flows over the workers and
+ * keeps every flow on one of them, in order. the workers only share the pipeline
+ */
+static void run_workers(IoBackend backend, PipelineHandle & pipes, int burst, int num_workers) {
+    // fanout ids are per network namespace, keep ours apart from another switch's. one id per port
+    int fanout_group = (getpid() << 3) & 0xffff;
+    std::vector<std::unique_ptr<PhysicalLayer>> phys;
+    for(int i = 0; i < num_workers; i++) {
+        phys.emplace_back(new PhysicalLayer(backend, FLAGS_rx_spin, fanout_group));
+    }
 
-//        for(auto & parsed_header : phv->parsed_headers) {
-//            delete parsed_header;
-//        }
-//        delete phv->match_value;
-//        delete phv;  // auto delete
+    std::vector<std::thread> threads;
+    for(auto & phy : phys) {
+        threads.emplace_back(run_to_completion, phy.get(), &pipes, burst);
     }
+    LOG(INFO) << "Started " << num_workers << " pipeline workers";
+    for(auto & t : threads) {
+        t.join();
+    }
+}
+
+/**
+ * stage-pipelined mode: the receive thread injects PHVs into the first stage and emits
+ * whatever leaves the last one; the stages themselves run on their own threads
+ */
+static void run_stages(PhysicalLayer & phy, PipelineHandle & pipes, int burst, int num_stages) {
+    StagePipeline stages(pipes.pin().pipe->get_proc_num(), num_stages);
+    stages.start();
+
+    PhvPool pool(PHV_POOL_SIZE);
+    Buffer frames[PKT_BURST_MAX];
+    uint32_t lens[PKT_BURST_MAX];
+    int if_indices[PKT_BURST_MAX];
+    int in_flight = 0;
+    // the pins of the packets still in the stages with how many packets each one carries, oldest first.
+    // a PHV only points at its pipeline, the pin here keeps that pipeline alive until the packet leaves
+    std::deque<std::pair<PipelinePin, int>> held;
+    uint64_t dropped = 0;
+    uint64_t last_stats = PhysicalLayer::get_ticks();
+    while(true) {
+        int n = phy.recv_burst(frames, lens, if_indices, burst, in_flight > 0 ? 0 : -1);
+        auto pin = pipes.pin();
+        if(n > 0 && (held.empty() || held.back().first.pipe != pin.pipe)) {
+            held.emplace_back(pin, 0);
+        }
+        for(int i = 0; i < n; i++) {
+            if(FLAGS_dump_packets) {
+                dump_rx_packet(frames[i], lens[i], if_indices[i]);
+            }
+            auto phv = init_phv(pool, frames[i], lens[i], if_indices[i], pin, false);
+            if(!stages.inject(StageJob{phv, lens[i]})) {
+                pool.release(phv);
+                if(dropped++ % 1024 == 0) {
+                    LOG(WARNING) << "first stage full, " << dropped << " packets dropped so far";
+                }
+                continue;
+            }
+            held.back().second++;
+            in_flight++;
+        }
+
+        StageJob job{};
+        while(stages.poll_exit(job)) {
+            if(!job.dropped) {
+                emit_packet(phy, job.phv, job.len, finish_packet(job.phv, job.len));
+            }
+            for(auto it = held.begin(); it != held.end(); ++it) {
+                if(it->first.pipe.get() == job.phv->pipe) {
+                    it->second--;
+                    break;
+                }
+            }
+            pool.release(job.phv);
+            in_flight--;
+        }
+        while(!held.empty() && held.front().second == 0) {
+            held.pop_front();
+        }
+        phy.flush_tx();
+
+        uint64_t now = PhysicalLayer::get_ticks();
+        if(FLAGS_stats_interval > 0 && now - last_stats >= (uint64_t) FLAGS_stats_interval) {
+            stages.log_stats();
+            last_stats = now;
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+
+    google::InitGoogleLogging(argv[0]);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+    net_config_init(FLAGS_ifconf);
+
+    init_mem();
+
+    // the processors' matchers take their SRAM and TCAM blocks from init_mem
+    auto pipes = new PipelineHandle(new Pipeline(PROC_NUM));
+
+    std::thread server_thread(api::RunServer, pipes);
+    server_thread.detach();
+
+    IoBackend io_backend = IoBackend::PCAP;
+    if(FLAGS_io == "tpacket") {
+        io_backend = IoBackend::TPACKET;
+    } else if(FLAGS_io != "pcap") {
+        LOG(ERROR) << "Unknown io backend " << FLAGS_io << ", falling back to pcap";
+    }
+
+    int burst = std::max(1, std::min(FLAGS_burst, PKT_BURST_MAX));
+
+    if(FLAGS_stages > 0) {
+        if(FLAGS_workers > 0) {
+            LOG(WARNING) << "-stages is set, ignoring -workers";
+        }
+        if(FLAGS_flow_cache > 0) {
+            // a hit would overtake the packets of its flow still in the stages
+            LOG(WARNING) << "-flow_cache is not supported with -stages, ignoring it";
+        }
+        PhysicalLayer phy(io_backend, FLAGS_rx_spin);
+        run_stages(phy, *pipes, burst, FLAGS_stages);
+        return 0;
+    }
+    if(FLAGS_workers > 0) {
+        run_workers(io_backend, *pipes, burst, FLAGS_workers);
+        return 0;
+    }
+
+    PhysicalLayer phy(io_backend, FLAGS_rx_spin);
+    run_to_completion(&phy, pipes, burst);
 
     return 0;
 }
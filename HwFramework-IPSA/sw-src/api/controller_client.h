@@ -38,9 +38,108 @@ namespace api {
 
     private:
         std::unique_ptr<rp4::CfgService::Stub> stub_;
+        // set between start_bundle and apply_bundle: config calls are collected here instead of sent
+        std::unique_ptr<rp4::ApplyConfigReq> bundle_;
+        // set between start_entries and finish_entries: inserts are packed into batches on one insertEntries stream
+        std::unique_ptr<ClientContext> entry_context_;
+        std::unique_ptr<grpc::ClientWriter<rp4::InsertEntriesReq>> entry_writer_;
+        rp4::InsertEntriesReq entry_batch_;
+        rp4::InsertEntriesResp entry_resp_;
+        int entry_num_ = 0;
+
+        // bytes of packed entries a batch carries before it is sent
+        const static int ENTRY_BATCH_BYTES = 1 << 20;
+
+        bool send_entries() {
+            if(entry_batch_.entries().empty()) {
+                return true;
+            }
+            bool ok = entry_writer_->Write(entry_batch_);
+            entry_batch_.clear_entries();
+            return ok;
+        }
+
+        template<class Req>
+        bool queued(Req & request, Req * (rp4::ConfigOp::*slot)()) {
+            if(bundle_ == nullptr) {
+                return false;
+            }
+            (bundle_->add_ops()->*slot)()->Swap(&request);
+            return true;
+        }
 
     public:
 
+        // config calls up to commit_config go to a shadow pipeline, packets keep the old config until then
+        RC begin_config() {
+            rp4::BeginConfigReq request;
+            rp4::BeginConfigResp response;
+            ClientContext context;
+
+            Status status = stub_->beginConfig(&context, request, &response);
+
+            if(!status.ok()) return 0;
+            if(response.res() != rp4::Res::OK) {
+                std::cerr << "beginConfig rejected: a transaction is already open" << std::endl;
+                return 0;
+            }
+            return 1;
+        }
+
+        RC commit_config() {
+            rp4::CommitConfigReq request;
+            rp4::CommitConfigResp response;
+            ClientContext context;
+
+            Status status = stub_->commitConfig(&context, request, &response);
+
+            if(!status.ok()) return 0;
+            if(response.res() != rp4::Res::OK) {
+                std::cerr << "commitConfig rejected: no transaction is open" << std::endl;
+                return 0;
+            }
+            return 1;
+        }
+
+        RC abort_config() {
+            rp4::AbortConfigReq request;
+            rp4::AbortConfigResp response;
+            ClientContext context;
+
+            Status status = stub_->abortConfig(&context, request, &response);
+
+            if(status.ok()) return 1;
+            else return 0;
+        }
+
+        // the config calls from here to apply_bundle return 1 at once and go out together in one applyConfig
+        void start_bundle() {
+            bundle_.reset(new rp4::ApplyConfigReq());
+        }
+
+        RC apply_bundle() {
+            if(bundle_ == nullptr) {
+                return 0;
+            }
+            std::unique_ptr<rp4::ApplyConfigReq> request = std::move(bundle_);
+            rp4::ApplyConfigResp response;
+            ClientContext context;
+
+            Status status = stub_->applyConfig(&context, *request, &response);
+
+            if(!status.ok()) {
+                std::cerr << "applyConfig RPC failed: " << status.error_code() << " "
+                          << status.error_message() << std::endl;
+                return 0;
+            }
+            if(response.res() != rp4::Res::OK) {
+                std::cerr << "applyConfig rejected: op " << response.applied() << " of "
+                          << request->ops_size() << " failed, nothing committed" << std::endl;
+                return 0;
+            }
+            return 1;
+        }
+
         RC set_metadata (std::vector<HeaderInfo*> metas) {
             rp4::SetMetadataReq request;
             for(auto it : metas) {
@@ -50,6 +149,8 @@ namespace api {
                 meta->set_headerlength(it->hdr_len);
             }
 
+            if(queued(request, &rp4::ConfigOp::mutable_setmetadata)) return 1;
+
             rp4::SetMetadataResp response;
             ClientContext context;
 
@@ -81,6 +182,8 @@ namespace api {
                 ctx_msg->add_biases(bias);
             }
 
+            if(queued(request, &rp4::ConfigOp::mutable_loadneuronprimitivecontext)) return 1;
+
             rp4::LoadNeuronPrimitiveContextResp response;
             ClientContext context;
             Status status = stub_->loadNeuronPrimitiveContext(&context, request, &response);
@@ -111,6 +214,8 @@ namespace api {
                 entry->set_value(point.second);
             }
 
+            if(queued(request, &rp4::ConfigOp::mutable_loadsigmoidtable)) return 1;
+
             rp4::LoadSigmoidTableResp response;
             ClientContext context;
             Status status = stub_->loadSigmoidTable(&context, request, &response);
@@ -130,6 +235,8 @@ namespace api {
 
         RC clear_sigmoid_table() {
             rp4::ClearSigmoidTableReq request;
+            if(queued(request, &rp4::ConfigOp::mutable_clearsigmoidtable)) return 1;
+
             rp4::ClearSigmoidTableResp response;
             ClientContext context;
             Status status = stub_->clearSigmoidTable(&context, request, &response);
@@ -151,6 +258,8 @@ namespace api {
                 entry->set_value(point.second);
             }
 
+            if(queued(request, &rp4::ConfigOp::mutable_loadexptable)) return 1;
+
             rp4::LoadExpTableResp response;
             ClientContext context;
             Status status = stub_->loadExpTable(&context, request, &response);
@@ -162,6 +271,8 @@ namespace api {
 
         RC clear_exp_table() {
             rp4::ClearExpTableReq request;
+            if(queued(request, &rp4::ConfigOp::mutable_clearexptable)) return 1;
+
             rp4::ClearExpTableResp response;
             ClientContext context;
             Status status = stub_->clearExpTable(&context, request, &response);
@@ -173,6 +284,8 @@ namespace api {
 
         RC clear_neuron_primitive_contexts() {
             rp4::ClearNeuronPrimitiveContextsReq request;
+            if(queued(request, &rp4::ConfigOp::mutable_clearneuronprimitivecontexts)) return 1;
+
             rp4::ClearNeuronPrimitiveContextsResp response;
             ClientContext context;
             Status status = stub_->clearNeuronPrimitiveContexts(&context, request, &response);
@@ -187,6 +300,8 @@ namespace api {
             request.set_procid(proc_id);
             request.set_parserlevel(parser_level);
 
+            if(queued(request, &rp4::ConfigOp::mutable_initparserlevel)) return 1;
+
             rp4::ParserLevelResp response;
             ClientContext context;
 
@@ -226,6 +341,8 @@ namespace api {
                 field->set_fieldtype(get_field_type(it->fd_type));
             }
 
+            if(queued(request, &rp4::ConfigOp::mutable_modparserentry)) return 1;
+
             rp4::ModParserEntryResp response;
             ClientContext context;
             Status status = stub_->modParserEntry(&context, request, &response);
@@ -241,6 +358,8 @@ namespace api {
             rp4::ClearParserReq request;
             request.set_procid(proc_id);
 
+            if(queued(request, &rp4::ConfigOp::mutable_clearparser)) return 1;
+
             rp4::ClearParserResp response;
             ClientContext context;
             Status status = stub_->clearParser(&context, request, &response);
@@ -261,6 +380,8 @@ namespace api {
 
             request.set_relation(get_relation_code(exp->relation));
 
+            if(queued(request, &rp4::ConfigOp::mutable_insertrelationexp)) return 1;
+
             rp4::InsertRelationExpResp response;
             ClientContext context;
             Status status = stub_->insertRelationExp(&context, request, &response);
@@ -272,6 +393,8 @@ namespace api {
             rp4::ClearRelationExpReq request;
             request.set_procid(proc_id);
 
+            if(queued(request, &rp4::ConfigOp::mutable_clearrelationexp)) return 1;
+
             rp4::ClearRelationExpResp response;
             ClientContext context;
 
@@ -284,6 +407,8 @@ namespace api {
             rp4::ClearResMapReq request;
             request.set_procid(proc_id);
 
+            if(queued(request, &rp4::ConfigOp::mutable_clearresmap)) return 1;
+
             rp4::ClearResMapResp response;
             ClientContext context;
 
@@ -308,6 +433,8 @@ namespace api {
             entry->set_type(get_gate_entry_type(type));
             entry->set_val(value);
 
+            if(queued(request, &rp4::ConfigOp::mutable_modresmap)) return 1;
+
             rp4::ModResMapResp response;
             ClientContext context;
 
@@ -324,6 +451,8 @@ namespace api {
             entry->set_type(get_gate_entry_type(type));
             entry->set_val(value);
 
+            if(queued(request, &rp4::ConfigOp::mutable_setdefaultgateentry)) return 1;
+
             rp4::SetDefaultGateEntryResp response;
             ClientContext context;
 
@@ -338,6 +467,8 @@ namespace api {
             request.set_matcherid(matcher_id);
             request.set_notable(no_table);
 
+            if(queued(request, &rp4::ConfigOp::mutable_setnotable)) return 1;
+
             rp4::SetNoTableResp response;
             ClientContext context;
 
@@ -358,6 +489,8 @@ namespace api {
                 action_proc->set_procid(it.second);
             }
 
+            if(queued(request, &rp4::ConfigOp::mutable_setactionproc)) return 1;
+
             rp4::SetActionProcResp response;
             ClientContext context;
 
@@ -393,6 +526,8 @@ namespace api {
 
             request.set_missactid(miss_act_id);
 
+            if(queued(request, &rp4::ConfigOp::mutable_setmemconfig)) return 1;
+
             rp4::SetMemConfigResp response;
             ClientContext context;
 
@@ -415,6 +550,8 @@ namespace api {
                 fd->set_fieldtype(get_field_type(it->fd_type));
             }
 
+            if(queued(request, &rp4::ConfigOp::mutable_setfieldinfo)) return 1;
+
             rp4::SetFieldInfoResp response;
             ClientContext context;
 
@@ -429,6 +566,8 @@ namespace api {
             request.set_procid(proc_id);
             request.set_matcherid(matcher_id);
 
+            if(queued(request, &rp4::ConfigOp::mutable_clearoldconfig)) return 1;
+
             rp4::ClearOldConfigResp response;
             ClientContext context;
 
@@ -444,6 +583,8 @@ namespace api {
             request.set_matcherid(matcher_id);
             request.set_miss_act_id(miss_act_id);
 
+            if(queued(request, &rp4::ConfigOp::mutable_setmissactid)) return 1;
+
             rp4::SetMissActIdResp response;
             ClientContext context;
 
@@ -453,8 +594,74 @@ namespace api {
             else return 0;
         }
 
+        // inserts from here to finish_entries return at once and are streamed in batches in one insertEntries
+        void start_entries() {
+            entry_context_.reset(new ClientContext());
+            entry_resp_.Clear();
+            entry_writer_ = stub_->insertEntries(entry_context_.get(), &entry_resp_);
+            entry_batch_.Clear();
+            entry_num_ = 0;
+        }
+
+        // mask is nullptr for an exact match table
+        RC add_entry(int proc_id, int matcher_id, const uint8_t * key, const uint8_t * mask,
+                     const uint8_t * value, int key_byte_len, int value_byte_len) {
+            if(entry_writer_ == nullptr) {
+                return 0;
+            }
+            bool ternary = mask != nullptr;
+            if(!entry_batch_.entries().empty() &&
+               (entry_batch_.procid() != proc_id || entry_batch_.matcherid() != matcher_id ||
+                entry_batch_.ternary() != ternary || entry_batch_.key_byte_len() != key_byte_len ||
+                entry_batch_.value_byte_len() != value_byte_len ||
+                entry_batch_.entries().size() >= (size_t) ENTRY_BATCH_BYTES)) {
+                if(!send_entries()) return 0;
+            }
+            if(entry_batch_.entries().empty()) {
+                entry_batch_.set_procid(proc_id);
+                entry_batch_.set_matcherid(matcher_id);
+                entry_batch_.set_ternary(ternary);
+                entry_batch_.set_key_byte_len(key_byte_len);
+                entry_batch_.set_value_byte_len(value_byte_len);
+            }
+            auto entries = entry_batch_.mutable_entries();
+            entries->append((const char*)key, key_byte_len);
+            if(ternary) {
+                entries->append((const char*)mask, key_byte_len);
+            }
+            entries->append((const char*)value, value_byte_len);
+            entry_num_++;
+            return 1;
+        }
+
+        RC finish_entries() {
+            if(entry_writer_ == nullptr) {
+                return 0;
+            }
+            send_entries();
+            entry_writer_->WritesDone();
+            Status status = entry_writer_->Finish();
+            entry_writer_ = nullptr;
+            entry_context_ = nullptr;
+
+            if(!status.ok()) {
+                std::cerr << "insertEntries RPC failed: " << status.error_code() << " "
+                          << status.error_message() << std::endl;
+                return 0;
+            }
+            if(entry_resp_.res() != rp4::Res::OK) {
+                std::cerr << "insertEntries: " << entry_resp_.failed() << " of " << entry_num_
+                          << " entries not inserted" << std::endl;
+                return 0;
+            }
+            return 1;
+        }
+
         RC insert_sram_entry(int proc_id, int matcher_id, uint8_t * key,
                              uint8_t * value, int key_byte_len, int value_byte_len) {
+            if(entry_writer_ != nullptr) {
+                return add_entry(proc_id, matcher_id, key, nullptr, value, key_byte_len, value_byte_len);
+            }
             rp4::InsertSramEntryReq request;
             request.set_procid(proc_id);
             request.set_matcherid(matcher_id);
@@ -469,12 +676,20 @@ namespace api {
 
             Status status = stub_->insertSramEntry(&context, request, &response);
 
-            if(status.ok()) return 1;
-            else return 0;
+            if(!status.ok()) return 0;
+            if(response.res() != rp4::Res::OK) {
+                std::cerr << "insertSramEntry rejected: table full, " << response.occupancy()
+                          << "/" << response.capacity() << " entries, stash " << response.stash_used() << std::endl;
+                return 0;
+            }
+            return 1;
         }
 
         RC insert_tcam_entry(int proc_id, int matcher_id, uint8_t * key, uint8_t * mask,
                              uint8_t * value, int key_byte_len, int value_byte_len) {
+            if(entry_writer_ != nullptr) {
+                return add_entry(proc_id, matcher_id, key, mask, value, key_byte_len, value_byte_len);
+            }
             rp4::InsertTcamEntryReq request;
             request.set_procid(proc_id);
             request.set_matcherid(matcher_id);
@@ -494,6 +709,99 @@ namespace api {
             else return 0;
         }
 
+        RC modify_sram_entry(int proc_id, int matcher_id, uint8_t * key,
+                             uint8_t * value, int key_byte_len, int value_byte_len) {
+            rp4::ModSramEntryReq request;
+            request.set_procid(proc_id);
+            request.set_matcherid(matcher_id);
+            request.set_key_byte_len(key_byte_len);
+            request.set_value_byte_len(value_byte_len);
+
+            request.set_key(get_string(key, key_byte_len));
+            request.set_value(get_string(value, value_byte_len));
+
+            rp4::ModSramEntryResp response;
+            ClientContext context;
+
+            Status status = stub_->modSramEntry(&context, request, &response);
+
+            if(!status.ok()) return 0;
+            if(response.res() != rp4::Res::OK) {
+                std::cerr << "modSramEntry rejected: key not in table" << std::endl;
+                return 0;
+            }
+            return 1;
+        }
+
+        RC delete_sram_entry(int proc_id, int matcher_id, uint8_t * key, int key_byte_len) {
+            rp4::DelSramEntryReq request;
+            request.set_procid(proc_id);
+            request.set_matcherid(matcher_id);
+            request.set_key_byte_len(key_byte_len);
+
+            request.set_key(get_string(key, key_byte_len));
+
+            rp4::DelSramEntryResp response;
+            ClientContext context;
+
+            Status status = stub_->delSramEntry(&context, request, &response);
+
+            if(!status.ok()) return 0;
+            if(response.res() != rp4::Res::OK) {
+                std::cerr << "delSramEntry rejected: key not in table, " << response.occupancy()
+                          << " entries left" << std::endl;
+                return 0;
+            }
+            return 1;
+        }
+
+        RC modify_tcam_entry(int proc_id, int matcher_id, uint8_t * key, uint8_t * mask,
+                             uint8_t * value, int key_byte_len, int value_byte_len) {
+            rp4::ModTcamEntryReq request;
+            request.set_procid(proc_id);
+            request.set_matcherid(matcher_id);
+            request.set_key_byte_len(key_byte_len);
+            request.set_value_byte_len(value_byte_len);
+
+            request.set_key(get_string(key, key_byte_len));
+            request.set_mask(get_string(mask, key_byte_len));
+            request.set_value(get_string(value, value_byte_len));
+
+            rp4::ModTcamEntryResp response;
+            ClientContext context;
+
+            Status status = stub_->modTcamEntry(&context, request, &response);
+
+            if(!status.ok()) return 0;
+            if(response.res() != rp4::Res::OK) {
+                std::cerr << "modTcamEntry rejected: no entry with this key and mask" << std::endl;
+                return 0;
+            }
+            return 1;
+        }
+
+        RC delete_tcam_entry(int proc_id, int matcher_id, uint8_t * key, uint8_t * mask, int key_byte_len) {
+            rp4::DelTcamEntryReq request;
+            request.set_procid(proc_id);
+            request.set_matcherid(matcher_id);
+            request.set_key_byte_len(key_byte_len);
+
+            request.set_key(get_string(key, key_byte_len));
+            request.set_mask(get_string(mask, key_byte_len));
+
+            rp4::DelTcamEntryResp response;
+            ClientContext context;
+
+            Status status = stub_->delTcamEntry(&context, request, &response);
+
+            if(!status.ok()) return 0;
+            if(response.res() != rp4::Res::OK) {
+                std::cerr << "delTcamEntry rejected: no entry with this key and mask" << std::endl;
+                return 0;
+            }
+            return 1;
+        }
+
         RC insert_action(int proc_id, int action_id, int para_num, std::vector<Primitive*> primitives,
                          std::vector<int> action_para_lens) {
             rp4::InsertActionReq request;
@@ -521,6 +829,8 @@ namespace api {
 
             }
 
+            if(queued(request, &rp4::ConfigOp::mutable_insertaction)) return 1;
+
             rp4::InsertActionResp response;
             ClientContext context;
 
@@ -535,6 +845,8 @@ namespace api {
             rp4::ClearActionReq request;
             request.set_procid(proc_id);
 
+            if(queued(request, &rp4::ConfigOp::mutable_clearaction)) return 1;
+
             rp4::ClearActionResp response;
             ClientContext context;
 
@@ -549,6 +861,8 @@ namespace api {
             request.set_procid(proc_id);
             request.set_actionid(action_id);
 
+            if(queued(request, &rp4::ConfigOp::mutable_delaction)) return 1;
+
             rp4::DelActionResp response;
             ClientContext context;
 
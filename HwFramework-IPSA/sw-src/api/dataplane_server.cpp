@@ -5,10 +5,10 @@
 
 int main(int argc, char * argv[]) {
 //    google::InitGoogleLogging(argv[0]);
-    auto pipe = new Pipeline(PROC_NUM);
-
     init_mem();
-    api::RunServer(pipe);
+    auto pipes = new PipelineHandle(new Pipeline(PROC_NUM));
+
+    api::RunServer(pipes);
 
     return 0;
 }
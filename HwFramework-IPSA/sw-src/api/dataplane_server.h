@@ -5,6 +5,7 @@
 #include "../api_pb/controller_to_dataplane.grpc.pb.h"
 
 #include "../dataplane/pipeline.h"
+#include "../dataplane/pipeline_txn.h"
 #include "../dataplane/neuron_primitive.h"
 
 #include <grpcpp/grpcpp.h>
@@ -13,12 +14,19 @@
 
 #include <google/protobuf/text_format.h>
 
+#include <chrono>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace api {
 
-    Pipeline *ppl;
+    PipelineHandle *pipes;
+    // grpc runs handlers on several threads; pipeline config and table entries go one call at a time.
+    // recursive: applyConfig runs the handlers of its ops under it
+    std::recursive_mutex config_mu;
 
 class CfgServiceImpl final : public rp4::CfgService::Service {
 
@@ -29,9 +37,211 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
             std::cout << "Requesting \n" << req_str << std::endl;
         }
 
+        // every handler changes the config, so cached flow results from before it must not be replayed
+        static void config_changed() {
+            glb.config_epoch.fetch_add(1, std::memory_order_release);
+        }
+
+        static Pipeline * config_target(int proc_id) {
+            return pipes == nullptr ? nullptr : pipes->config_target(proc_id);
+        }
+
+        /**
+         * a config call made outside a transaction is a transaction of its own: it works on copies of the
+         * processors it touches, published if the call answers OK and dropped otherwise, so packets never
+         * run a config halfway through a change. inside an open transaction or a bundle it does nothing
+         */
+        class OwnTxn {
+            const void * response;
+            bool (*succeeded)(const void *);
+            bool own;
+
+        public:
+            template<class Resp>
+            explicit OwnTxn(const Resp * _response)
+                    : response(_response),
+                      succeeded([](const void * r) { return static_cast<const Resp *>(r)->res() == rp4::Res::OK; }),
+                      own(pipes != nullptr && !pipes->in_transaction() && pipes->begin()) {}
+
+            OwnTxn(const OwnTxn &) = delete;
+            OwnTxn & operator=(const OwnTxn &) = delete;
+
+            ~OwnTxn() {
+                if(!own) {
+                    return;
+                }
+                if(succeeded(response)) {
+                    pipes->commit();
+                    // once more after the swap, flows cached in between ran the old config
+                    config_changed();
+                } else {
+                    pipes->abort();
+                }
+            }
+        };
+
+        // the entry buffers are sized from the declared lengths, the bytes sent must fill them exactly.
+        // mask_size < 0: the request has no mask
+        static bool entry_lengths_ok(const char *rpc, int key_len, size_t key_size, int value_len,
+                                     size_t value_size, long mask_size = -1) {
+            if(key_len > 0 && value_len >= 0 && key_size == (size_t)key_len && value_size == (size_t)value_len
+               && (mask_size < 0 || mask_size == key_len)) {
+                return true;
+            }
+            LOG(ERROR) << rpc << ": key " << key_size << "/" << key_len << ", value " << value_size << "/"
+                       << value_len << ", mask " << mask_size << " bytes do not match the declared lengths";
+            return false;
+        }
+
+        grpc::Status beginConfig(grpc::ServerContext *context, const rp4::BeginConfigReq *request,
+                                 rp4::BeginConfigResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            if(pipes == nullptr) {
+                return grpc::Status::CANCELLED;
+            }
+
+            bool ok = pipes->begin();
+            LOG(INFO) << "Config transaction begin: " << ok;
+            response->set_res(ok ? rp4::Res::OK : rp4::Res::FAIL);
+            return grpc::Status::OK;
+        }
+
+        grpc::Status commitConfig(grpc::ServerContext *context, const rp4::CommitConfigReq *request,
+                                  rp4::CommitConfigResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            if(pipes == nullptr) {
+                return grpc::Status::CANCELLED;
+            }
+
+            bool ok = pipes->commit();
+            LOG(INFO) << "Config transaction commit: " << ok << ", " << pipes->unpublished_num()
+                      << " old pipelines still in use";
+            response->set_res(ok ? rp4::Res::OK : rp4::Res::FAIL);
+            config_changed();
+            return grpc::Status::OK;
+        }
+
+        grpc::Status abortConfig(grpc::ServerContext *context, const rp4::AbortConfigReq *request,
+                                 rp4::AbortConfigResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            if(pipes == nullptr) {
+                return grpc::Status::CANCELLED;
+            }
+
+            bool ok = pipes->abort();
+            LOG(INFO) << "Config transaction abort: " << ok;
+            response->set_res(ok ? rp4::Res::OK : rp4::Res::FAIL);
+            return grpc::Status::OK;
+        }
+
+        // run one op of a bundle through the handler of its own rpc
+        template<class Req, class Resp>
+        bool apply_op(grpc::Status (CfgServiceImpl::*handler)(grpc::ServerContext *, const Req *, Resp *),
+                      grpc::ServerContext *context, const Req & request) {
+            // a handler that returns without saying how it went has failed
+            Resp response;
+            response.set_res(rp4::Res::FAIL);
+            grpc::Status status = (this->*handler)(context, &request, &response);
+            return status.ok() && response.res() == rp4::Res::OK;
+        }
+
+        bool apply_op(grpc::ServerContext *context, const rp4::ConfigOp & op) {
+            switch (op.op_case()) {
+                case rp4::ConfigOp::kSetMetadata :
+                    return apply_op(&CfgServiceImpl::setMetadata, context, op.setmetadata());
+                case rp4::ConfigOp::kInitParserLevel :
+                    return apply_op(&CfgServiceImpl::initParserLevel, context, op.initparserlevel());
+                case rp4::ConfigOp::kModParserEntry :
+                    return apply_op(&CfgServiceImpl::modParserEntry, context, op.modparserentry());
+                case rp4::ConfigOp::kClearParser :
+                    return apply_op(&CfgServiceImpl::clearParser, context, op.clearparser());
+                case rp4::ConfigOp::kInsertRelationExp :
+                    return apply_op(&CfgServiceImpl::insertRelationExp, context, op.insertrelationexp());
+                case rp4::ConfigOp::kClearRelationExp :
+                    return apply_op(&CfgServiceImpl::clearRelationExp, context, op.clearrelationexp());
+                case rp4::ConfigOp::kClearResMap :
+                    return apply_op(&CfgServiceImpl::clearResMap, context, op.clearresmap());
+                case rp4::ConfigOp::kModResMap :
+                    return apply_op(&CfgServiceImpl::modResMap, context, op.modresmap());
+                case rp4::ConfigOp::kSetDefaultGateEntry :
+                    return apply_op(&CfgServiceImpl::setDefaultGateEntry, context, op.setdefaultgateentry());
+                case rp4::ConfigOp::kSetNoTable :
+                    return apply_op(&CfgServiceImpl::setNoTable, context, op.setnotable());
+                case rp4::ConfigOp::kSetActionProc :
+                    return apply_op(&CfgServiceImpl::setActionProc, context, op.setactionproc());
+                case rp4::ConfigOp::kSetMemConfig :
+                    return apply_op(&CfgServiceImpl::setMemConfig, context, op.setmemconfig());
+                case rp4::ConfigOp::kSetFieldInfo :
+                    return apply_op(&CfgServiceImpl::setFieldInfo, context, op.setfieldinfo());
+                case rp4::ConfigOp::kClearOldConfig :
+                    return apply_op(&CfgServiceImpl::clearOldConfig, context, op.clearoldconfig());
+                case rp4::ConfigOp::kSetMissActId :
+                    return apply_op(&CfgServiceImpl::setMissActId, context, op.setmissactid());
+                case rp4::ConfigOp::kInsertAction :
+                    return apply_op(&CfgServiceImpl::insertAction, context, op.insertaction());
+                case rp4::ConfigOp::kClearAction :
+                    return apply_op(&CfgServiceImpl::clearAction, context, op.clearaction());
+                case rp4::ConfigOp::kDelAction :
+                    return apply_op(&CfgServiceImpl::delAction, context, op.delaction());
+                case rp4::ConfigOp::kLoadSigmoidTable :
+                    return apply_op(&CfgServiceImpl::loadSigmoidTable, context, op.loadsigmoidtable());
+                case rp4::ConfigOp::kClearSigmoidTable :
+                    return apply_op(&CfgServiceImpl::clearSigmoidTable, context, op.clearsigmoidtable());
+                case rp4::ConfigOp::kLoadExpTable :
+                    return apply_op(&CfgServiceImpl::loadExpTable, context, op.loadexptable());
+                case rp4::ConfigOp::kClearExpTable :
+                    return apply_op(&CfgServiceImpl::clearExpTable, context, op.clearexptable());
+                case rp4::ConfigOp::kLoadNeuronPrimitiveContext :
+                    return apply_op(&CfgServiceImpl::loadNeuronPrimitiveContext, context,
+                                    op.loadneuronprimitivecontext());
+                case rp4::ConfigOp::kClearNeuronPrimitiveContexts :
+                    return apply_op(&CfgServiceImpl::clearNeuronPrimitiveContexts, context,
+                                    op.clearneuronprimitivecontexts());
+                default:
+                    LOG(ERROR) << "applyConfig: empty or unknown op";
+                    return false;
+            }
+        }
+
+        grpc::Status applyConfig(grpc::ServerContext *context, const rp4::ApplyConfigReq *request,
+                                 rp4::ApplyConfigResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            if(pipes == nullptr) {
+                return grpc::Status::CANCELLED;
+            }
+
+            // inside an open transaction the bundle becomes part of it, otherwise it is one of its own
+            bool own_txn = !pipes->in_transaction() && pipes->begin();
+            int applied = 0;
+            bool ok = true;
+            for(const auto & op : request->ops()) {
+                if(!apply_op(context, op)) {
+                    LOG(ERROR) << "applyConfig: op " << applied << " failed";
+                    ok = false;
+                    break;
+                }
+                applied++;
+            }
+            if(own_txn) {
+                if(ok) {
+                    pipes->commit();
+                } else {
+                    pipes->abort();
+                }
+            }
+            LOG(INFO) << "Config bundle: " << applied << " of " << request->ops_size() << " ops applied";
+            response->set_res(ok ? rp4::Res::OK : rp4::Res::FAIL);
+            response->set_applied(applied);
+            config_changed();
+            return grpc::Status::OK;
+        }
+
         grpc::Status setMetadata (
                 grpc::ServerContext *context, const rp4::SetMetadataReq *request,
                 rp4::SetMetadataResp * response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = pipes == nullptr ? nullptr : pipes->pipeline_target();
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
@@ -46,23 +256,33 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
                 metas.push_back(meta);
             }
             ppl->set_metadata_header(metas);
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status initParserLevel(
                 grpc::ServerContext *context, const rp4::ParserLevelReq *request,
                 rp4::ParserLevelResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
 
 
             ppl->init_parser_level(request->procid(), request->parserlevel());
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status modParserEntry(grpc::ServerContext *context, const rp4::ModParserEntryReq *request,
                                     rp4::ModParserEntryResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
@@ -78,22 +298,31 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
                                             request->key(), request->mask(), request->hdrid(), request->hdrlen(),
                                             request->nextstate(), request->transfieldnum(), _trans_fds, request->miss_act());
 
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status clearParser(grpc::ServerContext *context, const rp4::ClearParserReq *request,
                                     rp4::ClearParserResp * response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
 
-            std::cout << request->procid() << std::endl;
             ppl->clear_parser(request->procid());
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status insertRelationExp(grpc::ServerContext *context, const rp4::InsertRelationExpReq *request,
                                        rp4::InsertRelationExpResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
@@ -111,32 +340,47 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
 
             ppl->insert_exp(request->procid(), exp);
 
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status clearRelationExp(grpc::ServerContext *context, const rp4::ClearRelationExpReq *request,
                                        rp4::ClearRelationExpResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
 
             ppl->clear_exp(request->procid());
 
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status clearResMap(grpc::ServerContext *context, const rp4::ClearResMapReq *request,
                                  rp4::ClearResMapResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
 
             ppl->clear_res_map(request->procid());
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status modResMap(grpc::ServerContext *context, const rp4::ModResMapReq *request,
                                rp4::ModResMapResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
@@ -144,11 +388,16 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
             ppl->modify_res_map(request->procid(), request->key(),
                                 get_gate_entry_type(request->entry().type()), request->entry().val());
 
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status setDefaultGateEntry(grpc::ServerContext *context, const rp4::SetDefaultGateEntryReq *request,
                                          rp4::SetDefaultGateEntryResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->proc_id());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
@@ -156,11 +405,16 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
             ppl->set_default_entry(request->proc_id(),
                                    get_gate_entry_type(request->default_entry().type()),
                                    request->default_entry().val());
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status setActionProc(grpc::ServerContext *context, const rp4::SetActionProcReq *request,
                                    rp4::SetActionProcResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
@@ -173,11 +427,16 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
                                      request->matcherid(),
                                      _action_proc);
 
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status setMemConfig(grpc::ServerContext *context, const rp4::SetMemConfigReq *request,
                                    rp4::SetMemConfigResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
@@ -202,11 +461,16 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
                                 request->keywidth(), request->valuewidth(), request->depth(),
                                 key_i, value_i);
             ppl->set_miss_act_id(request->procid(), request->matcherid(), request->missactid());
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status setFieldInfo(grpc::ServerContext *context, const rp4::SetFieldInfoReq *request,
                                   rp4::SetFieldInfoResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
@@ -228,63 +492,187 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
                 _fdInfos.push_back(fd);
             }
             ppl->set_field_infos(request->procid(), request->matcherid(), _fdInfos);
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status setNoTable(grpc::ServerContext *context, const rp4::SetNoTableReq *request,
                                      rp4::SetNoTableResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
 
             ppl->set_no_table(request->procid(), request->matcherid(), request->notable());
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status clearOldConfig(grpc::ServerContext *context, const rp4::ClearOldConfigReq *request,
                                       rp4::ClearOldConfigResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
             ppl->clear_old_config(request->procid(), request->matcherid());
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status setMissActId(grpc::ServerContext *context, const rp4::SetMissActIdReq *request,
                                 rp4::SetMissActIdResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
 
             ppl->set_miss_act_id(request->procid(), request->matcherid(), request->miss_act_id());
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
 
         grpc::Status insertSramEntry(grpc::ServerContext *context, const rp4::InsertSramEntryReq *request,
                                     rp4::InsertSramEntryResp *response) override {
-            if(ppl == nullptr) {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            if(pipes == nullptr) {
                 return grpc::Status::CANCELLED;
             }
+            if(!entry_lengths_ok("insertSramEntry", request->key_byte_len(), request->key().size(),
+                                 request->value_byte_len(), request->value().size())) {
+                response->set_res(rp4::Res::FAIL);
+                return grpc::Status::OK;
+            }
+            Pipeline * ppl = pipes->entry_target(request->procid());
 
             uint8_t key_i[request->key_byte_len()];
             uint8_t value_i[request->value_byte_len()];
             get_uint_from_bytes(request->key(), key_i);
             get_uint_from_bytes(request->value(), value_i);
-            ppl->insert_sram_entry(request->procid(),
+            ExactTableStats stats;
+            bool ok = ppl->insert_sram_entry(request->procid(),
                                    request->matcherid(),
                                    key_i, value_i,
                                    request->key_byte_len(),
-                                   request->value_byte_len());
+                                   request->value_byte_len(), &stats);
 
+            response->set_res(ok ? rp4::Res::OK : rp4::Res::FAIL);
+            response->set_occupancy(stats.occupancy);
+            response->set_capacity(stats.capacity);
+            response->set_stash_used(stats.stash_used);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status insertTcamEntry(grpc::ServerContext *context, const rp4::InsertTcamEntryReq *request,
                                      rp4::InsertTcamEntryResp *response) override {
-            if(ppl == nullptr) {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            if(pipes == nullptr) {
+                return grpc::Status::CANCELLED;
+            }
+            if(!entry_lengths_ok("insertTcamEntry", request->key_byte_len(), request->key().size(),
+                                 request->value_byte_len(), request->value().size(),
+                                 (long)request->mask().size())) {
+                response->set_res(rp4::Res::FAIL);
+                return grpc::Status::OK;
+            }
+            Pipeline * ppl = pipes->entry_target(request->procid());
+
+            uint8_t key_i[request->key_byte_len()];
+            uint8_t value_i[request->value_byte_len()];
+            get_uint_from_bytes(request->key(), key_i);
+            get_uint_from_bytes(request->value(), value_i);
+
+            uint8_t mask_i[request->mask().length()];
+            get_uint_from_bytes(request->mask(), mask_i);
+
+            bool ok = ppl->insert_tcam_entry(request->procid(),
+                                   request->matcherid(),
+                                   key_i, mask_i, value_i,
+                                   request->key_byte_len(),
+                                   request->value_byte_len());
+
+            response->set_res(ok ? rp4::Res::OK : rp4::Res::FAIL);
+            config_changed();
+            return grpc::Status::OK;
+        }
+
+        grpc::Status modSramEntry(grpc::ServerContext *context, const rp4::ModSramEntryReq *request,
+                                  rp4::ModSramEntryResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            if(pipes == nullptr) {
+                return grpc::Status::CANCELLED;
+            }
+            if(!entry_lengths_ok("modSramEntry", request->key_byte_len(), request->key().size(),
+                                 request->value_byte_len(), request->value().size())) {
+                response->set_res(rp4::Res::FAIL);
+                return grpc::Status::OK;
+            }
+            Pipeline * ppl = pipes->entry_target(request->procid());
+
+            uint8_t key_i[request->key_byte_len()];
+            uint8_t value_i[request->value_byte_len()];
+            get_uint_from_bytes(request->key(), key_i);
+            get_uint_from_bytes(request->value(), value_i);
+            bool ok = ppl->modify_sram_entry(request->procid(),
+                                   request->matcherid(),
+                                   key_i, value_i,
+                                   request->key_byte_len(),
+                                   request->value_byte_len());
+
+            response->set_res(ok ? rp4::Res::OK : rp4::Res::FAIL);
+            config_changed();
+            return grpc::Status::OK;
+        }
+
+        grpc::Status delSramEntry(grpc::ServerContext *context, const rp4::DelSramEntryReq *request,
+                                  rp4::DelSramEntryResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            if(pipes == nullptr) {
+                return grpc::Status::CANCELLED;
+            }
+            if(!entry_lengths_ok("delSramEntry", request->key_byte_len(), request->key().size(), 0, 0)) {
+                response->set_res(rp4::Res::FAIL);
+                return grpc::Status::OK;
+            }
+            Pipeline * ppl = pipes->entry_target(request->procid());
+
+            uint8_t key_i[request->key_byte_len()];
+            get_uint_from_bytes(request->key(), key_i);
+            ExactTableStats stats;
+            bool ok = ppl->delete_sram_entry(request->procid(),
+                                   request->matcherid(),
+                                   key_i, request->key_byte_len(), &stats);
+
+            response->set_res(ok ? rp4::Res::OK : rp4::Res::FAIL);
+            response->set_occupancy(stats.occupancy);
+            config_changed();
+            return grpc::Status::OK;
+        }
+
+        grpc::Status modTcamEntry(grpc::ServerContext *context, const rp4::ModTcamEntryReq *request,
+                                  rp4::ModTcamEntryResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            if(pipes == nullptr) {
                 return grpc::Status::CANCELLED;
             }
+            if(!entry_lengths_ok("modTcamEntry", request->key_byte_len(), request->key().size(),
+                                 request->value_byte_len(), request->value().size(),
+                                 (long)request->mask().size())) {
+                response->set_res(rp4::Res::FAIL);
+                return grpc::Status::OK;
+            }
+            Pipeline * ppl = pipes->entry_target(request->procid());
 
             uint8_t key_i[request->key_byte_len()];
             uint8_t value_i[request->value_byte_len()];
@@ -294,17 +682,103 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
             uint8_t mask_i[request->mask().length()];
             get_uint_from_bytes(request->mask(), mask_i);
 
-            ppl->insert_tcam_entry(request->procid(),
+            bool ok = ppl->modify_tcam_entry(request->procid(),
                                    request->matcherid(),
                                    key_i, mask_i, value_i,
                                    request->key_byte_len(),
                                    request->value_byte_len());
 
+            response->set_res(ok ? rp4::Res::OK : rp4::Res::FAIL);
+            config_changed();
+            return grpc::Status::OK;
+        }
+
+        grpc::Status delTcamEntry(grpc::ServerContext *context, const rp4::DelTcamEntryReq *request,
+                                  rp4::DelTcamEntryResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            if(pipes == nullptr) {
+                return grpc::Status::CANCELLED;
+            }
+            if(!entry_lengths_ok("delTcamEntry", request->key_byte_len(), request->key().size(), 0, 0,
+                                 (long)request->mask().size())) {
+                response->set_res(rp4::Res::FAIL);
+                return grpc::Status::OK;
+            }
+            Pipeline * ppl = pipes->entry_target(request->procid());
+
+            uint8_t key_i[request->key_byte_len()];
+            get_uint_from_bytes(request->key(), key_i);
+
+            uint8_t mask_i[request->mask().length()];
+            get_uint_from_bytes(request->mask(), mask_i);
+
+            bool ok = ppl->delete_tcam_entry(request->procid(),
+                                   request->matcherid(),
+                                   key_i, mask_i,
+                                   request->key_byte_len());
+
+            response->set_res(ok ? rp4::Res::OK : rp4::Res::FAIL);
+            config_changed();
+            return grpc::Status::OK;
+        }
+
+        // the lock is taken per batch, other config calls may run between the batches of a long load
+        grpc::Status insertEntries(grpc::ServerContext *context, grpc::ServerReader<rp4::InsertEntriesReq> *reader,
+                                   rp4::InsertEntriesResp *response) override {
+            if(pipes == nullptr) {
+                return grpc::Status::CANCELLED;
+            }
+
+            rp4::InsertEntriesReq batch;
+            std::vector<uint8_t> entries;
+            int inserted = 0, failed = 0;
+            bool ok = true;
+            while(reader->Read(&batch)) {
+                std::lock_guard<std::recursive_mutex> lock(config_mu);
+                int key_len = batch.key_byte_len();
+                int mask_len = batch.ternary() ? key_len : 0;
+                int value_len = batch.value_byte_len();
+                int entry_len = key_len + mask_len + value_len;
+                if(key_len <= 0 || value_len < 0 || batch.entries().size() % entry_len != 0) {
+                    LOG(ERROR) << "insertEntries: batch of " << batch.entries().size()
+                               << " bytes does not split into entries of " << entry_len;
+                    ok = false;
+                    continue;
+                }
+                int num = batch.entries().size() / entry_len;
+                Pipeline * ppl = pipes->entry_target(batch.procid());
+
+                entries.assign(batch.entries().begin(), batch.entries().end());
+                for(int i = 0; i < num; i++) {
+                    uint8_t * key = entries.data() + (size_t)i * entry_len;
+                    uint8_t * value = key + key_len + mask_len;
+                    bool entry_ok = batch.ternary()
+                            ? ppl->insert_tcam_entry(batch.procid(), batch.matcherid(), key, key + key_len, value,
+                                                     key_len, value_len)
+                            : ppl->insert_sram_entry(batch.procid(), batch.matcherid(), key, value,
+                                                     key_len, value_len);
+                    if(entry_ok) {
+                        inserted++;
+                    } else {
+                        failed++;
+                    }
+                }
+                // the stream may stay open for long, flows cached before this batch must not outlive it
+                config_changed();
+            }
+
+            LOG(INFO) << "Bulk insert: " << inserted << " entries inserted, " << failed << " failed";
+            response->set_res(ok && failed == 0 ? rp4::Res::OK : rp4::Res::FAIL);
+            response->set_inserted(inserted);
+            response->set_failed(failed);
             return grpc::Status::OK;
         }
 
         grpc::Status insertAction(grpc::ServerContext *context, const rp4::InsertActionReq *request,
                                   rp4::InsertActionResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
@@ -345,27 +819,38 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
             ac->action_para_lens = _action_para_lens;
 
             ppl->insert_action(request->procid(), ac, request->actionid());
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status clearAction(grpc::ServerContext *context, const rp4::ClearActionReq *request,
                                   rp4::ClearActionResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
 
             ppl->clear_action(request->procid());
+            response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
         grpc::Status delAction(grpc::ServerContext *context, const rp4::DelActionReq *request,
                                   rp4::DelActionResp *response) override {
+            std::lock_guard<std::recursive_mutex> lock(config_mu);
+            OwnTxn txn(response);
+            Pipeline * ppl = config_target(request->procid());
             if(ppl == nullptr) {
                 return grpc::Status::CANCELLED;
             }
 
-            ppl->del_action(request->procid(), request->actionid());
-
+            bool ok = ppl->del_action(request->procid(), request->actionid());
+            response->set_res(ok ? rp4::Res::OK : rp4::Res::FAIL);
+            config_changed();
             return grpc::Status::OK;
         }
 
@@ -397,6 +882,7 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
 
             bool ok = NeuronPrimitiveManager::instance().upsert_context(ctx);
             response->set_res(ok ? rp4::Res::OK : rp4::Res::FAIL);
+            config_changed();
             return grpc::Status::OK;
         }
 
@@ -407,6 +893,7 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
             (void)request;
             NeuronPrimitiveManager::instance().clear();
             response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
@@ -416,6 +903,7 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
             (void)context;
             if (request->points_size() == 0) {
                 response->set_res(rp4::Res::FAIL);
+                config_changed();
                 return grpc::Status::OK;
             }
 
@@ -448,6 +936,7 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
             if (!ok) {
                 LOG(ERROR) << "Sigmoid table: missing entries between " << min_input << " and " << max_input;
                 response->set_res(rp4::Res::FAIL);
+                config_changed();
                 return grpc::Status::OK;
             }
 
@@ -457,6 +946,7 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
                                                                      input_multiplier,
                                                                      values);
             response->set_res(loaded ? rp4::Res::OK : rp4::Res::FAIL);
+            config_changed();
             return grpc::Status::OK;
         }
 
@@ -467,6 +957,7 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
             (void)request;
             SigmoidTableManager::instance().clear();
             response->set_res(rp4::Res::OK);
+            config_changed();
             return grpc::Status::OK;
         }
 
@@ -476,6 +967,7 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
             (void)context;
             if (request->points_size() == 0) {
                 response->set_res(rp4::Res::FAIL);
+                config_changed();
                 return grpc::Status::OK;
             }
 
@@ -512,9 +1004,21 @@ class CfgServiceImpl final : public rp4::CfgService::Service {
             if (!ok) {
                 LOG(ERROR) << "Exp table: missing entries between " << min_input << " and " << max_input;
                 response->set_res(rp4::Res::FAIL);
+                config_changed();
                 return grpc::Status::OK;
             }
 
+            response->set_res(rp4::Res::OK);
+            config_changed();
+            return grpc::Status::OK;
+        }
+
+        // loadExpTable only validates the points, there is no table to drop
+        grpc::Status clearExpTable(grpc::ServerContext *context,
+                                   const rp4::ClearExpTableReq *request,
+                                   rp4::ClearExpTableResp *response) override {
+            (void)context;
+            (void)request;
             response->set_res(rp4::Res::OK);
             return grpc::Status::OK;
         }
@@ -749,8 +1253,8 @@ private:
 
     };
 
-    static inline void RunServer(Pipeline *pipe) {
-        ppl = pipe;
+    static inline void RunServer(PipelineHandle *_pipes) {
+        pipes = _pipes;
 
         std::string server_address("0.0.0.0:50051");
         CfgServiceImpl service;
@@ -759,11 +1263,23 @@ private:
         grpc::reflection::InitProtoReflectionServerBuilderPlugin();
         grpc::ServerBuilder builder;
         builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+        // a whole-pipeline config bundle easily passes the 4 MB default
+        builder.SetMaxReceiveMessageSize(-1);
         builder.RegisterService(&service);
 
         std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
         std::cout << "Server listening on " << server_address << std::endl;
 
+        // old pipelines are otherwise only deleted on the next config call, however long that takes
+        std::thread reclaimer([] {
+            while(true) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(PIPELINE_RECLAIM_INTERVAL_MS));
+                std::lock_guard<std::recursive_mutex> lock(config_mu);
+                pipes->reclaim();
+            }
+        });
+        reclaimer.detach();
+
         server->Wait();
     }
 
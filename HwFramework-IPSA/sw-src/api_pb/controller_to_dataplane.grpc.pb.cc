@@ -23,6 +23,10 @@ namespace rp4 {
 
 static const char* CfgService_method_names[] = {
   "/rp4.CfgService/setMetadata",
+  "/rp4.CfgService/beginConfig",
+  "/rp4.CfgService/commitConfig",
+  "/rp4.CfgService/abortConfig",
+  "/rp4.CfgService/applyConfig",
   "/rp4.CfgService/initParserLevel",
   "/rp4.CfgService/modParserEntry",
   "/rp4.CfgService/clearParser",
@@ -39,6 +43,11 @@ static const char* CfgService_method_names[] = {
   "/rp4.CfgService/setMissActId",
   "/rp4.CfgService/insertSramEntry",
   "/rp4.CfgService/insertTcamEntry",
+  "/rp4.CfgService/modSramEntry",
+  "/rp4.CfgService/delSramEntry",
+  "/rp4.CfgService/modTcamEntry",
+  "/rp4.CfgService/delTcamEntry",
+  "/rp4.CfgService/insertEntries",
   "/rp4.CfgService/insertAction",
   "/rp4.CfgService/clearAction",
   "/rp4.CfgService/delAction",
@@ -58,31 +67,40 @@ std::unique_ptr< CfgService::Stub> CfgService::NewStub(const std::shared_ptr< ::
 
 CfgService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
   : channel_(channel), rpcmethod_setMetadata_(CfgService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_initParserLevel_(CfgService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_modParserEntry_(CfgService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_clearParser_(CfgService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_insertRelationExp_(CfgService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_clearRelationExp_(CfgService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_clearResMap_(CfgService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_modResMap_(CfgService_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_setDefaultGateEntry_(CfgService_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_setNoTable_(CfgService_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_setActionProc_(CfgService_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_setMemConfig_(CfgService_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_setFieldInfo_(CfgService_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_clearOldConfig_(CfgService_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_setMissActId_(CfgService_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_insertSramEntry_(CfgService_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_insertTcamEntry_(CfgService_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_insertAction_(CfgService_method_names[17], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_clearAction_(CfgService_method_names[18], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_delAction_(CfgService_method_names[19], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_loadSigmoidTable_(CfgService_method_names[20], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_clearSigmoidTable_(CfgService_method_names[21], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_loadExpTable_(CfgService_method_names[22], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_clearExpTable_(CfgService_method_names[23], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_loadNeuronPrimitiveContext_(CfgService_method_names[24], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_clearNeuronPrimitiveContexts_(CfgService_method_names[25], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_beginConfig_(CfgService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_commitConfig_(CfgService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_abortConfig_(CfgService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_applyConfig_(CfgService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_initParserLevel_(CfgService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_modParserEntry_(CfgService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_clearParser_(CfgService_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_insertRelationExp_(CfgService_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_clearRelationExp_(CfgService_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_clearResMap_(CfgService_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_modResMap_(CfgService_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_setDefaultGateEntry_(CfgService_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_setNoTable_(CfgService_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_setActionProc_(CfgService_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_setMemConfig_(CfgService_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_setFieldInfo_(CfgService_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_clearOldConfig_(CfgService_method_names[17], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_setMissActId_(CfgService_method_names[18], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_insertSramEntry_(CfgService_method_names[19], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_insertTcamEntry_(CfgService_method_names[20], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_modSramEntry_(CfgService_method_names[21], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_delSramEntry_(CfgService_method_names[22], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_modTcamEntry_(CfgService_method_names[23], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_delTcamEntry_(CfgService_method_names[24], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_insertEntries_(CfgService_method_names[25], options.suffix_for_stats(),::grpc::internal::RpcMethod::CLIENT_STREAMING, channel)
+  , rpcmethod_insertAction_(CfgService_method_names[26], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_clearAction_(CfgService_method_names[27], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_delAction_(CfgService_method_names[28], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_loadSigmoidTable_(CfgService_method_names[29], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_clearSigmoidTable_(CfgService_method_names[30], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_loadExpTable_(CfgService_method_names[31], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_clearExpTable_(CfgService_method_names[32], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_loadNeuronPrimitiveContext_(CfgService_method_names[33], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_clearNeuronPrimitiveContexts_(CfgService_method_names[34], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status CfgService::Stub::setMetadata(::grpc::ClientContext* context, const ::rp4::SetMetadataReq& request, ::rp4::SetMetadataResp* response) {
@@ -108,6 +126,98 @@ void CfgService::Stub::async::setMetadata(::grpc::ClientContext* context, const
   return result;
 }
 
+::grpc::Status CfgService::Stub::beginConfig(::grpc::ClientContext* context, const ::rp4::BeginConfigReq& request, ::rp4::BeginConfigResp* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::rp4::BeginConfigReq, ::rp4::BeginConfigResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_beginConfig_, context, request, response);
+}
+
+void CfgService::Stub::async::beginConfig(::grpc::ClientContext* context, const ::rp4::BeginConfigReq* request, ::rp4::BeginConfigResp* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::rp4::BeginConfigReq, ::rp4::BeginConfigResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_beginConfig_, context, request, response, std::move(f));
+}
+
+void CfgService::Stub::async::beginConfig(::grpc::ClientContext* context, const ::rp4::BeginConfigReq* request, ::rp4::BeginConfigResp* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_beginConfig_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::BeginConfigResp>* CfgService::Stub::PrepareAsyncbeginConfigRaw(::grpc::ClientContext* context, const ::rp4::BeginConfigReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::rp4::BeginConfigResp, ::rp4::BeginConfigReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_beginConfig_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::BeginConfigResp>* CfgService::Stub::AsyncbeginConfigRaw(::grpc::ClientContext* context, const ::rp4::BeginConfigReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncbeginConfigRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status CfgService::Stub::commitConfig(::grpc::ClientContext* context, const ::rp4::CommitConfigReq& request, ::rp4::CommitConfigResp* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::rp4::CommitConfigReq, ::rp4::CommitConfigResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_commitConfig_, context, request, response);
+}
+
+void CfgService::Stub::async::commitConfig(::grpc::ClientContext* context, const ::rp4::CommitConfigReq* request, ::rp4::CommitConfigResp* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::rp4::CommitConfigReq, ::rp4::CommitConfigResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_commitConfig_, context, request, response, std::move(f));
+}
+
+void CfgService::Stub::async::commitConfig(::grpc::ClientContext* context, const ::rp4::CommitConfigReq* request, ::rp4::CommitConfigResp* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_commitConfig_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::CommitConfigResp>* CfgService::Stub::PrepareAsynccommitConfigRaw(::grpc::ClientContext* context, const ::rp4::CommitConfigReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::rp4::CommitConfigResp, ::rp4::CommitConfigReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_commitConfig_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::CommitConfigResp>* CfgService::Stub::AsynccommitConfigRaw(::grpc::ClientContext* context, const ::rp4::CommitConfigReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsynccommitConfigRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status CfgService::Stub::abortConfig(::grpc::ClientContext* context, const ::rp4::AbortConfigReq& request, ::rp4::AbortConfigResp* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::rp4::AbortConfigReq, ::rp4::AbortConfigResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_abortConfig_, context, request, response);
+}
+
+void CfgService::Stub::async::abortConfig(::grpc::ClientContext* context, const ::rp4::AbortConfigReq* request, ::rp4::AbortConfigResp* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::rp4::AbortConfigReq, ::rp4::AbortConfigResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_abortConfig_, context, request, response, std::move(f));
+}
+
+void CfgService::Stub::async::abortConfig(::grpc::ClientContext* context, const ::rp4::AbortConfigReq* request, ::rp4::AbortConfigResp* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_abortConfig_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::AbortConfigResp>* CfgService::Stub::PrepareAsyncabortConfigRaw(::grpc::ClientContext* context, const ::rp4::AbortConfigReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::rp4::AbortConfigResp, ::rp4::AbortConfigReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_abortConfig_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::AbortConfigResp>* CfgService::Stub::AsyncabortConfigRaw(::grpc::ClientContext* context, const ::rp4::AbortConfigReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncabortConfigRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status CfgService::Stub::applyConfig(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq& request, ::rp4::ApplyConfigResp* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::rp4::ApplyConfigReq, ::rp4::ApplyConfigResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_applyConfig_, context, request, response);
+}
+
+void CfgService::Stub::async::applyConfig(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq* request, ::rp4::ApplyConfigResp* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::rp4::ApplyConfigReq, ::rp4::ApplyConfigResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_applyConfig_, context, request, response, std::move(f));
+}
+
+void CfgService::Stub::async::applyConfig(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq* request, ::rp4::ApplyConfigResp* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_applyConfig_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::ApplyConfigResp>* CfgService::Stub::PrepareAsyncapplyConfigRaw(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::rp4::ApplyConfigResp, ::rp4::ApplyConfigReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_applyConfig_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::ApplyConfigResp>* CfgService::Stub::AsyncapplyConfigRaw(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncapplyConfigRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status CfgService::Stub::initParserLevel(::grpc::ClientContext* context, const ::rp4::ParserLevelReq& request, ::rp4::ParserLevelResp* response) {
   return ::grpc::internal::BlockingUnaryCall< ::rp4::ParserLevelReq, ::rp4::ParserLevelResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_initParserLevel_, context, request, response);
 }
@@ -476,6 +586,114 @@ void CfgService::Stub::async::insertTcamEntry(::grpc::ClientContext* context, co
   return result;
 }
 
+::grpc::Status CfgService::Stub::modSramEntry(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq& request, ::rp4::ModSramEntryResp* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::rp4::ModSramEntryReq, ::rp4::ModSramEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_modSramEntry_, context, request, response);
+}
+
+void CfgService::Stub::async::modSramEntry(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq* request, ::rp4::ModSramEntryResp* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::rp4::ModSramEntryReq, ::rp4::ModSramEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_modSramEntry_, context, request, response, std::move(f));
+}
+
+void CfgService::Stub::async::modSramEntry(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq* request, ::rp4::ModSramEntryResp* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_modSramEntry_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::ModSramEntryResp>* CfgService::Stub::PrepareAsyncmodSramEntryRaw(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::rp4::ModSramEntryResp, ::rp4::ModSramEntryReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_modSramEntry_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::ModSramEntryResp>* CfgService::Stub::AsyncmodSramEntryRaw(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncmodSramEntryRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status CfgService::Stub::delSramEntry(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq& request, ::rp4::DelSramEntryResp* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::rp4::DelSramEntryReq, ::rp4::DelSramEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_delSramEntry_, context, request, response);
+}
+
+void CfgService::Stub::async::delSramEntry(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq* request, ::rp4::DelSramEntryResp* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::rp4::DelSramEntryReq, ::rp4::DelSramEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_delSramEntry_, context, request, response, std::move(f));
+}
+
+void CfgService::Stub::async::delSramEntry(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq* request, ::rp4::DelSramEntryResp* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_delSramEntry_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::DelSramEntryResp>* CfgService::Stub::PrepareAsyncdelSramEntryRaw(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::rp4::DelSramEntryResp, ::rp4::DelSramEntryReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_delSramEntry_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::DelSramEntryResp>* CfgService::Stub::AsyncdelSramEntryRaw(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncdelSramEntryRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status CfgService::Stub::modTcamEntry(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq& request, ::rp4::ModTcamEntryResp* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::rp4::ModTcamEntryReq, ::rp4::ModTcamEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_modTcamEntry_, context, request, response);
+}
+
+void CfgService::Stub::async::modTcamEntry(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq* request, ::rp4::ModTcamEntryResp* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::rp4::ModTcamEntryReq, ::rp4::ModTcamEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_modTcamEntry_, context, request, response, std::move(f));
+}
+
+void CfgService::Stub::async::modTcamEntry(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq* request, ::rp4::ModTcamEntryResp* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_modTcamEntry_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::ModTcamEntryResp>* CfgService::Stub::PrepareAsyncmodTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::rp4::ModTcamEntryResp, ::rp4::ModTcamEntryReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_modTcamEntry_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::ModTcamEntryResp>* CfgService::Stub::AsyncmodTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncmodTcamEntryRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status CfgService::Stub::delTcamEntry(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq& request, ::rp4::DelTcamEntryResp* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::rp4::DelTcamEntryReq, ::rp4::DelTcamEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_delTcamEntry_, context, request, response);
+}
+
+void CfgService::Stub::async::delTcamEntry(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq* request, ::rp4::DelTcamEntryResp* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::rp4::DelTcamEntryReq, ::rp4::DelTcamEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_delTcamEntry_, context, request, response, std::move(f));
+}
+
+void CfgService::Stub::async::delTcamEntry(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq* request, ::rp4::DelTcamEntryResp* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_delTcamEntry_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::DelTcamEntryResp>* CfgService::Stub::PrepareAsyncdelTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::rp4::DelTcamEntryResp, ::rp4::DelTcamEntryReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_delTcamEntry_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::rp4::DelTcamEntryResp>* CfgService::Stub::AsyncdelTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncdelTcamEntryRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientWriter< ::rp4::InsertEntriesReq>* CfgService::Stub::insertEntriesRaw(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response) {
+  return ::grpc::internal::ClientWriterFactory< ::rp4::InsertEntriesReq>::Create(channel_.get(), rpcmethod_insertEntries_, context, response);
+}
+
+void CfgService::Stub::async::insertEntries(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response, ::grpc::ClientWriteReactor< ::rp4::InsertEntriesReq>* reactor) {
+  ::grpc::internal::ClientCallbackWriterFactory< ::rp4::InsertEntriesReq>::Create(stub_->channel_.get(), stub_->rpcmethod_insertEntries_, context, response, reactor);
+}
+
+::grpc::ClientAsyncWriter< ::rp4::InsertEntriesReq>* CfgService::Stub::AsyncinsertEntriesRaw(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::rp4::InsertEntriesReq>::Create(channel_.get(), cq, rpcmethod_insertEntries_, context, response, true, tag);
+}
+
+::grpc::ClientAsyncWriter< ::rp4::InsertEntriesReq>* CfgService::Stub::PrepareAsyncinsertEntriesRaw(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::rp4::InsertEntriesReq>::Create(channel_.get(), cq, rpcmethod_insertEntries_, context, response, false, nullptr);
+}
+
 ::grpc::Status CfgService::Stub::insertAction(::grpc::ClientContext* context, const ::rp4::InsertActionReq& request, ::rp4::InsertActionResp* response) {
   return ::grpc::internal::BlockingUnaryCall< ::rp4::InsertActionReq, ::rp4::InsertActionResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_insertAction_, context, request, response);
 }
@@ -697,6 +915,46 @@ CfgService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       CfgService_method_names[1],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::BeginConfigReq, ::rp4::BeginConfigResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](CfgService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::rp4::BeginConfigReq* req,
+             ::rp4::BeginConfigResp* resp) {
+               return service->beginConfig(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      CfgService_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::CommitConfigReq, ::rp4::CommitConfigResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](CfgService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::rp4::CommitConfigReq* req,
+             ::rp4::CommitConfigResp* resp) {
+               return service->commitConfig(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      CfgService_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::AbortConfigReq, ::rp4::AbortConfigResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](CfgService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::rp4::AbortConfigReq* req,
+             ::rp4::AbortConfigResp* resp) {
+               return service->abortConfig(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      CfgService_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::ApplyConfigReq, ::rp4::ApplyConfigResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](CfgService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::rp4::ApplyConfigReq* req,
+             ::rp4::ApplyConfigResp* resp) {
+               return service->applyConfig(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      CfgService_method_names[5],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::ParserLevelReq, ::rp4::ParserLevelResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
              ::grpc::ServerContext* ctx,
@@ -705,7 +963,7 @@ CfgService::Service::Service() {
                return service->initParserLevel(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[2],
+      CfgService_method_names[6],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::ModParserEntryReq, ::rp4::ModParserEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -715,7 +973,7 @@ CfgService::Service::Service() {
                return service->modParserEntry(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[3],
+      CfgService_method_names[7],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::ClearParserReq, ::rp4::ClearParserResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -725,7 +983,7 @@ CfgService::Service::Service() {
                return service->clearParser(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[4],
+      CfgService_method_names[8],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::InsertRelationExpReq, ::rp4::InsertRelationExpResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -735,7 +993,7 @@ CfgService::Service::Service() {
                return service->insertRelationExp(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[5],
+      CfgService_method_names[9],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::ClearRelationExpReq, ::rp4::ClearRelationExpResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -745,7 +1003,7 @@ CfgService::Service::Service() {
                return service->clearRelationExp(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[6],
+      CfgService_method_names[10],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::ClearResMapReq, ::rp4::ClearResMapResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -755,7 +1013,7 @@ CfgService::Service::Service() {
                return service->clearResMap(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[7],
+      CfgService_method_names[11],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::ModResMapReq, ::rp4::ModResMapResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -765,7 +1023,7 @@ CfgService::Service::Service() {
                return service->modResMap(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[8],
+      CfgService_method_names[12],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::SetDefaultGateEntryReq, ::rp4::SetDefaultGateEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -775,7 +1033,7 @@ CfgService::Service::Service() {
                return service->setDefaultGateEntry(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[9],
+      CfgService_method_names[13],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::SetNoTableReq, ::rp4::SetNoTableResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -785,7 +1043,7 @@ CfgService::Service::Service() {
                return service->setNoTable(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[10],
+      CfgService_method_names[14],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::SetActionProcReq, ::rp4::SetActionProcResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -795,7 +1053,7 @@ CfgService::Service::Service() {
                return service->setActionProc(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[11],
+      CfgService_method_names[15],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::SetMemConfigReq, ::rp4::SetMemConfigResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -805,7 +1063,7 @@ CfgService::Service::Service() {
                return service->setMemConfig(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[12],
+      CfgService_method_names[16],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::SetFieldInfoReq, ::rp4::SetFieldInfoResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -815,7 +1073,7 @@ CfgService::Service::Service() {
                return service->setFieldInfo(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[13],
+      CfgService_method_names[17],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::ClearOldConfigReq, ::rp4::ClearOldConfigResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -825,7 +1083,7 @@ CfgService::Service::Service() {
                return service->clearOldConfig(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[14],
+      CfgService_method_names[18],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::SetMissActIdReq, ::rp4::SetMissActIdResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -835,7 +1093,7 @@ CfgService::Service::Service() {
                return service->setMissActId(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[15],
+      CfgService_method_names[19],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::InsertSramEntryReq, ::rp4::InsertSramEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -845,7 +1103,7 @@ CfgService::Service::Service() {
                return service->insertSramEntry(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[16],
+      CfgService_method_names[20],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::InsertTcamEntryReq, ::rp4::InsertTcamEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -855,7 +1113,57 @@ CfgService::Service::Service() {
                return service->insertTcamEntry(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[17],
+      CfgService_method_names[21],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::ModSramEntryReq, ::rp4::ModSramEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](CfgService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::rp4::ModSramEntryReq* req,
+             ::rp4::ModSramEntryResp* resp) {
+               return service->modSramEntry(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      CfgService_method_names[22],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::DelSramEntryReq, ::rp4::DelSramEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](CfgService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::rp4::DelSramEntryReq* req,
+             ::rp4::DelSramEntryResp* resp) {
+               return service->delSramEntry(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      CfgService_method_names[23],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::ModTcamEntryReq, ::rp4::ModTcamEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](CfgService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::rp4::ModTcamEntryReq* req,
+             ::rp4::ModTcamEntryResp* resp) {
+               return service->modTcamEntry(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      CfgService_method_names[24],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::DelTcamEntryReq, ::rp4::DelTcamEntryResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](CfgService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::rp4::DelTcamEntryReq* req,
+             ::rp4::DelTcamEntryResp* resp) {
+               return service->delTcamEntry(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      CfgService_method_names[25],
+      ::grpc::internal::RpcMethod::CLIENT_STREAMING,
+      new ::grpc::internal::ClientStreamingHandler< CfgService::Service, ::rp4::InsertEntriesReq, ::rp4::InsertEntriesResp>(
+          [](CfgService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReader<::rp4::InsertEntriesReq>* reader,
+             ::rp4::InsertEntriesResp* resp) {
+               return service->insertEntries(ctx, reader, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      CfgService_method_names[26],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::InsertActionReq, ::rp4::InsertActionResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -865,7 +1173,7 @@ CfgService::Service::Service() {
                return service->insertAction(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[18],
+      CfgService_method_names[27],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::ClearActionReq, ::rp4::ClearActionResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -875,7 +1183,7 @@ CfgService::Service::Service() {
                return service->clearAction(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[19],
+      CfgService_method_names[28],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::DelActionReq, ::rp4::DelActionResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -885,7 +1193,7 @@ CfgService::Service::Service() {
                return service->delAction(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[20],
+      CfgService_method_names[29],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::LoadSigmoidTableReq, ::rp4::LoadSigmoidTableResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -895,7 +1203,7 @@ CfgService::Service::Service() {
                return service->loadSigmoidTable(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[21],
+      CfgService_method_names[30],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::ClearSigmoidTableReq, ::rp4::ClearSigmoidTableResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -905,7 +1213,7 @@ CfgService::Service::Service() {
                return service->clearSigmoidTable(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[22],
+      CfgService_method_names[31],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::LoadExpTableReq, ::rp4::LoadExpTableResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -915,7 +1223,7 @@ CfgService::Service::Service() {
                return service->loadExpTable(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[23],
+      CfgService_method_names[32],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::ClearExpTableReq, ::rp4::ClearExpTableResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -925,7 +1233,7 @@ CfgService::Service::Service() {
                return service->clearExpTable(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[24],
+      CfgService_method_names[33],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::LoadNeuronPrimitiveContextReq, ::rp4::LoadNeuronPrimitiveContextResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -935,7 +1243,7 @@ CfgService::Service::Service() {
                return service->loadNeuronPrimitiveContext(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      CfgService_method_names[25],
+      CfgService_method_names[34],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< CfgService::Service, ::rp4::ClearNeuronPrimitiveContextsReq, ::rp4::ClearNeuronPrimitiveContextsResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](CfgService::Service* service,
@@ -956,6 +1264,34 @@ CfgService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status CfgService::Service::beginConfig(::grpc::ServerContext* context, const ::rp4::BeginConfigReq* request, ::rp4::BeginConfigResp* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status CfgService::Service::commitConfig(::grpc::ServerContext* context, const ::rp4::CommitConfigReq* request, ::rp4::CommitConfigResp* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status CfgService::Service::abortConfig(::grpc::ServerContext* context, const ::rp4::AbortConfigReq* request, ::rp4::AbortConfigResp* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status CfgService::Service::applyConfig(::grpc::ServerContext* context, const ::rp4::ApplyConfigReq* request, ::rp4::ApplyConfigResp* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status CfgService::Service::initParserLevel(::grpc::ServerContext* context, const ::rp4::ParserLevelReq* request, ::rp4::ParserLevelResp* response) {
   (void) context;
   (void) request;
@@ -1068,6 +1404,41 @@ CfgService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status CfgService::Service::modSramEntry(::grpc::ServerContext* context, const ::rp4::ModSramEntryReq* request, ::rp4::ModSramEntryResp* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status CfgService::Service::delSramEntry(::grpc::ServerContext* context, const ::rp4::DelSramEntryReq* request, ::rp4::DelSramEntryResp* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status CfgService::Service::modTcamEntry(::grpc::ServerContext* context, const ::rp4::ModTcamEntryReq* request, ::rp4::ModTcamEntryResp* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status CfgService::Service::delTcamEntry(::grpc::ServerContext* context, const ::rp4::DelTcamEntryReq* request, ::rp4::DelTcamEntryResp* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status CfgService::Service::insertEntries(::grpc::ServerContext* context, ::grpc::ServerReader< ::rp4::InsertEntriesReq>* reader, ::rp4::InsertEntriesResp* response) {
+  (void) context;
+  (void) reader;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status CfgService::Service::insertAction(::grpc::ServerContext* context, const ::rp4::InsertActionReq* request, ::rp4::InsertActionResp* response) {
   (void) context;
   (void) request;
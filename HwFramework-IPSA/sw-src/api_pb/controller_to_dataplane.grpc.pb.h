@@ -43,6 +43,37 @@ class CfgService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::SetMetadataResp>> PrepareAsyncsetMetadata(::grpc::ClientContext* context, const ::rp4::SetMetadataReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::SetMetadataResp>>(PrepareAsyncsetMetadataRaw(context, request, cq));
     }
+    // ***** config transaction ****
+    // config calls between begin and commit build a shadow pipeline, commit swaps it in at once
+    virtual ::grpc::Status beginConfig(::grpc::ClientContext* context, const ::rp4::BeginConfigReq& request, ::rp4::BeginConfigResp* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::BeginConfigResp>> AsyncbeginConfig(::grpc::ClientContext* context, const ::rp4::BeginConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::BeginConfigResp>>(AsyncbeginConfigRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::BeginConfigResp>> PrepareAsyncbeginConfig(::grpc::ClientContext* context, const ::rp4::BeginConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::BeginConfigResp>>(PrepareAsyncbeginConfigRaw(context, request, cq));
+    }
+    virtual ::grpc::Status commitConfig(::grpc::ClientContext* context, const ::rp4::CommitConfigReq& request, ::rp4::CommitConfigResp* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::CommitConfigResp>> AsynccommitConfig(::grpc::ClientContext* context, const ::rp4::CommitConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::CommitConfigResp>>(AsynccommitConfigRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::CommitConfigResp>> PrepareAsynccommitConfig(::grpc::ClientContext* context, const ::rp4::CommitConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::CommitConfigResp>>(PrepareAsynccommitConfigRaw(context, request, cq));
+    }
+    virtual ::grpc::Status abortConfig(::grpc::ClientContext* context, const ::rp4::AbortConfigReq& request, ::rp4::AbortConfigResp* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::AbortConfigResp>> AsyncabortConfig(::grpc::ClientContext* context, const ::rp4::AbortConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::AbortConfigResp>>(AsyncabortConfigRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::AbortConfigResp>> PrepareAsyncabortConfig(::grpc::ClientContext* context, const ::rp4::AbortConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::AbortConfigResp>>(PrepareAsyncabortConfigRaw(context, request, cq));
+    }
+    // a whole config in one call, applied as one transaction unless one is already open
+    virtual ::grpc::Status applyConfig(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq& request, ::rp4::ApplyConfigResp* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ApplyConfigResp>> AsyncapplyConfig(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ApplyConfigResp>>(AsyncapplyConfigRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ApplyConfigResp>> PrepareAsyncapplyConfig(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ApplyConfigResp>>(PrepareAsyncapplyConfigRaw(context, request, cq));
+    }
     // **** parser ****
     virtual ::grpc::Status initParserLevel(::grpc::ClientContext* context, const ::rp4::ParserLevelReq& request, ::rp4::ParserLevelResp* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ParserLevelResp>> AsyncinitParserLevel(::grpc::ClientContext* context, const ::rp4::ParserLevelReq& request, ::grpc::CompletionQueue* cq) {
@@ -161,6 +192,44 @@ class CfgService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::InsertTcamEntryResp>> PrepareAsyncinsertTcamEntry(::grpc::ClientContext* context, const ::rp4::InsertTcamEntryReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::InsertTcamEntryResp>>(PrepareAsyncinsertTcamEntryRaw(context, request, cq));
     }
+    virtual ::grpc::Status modSramEntry(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq& request, ::rp4::ModSramEntryResp* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ModSramEntryResp>> AsyncmodSramEntry(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ModSramEntryResp>>(AsyncmodSramEntryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ModSramEntryResp>> PrepareAsyncmodSramEntry(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ModSramEntryResp>>(PrepareAsyncmodSramEntryRaw(context, request, cq));
+    }
+    virtual ::grpc::Status delSramEntry(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq& request, ::rp4::DelSramEntryResp* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::DelSramEntryResp>> AsyncdelSramEntry(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::DelSramEntryResp>>(AsyncdelSramEntryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::DelSramEntryResp>> PrepareAsyncdelSramEntry(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::DelSramEntryResp>>(PrepareAsyncdelSramEntryRaw(context, request, cq));
+    }
+    virtual ::grpc::Status modTcamEntry(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq& request, ::rp4::ModTcamEntryResp* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ModTcamEntryResp>> AsyncmodTcamEntry(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ModTcamEntryResp>>(AsyncmodTcamEntryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ModTcamEntryResp>> PrepareAsyncmodTcamEntry(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ModTcamEntryResp>>(PrepareAsyncmodTcamEntryRaw(context, request, cq));
+    }
+    virtual ::grpc::Status delTcamEntry(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq& request, ::rp4::DelTcamEntryResp* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::DelTcamEntryResp>> AsyncdelTcamEntry(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::DelTcamEntryResp>>(AsyncdelTcamEntryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::DelTcamEntryResp>> PrepareAsyncdelTcamEntry(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::DelTcamEntryResp>>(PrepareAsyncdelTcamEntryRaw(context, request, cq));
+    }
+    // bulk load: batches of entries streamed in, one reply at the end
+    std::unique_ptr< ::grpc::ClientWriterInterface< ::rp4::InsertEntriesReq>> insertEntries(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response) {
+      return std::unique_ptr< ::grpc::ClientWriterInterface< ::rp4::InsertEntriesReq>>(insertEntriesRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::rp4::InsertEntriesReq>> AsyncinsertEntries(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::rp4::InsertEntriesReq>>(AsyncinsertEntriesRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::rp4::InsertEntriesReq>> PrepareAsyncinsertEntries(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::rp4::InsertEntriesReq>>(PrepareAsyncinsertEntriesRaw(context, response, cq));
+    }
     // ***** executor ******
     virtual ::grpc::Status insertAction(::grpc::ClientContext* context, const ::rp4::InsertActionReq& request, ::rp4::InsertActionResp* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::rp4::InsertActionResp>> AsyncinsertAction(::grpc::ClientContext* context, const ::rp4::InsertActionReq& request, ::grpc::CompletionQueue* cq) {
@@ -232,6 +301,17 @@ class CfgService final {
       // ***** metadata ****
       virtual void setMetadata(::grpc::ClientContext* context, const ::rp4::SetMetadataReq* request, ::rp4::SetMetadataResp* response, std::function<void(::grpc::Status)>) = 0;
       virtual void setMetadata(::grpc::ClientContext* context, const ::rp4::SetMetadataReq* request, ::rp4::SetMetadataResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // ***** config transaction ****
+      // config calls between begin and commit build a shadow pipeline, commit swaps it in at once
+      virtual void beginConfig(::grpc::ClientContext* context, const ::rp4::BeginConfigReq* request, ::rp4::BeginConfigResp* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void beginConfig(::grpc::ClientContext* context, const ::rp4::BeginConfigReq* request, ::rp4::BeginConfigResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void commitConfig(::grpc::ClientContext* context, const ::rp4::CommitConfigReq* request, ::rp4::CommitConfigResp* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void commitConfig(::grpc::ClientContext* context, const ::rp4::CommitConfigReq* request, ::rp4::CommitConfigResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void abortConfig(::grpc::ClientContext* context, const ::rp4::AbortConfigReq* request, ::rp4::AbortConfigResp* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void abortConfig(::grpc::ClientContext* context, const ::rp4::AbortConfigReq* request, ::rp4::AbortConfigResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // a whole config in one call, applied as one transaction unless one is already open
+      virtual void applyConfig(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq* request, ::rp4::ApplyConfigResp* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void applyConfig(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq* request, ::rp4::ApplyConfigResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // **** parser ****
       virtual void initParserLevel(::grpc::ClientContext* context, const ::rp4::ParserLevelReq* request, ::rp4::ParserLevelResp* response, std::function<void(::grpc::Status)>) = 0;
       virtual void initParserLevel(::grpc::ClientContext* context, const ::rp4::ParserLevelReq* request, ::rp4::ParserLevelResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
@@ -270,6 +350,16 @@ class CfgService final {
       virtual void insertSramEntry(::grpc::ClientContext* context, const ::rp4::InsertSramEntryReq* request, ::rp4::InsertSramEntryResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void insertTcamEntry(::grpc::ClientContext* context, const ::rp4::InsertTcamEntryReq* request, ::rp4::InsertTcamEntryResp* response, std::function<void(::grpc::Status)>) = 0;
       virtual void insertTcamEntry(::grpc::ClientContext* context, const ::rp4::InsertTcamEntryReq* request, ::rp4::InsertTcamEntryResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void modSramEntry(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq* request, ::rp4::ModSramEntryResp* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void modSramEntry(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq* request, ::rp4::ModSramEntryResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void delSramEntry(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq* request, ::rp4::DelSramEntryResp* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void delSramEntry(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq* request, ::rp4::DelSramEntryResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void modTcamEntry(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq* request, ::rp4::ModTcamEntryResp* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void modTcamEntry(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq* request, ::rp4::ModTcamEntryResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void delTcamEntry(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq* request, ::rp4::DelTcamEntryResp* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void delTcamEntry(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq* request, ::rp4::DelTcamEntryResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // bulk load: batches of entries streamed in, one reply at the end
+      virtual void insertEntries(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response, ::grpc::ClientWriteReactor< ::rp4::InsertEntriesReq>* reactor) = 0;
       // ***** executor ******
       virtual void insertAction(::grpc::ClientContext* context, const ::rp4::InsertActionReq* request, ::rp4::InsertActionResp* response, std::function<void(::grpc::Status)>) = 0;
       virtual void insertAction(::grpc::ClientContext* context, const ::rp4::InsertActionReq* request, ::rp4::InsertActionResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
@@ -297,6 +387,14 @@ class CfgService final {
    private:
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::SetMetadataResp>* AsyncsetMetadataRaw(::grpc::ClientContext* context, const ::rp4::SetMetadataReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::SetMetadataResp>* PrepareAsyncsetMetadataRaw(::grpc::ClientContext* context, const ::rp4::SetMetadataReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::BeginConfigResp>* AsyncbeginConfigRaw(::grpc::ClientContext* context, const ::rp4::BeginConfigReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::BeginConfigResp>* PrepareAsyncbeginConfigRaw(::grpc::ClientContext* context, const ::rp4::BeginConfigReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::CommitConfigResp>* AsynccommitConfigRaw(::grpc::ClientContext* context, const ::rp4::CommitConfigReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::CommitConfigResp>* PrepareAsynccommitConfigRaw(::grpc::ClientContext* context, const ::rp4::CommitConfigReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::AbortConfigResp>* AsyncabortConfigRaw(::grpc::ClientContext* context, const ::rp4::AbortConfigReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::AbortConfigResp>* PrepareAsyncabortConfigRaw(::grpc::ClientContext* context, const ::rp4::AbortConfigReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ApplyConfigResp>* AsyncapplyConfigRaw(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ApplyConfigResp>* PrepareAsyncapplyConfigRaw(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ParserLevelResp>* AsyncinitParserLevelRaw(::grpc::ClientContext* context, const ::rp4::ParserLevelReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ParserLevelResp>* PrepareAsyncinitParserLevelRaw(::grpc::ClientContext* context, const ::rp4::ParserLevelReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ModParserEntryResp>* AsyncmodParserEntryRaw(::grpc::ClientContext* context, const ::rp4::ModParserEntryReq& request, ::grpc::CompletionQueue* cq) = 0;
@@ -329,6 +427,17 @@ class CfgService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::InsertSramEntryResp>* PrepareAsyncinsertSramEntryRaw(::grpc::ClientContext* context, const ::rp4::InsertSramEntryReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::InsertTcamEntryResp>* AsyncinsertTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::InsertTcamEntryReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::InsertTcamEntryResp>* PrepareAsyncinsertTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::InsertTcamEntryReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ModSramEntryResp>* AsyncmodSramEntryRaw(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ModSramEntryResp>* PrepareAsyncmodSramEntryRaw(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::DelSramEntryResp>* AsyncdelSramEntryRaw(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::DelSramEntryResp>* PrepareAsyncdelSramEntryRaw(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ModTcamEntryResp>* AsyncmodTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ModTcamEntryResp>* PrepareAsyncmodTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::DelTcamEntryResp>* AsyncdelTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::DelTcamEntryResp>* PrepareAsyncdelTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientWriterInterface< ::rp4::InsertEntriesReq>* insertEntriesRaw(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::rp4::InsertEntriesReq>* AsyncinsertEntriesRaw(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::rp4::InsertEntriesReq>* PrepareAsyncinsertEntriesRaw(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::InsertActionResp>* AsyncinsertActionRaw(::grpc::ClientContext* context, const ::rp4::InsertActionReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::InsertActionResp>* PrepareAsyncinsertActionRaw(::grpc::ClientContext* context, const ::rp4::InsertActionReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::rp4::ClearActionResp>* AsyncclearActionRaw(::grpc::ClientContext* context, const ::rp4::ClearActionReq& request, ::grpc::CompletionQueue* cq) = 0;
@@ -358,6 +467,34 @@ class CfgService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::SetMetadataResp>> PrepareAsyncsetMetadata(::grpc::ClientContext* context, const ::rp4::SetMetadataReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::SetMetadataResp>>(PrepareAsyncsetMetadataRaw(context, request, cq));
     }
+    ::grpc::Status beginConfig(::grpc::ClientContext* context, const ::rp4::BeginConfigReq& request, ::rp4::BeginConfigResp* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::BeginConfigResp>> AsyncbeginConfig(::grpc::ClientContext* context, const ::rp4::BeginConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::BeginConfigResp>>(AsyncbeginConfigRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::BeginConfigResp>> PrepareAsyncbeginConfig(::grpc::ClientContext* context, const ::rp4::BeginConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::BeginConfigResp>>(PrepareAsyncbeginConfigRaw(context, request, cq));
+    }
+    ::grpc::Status commitConfig(::grpc::ClientContext* context, const ::rp4::CommitConfigReq& request, ::rp4::CommitConfigResp* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::CommitConfigResp>> AsynccommitConfig(::grpc::ClientContext* context, const ::rp4::CommitConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::CommitConfigResp>>(AsynccommitConfigRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::CommitConfigResp>> PrepareAsynccommitConfig(::grpc::ClientContext* context, const ::rp4::CommitConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::CommitConfigResp>>(PrepareAsynccommitConfigRaw(context, request, cq));
+    }
+    ::grpc::Status abortConfig(::grpc::ClientContext* context, const ::rp4::AbortConfigReq& request, ::rp4::AbortConfigResp* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::AbortConfigResp>> AsyncabortConfig(::grpc::ClientContext* context, const ::rp4::AbortConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::AbortConfigResp>>(AsyncabortConfigRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::AbortConfigResp>> PrepareAsyncabortConfig(::grpc::ClientContext* context, const ::rp4::AbortConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::AbortConfigResp>>(PrepareAsyncabortConfigRaw(context, request, cq));
+    }
+    ::grpc::Status applyConfig(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq& request, ::rp4::ApplyConfigResp* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::ApplyConfigResp>> AsyncapplyConfig(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::ApplyConfigResp>>(AsyncapplyConfigRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::ApplyConfigResp>> PrepareAsyncapplyConfig(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::ApplyConfigResp>>(PrepareAsyncapplyConfigRaw(context, request, cq));
+    }
     ::grpc::Status initParserLevel(::grpc::ClientContext* context, const ::rp4::ParserLevelReq& request, ::rp4::ParserLevelResp* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::ParserLevelResp>> AsyncinitParserLevel(::grpc::ClientContext* context, const ::rp4::ParserLevelReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::ParserLevelResp>>(AsyncinitParserLevelRaw(context, request, cq));
@@ -470,6 +607,43 @@ class CfgService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::InsertTcamEntryResp>> PrepareAsyncinsertTcamEntry(::grpc::ClientContext* context, const ::rp4::InsertTcamEntryReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::InsertTcamEntryResp>>(PrepareAsyncinsertTcamEntryRaw(context, request, cq));
     }
+    ::grpc::Status modSramEntry(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq& request, ::rp4::ModSramEntryResp* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::ModSramEntryResp>> AsyncmodSramEntry(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::ModSramEntryResp>>(AsyncmodSramEntryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::ModSramEntryResp>> PrepareAsyncmodSramEntry(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::ModSramEntryResp>>(PrepareAsyncmodSramEntryRaw(context, request, cq));
+    }
+    ::grpc::Status delSramEntry(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq& request, ::rp4::DelSramEntryResp* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::DelSramEntryResp>> AsyncdelSramEntry(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::DelSramEntryResp>>(AsyncdelSramEntryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::DelSramEntryResp>> PrepareAsyncdelSramEntry(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::DelSramEntryResp>>(PrepareAsyncdelSramEntryRaw(context, request, cq));
+    }
+    ::grpc::Status modTcamEntry(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq& request, ::rp4::ModTcamEntryResp* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::ModTcamEntryResp>> AsyncmodTcamEntry(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::ModTcamEntryResp>>(AsyncmodTcamEntryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::ModTcamEntryResp>> PrepareAsyncmodTcamEntry(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::ModTcamEntryResp>>(PrepareAsyncmodTcamEntryRaw(context, request, cq));
+    }
+    ::grpc::Status delTcamEntry(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq& request, ::rp4::DelTcamEntryResp* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::DelTcamEntryResp>> AsyncdelTcamEntry(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::DelTcamEntryResp>>(AsyncdelTcamEntryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::DelTcamEntryResp>> PrepareAsyncdelTcamEntry(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::DelTcamEntryResp>>(PrepareAsyncdelTcamEntryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientWriter< ::rp4::InsertEntriesReq>> insertEntries(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response) {
+      return std::unique_ptr< ::grpc::ClientWriter< ::rp4::InsertEntriesReq>>(insertEntriesRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::rp4::InsertEntriesReq>> AsyncinsertEntries(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::rp4::InsertEntriesReq>>(AsyncinsertEntriesRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::rp4::InsertEntriesReq>> PrepareAsyncinsertEntries(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::rp4::InsertEntriesReq>>(PrepareAsyncinsertEntriesRaw(context, response, cq));
+    }
     ::grpc::Status insertAction(::grpc::ClientContext* context, const ::rp4::InsertActionReq& request, ::rp4::InsertActionResp* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::InsertActionResp>> AsyncinsertAction(::grpc::ClientContext* context, const ::rp4::InsertActionReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::rp4::InsertActionResp>>(AsyncinsertActionRaw(context, request, cq));
@@ -538,6 +712,14 @@ class CfgService final {
      public:
       void setMetadata(::grpc::ClientContext* context, const ::rp4::SetMetadataReq* request, ::rp4::SetMetadataResp* response, std::function<void(::grpc::Status)>) override;
       void setMetadata(::grpc::ClientContext* context, const ::rp4::SetMetadataReq* request, ::rp4::SetMetadataResp* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void beginConfig(::grpc::ClientContext* context, const ::rp4::BeginConfigReq* request, ::rp4::BeginConfigResp* response, std::function<void(::grpc::Status)>) override;
+      void beginConfig(::grpc::ClientContext* context, const ::rp4::BeginConfigReq* request, ::rp4::BeginConfigResp* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void commitConfig(::grpc::ClientContext* context, const ::rp4::CommitConfigReq* request, ::rp4::CommitConfigResp* response, std::function<void(::grpc::Status)>) override;
+      void commitConfig(::grpc::ClientContext* context, const ::rp4::CommitConfigReq* request, ::rp4::CommitConfigResp* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void abortConfig(::grpc::ClientContext* context, const ::rp4::AbortConfigReq* request, ::rp4::AbortConfigResp* response, std::function<void(::grpc::Status)>) override;
+      void abortConfig(::grpc::ClientContext* context, const ::rp4::AbortConfigReq* request, ::rp4::AbortConfigResp* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void applyConfig(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq* request, ::rp4::ApplyConfigResp* response, std::function<void(::grpc::Status)>) override;
+      void applyConfig(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq* request, ::rp4::ApplyConfigResp* response, ::grpc::ClientUnaryReactor* reactor) override;
       void initParserLevel(::grpc::ClientContext* context, const ::rp4::ParserLevelReq* request, ::rp4::ParserLevelResp* response, std::function<void(::grpc::Status)>) override;
       void initParserLevel(::grpc::ClientContext* context, const ::rp4::ParserLevelReq* request, ::rp4::ParserLevelResp* response, ::grpc::ClientUnaryReactor* reactor) override;
       void modParserEntry(::grpc::ClientContext* context, const ::rp4::ModParserEntryReq* request, ::rp4::ModParserEntryResp* response, std::function<void(::grpc::Status)>) override;
@@ -570,6 +752,15 @@ class CfgService final {
       void insertSramEntry(::grpc::ClientContext* context, const ::rp4::InsertSramEntryReq* request, ::rp4::InsertSramEntryResp* response, ::grpc::ClientUnaryReactor* reactor) override;
       void insertTcamEntry(::grpc::ClientContext* context, const ::rp4::InsertTcamEntryReq* request, ::rp4::InsertTcamEntryResp* response, std::function<void(::grpc::Status)>) override;
       void insertTcamEntry(::grpc::ClientContext* context, const ::rp4::InsertTcamEntryReq* request, ::rp4::InsertTcamEntryResp* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void modSramEntry(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq* request, ::rp4::ModSramEntryResp* response, std::function<void(::grpc::Status)>) override;
+      void modSramEntry(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq* request, ::rp4::ModSramEntryResp* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void delSramEntry(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq* request, ::rp4::DelSramEntryResp* response, std::function<void(::grpc::Status)>) override;
+      void delSramEntry(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq* request, ::rp4::DelSramEntryResp* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void modTcamEntry(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq* request, ::rp4::ModTcamEntryResp* response, std::function<void(::grpc::Status)>) override;
+      void modTcamEntry(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq* request, ::rp4::ModTcamEntryResp* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void delTcamEntry(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq* request, ::rp4::DelTcamEntryResp* response, std::function<void(::grpc::Status)>) override;
+      void delTcamEntry(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq* request, ::rp4::DelTcamEntryResp* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void insertEntries(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response, ::grpc::ClientWriteReactor< ::rp4::InsertEntriesReq>* reactor) override;
       void insertAction(::grpc::ClientContext* context, const ::rp4::InsertActionReq* request, ::rp4::InsertActionResp* response, std::function<void(::grpc::Status)>) override;
       void insertAction(::grpc::ClientContext* context, const ::rp4::InsertActionReq* request, ::rp4::InsertActionResp* response, ::grpc::ClientUnaryReactor* reactor) override;
       void clearAction(::grpc::ClientContext* context, const ::rp4::ClearActionReq* request, ::rp4::ClearActionResp* response, std::function<void(::grpc::Status)>) override;
@@ -601,6 +792,14 @@ class CfgService final {
     class async async_stub_{this};
     ::grpc::ClientAsyncResponseReader< ::rp4::SetMetadataResp>* AsyncsetMetadataRaw(::grpc::ClientContext* context, const ::rp4::SetMetadataReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::rp4::SetMetadataResp>* PrepareAsyncsetMetadataRaw(::grpc::ClientContext* context, const ::rp4::SetMetadataReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::BeginConfigResp>* AsyncbeginConfigRaw(::grpc::ClientContext* context, const ::rp4::BeginConfigReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::BeginConfigResp>* PrepareAsyncbeginConfigRaw(::grpc::ClientContext* context, const ::rp4::BeginConfigReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::CommitConfigResp>* AsynccommitConfigRaw(::grpc::ClientContext* context, const ::rp4::CommitConfigReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::CommitConfigResp>* PrepareAsynccommitConfigRaw(::grpc::ClientContext* context, const ::rp4::CommitConfigReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::AbortConfigResp>* AsyncabortConfigRaw(::grpc::ClientContext* context, const ::rp4::AbortConfigReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::AbortConfigResp>* PrepareAsyncabortConfigRaw(::grpc::ClientContext* context, const ::rp4::AbortConfigReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::ApplyConfigResp>* AsyncapplyConfigRaw(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::ApplyConfigResp>* PrepareAsyncapplyConfigRaw(::grpc::ClientContext* context, const ::rp4::ApplyConfigReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::rp4::ParserLevelResp>* AsyncinitParserLevelRaw(::grpc::ClientContext* context, const ::rp4::ParserLevelReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::rp4::ParserLevelResp>* PrepareAsyncinitParserLevelRaw(::grpc::ClientContext* context, const ::rp4::ParserLevelReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::rp4::ModParserEntryResp>* AsyncmodParserEntryRaw(::grpc::ClientContext* context, const ::rp4::ModParserEntryReq& request, ::grpc::CompletionQueue* cq) override;
@@ -633,6 +832,17 @@ class CfgService final {
     ::grpc::ClientAsyncResponseReader< ::rp4::InsertSramEntryResp>* PrepareAsyncinsertSramEntryRaw(::grpc::ClientContext* context, const ::rp4::InsertSramEntryReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::rp4::InsertTcamEntryResp>* AsyncinsertTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::InsertTcamEntryReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::rp4::InsertTcamEntryResp>* PrepareAsyncinsertTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::InsertTcamEntryReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::ModSramEntryResp>* AsyncmodSramEntryRaw(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::ModSramEntryResp>* PrepareAsyncmodSramEntryRaw(::grpc::ClientContext* context, const ::rp4::ModSramEntryReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::DelSramEntryResp>* AsyncdelSramEntryRaw(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::DelSramEntryResp>* PrepareAsyncdelSramEntryRaw(::grpc::ClientContext* context, const ::rp4::DelSramEntryReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::ModTcamEntryResp>* AsyncmodTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::ModTcamEntryResp>* PrepareAsyncmodTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::ModTcamEntryReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::DelTcamEntryResp>* AsyncdelTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::rp4::DelTcamEntryResp>* PrepareAsyncdelTcamEntryRaw(::grpc::ClientContext* context, const ::rp4::DelTcamEntryReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientWriter< ::rp4::InsertEntriesReq>* insertEntriesRaw(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response) override;
+    ::grpc::ClientAsyncWriter< ::rp4::InsertEntriesReq>* AsyncinsertEntriesRaw(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncWriter< ::rp4::InsertEntriesReq>* PrepareAsyncinsertEntriesRaw(::grpc::ClientContext* context, ::rp4::InsertEntriesResp* response, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::rp4::InsertActionResp>* AsyncinsertActionRaw(::grpc::ClientContext* context, const ::rp4::InsertActionReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::rp4::InsertActionResp>* PrepareAsyncinsertActionRaw(::grpc::ClientContext* context, const ::rp4::InsertActionReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::rp4::ClearActionResp>* AsyncclearActionRaw(::grpc::ClientContext* context, const ::rp4::ClearActionReq& request, ::grpc::CompletionQueue* cq) override;
@@ -652,6 +862,10 @@ class CfgService final {
     ::grpc::ClientAsyncResponseReader< ::rp4::ClearNeuronPrimitiveContextsResp>* AsyncclearNeuronPrimitiveContextsRaw(::grpc::ClientContext* context, const ::rp4::ClearNeuronPrimitiveContextsReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::rp4::ClearNeuronPrimitiveContextsResp>* PrepareAsyncclearNeuronPrimitiveContextsRaw(::grpc::ClientContext* context, const ::rp4::ClearNeuronPrimitiveContextsReq& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_setMetadata_;
+    const ::grpc::internal::RpcMethod rpcmethod_beginConfig_;
+    const ::grpc::internal::RpcMethod rpcmethod_commitConfig_;
+    const ::grpc::internal::RpcMethod rpcmethod_abortConfig_;
+    const ::grpc::internal::RpcMethod rpcmethod_applyConfig_;
     const ::grpc::internal::RpcMethod rpcmethod_initParserLevel_;
     const ::grpc::internal::RpcMethod rpcmethod_modParserEntry_;
     const ::grpc::internal::RpcMethod rpcmethod_clearParser_;
@@ -668,6 +882,11 @@ class CfgService final {
     const ::grpc::internal::RpcMethod rpcmethod_setMissActId_;
     const ::grpc::internal::RpcMethod rpcmethod_insertSramEntry_;
     const ::grpc::internal::RpcMethod rpcmethod_insertTcamEntry_;
+    const ::grpc::internal::RpcMethod rpcmethod_modSramEntry_;
+    const ::grpc::internal::RpcMethod rpcmethod_delSramEntry_;
+    const ::grpc::internal::RpcMethod rpcmethod_modTcamEntry_;
+    const ::grpc::internal::RpcMethod rpcmethod_delTcamEntry_;
+    const ::grpc::internal::RpcMethod rpcmethod_insertEntries_;
     const ::grpc::internal::RpcMethod rpcmethod_insertAction_;
     const ::grpc::internal::RpcMethod rpcmethod_clearAction_;
     const ::grpc::internal::RpcMethod rpcmethod_delAction_;
@@ -686,6 +905,13 @@ class CfgService final {
     virtual ~Service();
     // ***** metadata ****
     virtual ::grpc::Status setMetadata(::grpc::ServerContext* context, const ::rp4::SetMetadataReq* request, ::rp4::SetMetadataResp* response);
+    // ***** config transaction ****
+    // config calls between begin and commit build a shadow pipeline, commit swaps it in at once
+    virtual ::grpc::Status beginConfig(::grpc::ServerContext* context, const ::rp4::BeginConfigReq* request, ::rp4::BeginConfigResp* response);
+    virtual ::grpc::Status commitConfig(::grpc::ServerContext* context, const ::rp4::CommitConfigReq* request, ::rp4::CommitConfigResp* response);
+    virtual ::grpc::Status abortConfig(::grpc::ServerContext* context, const ::rp4::AbortConfigReq* request, ::rp4::AbortConfigResp* response);
+    // a whole config in one call, applied as one transaction unless one is already open
+    virtual ::grpc::Status applyConfig(::grpc::ServerContext* context, const ::rp4::ApplyConfigReq* request, ::rp4::ApplyConfigResp* response);
     // **** parser ****
     virtual ::grpc::Status initParserLevel(::grpc::ServerContext* context, const ::rp4::ParserLevelReq* request, ::rp4::ParserLevelResp* response);
     virtual ::grpc::Status modParserEntry(::grpc::ServerContext* context, const ::rp4::ModParserEntryReq* request, ::rp4::ModParserEntryResp* response);
@@ -708,6 +934,12 @@ class CfgService final {
     // table entry
     virtual ::grpc::Status insertSramEntry(::grpc::ServerContext* context, const ::rp4::InsertSramEntryReq* request, ::rp4::InsertSramEntryResp* response);
     virtual ::grpc::Status insertTcamEntry(::grpc::ServerContext* context, const ::rp4::InsertTcamEntryReq* request, ::rp4::InsertTcamEntryResp* response);
+    virtual ::grpc::Status modSramEntry(::grpc::ServerContext* context, const ::rp4::ModSramEntryReq* request, ::rp4::ModSramEntryResp* response);
+    virtual ::grpc::Status delSramEntry(::grpc::ServerContext* context, const ::rp4::DelSramEntryReq* request, ::rp4::DelSramEntryResp* response);
+    virtual ::grpc::Status modTcamEntry(::grpc::ServerContext* context, const ::rp4::ModTcamEntryReq* request, ::rp4::ModTcamEntryResp* response);
+    virtual ::grpc::Status delTcamEntry(::grpc::ServerContext* context, const ::rp4::DelTcamEntryReq* request, ::rp4::DelTcamEntryResp* response);
+    // bulk load: batches of entries streamed in, one reply at the end
+    virtual ::grpc::Status insertEntries(::grpc::ServerContext* context, ::grpc::ServerReader< ::rp4::InsertEntriesReq>* reader, ::rp4::InsertEntriesResp* response);
     // ***** executor ******
     virtual ::grpc::Status insertAction(::grpc::ServerContext* context, const ::rp4::InsertActionReq* request, ::rp4::InsertActionResp* response);
     virtual ::grpc::Status clearAction(::grpc::ServerContext* context, const ::rp4::ClearActionReq* request, ::rp4::ClearActionResp* response);
@@ -741,12 +973,92 @@ class CfgService final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_beginConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_beginConfig() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_beginConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status beginConfig(::grpc::ServerContext* /*context*/, const ::rp4::BeginConfigReq* /*request*/, ::rp4::BeginConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestbeginConfig(::grpc::ServerContext* context, ::rp4::BeginConfigReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::BeginConfigResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_commitConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_commitConfig() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_commitConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status commitConfig(::grpc::ServerContext* /*context*/, const ::rp4::CommitConfigReq* /*request*/, ::rp4::CommitConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestcommitConfig(::grpc::ServerContext* context, ::rp4::CommitConfigReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::CommitConfigResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_abortConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_abortConfig() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_abortConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status abortConfig(::grpc::ServerContext* /*context*/, const ::rp4::AbortConfigReq* /*request*/, ::rp4::AbortConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestabortConfig(::grpc::ServerContext* context, ::rp4::AbortConfigReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::AbortConfigResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_applyConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_applyConfig() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_applyConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status applyConfig(::grpc::ServerContext* /*context*/, const ::rp4::ApplyConfigReq* /*request*/, ::rp4::ApplyConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestapplyConfig(::grpc::ServerContext* context, ::rp4::ApplyConfigReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::ApplyConfigResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_initParserLevel : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_initParserLevel() {
-      ::grpc::Service::MarkMethodAsync(1);
+      ::grpc::Service::MarkMethodAsync(5);
     }
     ~WithAsyncMethod_initParserLevel() override {
       BaseClassMustBeDerivedFromService(this);
@@ -757,7 +1069,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestinitParserLevel(::grpc::ServerContext* context, ::rp4::ParserLevelReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::ParserLevelResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -766,7 +1078,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_modParserEntry() {
-      ::grpc::Service::MarkMethodAsync(2);
+      ::grpc::Service::MarkMethodAsync(6);
     }
     ~WithAsyncMethod_modParserEntry() override {
       BaseClassMustBeDerivedFromService(this);
@@ -777,7 +1089,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestmodParserEntry(::grpc::ServerContext* context, ::rp4::ModParserEntryReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::ModParserEntryResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -786,7 +1098,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_clearParser() {
-      ::grpc::Service::MarkMethodAsync(3);
+      ::grpc::Service::MarkMethodAsync(7);
     }
     ~WithAsyncMethod_clearParser() override {
       BaseClassMustBeDerivedFromService(this);
@@ -797,7 +1109,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestclearParser(::grpc::ServerContext* context, ::rp4::ClearParserReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::ClearParserResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -806,7 +1118,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_insertRelationExp() {
-      ::grpc::Service::MarkMethodAsync(4);
+      ::grpc::Service::MarkMethodAsync(8);
     }
     ~WithAsyncMethod_insertRelationExp() override {
       BaseClassMustBeDerivedFromService(this);
@@ -817,7 +1129,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestinsertRelationExp(::grpc::ServerContext* context, ::rp4::InsertRelationExpReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::InsertRelationExpResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -826,7 +1138,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_clearRelationExp() {
-      ::grpc::Service::MarkMethodAsync(5);
+      ::grpc::Service::MarkMethodAsync(9);
     }
     ~WithAsyncMethod_clearRelationExp() override {
       BaseClassMustBeDerivedFromService(this);
@@ -837,7 +1149,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestclearRelationExp(::grpc::ServerContext* context, ::rp4::ClearRelationExpReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::ClearRelationExpResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -846,7 +1158,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_clearResMap() {
-      ::grpc::Service::MarkMethodAsync(6);
+      ::grpc::Service::MarkMethodAsync(10);
     }
     ~WithAsyncMethod_clearResMap() override {
       BaseClassMustBeDerivedFromService(this);
@@ -857,7 +1169,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestclearResMap(::grpc::ServerContext* context, ::rp4::ClearResMapReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::ClearResMapResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -866,7 +1178,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_modResMap() {
-      ::grpc::Service::MarkMethodAsync(7);
+      ::grpc::Service::MarkMethodAsync(11);
     }
     ~WithAsyncMethod_modResMap() override {
       BaseClassMustBeDerivedFromService(this);
@@ -877,7 +1189,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestmodResMap(::grpc::ServerContext* context, ::rp4::ModResMapReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::ModResMapResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -886,7 +1198,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_setDefaultGateEntry() {
-      ::grpc::Service::MarkMethodAsync(8);
+      ::grpc::Service::MarkMethodAsync(12);
     }
     ~WithAsyncMethod_setDefaultGateEntry() override {
       BaseClassMustBeDerivedFromService(this);
@@ -897,7 +1209,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestsetDefaultGateEntry(::grpc::ServerContext* context, ::rp4::SetDefaultGateEntryReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::SetDefaultGateEntryResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -906,7 +1218,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_setNoTable() {
-      ::grpc::Service::MarkMethodAsync(9);
+      ::grpc::Service::MarkMethodAsync(13);
     }
     ~WithAsyncMethod_setNoTable() override {
       BaseClassMustBeDerivedFromService(this);
@@ -917,7 +1229,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestsetNoTable(::grpc::ServerContext* context, ::rp4::SetNoTableReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::SetNoTableResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -926,7 +1238,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_setActionProc() {
-      ::grpc::Service::MarkMethodAsync(10);
+      ::grpc::Service::MarkMethodAsync(14);
     }
     ~WithAsyncMethod_setActionProc() override {
       BaseClassMustBeDerivedFromService(this);
@@ -937,7 +1249,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestsetActionProc(::grpc::ServerContext* context, ::rp4::SetActionProcReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::SetActionProcResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -946,7 +1258,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_setMemConfig() {
-      ::grpc::Service::MarkMethodAsync(11);
+      ::grpc::Service::MarkMethodAsync(15);
     }
     ~WithAsyncMethod_setMemConfig() override {
       BaseClassMustBeDerivedFromService(this);
@@ -957,7 +1269,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestsetMemConfig(::grpc::ServerContext* context, ::rp4::SetMemConfigReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::SetMemConfigResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -966,7 +1278,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_setFieldInfo() {
-      ::grpc::Service::MarkMethodAsync(12);
+      ::grpc::Service::MarkMethodAsync(16);
     }
     ~WithAsyncMethod_setFieldInfo() override {
       BaseClassMustBeDerivedFromService(this);
@@ -977,7 +1289,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestsetFieldInfo(::grpc::ServerContext* context, ::rp4::SetFieldInfoReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::SetFieldInfoResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -986,7 +1298,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_clearOldConfig() {
-      ::grpc::Service::MarkMethodAsync(13);
+      ::grpc::Service::MarkMethodAsync(17);
     }
     ~WithAsyncMethod_clearOldConfig() override {
       BaseClassMustBeDerivedFromService(this);
@@ -997,7 +1309,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestclearOldConfig(::grpc::ServerContext* context, ::rp4::ClearOldConfigReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::ClearOldConfigResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1006,7 +1318,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_setMissActId() {
-      ::grpc::Service::MarkMethodAsync(14);
+      ::grpc::Service::MarkMethodAsync(18);
     }
     ~WithAsyncMethod_setMissActId() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1017,7 +1329,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestsetMissActId(::grpc::ServerContext* context, ::rp4::SetMissActIdReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::SetMissActIdResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1026,7 +1338,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_insertSramEntry() {
-      ::grpc::Service::MarkMethodAsync(15);
+      ::grpc::Service::MarkMethodAsync(19);
     }
     ~WithAsyncMethod_insertSramEntry() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1037,7 +1349,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestinsertSramEntry(::grpc::ServerContext* context, ::rp4::InsertSramEntryReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::InsertSramEntryResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1046,7 +1358,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_insertTcamEntry() {
-      ::grpc::Service::MarkMethodAsync(16);
+      ::grpc::Service::MarkMethodAsync(20);
     }
     ~WithAsyncMethod_insertTcamEntry() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1057,7 +1369,107 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestinsertTcamEntry(::grpc::ServerContext* context, ::rp4::InsertTcamEntryReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::InsertTcamEntryResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(20, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_modSramEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_modSramEntry() {
+      ::grpc::Service::MarkMethodAsync(21);
+    }
+    ~WithAsyncMethod_modSramEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status modSramEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModSramEntryReq* /*request*/, ::rp4::ModSramEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestmodSramEntry(::grpc::ServerContext* context, ::rp4::ModSramEntryReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::ModSramEntryResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(21, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_delSramEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_delSramEntry() {
+      ::grpc::Service::MarkMethodAsync(22);
+    }
+    ~WithAsyncMethod_delSramEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status delSramEntry(::grpc::ServerContext* /*context*/, const ::rp4::DelSramEntryReq* /*request*/, ::rp4::DelSramEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestdelSramEntry(::grpc::ServerContext* context, ::rp4::DelSramEntryReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::DelSramEntryResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(22, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_modTcamEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_modTcamEntry() {
+      ::grpc::Service::MarkMethodAsync(23);
+    }
+    ~WithAsyncMethod_modTcamEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status modTcamEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModTcamEntryReq* /*request*/, ::rp4::ModTcamEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestmodTcamEntry(::grpc::ServerContext* context, ::rp4::ModTcamEntryReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::ModTcamEntryResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(23, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_delTcamEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_delTcamEntry() {
+      ::grpc::Service::MarkMethodAsync(24);
+    }
+    ~WithAsyncMethod_delTcamEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status delTcamEntry(::grpc::ServerContext* /*context*/, const ::rp4::DelTcamEntryReq* /*request*/, ::rp4::DelTcamEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestdelTcamEntry(::grpc::ServerContext* context, ::rp4::DelTcamEntryReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::DelTcamEntryResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(24, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_insertEntries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_insertEntries() {
+      ::grpc::Service::MarkMethodAsync(25);
+    }
+    ~WithAsyncMethod_insertEntries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status insertEntries(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::rp4::InsertEntriesReq>* /*reader*/, ::rp4::InsertEntriesResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestinsertEntries(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::rp4::InsertEntriesResp, ::rp4::InsertEntriesReq>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(25, context, reader, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1066,7 +1478,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_insertAction() {
-      ::grpc::Service::MarkMethodAsync(17);
+      ::grpc::Service::MarkMethodAsync(26);
     }
     ~WithAsyncMethod_insertAction() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1077,7 +1489,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestinsertAction(::grpc::ServerContext* context, ::rp4::InsertActionReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::InsertActionResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(26, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1086,7 +1498,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_clearAction() {
-      ::grpc::Service::MarkMethodAsync(18);
+      ::grpc::Service::MarkMethodAsync(27);
     }
     ~WithAsyncMethod_clearAction() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1097,7 +1509,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestclearAction(::grpc::ServerContext* context, ::rp4::ClearActionReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::ClearActionResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(27, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1106,7 +1518,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_delAction() {
-      ::grpc::Service::MarkMethodAsync(19);
+      ::grpc::Service::MarkMethodAsync(28);
     }
     ~WithAsyncMethod_delAction() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1117,7 +1529,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestdelAction(::grpc::ServerContext* context, ::rp4::DelActionReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::DelActionResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(28, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1126,7 +1538,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_loadSigmoidTable() {
-      ::grpc::Service::MarkMethodAsync(20);
+      ::grpc::Service::MarkMethodAsync(29);
     }
     ~WithAsyncMethod_loadSigmoidTable() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1137,7 +1549,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestloadSigmoidTable(::grpc::ServerContext* context, ::rp4::LoadSigmoidTableReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::LoadSigmoidTableResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(20, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(29, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1146,7 +1558,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_clearSigmoidTable() {
-      ::grpc::Service::MarkMethodAsync(21);
+      ::grpc::Service::MarkMethodAsync(30);
     }
     ~WithAsyncMethod_clearSigmoidTable() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1157,7 +1569,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestclearSigmoidTable(::grpc::ServerContext* context, ::rp4::ClearSigmoidTableReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::ClearSigmoidTableResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(21, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(30, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1166,7 +1578,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_loadExpTable() {
-      ::grpc::Service::MarkMethodAsync(22);
+      ::grpc::Service::MarkMethodAsync(31);
     }
     ~WithAsyncMethod_loadExpTable() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1177,7 +1589,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestloadExpTable(::grpc::ServerContext* context, ::rp4::LoadExpTableReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::LoadExpTableResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(22, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(31, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1186,7 +1598,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_clearExpTable() {
-      ::grpc::Service::MarkMethodAsync(23);
+      ::grpc::Service::MarkMethodAsync(32);
     }
     ~WithAsyncMethod_clearExpTable() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1197,7 +1609,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestclearExpTable(::grpc::ServerContext* context, ::rp4::ClearExpTableReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::ClearExpTableResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(23, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(32, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1206,7 +1618,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_loadNeuronPrimitiveContext() {
-      ::grpc::Service::MarkMethodAsync(24);
+      ::grpc::Service::MarkMethodAsync(33);
     }
     ~WithAsyncMethod_loadNeuronPrimitiveContext() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1217,7 +1629,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestloadNeuronPrimitiveContext(::grpc::ServerContext* context, ::rp4::LoadNeuronPrimitiveContextReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::LoadNeuronPrimitiveContextResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(24, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(33, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1226,7 +1638,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_clearNeuronPrimitiveContexts() {
-      ::grpc::Service::MarkMethodAsync(25);
+      ::grpc::Service::MarkMethodAsync(34);
     }
     ~WithAsyncMethod_clearNeuronPrimitiveContexts() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1237,10 +1649,10 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestclearNeuronPrimitiveContexts(::grpc::ServerContext* context, ::rp4::ClearNeuronPrimitiveContextsReq* request, ::grpc::ServerAsyncResponseWriter< ::rp4::ClearNeuronPrimitiveContextsResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(25, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(34, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_setMetadata<WithAsyncMethod_initParserLevel<WithAsyncMethod_modParserEntry<WithAsyncMethod_clearParser<WithAsyncMethod_insertRelationExp<WithAsyncMethod_clearRelationExp<WithAsyncMethod_clearResMap<WithAsyncMethod_modResMap<WithAsyncMethod_setDefaultGateEntry<WithAsyncMethod_setNoTable<WithAsyncMethod_setActionProc<WithAsyncMethod_setMemConfig<WithAsyncMethod_setFieldInfo<WithAsyncMethod_clearOldConfig<WithAsyncMethod_setMissActId<WithAsyncMethod_insertSramEntry<WithAsyncMethod_insertTcamEntry<WithAsyncMethod_insertAction<WithAsyncMethod_clearAction<WithAsyncMethod_delAction<WithAsyncMethod_loadSigmoidTable<WithAsyncMethod_clearSigmoidTable<WithAsyncMethod_loadExpTable<WithAsyncMethod_clearExpTable<WithAsyncMethod_loadNeuronPrimitiveContext<WithAsyncMethod_clearNeuronPrimitiveContexts<Service > > > > > > > > > > > > > > > > > > > > > > > > > > AsyncService;
+  typedef WithAsyncMethod_setMetadata<WithAsyncMethod_beginConfig<WithAsyncMethod_commitConfig<WithAsyncMethod_abortConfig<WithAsyncMethod_applyConfig<WithAsyncMethod_initParserLevel<WithAsyncMethod_modParserEntry<WithAsyncMethod_clearParser<WithAsyncMethod_insertRelationExp<WithAsyncMethod_clearRelationExp<WithAsyncMethod_clearResMap<WithAsyncMethod_modResMap<WithAsyncMethod_setDefaultGateEntry<WithAsyncMethod_setNoTable<WithAsyncMethod_setActionProc<WithAsyncMethod_setMemConfig<WithAsyncMethod_setFieldInfo<WithAsyncMethod_clearOldConfig<WithAsyncMethod_setMissActId<WithAsyncMethod_insertSramEntry<WithAsyncMethod_insertTcamEntry<WithAsyncMethod_modSramEntry<WithAsyncMethod_delSramEntry<WithAsyncMethod_modTcamEntry<WithAsyncMethod_delTcamEntry<WithAsyncMethod_insertEntries<WithAsyncMethod_insertAction<WithAsyncMethod_clearAction<WithAsyncMethod_delAction<WithAsyncMethod_loadSigmoidTable<WithAsyncMethod_clearSigmoidTable<WithAsyncMethod_loadExpTable<WithAsyncMethod_clearExpTable<WithAsyncMethod_loadNeuronPrimitiveContext<WithAsyncMethod_clearNeuronPrimitiveContexts<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_setMetadata : public BaseClass {
    private:
@@ -1269,18 +1681,126 @@ class CfgService final {
       ::grpc::CallbackServerContext* /*context*/, const ::rp4::SetMetadataReq* /*request*/, ::rp4::SetMetadataResp* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithCallbackMethod_initParserLevel : public BaseClass {
+  class WithCallbackMethod_beginConfig : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_initParserLevel() {
+    WithCallbackMethod_beginConfig() {
       ::grpc::Service::MarkMethodCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::rp4::ParserLevelReq, ::rp4::ParserLevelResp>(
+          new ::grpc::internal::CallbackUnaryHandler< ::rp4::BeginConfigReq, ::rp4::BeginConfigResp>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::rp4::BeginConfigReq* request, ::rp4::BeginConfigResp* response) { return this->beginConfig(context, request, response); }));}
+    void SetMessageAllocatorFor_beginConfig(
+        ::grpc::MessageAllocator< ::rp4::BeginConfigReq, ::rp4::BeginConfigResp>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::BeginConfigReq, ::rp4::BeginConfigResp>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_beginConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status beginConfig(::grpc::ServerContext* /*context*/, const ::rp4::BeginConfigReq* /*request*/, ::rp4::BeginConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* beginConfig(
+      ::grpc::CallbackServerContext* /*context*/, const ::rp4::BeginConfigReq* /*request*/, ::rp4::BeginConfigResp* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_commitConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_commitConfig() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::rp4::CommitConfigReq, ::rp4::CommitConfigResp>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::rp4::CommitConfigReq* request, ::rp4::CommitConfigResp* response) { return this->commitConfig(context, request, response); }));}
+    void SetMessageAllocatorFor_commitConfig(
+        ::grpc::MessageAllocator< ::rp4::CommitConfigReq, ::rp4::CommitConfigResp>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::CommitConfigReq, ::rp4::CommitConfigResp>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_commitConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status commitConfig(::grpc::ServerContext* /*context*/, const ::rp4::CommitConfigReq* /*request*/, ::rp4::CommitConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* commitConfig(
+      ::grpc::CallbackServerContext* /*context*/, const ::rp4::CommitConfigReq* /*request*/, ::rp4::CommitConfigResp* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_abortConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_abortConfig() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::rp4::AbortConfigReq, ::rp4::AbortConfigResp>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::rp4::AbortConfigReq* request, ::rp4::AbortConfigResp* response) { return this->abortConfig(context, request, response); }));}
+    void SetMessageAllocatorFor_abortConfig(
+        ::grpc::MessageAllocator< ::rp4::AbortConfigReq, ::rp4::AbortConfigResp>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::AbortConfigReq, ::rp4::AbortConfigResp>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_abortConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status abortConfig(::grpc::ServerContext* /*context*/, const ::rp4::AbortConfigReq* /*request*/, ::rp4::AbortConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* abortConfig(
+      ::grpc::CallbackServerContext* /*context*/, const ::rp4::AbortConfigReq* /*request*/, ::rp4::AbortConfigResp* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_applyConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_applyConfig() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::rp4::ApplyConfigReq, ::rp4::ApplyConfigResp>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::rp4::ApplyConfigReq* request, ::rp4::ApplyConfigResp* response) { return this->applyConfig(context, request, response); }));}
+    void SetMessageAllocatorFor_applyConfig(
+        ::grpc::MessageAllocator< ::rp4::ApplyConfigReq, ::rp4::ApplyConfigResp>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::ApplyConfigReq, ::rp4::ApplyConfigResp>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_applyConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status applyConfig(::grpc::ServerContext* /*context*/, const ::rp4::ApplyConfigReq* /*request*/, ::rp4::ApplyConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* applyConfig(
+      ::grpc::CallbackServerContext* /*context*/, const ::rp4::ApplyConfigReq* /*request*/, ::rp4::ApplyConfigResp* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_initParserLevel : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_initParserLevel() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::rp4::ParserLevelReq, ::rp4::ParserLevelResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::ParserLevelReq* request, ::rp4::ParserLevelResp* response) { return this->initParserLevel(context, request, response); }));}
     void SetMessageAllocatorFor_initParserLevel(
         ::grpc::MessageAllocator< ::rp4::ParserLevelReq, ::rp4::ParserLevelResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::ParserLevelReq, ::rp4::ParserLevelResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1301,13 +1821,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_modParserEntry() {
-      ::grpc::Service::MarkMethodCallback(2,
+      ::grpc::Service::MarkMethodCallback(6,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::ModParserEntryReq, ::rp4::ModParserEntryResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::ModParserEntryReq* request, ::rp4::ModParserEntryResp* response) { return this->modParserEntry(context, request, response); }));}
     void SetMessageAllocatorFor_modParserEntry(
         ::grpc::MessageAllocator< ::rp4::ModParserEntryReq, ::rp4::ModParserEntryResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::ModParserEntryReq, ::rp4::ModParserEntryResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1328,13 +1848,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_clearParser() {
-      ::grpc::Service::MarkMethodCallback(3,
+      ::grpc::Service::MarkMethodCallback(7,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::ClearParserReq, ::rp4::ClearParserResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::ClearParserReq* request, ::rp4::ClearParserResp* response) { return this->clearParser(context, request, response); }));}
     void SetMessageAllocatorFor_clearParser(
         ::grpc::MessageAllocator< ::rp4::ClearParserReq, ::rp4::ClearParserResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::ClearParserReq, ::rp4::ClearParserResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1355,13 +1875,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_insertRelationExp() {
-      ::grpc::Service::MarkMethodCallback(4,
+      ::grpc::Service::MarkMethodCallback(8,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::InsertRelationExpReq, ::rp4::InsertRelationExpResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::InsertRelationExpReq* request, ::rp4::InsertRelationExpResp* response) { return this->insertRelationExp(context, request, response); }));}
     void SetMessageAllocatorFor_insertRelationExp(
         ::grpc::MessageAllocator< ::rp4::InsertRelationExpReq, ::rp4::InsertRelationExpResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::InsertRelationExpReq, ::rp4::InsertRelationExpResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1382,13 +1902,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_clearRelationExp() {
-      ::grpc::Service::MarkMethodCallback(5,
+      ::grpc::Service::MarkMethodCallback(9,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::ClearRelationExpReq, ::rp4::ClearRelationExpResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::ClearRelationExpReq* request, ::rp4::ClearRelationExpResp* response) { return this->clearRelationExp(context, request, response); }));}
     void SetMessageAllocatorFor_clearRelationExp(
         ::grpc::MessageAllocator< ::rp4::ClearRelationExpReq, ::rp4::ClearRelationExpResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::ClearRelationExpReq, ::rp4::ClearRelationExpResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1409,13 +1929,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_clearResMap() {
-      ::grpc::Service::MarkMethodCallback(6,
+      ::grpc::Service::MarkMethodCallback(10,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::ClearResMapReq, ::rp4::ClearResMapResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::ClearResMapReq* request, ::rp4::ClearResMapResp* response) { return this->clearResMap(context, request, response); }));}
     void SetMessageAllocatorFor_clearResMap(
         ::grpc::MessageAllocator< ::rp4::ClearResMapReq, ::rp4::ClearResMapResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::ClearResMapReq, ::rp4::ClearResMapResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1436,13 +1956,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_modResMap() {
-      ::grpc::Service::MarkMethodCallback(7,
+      ::grpc::Service::MarkMethodCallback(11,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::ModResMapReq, ::rp4::ModResMapResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::ModResMapReq* request, ::rp4::ModResMapResp* response) { return this->modResMap(context, request, response); }));}
     void SetMessageAllocatorFor_modResMap(
         ::grpc::MessageAllocator< ::rp4::ModResMapReq, ::rp4::ModResMapResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::ModResMapReq, ::rp4::ModResMapResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1463,13 +1983,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_setDefaultGateEntry() {
-      ::grpc::Service::MarkMethodCallback(8,
+      ::grpc::Service::MarkMethodCallback(12,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::SetDefaultGateEntryReq, ::rp4::SetDefaultGateEntryResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::SetDefaultGateEntryReq* request, ::rp4::SetDefaultGateEntryResp* response) { return this->setDefaultGateEntry(context, request, response); }));}
     void SetMessageAllocatorFor_setDefaultGateEntry(
         ::grpc::MessageAllocator< ::rp4::SetDefaultGateEntryReq, ::rp4::SetDefaultGateEntryResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::SetDefaultGateEntryReq, ::rp4::SetDefaultGateEntryResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1490,13 +2010,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_setNoTable() {
-      ::grpc::Service::MarkMethodCallback(9,
+      ::grpc::Service::MarkMethodCallback(13,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::SetNoTableReq, ::rp4::SetNoTableResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::SetNoTableReq* request, ::rp4::SetNoTableResp* response) { return this->setNoTable(context, request, response); }));}
     void SetMessageAllocatorFor_setNoTable(
         ::grpc::MessageAllocator< ::rp4::SetNoTableReq, ::rp4::SetNoTableResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(13);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::SetNoTableReq, ::rp4::SetNoTableResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1517,13 +2037,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_setActionProc() {
-      ::grpc::Service::MarkMethodCallback(10,
+      ::grpc::Service::MarkMethodCallback(14,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::SetActionProcReq, ::rp4::SetActionProcResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::SetActionProcReq* request, ::rp4::SetActionProcResp* response) { return this->setActionProc(context, request, response); }));}
     void SetMessageAllocatorFor_setActionProc(
         ::grpc::MessageAllocator< ::rp4::SetActionProcReq, ::rp4::SetActionProcResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(14);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::SetActionProcReq, ::rp4::SetActionProcResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1544,13 +2064,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_setMemConfig() {
-      ::grpc::Service::MarkMethodCallback(11,
+      ::grpc::Service::MarkMethodCallback(15,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::SetMemConfigReq, ::rp4::SetMemConfigResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::SetMemConfigReq* request, ::rp4::SetMemConfigResp* response) { return this->setMemConfig(context, request, response); }));}
     void SetMessageAllocatorFor_setMemConfig(
         ::grpc::MessageAllocator< ::rp4::SetMemConfigReq, ::rp4::SetMemConfigResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(15);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::SetMemConfigReq, ::rp4::SetMemConfigResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1571,13 +2091,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_setFieldInfo() {
-      ::grpc::Service::MarkMethodCallback(12,
+      ::grpc::Service::MarkMethodCallback(16,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::SetFieldInfoReq, ::rp4::SetFieldInfoResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::SetFieldInfoReq* request, ::rp4::SetFieldInfoResp* response) { return this->setFieldInfo(context, request, response); }));}
     void SetMessageAllocatorFor_setFieldInfo(
         ::grpc::MessageAllocator< ::rp4::SetFieldInfoReq, ::rp4::SetFieldInfoResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(16);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::SetFieldInfoReq, ::rp4::SetFieldInfoResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1598,13 +2118,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_clearOldConfig() {
-      ::grpc::Service::MarkMethodCallback(13,
+      ::grpc::Service::MarkMethodCallback(17,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::ClearOldConfigReq, ::rp4::ClearOldConfigResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::ClearOldConfigReq* request, ::rp4::ClearOldConfigResp* response) { return this->clearOldConfig(context, request, response); }));}
     void SetMessageAllocatorFor_clearOldConfig(
         ::grpc::MessageAllocator< ::rp4::ClearOldConfigReq, ::rp4::ClearOldConfigResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(13);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(17);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::ClearOldConfigReq, ::rp4::ClearOldConfigResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1625,13 +2145,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_setMissActId() {
-      ::grpc::Service::MarkMethodCallback(14,
+      ::grpc::Service::MarkMethodCallback(18,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::SetMissActIdReq, ::rp4::SetMissActIdResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::SetMissActIdReq* request, ::rp4::SetMissActIdResp* response) { return this->setMissActId(context, request, response); }));}
     void SetMessageAllocatorFor_setMissActId(
         ::grpc::MessageAllocator< ::rp4::SetMissActIdReq, ::rp4::SetMissActIdResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(14);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(18);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::SetMissActIdReq, ::rp4::SetMissActIdResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1652,13 +2172,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_insertSramEntry() {
-      ::grpc::Service::MarkMethodCallback(15,
+      ::grpc::Service::MarkMethodCallback(19,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::InsertSramEntryReq, ::rp4::InsertSramEntryResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::InsertSramEntryReq* request, ::rp4::InsertSramEntryResp* response) { return this->insertSramEntry(context, request, response); }));}
     void SetMessageAllocatorFor_insertSramEntry(
         ::grpc::MessageAllocator< ::rp4::InsertSramEntryReq, ::rp4::InsertSramEntryResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(15);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(19);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::InsertSramEntryReq, ::rp4::InsertSramEntryResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1679,13 +2199,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_insertTcamEntry() {
-      ::grpc::Service::MarkMethodCallback(16,
+      ::grpc::Service::MarkMethodCallback(20,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::InsertTcamEntryReq, ::rp4::InsertTcamEntryResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::InsertTcamEntryReq* request, ::rp4::InsertTcamEntryResp* response) { return this->insertTcamEntry(context, request, response); }));}
     void SetMessageAllocatorFor_insertTcamEntry(
         ::grpc::MessageAllocator< ::rp4::InsertTcamEntryReq, ::rp4::InsertTcamEntryResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(16);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(20);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::InsertTcamEntryReq, ::rp4::InsertTcamEntryResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1701,18 +2221,148 @@ class CfgService final {
       ::grpc::CallbackServerContext* /*context*/, const ::rp4::InsertTcamEntryReq* /*request*/, ::rp4::InsertTcamEntryResp* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_modSramEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_modSramEntry() {
+      ::grpc::Service::MarkMethodCallback(21,
+          new ::grpc::internal::CallbackUnaryHandler< ::rp4::ModSramEntryReq, ::rp4::ModSramEntryResp>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::rp4::ModSramEntryReq* request, ::rp4::ModSramEntryResp* response) { return this->modSramEntry(context, request, response); }));}
+    void SetMessageAllocatorFor_modSramEntry(
+        ::grpc::MessageAllocator< ::rp4::ModSramEntryReq, ::rp4::ModSramEntryResp>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(21);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::ModSramEntryReq, ::rp4::ModSramEntryResp>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_modSramEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status modSramEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModSramEntryReq* /*request*/, ::rp4::ModSramEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* modSramEntry(
+      ::grpc::CallbackServerContext* /*context*/, const ::rp4::ModSramEntryReq* /*request*/, ::rp4::ModSramEntryResp* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_delSramEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_delSramEntry() {
+      ::grpc::Service::MarkMethodCallback(22,
+          new ::grpc::internal::CallbackUnaryHandler< ::rp4::DelSramEntryReq, ::rp4::DelSramEntryResp>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::rp4::DelSramEntryReq* request, ::rp4::DelSramEntryResp* response) { return this->delSramEntry(context, request, response); }));}
+    void SetMessageAllocatorFor_delSramEntry(
+        ::grpc::MessageAllocator< ::rp4::DelSramEntryReq, ::rp4::DelSramEntryResp>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(22);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::DelSramEntryReq, ::rp4::DelSramEntryResp>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_delSramEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status delSramEntry(::grpc::ServerContext* /*context*/, const ::rp4::DelSramEntryReq* /*request*/, ::rp4::DelSramEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* delSramEntry(
+      ::grpc::CallbackServerContext* /*context*/, const ::rp4::DelSramEntryReq* /*request*/, ::rp4::DelSramEntryResp* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_modTcamEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_modTcamEntry() {
+      ::grpc::Service::MarkMethodCallback(23,
+          new ::grpc::internal::CallbackUnaryHandler< ::rp4::ModTcamEntryReq, ::rp4::ModTcamEntryResp>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::rp4::ModTcamEntryReq* request, ::rp4::ModTcamEntryResp* response) { return this->modTcamEntry(context, request, response); }));}
+    void SetMessageAllocatorFor_modTcamEntry(
+        ::grpc::MessageAllocator< ::rp4::ModTcamEntryReq, ::rp4::ModTcamEntryResp>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(23);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::ModTcamEntryReq, ::rp4::ModTcamEntryResp>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_modTcamEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status modTcamEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModTcamEntryReq* /*request*/, ::rp4::ModTcamEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* modTcamEntry(
+      ::grpc::CallbackServerContext* /*context*/, const ::rp4::ModTcamEntryReq* /*request*/, ::rp4::ModTcamEntryResp* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_delTcamEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_delTcamEntry() {
+      ::grpc::Service::MarkMethodCallback(24,
+          new ::grpc::internal::CallbackUnaryHandler< ::rp4::DelTcamEntryReq, ::rp4::DelTcamEntryResp>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::rp4::DelTcamEntryReq* request, ::rp4::DelTcamEntryResp* response) { return this->delTcamEntry(context, request, response); }));}
+    void SetMessageAllocatorFor_delTcamEntry(
+        ::grpc::MessageAllocator< ::rp4::DelTcamEntryReq, ::rp4::DelTcamEntryResp>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(24);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::DelTcamEntryReq, ::rp4::DelTcamEntryResp>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_delTcamEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status delTcamEntry(::grpc::ServerContext* /*context*/, const ::rp4::DelTcamEntryReq* /*request*/, ::rp4::DelTcamEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* delTcamEntry(
+      ::grpc::CallbackServerContext* /*context*/, const ::rp4::DelTcamEntryReq* /*request*/, ::rp4::DelTcamEntryResp* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_insertEntries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_insertEntries() {
+      ::grpc::Service::MarkMethodCallback(25,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::rp4::InsertEntriesReq, ::rp4::InsertEntriesResp>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::rp4::InsertEntriesResp* response) { return this->insertEntries(context, response); }));
+    }
+    ~WithCallbackMethod_insertEntries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status insertEntries(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::rp4::InsertEntriesReq>* /*reader*/, ::rp4::InsertEntriesResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::rp4::InsertEntriesReq>* insertEntries(
+      ::grpc::CallbackServerContext* /*context*/, ::rp4::InsertEntriesResp* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_insertAction : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_insertAction() {
-      ::grpc::Service::MarkMethodCallback(17,
+      ::grpc::Service::MarkMethodCallback(26,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::InsertActionReq, ::rp4::InsertActionResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::InsertActionReq* request, ::rp4::InsertActionResp* response) { return this->insertAction(context, request, response); }));}
     void SetMessageAllocatorFor_insertAction(
         ::grpc::MessageAllocator< ::rp4::InsertActionReq, ::rp4::InsertActionResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(17);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(26);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::InsertActionReq, ::rp4::InsertActionResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1733,13 +2383,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_clearAction() {
-      ::grpc::Service::MarkMethodCallback(18,
+      ::grpc::Service::MarkMethodCallback(27,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::ClearActionReq, ::rp4::ClearActionResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::ClearActionReq* request, ::rp4::ClearActionResp* response) { return this->clearAction(context, request, response); }));}
     void SetMessageAllocatorFor_clearAction(
         ::grpc::MessageAllocator< ::rp4::ClearActionReq, ::rp4::ClearActionResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(18);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(27);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::ClearActionReq, ::rp4::ClearActionResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1760,13 +2410,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_delAction() {
-      ::grpc::Service::MarkMethodCallback(19,
+      ::grpc::Service::MarkMethodCallback(28,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::DelActionReq, ::rp4::DelActionResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::DelActionReq* request, ::rp4::DelActionResp* response) { return this->delAction(context, request, response); }));}
     void SetMessageAllocatorFor_delAction(
         ::grpc::MessageAllocator< ::rp4::DelActionReq, ::rp4::DelActionResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(19);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(28);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::DelActionReq, ::rp4::DelActionResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1787,13 +2437,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_loadSigmoidTable() {
-      ::grpc::Service::MarkMethodCallback(20,
+      ::grpc::Service::MarkMethodCallback(29,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::LoadSigmoidTableReq, ::rp4::LoadSigmoidTableResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::LoadSigmoidTableReq* request, ::rp4::LoadSigmoidTableResp* response) { return this->loadSigmoidTable(context, request, response); }));}
     void SetMessageAllocatorFor_loadSigmoidTable(
         ::grpc::MessageAllocator< ::rp4::LoadSigmoidTableReq, ::rp4::LoadSigmoidTableResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(20);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(29);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::LoadSigmoidTableReq, ::rp4::LoadSigmoidTableResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1814,13 +2464,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_clearSigmoidTable() {
-      ::grpc::Service::MarkMethodCallback(21,
+      ::grpc::Service::MarkMethodCallback(30,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::ClearSigmoidTableReq, ::rp4::ClearSigmoidTableResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::ClearSigmoidTableReq* request, ::rp4::ClearSigmoidTableResp* response) { return this->clearSigmoidTable(context, request, response); }));}
     void SetMessageAllocatorFor_clearSigmoidTable(
         ::grpc::MessageAllocator< ::rp4::ClearSigmoidTableReq, ::rp4::ClearSigmoidTableResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(21);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(30);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::ClearSigmoidTableReq, ::rp4::ClearSigmoidTableResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1841,13 +2491,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_loadExpTable() {
-      ::grpc::Service::MarkMethodCallback(22,
+      ::grpc::Service::MarkMethodCallback(31,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::LoadExpTableReq, ::rp4::LoadExpTableResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::LoadExpTableReq* request, ::rp4::LoadExpTableResp* response) { return this->loadExpTable(context, request, response); }));}
     void SetMessageAllocatorFor_loadExpTable(
         ::grpc::MessageAllocator< ::rp4::LoadExpTableReq, ::rp4::LoadExpTableResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(22);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(31);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::LoadExpTableReq, ::rp4::LoadExpTableResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1868,13 +2518,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_clearExpTable() {
-      ::grpc::Service::MarkMethodCallback(23,
+      ::grpc::Service::MarkMethodCallback(32,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::ClearExpTableReq, ::rp4::ClearExpTableResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::ClearExpTableReq* request, ::rp4::ClearExpTableResp* response) { return this->clearExpTable(context, request, response); }));}
     void SetMessageAllocatorFor_clearExpTable(
         ::grpc::MessageAllocator< ::rp4::ClearExpTableReq, ::rp4::ClearExpTableResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(23);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(32);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::ClearExpTableReq, ::rp4::ClearExpTableResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1895,13 +2545,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_loadNeuronPrimitiveContext() {
-      ::grpc::Service::MarkMethodCallback(24,
+      ::grpc::Service::MarkMethodCallback(33,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::LoadNeuronPrimitiveContextReq, ::rp4::LoadNeuronPrimitiveContextResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::LoadNeuronPrimitiveContextReq* request, ::rp4::LoadNeuronPrimitiveContextResp* response) { return this->loadNeuronPrimitiveContext(context, request, response); }));}
     void SetMessageAllocatorFor_loadNeuronPrimitiveContext(
         ::grpc::MessageAllocator< ::rp4::LoadNeuronPrimitiveContextReq, ::rp4::LoadNeuronPrimitiveContextResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(24);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(33);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::LoadNeuronPrimitiveContextReq, ::rp4::LoadNeuronPrimitiveContextResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1922,13 +2572,13 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_clearNeuronPrimitiveContexts() {
-      ::grpc::Service::MarkMethodCallback(25,
+      ::grpc::Service::MarkMethodCallback(34,
           new ::grpc::internal::CallbackUnaryHandler< ::rp4::ClearNeuronPrimitiveContextsReq, ::rp4::ClearNeuronPrimitiveContextsResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::rp4::ClearNeuronPrimitiveContextsReq* request, ::rp4::ClearNeuronPrimitiveContextsResp* response) { return this->clearNeuronPrimitiveContexts(context, request, response); }));}
     void SetMessageAllocatorFor_clearNeuronPrimitiveContexts(
         ::grpc::MessageAllocator< ::rp4::ClearNeuronPrimitiveContextsReq, ::rp4::ClearNeuronPrimitiveContextsResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(25);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(34);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::rp4::ClearNeuronPrimitiveContextsReq, ::rp4::ClearNeuronPrimitiveContextsResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1943,7 +2593,7 @@ class CfgService final {
     virtual ::grpc::ServerUnaryReactor* clearNeuronPrimitiveContexts(
       ::grpc::CallbackServerContext* /*context*/, const ::rp4::ClearNeuronPrimitiveContextsReq* /*request*/, ::rp4::ClearNeuronPrimitiveContextsResp* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_setMetadata<WithCallbackMethod_initParserLevel<WithCallbackMethod_modParserEntry<WithCallbackMethod_clearParser<WithCallbackMethod_insertRelationExp<WithCallbackMethod_clearRelationExp<WithCallbackMethod_clearResMap<WithCallbackMethod_modResMap<WithCallbackMethod_setDefaultGateEntry<WithCallbackMethod_setNoTable<WithCallbackMethod_setActionProc<WithCallbackMethod_setMemConfig<WithCallbackMethod_setFieldInfo<WithCallbackMethod_clearOldConfig<WithCallbackMethod_setMissActId<WithCallbackMethod_insertSramEntry<WithCallbackMethod_insertTcamEntry<WithCallbackMethod_insertAction<WithCallbackMethod_clearAction<WithCallbackMethod_delAction<WithCallbackMethod_loadSigmoidTable<WithCallbackMethod_clearSigmoidTable<WithCallbackMethod_loadExpTable<WithCallbackMethod_clearExpTable<WithCallbackMethod_loadNeuronPrimitiveContext<WithCallbackMethod_clearNeuronPrimitiveContexts<Service > > > > > > > > > > > > > > > > > > > > > > > > > > CallbackService;
+  typedef WithCallbackMethod_setMetadata<WithCallbackMethod_beginConfig<WithCallbackMethod_commitConfig<WithCallbackMethod_abortConfig<WithCallbackMethod_applyConfig<WithCallbackMethod_initParserLevel<WithCallbackMethod_modParserEntry<WithCallbackMethod_clearParser<WithCallbackMethod_insertRelationExp<WithCallbackMethod_clearRelationExp<WithCallbackMethod_clearResMap<WithCallbackMethod_modResMap<WithCallbackMethod_setDefaultGateEntry<WithCallbackMethod_setNoTable<WithCallbackMethod_setActionProc<WithCallbackMethod_setMemConfig<WithCallbackMethod_setFieldInfo<WithCallbackMethod_clearOldConfig<WithCallbackMethod_setMissActId<WithCallbackMethod_insertSramEntry<WithCallbackMethod_insertTcamEntry<WithCallbackMethod_modSramEntry<WithCallbackMethod_delSramEntry<WithCallbackMethod_modTcamEntry<WithCallbackMethod_delTcamEntry<WithCallbackMethod_insertEntries<WithCallbackMethod_insertAction<WithCallbackMethod_clearAction<WithCallbackMethod_delAction<WithCallbackMethod_loadSigmoidTable<WithCallbackMethod_clearSigmoidTable<WithCallbackMethod_loadExpTable<WithCallbackMethod_clearExpTable<WithCallbackMethod_loadNeuronPrimitiveContext<WithCallbackMethod_clearNeuronPrimitiveContexts<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_setMetadata : public BaseClass {
@@ -1963,103 +2613,171 @@ class CfgService final {
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_initParserLevel : public BaseClass {
+  class WithGenericMethod_beginConfig : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_initParserLevel() {
+    WithGenericMethod_beginConfig() {
       ::grpc::Service::MarkMethodGeneric(1);
     }
-    ~WithGenericMethod_initParserLevel() override {
+    ~WithGenericMethod_beginConfig() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status initParserLevel(::grpc::ServerContext* /*context*/, const ::rp4::ParserLevelReq* /*request*/, ::rp4::ParserLevelResp* /*response*/) override {
+    ::grpc::Status beginConfig(::grpc::ServerContext* /*context*/, const ::rp4::BeginConfigReq* /*request*/, ::rp4::BeginConfigResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_modParserEntry : public BaseClass {
+  class WithGenericMethod_commitConfig : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_modParserEntry() {
+    WithGenericMethod_commitConfig() {
       ::grpc::Service::MarkMethodGeneric(2);
     }
-    ~WithGenericMethod_modParserEntry() override {
+    ~WithGenericMethod_commitConfig() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status modParserEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModParserEntryReq* /*request*/, ::rp4::ModParserEntryResp* /*response*/) override {
+    ::grpc::Status commitConfig(::grpc::ServerContext* /*context*/, const ::rp4::CommitConfigReq* /*request*/, ::rp4::CommitConfigResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_clearParser : public BaseClass {
+  class WithGenericMethod_abortConfig : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_clearParser() {
+    WithGenericMethod_abortConfig() {
       ::grpc::Service::MarkMethodGeneric(3);
     }
-    ~WithGenericMethod_clearParser() override {
+    ~WithGenericMethod_abortConfig() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status clearParser(::grpc::ServerContext* /*context*/, const ::rp4::ClearParserReq* /*request*/, ::rp4::ClearParserResp* /*response*/) override {
+    ::grpc::Status abortConfig(::grpc::ServerContext* /*context*/, const ::rp4::AbortConfigReq* /*request*/, ::rp4::AbortConfigResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_insertRelationExp : public BaseClass {
+  class WithGenericMethod_applyConfig : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_insertRelationExp() {
+    WithGenericMethod_applyConfig() {
       ::grpc::Service::MarkMethodGeneric(4);
     }
-    ~WithGenericMethod_insertRelationExp() override {
+    ~WithGenericMethod_applyConfig() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status insertRelationExp(::grpc::ServerContext* /*context*/, const ::rp4::InsertRelationExpReq* /*request*/, ::rp4::InsertRelationExpResp* /*response*/) override {
+    ::grpc::Status applyConfig(::grpc::ServerContext* /*context*/, const ::rp4::ApplyConfigReq* /*request*/, ::rp4::ApplyConfigResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_clearRelationExp : public BaseClass {
+  class WithGenericMethod_initParserLevel : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_clearRelationExp() {
+    WithGenericMethod_initParserLevel() {
       ::grpc::Service::MarkMethodGeneric(5);
     }
-    ~WithGenericMethod_clearRelationExp() override {
+    ~WithGenericMethod_initParserLevel() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status clearRelationExp(::grpc::ServerContext* /*context*/, const ::rp4::ClearRelationExpReq* /*request*/, ::rp4::ClearRelationExpResp* /*response*/) override {
+    ::grpc::Status initParserLevel(::grpc::ServerContext* /*context*/, const ::rp4::ParserLevelReq* /*request*/, ::rp4::ParserLevelResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_clearResMap : public BaseClass {
+  class WithGenericMethod_modParserEntry : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_clearResMap() {
+    WithGenericMethod_modParserEntry() {
       ::grpc::Service::MarkMethodGeneric(6);
     }
-    ~WithGenericMethod_clearResMap() override {
+    ~WithGenericMethod_modParserEntry() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status clearResMap(::grpc::ServerContext* /*context*/, const ::rp4::ClearResMapReq* /*request*/, ::rp4::ClearResMapResp* /*response*/) override {
+    ::grpc::Status modParserEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModParserEntryReq* /*request*/, ::rp4::ModParserEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_clearParser : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_clearParser() {
+      ::grpc::Service::MarkMethodGeneric(7);
+    }
+    ~WithGenericMethod_clearParser() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status clearParser(::grpc::ServerContext* /*context*/, const ::rp4::ClearParserReq* /*request*/, ::rp4::ClearParserResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_insertRelationExp : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_insertRelationExp() {
+      ::grpc::Service::MarkMethodGeneric(8);
+    }
+    ~WithGenericMethod_insertRelationExp() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status insertRelationExp(::grpc::ServerContext* /*context*/, const ::rp4::InsertRelationExpReq* /*request*/, ::rp4::InsertRelationExpResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_clearRelationExp : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_clearRelationExp() {
+      ::grpc::Service::MarkMethodGeneric(9);
+    }
+    ~WithGenericMethod_clearRelationExp() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status clearRelationExp(::grpc::ServerContext* /*context*/, const ::rp4::ClearRelationExpReq* /*request*/, ::rp4::ClearRelationExpResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_clearResMap : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_clearResMap() {
+      ::grpc::Service::MarkMethodGeneric(10);
+    }
+    ~WithGenericMethod_clearResMap() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status clearResMap(::grpc::ServerContext* /*context*/, const ::rp4::ClearResMapReq* /*request*/, ::rp4::ClearResMapResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -2070,7 +2788,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_modResMap() {
-      ::grpc::Service::MarkMethodGeneric(7);
+      ::grpc::Service::MarkMethodGeneric(11);
     }
     ~WithGenericMethod_modResMap() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2087,7 +2805,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_setDefaultGateEntry() {
-      ::grpc::Service::MarkMethodGeneric(8);
+      ::grpc::Service::MarkMethodGeneric(12);
     }
     ~WithGenericMethod_setDefaultGateEntry() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2104,7 +2822,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_setNoTable() {
-      ::grpc::Service::MarkMethodGeneric(9);
+      ::grpc::Service::MarkMethodGeneric(13);
     }
     ~WithGenericMethod_setNoTable() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2121,7 +2839,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_setActionProc() {
-      ::grpc::Service::MarkMethodGeneric(10);
+      ::grpc::Service::MarkMethodGeneric(14);
     }
     ~WithGenericMethod_setActionProc() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2138,7 +2856,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_setMemConfig() {
-      ::grpc::Service::MarkMethodGeneric(11);
+      ::grpc::Service::MarkMethodGeneric(15);
     }
     ~WithGenericMethod_setMemConfig() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2155,7 +2873,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_setFieldInfo() {
-      ::grpc::Service::MarkMethodGeneric(12);
+      ::grpc::Service::MarkMethodGeneric(16);
     }
     ~WithGenericMethod_setFieldInfo() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2172,7 +2890,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_clearOldConfig() {
-      ::grpc::Service::MarkMethodGeneric(13);
+      ::grpc::Service::MarkMethodGeneric(17);
     }
     ~WithGenericMethod_clearOldConfig() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2189,7 +2907,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_setMissActId() {
-      ::grpc::Service::MarkMethodGeneric(14);
+      ::grpc::Service::MarkMethodGeneric(18);
     }
     ~WithGenericMethod_setMissActId() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2206,7 +2924,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_insertSramEntry() {
-      ::grpc::Service::MarkMethodGeneric(15);
+      ::grpc::Service::MarkMethodGeneric(19);
     }
     ~WithGenericMethod_insertSramEntry() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2223,7 +2941,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_insertTcamEntry() {
-      ::grpc::Service::MarkMethodGeneric(16);
+      ::grpc::Service::MarkMethodGeneric(20);
     }
     ~WithGenericMethod_insertTcamEntry() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2235,12 +2953,97 @@ class CfgService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_modSramEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_modSramEntry() {
+      ::grpc::Service::MarkMethodGeneric(21);
+    }
+    ~WithGenericMethod_modSramEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status modSramEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModSramEntryReq* /*request*/, ::rp4::ModSramEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_delSramEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_delSramEntry() {
+      ::grpc::Service::MarkMethodGeneric(22);
+    }
+    ~WithGenericMethod_delSramEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status delSramEntry(::grpc::ServerContext* /*context*/, const ::rp4::DelSramEntryReq* /*request*/, ::rp4::DelSramEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_modTcamEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_modTcamEntry() {
+      ::grpc::Service::MarkMethodGeneric(23);
+    }
+    ~WithGenericMethod_modTcamEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status modTcamEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModTcamEntryReq* /*request*/, ::rp4::ModTcamEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_delTcamEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_delTcamEntry() {
+      ::grpc::Service::MarkMethodGeneric(24);
+    }
+    ~WithGenericMethod_delTcamEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status delTcamEntry(::grpc::ServerContext* /*context*/, const ::rp4::DelTcamEntryReq* /*request*/, ::rp4::DelTcamEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_insertEntries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_insertEntries() {
+      ::grpc::Service::MarkMethodGeneric(25);
+    }
+    ~WithGenericMethod_insertEntries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status insertEntries(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::rp4::InsertEntriesReq>* /*reader*/, ::rp4::InsertEntriesResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_insertAction : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_insertAction() {
-      ::grpc::Service::MarkMethodGeneric(17);
+      ::grpc::Service::MarkMethodGeneric(26);
     }
     ~WithGenericMethod_insertAction() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2257,7 +3060,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_clearAction() {
-      ::grpc::Service::MarkMethodGeneric(18);
+      ::grpc::Service::MarkMethodGeneric(27);
     }
     ~WithGenericMethod_clearAction() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2274,7 +3077,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_delAction() {
-      ::grpc::Service::MarkMethodGeneric(19);
+      ::grpc::Service::MarkMethodGeneric(28);
     }
     ~WithGenericMethod_delAction() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2291,7 +3094,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_loadSigmoidTable() {
-      ::grpc::Service::MarkMethodGeneric(20);
+      ::grpc::Service::MarkMethodGeneric(29);
     }
     ~WithGenericMethod_loadSigmoidTable() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2308,7 +3111,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_clearSigmoidTable() {
-      ::grpc::Service::MarkMethodGeneric(21);
+      ::grpc::Service::MarkMethodGeneric(30);
     }
     ~WithGenericMethod_clearSigmoidTable() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2325,7 +3128,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_loadExpTable() {
-      ::grpc::Service::MarkMethodGeneric(22);
+      ::grpc::Service::MarkMethodGeneric(31);
     }
     ~WithGenericMethod_loadExpTable() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2342,7 +3145,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_clearExpTable() {
-      ::grpc::Service::MarkMethodGeneric(23);
+      ::grpc::Service::MarkMethodGeneric(32);
     }
     ~WithGenericMethod_clearExpTable() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2359,7 +3162,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_loadNeuronPrimitiveContext() {
-      ::grpc::Service::MarkMethodGeneric(24);
+      ::grpc::Service::MarkMethodGeneric(33);
     }
     ~WithGenericMethod_loadNeuronPrimitiveContext() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2376,7 +3179,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_clearNeuronPrimitiveContexts() {
-      ::grpc::Service::MarkMethodGeneric(25);
+      ::grpc::Service::MarkMethodGeneric(34);
     }
     ~WithGenericMethod_clearNeuronPrimitiveContexts() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2408,233 +3211,313 @@ class CfgService final {
     }
   };
   template <class BaseClass>
-  class WithRawMethod_initParserLevel : public BaseClass {
+  class WithRawMethod_beginConfig : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_initParserLevel() {
+    WithRawMethod_beginConfig() {
       ::grpc::Service::MarkMethodRaw(1);
     }
-    ~WithRawMethod_initParserLevel() override {
+    ~WithRawMethod_beginConfig() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status initParserLevel(::grpc::ServerContext* /*context*/, const ::rp4::ParserLevelReq* /*request*/, ::rp4::ParserLevelResp* /*response*/) override {
+    ::grpc::Status beginConfig(::grpc::ServerContext* /*context*/, const ::rp4::BeginConfigReq* /*request*/, ::rp4::BeginConfigResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestinitParserLevel(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestbeginConfig(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_modParserEntry : public BaseClass {
+  class WithRawMethod_commitConfig : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_modParserEntry() {
+    WithRawMethod_commitConfig() {
       ::grpc::Service::MarkMethodRaw(2);
     }
-    ~WithRawMethod_modParserEntry() override {
+    ~WithRawMethod_commitConfig() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status modParserEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModParserEntryReq* /*request*/, ::rp4::ModParserEntryResp* /*response*/) override {
+    ::grpc::Status commitConfig(::grpc::ServerContext* /*context*/, const ::rp4::CommitConfigReq* /*request*/, ::rp4::CommitConfigResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestmodParserEntry(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestcommitConfig(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_clearParser : public BaseClass {
+  class WithRawMethod_abortConfig : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_clearParser() {
+    WithRawMethod_abortConfig() {
       ::grpc::Service::MarkMethodRaw(3);
     }
-    ~WithRawMethod_clearParser() override {
+    ~WithRawMethod_abortConfig() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status clearParser(::grpc::ServerContext* /*context*/, const ::rp4::ClearParserReq* /*request*/, ::rp4::ClearParserResp* /*response*/) override {
+    ::grpc::Status abortConfig(::grpc::ServerContext* /*context*/, const ::rp4::AbortConfigReq* /*request*/, ::rp4::AbortConfigResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestclearParser(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestabortConfig(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_insertRelationExp : public BaseClass {
+  class WithRawMethod_applyConfig : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_insertRelationExp() {
+    WithRawMethod_applyConfig() {
       ::grpc::Service::MarkMethodRaw(4);
     }
-    ~WithRawMethod_insertRelationExp() override {
+    ~WithRawMethod_applyConfig() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status insertRelationExp(::grpc::ServerContext* /*context*/, const ::rp4::InsertRelationExpReq* /*request*/, ::rp4::InsertRelationExpResp* /*response*/) override {
+    ::grpc::Status applyConfig(::grpc::ServerContext* /*context*/, const ::rp4::ApplyConfigReq* /*request*/, ::rp4::ApplyConfigResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestinsertRelationExp(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestapplyConfig(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_clearRelationExp : public BaseClass {
+  class WithRawMethod_initParserLevel : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_clearRelationExp() {
+    WithRawMethod_initParserLevel() {
       ::grpc::Service::MarkMethodRaw(5);
     }
-    ~WithRawMethod_clearRelationExp() override {
+    ~WithRawMethod_initParserLevel() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status clearRelationExp(::grpc::ServerContext* /*context*/, const ::rp4::ClearRelationExpReq* /*request*/, ::rp4::ClearRelationExpResp* /*response*/) override {
+    ::grpc::Status initParserLevel(::grpc::ServerContext* /*context*/, const ::rp4::ParserLevelReq* /*request*/, ::rp4::ParserLevelResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestclearRelationExp(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestinitParserLevel(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_clearResMap : public BaseClass {
+  class WithRawMethod_modParserEntry : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_clearResMap() {
+    WithRawMethod_modParserEntry() {
       ::grpc::Service::MarkMethodRaw(6);
     }
-    ~WithRawMethod_clearResMap() override {
+    ~WithRawMethod_modParserEntry() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status clearResMap(::grpc::ServerContext* /*context*/, const ::rp4::ClearResMapReq* /*request*/, ::rp4::ClearResMapResp* /*response*/) override {
+    ::grpc::Status modParserEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModParserEntryReq* /*request*/, ::rp4::ModParserEntryResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestclearResMap(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestmodParserEntry(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_modResMap : public BaseClass {
+  class WithRawMethod_clearParser : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_modResMap() {
+    WithRawMethod_clearParser() {
       ::grpc::Service::MarkMethodRaw(7);
     }
-    ~WithRawMethod_modResMap() override {
+    ~WithRawMethod_clearParser() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status modResMap(::grpc::ServerContext* /*context*/, const ::rp4::ModResMapReq* /*request*/, ::rp4::ModResMapResp* /*response*/) override {
+    ::grpc::Status clearParser(::grpc::ServerContext* /*context*/, const ::rp4::ClearParserReq* /*request*/, ::rp4::ClearParserResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestmodResMap(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestclearParser(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_setDefaultGateEntry : public BaseClass {
+  class WithRawMethod_insertRelationExp : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_setDefaultGateEntry() {
+    WithRawMethod_insertRelationExp() {
       ::grpc::Service::MarkMethodRaw(8);
     }
-    ~WithRawMethod_setDefaultGateEntry() override {
+    ~WithRawMethod_insertRelationExp() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status setDefaultGateEntry(::grpc::ServerContext* /*context*/, const ::rp4::SetDefaultGateEntryReq* /*request*/, ::rp4::SetDefaultGateEntryResp* /*response*/) override {
+    ::grpc::Status insertRelationExp(::grpc::ServerContext* /*context*/, const ::rp4::InsertRelationExpReq* /*request*/, ::rp4::InsertRelationExpResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestsetDefaultGateEntry(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestinsertRelationExp(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_setNoTable : public BaseClass {
+  class WithRawMethod_clearRelationExp : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_setNoTable() {
+    WithRawMethod_clearRelationExp() {
       ::grpc::Service::MarkMethodRaw(9);
     }
-    ~WithRawMethod_setNoTable() override {
+    ~WithRawMethod_clearRelationExp() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status setNoTable(::grpc::ServerContext* /*context*/, const ::rp4::SetNoTableReq* /*request*/, ::rp4::SetNoTableResp* /*response*/) override {
+    ::grpc::Status clearRelationExp(::grpc::ServerContext* /*context*/, const ::rp4::ClearRelationExpReq* /*request*/, ::rp4::ClearRelationExpResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestsetNoTable(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestclearRelationExp(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_setActionProc : public BaseClass {
+  class WithRawMethod_clearResMap : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_setActionProc() {
+    WithRawMethod_clearResMap() {
       ::grpc::Service::MarkMethodRaw(10);
     }
-    ~WithRawMethod_setActionProc() override {
+    ~WithRawMethod_clearResMap() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status setActionProc(::grpc::ServerContext* /*context*/, const ::rp4::SetActionProcReq* /*request*/, ::rp4::SetActionProcResp* /*response*/) override {
+    ::grpc::Status clearResMap(::grpc::ServerContext* /*context*/, const ::rp4::ClearResMapReq* /*request*/, ::rp4::ClearResMapResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestsetActionProc(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestclearResMap(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_setMemConfig : public BaseClass {
+  class WithRawMethod_modResMap : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_setMemConfig() {
+    WithRawMethod_modResMap() {
       ::grpc::Service::MarkMethodRaw(11);
     }
-    ~WithRawMethod_setMemConfig() override {
+    ~WithRawMethod_modResMap() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status setMemConfig(::grpc::ServerContext* /*context*/, const ::rp4::SetMemConfigReq* /*request*/, ::rp4::SetMemConfigResp* /*response*/) override {
+    ::grpc::Status modResMap(::grpc::ServerContext* /*context*/, const ::rp4::ModResMapReq* /*request*/, ::rp4::ModResMapResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestsetMemConfig(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestmodResMap(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_setFieldInfo : public BaseClass {
+  class WithRawMethod_setDefaultGateEntry : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_setFieldInfo() {
+    WithRawMethod_setDefaultGateEntry() {
       ::grpc::Service::MarkMethodRaw(12);
     }
+    ~WithRawMethod_setDefaultGateEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status setDefaultGateEntry(::grpc::ServerContext* /*context*/, const ::rp4::SetDefaultGateEntryReq* /*request*/, ::rp4::SetDefaultGateEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestsetDefaultGateEntry(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_setNoTable : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_setNoTable() {
+      ::grpc::Service::MarkMethodRaw(13);
+    }
+    ~WithRawMethod_setNoTable() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status setNoTable(::grpc::ServerContext* /*context*/, const ::rp4::SetNoTableReq* /*request*/, ::rp4::SetNoTableResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestsetNoTable(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_setActionProc : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_setActionProc() {
+      ::grpc::Service::MarkMethodRaw(14);
+    }
+    ~WithRawMethod_setActionProc() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status setActionProc(::grpc::ServerContext* /*context*/, const ::rp4::SetActionProcReq* /*request*/, ::rp4::SetActionProcResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestsetActionProc(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_setMemConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_setMemConfig() {
+      ::grpc::Service::MarkMethodRaw(15);
+    }
+    ~WithRawMethod_setMemConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status setMemConfig(::grpc::ServerContext* /*context*/, const ::rp4::SetMemConfigReq* /*request*/, ::rp4::SetMemConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestsetMemConfig(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_setFieldInfo : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_setFieldInfo() {
+      ::grpc::Service::MarkMethodRaw(16);
+    }
     ~WithRawMethod_setFieldInfo() override {
       BaseClassMustBeDerivedFromService(this);
     }
@@ -2644,7 +3527,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestsetFieldInfo(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2653,7 +3536,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_clearOldConfig() {
-      ::grpc::Service::MarkMethodRaw(13);
+      ::grpc::Service::MarkMethodRaw(17);
     }
     ~WithRawMethod_clearOldConfig() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2664,7 +3547,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestclearOldConfig(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2673,7 +3556,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_setMissActId() {
-      ::grpc::Service::MarkMethodRaw(14);
+      ::grpc::Service::MarkMethodRaw(18);
     }
     ~WithRawMethod_setMissActId() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2684,7 +3567,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestsetMissActId(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2693,7 +3576,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_insertSramEntry() {
-      ::grpc::Service::MarkMethodRaw(15);
+      ::grpc::Service::MarkMethodRaw(19);
     }
     ~WithRawMethod_insertSramEntry() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2704,7 +3587,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestinsertSramEntry(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2713,7 +3596,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_insertTcamEntry() {
-      ::grpc::Service::MarkMethodRaw(16);
+      ::grpc::Service::MarkMethodRaw(20);
     }
     ~WithRawMethod_insertTcamEntry() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2724,7 +3607,107 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestinsertTcamEntry(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(20, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_modSramEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_modSramEntry() {
+      ::grpc::Service::MarkMethodRaw(21);
+    }
+    ~WithRawMethod_modSramEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status modSramEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModSramEntryReq* /*request*/, ::rp4::ModSramEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestmodSramEntry(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(21, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_delSramEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_delSramEntry() {
+      ::grpc::Service::MarkMethodRaw(22);
+    }
+    ~WithRawMethod_delSramEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status delSramEntry(::grpc::ServerContext* /*context*/, const ::rp4::DelSramEntryReq* /*request*/, ::rp4::DelSramEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestdelSramEntry(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(22, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_modTcamEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_modTcamEntry() {
+      ::grpc::Service::MarkMethodRaw(23);
+    }
+    ~WithRawMethod_modTcamEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status modTcamEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModTcamEntryReq* /*request*/, ::rp4::ModTcamEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestmodTcamEntry(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(23, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_delTcamEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_delTcamEntry() {
+      ::grpc::Service::MarkMethodRaw(24);
+    }
+    ~WithRawMethod_delTcamEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status delTcamEntry(::grpc::ServerContext* /*context*/, const ::rp4::DelTcamEntryReq* /*request*/, ::rp4::DelTcamEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestdelTcamEntry(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(24, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_insertEntries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_insertEntries() {
+      ::grpc::Service::MarkMethodRaw(25);
+    }
+    ~WithRawMethod_insertEntries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status insertEntries(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::rp4::InsertEntriesReq>* /*reader*/, ::rp4::InsertEntriesResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestinsertEntries(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(25, context, reader, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2733,7 +3716,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_insertAction() {
-      ::grpc::Service::MarkMethodRaw(17);
+      ::grpc::Service::MarkMethodRaw(26);
     }
     ~WithRawMethod_insertAction() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2744,7 +3727,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestinsertAction(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(26, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2753,7 +3736,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_clearAction() {
-      ::grpc::Service::MarkMethodRaw(18);
+      ::grpc::Service::MarkMethodRaw(27);
     }
     ~WithRawMethod_clearAction() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2764,7 +3747,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestclearAction(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(27, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2773,7 +3756,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_delAction() {
-      ::grpc::Service::MarkMethodRaw(19);
+      ::grpc::Service::MarkMethodRaw(28);
     }
     ~WithRawMethod_delAction() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2784,7 +3767,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestdelAction(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(28, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2793,7 +3776,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_loadSigmoidTable() {
-      ::grpc::Service::MarkMethodRaw(20);
+      ::grpc::Service::MarkMethodRaw(29);
     }
     ~WithRawMethod_loadSigmoidTable() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2804,7 +3787,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestloadSigmoidTable(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(20, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(29, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2813,7 +3796,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_clearSigmoidTable() {
-      ::grpc::Service::MarkMethodRaw(21);
+      ::grpc::Service::MarkMethodRaw(30);
     }
     ~WithRawMethod_clearSigmoidTable() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2824,7 +3807,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestclearSigmoidTable(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(21, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(30, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2833,7 +3816,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_loadExpTable() {
-      ::grpc::Service::MarkMethodRaw(22);
+      ::grpc::Service::MarkMethodRaw(31);
     }
     ~WithRawMethod_loadExpTable() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2844,7 +3827,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestloadExpTable(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(22, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(31, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2853,7 +3836,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_clearExpTable() {
-      ::grpc::Service::MarkMethodRaw(23);
+      ::grpc::Service::MarkMethodRaw(32);
     }
     ~WithRawMethod_clearExpTable() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2864,7 +3847,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestclearExpTable(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(23, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(32, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2873,7 +3856,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_loadNeuronPrimitiveContext() {
-      ::grpc::Service::MarkMethodRaw(24);
+      ::grpc::Service::MarkMethodRaw(33);
     }
     ~WithRawMethod_loadNeuronPrimitiveContext() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2884,7 +3867,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestloadNeuronPrimitiveContext(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(24, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(33, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2893,7 +3876,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_clearNeuronPrimitiveContexts() {
-      ::grpc::Service::MarkMethodRaw(25);
+      ::grpc::Service::MarkMethodRaw(34);
     }
     ~WithRawMethod_clearNeuronPrimitiveContexts() override {
       BaseClassMustBeDerivedFromService(this);
@@ -2904,7 +3887,7 @@ class CfgService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestclearNeuronPrimitiveContexts(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(25, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(34, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2930,12 +3913,100 @@ class CfgService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_beginConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_beginConfig() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->beginConfig(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_beginConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status beginConfig(::grpc::ServerContext* /*context*/, const ::rp4::BeginConfigReq* /*request*/, ::rp4::BeginConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* beginConfig(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_commitConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_commitConfig() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->commitConfig(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_commitConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status commitConfig(::grpc::ServerContext* /*context*/, const ::rp4::CommitConfigReq* /*request*/, ::rp4::CommitConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* commitConfig(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_abortConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_abortConfig() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->abortConfig(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_abortConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status abortConfig(::grpc::ServerContext* /*context*/, const ::rp4::AbortConfigReq* /*request*/, ::rp4::AbortConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* abortConfig(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_applyConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_applyConfig() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->applyConfig(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_applyConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status applyConfig(::grpc::ServerContext* /*context*/, const ::rp4::ApplyConfigReq* /*request*/, ::rp4::ApplyConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* applyConfig(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_initParserLevel : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_initParserLevel() {
-      ::grpc::Service::MarkMethodRawCallback(1,
+      ::grpc::Service::MarkMethodRawCallback(5,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->initParserLevel(context, request, response); }));
@@ -2957,7 +4028,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_modParserEntry() {
-      ::grpc::Service::MarkMethodRawCallback(2,
+      ::grpc::Service::MarkMethodRawCallback(6,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->modParserEntry(context, request, response); }));
@@ -2979,7 +4050,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_clearParser() {
-      ::grpc::Service::MarkMethodRawCallback(3,
+      ::grpc::Service::MarkMethodRawCallback(7,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->clearParser(context, request, response); }));
@@ -3001,7 +4072,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_insertRelationExp() {
-      ::grpc::Service::MarkMethodRawCallback(4,
+      ::grpc::Service::MarkMethodRawCallback(8,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->insertRelationExp(context, request, response); }));
@@ -3023,7 +4094,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_clearRelationExp() {
-      ::grpc::Service::MarkMethodRawCallback(5,
+      ::grpc::Service::MarkMethodRawCallback(9,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->clearRelationExp(context, request, response); }));
@@ -3045,7 +4116,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_clearResMap() {
-      ::grpc::Service::MarkMethodRawCallback(6,
+      ::grpc::Service::MarkMethodRawCallback(10,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->clearResMap(context, request, response); }));
@@ -3067,7 +4138,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_modResMap() {
-      ::grpc::Service::MarkMethodRawCallback(7,
+      ::grpc::Service::MarkMethodRawCallback(11,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->modResMap(context, request, response); }));
@@ -3089,7 +4160,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_setDefaultGateEntry() {
-      ::grpc::Service::MarkMethodRawCallback(8,
+      ::grpc::Service::MarkMethodRawCallback(12,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->setDefaultGateEntry(context, request, response); }));
@@ -3111,7 +4182,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_setNoTable() {
-      ::grpc::Service::MarkMethodRawCallback(9,
+      ::grpc::Service::MarkMethodRawCallback(13,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->setNoTable(context, request, response); }));
@@ -3133,7 +4204,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_setActionProc() {
-      ::grpc::Service::MarkMethodRawCallback(10,
+      ::grpc::Service::MarkMethodRawCallback(14,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->setActionProc(context, request, response); }));
@@ -3154,132 +4225,242 @@ class CfgService final {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_setMemConfig() {
-      ::grpc::Service::MarkMethodRawCallback(11,
+    WithRawCallbackMethod_setMemConfig() {
+      ::grpc::Service::MarkMethodRawCallback(15,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->setMemConfig(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_setMemConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status setMemConfig(::grpc::ServerContext* /*context*/, const ::rp4::SetMemConfigReq* /*request*/, ::rp4::SetMemConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* setMemConfig(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_setFieldInfo : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_setFieldInfo() {
+      ::grpc::Service::MarkMethodRawCallback(16,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->setFieldInfo(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_setFieldInfo() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status setFieldInfo(::grpc::ServerContext* /*context*/, const ::rp4::SetFieldInfoReq* /*request*/, ::rp4::SetFieldInfoResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* setFieldInfo(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_clearOldConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_clearOldConfig() {
+      ::grpc::Service::MarkMethodRawCallback(17,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->clearOldConfig(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_clearOldConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status clearOldConfig(::grpc::ServerContext* /*context*/, const ::rp4::ClearOldConfigReq* /*request*/, ::rp4::ClearOldConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* clearOldConfig(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_setMissActId : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_setMissActId() {
+      ::grpc::Service::MarkMethodRawCallback(18,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->setMissActId(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_setMissActId() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status setMissActId(::grpc::ServerContext* /*context*/, const ::rp4::SetMissActIdReq* /*request*/, ::rp4::SetMissActIdResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* setMissActId(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_insertSramEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_insertSramEntry() {
+      ::grpc::Service::MarkMethodRawCallback(19,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->insertSramEntry(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_insertSramEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status insertSramEntry(::grpc::ServerContext* /*context*/, const ::rp4::InsertSramEntryReq* /*request*/, ::rp4::InsertSramEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* insertSramEntry(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_insertTcamEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_insertTcamEntry() {
+      ::grpc::Service::MarkMethodRawCallback(20,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->setMemConfig(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->insertTcamEntry(context, request, response); }));
     }
-    ~WithRawCallbackMethod_setMemConfig() override {
+    ~WithRawCallbackMethod_insertTcamEntry() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status setMemConfig(::grpc::ServerContext* /*context*/, const ::rp4::SetMemConfigReq* /*request*/, ::rp4::SetMemConfigResp* /*response*/) override {
+    ::grpc::Status insertTcamEntry(::grpc::ServerContext* /*context*/, const ::rp4::InsertTcamEntryReq* /*request*/, ::rp4::InsertTcamEntryResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* setMemConfig(
+    virtual ::grpc::ServerUnaryReactor* insertTcamEntry(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_setFieldInfo : public BaseClass {
+  class WithRawCallbackMethod_modSramEntry : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_setFieldInfo() {
-      ::grpc::Service::MarkMethodRawCallback(12,
+    WithRawCallbackMethod_modSramEntry() {
+      ::grpc::Service::MarkMethodRawCallback(21,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->setFieldInfo(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->modSramEntry(context, request, response); }));
     }
-    ~WithRawCallbackMethod_setFieldInfo() override {
+    ~WithRawCallbackMethod_modSramEntry() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status setFieldInfo(::grpc::ServerContext* /*context*/, const ::rp4::SetFieldInfoReq* /*request*/, ::rp4::SetFieldInfoResp* /*response*/) override {
+    ::grpc::Status modSramEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModSramEntryReq* /*request*/, ::rp4::ModSramEntryResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* setFieldInfo(
+    virtual ::grpc::ServerUnaryReactor* modSramEntry(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_clearOldConfig : public BaseClass {
+  class WithRawCallbackMethod_delSramEntry : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_clearOldConfig() {
-      ::grpc::Service::MarkMethodRawCallback(13,
+    WithRawCallbackMethod_delSramEntry() {
+      ::grpc::Service::MarkMethodRawCallback(22,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->clearOldConfig(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->delSramEntry(context, request, response); }));
     }
-    ~WithRawCallbackMethod_clearOldConfig() override {
+    ~WithRawCallbackMethod_delSramEntry() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status clearOldConfig(::grpc::ServerContext* /*context*/, const ::rp4::ClearOldConfigReq* /*request*/, ::rp4::ClearOldConfigResp* /*response*/) override {
+    ::grpc::Status delSramEntry(::grpc::ServerContext* /*context*/, const ::rp4::DelSramEntryReq* /*request*/, ::rp4::DelSramEntryResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* clearOldConfig(
+    virtual ::grpc::ServerUnaryReactor* delSramEntry(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_setMissActId : public BaseClass {
+  class WithRawCallbackMethod_modTcamEntry : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_setMissActId() {
-      ::grpc::Service::MarkMethodRawCallback(14,
+    WithRawCallbackMethod_modTcamEntry() {
+      ::grpc::Service::MarkMethodRawCallback(23,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->setMissActId(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->modTcamEntry(context, request, response); }));
     }
-    ~WithRawCallbackMethod_setMissActId() override {
+    ~WithRawCallbackMethod_modTcamEntry() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status setMissActId(::grpc::ServerContext* /*context*/, const ::rp4::SetMissActIdReq* /*request*/, ::rp4::SetMissActIdResp* /*response*/) override {
+    ::grpc::Status modTcamEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModTcamEntryReq* /*request*/, ::rp4::ModTcamEntryResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* setMissActId(
+    virtual ::grpc::ServerUnaryReactor* modTcamEntry(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_insertSramEntry : public BaseClass {
+  class WithRawCallbackMethod_delTcamEntry : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_insertSramEntry() {
-      ::grpc::Service::MarkMethodRawCallback(15,
+    WithRawCallbackMethod_delTcamEntry() {
+      ::grpc::Service::MarkMethodRawCallback(24,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->insertSramEntry(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->delTcamEntry(context, request, response); }));
     }
-    ~WithRawCallbackMethod_insertSramEntry() override {
+    ~WithRawCallbackMethod_delTcamEntry() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status insertSramEntry(::grpc::ServerContext* /*context*/, const ::rp4::InsertSramEntryReq* /*request*/, ::rp4::InsertSramEntryResp* /*response*/) override {
+    ::grpc::Status delTcamEntry(::grpc::ServerContext* /*context*/, const ::rp4::DelTcamEntryReq* /*request*/, ::rp4::DelTcamEntryResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* insertSramEntry(
+    virtual ::grpc::ServerUnaryReactor* delTcamEntry(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_insertTcamEntry : public BaseClass {
+  class WithRawCallbackMethod_insertEntries : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_insertTcamEntry() {
-      ::grpc::Service::MarkMethodRawCallback(16,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+    WithRawCallbackMethod_insertEntries() {
+      ::grpc::Service::MarkMethodRawCallback(25,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->insertTcamEntry(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, ::grpc::ByteBuffer* response) { return this->insertEntries(context, response); }));
     }
-    ~WithRawCallbackMethod_insertTcamEntry() override {
+    ~WithRawCallbackMethod_insertEntries() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status insertTcamEntry(::grpc::ServerContext* /*context*/, const ::rp4::InsertTcamEntryReq* /*request*/, ::rp4::InsertTcamEntryResp* /*response*/) override {
+    ::grpc::Status insertEntries(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::rp4::InsertEntriesReq>* /*reader*/, ::rp4::InsertEntriesResp* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* insertTcamEntry(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+    virtual ::grpc::ServerReadReactor< ::grpc::ByteBuffer>* insertEntries(
+      ::grpc::CallbackServerContext* /*context*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
   class WithRawCallbackMethod_insertAction : public BaseClass {
@@ -3287,7 +4468,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_insertAction() {
-      ::grpc::Service::MarkMethodRawCallback(17,
+      ::grpc::Service::MarkMethodRawCallback(26,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->insertAction(context, request, response); }));
@@ -3309,7 +4490,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_clearAction() {
-      ::grpc::Service::MarkMethodRawCallback(18,
+      ::grpc::Service::MarkMethodRawCallback(27,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->clearAction(context, request, response); }));
@@ -3331,7 +4512,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_delAction() {
-      ::grpc::Service::MarkMethodRawCallback(19,
+      ::grpc::Service::MarkMethodRawCallback(28,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->delAction(context, request, response); }));
@@ -3353,7 +4534,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_loadSigmoidTable() {
-      ::grpc::Service::MarkMethodRawCallback(20,
+      ::grpc::Service::MarkMethodRawCallback(29,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->loadSigmoidTable(context, request, response); }));
@@ -3375,7 +4556,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_clearSigmoidTable() {
-      ::grpc::Service::MarkMethodRawCallback(21,
+      ::grpc::Service::MarkMethodRawCallback(30,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->clearSigmoidTable(context, request, response); }));
@@ -3397,7 +4578,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_loadExpTable() {
-      ::grpc::Service::MarkMethodRawCallback(22,
+      ::grpc::Service::MarkMethodRawCallback(31,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->loadExpTable(context, request, response); }));
@@ -3419,7 +4600,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_clearExpTable() {
-      ::grpc::Service::MarkMethodRawCallback(23,
+      ::grpc::Service::MarkMethodRawCallback(32,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->clearExpTable(context, request, response); }));
@@ -3441,7 +4622,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_loadNeuronPrimitiveContext() {
-      ::grpc::Service::MarkMethodRawCallback(24,
+      ::grpc::Service::MarkMethodRawCallback(33,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->loadNeuronPrimitiveContext(context, request, response); }));
@@ -3463,7 +4644,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_clearNeuronPrimitiveContexts() {
-      ::grpc::Service::MarkMethodRawCallback(25,
+      ::grpc::Service::MarkMethodRawCallback(34,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->clearNeuronPrimitiveContexts(context, request, response); }));
@@ -3507,12 +4688,120 @@ class CfgService final {
     virtual ::grpc::Status StreamedsetMetadata(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::rp4::SetMetadataReq,::rp4::SetMetadataResp>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_beginConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_beginConfig() {
+      ::grpc::Service::MarkMethodStreamed(1,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::rp4::BeginConfigReq, ::rp4::BeginConfigResp>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::rp4::BeginConfigReq, ::rp4::BeginConfigResp>* streamer) {
+                       return this->StreamedbeginConfig(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_beginConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status beginConfig(::grpc::ServerContext* /*context*/, const ::rp4::BeginConfigReq* /*request*/, ::rp4::BeginConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedbeginConfig(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::rp4::BeginConfigReq,::rp4::BeginConfigResp>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_commitConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_commitConfig() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::rp4::CommitConfigReq, ::rp4::CommitConfigResp>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::rp4::CommitConfigReq, ::rp4::CommitConfigResp>* streamer) {
+                       return this->StreamedcommitConfig(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_commitConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status commitConfig(::grpc::ServerContext* /*context*/, const ::rp4::CommitConfigReq* /*request*/, ::rp4::CommitConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedcommitConfig(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::rp4::CommitConfigReq,::rp4::CommitConfigResp>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_abortConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_abortConfig() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::rp4::AbortConfigReq, ::rp4::AbortConfigResp>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::rp4::AbortConfigReq, ::rp4::AbortConfigResp>* streamer) {
+                       return this->StreamedabortConfig(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_abortConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status abortConfig(::grpc::ServerContext* /*context*/, const ::rp4::AbortConfigReq* /*request*/, ::rp4::AbortConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedabortConfig(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::rp4::AbortConfigReq,::rp4::AbortConfigResp>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_applyConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_applyConfig() {
+      ::grpc::Service::MarkMethodStreamed(4,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::rp4::ApplyConfigReq, ::rp4::ApplyConfigResp>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::rp4::ApplyConfigReq, ::rp4::ApplyConfigResp>* streamer) {
+                       return this->StreamedapplyConfig(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_applyConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status applyConfig(::grpc::ServerContext* /*context*/, const ::rp4::ApplyConfigReq* /*request*/, ::rp4::ApplyConfigResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedapplyConfig(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::rp4::ApplyConfigReq,::rp4::ApplyConfigResp>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_initParserLevel : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_initParserLevel() {
-      ::grpc::Service::MarkMethodStreamed(1,
+      ::grpc::Service::MarkMethodStreamed(5,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::ParserLevelReq, ::rp4::ParserLevelResp>(
             [this](::grpc::ServerContext* context,
@@ -3539,7 +4828,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_modParserEntry() {
-      ::grpc::Service::MarkMethodStreamed(2,
+      ::grpc::Service::MarkMethodStreamed(6,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::ModParserEntryReq, ::rp4::ModParserEntryResp>(
             [this](::grpc::ServerContext* context,
@@ -3566,7 +4855,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_clearParser() {
-      ::grpc::Service::MarkMethodStreamed(3,
+      ::grpc::Service::MarkMethodStreamed(7,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::ClearParserReq, ::rp4::ClearParserResp>(
             [this](::grpc::ServerContext* context,
@@ -3593,7 +4882,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_insertRelationExp() {
-      ::grpc::Service::MarkMethodStreamed(4,
+      ::grpc::Service::MarkMethodStreamed(8,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::InsertRelationExpReq, ::rp4::InsertRelationExpResp>(
             [this](::grpc::ServerContext* context,
@@ -3620,7 +4909,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_clearRelationExp() {
-      ::grpc::Service::MarkMethodStreamed(5,
+      ::grpc::Service::MarkMethodStreamed(9,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::ClearRelationExpReq, ::rp4::ClearRelationExpResp>(
             [this](::grpc::ServerContext* context,
@@ -3647,7 +4936,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_clearResMap() {
-      ::grpc::Service::MarkMethodStreamed(6,
+      ::grpc::Service::MarkMethodStreamed(10,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::ClearResMapReq, ::rp4::ClearResMapResp>(
             [this](::grpc::ServerContext* context,
@@ -3674,7 +4963,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_modResMap() {
-      ::grpc::Service::MarkMethodStreamed(7,
+      ::grpc::Service::MarkMethodStreamed(11,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::ModResMapReq, ::rp4::ModResMapResp>(
             [this](::grpc::ServerContext* context,
@@ -3701,7 +4990,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_setDefaultGateEntry() {
-      ::grpc::Service::MarkMethodStreamed(8,
+      ::grpc::Service::MarkMethodStreamed(12,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::SetDefaultGateEntryReq, ::rp4::SetDefaultGateEntryResp>(
             [this](::grpc::ServerContext* context,
@@ -3728,7 +5017,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_setNoTable() {
-      ::grpc::Service::MarkMethodStreamed(9,
+      ::grpc::Service::MarkMethodStreamed(13,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::SetNoTableReq, ::rp4::SetNoTableResp>(
             [this](::grpc::ServerContext* context,
@@ -3755,7 +5044,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_setActionProc() {
-      ::grpc::Service::MarkMethodStreamed(10,
+      ::grpc::Service::MarkMethodStreamed(14,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::SetActionProcReq, ::rp4::SetActionProcResp>(
             [this](::grpc::ServerContext* context,
@@ -3782,7 +5071,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_setMemConfig() {
-      ::grpc::Service::MarkMethodStreamed(11,
+      ::grpc::Service::MarkMethodStreamed(15,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::SetMemConfigReq, ::rp4::SetMemConfigResp>(
             [this](::grpc::ServerContext* context,
@@ -3809,7 +5098,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_setFieldInfo() {
-      ::grpc::Service::MarkMethodStreamed(12,
+      ::grpc::Service::MarkMethodStreamed(16,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::SetFieldInfoReq, ::rp4::SetFieldInfoResp>(
             [this](::grpc::ServerContext* context,
@@ -3836,7 +5125,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_clearOldConfig() {
-      ::grpc::Service::MarkMethodStreamed(13,
+      ::grpc::Service::MarkMethodStreamed(17,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::ClearOldConfigReq, ::rp4::ClearOldConfigResp>(
             [this](::grpc::ServerContext* context,
@@ -3863,7 +5152,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_setMissActId() {
-      ::grpc::Service::MarkMethodStreamed(14,
+      ::grpc::Service::MarkMethodStreamed(18,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::SetMissActIdReq, ::rp4::SetMissActIdResp>(
             [this](::grpc::ServerContext* context,
@@ -3890,7 +5179,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_insertSramEntry() {
-      ::grpc::Service::MarkMethodStreamed(15,
+      ::grpc::Service::MarkMethodStreamed(19,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::InsertSramEntryReq, ::rp4::InsertSramEntryResp>(
             [this](::grpc::ServerContext* context,
@@ -3917,7 +5206,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_insertTcamEntry() {
-      ::grpc::Service::MarkMethodStreamed(16,
+      ::grpc::Service::MarkMethodStreamed(20,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::InsertTcamEntryReq, ::rp4::InsertTcamEntryResp>(
             [this](::grpc::ServerContext* context,
@@ -3939,12 +5228,120 @@ class CfgService final {
     virtual ::grpc::Status StreamedinsertTcamEntry(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::rp4::InsertTcamEntryReq,::rp4::InsertTcamEntryResp>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_modSramEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_modSramEntry() {
+      ::grpc::Service::MarkMethodStreamed(21,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::rp4::ModSramEntryReq, ::rp4::ModSramEntryResp>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::rp4::ModSramEntryReq, ::rp4::ModSramEntryResp>* streamer) {
+                       return this->StreamedmodSramEntry(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_modSramEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status modSramEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModSramEntryReq* /*request*/, ::rp4::ModSramEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedmodSramEntry(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::rp4::ModSramEntryReq,::rp4::ModSramEntryResp>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_delSramEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_delSramEntry() {
+      ::grpc::Service::MarkMethodStreamed(22,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::rp4::DelSramEntryReq, ::rp4::DelSramEntryResp>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::rp4::DelSramEntryReq, ::rp4::DelSramEntryResp>* streamer) {
+                       return this->StreameddelSramEntry(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_delSramEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status delSramEntry(::grpc::ServerContext* /*context*/, const ::rp4::DelSramEntryReq* /*request*/, ::rp4::DelSramEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreameddelSramEntry(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::rp4::DelSramEntryReq,::rp4::DelSramEntryResp>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_modTcamEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_modTcamEntry() {
+      ::grpc::Service::MarkMethodStreamed(23,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::rp4::ModTcamEntryReq, ::rp4::ModTcamEntryResp>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::rp4::ModTcamEntryReq, ::rp4::ModTcamEntryResp>* streamer) {
+                       return this->StreamedmodTcamEntry(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_modTcamEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status modTcamEntry(::grpc::ServerContext* /*context*/, const ::rp4::ModTcamEntryReq* /*request*/, ::rp4::ModTcamEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedmodTcamEntry(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::rp4::ModTcamEntryReq,::rp4::ModTcamEntryResp>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_delTcamEntry : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_delTcamEntry() {
+      ::grpc::Service::MarkMethodStreamed(24,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::rp4::DelTcamEntryReq, ::rp4::DelTcamEntryResp>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::rp4::DelTcamEntryReq, ::rp4::DelTcamEntryResp>* streamer) {
+                       return this->StreameddelTcamEntry(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_delTcamEntry() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status delTcamEntry(::grpc::ServerContext* /*context*/, const ::rp4::DelTcamEntryReq* /*request*/, ::rp4::DelTcamEntryResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreameddelTcamEntry(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::rp4::DelTcamEntryReq,::rp4::DelTcamEntryResp>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_insertAction : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_insertAction() {
-      ::grpc::Service::MarkMethodStreamed(17,
+      ::grpc::Service::MarkMethodStreamed(26,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::InsertActionReq, ::rp4::InsertActionResp>(
             [this](::grpc::ServerContext* context,
@@ -3971,7 +5368,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_clearAction() {
-      ::grpc::Service::MarkMethodStreamed(18,
+      ::grpc::Service::MarkMethodStreamed(27,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::ClearActionReq, ::rp4::ClearActionResp>(
             [this](::grpc::ServerContext* context,
@@ -3998,7 +5395,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_delAction() {
-      ::grpc::Service::MarkMethodStreamed(19,
+      ::grpc::Service::MarkMethodStreamed(28,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::DelActionReq, ::rp4::DelActionResp>(
             [this](::grpc::ServerContext* context,
@@ -4025,7 +5422,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_loadSigmoidTable() {
-      ::grpc::Service::MarkMethodStreamed(20,
+      ::grpc::Service::MarkMethodStreamed(29,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::LoadSigmoidTableReq, ::rp4::LoadSigmoidTableResp>(
             [this](::grpc::ServerContext* context,
@@ -4052,7 +5449,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_clearSigmoidTable() {
-      ::grpc::Service::MarkMethodStreamed(21,
+      ::grpc::Service::MarkMethodStreamed(30,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::ClearSigmoidTableReq, ::rp4::ClearSigmoidTableResp>(
             [this](::grpc::ServerContext* context,
@@ -4079,7 +5476,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_loadExpTable() {
-      ::grpc::Service::MarkMethodStreamed(22,
+      ::grpc::Service::MarkMethodStreamed(31,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::LoadExpTableReq, ::rp4::LoadExpTableResp>(
             [this](::grpc::ServerContext* context,
@@ -4106,7 +5503,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_clearExpTable() {
-      ::grpc::Service::MarkMethodStreamed(23,
+      ::grpc::Service::MarkMethodStreamed(32,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::ClearExpTableReq, ::rp4::ClearExpTableResp>(
             [this](::grpc::ServerContext* context,
@@ -4133,7 +5530,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_loadNeuronPrimitiveContext() {
-      ::grpc::Service::MarkMethodStreamed(24,
+      ::grpc::Service::MarkMethodStreamed(33,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::LoadNeuronPrimitiveContextReq, ::rp4::LoadNeuronPrimitiveContextResp>(
             [this](::grpc::ServerContext* context,
@@ -4160,7 +5557,7 @@ class CfgService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_clearNeuronPrimitiveContexts() {
-      ::grpc::Service::MarkMethodStreamed(25,
+      ::grpc::Service::MarkMethodStreamed(34,
         new ::grpc::internal::StreamedUnaryHandler<
           ::rp4::ClearNeuronPrimitiveContextsReq, ::rp4::ClearNeuronPrimitiveContextsResp>(
             [this](::grpc::ServerContext* context,
@@ -4181,9 +5578,9 @@ class CfgService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedclearNeuronPrimitiveContexts(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::rp4::ClearNeuronPrimitiveContextsReq,::rp4::ClearNeuronPrimitiveContextsResp>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_setMetadata<WithStreamedUnaryMethod_initParserLevel<WithStreamedUnaryMethod_modParserEntry<WithStreamedUnaryMethod_clearParser<WithStreamedUnaryMethod_insertRelationExp<WithStreamedUnaryMethod_clearRelationExp<WithStreamedUnaryMethod_clearResMap<WithStreamedUnaryMethod_modResMap<WithStreamedUnaryMethod_setDefaultGateEntry<WithStreamedUnaryMethod_setNoTable<WithStreamedUnaryMethod_setActionProc<WithStreamedUnaryMethod_setMemConfig<WithStreamedUnaryMethod_setFieldInfo<WithStreamedUnaryMethod_clearOldConfig<WithStreamedUnaryMethod_setMissActId<WithStreamedUnaryMethod_insertSramEntry<WithStreamedUnaryMethod_insertTcamEntry<WithStreamedUnaryMethod_insertAction<WithStreamedUnaryMethod_clearAction<WithStreamedUnaryMethod_delAction<WithStreamedUnaryMethod_loadSigmoidTable<WithStreamedUnaryMethod_clearSigmoidTable<WithStreamedUnaryMethod_loadExpTable<WithStreamedUnaryMethod_clearExpTable<WithStreamedUnaryMethod_loadNeuronPrimitiveContext<WithStreamedUnaryMethod_clearNeuronPrimitiveContexts<Service > > > > > > > > > > > > > > > > > > > > > > > > > > StreamedUnaryService;
+  typedef WithStreamedUnaryMethod_setMetadata<WithStreamedUnaryMethod_beginConfig<WithStreamedUnaryMethod_commitConfig<WithStreamedUnaryMethod_abortConfig<WithStreamedUnaryMethod_applyConfig<WithStreamedUnaryMethod_initParserLevel<WithStreamedUnaryMethod_modParserEntry<WithStreamedUnaryMethod_clearParser<WithStreamedUnaryMethod_insertRelationExp<WithStreamedUnaryMethod_clearRelationExp<WithStreamedUnaryMethod_clearResMap<WithStreamedUnaryMethod_modResMap<WithStreamedUnaryMethod_setDefaultGateEntry<WithStreamedUnaryMethod_setNoTable<WithStreamedUnaryMethod_setActionProc<WithStreamedUnaryMethod_setMemConfig<WithStreamedUnaryMethod_setFieldInfo<WithStreamedUnaryMethod_clearOldConfig<WithStreamedUnaryMethod_setMissActId<WithStreamedUnaryMethod_insertSramEntry<WithStreamedUnaryMethod_insertTcamEntry<WithStreamedUnaryMethod_modSramEntry<WithStreamedUnaryMethod_delSramEntry<WithStreamedUnaryMethod_modTcamEntry<WithStreamedUnaryMethod_delTcamEntry<WithStreamedUnaryMethod_insertAction<WithStreamedUnaryMethod_clearAction<WithStreamedUnaryMethod_delAction<WithStreamedUnaryMethod_loadSigmoidTable<WithStreamedUnaryMethod_clearSigmoidTable<WithStreamedUnaryMethod_loadExpTable<WithStreamedUnaryMethod_clearExpTable<WithStreamedUnaryMethod_loadNeuronPrimitiveContext<WithStreamedUnaryMethod_clearNeuronPrimitiveContexts<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_setMetadata<WithStreamedUnaryMethod_initParserLevel<WithStreamedUnaryMethod_modParserEntry<WithStreamedUnaryMethod_clearParser<WithStreamedUnaryMethod_insertRelationExp<WithStreamedUnaryMethod_clearRelationExp<WithStreamedUnaryMethod_clearResMap<WithStreamedUnaryMethod_modResMap<WithStreamedUnaryMethod_setDefaultGateEntry<WithStreamedUnaryMethod_setNoTable<WithStreamedUnaryMethod_setActionProc<WithStreamedUnaryMethod_setMemConfig<WithStreamedUnaryMethod_setFieldInfo<WithStreamedUnaryMethod_clearOldConfig<WithStreamedUnaryMethod_setMissActId<WithStreamedUnaryMethod_insertSramEntry<WithStreamedUnaryMethod_insertTcamEntry<WithStreamedUnaryMethod_insertAction<WithStreamedUnaryMethod_clearAction<WithStreamedUnaryMethod_delAction<WithStreamedUnaryMethod_loadSigmoidTable<WithStreamedUnaryMethod_clearSigmoidTable<WithStreamedUnaryMethod_loadExpTable<WithStreamedUnaryMethod_clearExpTable<WithStreamedUnaryMethod_loadNeuronPrimitiveContext<WithStreamedUnaryMethod_clearNeuronPrimitiveContexts<Service > > > > > > > > > > > > > > > > > > > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_setMetadata<WithStreamedUnaryMethod_beginConfig<WithStreamedUnaryMethod_commitConfig<WithStreamedUnaryMethod_abortConfig<WithStreamedUnaryMethod_applyConfig<WithStreamedUnaryMethod_initParserLevel<WithStreamedUnaryMethod_modParserEntry<WithStreamedUnaryMethod_clearParser<WithStreamedUnaryMethod_insertRelationExp<WithStreamedUnaryMethod_clearRelationExp<WithStreamedUnaryMethod_clearResMap<WithStreamedUnaryMethod_modResMap<WithStreamedUnaryMethod_setDefaultGateEntry<WithStreamedUnaryMethod_setNoTable<WithStreamedUnaryMethod_setActionProc<WithStreamedUnaryMethod_setMemConfig<WithStreamedUnaryMethod_setFieldInfo<WithStreamedUnaryMethod_clearOldConfig<WithStreamedUnaryMethod_setMissActId<WithStreamedUnaryMethod_insertSramEntry<WithStreamedUnaryMethod_insertTcamEntry<WithStreamedUnaryMethod_modSramEntry<WithStreamedUnaryMethod_delSramEntry<WithStreamedUnaryMethod_modTcamEntry<WithStreamedUnaryMethod_delTcamEntry<WithStreamedUnaryMethod_insertAction<WithStreamedUnaryMethod_clearAction<WithStreamedUnaryMethod_delAction<WithStreamedUnaryMethod_loadSigmoidTable<WithStreamedUnaryMethod_clearSigmoidTable<WithStreamedUnaryMethod_loadExpTable<WithStreamedUnaryMethod_clearExpTable<WithStreamedUnaryMethod_loadNeuronPrimitiveContext<WithStreamedUnaryMethod_clearNeuronPrimitiveContexts<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace rp4
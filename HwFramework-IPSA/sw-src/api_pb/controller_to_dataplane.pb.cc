@@ -75,6 +75,119 @@ struct ClearStageReqDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClearStageReqDefaultTypeInternal _ClearStageReq_default_instance_;
+PROTOBUF_CONSTEXPR BeginConfigReq::BeginConfigReq(
+    ::_pbi::ConstantInitialized) {}
+struct BeginConfigReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BeginConfigReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BeginConfigReqDefaultTypeInternal() {}
+  union {
+    BeginConfigReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BeginConfigReqDefaultTypeInternal _BeginConfigReq_default_instance_;
+PROTOBUF_CONSTEXPR BeginConfigResp::BeginConfigResp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.res_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BeginConfigRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BeginConfigRespDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BeginConfigRespDefaultTypeInternal() {}
+  union {
+    BeginConfigResp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BeginConfigRespDefaultTypeInternal _BeginConfigResp_default_instance_;
+PROTOBUF_CONSTEXPR CommitConfigReq::CommitConfigReq(
+    ::_pbi::ConstantInitialized) {}
+struct CommitConfigReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommitConfigReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommitConfigReqDefaultTypeInternal() {}
+  union {
+    CommitConfigReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommitConfigReqDefaultTypeInternal _CommitConfigReq_default_instance_;
+PROTOBUF_CONSTEXPR CommitConfigResp::CommitConfigResp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.res_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommitConfigRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommitConfigRespDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommitConfigRespDefaultTypeInternal() {}
+  union {
+    CommitConfigResp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommitConfigRespDefaultTypeInternal _CommitConfigResp_default_instance_;
+PROTOBUF_CONSTEXPR AbortConfigReq::AbortConfigReq(
+    ::_pbi::ConstantInitialized) {}
+struct AbortConfigReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AbortConfigReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AbortConfigReqDefaultTypeInternal() {}
+  union {
+    AbortConfigReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AbortConfigReqDefaultTypeInternal _AbortConfigReq_default_instance_;
+PROTOBUF_CONSTEXPR AbortConfigResp::AbortConfigResp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.res_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AbortConfigRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AbortConfigRespDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AbortConfigRespDefaultTypeInternal() {}
+  union {
+    AbortConfigResp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AbortConfigRespDefaultTypeInternal _AbortConfigResp_default_instance_;
+PROTOBUF_CONSTEXPR ConfigOp::ConfigOp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.op_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ConfigOpDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfigOpDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfigOpDefaultTypeInternal() {}
+  union {
+    ConfigOp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfigOpDefaultTypeInternal _ConfigOp_default_instance_;
+PROTOBUF_CONSTEXPR ApplyConfigReq::ApplyConfigReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ops_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ApplyConfigReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ApplyConfigReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ApplyConfigReqDefaultTypeInternal() {}
+  union {
+    ApplyConfigReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ApplyConfigReqDefaultTypeInternal _ApplyConfigReq_default_instance_;
+PROTOBUF_CONSTEXPR ApplyConfigResp::ApplyConfigResp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.res_)*/0
+  , /*decltype(_impl_.applied_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ApplyConfigRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ApplyConfigRespDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ApplyConfigRespDefaultTypeInternal() {}
+  union {
+    ApplyConfigResp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ApplyConfigRespDefaultTypeInternal _ApplyConfigResp_default_instance_;
 PROTOBUF_CONSTEXPR ParserLevelReq::ParserLevelReq(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.procid_)*/0
@@ -527,6 +640,9 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 PROTOBUF_CONSTEXPR InsertSramEntryResp::InsertSramEntryResp(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.res_)*/0
+  , /*decltype(_impl_.occupancy_)*/0
+  , /*decltype(_impl_.capacity_)*/0
+  , /*decltype(_impl_.stash_used_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct InsertSramEntryRespDefaultTypeInternal {
   PROTOBUF_CONSTEXPR InsertSramEntryRespDefaultTypeInternal()
@@ -569,6 +685,162 @@ struct InsertTcamEntryRespDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InsertTcamEntryRespDefaultTypeInternal _InsertTcamEntryResp_default_instance_;
+PROTOBUF_CONSTEXPR ModSramEntryReq::ModSramEntryReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.procid_)*/0
+  , /*decltype(_impl_.matcherid_)*/0
+  , /*decltype(_impl_.key_byte_len_)*/0
+  , /*decltype(_impl_.value_byte_len_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ModSramEntryReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ModSramEntryReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ModSramEntryReqDefaultTypeInternal() {}
+  union {
+    ModSramEntryReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ModSramEntryReqDefaultTypeInternal _ModSramEntryReq_default_instance_;
+PROTOBUF_CONSTEXPR ModSramEntryResp::ModSramEntryResp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.res_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ModSramEntryRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ModSramEntryRespDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ModSramEntryRespDefaultTypeInternal() {}
+  union {
+    ModSramEntryResp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ModSramEntryRespDefaultTypeInternal _ModSramEntryResp_default_instance_;
+PROTOBUF_CONSTEXPR DelSramEntryReq::DelSramEntryReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.procid_)*/0
+  , /*decltype(_impl_.matcherid_)*/0
+  , /*decltype(_impl_.key_byte_len_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DelSramEntryReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DelSramEntryReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DelSramEntryReqDefaultTypeInternal() {}
+  union {
+    DelSramEntryReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DelSramEntryReqDefaultTypeInternal _DelSramEntryReq_default_instance_;
+PROTOBUF_CONSTEXPR DelSramEntryResp::DelSramEntryResp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.res_)*/0
+  , /*decltype(_impl_.occupancy_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DelSramEntryRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DelSramEntryRespDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DelSramEntryRespDefaultTypeInternal() {}
+  union {
+    DelSramEntryResp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DelSramEntryRespDefaultTypeInternal _DelSramEntryResp_default_instance_;
+PROTOBUF_CONSTEXPR ModTcamEntryReq::ModTcamEntryReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.mask_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.procid_)*/0
+  , /*decltype(_impl_.matcherid_)*/0
+  , /*decltype(_impl_.key_byte_len_)*/0
+  , /*decltype(_impl_.value_byte_len_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ModTcamEntryReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ModTcamEntryReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ModTcamEntryReqDefaultTypeInternal() {}
+  union {
+    ModTcamEntryReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ModTcamEntryReqDefaultTypeInternal _ModTcamEntryReq_default_instance_;
+PROTOBUF_CONSTEXPR ModTcamEntryResp::ModTcamEntryResp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.res_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ModTcamEntryRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ModTcamEntryRespDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ModTcamEntryRespDefaultTypeInternal() {}
+  union {
+    ModTcamEntryResp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ModTcamEntryRespDefaultTypeInternal _ModTcamEntryResp_default_instance_;
+PROTOBUF_CONSTEXPR DelTcamEntryReq::DelTcamEntryReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.mask_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.procid_)*/0
+  , /*decltype(_impl_.matcherid_)*/0
+  , /*decltype(_impl_.key_byte_len_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DelTcamEntryReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DelTcamEntryReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DelTcamEntryReqDefaultTypeInternal() {}
+  union {
+    DelTcamEntryReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DelTcamEntryReqDefaultTypeInternal _DelTcamEntryReq_default_instance_;
+PROTOBUF_CONSTEXPR DelTcamEntryResp::DelTcamEntryResp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.res_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DelTcamEntryRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DelTcamEntryRespDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DelTcamEntryRespDefaultTypeInternal() {}
+  union {
+    DelTcamEntryResp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DelTcamEntryRespDefaultTypeInternal _DelTcamEntryResp_default_instance_;
+PROTOBUF_CONSTEXPR InsertEntriesReq::InsertEntriesReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.procid_)*/0
+  , /*decltype(_impl_.matcherid_)*/0
+  , /*decltype(_impl_.ternary_)*/false
+  , /*decltype(_impl_.key_byte_len_)*/0
+  , /*decltype(_impl_.value_byte_len_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InsertEntriesReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InsertEntriesReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InsertEntriesReqDefaultTypeInternal() {}
+  union {
+    InsertEntriesReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InsertEntriesReqDefaultTypeInternal _InsertEntriesReq_default_instance_;
+PROTOBUF_CONSTEXPR InsertEntriesResp::InsertEntriesResp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.res_)*/0
+  , /*decltype(_impl_.inserted_)*/0
+  , /*decltype(_impl_.failed_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InsertEntriesRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InsertEntriesRespDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InsertEntriesRespDefaultTypeInternal() {}
+  union {
+    InsertEntriesResp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InsertEntriesRespDefaultTypeInternal _InsertEntriesResp_default_instance_;
 PROTOBUF_CONSTEXPR ClearOldConfigReq::ClearOldConfigReq(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.procid_)*/0
@@ -973,7 +1245,7 @@ struct ClearNeuronPrimitiveContextsRespDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClearNeuronPrimitiveContextsRespDefaultTypeInternal _ClearNeuronPrimitiveContextsResp_default_instance_;
 }  // namespace rp4
-static ::_pb::Metadata file_level_metadata_controller_5fto_5fdataplane_2eproto[67];
+static ::_pb::Metadata file_level_metadata_controller_5fto_5fdataplane_2eproto[86];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_controller_5fto_5fdataplane_2eproto[8];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_controller_5fto_5fdataplane_2eproto = nullptr;
 
@@ -1009,6 +1281,91 @@ const uint32_t TableStruct_controller_5fto_5fdataplane_2eproto::offsets[] PROTOB
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::rp4::ClearStageReq, _impl_.procid_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::BeginConfigReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::BeginConfigResp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::BeginConfigResp, _impl_.res_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::CommitConfigReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::CommitConfigResp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::CommitConfigResp, _impl_.res_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::AbortConfigReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::AbortConfigResp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::AbortConfigResp, _impl_.res_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::ConfigOp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::rp4::ConfigOp, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::rp4::ConfigOp, _impl_.op_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::ApplyConfigReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::ApplyConfigReq, _impl_.ops_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::ApplyConfigResp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::ApplyConfigResp, _impl_.res_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ApplyConfigResp, _impl_.applied_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::rp4::ParserLevelReq, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -1279,6 +1636,9 @@ const uint32_t TableStruct_controller_5fto_5fdataplane_2eproto::offsets[] PROTOB
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::rp4::InsertSramEntryResp, _impl_.res_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertSramEntryResp, _impl_.occupancy_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertSramEntryResp, _impl_.capacity_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertSramEntryResp, _impl_.stash_used_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::rp4::InsertTcamEntryReq, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -1300,98 +1660,194 @@ const uint32_t TableStruct_controller_5fto_5fdataplane_2eproto::offsets[] PROTOB
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::rp4::InsertTcamEntryResp, _impl_.res_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::rp4::ClearOldConfigReq, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModSramEntryReq, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::rp4::ClearOldConfigReq, _impl_.procid_),
-  PROTOBUF_FIELD_OFFSET(::rp4::ClearOldConfigReq, _impl_.matcherid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModSramEntryReq, _impl_.procid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModSramEntryReq, _impl_.matcherid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModSramEntryReq, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModSramEntryReq, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModSramEntryReq, _impl_.key_byte_len_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModSramEntryReq, _impl_.value_byte_len_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::rp4::ClearOldConfigResp, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModSramEntryResp, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::rp4::ClearOldConfigResp, _impl_.res_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModSramEntryResp, _impl_.res_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::rp4::SetMissActIdReq, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelSramEntryReq, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::rp4::SetMissActIdReq, _impl_.procid_),
-  PROTOBUF_FIELD_OFFSET(::rp4::SetMissActIdReq, _impl_.matcherid_),
-  PROTOBUF_FIELD_OFFSET(::rp4::SetMissActIdReq, _impl_.miss_act_id_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelSramEntryReq, _impl_.procid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelSramEntryReq, _impl_.matcherid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelSramEntryReq, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelSramEntryReq, _impl_.key_byte_len_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::rp4::SetMissActIdResp, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelSramEntryResp, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::rp4::SetMissActIdResp, _impl_.res_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelSramEntryResp, _impl_.res_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelSramEntryResp, _impl_.occupancy_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::rp4::Parameter, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModTcamEntryReq, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::rp4::Parameter, _impl_._oneof_case_[0]),
+  ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::rp4::Parameter, _impl_.type_),
-  ::_pbi::kInvalidFieldOffsetTag,
-  ::_pbi::kInvalidFieldOffsetTag,
-  ::_pbi::kInvalidFieldOffsetTag,
-  ::_pbi::kInvalidFieldOffsetTag,
-  ::_pbi::kInvalidFieldOffsetTag,
-  PROTOBUF_FIELD_OFFSET(::rp4::Parameter, _impl_.val_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModTcamEntryReq, _impl_.procid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModTcamEntryReq, _impl_.matcherid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModTcamEntryReq, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModTcamEntryReq, _impl_.mask_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModTcamEntryReq, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModTcamEntryReq, _impl_.key_byte_len_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModTcamEntryReq, _impl_.value_byte_len_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::rp4::ExpTreeNode, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModTcamEntryResp, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::rp4::ExpTreeNode, _impl_.opt_),
-  PROTOBUF_FIELD_OFFSET(::rp4::ExpTreeNode, _impl_.left_),
-  PROTOBUF_FIELD_OFFSET(::rp4::ExpTreeNode, _impl_.right_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ModTcamEntryResp, _impl_.res_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::rp4::Prim, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelTcamEntryReq, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::rp4::Prim, _impl_.lvalue_),
-  PROTOBUF_FIELD_OFFSET(::rp4::Prim, _impl_.root_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelTcamEntryReq, _impl_.procid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelTcamEntryReq, _impl_.matcherid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelTcamEntryReq, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelTcamEntryReq, _impl_.mask_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelTcamEntryReq, _impl_.key_byte_len_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::rp4::Action, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelTcamEntryResp, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::rp4::Action, _impl_.paranum_),
-  PROTOBUF_FIELD_OFFSET(::rp4::Action, _impl_.prims_),
-  PROTOBUF_FIELD_OFFSET(::rp4::Action, _impl_.actionparalens_),
+  PROTOBUF_FIELD_OFFSET(::rp4::DelTcamEntryResp, _impl_.res_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::rp4::InsertActionReq, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertEntriesReq, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::rp4::InsertActionReq, _impl_.procid_),
-  PROTOBUF_FIELD_OFFSET(::rp4::InsertActionReq, _impl_.action_),
-  PROTOBUF_FIELD_OFFSET(::rp4::InsertActionReq, _impl_.actionid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertEntriesReq, _impl_.procid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertEntriesReq, _impl_.matcherid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertEntriesReq, _impl_.ternary_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertEntriesReq, _impl_.key_byte_len_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertEntriesReq, _impl_.value_byte_len_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertEntriesReq, _impl_.entries_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::rp4::InsertActionResp, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertEntriesResp, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::rp4::InsertActionResp, _impl_.res_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertEntriesResp, _impl_.res_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertEntriesResp, _impl_.inserted_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertEntriesResp, _impl_.failed_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::rp4::ClearActionReq, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ClearOldConfigReq, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::rp4::ClearActionReq, _impl_.procid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ClearOldConfigReq, _impl_.procid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ClearOldConfigReq, _impl_.matcherid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::ClearOldConfigResp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::ClearOldConfigResp, _impl_.res_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::SetMissActIdReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::SetMissActIdReq, _impl_.procid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::SetMissActIdReq, _impl_.matcherid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::SetMissActIdReq, _impl_.miss_act_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::SetMissActIdResp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::SetMissActIdResp, _impl_.res_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::Parameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::rp4::Parameter, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::Parameter, _impl_.type_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::rp4::Parameter, _impl_.val_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::ExpTreeNode, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::ExpTreeNode, _impl_.opt_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ExpTreeNode, _impl_.left_),
+  PROTOBUF_FIELD_OFFSET(::rp4::ExpTreeNode, _impl_.right_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::Prim, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::Prim, _impl_.lvalue_),
+  PROTOBUF_FIELD_OFFSET(::rp4::Prim, _impl_.root_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::Action, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::Action, _impl_.paranum_),
+  PROTOBUF_FIELD_OFFSET(::rp4::Action, _impl_.prims_),
+  PROTOBUF_FIELD_OFFSET(::rp4::Action, _impl_.actionparalens_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertActionReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertActionReq, _impl_.procid_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertActionReq, _impl_.action_),
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertActionReq, _impl_.actionid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertActionResp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::InsertActionResp, _impl_.res_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rp4::ClearActionReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rp4::ClearActionReq, _impl_.procid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::rp4::ClearActionResp, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -1538,69 +1994,88 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 9, -1, -1, sizeof(::rp4::SetMetadataReq)},
   { 16, -1, -1, sizeof(::rp4::SetMetadataResp)},
   { 23, -1, -1, sizeof(::rp4::ClearStageReq)},
-  { 30, -1, -1, sizeof(::rp4::ParserLevelReq)},
-  { 38, -1, -1, sizeof(::rp4::ParserLevelResp)},
-  { 45, -1, -1, sizeof(::rp4::FieldInfo)},
-  { 55, -1, -1, sizeof(::rp4::ModParserEntryReq)},
-  { 72, -1, -1, sizeof(::rp4::ModParserEntryResp)},
-  { 79, -1, -1, sizeof(::rp4::ClearParserReq)},
-  { 86, -1, -1, sizeof(::rp4::ClearParserResp)},
-  { 93, -1, -1, sizeof(::rp4::Data)},
-  { 101, -1, -1, sizeof(::rp4::GateEntry)},
-  { 109, -1, -1, sizeof(::rp4::SetDefaultGateEntryReq)},
-  { 117, -1, -1, sizeof(::rp4::SetDefaultGateEntryResp)},
-  { 124, -1, -1, sizeof(::rp4::GatewayParam)},
-  { 134, -1, -1, sizeof(::rp4::RelationExp)},
-  { 143, -1, -1, sizeof(::rp4::InsertRelationExpReq)},
-  { 153, -1, -1, sizeof(::rp4::InsertRelationExpResp)},
-  { 160, -1, -1, sizeof(::rp4::ClearRelationExpReq)},
-  { 167, -1, -1, sizeof(::rp4::ClearRelationExpResp)},
-  { 174, -1, -1, sizeof(::rp4::ClearResMapReq)},
-  { 181, -1, -1, sizeof(::rp4::ClearResMapResp)},
-  { 188, -1, -1, sizeof(::rp4::ModResMapReq)},
-  { 197, -1, -1, sizeof(::rp4::ModResMapResp)},
-  { 204, -1, -1, sizeof(::rp4::SetNoTableReq)},
-  { 213, -1, -1, sizeof(::rp4::SetNoTableResp)},
-  { 220, -1, -1, sizeof(::rp4::ActionProc)},
-  { 228, -1, -1, sizeof(::rp4::SetActionProcReq)},
-  { 237, -1, -1, sizeof(::rp4::SetActionProcResp)},
-  { 244, -1, -1, sizeof(::rp4::SetMemConfigReq)},
-  { 259, -1, -1, sizeof(::rp4::SetMemConfigResp)},
-  { 266, -1, -1, sizeof(::rp4::SetFieldInfoReq)},
-  { 275, -1, -1, sizeof(::rp4::SetFieldInfoResp)},
-  { 282, -1, -1, sizeof(::rp4::InsertSramEntryReq)},
-  { 294, -1, -1, sizeof(::rp4::InsertSramEntryResp)},
-  { 301, -1, -1, sizeof(::rp4::InsertTcamEntryReq)},
-  { 314, -1, -1, sizeof(::rp4::InsertTcamEntryResp)},
-  { 321, -1, -1, sizeof(::rp4::ClearOldConfigReq)},
-  { 329, -1, -1, sizeof(::rp4::ClearOldConfigResp)},
-  { 336, -1, -1, sizeof(::rp4::SetMissActIdReq)},
-  { 345, -1, -1, sizeof(::rp4::SetMissActIdResp)},
-  { 352, -1, -1, sizeof(::rp4::Parameter)},
-  { 365, -1, -1, sizeof(::rp4::ExpTreeNode)},
-  { 374, -1, -1, sizeof(::rp4::Prim)},
-  { 382, -1, -1, sizeof(::rp4::Action)},
-  { 391, -1, -1, sizeof(::rp4::InsertActionReq)},
-  { 400, -1, -1, sizeof(::rp4::InsertActionResp)},
-  { 407, -1, -1, sizeof(::rp4::ClearActionReq)},
-  { 414, -1, -1, sizeof(::rp4::ClearActionResp)},
-  { 421, -1, -1, sizeof(::rp4::DelActionReq)},
-  { 429, -1, -1, sizeof(::rp4::DelActionResp)},
-  { 436, -1, -1, sizeof(::rp4::SigmoidPoint)},
-  { 444, -1, -1, sizeof(::rp4::LoadSigmoidTableReq)},
-  { 453, -1, -1, sizeof(::rp4::LoadSigmoidTableResp)},
-  { 460, -1, -1, sizeof(::rp4::ClearSigmoidTableReq)},
-  { 466, -1, -1, sizeof(::rp4::ClearSigmoidTableResp)},
-  { 473, -1, -1, sizeof(::rp4::ExpPoint)},
-  { 481, -1, -1, sizeof(::rp4::LoadExpTableReq)},
-  { 490, -1, -1, sizeof(::rp4::LoadExpTableResp)},
-  { 497, -1, -1, sizeof(::rp4::ClearExpTableReq)},
-  { 503, -1, -1, sizeof(::rp4::ClearExpTableResp)},
-  { 510, -1, -1, sizeof(::rp4::NeuronPrimitiveContext)},
-  { 527, -1, -1, sizeof(::rp4::LoadNeuronPrimitiveContextReq)},
-  { 534, -1, -1, sizeof(::rp4::LoadNeuronPrimitiveContextResp)},
-  { 541, -1, -1, sizeof(::rp4::ClearNeuronPrimitiveContextsReq)},
-  { 547, -1, -1, sizeof(::rp4::ClearNeuronPrimitiveContextsResp)},
+  { 30, -1, -1, sizeof(::rp4::BeginConfigReq)},
+  { 36, -1, -1, sizeof(::rp4::BeginConfigResp)},
+  { 43, -1, -1, sizeof(::rp4::CommitConfigReq)},
+  { 49, -1, -1, sizeof(::rp4::CommitConfigResp)},
+  { 56, -1, -1, sizeof(::rp4::AbortConfigReq)},
+  { 62, -1, -1, sizeof(::rp4::AbortConfigResp)},
+  { 69, -1, -1, sizeof(::rp4::ConfigOp)},
+  { 100, -1, -1, sizeof(::rp4::ApplyConfigReq)},
+  { 107, -1, -1, sizeof(::rp4::ApplyConfigResp)},
+  { 115, -1, -1, sizeof(::rp4::ParserLevelReq)},
+  { 123, -1, -1, sizeof(::rp4::ParserLevelResp)},
+  { 130, -1, -1, sizeof(::rp4::FieldInfo)},
+  { 140, -1, -1, sizeof(::rp4::ModParserEntryReq)},
+  { 157, -1, -1, sizeof(::rp4::ModParserEntryResp)},
+  { 164, -1, -1, sizeof(::rp4::ClearParserReq)},
+  { 171, -1, -1, sizeof(::rp4::ClearParserResp)},
+  { 178, -1, -1, sizeof(::rp4::Data)},
+  { 186, -1, -1, sizeof(::rp4::GateEntry)},
+  { 194, -1, -1, sizeof(::rp4::SetDefaultGateEntryReq)},
+  { 202, -1, -1, sizeof(::rp4::SetDefaultGateEntryResp)},
+  { 209, -1, -1, sizeof(::rp4::GatewayParam)},
+  { 219, -1, -1, sizeof(::rp4::RelationExp)},
+  { 228, -1, -1, sizeof(::rp4::InsertRelationExpReq)},
+  { 238, -1, -1, sizeof(::rp4::InsertRelationExpResp)},
+  { 245, -1, -1, sizeof(::rp4::ClearRelationExpReq)},
+  { 252, -1, -1, sizeof(::rp4::ClearRelationExpResp)},
+  { 259, -1, -1, sizeof(::rp4::ClearResMapReq)},
+  { 266, -1, -1, sizeof(::rp4::ClearResMapResp)},
+  { 273, -1, -1, sizeof(::rp4::ModResMapReq)},
+  { 282, -1, -1, sizeof(::rp4::ModResMapResp)},
+  { 289, -1, -1, sizeof(::rp4::SetNoTableReq)},
+  { 298, -1, -1, sizeof(::rp4::SetNoTableResp)},
+  { 305, -1, -1, sizeof(::rp4::ActionProc)},
+  { 313, -1, -1, sizeof(::rp4::SetActionProcReq)},
+  { 322, -1, -1, sizeof(::rp4::SetActionProcResp)},
+  { 329, -1, -1, sizeof(::rp4::SetMemConfigReq)},
+  { 344, -1, -1, sizeof(::rp4::SetMemConfigResp)},
+  { 351, -1, -1, sizeof(::rp4::SetFieldInfoReq)},
+  { 360, -1, -1, sizeof(::rp4::SetFieldInfoResp)},
+  { 367, -1, -1, sizeof(::rp4::InsertSramEntryReq)},
+  { 379, -1, -1, sizeof(::rp4::InsertSramEntryResp)},
+  { 389, -1, -1, sizeof(::rp4::InsertTcamEntryReq)},
+  { 402, -1, -1, sizeof(::rp4::InsertTcamEntryResp)},
+  { 409, -1, -1, sizeof(::rp4::ModSramEntryReq)},
+  { 421, -1, -1, sizeof(::rp4::ModSramEntryResp)},
+  { 428, -1, -1, sizeof(::rp4::DelSramEntryReq)},
+  { 438, -1, -1, sizeof(::rp4::DelSramEntryResp)},
+  { 446, -1, -1, sizeof(::rp4::ModTcamEntryReq)},
+  { 459, -1, -1, sizeof(::rp4::ModTcamEntryResp)},
+  { 466, -1, -1, sizeof(::rp4::DelTcamEntryReq)},
+  { 477, -1, -1, sizeof(::rp4::DelTcamEntryResp)},
+  { 484, -1, -1, sizeof(::rp4::InsertEntriesReq)},
+  { 496, -1, -1, sizeof(::rp4::InsertEntriesResp)},
+  { 505, -1, -1, sizeof(::rp4::ClearOldConfigReq)},
+  { 513, -1, -1, sizeof(::rp4::ClearOldConfigResp)},
+  { 520, -1, -1, sizeof(::rp4::SetMissActIdReq)},
+  { 529, -1, -1, sizeof(::rp4::SetMissActIdResp)},
+  { 536, -1, -1, sizeof(::rp4::Parameter)},
+  { 549, -1, -1, sizeof(::rp4::ExpTreeNode)},
+  { 558, -1, -1, sizeof(::rp4::Prim)},
+  { 566, -1, -1, sizeof(::rp4::Action)},
+  { 575, -1, -1, sizeof(::rp4::InsertActionReq)},
+  { 584, -1, -1, sizeof(::rp4::InsertActionResp)},
+  { 591, -1, -1, sizeof(::rp4::ClearActionReq)},
+  { 598, -1, -1, sizeof(::rp4::ClearActionResp)},
+  { 605, -1, -1, sizeof(::rp4::DelActionReq)},
+  { 613, -1, -1, sizeof(::rp4::DelActionResp)},
+  { 620, -1, -1, sizeof(::rp4::SigmoidPoint)},
+  { 628, -1, -1, sizeof(::rp4::LoadSigmoidTableReq)},
+  { 637, -1, -1, sizeof(::rp4::LoadSigmoidTableResp)},
+  { 644, -1, -1, sizeof(::rp4::ClearSigmoidTableReq)},
+  { 650, -1, -1, sizeof(::rp4::ClearSigmoidTableResp)},
+  { 657, -1, -1, sizeof(::rp4::ExpPoint)},
+  { 665, -1, -1, sizeof(::rp4::LoadExpTableReq)},
+  { 674, -1, -1, sizeof(::rp4::LoadExpTableResp)},
+  { 681, -1, -1, sizeof(::rp4::ClearExpTableReq)},
+  { 687, -1, -1, sizeof(::rp4::ClearExpTableResp)},
+  { 694, -1, -1, sizeof(::rp4::NeuronPrimitiveContext)},
+  { 711, -1, -1, sizeof(::rp4::LoadNeuronPrimitiveContextReq)},
+  { 718, -1, -1, sizeof(::rp4::LoadNeuronPrimitiveContextResp)},
+  { 725, -1, -1, sizeof(::rp4::ClearNeuronPrimitiveContextsReq)},
+  { 731, -1, -1, sizeof(::rp4::ClearNeuronPrimitiveContextsResp)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -1608,6 +2083,15 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::rp4::_SetMetadataReq_default_instance_._instance,
   &::rp4::_SetMetadataResp_default_instance_._instance,
   &::rp4::_ClearStageReq_default_instance_._instance,
+  &::rp4::_BeginConfigReq_default_instance_._instance,
+  &::rp4::_BeginConfigResp_default_instance_._instance,
+  &::rp4::_CommitConfigReq_default_instance_._instance,
+  &::rp4::_CommitConfigResp_default_instance_._instance,
+  &::rp4::_AbortConfigReq_default_instance_._instance,
+  &::rp4::_AbortConfigResp_default_instance_._instance,
+  &::rp4::_ConfigOp_default_instance_._instance,
+  &::rp4::_ApplyConfigReq_default_instance_._instance,
+  &::rp4::_ApplyConfigResp_default_instance_._instance,
   &::rp4::_ParserLevelReq_default_instance_._instance,
   &::rp4::_ParserLevelResp_default_instance_._instance,
   &::rp4::_FieldInfo_default_instance_._instance,
@@ -1642,6 +2126,16 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::rp4::_InsertSramEntryResp_default_instance_._instance,
   &::rp4::_InsertTcamEntryReq_default_instance_._instance,
   &::rp4::_InsertTcamEntryResp_default_instance_._instance,
+  &::rp4::_ModSramEntryReq_default_instance_._instance,
+  &::rp4::_ModSramEntryResp_default_instance_._instance,
+  &::rp4::_DelSramEntryReq_default_instance_._instance,
+  &::rp4::_DelSramEntryResp_default_instance_._instance,
+  &::rp4::_ModTcamEntryReq_default_instance_._instance,
+  &::rp4::_ModTcamEntryResp_default_instance_._instance,
+  &::rp4::_DelTcamEntryReq_default_instance_._instance,
+  &::rp4::_DelTcamEntryResp_default_instance_._instance,
+  &::rp4::_InsertEntriesReq_default_instance_._instance,
+  &::rp4::_InsertEntriesResp_default_instance_._instance,
   &::rp4::_ClearOldConfigReq_default_instance_._instance,
   &::rp4::_ClearOldConfigResp_default_instance_._instance,
   &::rp4::_SetMissActIdReq_default_instance_._instance,
@@ -1680,185 +2174,259 @@ const char descriptor_table_protodef_controller_5fto_5fdataplane_2eproto[] PROTO
   "etadataReq\022$\n\013headerInfos\030\001 \003(\0132\017.rp4.He"
   "aderInfo\"(\n\017SetMetadataResp\022\025\n\003res\030\001 \001(\016"
   "2\010.rp4.Res\"\037\n\rClearStageReq\022\016\n\006procId\030\001 "
-  "\001(\005\"5\n\016ParserLevelReq\022\016\n\006procId\030\001 \001(\005\022\023\n"
-  "\013parserLevel\030\002 \001(\005\"(\n\017ParserLevelResp\022\025\n"
-  "\003res\030\001 \001(\0162\010.rp4.Res\"g\n\tFieldInfo\022\r\n\005hdr"
-  "Id\030\001 \001(\005\022\026\n\016internalOffset\030\002 \001(\005\022\020\n\010fiel"
-  "dLen\030\003 \001(\005\022!\n\tfieldType\030\004 \001(\0162\016.rp4.Fiel"
-  "dType\"\337\001\n\021ModParserEntryReq\022\016\n\006procId\030\001 "
-  "\001(\005\022\023\n\013parserLevel\030\002 \001(\005\022\r\n\005state\030\003 \001(\005\022"
-  "\013\n\003key\030\004 \001(\r\022\014\n\004mask\030\005 \001(\005\022\r\n\005hdrId\030\006 \001("
-  "\005\022\016\n\006hdrLen\030\007 \001(\005\022\021\n\tnextState\030\010 \001(\005\022\025\n\r"
-  "transFieldNum\030\t \001(\005\022 \n\010transFds\030\n \003(\0132\016."
-  "rp4.FieldInfo\022\020\n\010miss_act\030\013 \001(\005\"+\n\022ModPa"
-  "rserEntryResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\" \n\016"
-  "ClearParserReq\022\016\n\006procId\030\001 \001(\005\"(\n\017ClearP"
-  "arserResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\" \n\004Data"
-  "\022\013\n\003len\030\001 \001(\005\022\013\n\003val\030\002 \001(\014\":\n\tGateEntry\022"
-  " \n\004type\030\001 \001(\0162\022.rp4.GateEntryType\022\013\n\003val"
-  "\030\002 \001(\005\"P\n\026SetDefaultGateEntryReq\022\017\n\007proc"
-  "_id\030\001 \001(\005\022%\n\rdefault_entry\030\002 \001(\0132\016.rp4.G"
-  "ateEntry\"0\n\027SetDefaultGateEntryResp\022\025\n\003r"
-  "es\030\001 \001(\0162\010.rp4.Res\"z\n\014GatewayParam\022%\n\tpa"
-  "ramType\030\001 \001(\0162\022.rp4.ParameterType\022\037\n\005fie"
-  "ld\030\002 \001(\0132\016.rp4.FieldInfoH\000\022\031\n\004data\030\003 \001(\013"
-  "2\t.rp4.DataH\000B\007\n\005value\"x\n\013RelationExp\022!\n"
-  "\006param1\030\001 \001(\0132\021.rp4.GatewayParam\022!\n\006para"
-  "m2\030\002 \001(\0132\021.rp4.GatewayParam\022#\n\010relation\030"
-  "\003 \001(\0162\021.rp4.RelationCode\"\221\001\n\024InsertRelat"
-  "ionExpReq\022\016\n\006procId\030\001 \001(\005\022!\n\006param1\030\002 \001("
-  "\0132\021.rp4.GatewayParam\022!\n\006param2\030\003 \001(\0132\021.r"
-  "p4.GatewayParam\022#\n\010relation\030\004 \001(\0162\021.rp4."
-  "RelationCode\".\n\025InsertRelationExpResp\022\025\n"
-  "\003res\030\001 \001(\0162\010.rp4.Res\"%\n\023ClearRelationExp"
-  "Req\022\016\n\006procId\030\001 \001(\005\"-\n\024ClearRelationExpR"
-  "esp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\" \n\016ClearResMa"
-  "pReq\022\016\n\006procId\030\001 \001(\005\"(\n\017ClearResMapResp\022"
-  "\025\n\003res\030\001 \001(\0162\010.rp4.Res\"J\n\014ModResMapReq\022\016"
-  "\n\006procId\030\001 \001(\005\022\013\n\003key\030\002 \001(\005\022\035\n\005entry\030\003 \001"
-  "(\0132\016.rp4.GateEntry\"&\n\rModResMapResp\022\025\n\003r"
-  "es\030\001 \001(\0162\010.rp4.Res\"C\n\rSetNoTableReq\022\016\n\006p"
-  "rocId\030\001 \001(\005\022\021\n\tmatcherId\030\002 \001(\005\022\017\n\007noTabl"
-  "e\030\003 \001(\010\"\'\n\016SetNoTableResp\022\025\n\003res\030\001 \001(\0162\010"
-  ".rp4.Res\".\n\nActionProc\022\020\n\010actionId\030\001 \001(\005"
-  "\022\016\n\006procId\030\002 \001(\005\"[\n\020SetActionProcReq\022\016\n\006"
-  "procId\030\001 \001(\005\022\021\n\tmatcherId\030\002 \001(\005\022$\n\013actio"
-  "nProcs\030\003 \003(\0132\017.rp4.ActionProc\"*\n\021SetActi"
-  "onProcResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"\307\001\n\017Se"
-  "tMemConfigReq\022\016\n\006procId\030\001 \001(\005\022\021\n\tmatcher"
-  "Id\030\002 \001(\005\022\020\n\010keyWidth\030\003 \001(\005\022\022\n\nvalueWidth"
-  "\030\004 \001(\005\022\021\n\tkeyConfig\030\005 \001(\014\022\023\n\013valueConfig"
-  "\030\006 \001(\014\022!\n\tmatchType\030\007 \001(\0162\016.rp4.MatchTyp"
-  "e\022\r\n\005depth\030\010 \001(\005\022\021\n\tmissActId\030\t \001(\005\")\n\020S"
-  "etMemConfigResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"U"
-  "\n\017SetFieldInfoReq\022\016\n\006procId\030\001 \001(\005\022\021\n\tmat"
-  "cherId\030\002 \001(\005\022\037\n\007fdInfos\030\003 \003(\0132\016.rp4.Fiel"
-  "dInfo\")\n\020SetFieldInfoResp\022\025\n\003res\030\001 \001(\0162\010"
-  ".rp4.Res\"\201\001\n\022InsertSramEntryReq\022\016\n\006procI"
-  "d\030\001 \001(\005\022\021\n\tmatcherId\030\002 \001(\005\022\013\n\003key\030\003 \001(\014\022"
-  "\r\n\005value\030\004 \001(\014\022\024\n\014key_byte_len\030\005 \001(\005\022\026\n\016"
-  "value_byte_len\030\006 \001(\005\",\n\023InsertSramEntryR"
-  "esp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"\217\001\n\022InsertTca"
-  "mEntryReq\022\016\n\006procId\030\001 \001(\005\022\021\n\tmatcherId\030\002"
-  " \001(\005\022\013\n\003key\030\003 \001(\014\022\014\n\004mask\030\004 \001(\014\022\r\n\005value"
-  "\030\005 \001(\014\022\024\n\014key_byte_len\030\006 \001(\005\022\026\n\016value_by"
-  "te_len\030\007 \001(\005\",\n\023InsertTcamEntryResp\022\025\n\003r"
-  "es\030\001 \001(\0162\010.rp4.Res\"6\n\021ClearOldConfigReq\022"
-  "\016\n\006procId\030\001 \001(\005\022\021\n\tmatcherId\030\002 \001(\005\"+\n\022Cl"
-  "earOldConfigResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\""
-  "I\n\017SetMissActIdReq\022\016\n\006procId\030\001 \001(\005\022\021\n\tma"
-  "tcherId\030\002 \001(\005\022\023\n\013miss_act_id\030\003 \001(\005\")\n\020Se"
-  "tMissActIdResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"\274\001"
-  "\n\tParameter\022 \n\004type\030\001 \001(\0162\022.rp4.Paramete"
-  "rType\022\017\n\005hdrId\030\002 \001(\005H\000\022\037\n\005field\030\003 \001(\0132\016."
-  "rp4.FieldInfoH\000\022!\n\014constantData\030\004 \001(\0132\t."
-  "rp4.DataH\000\022\026\n\014actionParaId\030\005 \001(\005H\000\022\031\n\002op"
-  "\030\006 \001(\0162\013.rp4.OpCodeH\000B\005\n\003val\"k\n\013ExpTreeN"
-  "ode\022\033\n\003opt\030\001 \001(\0132\016.rp4.Parameter\022\036\n\004left"
-  "\030\002 \001(\0132\020.rp4.ExpTreeNode\022\037\n\005right\030\003 \001(\0132"
-  "\020.rp4.ExpTreeNode\"F\n\004Prim\022\036\n\006lvalue\030\001 \001("
-  "\0132\016.rp4.FieldInfo\022\036\n\004root\030\002 \001(\0132\020.rp4.Ex"
-  "pTreeNode\"K\n\006Action\022\017\n\007paraNum\030\001 \001(\005\022\030\n\005"
-  "prims\030\002 \003(\0132\t.rp4.Prim\022\026\n\016actionParaLens"
-  "\030\004 \003(\005\"P\n\017InsertActionReq\022\016\n\006procId\030\001 \001("
-  "\005\022\033\n\006action\030\002 \001(\0132\013.rp4.Action\022\020\n\010action"
-  "Id\030\003 \001(\005\")\n\020InsertActionResp\022\025\n\003res\030\001 \001("
-  "\0162\010.rp4.Res\" \n\016ClearActionReq\022\016\n\006procId\030"
-  "\001 \001(\005\"(\n\017ClearActionResp\022\025\n\003res\030\001 \001(\0162\010."
-  "rp4.Res\"0\n\014DelActionReq\022\016\n\006procId\030\001 \001(\005\022"
-  "\020\n\010actionId\030\002 \001(\005\"&\n\rDelActionResp\022\025\n\003re"
-  "s\030\001 \001(\0162\010.rp4.Res\",\n\014SigmoidPoint\022\r\n\005inp"
-  "ut\030\001 \001(\005\022\r\n\005value\030\002 \001(\r\"i\n\023LoadSigmoidTa"
-  "bleReq\022!\n\006points\030\001 \003(\0132\021.rp4.SigmoidPoin"
-  "t\022\026\n\016value_bitwidth\030\002 \001(\005\022\027\n\017inputMultip"
-  "lier\030\003 \001(\r\"-\n\024LoadSigmoidTableResp\022\025\n\003re"
-  "s\030\001 \001(\0162\010.rp4.Res\"\026\n\024ClearSigmoidTableRe"
-  "q\".\n\025ClearSigmoidTableResp\022\025\n\003res\030\001 \001(\0162"
-  "\010.rp4.Res\"(\n\010ExpPoint\022\r\n\005input\030\001 \001(\005\022\r\n\005"
-  "value\030\002 \001(\r\"]\n\017LoadExpTableReq\022\035\n\006points"
-  "\030\001 \003(\0132\r.rp4.ExpPoint\022\027\n\017inputMultiplier"
-  "\030\002 \001(\r\022\022\n\nvalueScale\030\003 \001(\r\")\n\020LoadExpTab"
-  "leResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"\022\n\020ClearEx"
-  "pTableReq\"*\n\021ClearExpTableResp\022\025\n\003res\030\001 "
-  "\001(\0162\010.rp4.Res\"\227\002\n\026NeuronPrimitiveContext"
-  "\022\021\n\tcontextId\030\001 \001(\r\022\021\n\tnumInputs\030\002 \001(\r\022\022"
-  "\n\nnumNeurons\030\003 \001(\r\022\025\n\rinputBitwidth\030\004 \001("
-  "\r\022\026\n\016outputBitwidth\030\005 \001(\r\022\023\n\013outputShift"
-  "\030\006 \001(\r\022\027\n\017inputsAreSigned\030\007 \001(\010\022\030\n\020weigh"
-  "tsAreSigned\030\010 \001(\010\022\017\n\007weights\030\t \003(\021\022\016\n\006bi"
-  "ases\030\n \003(\021\022+\n\nactivation\030\013 \001(\0162\027.rp4.Act"
-  "ivationFunction\"M\n\035LoadNeuronPrimitiveCo"
-  "ntextReq\022,\n\007context\030\001 \001(\0132\033.rp4.NeuronPr"
-  "imitiveContext\"7\n\036LoadNeuronPrimitiveCon"
-  "textResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"!\n\037Clear"
-  "NeuronPrimitiveContextsReq\"9\n ClearNeuro"
-  "nPrimitiveContextsResp\022\025\n\003res\030\001 \001(\0162\010.rp"
-  "4.Res*\027\n\003Res\022\006\n\002OK\020\000\022\010\n\004FAIL\020\001*1\n\tFieldT"
-  "ype\022\006\n\002FD\020\000\022\t\n\005VALID\020\001\022\007\n\003HIT\020\002\022\010\n\004MISS\020"
-  "\003*M\n\rParameterType\022\014\n\010CONSTANT\020\000\022\n\n\006HEAD"
-  "ER\020\001\022\t\n\005FIELD\020\002\022\t\n\005PARAM\020\003\022\014\n\010OPERATOR\020\004"
-  "*A\n\014RelationCode\022\006\n\002GT\020\000\022\007\n\003GTE\020\001\022\006\n\002LT\020"
-  "\002\022\007\n\003LTE\020\003\022\006\n\002EQ\020\004\022\007\n\003NEQ\020\005*%\n\rGateEntry"
-  "Type\022\t\n\005TABLE\020\000\022\t\n\005STAGE\020\001*,\n\tMatchType\022"
-  "\t\n\005EXACT\020\000\022\013\n\007TERNARY\020\001\022\007\n\003LPM\020\002*\330\001\n\006OpC"
-  "ode\022\007\n\003ADD\020\000\022\007\n\003SUB\020\001\022\r\n\tSET_FIELD\020\002\022\016\n\n"
-  "COPY_FIELD\020\003\022\016\n\nSHIFT_LEFT\020\004\022\017\n\013SHIFT_RI"
-  "GHT\020\005\022\013\n\007BIT_AND\020\006\022\n\n\006BIT_OR\020\007\022\013\n\007BIT_XO"
-  "R\020\010\022\013\n\007BIT_NEG\020\t\022\007\n\003MUL\020\n\022\007\n\003DIV\020\013\022\024\n\020NE"
-  "URON_PRIMITIVE\020\014\022\022\n\016SIGMOID_LOOKUP\020\r\022\r\n\t"
-  "SUM_BLOCK\020\016*A\n\022ActivationFunction\022\014\n\010ACT"
-  "_NONE\020\000\022\014\n\010ACT_RELU\020\001\022\017\n\013ACT_SIGMOID\020\0022\344"
-  "\r\n\nCfgService\0228\n\013setMetadata\022\023.rp4.SetMe"
-  "tadataReq\032\024.rp4.SetMetadataResp\022<\n\017initP"
-  "arserLevel\022\023.rp4.ParserLevelReq\032\024.rp4.Pa"
-  "rserLevelResp\022A\n\016modParserEntry\022\026.rp4.Mo"
-  "dParserEntryReq\032\027.rp4.ModParserEntryResp"
-  "\0228\n\013clearParser\022\023.rp4.ClearParserReq\032\024.r"
-  "p4.ClearParserResp\022J\n\021insertRelationExp\022"
-  "\031.rp4.InsertRelationExpReq\032\032.rp4.InsertR"
-  "elationExpResp\022G\n\020clearRelationExp\022\030.rp4"
-  ".ClearRelationExpReq\032\031.rp4.ClearRelation"
-  "ExpResp\0228\n\013clearResMap\022\023.rp4.ClearResMap"
-  "Req\032\024.rp4.ClearResMapResp\0222\n\tmodResMap\022\021"
-  ".rp4.ModResMapReq\032\022.rp4.ModResMapResp\022P\n"
-  "\023setDefaultGateEntry\022\033.rp4.SetDefaultGat"
-  "eEntryReq\032\034.rp4.SetDefaultGateEntryResp\022"
-  "5\n\nsetNoTable\022\022.rp4.SetNoTableReq\032\023.rp4."
-  "SetNoTableResp\022>\n\rsetActionProc\022\025.rp4.Se"
-  "tActionProcReq\032\026.rp4.SetActionProcResp\022;"
-  "\n\014setMemConfig\022\024.rp4.SetMemConfigReq\032\025.r"
-  "p4.SetMemConfigResp\022;\n\014setFieldInfo\022\024.rp"
-  "4.SetFieldInfoReq\032\025.rp4.SetFieldInfoResp"
-  "\022A\n\016clearOldConfig\022\026.rp4.ClearOldConfigR"
-  "eq\032\027.rp4.ClearOldConfigResp\022;\n\014setMissAc"
-  "tId\022\024.rp4.SetMissActIdReq\032\025.rp4.SetMissA"
-  "ctIdResp\022D\n\017insertSramEntry\022\027.rp4.Insert"
-  "SramEntryReq\032\030.rp4.InsertSramEntryResp\022D"
-  "\n\017insertTcamEntry\022\027.rp4.InsertTcamEntryR"
-  "eq\032\030.rp4.InsertTcamEntryResp\022;\n\014insertAc"
-  "tion\022\024.rp4.InsertActionReq\032\025.rp4.InsertA"
-  "ctionResp\0228\n\013clearAction\022\023.rp4.ClearActi"
-  "onReq\032\024.rp4.ClearActionResp\0222\n\tdelAction"
-  "\022\021.rp4.DelActionReq\032\022.rp4.DelActionResp\022"
-  "G\n\020loadSigmoidTable\022\030.rp4.LoadSigmoidTab"
-  "leReq\032\031.rp4.LoadSigmoidTableResp\022J\n\021clea"
-  "rSigmoidTable\022\031.rp4.ClearSigmoidTableReq"
-  "\032\032.rp4.ClearSigmoidTableResp\022;\n\014loadExpT"
-  "able\022\024.rp4.LoadExpTableReq\032\025.rp4.LoadExp"
-  "TableResp\022>\n\rclearExpTable\022\025.rp4.ClearEx"
-  "pTableReq\032\026.rp4.ClearExpTableResp\022e\n\032loa"
-  "dNeuronPrimitiveContext\022\".rp4.LoadNeuron"
-  "PrimitiveContextReq\032#.rp4.LoadNeuronPrim"
-  "itiveContextResp\022k\n\034clearNeuronPrimitive"
-  "Contexts\022$.rp4.ClearNeuronPrimitiveConte"
-  "xtsReq\032%.rp4.ClearNeuronPrimitiveContext"
-  "sRespb\006proto3"
+  "\001(\005\"\020\n\016BeginConfigReq\"(\n\017BeginConfigResp"
+  "\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"\021\n\017CommitConfigR"
+  "eq\")\n\020CommitConfigResp\022\025\n\003res\030\001 \001(\0162\010.rp"
+  "4.Res\"\020\n\016AbortConfigReq\"(\n\017AbortConfigRe"
+  "sp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"\304\t\n\010ConfigOp\022*"
+  "\n\013setMetadata\030\001 \001(\0132\023.rp4.SetMetadataReq"
+  "H\000\022.\n\017initParserLevel\030\002 \001(\0132\023.rp4.Parser"
+  "LevelReqH\000\0220\n\016modParserEntry\030\003 \001(\0132\026.rp4"
+  ".ModParserEntryReqH\000\022*\n\013clearParser\030\004 \001("
+  "\0132\023.rp4.ClearParserReqH\000\0226\n\021insertRelati"
+  "onExp\030\005 \001(\0132\031.rp4.InsertRelationExpReqH\000"
+  "\0224\n\020clearRelationExp\030\006 \001(\0132\030.rp4.ClearRe"
+  "lationExpReqH\000\022*\n\013clearResMap\030\007 \001(\0132\023.rp"
+  "4.ClearResMapReqH\000\022&\n\tmodResMap\030\010 \001(\0132\021."
+  "rp4.ModResMapReqH\000\022:\n\023setDefaultGateEntr"
+  "y\030\t \001(\0132\033.rp4.SetDefaultGateEntryReqH\000\022("
+  "\n\nsetNoTable\030\n \001(\0132\022.rp4.SetNoTableReqH\000"
+  "\022.\n\rsetActionProc\030\013 \001(\0132\025.rp4.SetActionP"
+  "rocReqH\000\022,\n\014setMemConfig\030\014 \001(\0132\024.rp4.Set"
+  "MemConfigReqH\000\022,\n\014setFieldInfo\030\r \001(\0132\024.r"
+  "p4.SetFieldInfoReqH\000\0220\n\016clearOldConfig\030\016"
+  " \001(\0132\026.rp4.ClearOldConfigReqH\000\022,\n\014setMis"
+  "sActId\030\017 \001(\0132\024.rp4.SetMissActIdReqH\000\022,\n\014"
+  "insertAction\030\020 \001(\0132\024.rp4.InsertActionReq"
+  "H\000\022*\n\013clearAction\030\021 \001(\0132\023.rp4.ClearActio"
+  "nReqH\000\022&\n\tdelAction\030\022 \001(\0132\021.rp4.DelActio"
+  "nReqH\000\0224\n\020loadSigmoidTable\030\023 \001(\0132\030.rp4.L"
+  "oadSigmoidTableReqH\000\0226\n\021clearSigmoidTabl"
+  "e\030\024 \001(\0132\031.rp4.ClearSigmoidTableReqH\000\022,\n\014"
+  "loadExpTable\030\025 \001(\0132\024.rp4.LoadExpTableReq"
+  "H\000\022.\n\rclearExpTable\030\026 \001(\0132\025.rp4.ClearExp"
+  "TableReqH\000\022H\n\032loadNeuronPrimitiveContext"
+  "\030\027 \001(\0132\".rp4.LoadNeuronPrimitiveContextR"
+  "eqH\000\022L\n\034clearNeuronPrimitiveContexts\030\030 \001"
+  "(\0132$.rp4.ClearNeuronPrimitiveContextsReq"
+  "H\000B\004\n\002op\",\n\016ApplyConfigReq\022\032\n\003ops\030\001 \003(\0132"
+  "\r.rp4.ConfigOp\"9\n\017ApplyConfigResp\022\025\n\003res"
+  "\030\001 \001(\0162\010.rp4.Res\022\017\n\007applied\030\002 \001(\005\"5\n\016Par"
+  "serLevelReq\022\016\n\006procId\030\001 \001(\005\022\023\n\013parserLev"
+  "el\030\002 \001(\005\"(\n\017ParserLevelResp\022\025\n\003res\030\001 \001(\016"
+  "2\010.rp4.Res\"g\n\tFieldInfo\022\r\n\005hdrId\030\001 \001(\005\022\026"
+  "\n\016internalOffset\030\002 \001(\005\022\020\n\010fieldLen\030\003 \001(\005"
+  "\022!\n\tfieldType\030\004 \001(\0162\016.rp4.FieldType\"\337\001\n\021"
+  "ModParserEntryReq\022\016\n\006procId\030\001 \001(\005\022\023\n\013par"
+  "serLevel\030\002 \001(\005\022\r\n\005state\030\003 \001(\005\022\013\n\003key\030\004 \001"
+  "(\r\022\014\n\004mask\030\005 \001(\005\022\r\n\005hdrId\030\006 \001(\005\022\016\n\006hdrLe"
+  "n\030\007 \001(\005\022\021\n\tnextState\030\010 \001(\005\022\025\n\rtransField"
+  "Num\030\t \001(\005\022 \n\010transFds\030\n \003(\0132\016.rp4.FieldI"
+  "nfo\022\020\n\010miss_act\030\013 \001(\005\"+\n\022ModParserEntryR"
+  "esp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\" \n\016ClearParse"
+  "rReq\022\016\n\006procId\030\001 \001(\005\"(\n\017ClearParserResp\022"
+  "\025\n\003res\030\001 \001(\0162\010.rp4.Res\" \n\004Data\022\013\n\003len\030\001 "
+  "\001(\005\022\013\n\003val\030\002 \001(\014\":\n\tGateEntry\022 \n\004type\030\001 "
+  "\001(\0162\022.rp4.GateEntryType\022\013\n\003val\030\002 \001(\005\"P\n\026"
+  "SetDefaultGateEntryReq\022\017\n\007proc_id\030\001 \001(\005\022"
+  "%\n\rdefault_entry\030\002 \001(\0132\016.rp4.GateEntry\"0"
+  "\n\027SetDefaultGateEntryResp\022\025\n\003res\030\001 \001(\0162\010"
+  ".rp4.Res\"z\n\014GatewayParam\022%\n\tparamType\030\001 "
+  "\001(\0162\022.rp4.ParameterType\022\037\n\005field\030\002 \001(\0132\016"
+  ".rp4.FieldInfoH\000\022\031\n\004data\030\003 \001(\0132\t.rp4.Dat"
+  "aH\000B\007\n\005value\"x\n\013RelationExp\022!\n\006param1\030\001 "
+  "\001(\0132\021.rp4.GatewayParam\022!\n\006param2\030\002 \001(\0132\021"
+  ".rp4.GatewayParam\022#\n\010relation\030\003 \001(\0162\021.rp"
+  "4.RelationCode\"\221\001\n\024InsertRelationExpReq\022"
+  "\016\n\006procId\030\001 \001(\005\022!\n\006param1\030\002 \001(\0132\021.rp4.Ga"
+  "tewayParam\022!\n\006param2\030\003 \001(\0132\021.rp4.Gateway"
+  "Param\022#\n\010relation\030\004 \001(\0162\021.rp4.RelationCo"
+  "de\".\n\025InsertRelationExpResp\022\025\n\003res\030\001 \001(\016"
+  "2\010.rp4.Res\"%\n\023ClearRelationExpReq\022\016\n\006pro"
+  "cId\030\001 \001(\005\"-\n\024ClearRelationExpResp\022\025\n\003res"
+  "\030\001 \001(\0162\010.rp4.Res\" \n\016ClearResMapReq\022\016\n\006pr"
+  "ocId\030\001 \001(\005\"(\n\017ClearResMapResp\022\025\n\003res\030\001 \001"
+  "(\0162\010.rp4.Res\"J\n\014ModResMapReq\022\016\n\006procId\030\001"
+  " \001(\005\022\013\n\003key\030\002 \001(\005\022\035\n\005entry\030\003 \001(\0132\016.rp4.G"
+  "ateEntry\"&\n\rModResMapResp\022\025\n\003res\030\001 \001(\0162\010"
+  ".rp4.Res\"C\n\rSetNoTableReq\022\016\n\006procId\030\001 \001("
+  "\005\022\021\n\tmatcherId\030\002 \001(\005\022\017\n\007noTable\030\003 \001(\010\"\'\n"
+  "\016SetNoTableResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"."
+  "\n\nActionProc\022\020\n\010actionId\030\001 \001(\005\022\016\n\006procId"
+  "\030\002 \001(\005\"[\n\020SetActionProcReq\022\016\n\006procId\030\001 \001"
+  "(\005\022\021\n\tmatcherId\030\002 \001(\005\022$\n\013actionProcs\030\003 \003"
+  "(\0132\017.rp4.ActionProc\"*\n\021SetActionProcResp"
+  "\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"\307\001\n\017SetMemConfig"
+  "Req\022\016\n\006procId\030\001 \001(\005\022\021\n\tmatcherId\030\002 \001(\005\022\020"
+  "\n\010keyWidth\030\003 \001(\005\022\022\n\nvalueWidth\030\004 \001(\005\022\021\n\t"
+  "keyConfig\030\005 \001(\014\022\023\n\013valueConfig\030\006 \001(\014\022!\n\t"
+  "matchType\030\007 \001(\0162\016.rp4.MatchType\022\r\n\005depth"
+  "\030\010 \001(\005\022\021\n\tmissActId\030\t \001(\005\")\n\020SetMemConfi"
+  "gResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"U\n\017SetField"
+  "InfoReq\022\016\n\006procId\030\001 \001(\005\022\021\n\tmatcherId\030\002 \001"
+  "(\005\022\037\n\007fdInfos\030\003 \003(\0132\016.rp4.FieldInfo\")\n\020S"
+  "etFieldInfoResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"\201"
+  "\001\n\022InsertSramEntryReq\022\016\n\006procId\030\001 \001(\005\022\021\n"
+  "\tmatcherId\030\002 \001(\005\022\013\n\003key\030\003 \001(\014\022\r\n\005value\030\004"
+  " \001(\014\022\024\n\014key_byte_len\030\005 \001(\005\022\026\n\016value_byte"
+  "_len\030\006 \001(\005\"e\n\023InsertSramEntryResp\022\025\n\003res"
+  "\030\001 \001(\0162\010.rp4.Res\022\021\n\toccupancy\030\002 \001(\005\022\020\n\010c"
+  "apacity\030\003 \001(\005\022\022\n\nstash_used\030\004 \001(\005\"\217\001\n\022In"
+  "sertTcamEntryReq\022\016\n\006procId\030\001 \001(\005\022\021\n\tmatc"
+  "herId\030\002 \001(\005\022\013\n\003key\030\003 \001(\014\022\014\n\004mask\030\004 \001(\014\022\r"
+  "\n\005value\030\005 \001(\014\022\024\n\014key_byte_len\030\006 \001(\005\022\026\n\016v"
+  "alue_byte_len\030\007 \001(\005\",\n\023InsertTcamEntryRe"
+  "sp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"~\n\017ModSramEntr"
+  "yReq\022\016\n\006procId\030\001 \001(\005\022\021\n\tmatcherId\030\002 \001(\005\022"
+  "\013\n\003key\030\003 \001(\014\022\r\n\005value\030\004 \001(\014\022\024\n\014key_byte_"
+  "len\030\005 \001(\005\022\026\n\016value_byte_len\030\006 \001(\005\")\n\020Mod"
+  "SramEntryResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"W\n\017"
+  "DelSramEntryReq\022\016\n\006procId\030\001 \001(\005\022\021\n\tmatch"
+  "erId\030\002 \001(\005\022\013\n\003key\030\003 \001(\014\022\024\n\014key_byte_len\030"
+  "\004 \001(\005\"<\n\020DelSramEntryResp\022\025\n\003res\030\001 \001(\0162\010"
+  ".rp4.Res\022\021\n\toccupancy\030\002 \001(\005\"\214\001\n\017ModTcamE"
+  "ntryReq\022\016\n\006procId\030\001 \001(\005\022\021\n\tmatcherId\030\002 \001"
+  "(\005\022\013\n\003key\030\003 \001(\014\022\014\n\004mask\030\004 \001(\014\022\r\n\005value\030\005"
+  " \001(\014\022\024\n\014key_byte_len\030\006 \001(\005\022\026\n\016value_byte"
+  "_len\030\007 \001(\005\")\n\020ModTcamEntryResp\022\025\n\003res\030\001 "
+  "\001(\0162\010.rp4.Res\"e\n\017DelTcamEntryReq\022\016\n\006proc"
+  "Id\030\001 \001(\005\022\021\n\tmatcherId\030\002 \001(\005\022\013\n\003key\030\003 \001(\014"
+  "\022\014\n\004mask\030\004 \001(\014\022\024\n\014key_byte_len\030\005 \001(\005\")\n\020"
+  "DelTcamEntryResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\""
+  "\205\001\n\020InsertEntriesReq\022\016\n\006procId\030\001 \001(\005\022\021\n\t"
+  "matcherId\030\002 \001(\005\022\017\n\007ternary\030\003 \001(\010\022\024\n\014key_"
+  "byte_len\030\004 \001(\005\022\026\n\016value_byte_len\030\005 \001(\005\022\017"
+  "\n\007entries\030\006 \001(\014\"L\n\021InsertEntriesResp\022\025\n\003"
+  "res\030\001 \001(\0162\010.rp4.Res\022\020\n\010inserted\030\002 \001(\005\022\016\n"
+  "\006failed\030\003 \001(\005\"6\n\021ClearOldConfigReq\022\016\n\006pr"
+  "ocId\030\001 \001(\005\022\021\n\tmatcherId\030\002 \001(\005\"+\n\022ClearOl"
+  "dConfigResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"I\n\017Se"
+  "tMissActIdReq\022\016\n\006procId\030\001 \001(\005\022\021\n\tmatcher"
+  "Id\030\002 \001(\005\022\023\n\013miss_act_id\030\003 \001(\005\")\n\020SetMiss"
+  "ActIdResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"\274\001\n\tPar"
+  "ameter\022 \n\004type\030\001 \001(\0162\022.rp4.ParameterType"
+  "\022\017\n\005hdrId\030\002 \001(\005H\000\022\037\n\005field\030\003 \001(\0132\016.rp4.F"
+  "ieldInfoH\000\022!\n\014constantData\030\004 \001(\0132\t.rp4.D"
+  "ataH\000\022\026\n\014actionParaId\030\005 \001(\005H\000\022\031\n\002op\030\006 \001("
+  "\0162\013.rp4.OpCodeH\000B\005\n\003val\"k\n\013ExpTreeNode\022\033"
+  "\n\003opt\030\001 \001(\0132\016.rp4.Parameter\022\036\n\004left\030\002 \001("
+  "\0132\020.rp4.ExpTreeNode\022\037\n\005right\030\003 \001(\0132\020.rp4"
+  ".ExpTreeNode\"F\n\004Prim\022\036\n\006lvalue\030\001 \001(\0132\016.r"
+  "p4.FieldInfo\022\036\n\004root\030\002 \001(\0132\020.rp4.ExpTree"
+  "Node\"K\n\006Action\022\017\n\007paraNum\030\001 \001(\005\022\030\n\005prims"
+  "\030\002 \003(\0132\t.rp4.Prim\022\026\n\016actionParaLens\030\004 \003("
+  "\005\"P\n\017InsertActionReq\022\016\n\006procId\030\001 \001(\005\022\033\n\006"
+  "action\030\002 \001(\0132\013.rp4.Action\022\020\n\010actionId\030\003 "
+  "\001(\005\")\n\020InsertActionResp\022\025\n\003res\030\001 \001(\0162\010.r"
+  "p4.Res\" \n\016ClearActionReq\022\016\n\006procId\030\001 \001(\005"
+  "\"(\n\017ClearActionResp\022\025\n\003res\030\001 \001(\0162\010.rp4.R"
+  "es\"0\n\014DelActionReq\022\016\n\006procId\030\001 \001(\005\022\020\n\010ac"
+  "tionId\030\002 \001(\005\"&\n\rDelActionResp\022\025\n\003res\030\001 \001"
+  "(\0162\010.rp4.Res\",\n\014SigmoidPoint\022\r\n\005input\030\001 "
+  "\001(\005\022\r\n\005value\030\002 \001(\r\"i\n\023LoadSigmoidTableRe"
+  "q\022!\n\006points\030\001 \003(\0132\021.rp4.SigmoidPoint\022\026\n\016"
+  "value_bitwidth\030\002 \001(\005\022\027\n\017inputMultiplier\030"
+  "\003 \001(\r\"-\n\024LoadSigmoidTableResp\022\025\n\003res\030\001 \001"
+  "(\0162\010.rp4.Res\"\026\n\024ClearSigmoidTableReq\".\n\025"
+  "ClearSigmoidTableResp\022\025\n\003res\030\001 \001(\0162\010.rp4"
+  ".Res\"(\n\010ExpPoint\022\r\n\005input\030\001 \001(\005\022\r\n\005value"
+  "\030\002 \001(\r\"]\n\017LoadExpTableReq\022\035\n\006points\030\001 \003("
+  "\0132\r.rp4.ExpPoint\022\027\n\017inputMultiplier\030\002 \001("
+  "\r\022\022\n\nvalueScale\030\003 \001(\r\")\n\020LoadExpTableRes"
+  "p\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"\022\n\020ClearExpTabl"
+  "eReq\"*\n\021ClearExpTableResp\022\025\n\003res\030\001 \001(\0162\010"
+  ".rp4.Res\"\227\002\n\026NeuronPrimitiveContext\022\021\n\tc"
+  "ontextId\030\001 \001(\r\022\021\n\tnumInputs\030\002 \001(\r\022\022\n\nnum"
+  "Neurons\030\003 \001(\r\022\025\n\rinputBitwidth\030\004 \001(\r\022\026\n\016"
+  "outputBitwidth\030\005 \001(\r\022\023\n\013outputShift\030\006 \001("
+  "\r\022\027\n\017inputsAreSigned\030\007 \001(\010\022\030\n\020weightsAre"
+  "Signed\030\010 \001(\010\022\017\n\007weights\030\t \003(\021\022\016\n\006biases\030"
+  "\n \003(\021\022+\n\nactivation\030\013 \001(\0162\027.rp4.Activati"
+  "onFunction\"M\n\035LoadNeuronPrimitiveContext"
+  "Req\022,\n\007context\030\001 \001(\0132\033.rp4.NeuronPrimiti"
+  "veContext\"7\n\036LoadNeuronPrimitiveContextR"
+  "esp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res\"!\n\037ClearNeuro"
+  "nPrimitiveContextsReq\"9\n ClearNeuronPrim"
+  "itiveContextsResp\022\025\n\003res\030\001 \001(\0162\010.rp4.Res"
+  "*\027\n\003Res\022\006\n\002OK\020\000\022\010\n\004FAIL\020\001*1\n\tFieldType\022\006"
+  "\n\002FD\020\000\022\t\n\005VALID\020\001\022\007\n\003HIT\020\002\022\010\n\004MISS\020\003*M\n\r"
+  "ParameterType\022\014\n\010CONSTANT\020\000\022\n\n\006HEADER\020\001\022"
+  "\t\n\005FIELD\020\002\022\t\n\005PARAM\020\003\022\014\n\010OPERATOR\020\004*A\n\014R"
+  "elationCode\022\006\n\002GT\020\000\022\007\n\003GTE\020\001\022\006\n\002LT\020\002\022\007\n\003"
+  "LTE\020\003\022\006\n\002EQ\020\004\022\007\n\003NEQ\020\005*%\n\rGateEntryType\022"
+  "\t\n\005TABLE\020\000\022\t\n\005STAGE\020\001*,\n\tMatchType\022\t\n\005EX"
+  "ACT\020\000\022\013\n\007TERNARY\020\001\022\007\n\003LPM\020\002*\330\001\n\006OpCode\022\007"
+  "\n\003ADD\020\000\022\007\n\003SUB\020\001\022\r\n\tSET_FIELD\020\002\022\016\n\nCOPY_"
+  "FIELD\020\003\022\016\n\nSHIFT_LEFT\020\004\022\017\n\013SHIFT_RIGHT\020\005"
+  "\022\013\n\007BIT_AND\020\006\022\n\n\006BIT_OR\020\007\022\013\n\007BIT_XOR\020\010\022\013"
+  "\n\007BIT_NEG\020\t\022\007\n\003MUL\020\n\022\007\n\003DIV\020\013\022\024\n\020NEURON_"
+  "PRIMITIVE\020\014\022\022\n\016SIGMOID_LOOKUP\020\r\022\r\n\tSUM_B"
+  "LOCK\020\016*A\n\022ActivationFunction\022\014\n\010ACT_NONE"
+  "\020\000\022\014\n\010ACT_RELU\020\001\022\017\n\013ACT_SIGMOID\020\0022\205\022\n\nCf"
+  "gService\0228\n\013setMetadata\022\023.rp4.SetMetadat"
+  "aReq\032\024.rp4.SetMetadataResp\0228\n\013beginConfi"
+  "g\022\023.rp4.BeginConfigReq\032\024.rp4.BeginConfig"
+  "Resp\022;\n\014commitConfig\022\024.rp4.CommitConfigR"
+  "eq\032\025.rp4.CommitConfigResp\0228\n\013abortConfig"
+  "\022\023.rp4.AbortConfigReq\032\024.rp4.AbortConfigR"
+  "esp\0228\n\013applyConfig\022\023.rp4.ApplyConfigReq\032"
+  "\024.rp4.ApplyConfigResp\022<\n\017initParserLevel"
+  "\022\023.rp4.ParserLevelReq\032\024.rp4.ParserLevelR"
+  "esp\022A\n\016modParserEntry\022\026.rp4.ModParserEnt"
+  "ryReq\032\027.rp4.ModParserEntryResp\0228\n\013clearP"
+  "arser\022\023.rp4.ClearParserReq\032\024.rp4.ClearPa"
+  "rserResp\022J\n\021insertRelationExp\022\031.rp4.Inse"
+  "rtRelationExpReq\032\032.rp4.InsertRelationExp"
+  "Resp\022G\n\020clearRelationExp\022\030.rp4.ClearRela"
+  "tionExpReq\032\031.rp4.ClearRelationExpResp\0228\n"
+  "\013clearResMap\022\023.rp4.ClearResMapReq\032\024.rp4."
+  "ClearResMapResp\0222\n\tmodResMap\022\021.rp4.ModRe"
+  "sMapReq\032\022.rp4.ModResMapResp\022P\n\023setDefaul"
+  "tGateEntry\022\033.rp4.SetDefaultGateEntryReq\032"
+  "\034.rp4.SetDefaultGateEntryResp\0225\n\nsetNoTa"
+  "ble\022\022.rp4.SetNoTableReq\032\023.rp4.SetNoTable"
+  "Resp\022>\n\rsetActionProc\022\025.rp4.SetActionPro"
+  "cReq\032\026.rp4.SetActionProcResp\022;\n\014setMemCo"
+  "nfig\022\024.rp4.SetMemConfigReq\032\025.rp4.SetMemC"
+  "onfigResp\022;\n\014setFieldInfo\022\024.rp4.SetField"
+  "InfoReq\032\025.rp4.SetFieldInfoResp\022A\n\016clearO"
+  "ldConfig\022\026.rp4.ClearOldConfigReq\032\027.rp4.C"
+  "learOldConfigResp\022;\n\014setMissActId\022\024.rp4."
+  "SetMissActIdReq\032\025.rp4.SetMissActIdResp\022D"
+  "\n\017insertSramEntry\022\027.rp4.InsertSramEntryR"
+  "eq\032\030.rp4.InsertSramEntryResp\022D\n\017insertTc"
+  "amEntry\022\027.rp4.InsertTcamEntryReq\032\030.rp4.I"
+  "nsertTcamEntryResp\022;\n\014modSramEntry\022\024.rp4"
+  ".ModSramEntryReq\032\025.rp4.ModSramEntryResp\022"
+  ";\n\014delSramEntry\022\024.rp4.DelSramEntryReq\032\025."
+  "rp4.DelSramEntryResp\022;\n\014modTcamEntry\022\024.r"
+  "p4.ModTcamEntryReq\032\025.rp4.ModTcamEntryRes"
+  "p\022;\n\014delTcamEntry\022\024.rp4.DelTcamEntryReq\032"
+  "\025.rp4.DelTcamEntryResp\022@\n\rinsertEntries\022"
+  "\025.rp4.InsertEntriesReq\032\026.rp4.InsertEntri"
+  "esResp(\001\022;\n\014insertAction\022\024.rp4.InsertAct"
+  "ionReq\032\025.rp4.InsertActionResp\0228\n\013clearAc"
+  "tion\022\023.rp4.ClearActionReq\032\024.rp4.ClearAct"
+  "ionResp\0222\n\tdelAction\022\021.rp4.DelActionReq\032"
+  "\022.rp4.DelActionResp\022G\n\020loadSigmoidTable\022"
+  "\030.rp4.LoadSigmoidTableReq\032\031.rp4.LoadSigm"
+  "oidTableResp\022J\n\021clearSigmoidTable\022\031.rp4."
+  "ClearSigmoidTableReq\032\032.rp4.ClearSigmoidT"
+  "ableResp\022;\n\014loadExpTable\022\024.rp4.LoadExpTa"
+  "bleReq\032\025.rp4.LoadExpTableResp\022>\n\rclearEx"
+  "pTable\022\025.rp4.ClearExpTableReq\032\026.rp4.Clea"
+  "rExpTableResp\022e\n\032loadNeuronPrimitiveCont"
+  "ext\022\".rp4.LoadNeuronPrimitiveContextReq\032"
+  "#.rp4.LoadNeuronPrimitiveContextResp\022k\n\034"
+  "clearNeuronPrimitiveContexts\022$.rp4.Clear"
+  "NeuronPrimitiveContextsReq\032%.rp4.ClearNe"
+  "uronPrimitiveContextsRespb\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_controller_5fto_5fdataplane_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_controller_5fto_5fdataplane_2eproto = {
-    false, false, 7133, descriptor_table_protodef_controller_5fto_5fdataplane_2eproto,
+    false, false, 10113, descriptor_table_protodef_controller_5fto_5fdataplane_2eproto,
     "controller_to_dataplane.proto",
-    &descriptor_table_controller_5fto_5fdataplane_2eproto_once, nullptr, 0, 67,
+    &descriptor_table_controller_5fto_5fdataplane_2eproto_once, nullptr, 0, 86,
     schemas, file_default_instances, TableStruct_controller_5fto_5fdataplane_2eproto::offsets,
     file_level_metadata_controller_5fto_5fdataplane_2eproto, file_level_enum_descriptors_controller_5fto_5fdataplane_2eproto,
     file_level_service_descriptors_controller_5fto_5fdataplane_2eproto,
@@ -2788,44 +3356,80 @@ void ClearStageReq::InternalSwap(ClearStageReq* other) {
 
 // ===================================================================
 
-class ParserLevelReq::_Internal {
+class BeginConfigReq::_Internal {
  public:
 };
 
-ParserLevelReq::ParserLevelReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+BeginConfigReq::BeginConfigReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:rp4.BeginConfigReq)
+}
+BeginConfigReq::BeginConfigReq(const BeginConfigReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  BeginConfigReq* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:rp4.BeginConfigReq)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BeginConfigReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BeginConfigReq::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata BeginConfigReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[4]);
+}
+
+// ===================================================================
+
+class BeginConfigResp::_Internal {
+ public:
+};
+
+BeginConfigResp::BeginConfigResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.ParserLevelReq)
+  // @@protoc_insertion_point(arena_constructor:rp4.BeginConfigResp)
 }
-ParserLevelReq::ParserLevelReq(const ParserLevelReq& from)
+BeginConfigResp::BeginConfigResp(const BeginConfigResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ParserLevelReq* const _this = this; (void)_this;
+  BeginConfigResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.procid_){}
-    , decltype(_impl_.parserlevel_){}
+      decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.parserlevel_) -
-    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.parserlevel_));
-  // @@protoc_insertion_point(copy_constructor:rp4.ParserLevelReq)
+  _this->_impl_.res_ = from._impl_.res_;
+  // @@protoc_insertion_point(copy_constructor:rp4.BeginConfigResp)
 }
 
-inline void ParserLevelReq::SharedCtor(
+inline void BeginConfigResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.procid_){0}
-    , decltype(_impl_.parserlevel_){0}
+      decltype(_impl_.res_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-ParserLevelReq::~ParserLevelReq() {
-  // @@protoc_insertion_point(destructor:rp4.ParserLevelReq)
+BeginConfigResp::~BeginConfigResp() {
+  // @@protoc_insertion_point(destructor:rp4.BeginConfigResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2833,45 +3437,36 @@ ParserLevelReq::~ParserLevelReq() {
   SharedDtor();
 }
 
-inline void ParserLevelReq::SharedDtor() {
+inline void BeginConfigResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void ParserLevelReq::SetCachedSize(int size) const {
+void BeginConfigResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ParserLevelReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.ParserLevelReq)
+void BeginConfigResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.BeginConfigResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.procid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.parserlevel_) -
-      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.parserlevel_));
+  _impl_.res_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ParserLevelReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* BeginConfigResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 procId = 1;
+      // .rp4.Res res = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 parserLevel = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.parserlevel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_res(static_cast<::rp4::Res>(val));
         } else
           goto handle_unusual;
         continue;
@@ -2898,130 +3493,153 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ParserLevelReq::_InternalSerialize(
+uint8_t* BeginConfigResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.ParserLevelReq)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.BeginConfigResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 procId = 1;
-  if (this->_internal_procid() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
-  }
-
-  // int32 parserLevel = 2;
-  if (this->_internal_parserlevel() != 0) {
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_parserlevel(), target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_res(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.ParserLevelReq)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.BeginConfigResp)
   return target;
 }
 
-size_t ParserLevelReq::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.ParserLevelReq)
+size_t BeginConfigResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.BeginConfigResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 procId = 1;
-  if (this->_internal_procid() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
-  }
-
-  // int32 parserLevel = 2;
-  if (this->_internal_parserlevel() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_parserlevel());
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ParserLevelReq::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BeginConfigResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ParserLevelReq::MergeImpl
+    BeginConfigResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ParserLevelReq::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BeginConfigResp::GetClassData() const { return &_class_data_; }
 
 
-void ParserLevelReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ParserLevelReq*>(&to_msg);
-  auto& from = static_cast<const ParserLevelReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ParserLevelReq)
+void BeginConfigResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BeginConfigResp*>(&to_msg);
+  auto& from = static_cast<const BeginConfigResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.BeginConfigResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_procid() != 0) {
-    _this->_internal_set_procid(from._internal_procid());
-  }
-  if (from._internal_parserlevel() != 0) {
-    _this->_internal_set_parserlevel(from._internal_parserlevel());
+  if (from._internal_res() != 0) {
+    _this->_internal_set_res(from._internal_res());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ParserLevelReq::CopyFrom(const ParserLevelReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ParserLevelReq)
+void BeginConfigResp::CopyFrom(const BeginConfigResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.BeginConfigResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ParserLevelReq::IsInitialized() const {
+bool BeginConfigResp::IsInitialized() const {
   return true;
 }
 
-void ParserLevelReq::InternalSwap(ParserLevelReq* other) {
+void BeginConfigResp::InternalSwap(BeginConfigResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ParserLevelReq, _impl_.parserlevel_)
-      + sizeof(ParserLevelReq::_impl_.parserlevel_)
-      - PROTOBUF_FIELD_OFFSET(ParserLevelReq, _impl_.procid_)>(
-          reinterpret_cast<char*>(&_impl_.procid_),
-          reinterpret_cast<char*>(&other->_impl_.procid_));
+  swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ParserLevelReq::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata BeginConfigResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[4]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[5]);
 }
 
 // ===================================================================
 
-class ParserLevelResp::_Internal {
+class CommitConfigReq::_Internal {
  public:
 };
 
-ParserLevelResp::ParserLevelResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+CommitConfigReq::CommitConfigReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:rp4.CommitConfigReq)
+}
+CommitConfigReq::CommitConfigReq(const CommitConfigReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  CommitConfigReq* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:rp4.CommitConfigReq)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommitConfigReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommitConfigReq::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata CommitConfigReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[6]);
+}
+
+// ===================================================================
+
+class CommitConfigResp::_Internal {
+ public:
+};
+
+CommitConfigResp::CommitConfigResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.ParserLevelResp)
+  // @@protoc_insertion_point(arena_constructor:rp4.CommitConfigResp)
 }
-ParserLevelResp::ParserLevelResp(const ParserLevelResp& from)
+CommitConfigResp::CommitConfigResp(const CommitConfigResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ParserLevelResp* const _this = this; (void)_this;
+  CommitConfigResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.res_ = from._impl_.res_;
-  // @@protoc_insertion_point(copy_constructor:rp4.ParserLevelResp)
+  // @@protoc_insertion_point(copy_constructor:rp4.CommitConfigResp)
 }
 
-inline void ParserLevelResp::SharedCtor(
+inline void CommitConfigResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -3031,8 +3649,8 @@ inline void ParserLevelResp::SharedCtor(
   };
 }
 
-ParserLevelResp::~ParserLevelResp() {
-  // @@protoc_insertion_point(destructor:rp4.ParserLevelResp)
+CommitConfigResp::~CommitConfigResp() {
+  // @@protoc_insertion_point(destructor:rp4.CommitConfigResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3040,16 +3658,16 @@ ParserLevelResp::~ParserLevelResp() {
   SharedDtor();
 }
 
-inline void ParserLevelResp::SharedDtor() {
+inline void CommitConfigResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void ParserLevelResp::SetCachedSize(int size) const {
+void CommitConfigResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ParserLevelResp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.ParserLevelResp)
+void CommitConfigResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.CommitConfigResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -3058,7 +3676,7 @@ void ParserLevelResp::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ParserLevelResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CommitConfigResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -3096,9 +3714,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ParserLevelResp::_InternalSerialize(
+uint8_t* CommitConfigResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.ParserLevelResp)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.CommitConfigResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -3113,12 +3731,12 @@ uint8_t* ParserLevelResp::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.ParserLevelResp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.CommitConfigResp)
   return target;
 }
 
-size_t ParserLevelResp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.ParserLevelResp)
+size_t CommitConfigResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.CommitConfigResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -3134,17 +3752,17 @@ size_t ParserLevelResp::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ParserLevelResp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommitConfigResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ParserLevelResp::MergeImpl
+    CommitConfigResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ParserLevelResp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommitConfigResp::GetClassData() const { return &_class_data_; }
 
 
-void ParserLevelResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ParserLevelResp*>(&to_msg);
-  auto& from = static_cast<const ParserLevelResp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ParserLevelResp)
+void CommitConfigResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommitConfigResp*>(&to_msg);
+  auto& from = static_cast<const CommitConfigResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.CommitConfigResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -3155,73 +3773,105 @@ void ParserLevelResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ParserLevelResp::CopyFrom(const ParserLevelResp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ParserLevelResp)
+void CommitConfigResp::CopyFrom(const CommitConfigResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.CommitConfigResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ParserLevelResp::IsInitialized() const {
+bool CommitConfigResp::IsInitialized() const {
   return true;
 }
 
-void ParserLevelResp::InternalSwap(ParserLevelResp* other) {
+void CommitConfigResp::InternalSwap(CommitConfigResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ParserLevelResp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CommitConfigResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[5]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[7]);
 }
 
 // ===================================================================
 
-class FieldInfo::_Internal {
+class AbortConfigReq::_Internal {
  public:
 };
 
-FieldInfo::FieldInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+AbortConfigReq::AbortConfigReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:rp4.AbortConfigReq)
+}
+AbortConfigReq::AbortConfigReq(const AbortConfigReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  AbortConfigReq* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:rp4.AbortConfigReq)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AbortConfigReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AbortConfigReq::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata AbortConfigReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[8]);
+}
+
+// ===================================================================
+
+class AbortConfigResp::_Internal {
+ public:
+};
+
+AbortConfigResp::AbortConfigResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.FieldInfo)
+  // @@protoc_insertion_point(arena_constructor:rp4.AbortConfigResp)
 }
-FieldInfo::FieldInfo(const FieldInfo& from)
+AbortConfigResp::AbortConfigResp(const AbortConfigResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  FieldInfo* const _this = this; (void)_this;
+  AbortConfigResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.hdrid_){}
-    , decltype(_impl_.internaloffset_){}
-    , decltype(_impl_.fieldlen_){}
-    , decltype(_impl_.fieldtype_){}
+      decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.hdrid_, &from._impl_.hdrid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.fieldtype_) -
-    reinterpret_cast<char*>(&_impl_.hdrid_)) + sizeof(_impl_.fieldtype_));
-  // @@protoc_insertion_point(copy_constructor:rp4.FieldInfo)
+  _this->_impl_.res_ = from._impl_.res_;
+  // @@protoc_insertion_point(copy_constructor:rp4.AbortConfigResp)
 }
 
-inline void FieldInfo::SharedCtor(
+inline void AbortConfigResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.hdrid_){0}
-    , decltype(_impl_.internaloffset_){0}
-    , decltype(_impl_.fieldlen_){0}
-    , decltype(_impl_.fieldtype_){0}
+      decltype(_impl_.res_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-FieldInfo::~FieldInfo() {
-  // @@protoc_insertion_point(destructor:rp4.FieldInfo)
+AbortConfigResp::~AbortConfigResp() {
+  // @@protoc_insertion_point(destructor:rp4.AbortConfigResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3229,62 +3879,36 @@ FieldInfo::~FieldInfo() {
   SharedDtor();
 }
 
-inline void FieldInfo::SharedDtor() {
+inline void AbortConfigResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void FieldInfo::SetCachedSize(int size) const {
+void AbortConfigResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void FieldInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.FieldInfo)
+void AbortConfigResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.AbortConfigResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.hdrid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.fieldtype_) -
-      reinterpret_cast<char*>(&_impl_.hdrid_)) + sizeof(_impl_.fieldtype_));
+  _impl_.res_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* FieldInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* AbortConfigResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 hdrId = 1;
+      // .rp4.Res res = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.hdrid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 internalOffset = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.internaloffset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 fieldLen = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.fieldlen_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .rp4.FieldType fieldType = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
           uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          _internal_set_fieldtype(static_cast<::rp4::FieldType>(val));
+          _internal_set_res(static_cast<::rp4::Res>(val));
         } else
           goto handle_unusual;
         continue;
@@ -3311,223 +3935,5244 @@ failure:
 #undef CHK_
 }
 
-uint8_t* FieldInfo::_InternalSerialize(
+uint8_t* AbortConfigResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.FieldInfo)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.AbortConfigResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 hdrId = 1;
-  if (this->_internal_hdrid() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_hdrid(), target);
-  }
-
-  // int32 internalOffset = 2;
-  if (this->_internal_internaloffset() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_internaloffset(), target);
-  }
-
-  // int32 fieldLen = 3;
-  if (this->_internal_fieldlen() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_fieldlen(), target);
-  }
-
-  // .rp4.FieldType fieldType = 4;
-  if (this->_internal_fieldtype() != 0) {
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      4, this->_internal_fieldtype(), target);
+      1, this->_internal_res(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.FieldInfo)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.AbortConfigResp)
   return target;
 }
 
-size_t FieldInfo::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.FieldInfo)
+size_t AbortConfigResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.AbortConfigResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 hdrId = 1;
-  if (this->_internal_hdrid() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_hdrid());
-  }
-
-  // int32 internalOffset = 2;
-  if (this->_internal_internaloffset() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_internaloffset());
-  }
-
-  // int32 fieldLen = 3;
-  if (this->_internal_fieldlen() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_fieldlen());
-  }
-
-  // .rp4.FieldType fieldType = 4;
-  if (this->_internal_fieldtype() != 0) {
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
     total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_fieldtype());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FieldInfo::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AbortConfigResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    FieldInfo::MergeImpl
+    AbortConfigResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FieldInfo::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AbortConfigResp::GetClassData() const { return &_class_data_; }
 
 
-void FieldInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<FieldInfo*>(&to_msg);
-  auto& from = static_cast<const FieldInfo&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.FieldInfo)
+void AbortConfigResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AbortConfigResp*>(&to_msg);
+  auto& from = static_cast<const AbortConfigResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.AbortConfigResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_hdrid() != 0) {
-    _this->_internal_set_hdrid(from._internal_hdrid());
-  }
-  if (from._internal_internaloffset() != 0) {
-    _this->_internal_set_internaloffset(from._internal_internaloffset());
-  }
-  if (from._internal_fieldlen() != 0) {
-    _this->_internal_set_fieldlen(from._internal_fieldlen());
-  }
-  if (from._internal_fieldtype() != 0) {
-    _this->_internal_set_fieldtype(from._internal_fieldtype());
+  if (from._internal_res() != 0) {
+    _this->_internal_set_res(from._internal_res());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void FieldInfo::CopyFrom(const FieldInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.FieldInfo)
+void AbortConfigResp::CopyFrom(const AbortConfigResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.AbortConfigResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool FieldInfo::IsInitialized() const {
+bool AbortConfigResp::IsInitialized() const {
   return true;
 }
 
-void FieldInfo::InternalSwap(FieldInfo* other) {
+void AbortConfigResp::InternalSwap(AbortConfigResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(FieldInfo, _impl_.fieldtype_)
-      + sizeof(FieldInfo::_impl_.fieldtype_)
-      - PROTOBUF_FIELD_OFFSET(FieldInfo, _impl_.hdrid_)>(
-          reinterpret_cast<char*>(&_impl_.hdrid_),
-          reinterpret_cast<char*>(&other->_impl_.hdrid_));
+  swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata FieldInfo::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata AbortConfigResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[6]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[9]);
 }
 
 // ===================================================================
 
-class ModParserEntryReq::_Internal {
+class ConfigOp::_Internal {
  public:
+  static const ::rp4::SetMetadataReq& setmetadata(const ConfigOp* msg);
+  static const ::rp4::ParserLevelReq& initparserlevel(const ConfigOp* msg);
+  static const ::rp4::ModParserEntryReq& modparserentry(const ConfigOp* msg);
+  static const ::rp4::ClearParserReq& clearparser(const ConfigOp* msg);
+  static const ::rp4::InsertRelationExpReq& insertrelationexp(const ConfigOp* msg);
+  static const ::rp4::ClearRelationExpReq& clearrelationexp(const ConfigOp* msg);
+  static const ::rp4::ClearResMapReq& clearresmap(const ConfigOp* msg);
+  static const ::rp4::ModResMapReq& modresmap(const ConfigOp* msg);
+  static const ::rp4::SetDefaultGateEntryReq& setdefaultgateentry(const ConfigOp* msg);
+  static const ::rp4::SetNoTableReq& setnotable(const ConfigOp* msg);
+  static const ::rp4::SetActionProcReq& setactionproc(const ConfigOp* msg);
+  static const ::rp4::SetMemConfigReq& setmemconfig(const ConfigOp* msg);
+  static const ::rp4::SetFieldInfoReq& setfieldinfo(const ConfigOp* msg);
+  static const ::rp4::ClearOldConfigReq& clearoldconfig(const ConfigOp* msg);
+  static const ::rp4::SetMissActIdReq& setmissactid(const ConfigOp* msg);
+  static const ::rp4::InsertActionReq& insertaction(const ConfigOp* msg);
+  static const ::rp4::ClearActionReq& clearaction(const ConfigOp* msg);
+  static const ::rp4::DelActionReq& delaction(const ConfigOp* msg);
+  static const ::rp4::LoadSigmoidTableReq& loadsigmoidtable(const ConfigOp* msg);
+  static const ::rp4::ClearSigmoidTableReq& clearsigmoidtable(const ConfigOp* msg);
+  static const ::rp4::LoadExpTableReq& loadexptable(const ConfigOp* msg);
+  static const ::rp4::ClearExpTableReq& clearexptable(const ConfigOp* msg);
+  static const ::rp4::LoadNeuronPrimitiveContextReq& loadneuronprimitivecontext(const ConfigOp* msg);
+  static const ::rp4::ClearNeuronPrimitiveContextsReq& clearneuronprimitivecontexts(const ConfigOp* msg);
 };
 
-ModParserEntryReq::ModParserEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.ModParserEntryReq)
+const ::rp4::SetMetadataReq&
+ConfigOp::_Internal::setmetadata(const ConfigOp* msg) {
+  return *msg->_impl_.op_.setmetadata_;
 }
-ModParserEntryReq::ModParserEntryReq(const ModParserEntryReq& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ModParserEntryReq* const _this = this; (void)_this;
-  new (&_impl_) Impl_{
-      decltype(_impl_.transfds_){from._impl_.transfds_}
-    , decltype(_impl_.procid_){}
-    , decltype(_impl_.parserlevel_){}
-    , decltype(_impl_.state_){}
-    , decltype(_impl_.key_){}
-    , decltype(_impl_.mask_){}
-    , decltype(_impl_.hdrid_){}
-    , decltype(_impl_.hdrlen_){}
-    , decltype(_impl_.nextstate_){}
-    , decltype(_impl_.transfieldnum_){}
-    , decltype(_impl_.miss_act_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
-
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.miss_act_) -
-    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.miss_act_));
-  // @@protoc_insertion_point(copy_constructor:rp4.ModParserEntryReq)
+const ::rp4::ParserLevelReq&
+ConfigOp::_Internal::initparserlevel(const ConfigOp* msg) {
+  return *msg->_impl_.op_.initparserlevel_;
 }
-
-inline void ModParserEntryReq::SharedCtor(
-    ::_pb::Arena* arena, bool is_message_owned) {
-  (void)arena;
-  (void)is_message_owned;
-  new (&_impl_) Impl_{
-      decltype(_impl_.transfds_){arena}
-    , decltype(_impl_.procid_){0}
-    , decltype(_impl_.parserlevel_){0}
-    , decltype(_impl_.state_){0}
-    , decltype(_impl_.key_){0u}
-    , decltype(_impl_.mask_){0}
-    , decltype(_impl_.hdrid_){0}
-    , decltype(_impl_.hdrlen_){0}
-    , decltype(_impl_.nextstate_){0}
-    , decltype(_impl_.transfieldnum_){0}
-    , decltype(_impl_.miss_act_){0}
-    , /*decltype(_impl_._cached_size_)*/{}
-  };
+const ::rp4::ModParserEntryReq&
+ConfigOp::_Internal::modparserentry(const ConfigOp* msg) {
+  return *msg->_impl_.op_.modparserentry_;
 }
-
-ModParserEntryReq::~ModParserEntryReq() {
-  // @@protoc_insertion_point(destructor:rp4.ModParserEntryReq)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
+const ::rp4::ClearParserReq&
+ConfigOp::_Internal::clearparser(const ConfigOp* msg) {
+  return *msg->_impl_.op_.clearparser_;
 }
-
+const ::rp4::InsertRelationExpReq&
+ConfigOp::_Internal::insertrelationexp(const ConfigOp* msg) {
+  return *msg->_impl_.op_.insertrelationexp_;
+}
+const ::rp4::ClearRelationExpReq&
+ConfigOp::_Internal::clearrelationexp(const ConfigOp* msg) {
+  return *msg->_impl_.op_.clearrelationexp_;
+}
+const ::rp4::ClearResMapReq&
+ConfigOp::_Internal::clearresmap(const ConfigOp* msg) {
+  return *msg->_impl_.op_.clearresmap_;
+}
+const ::rp4::ModResMapReq&
+ConfigOp::_Internal::modresmap(const ConfigOp* msg) {
+  return *msg->_impl_.op_.modresmap_;
+}
+const ::rp4::SetDefaultGateEntryReq&
+ConfigOp::_Internal::setdefaultgateentry(const ConfigOp* msg) {
+  return *msg->_impl_.op_.setdefaultgateentry_;
+}
+const ::rp4::SetNoTableReq&
+ConfigOp::_Internal::setnotable(const ConfigOp* msg) {
+  return *msg->_impl_.op_.setnotable_;
+}
+const ::rp4::SetActionProcReq&
+ConfigOp::_Internal::setactionproc(const ConfigOp* msg) {
+  return *msg->_impl_.op_.setactionproc_;
+}
+const ::rp4::SetMemConfigReq&
+ConfigOp::_Internal::setmemconfig(const ConfigOp* msg) {
+  return *msg->_impl_.op_.setmemconfig_;
+}
+const ::rp4::SetFieldInfoReq&
+ConfigOp::_Internal::setfieldinfo(const ConfigOp* msg) {
+  return *msg->_impl_.op_.setfieldinfo_;
+}
+const ::rp4::ClearOldConfigReq&
+ConfigOp::_Internal::clearoldconfig(const ConfigOp* msg) {
+  return *msg->_impl_.op_.clearoldconfig_;
+}
+const ::rp4::SetMissActIdReq&
+ConfigOp::_Internal::setmissactid(const ConfigOp* msg) {
+  return *msg->_impl_.op_.setmissactid_;
+}
+const ::rp4::InsertActionReq&
+ConfigOp::_Internal::insertaction(const ConfigOp* msg) {
+  return *msg->_impl_.op_.insertaction_;
+}
+const ::rp4::ClearActionReq&
+ConfigOp::_Internal::clearaction(const ConfigOp* msg) {
+  return *msg->_impl_.op_.clearaction_;
+}
+const ::rp4::DelActionReq&
+ConfigOp::_Internal::delaction(const ConfigOp* msg) {
+  return *msg->_impl_.op_.delaction_;
+}
+const ::rp4::LoadSigmoidTableReq&
+ConfigOp::_Internal::loadsigmoidtable(const ConfigOp* msg) {
+  return *msg->_impl_.op_.loadsigmoidtable_;
+}
+const ::rp4::ClearSigmoidTableReq&
+ConfigOp::_Internal::clearsigmoidtable(const ConfigOp* msg) {
+  return *msg->_impl_.op_.clearsigmoidtable_;
+}
+const ::rp4::LoadExpTableReq&
+ConfigOp::_Internal::loadexptable(const ConfigOp* msg) {
+  return *msg->_impl_.op_.loadexptable_;
+}
+const ::rp4::ClearExpTableReq&
+ConfigOp::_Internal::clearexptable(const ConfigOp* msg) {
+  return *msg->_impl_.op_.clearexptable_;
+}
+const ::rp4::LoadNeuronPrimitiveContextReq&
+ConfigOp::_Internal::loadneuronprimitivecontext(const ConfigOp* msg) {
+  return *msg->_impl_.op_.loadneuronprimitivecontext_;
+}
+const ::rp4::ClearNeuronPrimitiveContextsReq&
+ConfigOp::_Internal::clearneuronprimitivecontexts(const ConfigOp* msg) {
+  return *msg->_impl_.op_.clearneuronprimitivecontexts_;
+}
+void ConfigOp::set_allocated_setmetadata(::rp4::SetMetadataReq* setmetadata) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (setmetadata) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(setmetadata);
+    if (message_arena != submessage_arena) {
+      setmetadata = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, setmetadata, submessage_arena);
+    }
+    set_has_setmetadata();
+    _impl_.op_.setmetadata_ = setmetadata;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.setMetadata)
+}
+void ConfigOp::set_allocated_initparserlevel(::rp4::ParserLevelReq* initparserlevel) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (initparserlevel) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(initparserlevel);
+    if (message_arena != submessage_arena) {
+      initparserlevel = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, initparserlevel, submessage_arena);
+    }
+    set_has_initparserlevel();
+    _impl_.op_.initparserlevel_ = initparserlevel;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.initParserLevel)
+}
+void ConfigOp::set_allocated_modparserentry(::rp4::ModParserEntryReq* modparserentry) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (modparserentry) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(modparserentry);
+    if (message_arena != submessage_arena) {
+      modparserentry = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, modparserentry, submessage_arena);
+    }
+    set_has_modparserentry();
+    _impl_.op_.modparserentry_ = modparserentry;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.modParserEntry)
+}
+void ConfigOp::set_allocated_clearparser(::rp4::ClearParserReq* clearparser) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (clearparser) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(clearparser);
+    if (message_arena != submessage_arena) {
+      clearparser = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, clearparser, submessage_arena);
+    }
+    set_has_clearparser();
+    _impl_.op_.clearparser_ = clearparser;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.clearParser)
+}
+void ConfigOp::set_allocated_insertrelationexp(::rp4::InsertRelationExpReq* insertrelationexp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (insertrelationexp) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(insertrelationexp);
+    if (message_arena != submessage_arena) {
+      insertrelationexp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, insertrelationexp, submessage_arena);
+    }
+    set_has_insertrelationexp();
+    _impl_.op_.insertrelationexp_ = insertrelationexp;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.insertRelationExp)
+}
+void ConfigOp::set_allocated_clearrelationexp(::rp4::ClearRelationExpReq* clearrelationexp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (clearrelationexp) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(clearrelationexp);
+    if (message_arena != submessage_arena) {
+      clearrelationexp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, clearrelationexp, submessage_arena);
+    }
+    set_has_clearrelationexp();
+    _impl_.op_.clearrelationexp_ = clearrelationexp;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.clearRelationExp)
+}
+void ConfigOp::set_allocated_clearresmap(::rp4::ClearResMapReq* clearresmap) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (clearresmap) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(clearresmap);
+    if (message_arena != submessage_arena) {
+      clearresmap = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, clearresmap, submessage_arena);
+    }
+    set_has_clearresmap();
+    _impl_.op_.clearresmap_ = clearresmap;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.clearResMap)
+}
+void ConfigOp::set_allocated_modresmap(::rp4::ModResMapReq* modresmap) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (modresmap) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(modresmap);
+    if (message_arena != submessage_arena) {
+      modresmap = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, modresmap, submessage_arena);
+    }
+    set_has_modresmap();
+    _impl_.op_.modresmap_ = modresmap;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.modResMap)
+}
+void ConfigOp::set_allocated_setdefaultgateentry(::rp4::SetDefaultGateEntryReq* setdefaultgateentry) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (setdefaultgateentry) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(setdefaultgateentry);
+    if (message_arena != submessage_arena) {
+      setdefaultgateentry = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, setdefaultgateentry, submessage_arena);
+    }
+    set_has_setdefaultgateentry();
+    _impl_.op_.setdefaultgateentry_ = setdefaultgateentry;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.setDefaultGateEntry)
+}
+void ConfigOp::set_allocated_setnotable(::rp4::SetNoTableReq* setnotable) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (setnotable) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(setnotable);
+    if (message_arena != submessage_arena) {
+      setnotable = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, setnotable, submessage_arena);
+    }
+    set_has_setnotable();
+    _impl_.op_.setnotable_ = setnotable;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.setNoTable)
+}
+void ConfigOp::set_allocated_setactionproc(::rp4::SetActionProcReq* setactionproc) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (setactionproc) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(setactionproc);
+    if (message_arena != submessage_arena) {
+      setactionproc = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, setactionproc, submessage_arena);
+    }
+    set_has_setactionproc();
+    _impl_.op_.setactionproc_ = setactionproc;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.setActionProc)
+}
+void ConfigOp::set_allocated_setmemconfig(::rp4::SetMemConfigReq* setmemconfig) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (setmemconfig) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(setmemconfig);
+    if (message_arena != submessage_arena) {
+      setmemconfig = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, setmemconfig, submessage_arena);
+    }
+    set_has_setmemconfig();
+    _impl_.op_.setmemconfig_ = setmemconfig;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.setMemConfig)
+}
+void ConfigOp::set_allocated_setfieldinfo(::rp4::SetFieldInfoReq* setfieldinfo) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (setfieldinfo) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(setfieldinfo);
+    if (message_arena != submessage_arena) {
+      setfieldinfo = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, setfieldinfo, submessage_arena);
+    }
+    set_has_setfieldinfo();
+    _impl_.op_.setfieldinfo_ = setfieldinfo;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.setFieldInfo)
+}
+void ConfigOp::set_allocated_clearoldconfig(::rp4::ClearOldConfigReq* clearoldconfig) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (clearoldconfig) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(clearoldconfig);
+    if (message_arena != submessage_arena) {
+      clearoldconfig = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, clearoldconfig, submessage_arena);
+    }
+    set_has_clearoldconfig();
+    _impl_.op_.clearoldconfig_ = clearoldconfig;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.clearOldConfig)
+}
+void ConfigOp::set_allocated_setmissactid(::rp4::SetMissActIdReq* setmissactid) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (setmissactid) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(setmissactid);
+    if (message_arena != submessage_arena) {
+      setmissactid = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, setmissactid, submessage_arena);
+    }
+    set_has_setmissactid();
+    _impl_.op_.setmissactid_ = setmissactid;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.setMissActId)
+}
+void ConfigOp::set_allocated_insertaction(::rp4::InsertActionReq* insertaction) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (insertaction) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(insertaction);
+    if (message_arena != submessage_arena) {
+      insertaction = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, insertaction, submessage_arena);
+    }
+    set_has_insertaction();
+    _impl_.op_.insertaction_ = insertaction;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.insertAction)
+}
+void ConfigOp::set_allocated_clearaction(::rp4::ClearActionReq* clearaction) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (clearaction) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(clearaction);
+    if (message_arena != submessage_arena) {
+      clearaction = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, clearaction, submessage_arena);
+    }
+    set_has_clearaction();
+    _impl_.op_.clearaction_ = clearaction;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.clearAction)
+}
+void ConfigOp::set_allocated_delaction(::rp4::DelActionReq* delaction) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (delaction) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(delaction);
+    if (message_arena != submessage_arena) {
+      delaction = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, delaction, submessage_arena);
+    }
+    set_has_delaction();
+    _impl_.op_.delaction_ = delaction;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.delAction)
+}
+void ConfigOp::set_allocated_loadsigmoidtable(::rp4::LoadSigmoidTableReq* loadsigmoidtable) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (loadsigmoidtable) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(loadsigmoidtable);
+    if (message_arena != submessage_arena) {
+      loadsigmoidtable = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, loadsigmoidtable, submessage_arena);
+    }
+    set_has_loadsigmoidtable();
+    _impl_.op_.loadsigmoidtable_ = loadsigmoidtable;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.loadSigmoidTable)
+}
+void ConfigOp::set_allocated_clearsigmoidtable(::rp4::ClearSigmoidTableReq* clearsigmoidtable) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (clearsigmoidtable) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(clearsigmoidtable);
+    if (message_arena != submessage_arena) {
+      clearsigmoidtable = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, clearsigmoidtable, submessage_arena);
+    }
+    set_has_clearsigmoidtable();
+    _impl_.op_.clearsigmoidtable_ = clearsigmoidtable;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.clearSigmoidTable)
+}
+void ConfigOp::set_allocated_loadexptable(::rp4::LoadExpTableReq* loadexptable) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (loadexptable) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(loadexptable);
+    if (message_arena != submessage_arena) {
+      loadexptable = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, loadexptable, submessage_arena);
+    }
+    set_has_loadexptable();
+    _impl_.op_.loadexptable_ = loadexptable;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.loadExpTable)
+}
+void ConfigOp::set_allocated_clearexptable(::rp4::ClearExpTableReq* clearexptable) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (clearexptable) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(clearexptable);
+    if (message_arena != submessage_arena) {
+      clearexptable = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, clearexptable, submessage_arena);
+    }
+    set_has_clearexptable();
+    _impl_.op_.clearexptable_ = clearexptable;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.clearExpTable)
+}
+void ConfigOp::set_allocated_loadneuronprimitivecontext(::rp4::LoadNeuronPrimitiveContextReq* loadneuronprimitivecontext) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (loadneuronprimitivecontext) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(loadneuronprimitivecontext);
+    if (message_arena != submessage_arena) {
+      loadneuronprimitivecontext = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, loadneuronprimitivecontext, submessage_arena);
+    }
+    set_has_loadneuronprimitivecontext();
+    _impl_.op_.loadneuronprimitivecontext_ = loadneuronprimitivecontext;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.loadNeuronPrimitiveContext)
+}
+void ConfigOp::set_allocated_clearneuronprimitivecontexts(::rp4::ClearNeuronPrimitiveContextsReq* clearneuronprimitivecontexts) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (clearneuronprimitivecontexts) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(clearneuronprimitivecontexts);
+    if (message_arena != submessage_arena) {
+      clearneuronprimitivecontexts = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, clearneuronprimitivecontexts, submessage_arena);
+    }
+    set_has_clearneuronprimitivecontexts();
+    _impl_.op_.clearneuronprimitivecontexts_ = clearneuronprimitivecontexts;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.ConfigOp.clearNeuronPrimitiveContexts)
+}
+ConfigOp::ConfigOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.ConfigOp)
+}
+ConfigOp::ConfigOp(const ConfigOp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConfigOp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_op();
+  switch (from.op_case()) {
+    case kSetMetadata: {
+      _this->_internal_mutable_setmetadata()->::rp4::SetMetadataReq::MergeFrom(
+          from._internal_setmetadata());
+      break;
+    }
+    case kInitParserLevel: {
+      _this->_internal_mutable_initparserlevel()->::rp4::ParserLevelReq::MergeFrom(
+          from._internal_initparserlevel());
+      break;
+    }
+    case kModParserEntry: {
+      _this->_internal_mutable_modparserentry()->::rp4::ModParserEntryReq::MergeFrom(
+          from._internal_modparserentry());
+      break;
+    }
+    case kClearParser: {
+      _this->_internal_mutable_clearparser()->::rp4::ClearParserReq::MergeFrom(
+          from._internal_clearparser());
+      break;
+    }
+    case kInsertRelationExp: {
+      _this->_internal_mutable_insertrelationexp()->::rp4::InsertRelationExpReq::MergeFrom(
+          from._internal_insertrelationexp());
+      break;
+    }
+    case kClearRelationExp: {
+      _this->_internal_mutable_clearrelationexp()->::rp4::ClearRelationExpReq::MergeFrom(
+          from._internal_clearrelationexp());
+      break;
+    }
+    case kClearResMap: {
+      _this->_internal_mutable_clearresmap()->::rp4::ClearResMapReq::MergeFrom(
+          from._internal_clearresmap());
+      break;
+    }
+    case kModResMap: {
+      _this->_internal_mutable_modresmap()->::rp4::ModResMapReq::MergeFrom(
+          from._internal_modresmap());
+      break;
+    }
+    case kSetDefaultGateEntry: {
+      _this->_internal_mutable_setdefaultgateentry()->::rp4::SetDefaultGateEntryReq::MergeFrom(
+          from._internal_setdefaultgateentry());
+      break;
+    }
+    case kSetNoTable: {
+      _this->_internal_mutable_setnotable()->::rp4::SetNoTableReq::MergeFrom(
+          from._internal_setnotable());
+      break;
+    }
+    case kSetActionProc: {
+      _this->_internal_mutable_setactionproc()->::rp4::SetActionProcReq::MergeFrom(
+          from._internal_setactionproc());
+      break;
+    }
+    case kSetMemConfig: {
+      _this->_internal_mutable_setmemconfig()->::rp4::SetMemConfigReq::MergeFrom(
+          from._internal_setmemconfig());
+      break;
+    }
+    case kSetFieldInfo: {
+      _this->_internal_mutable_setfieldinfo()->::rp4::SetFieldInfoReq::MergeFrom(
+          from._internal_setfieldinfo());
+      break;
+    }
+    case kClearOldConfig: {
+      _this->_internal_mutable_clearoldconfig()->::rp4::ClearOldConfigReq::MergeFrom(
+          from._internal_clearoldconfig());
+      break;
+    }
+    case kSetMissActId: {
+      _this->_internal_mutable_setmissactid()->::rp4::SetMissActIdReq::MergeFrom(
+          from._internal_setmissactid());
+      break;
+    }
+    case kInsertAction: {
+      _this->_internal_mutable_insertaction()->::rp4::InsertActionReq::MergeFrom(
+          from._internal_insertaction());
+      break;
+    }
+    case kClearAction: {
+      _this->_internal_mutable_clearaction()->::rp4::ClearActionReq::MergeFrom(
+          from._internal_clearaction());
+      break;
+    }
+    case kDelAction: {
+      _this->_internal_mutable_delaction()->::rp4::DelActionReq::MergeFrom(
+          from._internal_delaction());
+      break;
+    }
+    case kLoadSigmoidTable: {
+      _this->_internal_mutable_loadsigmoidtable()->::rp4::LoadSigmoidTableReq::MergeFrom(
+          from._internal_loadsigmoidtable());
+      break;
+    }
+    case kClearSigmoidTable: {
+      _this->_internal_mutable_clearsigmoidtable()->::rp4::ClearSigmoidTableReq::MergeFrom(
+          from._internal_clearsigmoidtable());
+      break;
+    }
+    case kLoadExpTable: {
+      _this->_internal_mutable_loadexptable()->::rp4::LoadExpTableReq::MergeFrom(
+          from._internal_loadexptable());
+      break;
+    }
+    case kClearExpTable: {
+      _this->_internal_mutable_clearexptable()->::rp4::ClearExpTableReq::MergeFrom(
+          from._internal_clearexptable());
+      break;
+    }
+    case kLoadNeuronPrimitiveContext: {
+      _this->_internal_mutable_loadneuronprimitivecontext()->::rp4::LoadNeuronPrimitiveContextReq::MergeFrom(
+          from._internal_loadneuronprimitivecontext());
+      break;
+    }
+    case kClearNeuronPrimitiveContexts: {
+      _this->_internal_mutable_clearneuronprimitivecontexts()->::rp4::ClearNeuronPrimitiveContextsReq::MergeFrom(
+          from._internal_clearneuronprimitivecontexts());
+      break;
+    }
+    case OP_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:rp4.ConfigOp)
+}
+
+inline void ConfigOp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_op();
+}
+
+ConfigOp::~ConfigOp() {
+  // @@protoc_insertion_point(destructor:rp4.ConfigOp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConfigOp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_op()) {
+    clear_op();
+  }
+}
+
+void ConfigOp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConfigOp::clear_op() {
+// @@protoc_insertion_point(one_of_clear_start:rp4.ConfigOp)
+  switch (op_case()) {
+    case kSetMetadata: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.setmetadata_;
+      }
+      break;
+    }
+    case kInitParserLevel: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.initparserlevel_;
+      }
+      break;
+    }
+    case kModParserEntry: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.modparserentry_;
+      }
+      break;
+    }
+    case kClearParser: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.clearparser_;
+      }
+      break;
+    }
+    case kInsertRelationExp: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.insertrelationexp_;
+      }
+      break;
+    }
+    case kClearRelationExp: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.clearrelationexp_;
+      }
+      break;
+    }
+    case kClearResMap: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.clearresmap_;
+      }
+      break;
+    }
+    case kModResMap: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.modresmap_;
+      }
+      break;
+    }
+    case kSetDefaultGateEntry: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.setdefaultgateentry_;
+      }
+      break;
+    }
+    case kSetNoTable: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.setnotable_;
+      }
+      break;
+    }
+    case kSetActionProc: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.setactionproc_;
+      }
+      break;
+    }
+    case kSetMemConfig: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.setmemconfig_;
+      }
+      break;
+    }
+    case kSetFieldInfo: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.setfieldinfo_;
+      }
+      break;
+    }
+    case kClearOldConfig: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.clearoldconfig_;
+      }
+      break;
+    }
+    case kSetMissActId: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.setmissactid_;
+      }
+      break;
+    }
+    case kInsertAction: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.insertaction_;
+      }
+      break;
+    }
+    case kClearAction: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.clearaction_;
+      }
+      break;
+    }
+    case kDelAction: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.delaction_;
+      }
+      break;
+    }
+    case kLoadSigmoidTable: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.loadsigmoidtable_;
+      }
+      break;
+    }
+    case kClearSigmoidTable: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.clearsigmoidtable_;
+      }
+      break;
+    }
+    case kLoadExpTable: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.loadexptable_;
+      }
+      break;
+    }
+    case kClearExpTable: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.clearexptable_;
+      }
+      break;
+    }
+    case kLoadNeuronPrimitiveContext: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.loadneuronprimitivecontext_;
+      }
+      break;
+    }
+    case kClearNeuronPrimitiveContexts: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.clearneuronprimitivecontexts_;
+      }
+      break;
+    }
+    case OP_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = OP_NOT_SET;
+}
+
+
+void ConfigOp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ConfigOp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_op();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConfigOp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .rp4.SetMetadataReq setMetadata = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_setmetadata(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.ParserLevelReq initParserLevel = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_initparserlevel(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.ModParserEntryReq modParserEntry = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_modparserentry(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.ClearParserReq clearParser = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_clearparser(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.InsertRelationExpReq insertRelationExp = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_insertrelationexp(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.ClearRelationExpReq clearRelationExp = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_clearrelationexp(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.ClearResMapReq clearResMap = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_clearresmap(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.ModResMapReq modResMap = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_modresmap(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.SetDefaultGateEntryReq setDefaultGateEntry = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_setdefaultgateentry(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.SetNoTableReq setNoTable = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_setnotable(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.SetActionProcReq setActionProc = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_setactionproc(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.SetMemConfigReq setMemConfig = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_setmemconfig(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.SetFieldInfoReq setFieldInfo = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_setfieldinfo(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.ClearOldConfigReq clearOldConfig = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_clearoldconfig(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.SetMissActIdReq setMissActId = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_setmissactid(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.InsertActionReq insertAction = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_insertaction(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.ClearActionReq clearAction = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_clearaction(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.DelActionReq delAction = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_delaction(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.LoadSigmoidTableReq loadSigmoidTable = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_loadsigmoidtable(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.ClearSigmoidTableReq clearSigmoidTable = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          ptr = ctx->ParseMessage(_internal_mutable_clearsigmoidtable(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.LoadExpTableReq loadExpTable = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 170)) {
+          ptr = ctx->ParseMessage(_internal_mutable_loadexptable(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.ClearExpTableReq clearExpTable = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 178)) {
+          ptr = ctx->ParseMessage(_internal_mutable_clearexptable(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.LoadNeuronPrimitiveContextReq loadNeuronPrimitiveContext = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 186)) {
+          ptr = ctx->ParseMessage(_internal_mutable_loadneuronprimitivecontext(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.ClearNeuronPrimitiveContextsReq clearNeuronPrimitiveContexts = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 194)) {
+          ptr = ctx->ParseMessage(_internal_mutable_clearneuronprimitivecontexts(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConfigOp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ConfigOp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .rp4.SetMetadataReq setMetadata = 1;
+  if (_internal_has_setmetadata()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::setmetadata(this),
+        _Internal::setmetadata(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.ParserLevelReq initParserLevel = 2;
+  if (_internal_has_initparserlevel()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::initparserlevel(this),
+        _Internal::initparserlevel(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.ModParserEntryReq modParserEntry = 3;
+  if (_internal_has_modparserentry()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::modparserentry(this),
+        _Internal::modparserentry(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.ClearParserReq clearParser = 4;
+  if (_internal_has_clearparser()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::clearparser(this),
+        _Internal::clearparser(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.InsertRelationExpReq insertRelationExp = 5;
+  if (_internal_has_insertrelationexp()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::insertrelationexp(this),
+        _Internal::insertrelationexp(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.ClearRelationExpReq clearRelationExp = 6;
+  if (_internal_has_clearrelationexp()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::clearrelationexp(this),
+        _Internal::clearrelationexp(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.ClearResMapReq clearResMap = 7;
+  if (_internal_has_clearresmap()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::clearresmap(this),
+        _Internal::clearresmap(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.ModResMapReq modResMap = 8;
+  if (_internal_has_modresmap()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::modresmap(this),
+        _Internal::modresmap(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.SetDefaultGateEntryReq setDefaultGateEntry = 9;
+  if (_internal_has_setdefaultgateentry()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::setdefaultgateentry(this),
+        _Internal::setdefaultgateentry(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.SetNoTableReq setNoTable = 10;
+  if (_internal_has_setnotable()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::setnotable(this),
+        _Internal::setnotable(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.SetActionProcReq setActionProc = 11;
+  if (_internal_has_setactionproc()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::setactionproc(this),
+        _Internal::setactionproc(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.SetMemConfigReq setMemConfig = 12;
+  if (_internal_has_setmemconfig()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::setmemconfig(this),
+        _Internal::setmemconfig(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.SetFieldInfoReq setFieldInfo = 13;
+  if (_internal_has_setfieldinfo()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, _Internal::setfieldinfo(this),
+        _Internal::setfieldinfo(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.ClearOldConfigReq clearOldConfig = 14;
+  if (_internal_has_clearoldconfig()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(14, _Internal::clearoldconfig(this),
+        _Internal::clearoldconfig(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.SetMissActIdReq setMissActId = 15;
+  if (_internal_has_setmissactid()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(15, _Internal::setmissactid(this),
+        _Internal::setmissactid(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.InsertActionReq insertAction = 16;
+  if (_internal_has_insertaction()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(16, _Internal::insertaction(this),
+        _Internal::insertaction(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.ClearActionReq clearAction = 17;
+  if (_internal_has_clearaction()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(17, _Internal::clearaction(this),
+        _Internal::clearaction(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.DelActionReq delAction = 18;
+  if (_internal_has_delaction()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(18, _Internal::delaction(this),
+        _Internal::delaction(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.LoadSigmoidTableReq loadSigmoidTable = 19;
+  if (_internal_has_loadsigmoidtable()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(19, _Internal::loadsigmoidtable(this),
+        _Internal::loadsigmoidtable(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.ClearSigmoidTableReq clearSigmoidTable = 20;
+  if (_internal_has_clearsigmoidtable()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(20, _Internal::clearsigmoidtable(this),
+        _Internal::clearsigmoidtable(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.LoadExpTableReq loadExpTable = 21;
+  if (_internal_has_loadexptable()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(21, _Internal::loadexptable(this),
+        _Internal::loadexptable(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.ClearExpTableReq clearExpTable = 22;
+  if (_internal_has_clearexptable()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(22, _Internal::clearexptable(this),
+        _Internal::clearexptable(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.LoadNeuronPrimitiveContextReq loadNeuronPrimitiveContext = 23;
+  if (_internal_has_loadneuronprimitivecontext()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(23, _Internal::loadneuronprimitivecontext(this),
+        _Internal::loadneuronprimitivecontext(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.ClearNeuronPrimitiveContextsReq clearNeuronPrimitiveContexts = 24;
+  if (_internal_has_clearneuronprimitivecontexts()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(24, _Internal::clearneuronprimitivecontexts(this),
+        _Internal::clearneuronprimitivecontexts(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ConfigOp)
+  return target;
+}
+
+size_t ConfigOp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ConfigOp)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (op_case()) {
+    // .rp4.SetMetadataReq setMetadata = 1;
+    case kSetMetadata: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.setmetadata_);
+      break;
+    }
+    // .rp4.ParserLevelReq initParserLevel = 2;
+    case kInitParserLevel: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.initparserlevel_);
+      break;
+    }
+    // .rp4.ModParserEntryReq modParserEntry = 3;
+    case kModParserEntry: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.modparserentry_);
+      break;
+    }
+    // .rp4.ClearParserReq clearParser = 4;
+    case kClearParser: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.clearparser_);
+      break;
+    }
+    // .rp4.InsertRelationExpReq insertRelationExp = 5;
+    case kInsertRelationExp: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.insertrelationexp_);
+      break;
+    }
+    // .rp4.ClearRelationExpReq clearRelationExp = 6;
+    case kClearRelationExp: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.clearrelationexp_);
+      break;
+    }
+    // .rp4.ClearResMapReq clearResMap = 7;
+    case kClearResMap: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.clearresmap_);
+      break;
+    }
+    // .rp4.ModResMapReq modResMap = 8;
+    case kModResMap: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.modresmap_);
+      break;
+    }
+    // .rp4.SetDefaultGateEntryReq setDefaultGateEntry = 9;
+    case kSetDefaultGateEntry: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.setdefaultgateentry_);
+      break;
+    }
+    // .rp4.SetNoTableReq setNoTable = 10;
+    case kSetNoTable: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.setnotable_);
+      break;
+    }
+    // .rp4.SetActionProcReq setActionProc = 11;
+    case kSetActionProc: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.setactionproc_);
+      break;
+    }
+    // .rp4.SetMemConfigReq setMemConfig = 12;
+    case kSetMemConfig: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.setmemconfig_);
+      break;
+    }
+    // .rp4.SetFieldInfoReq setFieldInfo = 13;
+    case kSetFieldInfo: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.setfieldinfo_);
+      break;
+    }
+    // .rp4.ClearOldConfigReq clearOldConfig = 14;
+    case kClearOldConfig: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.clearoldconfig_);
+      break;
+    }
+    // .rp4.SetMissActIdReq setMissActId = 15;
+    case kSetMissActId: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.setmissactid_);
+      break;
+    }
+    // .rp4.InsertActionReq insertAction = 16;
+    case kInsertAction: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.insertaction_);
+      break;
+    }
+    // .rp4.ClearActionReq clearAction = 17;
+    case kClearAction: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.clearaction_);
+      break;
+    }
+    // .rp4.DelActionReq delAction = 18;
+    case kDelAction: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.delaction_);
+      break;
+    }
+    // .rp4.LoadSigmoidTableReq loadSigmoidTable = 19;
+    case kLoadSigmoidTable: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.loadsigmoidtable_);
+      break;
+    }
+    // .rp4.ClearSigmoidTableReq clearSigmoidTable = 20;
+    case kClearSigmoidTable: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.clearsigmoidtable_);
+      break;
+    }
+    // .rp4.LoadExpTableReq loadExpTable = 21;
+    case kLoadExpTable: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.loadexptable_);
+      break;
+    }
+    // .rp4.ClearExpTableReq clearExpTable = 22;
+    case kClearExpTable: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.clearexptable_);
+      break;
+    }
+    // .rp4.LoadNeuronPrimitiveContextReq loadNeuronPrimitiveContext = 23;
+    case kLoadNeuronPrimitiveContext: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.loadneuronprimitivecontext_);
+      break;
+    }
+    // .rp4.ClearNeuronPrimitiveContextsReq clearNeuronPrimitiveContexts = 24;
+    case kClearNeuronPrimitiveContexts: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.clearneuronprimitivecontexts_);
+      break;
+    }
+    case OP_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConfigOp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConfigOp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConfigOp::GetClassData() const { return &_class_data_; }
+
+
+void ConfigOp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConfigOp*>(&to_msg);
+  auto& from = static_cast<const ConfigOp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ConfigOp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.op_case()) {
+    case kSetMetadata: {
+      _this->_internal_mutable_setmetadata()->::rp4::SetMetadataReq::MergeFrom(
+          from._internal_setmetadata());
+      break;
+    }
+    case kInitParserLevel: {
+      _this->_internal_mutable_initparserlevel()->::rp4::ParserLevelReq::MergeFrom(
+          from._internal_initparserlevel());
+      break;
+    }
+    case kModParserEntry: {
+      _this->_internal_mutable_modparserentry()->::rp4::ModParserEntryReq::MergeFrom(
+          from._internal_modparserentry());
+      break;
+    }
+    case kClearParser: {
+      _this->_internal_mutable_clearparser()->::rp4::ClearParserReq::MergeFrom(
+          from._internal_clearparser());
+      break;
+    }
+    case kInsertRelationExp: {
+      _this->_internal_mutable_insertrelationexp()->::rp4::InsertRelationExpReq::MergeFrom(
+          from._internal_insertrelationexp());
+      break;
+    }
+    case kClearRelationExp: {
+      _this->_internal_mutable_clearrelationexp()->::rp4::ClearRelationExpReq::MergeFrom(
+          from._internal_clearrelationexp());
+      break;
+    }
+    case kClearResMap: {
+      _this->_internal_mutable_clearresmap()->::rp4::ClearResMapReq::MergeFrom(
+          from._internal_clearresmap());
+      break;
+    }
+    case kModResMap: {
+      _this->_internal_mutable_modresmap()->::rp4::ModResMapReq::MergeFrom(
+          from._internal_modresmap());
+      break;
+    }
+    case kSetDefaultGateEntry: {
+      _this->_internal_mutable_setdefaultgateentry()->::rp4::SetDefaultGateEntryReq::MergeFrom(
+          from._internal_setdefaultgateentry());
+      break;
+    }
+    case kSetNoTable: {
+      _this->_internal_mutable_setnotable()->::rp4::SetNoTableReq::MergeFrom(
+          from._internal_setnotable());
+      break;
+    }
+    case kSetActionProc: {
+      _this->_internal_mutable_setactionproc()->::rp4::SetActionProcReq::MergeFrom(
+          from._internal_setactionproc());
+      break;
+    }
+    case kSetMemConfig: {
+      _this->_internal_mutable_setmemconfig()->::rp4::SetMemConfigReq::MergeFrom(
+          from._internal_setmemconfig());
+      break;
+    }
+    case kSetFieldInfo: {
+      _this->_internal_mutable_setfieldinfo()->::rp4::SetFieldInfoReq::MergeFrom(
+          from._internal_setfieldinfo());
+      break;
+    }
+    case kClearOldConfig: {
+      _this->_internal_mutable_clearoldconfig()->::rp4::ClearOldConfigReq::MergeFrom(
+          from._internal_clearoldconfig());
+      break;
+    }
+    case kSetMissActId: {
+      _this->_internal_mutable_setmissactid()->::rp4::SetMissActIdReq::MergeFrom(
+          from._internal_setmissactid());
+      break;
+    }
+    case kInsertAction: {
+      _this->_internal_mutable_insertaction()->::rp4::InsertActionReq::MergeFrom(
+          from._internal_insertaction());
+      break;
+    }
+    case kClearAction: {
+      _this->_internal_mutable_clearaction()->::rp4::ClearActionReq::MergeFrom(
+          from._internal_clearaction());
+      break;
+    }
+    case kDelAction: {
+      _this->_internal_mutable_delaction()->::rp4::DelActionReq::MergeFrom(
+          from._internal_delaction());
+      break;
+    }
+    case kLoadSigmoidTable: {
+      _this->_internal_mutable_loadsigmoidtable()->::rp4::LoadSigmoidTableReq::MergeFrom(
+          from._internal_loadsigmoidtable());
+      break;
+    }
+    case kClearSigmoidTable: {
+      _this->_internal_mutable_clearsigmoidtable()->::rp4::ClearSigmoidTableReq::MergeFrom(
+          from._internal_clearsigmoidtable());
+      break;
+    }
+    case kLoadExpTable: {
+      _this->_internal_mutable_loadexptable()->::rp4::LoadExpTableReq::MergeFrom(
+          from._internal_loadexptable());
+      break;
+    }
+    case kClearExpTable: {
+      _this->_internal_mutable_clearexptable()->::rp4::ClearExpTableReq::MergeFrom(
+          from._internal_clearexptable());
+      break;
+    }
+    case kLoadNeuronPrimitiveContext: {
+      _this->_internal_mutable_loadneuronprimitivecontext()->::rp4::LoadNeuronPrimitiveContextReq::MergeFrom(
+          from._internal_loadneuronprimitivecontext());
+      break;
+    }
+    case kClearNeuronPrimitiveContexts: {
+      _this->_internal_mutable_clearneuronprimitivecontexts()->::rp4::ClearNeuronPrimitiveContextsReq::MergeFrom(
+          from._internal_clearneuronprimitivecontexts());
+      break;
+    }
+    case OP_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ConfigOp::CopyFrom(const ConfigOp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ConfigOp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConfigOp::IsInitialized() const {
+  return true;
+}
+
+void ConfigOp::InternalSwap(ConfigOp* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.op_, other->_impl_.op_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ConfigOp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[10]);
+}
+
+// ===================================================================
+
+class ApplyConfigReq::_Internal {
+ public:
+};
+
+ApplyConfigReq::ApplyConfigReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.ApplyConfigReq)
+}
+ApplyConfigReq::ApplyConfigReq(const ApplyConfigReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ApplyConfigReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ops_){from._impl_.ops_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:rp4.ApplyConfigReq)
+}
+
+inline void ApplyConfigReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ops_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ApplyConfigReq::~ApplyConfigReq() {
+  // @@protoc_insertion_point(destructor:rp4.ApplyConfigReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ApplyConfigReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ops_.~RepeatedPtrField();
+}
+
+void ApplyConfigReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ApplyConfigReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ApplyConfigReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ops_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ApplyConfigReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .rp4.ConfigOp ops = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ApplyConfigReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ApplyConfigReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .rp4.ConfigOp ops = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ApplyConfigReq)
+  return target;
+}
+
+size_t ApplyConfigReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ApplyConfigReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .rp4.ConfigOp ops = 1;
+  total_size += 1UL * this->_internal_ops_size();
+  for (const auto& msg : this->_impl_.ops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ApplyConfigReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ApplyConfigReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ApplyConfigReq::GetClassData() const { return &_class_data_; }
+
+
+void ApplyConfigReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ApplyConfigReq*>(&to_msg);
+  auto& from = static_cast<const ApplyConfigReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ApplyConfigReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ops_.MergeFrom(from._impl_.ops_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ApplyConfigReq::CopyFrom(const ApplyConfigReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ApplyConfigReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ApplyConfigReq::IsInitialized() const {
+  return true;
+}
+
+void ApplyConfigReq::InternalSwap(ApplyConfigReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ops_.InternalSwap(&other->_impl_.ops_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ApplyConfigReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[11]);
+}
+
+// ===================================================================
+
+class ApplyConfigResp::_Internal {
+ public:
+};
+
+ApplyConfigResp::ApplyConfigResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.ApplyConfigResp)
+}
+ApplyConfigResp::ApplyConfigResp(const ApplyConfigResp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ApplyConfigResp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.res_){}
+    , decltype(_impl_.applied_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.res_, &from._impl_.res_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.applied_) -
+    reinterpret_cast<char*>(&_impl_.res_)) + sizeof(_impl_.applied_));
+  // @@protoc_insertion_point(copy_constructor:rp4.ApplyConfigResp)
+}
+
+inline void ApplyConfigResp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.res_){0}
+    , decltype(_impl_.applied_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ApplyConfigResp::~ApplyConfigResp() {
+  // @@protoc_insertion_point(destructor:rp4.ApplyConfigResp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ApplyConfigResp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ApplyConfigResp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ApplyConfigResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ApplyConfigResp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.res_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.applied_) -
+      reinterpret_cast<char*>(&_impl_.res_)) + sizeof(_impl_.applied_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ApplyConfigResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .rp4.Res res = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_res(static_cast<::rp4::Res>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 applied = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.applied_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ApplyConfigResp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ApplyConfigResp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_res(), target);
+  }
+
+  // int32 applied = 2;
+  if (this->_internal_applied() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_applied(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ApplyConfigResp)
+  return target;
+}
+
+size_t ApplyConfigResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ApplyConfigResp)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
+  }
+
+  // int32 applied = 2;
+  if (this->_internal_applied() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_applied());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ApplyConfigResp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ApplyConfigResp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ApplyConfigResp::GetClassData() const { return &_class_data_; }
+
+
+void ApplyConfigResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ApplyConfigResp*>(&to_msg);
+  auto& from = static_cast<const ApplyConfigResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ApplyConfigResp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_res() != 0) {
+    _this->_internal_set_res(from._internal_res());
+  }
+  if (from._internal_applied() != 0) {
+    _this->_internal_set_applied(from._internal_applied());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ApplyConfigResp::CopyFrom(const ApplyConfigResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ApplyConfigResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ApplyConfigResp::IsInitialized() const {
+  return true;
+}
+
+void ApplyConfigResp::InternalSwap(ApplyConfigResp* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ApplyConfigResp, _impl_.applied_)
+      + sizeof(ApplyConfigResp::_impl_.applied_)
+      - PROTOBUF_FIELD_OFFSET(ApplyConfigResp, _impl_.res_)>(
+          reinterpret_cast<char*>(&_impl_.res_),
+          reinterpret_cast<char*>(&other->_impl_.res_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ApplyConfigResp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[12]);
+}
+
+// ===================================================================
+
+class ParserLevelReq::_Internal {
+ public:
+};
+
+ParserLevelReq::ParserLevelReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.ParserLevelReq)
+}
+ParserLevelReq::ParserLevelReq(const ParserLevelReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ParserLevelReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.procid_){}
+    , decltype(_impl_.parserlevel_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.parserlevel_) -
+    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.parserlevel_));
+  // @@protoc_insertion_point(copy_constructor:rp4.ParserLevelReq)
+}
+
+inline void ParserLevelReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.procid_){0}
+    , decltype(_impl_.parserlevel_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ParserLevelReq::~ParserLevelReq() {
+  // @@protoc_insertion_point(destructor:rp4.ParserLevelReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ParserLevelReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ParserLevelReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ParserLevelReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ParserLevelReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.procid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.parserlevel_) -
+      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.parserlevel_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ParserLevelReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 procId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 parserLevel = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.parserlevel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ParserLevelReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ParserLevelReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
+  }
+
+  // int32 parserLevel = 2;
+  if (this->_internal_parserlevel() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_parserlevel(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ParserLevelReq)
+  return target;
+}
+
+size_t ParserLevelReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ParserLevelReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
+  }
+
+  // int32 parserLevel = 2;
+  if (this->_internal_parserlevel() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_parserlevel());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ParserLevelReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ParserLevelReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ParserLevelReq::GetClassData() const { return &_class_data_; }
+
+
+void ParserLevelReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ParserLevelReq*>(&to_msg);
+  auto& from = static_cast<const ParserLevelReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ParserLevelReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_procid() != 0) {
+    _this->_internal_set_procid(from._internal_procid());
+  }
+  if (from._internal_parserlevel() != 0) {
+    _this->_internal_set_parserlevel(from._internal_parserlevel());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ParserLevelReq::CopyFrom(const ParserLevelReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ParserLevelReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ParserLevelReq::IsInitialized() const {
+  return true;
+}
+
+void ParserLevelReq::InternalSwap(ParserLevelReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ParserLevelReq, _impl_.parserlevel_)
+      + sizeof(ParserLevelReq::_impl_.parserlevel_)
+      - PROTOBUF_FIELD_OFFSET(ParserLevelReq, _impl_.procid_)>(
+          reinterpret_cast<char*>(&_impl_.procid_),
+          reinterpret_cast<char*>(&other->_impl_.procid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ParserLevelReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[13]);
+}
+
+// ===================================================================
+
+class ParserLevelResp::_Internal {
+ public:
+};
+
+ParserLevelResp::ParserLevelResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.ParserLevelResp)
+}
+ParserLevelResp::ParserLevelResp(const ParserLevelResp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ParserLevelResp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.res_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.res_ = from._impl_.res_;
+  // @@protoc_insertion_point(copy_constructor:rp4.ParserLevelResp)
+}
+
+inline void ParserLevelResp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.res_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ParserLevelResp::~ParserLevelResp() {
+  // @@protoc_insertion_point(destructor:rp4.ParserLevelResp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ParserLevelResp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ParserLevelResp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ParserLevelResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ParserLevelResp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.res_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ParserLevelResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .rp4.Res res = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_res(static_cast<::rp4::Res>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ParserLevelResp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ParserLevelResp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_res(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ParserLevelResp)
+  return target;
+}
+
+size_t ParserLevelResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ParserLevelResp)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ParserLevelResp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ParserLevelResp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ParserLevelResp::GetClassData() const { return &_class_data_; }
+
+
+void ParserLevelResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ParserLevelResp*>(&to_msg);
+  auto& from = static_cast<const ParserLevelResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ParserLevelResp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_res() != 0) {
+    _this->_internal_set_res(from._internal_res());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ParserLevelResp::CopyFrom(const ParserLevelResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ParserLevelResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ParserLevelResp::IsInitialized() const {
+  return true;
+}
+
+void ParserLevelResp::InternalSwap(ParserLevelResp* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.res_, other->_impl_.res_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ParserLevelResp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[14]);
+}
+
+// ===================================================================
+
+class FieldInfo::_Internal {
+ public:
+};
+
+FieldInfo::FieldInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.FieldInfo)
+}
+FieldInfo::FieldInfo(const FieldInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FieldInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hdrid_){}
+    , decltype(_impl_.internaloffset_){}
+    , decltype(_impl_.fieldlen_){}
+    , decltype(_impl_.fieldtype_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.hdrid_, &from._impl_.hdrid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.fieldtype_) -
+    reinterpret_cast<char*>(&_impl_.hdrid_)) + sizeof(_impl_.fieldtype_));
+  // @@protoc_insertion_point(copy_constructor:rp4.FieldInfo)
+}
+
+inline void FieldInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hdrid_){0}
+    , decltype(_impl_.internaloffset_){0}
+    , decltype(_impl_.fieldlen_){0}
+    , decltype(_impl_.fieldtype_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+FieldInfo::~FieldInfo() {
+  // @@protoc_insertion_point(destructor:rp4.FieldInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FieldInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void FieldInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FieldInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.FieldInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.hdrid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.fieldtype_) -
+      reinterpret_cast<char*>(&_impl_.hdrid_)) + sizeof(_impl_.fieldtype_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FieldInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 hdrId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.hdrid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 internalOffset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.internaloffset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 fieldLen = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.fieldlen_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.FieldType fieldType = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_fieldtype(static_cast<::rp4::FieldType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FieldInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.FieldInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 hdrId = 1;
+  if (this->_internal_hdrid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_hdrid(), target);
+  }
+
+  // int32 internalOffset = 2;
+  if (this->_internal_internaloffset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_internaloffset(), target);
+  }
+
+  // int32 fieldLen = 3;
+  if (this->_internal_fieldlen() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_fieldlen(), target);
+  }
+
+  // .rp4.FieldType fieldType = 4;
+  if (this->_internal_fieldtype() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_fieldtype(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.FieldInfo)
+  return target;
+}
+
+size_t FieldInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.FieldInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 hdrId = 1;
+  if (this->_internal_hdrid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_hdrid());
+  }
+
+  // int32 internalOffset = 2;
+  if (this->_internal_internaloffset() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_internaloffset());
+  }
+
+  // int32 fieldLen = 3;
+  if (this->_internal_fieldlen() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_fieldlen());
+  }
+
+  // .rp4.FieldType fieldType = 4;
+  if (this->_internal_fieldtype() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_fieldtype());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FieldInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FieldInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FieldInfo::GetClassData() const { return &_class_data_; }
+
+
+void FieldInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FieldInfo*>(&to_msg);
+  auto& from = static_cast<const FieldInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.FieldInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_hdrid() != 0) {
+    _this->_internal_set_hdrid(from._internal_hdrid());
+  }
+  if (from._internal_internaloffset() != 0) {
+    _this->_internal_set_internaloffset(from._internal_internaloffset());
+  }
+  if (from._internal_fieldlen() != 0) {
+    _this->_internal_set_fieldlen(from._internal_fieldlen());
+  }
+  if (from._internal_fieldtype() != 0) {
+    _this->_internal_set_fieldtype(from._internal_fieldtype());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FieldInfo::CopyFrom(const FieldInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.FieldInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FieldInfo::IsInitialized() const {
+  return true;
+}
+
+void FieldInfo::InternalSwap(FieldInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FieldInfo, _impl_.fieldtype_)
+      + sizeof(FieldInfo::_impl_.fieldtype_)
+      - PROTOBUF_FIELD_OFFSET(FieldInfo, _impl_.hdrid_)>(
+          reinterpret_cast<char*>(&_impl_.hdrid_),
+          reinterpret_cast<char*>(&other->_impl_.hdrid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FieldInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[15]);
+}
+
+// ===================================================================
+
+class ModParserEntryReq::_Internal {
+ public:
+};
+
+ModParserEntryReq::ModParserEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.ModParserEntryReq)
+}
+ModParserEntryReq::ModParserEntryReq(const ModParserEntryReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ModParserEntryReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.transfds_){from._impl_.transfds_}
+    , decltype(_impl_.procid_){}
+    , decltype(_impl_.parserlevel_){}
+    , decltype(_impl_.state_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.mask_){}
+    , decltype(_impl_.hdrid_){}
+    , decltype(_impl_.hdrlen_){}
+    , decltype(_impl_.nextstate_){}
+    , decltype(_impl_.transfieldnum_){}
+    , decltype(_impl_.miss_act_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.miss_act_) -
+    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.miss_act_));
+  // @@protoc_insertion_point(copy_constructor:rp4.ModParserEntryReq)
+}
+
+inline void ModParserEntryReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.transfds_){arena}
+    , decltype(_impl_.procid_){0}
+    , decltype(_impl_.parserlevel_){0}
+    , decltype(_impl_.state_){0}
+    , decltype(_impl_.key_){0u}
+    , decltype(_impl_.mask_){0}
+    , decltype(_impl_.hdrid_){0}
+    , decltype(_impl_.hdrlen_){0}
+    , decltype(_impl_.nextstate_){0}
+    , decltype(_impl_.transfieldnum_){0}
+    , decltype(_impl_.miss_act_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ModParserEntryReq::~ModParserEntryReq() {
+  // @@protoc_insertion_point(destructor:rp4.ModParserEntryReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
 inline void ModParserEntryReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.transfds_.~RepeatedPtrField();
+  _impl_.transfds_.~RepeatedPtrField();
+}
+
+void ModParserEntryReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ModParserEntryReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ModParserEntryReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.transfds_.Clear();
+  ::memset(&_impl_.procid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.miss_act_) -
+      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.miss_act_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ModParserEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 procId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 parserLevel = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.parserlevel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 state = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.state_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 key = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.key_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 mask = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.mask_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 hdrId = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.hdrid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 hdrLen = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.hdrlen_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 nextState = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.nextstate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 transFieldNum = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.transfieldnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .rp4.FieldInfo transFds = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_transfds(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 miss_act = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.miss_act_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ModParserEntryReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ModParserEntryReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
+  }
+
+  // int32 parserLevel = 2;
+  if (this->_internal_parserlevel() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_parserlevel(), target);
+  }
+
+  // int32 state = 3;
+  if (this->_internal_state() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_state(), target);
+  }
+
+  // uint32 key = 4;
+  if (this->_internal_key() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_key(), target);
+  }
+
+  // int32 mask = 5;
+  if (this->_internal_mask() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_mask(), target);
+  }
+
+  // int32 hdrId = 6;
+  if (this->_internal_hdrid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_hdrid(), target);
+  }
+
+  // int32 hdrLen = 7;
+  if (this->_internal_hdrlen() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_hdrlen(), target);
+  }
+
+  // int32 nextState = 8;
+  if (this->_internal_nextstate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_nextstate(), target);
+  }
+
+  // int32 transFieldNum = 9;
+  if (this->_internal_transfieldnum() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_transfieldnum(), target);
+  }
+
+  // repeated .rp4.FieldInfo transFds = 10;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_transfds_size()); i < n; i++) {
+    const auto& repfield = this->_internal_transfds(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(10, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int32 miss_act = 11;
+  if (this->_internal_miss_act() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_miss_act(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ModParserEntryReq)
+  return target;
+}
+
+size_t ModParserEntryReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ModParserEntryReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .rp4.FieldInfo transFds = 10;
+  total_size += 1UL * this->_internal_transfds_size();
+  for (const auto& msg : this->_impl_.transfds_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
+  }
+
+  // int32 parserLevel = 2;
+  if (this->_internal_parserlevel() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_parserlevel());
+  }
+
+  // int32 state = 3;
+  if (this->_internal_state() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_state());
+  }
+
+  // uint32 key = 4;
+  if (this->_internal_key() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_key());
+  }
+
+  // int32 mask = 5;
+  if (this->_internal_mask() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_mask());
+  }
+
+  // int32 hdrId = 6;
+  if (this->_internal_hdrid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_hdrid());
+  }
+
+  // int32 hdrLen = 7;
+  if (this->_internal_hdrlen() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_hdrlen());
+  }
+
+  // int32 nextState = 8;
+  if (this->_internal_nextstate() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_nextstate());
+  }
+
+  // int32 transFieldNum = 9;
+  if (this->_internal_transfieldnum() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_transfieldnum());
+  }
+
+  // int32 miss_act = 11;
+  if (this->_internal_miss_act() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_miss_act());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModParserEntryReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ModParserEntryReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModParserEntryReq::GetClassData() const { return &_class_data_; }
+
+
+void ModParserEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ModParserEntryReq*>(&to_msg);
+  auto& from = static_cast<const ModParserEntryReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ModParserEntryReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.transfds_.MergeFrom(from._impl_.transfds_);
+  if (from._internal_procid() != 0) {
+    _this->_internal_set_procid(from._internal_procid());
+  }
+  if (from._internal_parserlevel() != 0) {
+    _this->_internal_set_parserlevel(from._internal_parserlevel());
+  }
+  if (from._internal_state() != 0) {
+    _this->_internal_set_state(from._internal_state());
+  }
+  if (from._internal_key() != 0) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (from._internal_mask() != 0) {
+    _this->_internal_set_mask(from._internal_mask());
+  }
+  if (from._internal_hdrid() != 0) {
+    _this->_internal_set_hdrid(from._internal_hdrid());
+  }
+  if (from._internal_hdrlen() != 0) {
+    _this->_internal_set_hdrlen(from._internal_hdrlen());
+  }
+  if (from._internal_nextstate() != 0) {
+    _this->_internal_set_nextstate(from._internal_nextstate());
+  }
+  if (from._internal_transfieldnum() != 0) {
+    _this->_internal_set_transfieldnum(from._internal_transfieldnum());
+  }
+  if (from._internal_miss_act() != 0) {
+    _this->_internal_set_miss_act(from._internal_miss_act());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ModParserEntryReq::CopyFrom(const ModParserEntryReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ModParserEntryReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ModParserEntryReq::IsInitialized() const {
+  return true;
+}
+
+void ModParserEntryReq::InternalSwap(ModParserEntryReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.transfds_.InternalSwap(&other->_impl_.transfds_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ModParserEntryReq, _impl_.miss_act_)
+      + sizeof(ModParserEntryReq::_impl_.miss_act_)
+      - PROTOBUF_FIELD_OFFSET(ModParserEntryReq, _impl_.procid_)>(
+          reinterpret_cast<char*>(&_impl_.procid_),
+          reinterpret_cast<char*>(&other->_impl_.procid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ModParserEntryReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[16]);
+}
+
+// ===================================================================
+
+class ModParserEntryResp::_Internal {
+ public:
+};
+
+ModParserEntryResp::ModParserEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.ModParserEntryResp)
+}
+ModParserEntryResp::ModParserEntryResp(const ModParserEntryResp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ModParserEntryResp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.res_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.res_ = from._impl_.res_;
+  // @@protoc_insertion_point(copy_constructor:rp4.ModParserEntryResp)
+}
+
+inline void ModParserEntryResp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.res_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ModParserEntryResp::~ModParserEntryResp() {
+  // @@protoc_insertion_point(destructor:rp4.ModParserEntryResp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ModParserEntryResp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ModParserEntryResp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ModParserEntryResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ModParserEntryResp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.res_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ModParserEntryResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .rp4.Res res = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_res(static_cast<::rp4::Res>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ModParserEntryResp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ModParserEntryResp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_res(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ModParserEntryResp)
+  return target;
+}
+
+size_t ModParserEntryResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ModParserEntryResp)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModParserEntryResp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ModParserEntryResp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModParserEntryResp::GetClassData() const { return &_class_data_; }
+
+
+void ModParserEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ModParserEntryResp*>(&to_msg);
+  auto& from = static_cast<const ModParserEntryResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ModParserEntryResp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_res() != 0) {
+    _this->_internal_set_res(from._internal_res());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ModParserEntryResp::CopyFrom(const ModParserEntryResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ModParserEntryResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ModParserEntryResp::IsInitialized() const {
+  return true;
+}
+
+void ModParserEntryResp::InternalSwap(ModParserEntryResp* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.res_, other->_impl_.res_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ModParserEntryResp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[17]);
+}
+
+// ===================================================================
+
+class ClearParserReq::_Internal {
+ public:
+};
+
+ClearParserReq::ClearParserReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.ClearParserReq)
+}
+ClearParserReq::ClearParserReq(const ClearParserReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClearParserReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.procid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.procid_ = from._impl_.procid_;
+  // @@protoc_insertion_point(copy_constructor:rp4.ClearParserReq)
+}
+
+inline void ClearParserReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.procid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ClearParserReq::~ClearParserReq() {
+  // @@protoc_insertion_point(destructor:rp4.ClearParserReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ClearParserReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ClearParserReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ClearParserReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ClearParserReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.procid_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClearParserReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 procId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ClearParserReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ClearParserReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ClearParserReq)
+  return target;
+}
+
+size_t ClearParserReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ClearParserReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClearParserReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClearParserReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearParserReq::GetClassData() const { return &_class_data_; }
+
+
+void ClearParserReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClearParserReq*>(&to_msg);
+  auto& from = static_cast<const ClearParserReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ClearParserReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_procid() != 0) {
+    _this->_internal_set_procid(from._internal_procid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClearParserReq::CopyFrom(const ClearParserReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ClearParserReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClearParserReq::IsInitialized() const {
+  return true;
+}
+
+void ClearParserReq::InternalSwap(ClearParserReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.procid_, other->_impl_.procid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClearParserReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[18]);
+}
+
+// ===================================================================
+
+class ClearParserResp::_Internal {
+ public:
+};
+
+ClearParserResp::ClearParserResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.ClearParserResp)
+}
+ClearParserResp::ClearParserResp(const ClearParserResp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClearParserResp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.res_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.res_ = from._impl_.res_;
+  // @@protoc_insertion_point(copy_constructor:rp4.ClearParserResp)
+}
+
+inline void ClearParserResp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.res_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ClearParserResp::~ClearParserResp() {
+  // @@protoc_insertion_point(destructor:rp4.ClearParserResp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ClearParserResp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ClearParserResp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ClearParserResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ClearParserResp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.res_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClearParserResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .rp4.Res res = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_res(static_cast<::rp4::Res>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ClearParserResp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ClearParserResp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_res(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ClearParserResp)
+  return target;
+}
+
+size_t ClearParserResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ClearParserResp)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClearParserResp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClearParserResp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearParserResp::GetClassData() const { return &_class_data_; }
+
+
+void ClearParserResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClearParserResp*>(&to_msg);
+  auto& from = static_cast<const ClearParserResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ClearParserResp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_res() != 0) {
+    _this->_internal_set_res(from._internal_res());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClearParserResp::CopyFrom(const ClearParserResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ClearParserResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClearParserResp::IsInitialized() const {
+  return true;
+}
+
+void ClearParserResp::InternalSwap(ClearParserResp* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.res_, other->_impl_.res_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClearParserResp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[19]);
+}
+
+// ===================================================================
+
+class Data::_Internal {
+ public:
+};
+
+Data::Data(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.Data)
+}
+Data::Data(const Data& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Data* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.val_){}
+    , decltype(_impl_.len_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.val_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.val_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_val().empty()) {
+    _this->_impl_.val_.Set(from._internal_val(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.len_ = from._impl_.len_;
+  // @@protoc_insertion_point(copy_constructor:rp4.Data)
+}
+
+inline void Data::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.val_){}
+    , decltype(_impl_.len_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.val_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.val_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Data::~Data() {
+  // @@protoc_insertion_point(destructor:rp4.Data)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Data::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.val_.Destroy();
+}
+
+void Data::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Data::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.Data)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.val_.ClearToEmpty();
+  _impl_.len_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Data::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 len = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes val = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_val();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Data::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.Data)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 len = 1;
+  if (this->_internal_len() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_len(), target);
+  }
+
+  // bytes val = 2;
+  if (!this->_internal_val().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_val(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.Data)
+  return target;
+}
+
+size_t Data::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.Data)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes val = 2;
+  if (!this->_internal_val().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_val());
+  }
+
+  // int32 len = 1;
+  if (this->_internal_len() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_len());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Data::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Data::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Data::GetClassData() const { return &_class_data_; }
+
+
+void Data::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Data*>(&to_msg);
+  auto& from = static_cast<const Data&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.Data)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_val().empty()) {
+    _this->_internal_set_val(from._internal_val());
+  }
+  if (from._internal_len() != 0) {
+    _this->_internal_set_len(from._internal_len());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Data::CopyFrom(const Data& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.Data)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Data::IsInitialized() const {
+  return true;
+}
+
+void Data::InternalSwap(Data* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.val_, lhs_arena,
+      &other->_impl_.val_, rhs_arena
+  );
+  swap(_impl_.len_, other->_impl_.len_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Data::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[20]);
+}
+
+// ===================================================================
+
+class GateEntry::_Internal {
+ public:
+};
+
+GateEntry::GateEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.GateEntry)
+}
+GateEntry::GateEntry(const GateEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GateEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.type_){}
+    , decltype(_impl_.val_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.val_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.val_));
+  // @@protoc_insertion_point(copy_constructor:rp4.GateEntry)
+}
+
+inline void GateEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.type_){0}
+    , decltype(_impl_.val_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GateEntry::~GateEntry() {
+  // @@protoc_insertion_point(destructor:rp4.GateEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GateEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void GateEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GateEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.GateEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.val_) -
+      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.val_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GateEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .rp4.GateEntryType type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::rp4::GateEntryType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 val = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.val_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GateEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.GateEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .rp4.GateEntryType type = 1;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // int32 val = 2;
+  if (this->_internal_val() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_val(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.GateEntry)
+  return target;
+}
+
+size_t GateEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.GateEntry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .rp4.GateEntryType type = 1;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // int32 val = 2;
+  if (this->_internal_val() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_val());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GateEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GateEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GateEntry::GetClassData() const { return &_class_data_; }
+
+
+void GateEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GateEntry*>(&to_msg);
+  auto& from = static_cast<const GateEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.GateEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_val() != 0) {
+    _this->_internal_set_val(from._internal_val());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GateEntry::CopyFrom(const GateEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.GateEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GateEntry::IsInitialized() const {
+  return true;
+}
+
+void GateEntry::InternalSwap(GateEntry* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GateEntry, _impl_.val_)
+      + sizeof(GateEntry::_impl_.val_)
+      - PROTOBUF_FIELD_OFFSET(GateEntry, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GateEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[21]);
+}
+
+// ===================================================================
+
+class SetDefaultGateEntryReq::_Internal {
+ public:
+  static const ::rp4::GateEntry& default_entry(const SetDefaultGateEntryReq* msg);
+};
+
+const ::rp4::GateEntry&
+SetDefaultGateEntryReq::_Internal::default_entry(const SetDefaultGateEntryReq* msg) {
+  return *msg->_impl_.default_entry_;
+}
+SetDefaultGateEntryReq::SetDefaultGateEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.SetDefaultGateEntryReq)
+}
+SetDefaultGateEntryReq::SetDefaultGateEntryReq(const SetDefaultGateEntryReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetDefaultGateEntryReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.default_entry_){nullptr}
+    , decltype(_impl_.proc_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_default_entry()) {
+    _this->_impl_.default_entry_ = new ::rp4::GateEntry(*from._impl_.default_entry_);
+  }
+  _this->_impl_.proc_id_ = from._impl_.proc_id_;
+  // @@protoc_insertion_point(copy_constructor:rp4.SetDefaultGateEntryReq)
+}
+
+inline void SetDefaultGateEntryReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.default_entry_){nullptr}
+    , decltype(_impl_.proc_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SetDefaultGateEntryReq::~SetDefaultGateEntryReq() {
+  // @@protoc_insertion_point(destructor:rp4.SetDefaultGateEntryReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetDefaultGateEntryReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.default_entry_;
+}
+
+void SetDefaultGateEntryReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetDefaultGateEntryReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.SetDefaultGateEntryReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.default_entry_ != nullptr) {
+    delete _impl_.default_entry_;
+  }
+  _impl_.default_entry_ = nullptr;
+  _impl_.proc_id_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetDefaultGateEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 proc_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.proc_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.GateEntry default_entry = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_default_entry(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetDefaultGateEntryReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetDefaultGateEntryReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 proc_id = 1;
+  if (this->_internal_proc_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_proc_id(), target);
+  }
+
+  // .rp4.GateEntry default_entry = 2;
+  if (this->_internal_has_default_entry()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::default_entry(this),
+        _Internal::default_entry(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetDefaultGateEntryReq)
+  return target;
+}
+
+size_t SetDefaultGateEntryReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.SetDefaultGateEntryReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .rp4.GateEntry default_entry = 2;
+  if (this->_internal_has_default_entry()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.default_entry_);
+  }
+
+  // int32 proc_id = 1;
+  if (this->_internal_proc_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_proc_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetDefaultGateEntryReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetDefaultGateEntryReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetDefaultGateEntryReq::GetClassData() const { return &_class_data_; }
+
+
+void SetDefaultGateEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetDefaultGateEntryReq*>(&to_msg);
+  auto& from = static_cast<const SetDefaultGateEntryReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetDefaultGateEntryReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_default_entry()) {
+    _this->_internal_mutable_default_entry()->::rp4::GateEntry::MergeFrom(
+        from._internal_default_entry());
+  }
+  if (from._internal_proc_id() != 0) {
+    _this->_internal_set_proc_id(from._internal_proc_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetDefaultGateEntryReq::CopyFrom(const SetDefaultGateEntryReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetDefaultGateEntryReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetDefaultGateEntryReq::IsInitialized() const {
+  return true;
+}
+
+void SetDefaultGateEntryReq::InternalSwap(SetDefaultGateEntryReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetDefaultGateEntryReq, _impl_.proc_id_)
+      + sizeof(SetDefaultGateEntryReq::_impl_.proc_id_)
+      - PROTOBUF_FIELD_OFFSET(SetDefaultGateEntryReq, _impl_.default_entry_)>(
+          reinterpret_cast<char*>(&_impl_.default_entry_),
+          reinterpret_cast<char*>(&other->_impl_.default_entry_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetDefaultGateEntryReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[22]);
+}
+
+// ===================================================================
+
+class SetDefaultGateEntryResp::_Internal {
+ public:
+};
+
+SetDefaultGateEntryResp::SetDefaultGateEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.SetDefaultGateEntryResp)
+}
+SetDefaultGateEntryResp::SetDefaultGateEntryResp(const SetDefaultGateEntryResp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetDefaultGateEntryResp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.res_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.res_ = from._impl_.res_;
+  // @@protoc_insertion_point(copy_constructor:rp4.SetDefaultGateEntryResp)
+}
+
+inline void SetDefaultGateEntryResp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.res_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SetDefaultGateEntryResp::~SetDefaultGateEntryResp() {
+  // @@protoc_insertion_point(destructor:rp4.SetDefaultGateEntryResp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetDefaultGateEntryResp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SetDefaultGateEntryResp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetDefaultGateEntryResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.SetDefaultGateEntryResp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.res_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetDefaultGateEntryResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .rp4.Res res = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_res(static_cast<::rp4::Res>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetDefaultGateEntryResp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetDefaultGateEntryResp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_res(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetDefaultGateEntryResp)
+  return target;
+}
+
+size_t SetDefaultGateEntryResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.SetDefaultGateEntryResp)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetDefaultGateEntryResp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetDefaultGateEntryResp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetDefaultGateEntryResp::GetClassData() const { return &_class_data_; }
+
+
+void SetDefaultGateEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetDefaultGateEntryResp*>(&to_msg);
+  auto& from = static_cast<const SetDefaultGateEntryResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetDefaultGateEntryResp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_res() != 0) {
+    _this->_internal_set_res(from._internal_res());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetDefaultGateEntryResp::CopyFrom(const SetDefaultGateEntryResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetDefaultGateEntryResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetDefaultGateEntryResp::IsInitialized() const {
+  return true;
+}
+
+void SetDefaultGateEntryResp::InternalSwap(SetDefaultGateEntryResp* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.res_, other->_impl_.res_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetDefaultGateEntryResp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[23]);
+}
+
+// ===================================================================
+
+class GatewayParam::_Internal {
+ public:
+  static const ::rp4::FieldInfo& field(const GatewayParam* msg);
+  static const ::rp4::Data& data(const GatewayParam* msg);
+};
+
+const ::rp4::FieldInfo&
+GatewayParam::_Internal::field(const GatewayParam* msg) {
+  return *msg->_impl_.value_.field_;
+}
+const ::rp4::Data&
+GatewayParam::_Internal::data(const GatewayParam* msg) {
+  return *msg->_impl_.value_.data_;
+}
+void GatewayParam::set_allocated_field(::rp4::FieldInfo* field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(field);
+    if (message_arena != submessage_arena) {
+      field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, field, submessage_arena);
+    }
+    set_has_field();
+    _impl_.value_.field_ = field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.GatewayParam.field)
+}
+void GatewayParam::set_allocated_data(::rp4::Data* data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(data);
+    if (message_arena != submessage_arena) {
+      data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, data, submessage_arena);
+    }
+    set_has_data();
+    _impl_.value_.data_ = data;
+  }
+  // @@protoc_insertion_point(field_set_allocated:rp4.GatewayParam.data)
+}
+GatewayParam::GatewayParam(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.GatewayParam)
+}
+GatewayParam::GatewayParam(const GatewayParam& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GatewayParam* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.paramtype_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.paramtype_ = from._impl_.paramtype_;
+  clear_has_value();
+  switch (from.value_case()) {
+    case kField: {
+      _this->_internal_mutable_field()->::rp4::FieldInfo::MergeFrom(
+          from._internal_field());
+      break;
+    }
+    case kData: {
+      _this->_internal_mutable_data()->::rp4::Data::MergeFrom(
+          from._internal_data());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:rp4.GatewayParam)
+}
+
+inline void GatewayParam::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.paramtype_){0}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_value();
+}
+
+GatewayParam::~GatewayParam() {
+  // @@protoc_insertion_point(destructor:rp4.GatewayParam)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GatewayParam::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_value()) {
+    clear_value();
+  }
+}
+
+void GatewayParam::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GatewayParam::clear_value() {
+// @@protoc_insertion_point(one_of_clear_start:rp4.GatewayParam)
+  switch (value_case()) {
+    case kField: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.field_;
+      }
+      break;
+    }
+    case kData: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.data_;
+      }
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
+}
+
+
+void GatewayParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.GatewayParam)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.paramtype_ = 0;
+  clear_value();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GatewayParam::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .rp4.ParameterType paramType = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_paramtype(static_cast<::rp4::ParameterType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.FieldInfo field = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_field(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.Data data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_data(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GatewayParam::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.GatewayParam)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .rp4.ParameterType paramType = 1;
+  if (this->_internal_paramtype() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_paramtype(), target);
+  }
+
+  // .rp4.FieldInfo field = 2;
+  if (_internal_has_field()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::field(this),
+        _Internal::field(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.Data data = 3;
+  if (_internal_has_data()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::data(this),
+        _Internal::data(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.GatewayParam)
+  return target;
+}
+
+size_t GatewayParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.GatewayParam)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .rp4.ParameterType paramType = 1;
+  if (this->_internal_paramtype() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_paramtype());
+  }
+
+  switch (value_case()) {
+    // .rp4.FieldInfo field = 2;
+    case kField: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.field_);
+      break;
+    }
+    // .rp4.Data data = 3;
+    case kData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.data_);
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GatewayParam::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GatewayParam::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GatewayParam::GetClassData() const { return &_class_data_; }
+
+
+void GatewayParam::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GatewayParam*>(&to_msg);
+  auto& from = static_cast<const GatewayParam&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.GatewayParam)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_paramtype() != 0) {
+    _this->_internal_set_paramtype(from._internal_paramtype());
+  }
+  switch (from.value_case()) {
+    case kField: {
+      _this->_internal_mutable_field()->::rp4::FieldInfo::MergeFrom(
+          from._internal_field());
+      break;
+    }
+    case kData: {
+      _this->_internal_mutable_data()->::rp4::Data::MergeFrom(
+          from._internal_data());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GatewayParam::CopyFrom(const GatewayParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.GatewayParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GatewayParam::IsInitialized() const {
+  return true;
+}
+
+void GatewayParam::InternalSwap(GatewayParam* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.paramtype_, other->_impl_.paramtype_);
+  swap(_impl_.value_, other->_impl_.value_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GatewayParam::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[24]);
+}
+
+// ===================================================================
+
+class RelationExp::_Internal {
+ public:
+  static const ::rp4::GatewayParam& param1(const RelationExp* msg);
+  static const ::rp4::GatewayParam& param2(const RelationExp* msg);
+};
+
+const ::rp4::GatewayParam&
+RelationExp::_Internal::param1(const RelationExp* msg) {
+  return *msg->_impl_.param1_;
+}
+const ::rp4::GatewayParam&
+RelationExp::_Internal::param2(const RelationExp* msg) {
+  return *msg->_impl_.param2_;
+}
+RelationExp::RelationExp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.RelationExp)
+}
+RelationExp::RelationExp(const RelationExp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RelationExp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.param1_){nullptr}
+    , decltype(_impl_.param2_){nullptr}
+    , decltype(_impl_.relation_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_param1()) {
+    _this->_impl_.param1_ = new ::rp4::GatewayParam(*from._impl_.param1_);
+  }
+  if (from._internal_has_param2()) {
+    _this->_impl_.param2_ = new ::rp4::GatewayParam(*from._impl_.param2_);
+  }
+  _this->_impl_.relation_ = from._impl_.relation_;
+  // @@protoc_insertion_point(copy_constructor:rp4.RelationExp)
+}
+
+inline void RelationExp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.param1_){nullptr}
+    , decltype(_impl_.param2_){nullptr}
+    , decltype(_impl_.relation_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RelationExp::~RelationExp() {
+  // @@protoc_insertion_point(destructor:rp4.RelationExp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RelationExp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.param1_;
+  if (this != internal_default_instance()) delete _impl_.param2_;
+}
+
+void RelationExp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RelationExp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.RelationExp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.param1_ != nullptr) {
+    delete _impl_.param1_;
+  }
+  _impl_.param1_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.param2_ != nullptr) {
+    delete _impl_.param2_;
+  }
+  _impl_.param2_ = nullptr;
+  _impl_.relation_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RelationExp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .rp4.GatewayParam param1 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_param1(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.GatewayParam param2 = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_param2(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.RelationCode relation = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_relation(static_cast<::rp4::RelationCode>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RelationExp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.RelationExp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .rp4.GatewayParam param1 = 1;
+  if (this->_internal_has_param1()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::param1(this),
+        _Internal::param1(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.GatewayParam param2 = 2;
+  if (this->_internal_has_param2()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::param2(this),
+        _Internal::param2(this).GetCachedSize(), target, stream);
+  }
+
+  // .rp4.RelationCode relation = 3;
+  if (this->_internal_relation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_relation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.RelationExp)
+  return target;
+}
+
+size_t RelationExp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.RelationExp)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .rp4.GatewayParam param1 = 1;
+  if (this->_internal_has_param1()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.param1_);
+  }
+
+  // .rp4.GatewayParam param2 = 2;
+  if (this->_internal_has_param2()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.param2_);
+  }
+
+  // .rp4.RelationCode relation = 3;
+  if (this->_internal_relation() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_relation());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RelationExp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RelationExp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RelationExp::GetClassData() const { return &_class_data_; }
+
+
+void RelationExp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RelationExp*>(&to_msg);
+  auto& from = static_cast<const RelationExp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.RelationExp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_param1()) {
+    _this->_internal_mutable_param1()->::rp4::GatewayParam::MergeFrom(
+        from._internal_param1());
+  }
+  if (from._internal_has_param2()) {
+    _this->_internal_mutable_param2()->::rp4::GatewayParam::MergeFrom(
+        from._internal_param2());
+  }
+  if (from._internal_relation() != 0) {
+    _this->_internal_set_relation(from._internal_relation());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RelationExp::CopyFrom(const RelationExp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.RelationExp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RelationExp::IsInitialized() const {
+  return true;
+}
+
+void RelationExp::InternalSwap(RelationExp* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RelationExp, _impl_.relation_)
+      + sizeof(RelationExp::_impl_.relation_)
+      - PROTOBUF_FIELD_OFFSET(RelationExp, _impl_.param1_)>(
+          reinterpret_cast<char*>(&_impl_.param1_),
+          reinterpret_cast<char*>(&other->_impl_.param1_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RelationExp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[25]);
+}
+
+// ===================================================================
+
+class InsertRelationExpReq::_Internal {
+ public:
+  static const ::rp4::GatewayParam& param1(const InsertRelationExpReq* msg);
+  static const ::rp4::GatewayParam& param2(const InsertRelationExpReq* msg);
+};
+
+const ::rp4::GatewayParam&
+InsertRelationExpReq::_Internal::param1(const InsertRelationExpReq* msg) {
+  return *msg->_impl_.param1_;
+}
+const ::rp4::GatewayParam&
+InsertRelationExpReq::_Internal::param2(const InsertRelationExpReq* msg) {
+  return *msg->_impl_.param2_;
+}
+InsertRelationExpReq::InsertRelationExpReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rp4.InsertRelationExpReq)
+}
+InsertRelationExpReq::InsertRelationExpReq(const InsertRelationExpReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InsertRelationExpReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.param1_){nullptr}
+    , decltype(_impl_.param2_){nullptr}
+    , decltype(_impl_.procid_){}
+    , decltype(_impl_.relation_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_param1()) {
+    _this->_impl_.param1_ = new ::rp4::GatewayParam(*from._impl_.param1_);
+  }
+  if (from._internal_has_param2()) {
+    _this->_impl_.param2_ = new ::rp4::GatewayParam(*from._impl_.param2_);
+  }
+  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.relation_) -
+    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.relation_));
+  // @@protoc_insertion_point(copy_constructor:rp4.InsertRelationExpReq)
+}
+
+inline void InsertRelationExpReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.param1_){nullptr}
+    , decltype(_impl_.param2_){nullptr}
+    , decltype(_impl_.procid_){0}
+    , decltype(_impl_.relation_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+InsertRelationExpReq::~InsertRelationExpReq() {
+  // @@protoc_insertion_point(destructor:rp4.InsertRelationExpReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InsertRelationExpReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.param1_;
+  if (this != internal_default_instance()) delete _impl_.param2_;
 }
 
-void ModParserEntryReq::SetCachedSize(int size) const {
+void InsertRelationExpReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ModParserEntryReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.ModParserEntryReq)
+void InsertRelationExpReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.InsertRelationExpReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.transfds_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.param1_ != nullptr) {
+    delete _impl_.param1_;
+  }
+  _impl_.param1_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.param2_ != nullptr) {
+    delete _impl_.param2_;
+  }
+  _impl_.param2_ = nullptr;
   ::memset(&_impl_.procid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.miss_act_) -
-      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.miss_act_));
+      reinterpret_cast<char*>(&_impl_.relation_) -
+      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.relation_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ModParserEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* InsertRelationExpReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -3541,88 +9186,28 @@ const char* ModParserEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseCont
         } else
           goto handle_unusual;
         continue;
-      // int32 parserLevel = 2;
+      // .rp4.GatewayParam param1 = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.parserlevel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_param1(), ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // int32 state = 3;
+      // .rp4.GatewayParam param2 = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.state_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_param2(), ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // uint32 key = 4;
+      // .rp4.RelationCode relation = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          _impl_.key_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 mask = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          _impl_.mask_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 hdrId = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
-          _impl_.hdrid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 hdrLen = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
-          _impl_.hdrlen_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 nextState = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
-          _impl_.nextstate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 transFieldNum = 9;
-      case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
-          _impl_.transfieldnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // repeated .rp4.FieldInfo transFds = 10;
-      case 10:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_transfds(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 miss_act = 11;
-      case 11:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
-          _impl_.miss_act_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_relation(static_cast<::rp4::RelationCode>(val));
         } else
           goto handle_unusual;
         continue;
@@ -3649,9 +9234,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ModParserEntryReq::_InternalSerialize(
+uint8_t* InsertRelationExpReq::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.ModParserEntryReq)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.InsertRelationExpReq)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -3661,89 +9246,55 @@ uint8_t* ModParserEntryReq::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
   }
 
-  // int32 parserLevel = 2;
-  if (this->_internal_parserlevel() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_parserlevel(), target);
-  }
-
-  // int32 state = 3;
-  if (this->_internal_state() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_state(), target);
-  }
-
-  // uint32 key = 4;
-  if (this->_internal_key() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_key(), target);
-  }
-
-  // int32 mask = 5;
-  if (this->_internal_mask() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_mask(), target);
-  }
-
-  // int32 hdrId = 6;
-  if (this->_internal_hdrid() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_hdrid(), target);
-  }
-
-  // int32 hdrLen = 7;
-  if (this->_internal_hdrlen() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_hdrlen(), target);
-  }
-
-  // int32 nextState = 8;
-  if (this->_internal_nextstate() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_nextstate(), target);
-  }
-
-  // int32 transFieldNum = 9;
-  if (this->_internal_transfieldnum() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_transfieldnum(), target);
+  // .rp4.GatewayParam param1 = 2;
+  if (this->_internal_has_param1()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::param1(this),
+        _Internal::param1(this).GetCachedSize(), target, stream);
   }
 
-  // repeated .rp4.FieldInfo transFds = 10;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_transfds_size()); i < n; i++) {
-    const auto& repfield = this->_internal_transfds(i);
+  // .rp4.GatewayParam param2 = 3;
+  if (this->_internal_has_param2()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(10, repfield, repfield.GetCachedSize(), target, stream);
+      InternalWriteMessage(3, _Internal::param2(this),
+        _Internal::param2(this).GetCachedSize(), target, stream);
   }
 
-  // int32 miss_act = 11;
-  if (this->_internal_miss_act() != 0) {
+  // .rp4.RelationCode relation = 4;
+  if (this->_internal_relation() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_miss_act(), target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_relation(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.ModParserEntryReq)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.InsertRelationExpReq)
   return target;
 }
 
-size_t ModParserEntryReq::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.ModParserEntryReq)
+size_t InsertRelationExpReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.InsertRelationExpReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .rp4.FieldInfo transFds = 10;
-  total_size += 1UL * this->_internal_transfds_size();
-  for (const auto& msg : this->_impl_.transfds_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // .rp4.GatewayParam param1 = 2;
+  if (this->_internal_has_param1()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.param1_);
+  }
+
+  // .rp4.GatewayParam param2 = 3;
+  if (this->_internal_has_param2()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.param2_);
   }
 
   // int32 procId = 1;
@@ -3751,157 +9302,100 @@ size_t ModParserEntryReq::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
   }
 
-  // int32 parserLevel = 2;
-  if (this->_internal_parserlevel() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_parserlevel());
-  }
-
-  // int32 state = 3;
-  if (this->_internal_state() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_state());
-  }
-
-  // uint32 key = 4;
-  if (this->_internal_key() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_key());
-  }
-
-  // int32 mask = 5;
-  if (this->_internal_mask() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_mask());
-  }
-
-  // int32 hdrId = 6;
-  if (this->_internal_hdrid() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_hdrid());
-  }
-
-  // int32 hdrLen = 7;
-  if (this->_internal_hdrlen() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_hdrlen());
-  }
-
-  // int32 nextState = 8;
-  if (this->_internal_nextstate() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_nextstate());
-  }
-
-  // int32 transFieldNum = 9;
-  if (this->_internal_transfieldnum() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_transfieldnum());
-  }
-
-  // int32 miss_act = 11;
-  if (this->_internal_miss_act() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_miss_act());
+  // .rp4.RelationCode relation = 4;
+  if (this->_internal_relation() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_relation());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModParserEntryReq::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertRelationExpReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ModParserEntryReq::MergeImpl
+    InsertRelationExpReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModParserEntryReq::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertRelationExpReq::GetClassData() const { return &_class_data_; }
 
 
-void ModParserEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ModParserEntryReq*>(&to_msg);
-  auto& from = static_cast<const ModParserEntryReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ModParserEntryReq)
+void InsertRelationExpReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InsertRelationExpReq*>(&to_msg);
+  auto& from = static_cast<const InsertRelationExpReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.InsertRelationExpReq)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.transfds_.MergeFrom(from._impl_.transfds_);
-  if (from._internal_procid() != 0) {
-    _this->_internal_set_procid(from._internal_procid());
-  }
-  if (from._internal_parserlevel() != 0) {
-    _this->_internal_set_parserlevel(from._internal_parserlevel());
-  }
-  if (from._internal_state() != 0) {
-    _this->_internal_set_state(from._internal_state());
-  }
-  if (from._internal_key() != 0) {
-    _this->_internal_set_key(from._internal_key());
-  }
-  if (from._internal_mask() != 0) {
-    _this->_internal_set_mask(from._internal_mask());
-  }
-  if (from._internal_hdrid() != 0) {
-    _this->_internal_set_hdrid(from._internal_hdrid());
-  }
-  if (from._internal_hdrlen() != 0) {
-    _this->_internal_set_hdrlen(from._internal_hdrlen());
+  if (from._internal_has_param1()) {
+    _this->_internal_mutable_param1()->::rp4::GatewayParam::MergeFrom(
+        from._internal_param1());
   }
-  if (from._internal_nextstate() != 0) {
-    _this->_internal_set_nextstate(from._internal_nextstate());
+  if (from._internal_has_param2()) {
+    _this->_internal_mutable_param2()->::rp4::GatewayParam::MergeFrom(
+        from._internal_param2());
   }
-  if (from._internal_transfieldnum() != 0) {
-    _this->_internal_set_transfieldnum(from._internal_transfieldnum());
+  if (from._internal_procid() != 0) {
+    _this->_internal_set_procid(from._internal_procid());
   }
-  if (from._internal_miss_act() != 0) {
-    _this->_internal_set_miss_act(from._internal_miss_act());
+  if (from._internal_relation() != 0) {
+    _this->_internal_set_relation(from._internal_relation());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ModParserEntryReq::CopyFrom(const ModParserEntryReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ModParserEntryReq)
+void InsertRelationExpReq::CopyFrom(const InsertRelationExpReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.InsertRelationExpReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ModParserEntryReq::IsInitialized() const {
+bool InsertRelationExpReq::IsInitialized() const {
   return true;
 }
 
-void ModParserEntryReq::InternalSwap(ModParserEntryReq* other) {
+void InsertRelationExpReq::InternalSwap(InsertRelationExpReq* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.transfds_.InternalSwap(&other->_impl_.transfds_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ModParserEntryReq, _impl_.miss_act_)
-      + sizeof(ModParserEntryReq::_impl_.miss_act_)
-      - PROTOBUF_FIELD_OFFSET(ModParserEntryReq, _impl_.procid_)>(
-          reinterpret_cast<char*>(&_impl_.procid_),
-          reinterpret_cast<char*>(&other->_impl_.procid_));
+      PROTOBUF_FIELD_OFFSET(InsertRelationExpReq, _impl_.relation_)
+      + sizeof(InsertRelationExpReq::_impl_.relation_)
+      - PROTOBUF_FIELD_OFFSET(InsertRelationExpReq, _impl_.param1_)>(
+          reinterpret_cast<char*>(&_impl_.param1_),
+          reinterpret_cast<char*>(&other->_impl_.param1_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ModParserEntryReq::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata InsertRelationExpReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[7]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[26]);
 }
 
 // ===================================================================
 
-class ModParserEntryResp::_Internal {
+class InsertRelationExpResp::_Internal {
  public:
 };
 
-ModParserEntryResp::ModParserEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+InsertRelationExpResp::InsertRelationExpResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.ModParserEntryResp)
+  // @@protoc_insertion_point(arena_constructor:rp4.InsertRelationExpResp)
 }
-ModParserEntryResp::ModParserEntryResp(const ModParserEntryResp& from)
+InsertRelationExpResp::InsertRelationExpResp(const InsertRelationExpResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ModParserEntryResp* const _this = this; (void)_this;
+  InsertRelationExpResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.res_ = from._impl_.res_;
-  // @@protoc_insertion_point(copy_constructor:rp4.ModParserEntryResp)
+  // @@protoc_insertion_point(copy_constructor:rp4.InsertRelationExpResp)
 }
 
-inline void ModParserEntryResp::SharedCtor(
+inline void InsertRelationExpResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -3911,8 +9405,8 @@ inline void ModParserEntryResp::SharedCtor(
   };
 }
 
-ModParserEntryResp::~ModParserEntryResp() {
-  // @@protoc_insertion_point(destructor:rp4.ModParserEntryResp)
+InsertRelationExpResp::~InsertRelationExpResp() {
+  // @@protoc_insertion_point(destructor:rp4.InsertRelationExpResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3920,16 +9414,16 @@ ModParserEntryResp::~ModParserEntryResp() {
   SharedDtor();
 }
 
-inline void ModParserEntryResp::SharedDtor() {
+inline void InsertRelationExpResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void ModParserEntryResp::SetCachedSize(int size) const {
+void InsertRelationExpResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ModParserEntryResp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.ModParserEntryResp)
+void InsertRelationExpResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.InsertRelationExpResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -3938,7 +9432,7 @@ void ModParserEntryResp::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ModParserEntryResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* InsertRelationExpResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -3976,9 +9470,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ModParserEntryResp::_InternalSerialize(
+uint8_t* InsertRelationExpResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.ModParserEntryResp)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.InsertRelationExpResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -3993,12 +9487,12 @@ uint8_t* ModParserEntryResp::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.ModParserEntryResp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.InsertRelationExpResp)
   return target;
 }
 
-size_t ModParserEntryResp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.ModParserEntryResp)
+size_t InsertRelationExpResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.InsertRelationExpResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -4014,17 +9508,17 @@ size_t ModParserEntryResp::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModParserEntryResp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertRelationExpResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ModParserEntryResp::MergeImpl
+    InsertRelationExpResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModParserEntryResp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertRelationExpResp::GetClassData() const { return &_class_data_; }
 
 
-void ModParserEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ModParserEntryResp*>(&to_msg);
-  auto& from = static_cast<const ModParserEntryResp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ModParserEntryResp)
+void InsertRelationExpResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InsertRelationExpResp*>(&to_msg);
+  auto& from = static_cast<const InsertRelationExpResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.InsertRelationExpResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -4035,54 +9529,54 @@ void ModParserEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, con
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ModParserEntryResp::CopyFrom(const ModParserEntryResp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ModParserEntryResp)
+void InsertRelationExpResp::CopyFrom(const InsertRelationExpResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.InsertRelationExpResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ModParserEntryResp::IsInitialized() const {
+bool InsertRelationExpResp::IsInitialized() const {
   return true;
 }
 
-void ModParserEntryResp::InternalSwap(ModParserEntryResp* other) {
+void InsertRelationExpResp::InternalSwap(InsertRelationExpResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ModParserEntryResp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata InsertRelationExpResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[8]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[27]);
 }
 
 // ===================================================================
 
-class ClearParserReq::_Internal {
+class ClearRelationExpReq::_Internal {
  public:
 };
 
-ClearParserReq::ClearParserReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ClearRelationExpReq::ClearRelationExpReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.ClearParserReq)
+  // @@protoc_insertion_point(arena_constructor:rp4.ClearRelationExpReq)
 }
-ClearParserReq::ClearParserReq(const ClearParserReq& from)
+ClearRelationExpReq::ClearRelationExpReq(const ClearRelationExpReq& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ClearParserReq* const _this = this; (void)_this;
+  ClearRelationExpReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.procid_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.procid_ = from._impl_.procid_;
-  // @@protoc_insertion_point(copy_constructor:rp4.ClearParserReq)
+  // @@protoc_insertion_point(copy_constructor:rp4.ClearRelationExpReq)
 }
 
-inline void ClearParserReq::SharedCtor(
+inline void ClearRelationExpReq::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -4092,8 +9586,8 @@ inline void ClearParserReq::SharedCtor(
   };
 }
 
-ClearParserReq::~ClearParserReq() {
-  // @@protoc_insertion_point(destructor:rp4.ClearParserReq)
+ClearRelationExpReq::~ClearRelationExpReq() {
+  // @@protoc_insertion_point(destructor:rp4.ClearRelationExpReq)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4101,16 +9595,16 @@ ClearParserReq::~ClearParserReq() {
   SharedDtor();
 }
 
-inline void ClearParserReq::SharedDtor() {
+inline void ClearRelationExpReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void ClearParserReq::SetCachedSize(int size) const {
+void ClearRelationExpReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ClearParserReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.ClearParserReq)
+void ClearRelationExpReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ClearRelationExpReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -4119,7 +9613,7 @@ void ClearParserReq::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ClearParserReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ClearRelationExpReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -4156,9 +9650,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ClearParserReq::_InternalSerialize(
+uint8_t* ClearRelationExpReq::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.ClearParserReq)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ClearRelationExpReq)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -4172,12 +9666,12 @@ uint8_t* ClearParserReq::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.ClearParserReq)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ClearRelationExpReq)
   return target;
 }
 
-size_t ClearParserReq::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.ClearParserReq)
+size_t ClearRelationExpReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ClearRelationExpReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -4192,17 +9686,17 @@ size_t ClearParserReq::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClearParserReq::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClearRelationExpReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ClearParserReq::MergeImpl
+    ClearRelationExpReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearParserReq::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearRelationExpReq::GetClassData() const { return &_class_data_; }
 
 
-void ClearParserReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ClearParserReq*>(&to_msg);
-  auto& from = static_cast<const ClearParserReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ClearParserReq)
+void ClearRelationExpReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClearRelationExpReq*>(&to_msg);
+  auto& from = static_cast<const ClearRelationExpReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ClearRelationExpReq)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -4213,54 +9707,54 @@ void ClearParserReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const :
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ClearParserReq::CopyFrom(const ClearParserReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ClearParserReq)
+void ClearRelationExpReq::CopyFrom(const ClearRelationExpReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ClearRelationExpReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ClearParserReq::IsInitialized() const {
+bool ClearRelationExpReq::IsInitialized() const {
   return true;
 }
 
-void ClearParserReq::InternalSwap(ClearParserReq* other) {
+void ClearRelationExpReq::InternalSwap(ClearRelationExpReq* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_.procid_, other->_impl_.procid_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ClearParserReq::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ClearRelationExpReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[9]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[28]);
 }
 
 // ===================================================================
 
-class ClearParserResp::_Internal {
+class ClearRelationExpResp::_Internal {
  public:
 };
 
-ClearParserResp::ClearParserResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ClearRelationExpResp::ClearRelationExpResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.ClearParserResp)
+  // @@protoc_insertion_point(arena_constructor:rp4.ClearRelationExpResp)
 }
-ClearParserResp::ClearParserResp(const ClearParserResp& from)
+ClearRelationExpResp::ClearRelationExpResp(const ClearRelationExpResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ClearParserResp* const _this = this; (void)_this;
+  ClearRelationExpResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.res_ = from._impl_.res_;
-  // @@protoc_insertion_point(copy_constructor:rp4.ClearParserResp)
+  // @@protoc_insertion_point(copy_constructor:rp4.ClearRelationExpResp)
 }
 
-inline void ClearParserResp::SharedCtor(
+inline void ClearRelationExpResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -4270,8 +9764,8 @@ inline void ClearParserResp::SharedCtor(
   };
 }
 
-ClearParserResp::~ClearParserResp() {
-  // @@protoc_insertion_point(destructor:rp4.ClearParserResp)
+ClearRelationExpResp::~ClearRelationExpResp() {
+  // @@protoc_insertion_point(destructor:rp4.ClearRelationExpResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4279,16 +9773,16 @@ ClearParserResp::~ClearParserResp() {
   SharedDtor();
 }
 
-inline void ClearParserResp::SharedDtor() {
+inline void ClearRelationExpResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void ClearParserResp::SetCachedSize(int size) const {
+void ClearRelationExpResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ClearParserResp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.ClearParserResp)
+void ClearRelationExpResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ClearRelationExpResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -4297,7 +9791,7 @@ void ClearParserResp::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ClearParserResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ClearRelationExpResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -4335,9 +9829,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ClearParserResp::_InternalSerialize(
+uint8_t* ClearRelationExpResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.ClearParserResp)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ClearRelationExpResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -4352,12 +9846,12 @@ uint8_t* ClearParserResp::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.ClearParserResp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ClearRelationExpResp)
   return target;
 }
 
-size_t ClearParserResp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.ClearParserResp)
+size_t ClearRelationExpResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ClearRelationExpResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -4373,17 +9867,17 @@ size_t ClearParserResp::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClearParserResp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClearRelationExpResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ClearParserResp::MergeImpl
+    ClearRelationExpResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearParserResp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearRelationExpResp::GetClassData() const { return &_class_data_; }
 
 
-void ClearParserResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ClearParserResp*>(&to_msg);
-  auto& from = static_cast<const ClearParserResp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ClearParserResp)
+void ClearRelationExpResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClearRelationExpResp*>(&to_msg);
+  auto& from = static_cast<const ClearRelationExpResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ClearRelationExpResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -4394,79 +9888,65 @@ void ClearParserResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ClearParserResp::CopyFrom(const ClearParserResp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ClearParserResp)
+void ClearRelationExpResp::CopyFrom(const ClearRelationExpResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ClearRelationExpResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ClearParserResp::IsInitialized() const {
+bool ClearRelationExpResp::IsInitialized() const {
   return true;
 }
 
-void ClearParserResp::InternalSwap(ClearParserResp* other) {
+void ClearRelationExpResp::InternalSwap(ClearRelationExpResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ClearParserResp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ClearRelationExpResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[10]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[29]);
 }
 
 // ===================================================================
 
-class Data::_Internal {
+class ClearResMapReq::_Internal {
  public:
 };
 
-Data::Data(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ClearResMapReq::ClearResMapReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.Data)
+  // @@protoc_insertion_point(arena_constructor:rp4.ClearResMapReq)
 }
-Data::Data(const Data& from)
+ClearResMapReq::ClearResMapReq(const ClearResMapReq& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  Data* const _this = this; (void)_this;
+  ClearResMapReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.val_){}
-    , decltype(_impl_.len_){}
+      decltype(_impl_.procid_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.val_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.val_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_val().empty()) {
-    _this->_impl_.val_.Set(from._internal_val(), 
-      _this->GetArenaForAllocation());
-  }
-  _this->_impl_.len_ = from._impl_.len_;
-  // @@protoc_insertion_point(copy_constructor:rp4.Data)
+  _this->_impl_.procid_ = from._impl_.procid_;
+  // @@protoc_insertion_point(copy_constructor:rp4.ClearResMapReq)
 }
 
-inline void Data::SharedCtor(
+inline void ClearResMapReq::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.val_){}
-    , decltype(_impl_.len_){0}
+      decltype(_impl_.procid_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.val_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.val_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-Data::~Data() {
-  // @@protoc_insertion_point(destructor:rp4.Data)
+ClearResMapReq::~ClearResMapReq() {
+  // @@protoc_insertion_point(destructor:rp4.ClearResMapReq)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4474,45 +9954,34 @@ Data::~Data() {
   SharedDtor();
 }
 
-inline void Data::SharedDtor() {
+inline void ClearResMapReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.val_.Destroy();
 }
 
-void Data::SetCachedSize(int size) const {
+void ClearResMapReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void Data::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.Data)
+void ClearResMapReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ClearResMapReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.val_.ClearToEmpty();
-  _impl_.len_ = 0;
+  _impl_.procid_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Data::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ClearResMapReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 len = 1;
+      // int32 procId = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // bytes val = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_val();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -4540,148 +10009,122 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Data::_InternalSerialize(
+uint8_t* ClearResMapReq::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.Data)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ClearResMapReq)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 len = 1;
-  if (this->_internal_len() != 0) {
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_len(), target);
-  }
-
-  // bytes val = 2;
-  if (!this->_internal_val().empty()) {
-    target = stream->WriteBytesMaybeAliased(
-        2, this->_internal_val(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.Data)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ClearResMapReq)
   return target;
 }
 
-size_t Data::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.Data)
+size_t ClearResMapReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ClearResMapReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // bytes val = 2;
-  if (!this->_internal_val().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_val());
-  }
-
-  // int32 len = 1;
-  if (this->_internal_len() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_len());
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Data::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClearResMapReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    Data::MergeImpl
+    ClearResMapReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Data::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearResMapReq::GetClassData() const { return &_class_data_; }
 
 
-void Data::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<Data*>(&to_msg);
-  auto& from = static_cast<const Data&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.Data)
+void ClearResMapReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClearResMapReq*>(&to_msg);
+  auto& from = static_cast<const ClearResMapReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ClearResMapReq)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_val().empty()) {
-    _this->_internal_set_val(from._internal_val());
-  }
-  if (from._internal_len() != 0) {
-    _this->_internal_set_len(from._internal_len());
+  if (from._internal_procid() != 0) {
+    _this->_internal_set_procid(from._internal_procid());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Data::CopyFrom(const Data& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.Data)
+void ClearResMapReq::CopyFrom(const ClearResMapReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ClearResMapReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Data::IsInitialized() const {
+bool ClearResMapReq::IsInitialized() const {
   return true;
 }
 
-void Data::InternalSwap(Data* other) {
+void ClearResMapReq::InternalSwap(ClearResMapReq* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.val_, lhs_arena,
-      &other->_impl_.val_, rhs_arena
-  );
-  swap(_impl_.len_, other->_impl_.len_);
+  swap(_impl_.procid_, other->_impl_.procid_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Data::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ClearResMapReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[11]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[30]);
 }
 
 // ===================================================================
 
-class GateEntry::_Internal {
+class ClearResMapResp::_Internal {
  public:
 };
 
-GateEntry::GateEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ClearResMapResp::ClearResMapResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.GateEntry)
+  // @@protoc_insertion_point(arena_constructor:rp4.ClearResMapResp)
 }
-GateEntry::GateEntry(const GateEntry& from)
+ClearResMapResp::ClearResMapResp(const ClearResMapResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  GateEntry* const _this = this; (void)_this;
+  ClearResMapResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.type_){}
-    , decltype(_impl_.val_){}
+      decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.type_, &from._impl_.type_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.val_) -
-    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.val_));
-  // @@protoc_insertion_point(copy_constructor:rp4.GateEntry)
+  _this->_impl_.res_ = from._impl_.res_;
+  // @@protoc_insertion_point(copy_constructor:rp4.ClearResMapResp)
 }
 
-inline void GateEntry::SharedCtor(
+inline void ClearResMapResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.type_){0}
-    , decltype(_impl_.val_){0}
+      decltype(_impl_.res_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-GateEntry::~GateEntry() {
-  // @@protoc_insertion_point(destructor:rp4.GateEntry)
+ClearResMapResp::~ClearResMapResp() {
+  // @@protoc_insertion_point(destructor:rp4.ClearResMapResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4689,46 +10132,36 @@ GateEntry::~GateEntry() {
   SharedDtor();
 }
 
-inline void GateEntry::SharedDtor() {
+inline void ClearResMapResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void GateEntry::SetCachedSize(int size) const {
+void ClearResMapResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void GateEntry::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.GateEntry)
+void ClearResMapResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ClearResMapResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.type_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.val_) -
-      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.val_));
+  _impl_.res_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GateEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ClearResMapResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .rp4.GateEntryType type = 1;
+      // .rp4.Res res = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
           uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          _internal_set_type(static_cast<::rp4::GateEntryType>(val));
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 val = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.val_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
+          _internal_set_res(static_cast<::rp4::Res>(val));
         } else
           goto handle_unusual;
         continue;
@@ -4755,153 +10188,138 @@ failure:
 #undef CHK_
 }
 
-uint8_t* GateEntry::_InternalSerialize(
+uint8_t* ClearResMapResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.GateEntry)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ClearResMapResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .rp4.GateEntryType type = 1;
-  if (this->_internal_type() != 0) {
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_type(), target);
-  }
-
-  // int32 val = 2;
-  if (this->_internal_val() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_val(), target);
+      1, this->_internal_res(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.GateEntry)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ClearResMapResp)
   return target;
 }
 
-size_t GateEntry::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.GateEntry)
+size_t ClearResMapResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ClearResMapResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .rp4.GateEntryType type = 1;
-  if (this->_internal_type() != 0) {
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
     total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
-  }
-
-  // int32 val = 2;
-  if (this->_internal_val() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_val());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GateEntry::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClearResMapResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    GateEntry::MergeImpl
+    ClearResMapResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GateEntry::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearResMapResp::GetClassData() const { return &_class_data_; }
 
 
-void GateEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<GateEntry*>(&to_msg);
-  auto& from = static_cast<const GateEntry&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.GateEntry)
+void ClearResMapResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClearResMapResp*>(&to_msg);
+  auto& from = static_cast<const ClearResMapResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ClearResMapResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_type() != 0) {
-    _this->_internal_set_type(from._internal_type());
-  }
-  if (from._internal_val() != 0) {
-    _this->_internal_set_val(from._internal_val());
+  if (from._internal_res() != 0) {
+    _this->_internal_set_res(from._internal_res());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-
-void GateEntry::CopyFrom(const GateEntry& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.GateEntry)
+
+void ClearResMapResp::CopyFrom(const ClearResMapResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ClearResMapResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GateEntry::IsInitialized() const {
+bool ClearResMapResp::IsInitialized() const {
   return true;
 }
 
-void GateEntry::InternalSwap(GateEntry* other) {
+void ClearResMapResp::InternalSwap(ClearResMapResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GateEntry, _impl_.val_)
-      + sizeof(GateEntry::_impl_.val_)
-      - PROTOBUF_FIELD_OFFSET(GateEntry, _impl_.type_)>(
-          reinterpret_cast<char*>(&_impl_.type_),
-          reinterpret_cast<char*>(&other->_impl_.type_));
+  swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GateEntry::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ClearResMapResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[12]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[31]);
 }
 
 // ===================================================================
 
-class SetDefaultGateEntryReq::_Internal {
+class ModResMapReq::_Internal {
  public:
-  static const ::rp4::GateEntry& default_entry(const SetDefaultGateEntryReq* msg);
+  static const ::rp4::GateEntry& entry(const ModResMapReq* msg);
 };
 
 const ::rp4::GateEntry&
-SetDefaultGateEntryReq::_Internal::default_entry(const SetDefaultGateEntryReq* msg) {
-  return *msg->_impl_.default_entry_;
+ModResMapReq::_Internal::entry(const ModResMapReq* msg) {
+  return *msg->_impl_.entry_;
 }
-SetDefaultGateEntryReq::SetDefaultGateEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ModResMapReq::ModResMapReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.SetDefaultGateEntryReq)
+  // @@protoc_insertion_point(arena_constructor:rp4.ModResMapReq)
 }
-SetDefaultGateEntryReq::SetDefaultGateEntryReq(const SetDefaultGateEntryReq& from)
+ModResMapReq::ModResMapReq(const ModResMapReq& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetDefaultGateEntryReq* const _this = this; (void)_this;
+  ModResMapReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.default_entry_){nullptr}
-    , decltype(_impl_.proc_id_){}
+      decltype(_impl_.entry_){nullptr}
+    , decltype(_impl_.procid_){}
+    , decltype(_impl_.key_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_default_entry()) {
-    _this->_impl_.default_entry_ = new ::rp4::GateEntry(*from._impl_.default_entry_);
+  if (from._internal_has_entry()) {
+    _this->_impl_.entry_ = new ::rp4::GateEntry(*from._impl_.entry_);
   }
-  _this->_impl_.proc_id_ = from._impl_.proc_id_;
-  // @@protoc_insertion_point(copy_constructor:rp4.SetDefaultGateEntryReq)
+  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.key_) -
+    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.key_));
+  // @@protoc_insertion_point(copy_constructor:rp4.ModResMapReq)
 }
 
-inline void SetDefaultGateEntryReq::SharedCtor(
+inline void ModResMapReq::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.default_entry_){nullptr}
-    , decltype(_impl_.proc_id_){0}
+      decltype(_impl_.entry_){nullptr}
+    , decltype(_impl_.procid_){0}
+    , decltype(_impl_.key_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-SetDefaultGateEntryReq::~SetDefaultGateEntryReq() {
-  // @@protoc_insertion_point(destructor:rp4.SetDefaultGateEntryReq)
+ModResMapReq::~ModResMapReq() {
+  // @@protoc_insertion_point(destructor:rp4.ModResMapReq)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4909,47 +10327,57 @@ SetDefaultGateEntryReq::~SetDefaultGateEntryReq() {
   SharedDtor();
 }
 
-inline void SetDefaultGateEntryReq::SharedDtor() {
+inline void ModResMapReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.default_entry_;
+  if (this != internal_default_instance()) delete _impl_.entry_;
 }
 
-void SetDefaultGateEntryReq::SetCachedSize(int size) const {
+void ModResMapReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetDefaultGateEntryReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.SetDefaultGateEntryReq)
+void ModResMapReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ModResMapReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.default_entry_ != nullptr) {
-    delete _impl_.default_entry_;
+  if (GetArenaForAllocation() == nullptr && _impl_.entry_ != nullptr) {
+    delete _impl_.entry_;
   }
-  _impl_.default_entry_ = nullptr;
-  _impl_.proc_id_ = 0;
+  _impl_.entry_ = nullptr;
+  ::memset(&_impl_.procid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.key_) -
+      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.key_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetDefaultGateEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ModResMapReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 proc_id = 1;
+      // int32 procId = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.proc_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // .rp4.GateEntry default_entry = 2;
+      // int32 key = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_default_entry(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.key_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.GateEntry entry = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_entry(), ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -4977,134 +10405,148 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetDefaultGateEntryReq::_InternalSerialize(
+uint8_t* ModResMapReq::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetDefaultGateEntryReq)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ModResMapReq)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 proc_id = 1;
-  if (this->_internal_proc_id() != 0) {
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_proc_id(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
   }
 
-  // .rp4.GateEntry default_entry = 2;
-  if (this->_internal_has_default_entry()) {
+  // int32 key = 2;
+  if (this->_internal_key() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_key(), target);
+  }
+
+  // .rp4.GateEntry entry = 3;
+  if (this->_internal_has_entry()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::default_entry(this),
-        _Internal::default_entry(this).GetCachedSize(), target, stream);
+      InternalWriteMessage(3, _Internal::entry(this),
+        _Internal::entry(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetDefaultGateEntryReq)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ModResMapReq)
   return target;
 }
 
-size_t SetDefaultGateEntryReq::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.SetDefaultGateEntryReq)
+size_t ModResMapReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ModResMapReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .rp4.GateEntry default_entry = 2;
-  if (this->_internal_has_default_entry()) {
+  // .rp4.GateEntry entry = 3;
+  if (this->_internal_has_entry()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.default_entry_);
+        *_impl_.entry_);
   }
 
-  // int32 proc_id = 1;
-  if (this->_internal_proc_id() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_proc_id());
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
+  }
+
+  // int32 key = 2;
+  if (this->_internal_key() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_key());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetDefaultGateEntryReq::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModResMapReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetDefaultGateEntryReq::MergeImpl
+    ModResMapReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetDefaultGateEntryReq::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModResMapReq::GetClassData() const { return &_class_data_; }
 
 
-void SetDefaultGateEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetDefaultGateEntryReq*>(&to_msg);
-  auto& from = static_cast<const SetDefaultGateEntryReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetDefaultGateEntryReq)
+void ModResMapReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ModResMapReq*>(&to_msg);
+  auto& from = static_cast<const ModResMapReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ModResMapReq)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_default_entry()) {
-    _this->_internal_mutable_default_entry()->::rp4::GateEntry::MergeFrom(
-        from._internal_default_entry());
+  if (from._internal_has_entry()) {
+    _this->_internal_mutable_entry()->::rp4::GateEntry::MergeFrom(
+        from._internal_entry());
   }
-  if (from._internal_proc_id() != 0) {
-    _this->_internal_set_proc_id(from._internal_proc_id());
+  if (from._internal_procid() != 0) {
+    _this->_internal_set_procid(from._internal_procid());
+  }
+  if (from._internal_key() != 0) {
+    _this->_internal_set_key(from._internal_key());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetDefaultGateEntryReq::CopyFrom(const SetDefaultGateEntryReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetDefaultGateEntryReq)
+void ModResMapReq::CopyFrom(const ModResMapReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ModResMapReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetDefaultGateEntryReq::IsInitialized() const {
+bool ModResMapReq::IsInitialized() const {
   return true;
 }
 
-void SetDefaultGateEntryReq::InternalSwap(SetDefaultGateEntryReq* other) {
+void ModResMapReq::InternalSwap(ModResMapReq* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SetDefaultGateEntryReq, _impl_.proc_id_)
-      + sizeof(SetDefaultGateEntryReq::_impl_.proc_id_)
-      - PROTOBUF_FIELD_OFFSET(SetDefaultGateEntryReq, _impl_.default_entry_)>(
-          reinterpret_cast<char*>(&_impl_.default_entry_),
-          reinterpret_cast<char*>(&other->_impl_.default_entry_));
+      PROTOBUF_FIELD_OFFSET(ModResMapReq, _impl_.key_)
+      + sizeof(ModResMapReq::_impl_.key_)
+      - PROTOBUF_FIELD_OFFSET(ModResMapReq, _impl_.entry_)>(
+          reinterpret_cast<char*>(&_impl_.entry_),
+          reinterpret_cast<char*>(&other->_impl_.entry_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetDefaultGateEntryReq::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ModResMapReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[13]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[32]);
 }
 
 // ===================================================================
 
-class SetDefaultGateEntryResp::_Internal {
+class ModResMapResp::_Internal {
  public:
 };
 
-SetDefaultGateEntryResp::SetDefaultGateEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ModResMapResp::ModResMapResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.SetDefaultGateEntryResp)
+  // @@protoc_insertion_point(arena_constructor:rp4.ModResMapResp)
 }
-SetDefaultGateEntryResp::SetDefaultGateEntryResp(const SetDefaultGateEntryResp& from)
+ModResMapResp::ModResMapResp(const ModResMapResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetDefaultGateEntryResp* const _this = this; (void)_this;
+  ModResMapResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.res_ = from._impl_.res_;
-  // @@protoc_insertion_point(copy_constructor:rp4.SetDefaultGateEntryResp)
+  // @@protoc_insertion_point(copy_constructor:rp4.ModResMapResp)
 }
 
-inline void SetDefaultGateEntryResp::SharedCtor(
+inline void ModResMapResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -5114,8 +10556,8 @@ inline void SetDefaultGateEntryResp::SharedCtor(
   };
 }
 
-SetDefaultGateEntryResp::~SetDefaultGateEntryResp() {
-  // @@protoc_insertion_point(destructor:rp4.SetDefaultGateEntryResp)
+ModResMapResp::~ModResMapResp() {
+  // @@protoc_insertion_point(destructor:rp4.ModResMapResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -5123,16 +10565,16 @@ SetDefaultGateEntryResp::~SetDefaultGateEntryResp() {
   SharedDtor();
 }
 
-inline void SetDefaultGateEntryResp::SharedDtor() {
+inline void ModResMapResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void SetDefaultGateEntryResp::SetCachedSize(int size) const {
+void ModResMapResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetDefaultGateEntryResp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.SetDefaultGateEntryResp)
+void ModResMapResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ModResMapResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -5141,7 +10583,7 @@ void SetDefaultGateEntryResp::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetDefaultGateEntryResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ModResMapResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -5179,9 +10621,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetDefaultGateEntryResp::_InternalSerialize(
+uint8_t* ModResMapResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetDefaultGateEntryResp)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ModResMapResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -5196,12 +10638,12 @@ uint8_t* SetDefaultGateEntryResp::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetDefaultGateEntryResp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ModResMapResp)
   return target;
 }
 
-size_t SetDefaultGateEntryResp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.SetDefaultGateEntryResp)
+size_t ModResMapResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ModResMapResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -5217,17 +10659,17 @@ size_t SetDefaultGateEntryResp::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetDefaultGateEntryResp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModResMapResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetDefaultGateEntryResp::MergeImpl
+    ModResMapResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetDefaultGateEntryResp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModResMapResp::GetClassData() const { return &_class_data_; }
 
 
-void SetDefaultGateEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetDefaultGateEntryResp*>(&to_msg);
-  auto& from = static_cast<const SetDefaultGateEntryResp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetDefaultGateEntryResp)
+void ModResMapResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ModResMapResp*>(&to_msg);
+  auto& from = static_cast<const ModResMapResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ModResMapResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -5238,126 +10680,71 @@ void SetDefaultGateEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetDefaultGateEntryResp::CopyFrom(const SetDefaultGateEntryResp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetDefaultGateEntryResp)
+void ModResMapResp::CopyFrom(const ModResMapResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ModResMapResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetDefaultGateEntryResp::IsInitialized() const {
+bool ModResMapResp::IsInitialized() const {
   return true;
 }
 
-void SetDefaultGateEntryResp::InternalSwap(SetDefaultGateEntryResp* other) {
+void ModResMapResp::InternalSwap(ModResMapResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetDefaultGateEntryResp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ModResMapResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[14]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[33]);
 }
 
 // ===================================================================
 
-class GatewayParam::_Internal {
+class SetNoTableReq::_Internal {
  public:
-  static const ::rp4::FieldInfo& field(const GatewayParam* msg);
-  static const ::rp4::Data& data(const GatewayParam* msg);
 };
 
-const ::rp4::FieldInfo&
-GatewayParam::_Internal::field(const GatewayParam* msg) {
-  return *msg->_impl_.value_.field_;
-}
-const ::rp4::Data&
-GatewayParam::_Internal::data(const GatewayParam* msg) {
-  return *msg->_impl_.value_.data_;
-}
-void GatewayParam::set_allocated_field(::rp4::FieldInfo* field) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  clear_value();
-  if (field) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(field);
-    if (message_arena != submessage_arena) {
-      field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, field, submessage_arena);
-    }
-    set_has_field();
-    _impl_.value_.field_ = field;
-  }
-  // @@protoc_insertion_point(field_set_allocated:rp4.GatewayParam.field)
-}
-void GatewayParam::set_allocated_data(::rp4::Data* data) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  clear_value();
-  if (data) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(data);
-    if (message_arena != submessage_arena) {
-      data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, data, submessage_arena);
-    }
-    set_has_data();
-    _impl_.value_.data_ = data;
-  }
-  // @@protoc_insertion_point(field_set_allocated:rp4.GatewayParam.data)
-}
-GatewayParam::GatewayParam(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SetNoTableReq::SetNoTableReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.GatewayParam)
+  // @@protoc_insertion_point(arena_constructor:rp4.SetNoTableReq)
 }
-GatewayParam::GatewayParam(const GatewayParam& from)
+SetNoTableReq::SetNoTableReq(const SetNoTableReq& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  GatewayParam* const _this = this; (void)_this;
+  SetNoTableReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.paramtype_){}
-    , decltype(_impl_.value_){}
-    , /*decltype(_impl_._cached_size_)*/{}
-    , /*decltype(_impl_._oneof_case_)*/{}};
+      decltype(_impl_.procid_){}
+    , decltype(_impl_.matcherid_){}
+    , decltype(_impl_.notable_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.paramtype_ = from._impl_.paramtype_;
-  clear_has_value();
-  switch (from.value_case()) {
-    case kField: {
-      _this->_internal_mutable_field()->::rp4::FieldInfo::MergeFrom(
-          from._internal_field());
-      break;
-    }
-    case kData: {
-      _this->_internal_mutable_data()->::rp4::Data::MergeFrom(
-          from._internal_data());
-      break;
-    }
-    case VALUE_NOT_SET: {
-      break;
-    }
-  }
-  // @@protoc_insertion_point(copy_constructor:rp4.GatewayParam)
+  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.notable_) -
+    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.notable_));
+  // @@protoc_insertion_point(copy_constructor:rp4.SetNoTableReq)
 }
 
-inline void GatewayParam::SharedCtor(
+inline void SetNoTableReq::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.paramtype_){0}
-    , decltype(_impl_.value_){}
+      decltype(_impl_.procid_){0}
+    , decltype(_impl_.matcherid_){0}
+    , decltype(_impl_.notable_){false}
     , /*decltype(_impl_._cached_size_)*/{}
-    , /*decltype(_impl_._oneof_case_)*/{}
   };
-  clear_has_value();
 }
 
-GatewayParam::~GatewayParam() {
-  // @@protoc_insertion_point(destructor:rp4.GatewayParam)
+SetNoTableReq::~SetNoTableReq() {
+  // @@protoc_insertion_point(destructor:rp4.SetNoTableReq)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -5365,78 +10752,52 @@ GatewayParam::~GatewayParam() {
   SharedDtor();
 }
 
-inline void GatewayParam::SharedDtor() {
+inline void SetNoTableReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (has_value()) {
-    clear_value();
-  }
 }
 
-void GatewayParam::SetCachedSize(int size) const {
+void SetNoTableReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void GatewayParam::clear_value() {
-// @@protoc_insertion_point(one_of_clear_start:rp4.GatewayParam)
-  switch (value_case()) {
-    case kField: {
-      if (GetArenaForAllocation() == nullptr) {
-        delete _impl_.value_.field_;
-      }
-      break;
-    }
-    case kData: {
-      if (GetArenaForAllocation() == nullptr) {
-        delete _impl_.value_.data_;
-      }
-      break;
-    }
-    case VALUE_NOT_SET: {
-      break;
-    }
-  }
-  _impl_._oneof_case_[0] = VALUE_NOT_SET;
-}
-
-
-void GatewayParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.GatewayParam)
+void SetNoTableReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.SetNoTableReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.paramtype_ = 0;
-  clear_value();
+  ::memset(&_impl_.procid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.notable_) -
+      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.notable_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GatewayParam::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SetNoTableReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .rp4.ParameterType paramType = 1;
+      // int32 procId = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          _internal_set_paramtype(static_cast<::rp4::ParameterType>(val));
         } else
           goto handle_unusual;
         continue;
-      // .rp4.FieldInfo field = 2;
+      // int32 matcherId = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_field(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.matcherid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // .rp4.Data data = 3;
+      // bool noTable = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_data(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.notable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -5464,194 +10825,155 @@ failure:
 #undef CHK_
 }
 
-uint8_t* GatewayParam::_InternalSerialize(
+uint8_t* SetNoTableReq::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.GatewayParam)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetNoTableReq)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .rp4.ParameterType paramType = 1;
-  if (this->_internal_paramtype() != 0) {
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_paramtype(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
   }
 
-  // .rp4.FieldInfo field = 2;
-  if (_internal_has_field()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::field(this),
-        _Internal::field(this).GetCachedSize(), target, stream);
+  // int32 matcherId = 2;
+  if (this->_internal_matcherid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_matcherid(), target);
   }
 
-  // .rp4.Data data = 3;
-  if (_internal_has_data()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(3, _Internal::data(this),
-        _Internal::data(this).GetCachedSize(), target, stream);
+  // bool noTable = 3;
+  if (this->_internal_notable() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_notable(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.GatewayParam)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetNoTableReq)
   return target;
 }
 
-size_t GatewayParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.GatewayParam)
+size_t SetNoTableReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.SetNoTableReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .rp4.ParameterType paramType = 1;
-  if (this->_internal_paramtype() != 0) {
-    total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_paramtype());
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
   }
 
-  switch (value_case()) {
-    // .rp4.FieldInfo field = 2;
-    case kField: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *_impl_.value_.field_);
-      break;
-    }
-    // .rp4.Data data = 3;
-    case kData: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *_impl_.value_.data_);
-      break;
-    }
-    case VALUE_NOT_SET: {
-      break;
-    }
+  // int32 matcherId = 2;
+  if (this->_internal_matcherid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_matcherid());
+  }
+
+  // bool noTable = 3;
+  if (this->_internal_notable() != 0) {
+    total_size += 1 + 1;
   }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GatewayParam::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetNoTableReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    GatewayParam::MergeImpl
+    SetNoTableReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GatewayParam::GetClassData() const { return &_class_data_; }
-
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetNoTableReq::GetClassData() const { return &_class_data_; }
 
-void GatewayParam::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<GatewayParam*>(&to_msg);
-  auto& from = static_cast<const GatewayParam&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.GatewayParam)
-  GOOGLE_DCHECK_NE(&from, _this);
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from._internal_paramtype() != 0) {
-    _this->_internal_set_paramtype(from._internal_paramtype());
-  }
-  switch (from.value_case()) {
-    case kField: {
-      _this->_internal_mutable_field()->::rp4::FieldInfo::MergeFrom(
-          from._internal_field());
-      break;
-    }
-    case kData: {
-      _this->_internal_mutable_data()->::rp4::Data::MergeFrom(
-          from._internal_data());
-      break;
-    }
-    case VALUE_NOT_SET: {
-      break;
-    }
+void SetNoTableReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetNoTableReq*>(&to_msg);
+  auto& from = static_cast<const SetNoTableReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetNoTableReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_procid() != 0) {
+    _this->_internal_set_procid(from._internal_procid());
+  }
+  if (from._internal_matcherid() != 0) {
+    _this->_internal_set_matcherid(from._internal_matcherid());
+  }
+  if (from._internal_notable() != 0) {
+    _this->_internal_set_notable(from._internal_notable());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void GatewayParam::CopyFrom(const GatewayParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.GatewayParam)
+void SetNoTableReq::CopyFrom(const SetNoTableReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetNoTableReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GatewayParam::IsInitialized() const {
+bool SetNoTableReq::IsInitialized() const {
   return true;
 }
 
-void GatewayParam::InternalSwap(GatewayParam* other) {
+void SetNoTableReq::InternalSwap(SetNoTableReq* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.paramtype_, other->_impl_.paramtype_);
-  swap(_impl_.value_, other->_impl_.value_);
-  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetNoTableReq, _impl_.notable_)
+      + sizeof(SetNoTableReq::_impl_.notable_)
+      - PROTOBUF_FIELD_OFFSET(SetNoTableReq, _impl_.procid_)>(
+          reinterpret_cast<char*>(&_impl_.procid_),
+          reinterpret_cast<char*>(&other->_impl_.procid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GatewayParam::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SetNoTableReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[15]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[34]);
 }
 
 // ===================================================================
 
-class RelationExp::_Internal {
+class SetNoTableResp::_Internal {
  public:
-  static const ::rp4::GatewayParam& param1(const RelationExp* msg);
-  static const ::rp4::GatewayParam& param2(const RelationExp* msg);
 };
 
-const ::rp4::GatewayParam&
-RelationExp::_Internal::param1(const RelationExp* msg) {
-  return *msg->_impl_.param1_;
-}
-const ::rp4::GatewayParam&
-RelationExp::_Internal::param2(const RelationExp* msg) {
-  return *msg->_impl_.param2_;
-}
-RelationExp::RelationExp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SetNoTableResp::SetNoTableResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.RelationExp)
+  // @@protoc_insertion_point(arena_constructor:rp4.SetNoTableResp)
 }
-RelationExp::RelationExp(const RelationExp& from)
+SetNoTableResp::SetNoTableResp(const SetNoTableResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  RelationExp* const _this = this; (void)_this;
+  SetNoTableResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.param1_){nullptr}
-    , decltype(_impl_.param2_){nullptr}
-    , decltype(_impl_.relation_){}
+      decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_param1()) {
-    _this->_impl_.param1_ = new ::rp4::GatewayParam(*from._impl_.param1_);
-  }
-  if (from._internal_has_param2()) {
-    _this->_impl_.param2_ = new ::rp4::GatewayParam(*from._impl_.param2_);
-  }
-  _this->_impl_.relation_ = from._impl_.relation_;
-  // @@protoc_insertion_point(copy_constructor:rp4.RelationExp)
+  _this->_impl_.res_ = from._impl_.res_;
+  // @@protoc_insertion_point(copy_constructor:rp4.SetNoTableResp)
 }
 
-inline void RelationExp::SharedCtor(
+inline void SetNoTableResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.param1_){nullptr}
-    , decltype(_impl_.param2_){nullptr}
-    , decltype(_impl_.relation_){0}
+      decltype(_impl_.res_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-RelationExp::~RelationExp() {
-  // @@protoc_insertion_point(destructor:rp4.RelationExp)
+SetNoTableResp::~SetNoTableResp() {
+  // @@protoc_insertion_point(destructor:rp4.SetNoTableResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -5659,62 +10981,36 @@ RelationExp::~RelationExp() {
   SharedDtor();
 }
 
-inline void RelationExp::SharedDtor() {
+inline void SetNoTableResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.param1_;
-  if (this != internal_default_instance()) delete _impl_.param2_;
 }
 
-void RelationExp::SetCachedSize(int size) const {
+void SetNoTableResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void RelationExp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.RelationExp)
+void SetNoTableResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.SetNoTableResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.param1_ != nullptr) {
-    delete _impl_.param1_;
-  }
-  _impl_.param1_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && _impl_.param2_ != nullptr) {
-    delete _impl_.param2_;
-  }
-  _impl_.param2_ = nullptr;
-  _impl_.relation_ = 0;
+  _impl_.res_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RelationExp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SetNoTableResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .rp4.GatewayParam param1 = 1;
+      // .rp4.Res res = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_param1(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .rp4.GatewayParam param2 = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_param2(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .rp4.RelationCode relation = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
           uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          _internal_set_relation(static_cast<::rp4::RelationCode>(val));
+          _internal_set_res(static_cast<::rp4::Res>(val));
         } else
           goto handle_unusual;
         continue;
@@ -5741,189 +11037,128 @@ failure:
 #undef CHK_
 }
 
-uint8_t* RelationExp::_InternalSerialize(
+uint8_t* SetNoTableResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.RelationExp)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetNoTableResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .rp4.GatewayParam param1 = 1;
-  if (this->_internal_has_param1()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::param1(this),
-        _Internal::param1(this).GetCachedSize(), target, stream);
-  }
-
-  // .rp4.GatewayParam param2 = 2;
-  if (this->_internal_has_param2()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::param2(this),
-        _Internal::param2(this).GetCachedSize(), target, stream);
-  }
-
-  // .rp4.RelationCode relation = 3;
-  if (this->_internal_relation() != 0) {
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      3, this->_internal_relation(), target);
+      1, this->_internal_res(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.RelationExp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetNoTableResp)
   return target;
 }
 
-size_t RelationExp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.RelationExp)
+size_t SetNoTableResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.SetNoTableResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .rp4.GatewayParam param1 = 1;
-  if (this->_internal_has_param1()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.param1_);
-  }
-
-  // .rp4.GatewayParam param2 = 2;
-  if (this->_internal_has_param2()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.param2_);
-  }
-
-  // .rp4.RelationCode relation = 3;
-  if (this->_internal_relation() != 0) {
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
     total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_relation());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RelationExp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetNoTableResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    RelationExp::MergeImpl
+    SetNoTableResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RelationExp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetNoTableResp::GetClassData() const { return &_class_data_; }
 
 
-void RelationExp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<RelationExp*>(&to_msg);
-  auto& from = static_cast<const RelationExp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.RelationExp)
+void SetNoTableResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetNoTableResp*>(&to_msg);
+  auto& from = static_cast<const SetNoTableResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetNoTableResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_param1()) {
-    _this->_internal_mutable_param1()->::rp4::GatewayParam::MergeFrom(
-        from._internal_param1());
-  }
-  if (from._internal_has_param2()) {
-    _this->_internal_mutable_param2()->::rp4::GatewayParam::MergeFrom(
-        from._internal_param2());
-  }
-  if (from._internal_relation() != 0) {
-    _this->_internal_set_relation(from._internal_relation());
+  if (from._internal_res() != 0) {
+    _this->_internal_set_res(from._internal_res());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RelationExp::CopyFrom(const RelationExp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.RelationExp)
+void SetNoTableResp::CopyFrom(const SetNoTableResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetNoTableResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RelationExp::IsInitialized() const {
+bool SetNoTableResp::IsInitialized() const {
   return true;
 }
 
-void RelationExp::InternalSwap(RelationExp* other) {
+void SetNoTableResp::InternalSwap(SetNoTableResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RelationExp, _impl_.relation_)
-      + sizeof(RelationExp::_impl_.relation_)
-      - PROTOBUF_FIELD_OFFSET(RelationExp, _impl_.param1_)>(
-          reinterpret_cast<char*>(&_impl_.param1_),
-          reinterpret_cast<char*>(&other->_impl_.param1_));
+  swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RelationExp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SetNoTableResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[16]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[35]);
 }
 
 // ===================================================================
 
-class InsertRelationExpReq::_Internal {
+class ActionProc::_Internal {
  public:
-  static const ::rp4::GatewayParam& param1(const InsertRelationExpReq* msg);
-  static const ::rp4::GatewayParam& param2(const InsertRelationExpReq* msg);
 };
 
-const ::rp4::GatewayParam&
-InsertRelationExpReq::_Internal::param1(const InsertRelationExpReq* msg) {
-  return *msg->_impl_.param1_;
-}
-const ::rp4::GatewayParam&
-InsertRelationExpReq::_Internal::param2(const InsertRelationExpReq* msg) {
-  return *msg->_impl_.param2_;
-}
-InsertRelationExpReq::InsertRelationExpReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ActionProc::ActionProc(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.InsertRelationExpReq)
+  // @@protoc_insertion_point(arena_constructor:rp4.ActionProc)
 }
-InsertRelationExpReq::InsertRelationExpReq(const InsertRelationExpReq& from)
+ActionProc::ActionProc(const ActionProc& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  InsertRelationExpReq* const _this = this; (void)_this;
+  ActionProc* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.param1_){nullptr}
-    , decltype(_impl_.param2_){nullptr}
-    , decltype(_impl_.procid_){}
-    , decltype(_impl_.relation_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
-
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_param1()) {
-    _this->_impl_.param1_ = new ::rp4::GatewayParam(*from._impl_.param1_);
-  }
-  if (from._internal_has_param2()) {
-    _this->_impl_.param2_ = new ::rp4::GatewayParam(*from._impl_.param2_);
-  }
-  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.relation_) -
-    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.relation_));
-  // @@protoc_insertion_point(copy_constructor:rp4.InsertRelationExpReq)
+      decltype(_impl_.actionid_){}
+    , decltype(_impl_.procid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.actionid_, &from._impl_.actionid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.procid_) -
+    reinterpret_cast<char*>(&_impl_.actionid_)) + sizeof(_impl_.procid_));
+  // @@protoc_insertion_point(copy_constructor:rp4.ActionProc)
 }
 
-inline void InsertRelationExpReq::SharedCtor(
+inline void ActionProc::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.param1_){nullptr}
-    , decltype(_impl_.param2_){nullptr}
+      decltype(_impl_.actionid_){0}
     , decltype(_impl_.procid_){0}
-    , decltype(_impl_.relation_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-InsertRelationExpReq::~InsertRelationExpReq() {
-  // @@protoc_insertion_point(destructor:rp4.InsertRelationExpReq)
+ActionProc::~ActionProc() {
+  // @@protoc_insertion_point(destructor:rp4.ActionProc)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -5931,72 +11166,45 @@ InsertRelationExpReq::~InsertRelationExpReq() {
   SharedDtor();
 }
 
-inline void InsertRelationExpReq::SharedDtor() {
+inline void ActionProc::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.param1_;
-  if (this != internal_default_instance()) delete _impl_.param2_;
 }
 
-void InsertRelationExpReq::SetCachedSize(int size) const {
+void ActionProc::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void InsertRelationExpReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.InsertRelationExpReq)
+void ActionProc::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ActionProc)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.param1_ != nullptr) {
-    delete _impl_.param1_;
-  }
-  _impl_.param1_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && _impl_.param2_ != nullptr) {
-    delete _impl_.param2_;
-  }
-  _impl_.param2_ = nullptr;
-  ::memset(&_impl_.procid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.relation_) -
-      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.relation_));
+  ::memset(&_impl_.actionid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.procid_) -
+      reinterpret_cast<char*>(&_impl_.actionid_)) + sizeof(_impl_.procid_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* InsertRelationExpReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ActionProc::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 procId = 1;
+      // int32 actionId = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.actionid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // .rp4.GatewayParam param1 = 2;
+      // int32 procId = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_param1(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .rp4.GatewayParam param2 = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_param2(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .rp4.RelationCode relation = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          _internal_set_relation(static_cast<::rp4::RelationCode>(val));
         } else
           goto handle_unusual;
         continue;
@@ -6023,179 +11231,147 @@ failure:
 #undef CHK_
 }
 
-uint8_t* InsertRelationExpReq::_InternalSerialize(
+uint8_t* ActionProc::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.InsertRelationExpReq)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ActionProc)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 procId = 1;
-  if (this->_internal_procid() != 0) {
+  // int32 actionId = 1;
+  if (this->_internal_actionid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
-  }
-
-  // .rp4.GatewayParam param1 = 2;
-  if (this->_internal_has_param1()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::param1(this),
-        _Internal::param1(this).GetCachedSize(), target, stream);
-  }
-
-  // .rp4.GatewayParam param2 = 3;
-  if (this->_internal_has_param2()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(3, _Internal::param2(this),
-        _Internal::param2(this).GetCachedSize(), target, stream);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_actionid(), target);
   }
 
-  // .rp4.RelationCode relation = 4;
-  if (this->_internal_relation() != 0) {
+  // int32 procId = 2;
+  if (this->_internal_procid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      4, this->_internal_relation(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_procid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.InsertRelationExpReq)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ActionProc)
   return target;
 }
 
-size_t InsertRelationExpReq::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.InsertRelationExpReq)
+size_t ActionProc::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ActionProc)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .rp4.GatewayParam param1 = 2;
-  if (this->_internal_has_param1()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.param1_);
-  }
-
-  // .rp4.GatewayParam param2 = 3;
-  if (this->_internal_has_param2()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.param2_);
+  // int32 actionId = 1;
+  if (this->_internal_actionid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_actionid());
   }
 
-  // int32 procId = 1;
+  // int32 procId = 2;
   if (this->_internal_procid() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
   }
 
-  // .rp4.RelationCode relation = 4;
-  if (this->_internal_relation() != 0) {
-    total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_relation());
-  }
-
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertRelationExpReq::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ActionProc::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    InsertRelationExpReq::MergeImpl
+    ActionProc::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertRelationExpReq::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ActionProc::GetClassData() const { return &_class_data_; }
 
 
-void InsertRelationExpReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<InsertRelationExpReq*>(&to_msg);
-  auto& from = static_cast<const InsertRelationExpReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.InsertRelationExpReq)
+void ActionProc::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ActionProc*>(&to_msg);
+  auto& from = static_cast<const ActionProc&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ActionProc)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_param1()) {
-    _this->_internal_mutable_param1()->::rp4::GatewayParam::MergeFrom(
-        from._internal_param1());
-  }
-  if (from._internal_has_param2()) {
-    _this->_internal_mutable_param2()->::rp4::GatewayParam::MergeFrom(
-        from._internal_param2());
+  if (from._internal_actionid() != 0) {
+    _this->_internal_set_actionid(from._internal_actionid());
   }
   if (from._internal_procid() != 0) {
     _this->_internal_set_procid(from._internal_procid());
   }
-  if (from._internal_relation() != 0) {
-    _this->_internal_set_relation(from._internal_relation());
-  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InsertRelationExpReq::CopyFrom(const InsertRelationExpReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.InsertRelationExpReq)
+void ActionProc::CopyFrom(const ActionProc& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ActionProc)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InsertRelationExpReq::IsInitialized() const {
+bool ActionProc::IsInitialized() const {
   return true;
 }
 
-void InsertRelationExpReq::InternalSwap(InsertRelationExpReq* other) {
+void ActionProc::InternalSwap(ActionProc* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(InsertRelationExpReq, _impl_.relation_)
-      + sizeof(InsertRelationExpReq::_impl_.relation_)
-      - PROTOBUF_FIELD_OFFSET(InsertRelationExpReq, _impl_.param1_)>(
-          reinterpret_cast<char*>(&_impl_.param1_),
-          reinterpret_cast<char*>(&other->_impl_.param1_));
+      PROTOBUF_FIELD_OFFSET(ActionProc, _impl_.procid_)
+      + sizeof(ActionProc::_impl_.procid_)
+      - PROTOBUF_FIELD_OFFSET(ActionProc, _impl_.actionid_)>(
+          reinterpret_cast<char*>(&_impl_.actionid_),
+          reinterpret_cast<char*>(&other->_impl_.actionid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata InsertRelationExpReq::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ActionProc::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[17]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[36]);
 }
 
 // ===================================================================
 
-class InsertRelationExpResp::_Internal {
+class SetActionProcReq::_Internal {
  public:
 };
 
-InsertRelationExpResp::InsertRelationExpResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SetActionProcReq::SetActionProcReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.InsertRelationExpResp)
+  // @@protoc_insertion_point(arena_constructor:rp4.SetActionProcReq)
 }
-InsertRelationExpResp::InsertRelationExpResp(const InsertRelationExpResp& from)
+SetActionProcReq::SetActionProcReq(const SetActionProcReq& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  InsertRelationExpResp* const _this = this; (void)_this;
+  SetActionProcReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.res_){}
+      decltype(_impl_.actionprocs_){from._impl_.actionprocs_}
+    , decltype(_impl_.procid_){}
+    , decltype(_impl_.matcherid_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.res_ = from._impl_.res_;
-  // @@protoc_insertion_point(copy_constructor:rp4.InsertRelationExpResp)
+  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.matcherid_) -
+    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.matcherid_));
+  // @@protoc_insertion_point(copy_constructor:rp4.SetActionProcReq)
 }
 
-inline void InsertRelationExpResp::SharedCtor(
+inline void SetActionProcReq::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.res_){0}
+      decltype(_impl_.actionprocs_){arena}
+    , decltype(_impl_.procid_){0}
+    , decltype(_impl_.matcherid_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-InsertRelationExpResp::~InsertRelationExpResp() {
-  // @@protoc_insertion_point(destructor:rp4.InsertRelationExpResp)
+SetActionProcReq::~SetActionProcReq() {
+  // @@protoc_insertion_point(destructor:rp4.SetActionProcReq)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -6203,36 +11379,60 @@ InsertRelationExpResp::~InsertRelationExpResp() {
   SharedDtor();
 }
 
-inline void InsertRelationExpResp::SharedDtor() {
+inline void SetActionProcReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.actionprocs_.~RepeatedPtrField();
 }
 
-void InsertRelationExpResp::SetCachedSize(int size) const {
+void SetActionProcReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void InsertRelationExpResp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.InsertRelationExpResp)
+void SetActionProcReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.SetActionProcReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.res_ = 0;
+  _impl_.actionprocs_.Clear();
+  ::memset(&_impl_.procid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.matcherid_) -
+      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.matcherid_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* InsertRelationExpResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SetActionProcReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .rp4.Res res = 1;
+      // int32 procId = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          _internal_set_res(static_cast<::rp4::Res>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 matcherId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.matcherid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .rp4.ActionProc actionProcs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_actionprocs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -6259,124 +11459,158 @@ failure:
 #undef CHK_
 }
 
-uint8_t* InsertRelationExpResp::_InternalSerialize(
+uint8_t* SetActionProcReq::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.InsertRelationExpResp)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetActionProcReq)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .rp4.Res res = 1;
-  if (this->_internal_res() != 0) {
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_res(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
+  }
+
+  // int32 matcherId = 2;
+  if (this->_internal_matcherid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_matcherid(), target);
+  }
+
+  // repeated .rp4.ActionProc actionProcs = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_actionprocs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_actionprocs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.InsertRelationExpResp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetActionProcReq)
   return target;
 }
 
-size_t InsertRelationExpResp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.InsertRelationExpResp)
+size_t SetActionProcReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.SetActionProcReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .rp4.Res res = 1;
-  if (this->_internal_res() != 0) {
-    total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
+  // repeated .rp4.ActionProc actionProcs = 3;
+  total_size += 1UL * this->_internal_actionprocs_size();
+  for (const auto& msg : this->_impl_.actionprocs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
+  }
+
+  // int32 matcherId = 2;
+  if (this->_internal_matcherid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_matcherid());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertRelationExpResp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetActionProcReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    InsertRelationExpResp::MergeImpl
+    SetActionProcReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertRelationExpResp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetActionProcReq::GetClassData() const { return &_class_data_; }
 
 
-void InsertRelationExpResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<InsertRelationExpResp*>(&to_msg);
-  auto& from = static_cast<const InsertRelationExpResp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.InsertRelationExpResp)
+void SetActionProcReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetActionProcReq*>(&to_msg);
+  auto& from = static_cast<const SetActionProcReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetActionProcReq)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_res() != 0) {
-    _this->_internal_set_res(from._internal_res());
+  _this->_impl_.actionprocs_.MergeFrom(from._impl_.actionprocs_);
+  if (from._internal_procid() != 0) {
+    _this->_internal_set_procid(from._internal_procid());
+  }
+  if (from._internal_matcherid() != 0) {
+    _this->_internal_set_matcherid(from._internal_matcherid());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InsertRelationExpResp::CopyFrom(const InsertRelationExpResp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.InsertRelationExpResp)
+void SetActionProcReq::CopyFrom(const SetActionProcReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetActionProcReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InsertRelationExpResp::IsInitialized() const {
+bool SetActionProcReq::IsInitialized() const {
   return true;
 }
 
-void InsertRelationExpResp::InternalSwap(InsertRelationExpResp* other) {
+void SetActionProcReq::InternalSwap(SetActionProcReq* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.res_, other->_impl_.res_);
+  _impl_.actionprocs_.InternalSwap(&other->_impl_.actionprocs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetActionProcReq, _impl_.matcherid_)
+      + sizeof(SetActionProcReq::_impl_.matcherid_)
+      - PROTOBUF_FIELD_OFFSET(SetActionProcReq, _impl_.procid_)>(
+          reinterpret_cast<char*>(&_impl_.procid_),
+          reinterpret_cast<char*>(&other->_impl_.procid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata InsertRelationExpResp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SetActionProcReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[18]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[37]);
 }
 
 // ===================================================================
 
-class ClearRelationExpReq::_Internal {
+class SetActionProcResp::_Internal {
  public:
 };
 
-ClearRelationExpReq::ClearRelationExpReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SetActionProcResp::SetActionProcResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.ClearRelationExpReq)
+  // @@protoc_insertion_point(arena_constructor:rp4.SetActionProcResp)
 }
-ClearRelationExpReq::ClearRelationExpReq(const ClearRelationExpReq& from)
+SetActionProcResp::SetActionProcResp(const SetActionProcResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ClearRelationExpReq* const _this = this; (void)_this;
+  SetActionProcResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.procid_){}
+      decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.procid_ = from._impl_.procid_;
-  // @@protoc_insertion_point(copy_constructor:rp4.ClearRelationExpReq)
+  _this->_impl_.res_ = from._impl_.res_;
+  // @@protoc_insertion_point(copy_constructor:rp4.SetActionProcResp)
 }
 
-inline void ClearRelationExpReq::SharedCtor(
+inline void SetActionProcResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.procid_){0}
+      decltype(_impl_.res_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-ClearRelationExpReq::~ClearRelationExpReq() {
-  // @@protoc_insertion_point(destructor:rp4.ClearRelationExpReq)
+SetActionProcResp::~SetActionProcResp() {
+  // @@protoc_insertion_point(destructor:rp4.SetActionProcResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -6384,35 +11618,36 @@ ClearRelationExpReq::~ClearRelationExpReq() {
   SharedDtor();
 }
 
-inline void ClearRelationExpReq::SharedDtor() {
+inline void SetActionProcResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void ClearRelationExpReq::SetCachedSize(int size) const {
+void SetActionProcResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ClearRelationExpReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.ClearRelationExpReq)
+void SetActionProcResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.SetActionProcResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.procid_ = 0;
+  _impl_.res_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ClearRelationExpReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SetActionProcResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 procId = 1;
+      // .rp4.Res res = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_res(static_cast<::rp4::Res>(val));
         } else
           goto handle_unusual;
         continue;
@@ -6439,122 +11674,166 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ClearRelationExpReq::_InternalSerialize(
+uint8_t* SetActionProcResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.ClearRelationExpReq)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetActionProcResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 procId = 1;
-  if (this->_internal_procid() != 0) {
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_res(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.ClearRelationExpReq)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetActionProcResp)
   return target;
 }
 
-size_t ClearRelationExpReq::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.ClearRelationExpReq)
+size_t SetActionProcResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.SetActionProcResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 procId = 1;
-  if (this->_internal_procid() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClearRelationExpReq::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetActionProcResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ClearRelationExpReq::MergeImpl
+    SetActionProcResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearRelationExpReq::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetActionProcResp::GetClassData() const { return &_class_data_; }
 
 
-void ClearRelationExpReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ClearRelationExpReq*>(&to_msg);
-  auto& from = static_cast<const ClearRelationExpReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ClearRelationExpReq)
+void SetActionProcResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetActionProcResp*>(&to_msg);
+  auto& from = static_cast<const SetActionProcResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetActionProcResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_procid() != 0) {
-    _this->_internal_set_procid(from._internal_procid());
+  if (from._internal_res() != 0) {
+    _this->_internal_set_res(from._internal_res());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ClearRelationExpReq::CopyFrom(const ClearRelationExpReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ClearRelationExpReq)
+void SetActionProcResp::CopyFrom(const SetActionProcResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetActionProcResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ClearRelationExpReq::IsInitialized() const {
+bool SetActionProcResp::IsInitialized() const {
   return true;
 }
 
-void ClearRelationExpReq::InternalSwap(ClearRelationExpReq* other) {
+void SetActionProcResp::InternalSwap(SetActionProcResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.procid_, other->_impl_.procid_);
+  swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ClearRelationExpReq::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SetActionProcResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[19]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[38]);
 }
 
 // ===================================================================
 
-class ClearRelationExpResp::_Internal {
+class SetMemConfigReq::_Internal {
  public:
 };
 
-ClearRelationExpResp::ClearRelationExpResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SetMemConfigReq::SetMemConfigReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.ClearRelationExpResp)
+  // @@protoc_insertion_point(arena_constructor:rp4.SetMemConfigReq)
 }
-ClearRelationExpResp::ClearRelationExpResp(const ClearRelationExpResp& from)
+SetMemConfigReq::SetMemConfigReq(const SetMemConfigReq& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ClearRelationExpResp* const _this = this; (void)_this;
+  SetMemConfigReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.res_){}
+      decltype(_impl_.keyconfig_){}
+    , decltype(_impl_.valueconfig_){}
+    , decltype(_impl_.procid_){}
+    , decltype(_impl_.matcherid_){}
+    , decltype(_impl_.keywidth_){}
+    , decltype(_impl_.valuewidth_){}
+    , decltype(_impl_.matchtype_){}
+    , decltype(_impl_.depth_){}
+    , decltype(_impl_.missactid_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.res_ = from._impl_.res_;
-  // @@protoc_insertion_point(copy_constructor:rp4.ClearRelationExpResp)
+  _impl_.keyconfig_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.keyconfig_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_keyconfig().empty()) {
+    _this->_impl_.keyconfig_.Set(from._internal_keyconfig(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.valueconfig_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.valueconfig_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_valueconfig().empty()) {
+    _this->_impl_.valueconfig_.Set(from._internal_valueconfig(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.missactid_) -
+    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.missactid_));
+  // @@protoc_insertion_point(copy_constructor:rp4.SetMemConfigReq)
 }
 
-inline void ClearRelationExpResp::SharedCtor(
+inline void SetMemConfigReq::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.res_){0}
+      decltype(_impl_.keyconfig_){}
+    , decltype(_impl_.valueconfig_){}
+    , decltype(_impl_.procid_){0}
+    , decltype(_impl_.matcherid_){0}
+    , decltype(_impl_.keywidth_){0}
+    , decltype(_impl_.valuewidth_){0}
+    , decltype(_impl_.matchtype_){0}
+    , decltype(_impl_.depth_){0}
+    , decltype(_impl_.missactid_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.keyconfig_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.keyconfig_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.valueconfig_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.valueconfig_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-ClearRelationExpResp::~ClearRelationExpResp() {
-  // @@protoc_insertion_point(destructor:rp4.ClearRelationExpResp)
+SetMemConfigReq::~SetMemConfigReq() {
+  // @@protoc_insertion_point(destructor:rp4.SetMemConfigReq)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -6562,36 +11841,108 @@ ClearRelationExpResp::~ClearRelationExpResp() {
   SharedDtor();
 }
 
-inline void ClearRelationExpResp::SharedDtor() {
+inline void SetMemConfigReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keyconfig_.Destroy();
+  _impl_.valueconfig_.Destroy();
 }
 
-void ClearRelationExpResp::SetCachedSize(int size) const {
+void SetMemConfigReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ClearRelationExpResp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.ClearRelationExpResp)
+void SetMemConfigReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.SetMemConfigReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.res_ = 0;
+  _impl_.keyconfig_.ClearToEmpty();
+  _impl_.valueconfig_.ClearToEmpty();
+  ::memset(&_impl_.procid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.missactid_) -
+      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.missactid_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ClearRelationExpResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SetMemConfigReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .rp4.Res res = 1;
+      // int32 procId = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 matcherId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.matcherid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 keyWidth = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.keywidth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 valueWidth = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.valuewidth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes keyConfig = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_keyconfig();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes valueConfig = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_valueconfig();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rp4.MatchType matchType = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
           uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          _internal_set_res(static_cast<::rp4::Res>(val));
+          _internal_set_matchtype(static_cast<::rp4::MatchType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 depth = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 missActId = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.missactid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -6618,124 +11969,255 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ClearRelationExpResp::_InternalSerialize(
+uint8_t* SetMemConfigReq::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.ClearRelationExpResp)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetMemConfigReq)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .rp4.Res res = 1;
-  if (this->_internal_res() != 0) {
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
+  }
+
+  // int32 matcherId = 2;
+  if (this->_internal_matcherid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_matcherid(), target);
+  }
+
+  // int32 keyWidth = 3;
+  if (this->_internal_keywidth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_keywidth(), target);
+  }
+
+  // int32 valueWidth = 4;
+  if (this->_internal_valuewidth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_valuewidth(), target);
+  }
+
+  // bytes keyConfig = 5;
+  if (!this->_internal_keyconfig().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_keyconfig(), target);
+  }
+
+  // bytes valueConfig = 6;
+  if (!this->_internal_valueconfig().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_valueconfig(), target);
+  }
+
+  // .rp4.MatchType matchType = 7;
+  if (this->_internal_matchtype() != 0) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_res(), target);
+      7, this->_internal_matchtype(), target);
+  }
+
+  // int32 depth = 8;
+  if (this->_internal_depth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_depth(), target);
+  }
+
+  // int32 missActId = 9;
+  if (this->_internal_missactid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_missactid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.ClearRelationExpResp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetMemConfigReq)
   return target;
 }
 
-size_t ClearRelationExpResp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.ClearRelationExpResp)
+size_t SetMemConfigReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.SetMemConfigReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .rp4.Res res = 1;
-  if (this->_internal_res() != 0) {
+  // bytes keyConfig = 5;
+  if (!this->_internal_keyconfig().empty()) {
     total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_keyconfig());
+  }
+
+  // bytes valueConfig = 6;
+  if (!this->_internal_valueconfig().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_valueconfig());
+  }
+
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
+  }
+
+  // int32 matcherId = 2;
+  if (this->_internal_matcherid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_matcherid());
+  }
+
+  // int32 keyWidth = 3;
+  if (this->_internal_keywidth() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_keywidth());
+  }
+
+  // int32 valueWidth = 4;
+  if (this->_internal_valuewidth() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_valuewidth());
+  }
+
+  // .rp4.MatchType matchType = 7;
+  if (this->_internal_matchtype() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_matchtype());
+  }
+
+  // int32 depth = 8;
+  if (this->_internal_depth() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_depth());
+  }
+
+  // int32 missActId = 9;
+  if (this->_internal_missactid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_missactid());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClearRelationExpResp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetMemConfigReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ClearRelationExpResp::MergeImpl
+    SetMemConfigReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearRelationExpResp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetMemConfigReq::GetClassData() const { return &_class_data_; }
 
 
-void ClearRelationExpResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ClearRelationExpResp*>(&to_msg);
-  auto& from = static_cast<const ClearRelationExpResp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ClearRelationExpResp)
+void SetMemConfigReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetMemConfigReq*>(&to_msg);
+  auto& from = static_cast<const SetMemConfigReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetMemConfigReq)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_res() != 0) {
-    _this->_internal_set_res(from._internal_res());
+  if (!from._internal_keyconfig().empty()) {
+    _this->_internal_set_keyconfig(from._internal_keyconfig());
+  }
+  if (!from._internal_valueconfig().empty()) {
+    _this->_internal_set_valueconfig(from._internal_valueconfig());
+  }
+  if (from._internal_procid() != 0) {
+    _this->_internal_set_procid(from._internal_procid());
+  }
+  if (from._internal_matcherid() != 0) {
+    _this->_internal_set_matcherid(from._internal_matcherid());
+  }
+  if (from._internal_keywidth() != 0) {
+    _this->_internal_set_keywidth(from._internal_keywidth());
+  }
+  if (from._internal_valuewidth() != 0) {
+    _this->_internal_set_valuewidth(from._internal_valuewidth());
+  }
+  if (from._internal_matchtype() != 0) {
+    _this->_internal_set_matchtype(from._internal_matchtype());
+  }
+  if (from._internal_depth() != 0) {
+    _this->_internal_set_depth(from._internal_depth());
+  }
+  if (from._internal_missactid() != 0) {
+    _this->_internal_set_missactid(from._internal_missactid());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ClearRelationExpResp::CopyFrom(const ClearRelationExpResp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ClearRelationExpResp)
+void SetMemConfigReq::CopyFrom(const SetMemConfigReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetMemConfigReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ClearRelationExpResp::IsInitialized() const {
+bool SetMemConfigReq::IsInitialized() const {
   return true;
 }
 
-void ClearRelationExpResp::InternalSwap(ClearRelationExpResp* other) {
+void SetMemConfigReq::InternalSwap(SetMemConfigReq* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.res_, other->_impl_.res_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.keyconfig_, lhs_arena,
+      &other->_impl_.keyconfig_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.valueconfig_, lhs_arena,
+      &other->_impl_.valueconfig_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetMemConfigReq, _impl_.missactid_)
+      + sizeof(SetMemConfigReq::_impl_.missactid_)
+      - PROTOBUF_FIELD_OFFSET(SetMemConfigReq, _impl_.procid_)>(
+          reinterpret_cast<char*>(&_impl_.procid_),
+          reinterpret_cast<char*>(&other->_impl_.procid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ClearRelationExpResp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SetMemConfigReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[20]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[39]);
 }
 
 // ===================================================================
 
-class ClearResMapReq::_Internal {
+class SetMemConfigResp::_Internal {
  public:
 };
 
-ClearResMapReq::ClearResMapReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SetMemConfigResp::SetMemConfigResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.ClearResMapReq)
+  // @@protoc_insertion_point(arena_constructor:rp4.SetMemConfigResp)
 }
-ClearResMapReq::ClearResMapReq(const ClearResMapReq& from)
+SetMemConfigResp::SetMemConfigResp(const SetMemConfigResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ClearResMapReq* const _this = this; (void)_this;
+  SetMemConfigResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.procid_){}
+      decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.procid_ = from._impl_.procid_;
-  // @@protoc_insertion_point(copy_constructor:rp4.ClearResMapReq)
+  _this->_impl_.res_ = from._impl_.res_;
+  // @@protoc_insertion_point(copy_constructor:rp4.SetMemConfigResp)
 }
 
-inline void ClearResMapReq::SharedCtor(
+inline void SetMemConfigResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.procid_){0}
+      decltype(_impl_.res_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-ClearResMapReq::~ClearResMapReq() {
-  // @@protoc_insertion_point(destructor:rp4.ClearResMapReq)
+SetMemConfigResp::~SetMemConfigResp() {
+  // @@protoc_insertion_point(destructor:rp4.SetMemConfigResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -6743,35 +12225,36 @@ ClearResMapReq::~ClearResMapReq() {
   SharedDtor();
 }
 
-inline void ClearResMapReq::SharedDtor() {
+inline void SetMemConfigResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void ClearResMapReq::SetCachedSize(int size) const {
+void SetMemConfigResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ClearResMapReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.ClearResMapReq)
+void SetMemConfigResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.SetMemConfigResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.procid_ = 0;
+  _impl_.res_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ClearResMapReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SetMemConfigResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 procId = 1;
+      // .rp4.Res res = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_res(static_cast<::rp4::Res>(val));
         } else
           goto handle_unusual;
         continue;
@@ -6798,122 +12281,130 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ClearResMapReq::_InternalSerialize(
+uint8_t* SetMemConfigResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.ClearResMapReq)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetMemConfigResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 procId = 1;
-  if (this->_internal_procid() != 0) {
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_res(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.ClearResMapReq)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetMemConfigResp)
   return target;
 }
 
-size_t ClearResMapReq::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.ClearResMapReq)
+size_t SetMemConfigResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.SetMemConfigResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 procId = 1;
-  if (this->_internal_procid() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClearResMapReq::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetMemConfigResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ClearResMapReq::MergeImpl
+    SetMemConfigResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearResMapReq::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetMemConfigResp::GetClassData() const { return &_class_data_; }
 
 
-void ClearResMapReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ClearResMapReq*>(&to_msg);
-  auto& from = static_cast<const ClearResMapReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ClearResMapReq)
+void SetMemConfigResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetMemConfigResp*>(&to_msg);
+  auto& from = static_cast<const SetMemConfigResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetMemConfigResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_procid() != 0) {
-    _this->_internal_set_procid(from._internal_procid());
+  if (from._internal_res() != 0) {
+    _this->_internal_set_res(from._internal_res());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ClearResMapReq::CopyFrom(const ClearResMapReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ClearResMapReq)
+void SetMemConfigResp::CopyFrom(const SetMemConfigResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetMemConfigResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ClearResMapReq::IsInitialized() const {
+bool SetMemConfigResp::IsInitialized() const {
   return true;
 }
 
-void ClearResMapReq::InternalSwap(ClearResMapReq* other) {
+void SetMemConfigResp::InternalSwap(SetMemConfigResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.procid_, other->_impl_.procid_);
+  swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ClearResMapReq::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SetMemConfigResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[21]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[40]);
 }
 
 // ===================================================================
 
-class ClearResMapResp::_Internal {
+class SetFieldInfoReq::_Internal {
  public:
 };
 
-ClearResMapResp::ClearResMapResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SetFieldInfoReq::SetFieldInfoReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.ClearResMapResp)
+  // @@protoc_insertion_point(arena_constructor:rp4.SetFieldInfoReq)
 }
-ClearResMapResp::ClearResMapResp(const ClearResMapResp& from)
+SetFieldInfoReq::SetFieldInfoReq(const SetFieldInfoReq& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ClearResMapResp* const _this = this; (void)_this;
+  SetFieldInfoReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.res_){}
+      decltype(_impl_.fdinfos_){from._impl_.fdinfos_}
+    , decltype(_impl_.procid_){}
+    , decltype(_impl_.matcherid_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.res_ = from._impl_.res_;
-  // @@protoc_insertion_point(copy_constructor:rp4.ClearResMapResp)
+  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.matcherid_) -
+    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.matcherid_));
+  // @@protoc_insertion_point(copy_constructor:rp4.SetFieldInfoReq)
 }
 
-inline void ClearResMapResp::SharedCtor(
+inline void SetFieldInfoReq::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.res_){0}
+      decltype(_impl_.fdinfos_){arena}
+    , decltype(_impl_.procid_){0}
+    , decltype(_impl_.matcherid_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-ClearResMapResp::~ClearResMapResp() {
-  // @@protoc_insertion_point(destructor:rp4.ClearResMapResp)
+SetFieldInfoReq::~SetFieldInfoReq() {
+  // @@protoc_insertion_point(destructor:rp4.SetFieldInfoReq)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -6921,36 +12412,60 @@ ClearResMapResp::~ClearResMapResp() {
   SharedDtor();
 }
 
-inline void ClearResMapResp::SharedDtor() {
+inline void SetFieldInfoReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.fdinfos_.~RepeatedPtrField();
 }
 
-void ClearResMapResp::SetCachedSize(int size) const {
+void SetFieldInfoReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ClearResMapResp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.ClearResMapResp)
+void SetFieldInfoReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.SetFieldInfoReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.res_ = 0;
+  _impl_.fdinfos_.Clear();
+  ::memset(&_impl_.procid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.matcherid_) -
+      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.matcherid_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ClearResMapResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SetFieldInfoReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .rp4.Res res = 1;
+      // int32 procId = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          _internal_set_res(static_cast<::rp4::Res>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 matcherId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.matcherid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .rp4.FieldInfo fdInfos = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_fdinfos(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -6977,138 +12492,158 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ClearResMapResp::_InternalSerialize(
+uint8_t* SetFieldInfoReq::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.ClearResMapResp)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetFieldInfoReq)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .rp4.Res res = 1;
-  if (this->_internal_res() != 0) {
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_res(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
+  }
+
+  // int32 matcherId = 2;
+  if (this->_internal_matcherid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_matcherid(), target);
+  }
+
+  // repeated .rp4.FieldInfo fdInfos = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_fdinfos_size()); i < n; i++) {
+    const auto& repfield = this->_internal_fdinfos(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.ClearResMapResp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetFieldInfoReq)
   return target;
 }
 
-size_t ClearResMapResp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.ClearResMapResp)
+size_t SetFieldInfoReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.SetFieldInfoReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .rp4.Res res = 1;
-  if (this->_internal_res() != 0) {
-    total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
+  // repeated .rp4.FieldInfo fdInfos = 3;
+  total_size += 1UL * this->_internal_fdinfos_size();
+  for (const auto& msg : this->_impl_.fdinfos_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
+  }
+
+  // int32 matcherId = 2;
+  if (this->_internal_matcherid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_matcherid());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClearResMapResp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetFieldInfoReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ClearResMapResp::MergeImpl
+    SetFieldInfoReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearResMapResp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetFieldInfoReq::GetClassData() const { return &_class_data_; }
 
 
-void ClearResMapResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ClearResMapResp*>(&to_msg);
-  auto& from = static_cast<const ClearResMapResp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ClearResMapResp)
+void SetFieldInfoReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetFieldInfoReq*>(&to_msg);
+  auto& from = static_cast<const SetFieldInfoReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetFieldInfoReq)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_res() != 0) {
-    _this->_internal_set_res(from._internal_res());
+  _this->_impl_.fdinfos_.MergeFrom(from._impl_.fdinfos_);
+  if (from._internal_procid() != 0) {
+    _this->_internal_set_procid(from._internal_procid());
+  }
+  if (from._internal_matcherid() != 0) {
+    _this->_internal_set_matcherid(from._internal_matcherid());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-
-void ClearResMapResp::CopyFrom(const ClearResMapResp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ClearResMapResp)
+
+void SetFieldInfoReq::CopyFrom(const SetFieldInfoReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetFieldInfoReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ClearResMapResp::IsInitialized() const {
+bool SetFieldInfoReq::IsInitialized() const {
   return true;
 }
 
-void ClearResMapResp::InternalSwap(ClearResMapResp* other) {
+void SetFieldInfoReq::InternalSwap(SetFieldInfoReq* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.res_, other->_impl_.res_);
+  _impl_.fdinfos_.InternalSwap(&other->_impl_.fdinfos_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetFieldInfoReq, _impl_.matcherid_)
+      + sizeof(SetFieldInfoReq::_impl_.matcherid_)
+      - PROTOBUF_FIELD_OFFSET(SetFieldInfoReq, _impl_.procid_)>(
+          reinterpret_cast<char*>(&_impl_.procid_),
+          reinterpret_cast<char*>(&other->_impl_.procid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ClearResMapResp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SetFieldInfoReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[22]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[41]);
 }
 
 // ===================================================================
 
-class ModResMapReq::_Internal {
+class SetFieldInfoResp::_Internal {
  public:
-  static const ::rp4::GateEntry& entry(const ModResMapReq* msg);
 };
 
-const ::rp4::GateEntry&
-ModResMapReq::_Internal::entry(const ModResMapReq* msg) {
-  return *msg->_impl_.entry_;
-}
-ModResMapReq::ModResMapReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SetFieldInfoResp::SetFieldInfoResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.ModResMapReq)
+  // @@protoc_insertion_point(arena_constructor:rp4.SetFieldInfoResp)
 }
-ModResMapReq::ModResMapReq(const ModResMapReq& from)
+SetFieldInfoResp::SetFieldInfoResp(const SetFieldInfoResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ModResMapReq* const _this = this; (void)_this;
+  SetFieldInfoResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.entry_){nullptr}
-    , decltype(_impl_.procid_){}
-    , decltype(_impl_.key_){}
+      decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_entry()) {
-    _this->_impl_.entry_ = new ::rp4::GateEntry(*from._impl_.entry_);
-  }
-  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.key_) -
-    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.key_));
-  // @@protoc_insertion_point(copy_constructor:rp4.ModResMapReq)
+  _this->_impl_.res_ = from._impl_.res_;
+  // @@protoc_insertion_point(copy_constructor:rp4.SetFieldInfoResp)
 }
 
-inline void ModResMapReq::SharedCtor(
+inline void SetFieldInfoResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.entry_){nullptr}
-    , decltype(_impl_.procid_){0}
-    , decltype(_impl_.key_){0}
+      decltype(_impl_.res_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-ModResMapReq::~ModResMapReq() {
-  // @@protoc_insertion_point(destructor:rp4.ModResMapReq)
+SetFieldInfoResp::~SetFieldInfoResp() {
+  // @@protoc_insertion_point(destructor:rp4.SetFieldInfoResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -7116,58 +12651,36 @@ ModResMapReq::~ModResMapReq() {
   SharedDtor();
 }
 
-inline void ModResMapReq::SharedDtor() {
+inline void SetFieldInfoResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.entry_;
 }
 
-void ModResMapReq::SetCachedSize(int size) const {
+void SetFieldInfoResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ModResMapReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.ModResMapReq)
+void SetFieldInfoResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.SetFieldInfoResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.entry_ != nullptr) {
-    delete _impl_.entry_;
-  }
-  _impl_.entry_ = nullptr;
-  ::memset(&_impl_.procid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.key_) -
-      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.key_));
+  _impl_.res_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ModResMapReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SetFieldInfoResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 procId = 1;
+      // .rp4.Res res = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 key = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.key_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .rp4.GateEntry entry = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_entry(), ptr);
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_res(static_cast<::rp4::Res>(val));
         } else
           goto handle_unusual;
         continue;
@@ -7194,159 +12707,160 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ModResMapReq::_InternalSerialize(
+uint8_t* SetFieldInfoResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.ModResMapReq)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetFieldInfoResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 procId = 1;
-  if (this->_internal_procid() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
-  }
-
-  // int32 key = 2;
-  if (this->_internal_key() != 0) {
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_key(), target);
-  }
-
-  // .rp4.GateEntry entry = 3;
-  if (this->_internal_has_entry()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(3, _Internal::entry(this),
-        _Internal::entry(this).GetCachedSize(), target, stream);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_res(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.ModResMapReq)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetFieldInfoResp)
   return target;
 }
 
-size_t ModResMapReq::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.ModResMapReq)
+size_t SetFieldInfoResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.SetFieldInfoResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .rp4.GateEntry entry = 3;
-  if (this->_internal_has_entry()) {
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.entry_);
-  }
-
-  // int32 procId = 1;
-  if (this->_internal_procid() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
-  }
-
-  // int32 key = 2;
-  if (this->_internal_key() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_key());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModResMapReq::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetFieldInfoResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ModResMapReq::MergeImpl
+    SetFieldInfoResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModResMapReq::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetFieldInfoResp::GetClassData() const { return &_class_data_; }
 
 
-void ModResMapReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ModResMapReq*>(&to_msg);
-  auto& from = static_cast<const ModResMapReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ModResMapReq)
+void SetFieldInfoResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetFieldInfoResp*>(&to_msg);
+  auto& from = static_cast<const SetFieldInfoResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetFieldInfoResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_entry()) {
-    _this->_internal_mutable_entry()->::rp4::GateEntry::MergeFrom(
-        from._internal_entry());
-  }
-  if (from._internal_procid() != 0) {
-    _this->_internal_set_procid(from._internal_procid());
-  }
-  if (from._internal_key() != 0) {
-    _this->_internal_set_key(from._internal_key());
+  if (from._internal_res() != 0) {
+    _this->_internal_set_res(from._internal_res());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ModResMapReq::CopyFrom(const ModResMapReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ModResMapReq)
+void SetFieldInfoResp::CopyFrom(const SetFieldInfoResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetFieldInfoResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ModResMapReq::IsInitialized() const {
+bool SetFieldInfoResp::IsInitialized() const {
   return true;
 }
 
-void ModResMapReq::InternalSwap(ModResMapReq* other) {
+void SetFieldInfoResp::InternalSwap(SetFieldInfoResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ModResMapReq, _impl_.key_)
-      + sizeof(ModResMapReq::_impl_.key_)
-      - PROTOBUF_FIELD_OFFSET(ModResMapReq, _impl_.entry_)>(
-          reinterpret_cast<char*>(&_impl_.entry_),
-          reinterpret_cast<char*>(&other->_impl_.entry_));
+  swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ModResMapReq::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SetFieldInfoResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[23]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[42]);
 }
 
 // ===================================================================
 
-class ModResMapResp::_Internal {
+class InsertSramEntryReq::_Internal {
  public:
 };
 
-ModResMapResp::ModResMapResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+InsertSramEntryReq::InsertSramEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.ModResMapResp)
+  // @@protoc_insertion_point(arena_constructor:rp4.InsertSramEntryReq)
 }
-ModResMapResp::ModResMapResp(const ModResMapResp& from)
+InsertSramEntryReq::InsertSramEntryReq(const InsertSramEntryReq& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ModResMapResp* const _this = this; (void)_this;
+  InsertSramEntryReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.res_){}
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.procid_){}
+    , decltype(_impl_.matcherid_){}
+    , decltype(_impl_.key_byte_len_){}
+    , decltype(_impl_.value_byte_len_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.res_ = from._impl_.res_;
-  // @@protoc_insertion_point(copy_constructor:rp4.ModResMapResp)
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.value_byte_len_) -
+    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.value_byte_len_));
+  // @@protoc_insertion_point(copy_constructor:rp4.InsertSramEntryReq)
 }
 
-inline void ModResMapResp::SharedCtor(
+inline void InsertSramEntryReq::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.res_){0}
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.procid_){0}
+    , decltype(_impl_.matcherid_){0}
+    , decltype(_impl_.key_byte_len_){0}
+    , decltype(_impl_.value_byte_len_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-ModResMapResp::~ModResMapResp() {
-  // @@protoc_insertion_point(destructor:rp4.ModResMapResp)
+InsertSramEntryReq::~InsertSramEntryReq() {
+  // @@protoc_insertion_point(destructor:rp4.InsertSramEntryReq)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -7354,36 +12868,83 @@ ModResMapResp::~ModResMapResp() {
   SharedDtor();
 }
 
-inline void ModResMapResp::SharedDtor() {
+inline void InsertSramEntryReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
 }
 
-void ModResMapResp::SetCachedSize(int size) const {
+void InsertSramEntryReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ModResMapResp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.ModResMapResp)
+void InsertSramEntryReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.InsertSramEntryReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.res_ = 0;
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.procid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.value_byte_len_) -
+      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.value_byte_len_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ModResMapResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* InsertSramEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .rp4.Res res = 1;
+      // int32 procId = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 matcherId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.matcherid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes key = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 key_byte_len = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.key_byte_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 value_byte_len = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.value_byte_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          _internal_set_res(static_cast<::rp4::Res>(val));
         } else
           goto handle_unusual;
         continue;
@@ -7410,130 +12971,219 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ModResMapResp::_InternalSerialize(
+uint8_t* InsertSramEntryReq::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.ModResMapResp)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.InsertSramEntryReq)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .rp4.Res res = 1;
-  if (this->_internal_res() != 0) {
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_res(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
+  }
+
+  // int32 matcherId = 2;
+  if (this->_internal_matcherid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_matcherid(), target);
+  }
+
+  // bytes key = 3;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_key(), target);
+  }
+
+  // bytes value = 4;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_value(), target);
+  }
+
+  // int32 key_byte_len = 5;
+  if (this->_internal_key_byte_len() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_key_byte_len(), target);
+  }
+
+  // int32 value_byte_len = 6;
+  if (this->_internal_value_byte_len() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_value_byte_len(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.ModResMapResp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.InsertSramEntryReq)
   return target;
 }
 
-size_t ModResMapResp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.ModResMapResp)
+size_t InsertSramEntryReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.InsertSramEntryReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .rp4.Res res = 1;
-  if (this->_internal_res() != 0) {
+  // bytes key = 3;
+  if (!this->_internal_key().empty()) {
     total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes value = 4;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
+  }
+
+  // int32 matcherId = 2;
+  if (this->_internal_matcherid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_matcherid());
+  }
+
+  // int32 key_byte_len = 5;
+  if (this->_internal_key_byte_len() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_key_byte_len());
+  }
+
+  // int32 value_byte_len = 6;
+  if (this->_internal_value_byte_len() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_value_byte_len());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModResMapResp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertSramEntryReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ModResMapResp::MergeImpl
+    InsertSramEntryReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModResMapResp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertSramEntryReq::GetClassData() const { return &_class_data_; }
 
 
-void ModResMapResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ModResMapResp*>(&to_msg);
-  auto& from = static_cast<const ModResMapResp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ModResMapResp)
+void InsertSramEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InsertSramEntryReq*>(&to_msg);
+  auto& from = static_cast<const InsertSramEntryReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.InsertSramEntryReq)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_res() != 0) {
-    _this->_internal_set_res(from._internal_res());
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_procid() != 0) {
+    _this->_internal_set_procid(from._internal_procid());
+  }
+  if (from._internal_matcherid() != 0) {
+    _this->_internal_set_matcherid(from._internal_matcherid());
+  }
+  if (from._internal_key_byte_len() != 0) {
+    _this->_internal_set_key_byte_len(from._internal_key_byte_len());
+  }
+  if (from._internal_value_byte_len() != 0) {
+    _this->_internal_set_value_byte_len(from._internal_value_byte_len());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ModResMapResp::CopyFrom(const ModResMapResp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ModResMapResp)
+void InsertSramEntryReq::CopyFrom(const InsertSramEntryReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.InsertSramEntryReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ModResMapResp::IsInitialized() const {
+bool InsertSramEntryReq::IsInitialized() const {
   return true;
 }
 
-void ModResMapResp::InternalSwap(ModResMapResp* other) {
+void InsertSramEntryReq::InternalSwap(InsertSramEntryReq* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.res_, other->_impl_.res_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InsertSramEntryReq, _impl_.value_byte_len_)
+      + sizeof(InsertSramEntryReq::_impl_.value_byte_len_)
+      - PROTOBUF_FIELD_OFFSET(InsertSramEntryReq, _impl_.procid_)>(
+          reinterpret_cast<char*>(&_impl_.procid_),
+          reinterpret_cast<char*>(&other->_impl_.procid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ModResMapResp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata InsertSramEntryReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[24]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[43]);
 }
 
 // ===================================================================
 
-class SetNoTableReq::_Internal {
+class InsertSramEntryResp::_Internal {
  public:
 };
 
-SetNoTableReq::SetNoTableReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+InsertSramEntryResp::InsertSramEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.SetNoTableReq)
+  // @@protoc_insertion_point(arena_constructor:rp4.InsertSramEntryResp)
 }
-SetNoTableReq::SetNoTableReq(const SetNoTableReq& from)
+InsertSramEntryResp::InsertSramEntryResp(const InsertSramEntryResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetNoTableReq* const _this = this; (void)_this;
+  InsertSramEntryResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.procid_){}
-    , decltype(_impl_.matcherid_){}
-    , decltype(_impl_.notable_){}
+      decltype(_impl_.res_){}
+    , decltype(_impl_.occupancy_){}
+    , decltype(_impl_.capacity_){}
+    , decltype(_impl_.stash_used_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.notable_) -
-    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.notable_));
-  // @@protoc_insertion_point(copy_constructor:rp4.SetNoTableReq)
+  ::memcpy(&_impl_.res_, &from._impl_.res_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.stash_used_) -
+    reinterpret_cast<char*>(&_impl_.res_)) + sizeof(_impl_.stash_used_));
+  // @@protoc_insertion_point(copy_constructor:rp4.InsertSramEntryResp)
 }
 
-inline void SetNoTableReq::SharedCtor(
+inline void InsertSramEntryResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.procid_){0}
-    , decltype(_impl_.matcherid_){0}
-    , decltype(_impl_.notable_){false}
+      decltype(_impl_.res_){0}
+    , decltype(_impl_.occupancy_){0}
+    , decltype(_impl_.capacity_){0}
+    , decltype(_impl_.stash_used_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-SetNoTableReq::~SetNoTableReq() {
-  // @@protoc_insertion_point(destructor:rp4.SetNoTableReq)
+InsertSramEntryResp::~InsertSramEntryResp() {
+  // @@protoc_insertion_point(destructor:rp4.InsertSramEntryResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -7541,52 +13191,61 @@ SetNoTableReq::~SetNoTableReq() {
   SharedDtor();
 }
 
-inline void SetNoTableReq::SharedDtor() {
+inline void InsertSramEntryResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void SetNoTableReq::SetCachedSize(int size) const {
+void InsertSramEntryResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetNoTableReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.SetNoTableReq)
+void InsertSramEntryResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.InsertSramEntryResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.procid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.notable_) -
-      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.notable_));
+  ::memset(&_impl_.res_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.stash_used_) -
+      reinterpret_cast<char*>(&_impl_.res_)) + sizeof(_impl_.stash_used_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetNoTableReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* InsertSramEntryResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 procId = 1;
+      // .rp4.Res res = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_res(static_cast<::rp4::Res>(val));
         } else
           goto handle_unusual;
         continue;
-      // int32 matcherId = 2;
+      // int32 occupancy = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.matcherid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.occupancy_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // bool noTable = 3;
+      // int32 capacity = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.notable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.capacity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 stash_used = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.stash_used_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -7614,155 +13273,221 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetNoTableReq::_InternalSerialize(
+uint8_t* InsertSramEntryResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetNoTableReq)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.InsertSramEntryResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 procId = 1;
-  if (this->_internal_procid() != 0) {
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_res(), target);
   }
 
-  // int32 matcherId = 2;
-  if (this->_internal_matcherid() != 0) {
+  // int32 occupancy = 2;
+  if (this->_internal_occupancy() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_matcherid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_occupancy(), target);
   }
 
-  // bool noTable = 3;
-  if (this->_internal_notable() != 0) {
+  // int32 capacity = 3;
+  if (this->_internal_capacity() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_notable(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_capacity(), target);
+  }
+
+  // int32 stash_used = 4;
+  if (this->_internal_stash_used() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_stash_used(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetNoTableReq)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.InsertSramEntryResp)
   return target;
 }
 
-size_t SetNoTableReq::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.SetNoTableReq)
+size_t InsertSramEntryResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.InsertSramEntryResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 procId = 1;
-  if (this->_internal_procid() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
   }
 
-  // int32 matcherId = 2;
-  if (this->_internal_matcherid() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_matcherid());
+  // int32 occupancy = 2;
+  if (this->_internal_occupancy() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_occupancy());
   }
 
-  // bool noTable = 3;
-  if (this->_internal_notable() != 0) {
-    total_size += 1 + 1;
+  // int32 capacity = 3;
+  if (this->_internal_capacity() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_capacity());
+  }
+
+  // int32 stash_used = 4;
+  if (this->_internal_stash_used() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_stash_used());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetNoTableReq::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertSramEntryResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetNoTableReq::MergeImpl
+    InsertSramEntryResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetNoTableReq::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertSramEntryResp::GetClassData() const { return &_class_data_; }
 
 
-void SetNoTableReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetNoTableReq*>(&to_msg);
-  auto& from = static_cast<const SetNoTableReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetNoTableReq)
+void InsertSramEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InsertSramEntryResp*>(&to_msg);
+  auto& from = static_cast<const InsertSramEntryResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.InsertSramEntryResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_procid() != 0) {
-    _this->_internal_set_procid(from._internal_procid());
+  if (from._internal_res() != 0) {
+    _this->_internal_set_res(from._internal_res());
   }
-  if (from._internal_matcherid() != 0) {
-    _this->_internal_set_matcherid(from._internal_matcherid());
+  if (from._internal_occupancy() != 0) {
+    _this->_internal_set_occupancy(from._internal_occupancy());
   }
-  if (from._internal_notable() != 0) {
-    _this->_internal_set_notable(from._internal_notable());
+  if (from._internal_capacity() != 0) {
+    _this->_internal_set_capacity(from._internal_capacity());
+  }
+  if (from._internal_stash_used() != 0) {
+    _this->_internal_set_stash_used(from._internal_stash_used());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetNoTableReq::CopyFrom(const SetNoTableReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetNoTableReq)
+void InsertSramEntryResp::CopyFrom(const InsertSramEntryResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.InsertSramEntryResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetNoTableReq::IsInitialized() const {
+bool InsertSramEntryResp::IsInitialized() const {
   return true;
 }
 
-void SetNoTableReq::InternalSwap(SetNoTableReq* other) {
+void InsertSramEntryResp::InternalSwap(InsertSramEntryResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SetNoTableReq, _impl_.notable_)
-      + sizeof(SetNoTableReq::_impl_.notable_)
-      - PROTOBUF_FIELD_OFFSET(SetNoTableReq, _impl_.procid_)>(
-          reinterpret_cast<char*>(&_impl_.procid_),
-          reinterpret_cast<char*>(&other->_impl_.procid_));
+      PROTOBUF_FIELD_OFFSET(InsertSramEntryResp, _impl_.stash_used_)
+      + sizeof(InsertSramEntryResp::_impl_.stash_used_)
+      - PROTOBUF_FIELD_OFFSET(InsertSramEntryResp, _impl_.res_)>(
+          reinterpret_cast<char*>(&_impl_.res_),
+          reinterpret_cast<char*>(&other->_impl_.res_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetNoTableReq::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata InsertSramEntryResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[25]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[44]);
 }
 
 // ===================================================================
 
-class SetNoTableResp::_Internal {
+class InsertTcamEntryReq::_Internal {
  public:
 };
 
-SetNoTableResp::SetNoTableResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+InsertTcamEntryReq::InsertTcamEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.SetNoTableResp)
+  // @@protoc_insertion_point(arena_constructor:rp4.InsertTcamEntryReq)
 }
-SetNoTableResp::SetNoTableResp(const SetNoTableResp& from)
+InsertTcamEntryReq::InsertTcamEntryReq(const InsertTcamEntryReq& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetNoTableResp* const _this = this; (void)_this;
+  InsertTcamEntryReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.res_){}
+      decltype(_impl_.key_){}
+    , decltype(_impl_.mask_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.procid_){}
+    , decltype(_impl_.matcherid_){}
+    , decltype(_impl_.key_byte_len_){}
+    , decltype(_impl_.value_byte_len_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.res_ = from._impl_.res_;
-  // @@protoc_insertion_point(copy_constructor:rp4.SetNoTableResp)
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.mask_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mask_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_mask().empty()) {
+    _this->_impl_.mask_.Set(from._internal_mask(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.procid_, &from._impl_.procid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.value_byte_len_) -
+    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.value_byte_len_));
+  // @@protoc_insertion_point(copy_constructor:rp4.InsertTcamEntryReq)
 }
 
-inline void SetNoTableResp::SharedCtor(
+inline void InsertTcamEntryReq::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.res_){0}
+      decltype(_impl_.key_){}
+    , decltype(_impl_.mask_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.procid_){0}
+    , decltype(_impl_.matcherid_){0}
+    , decltype(_impl_.key_byte_len_){0}
+    , decltype(_impl_.value_byte_len_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.mask_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mask_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SetNoTableResp::~SetNoTableResp() {
-  // @@protoc_insertion_point(destructor:rp4.SetNoTableResp)
+InsertTcamEntryReq::~InsertTcamEntryReq() {
+  // @@protoc_insertion_point(destructor:rp4.InsertTcamEntryReq)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -7770,36 +13495,94 @@ SetNoTableResp::~SetNoTableResp() {
   SharedDtor();
 }
 
-inline void SetNoTableResp::SharedDtor() {
+inline void InsertTcamEntryReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.mask_.Destroy();
+  _impl_.value_.Destroy();
 }
 
-void SetNoTableResp::SetCachedSize(int size) const {
+void InsertTcamEntryReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetNoTableResp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.SetNoTableResp)
+void InsertTcamEntryReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.InsertTcamEntryReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.res_ = 0;
+  _impl_.key_.ClearToEmpty();
+  _impl_.mask_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.procid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.value_byte_len_) -
+      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.value_byte_len_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetNoTableResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* InsertTcamEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .rp4.Res res = 1;
+      // int32 procId = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 matcherId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.matcherid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes key = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes mask = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_mask();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes value = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 key_byte_len = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.key_byte_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 value_byte_len = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.value_byte_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          _internal_set_res(static_cast<::rp4::Res>(val));
         } else
           goto handle_unusual;
         continue;
@@ -7826,128 +13609,231 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetNoTableResp::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetNoTableResp)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
+uint8_t* InsertTcamEntryReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.InsertTcamEntryReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_procid(), target);
+  }
+
+  // int32 matcherId = 2;
+  if (this->_internal_matcherid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_matcherid(), target);
+  }
+
+  // bytes key = 3;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_key(), target);
+  }
+
+  // bytes mask = 4;
+  if (!this->_internal_mask().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_mask(), target);
+  }
 
-  // .rp4.Res res = 1;
-  if (this->_internal_res() != 0) {
+  // bytes value = 5;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_value(), target);
+  }
+
+  // int32 key_byte_len = 6;
+  if (this->_internal_key_byte_len() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_res(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_key_byte_len(), target);
+  }
+
+  // int32 value_byte_len = 7;
+  if (this->_internal_value_byte_len() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_value_byte_len(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetNoTableResp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.InsertTcamEntryReq)
   return target;
 }
 
-size_t SetNoTableResp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.SetNoTableResp)
+size_t InsertTcamEntryReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.InsertTcamEntryReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .rp4.Res res = 1;
-  if (this->_internal_res() != 0) {
+  // bytes key = 3;
+  if (!this->_internal_key().empty()) {
     total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes mask = 4;
+  if (!this->_internal_mask().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_mask());
+  }
+
+  // bytes value = 5;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // int32 procId = 1;
+  if (this->_internal_procid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
+  }
+
+  // int32 matcherId = 2;
+  if (this->_internal_matcherid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_matcherid());
+  }
+
+  // int32 key_byte_len = 6;
+  if (this->_internal_key_byte_len() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_key_byte_len());
+  }
+
+  // int32 value_byte_len = 7;
+  if (this->_internal_value_byte_len() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_value_byte_len());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetNoTableResp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertTcamEntryReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetNoTableResp::MergeImpl
+    InsertTcamEntryReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetNoTableResp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertTcamEntryReq::GetClassData() const { return &_class_data_; }
 
 
-void SetNoTableResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetNoTableResp*>(&to_msg);
-  auto& from = static_cast<const SetNoTableResp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetNoTableResp)
+void InsertTcamEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InsertTcamEntryReq*>(&to_msg);
+  auto& from = static_cast<const InsertTcamEntryReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.InsertTcamEntryReq)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_res() != 0) {
-    _this->_internal_set_res(from._internal_res());
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_mask().empty()) {
+    _this->_internal_set_mask(from._internal_mask());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_procid() != 0) {
+    _this->_internal_set_procid(from._internal_procid());
+  }
+  if (from._internal_matcherid() != 0) {
+    _this->_internal_set_matcherid(from._internal_matcherid());
+  }
+  if (from._internal_key_byte_len() != 0) {
+    _this->_internal_set_key_byte_len(from._internal_key_byte_len());
+  }
+  if (from._internal_value_byte_len() != 0) {
+    _this->_internal_set_value_byte_len(from._internal_value_byte_len());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetNoTableResp::CopyFrom(const SetNoTableResp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetNoTableResp)
+void InsertTcamEntryReq::CopyFrom(const InsertTcamEntryReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.InsertTcamEntryReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetNoTableResp::IsInitialized() const {
+bool InsertTcamEntryReq::IsInitialized() const {
   return true;
 }
 
-void SetNoTableResp::InternalSwap(SetNoTableResp* other) {
+void InsertTcamEntryReq::InternalSwap(InsertTcamEntryReq* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.res_, other->_impl_.res_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.mask_, lhs_arena,
+      &other->_impl_.mask_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InsertTcamEntryReq, _impl_.value_byte_len_)
+      + sizeof(InsertTcamEntryReq::_impl_.value_byte_len_)
+      - PROTOBUF_FIELD_OFFSET(InsertTcamEntryReq, _impl_.procid_)>(
+          reinterpret_cast<char*>(&_impl_.procid_),
+          reinterpret_cast<char*>(&other->_impl_.procid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetNoTableResp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata InsertTcamEntryReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[26]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[45]);
 }
 
 // ===================================================================
 
-class ActionProc::_Internal {
+class InsertTcamEntryResp::_Internal {
  public:
 };
 
-ActionProc::ActionProc(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+InsertTcamEntryResp::InsertTcamEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.ActionProc)
+  // @@protoc_insertion_point(arena_constructor:rp4.InsertTcamEntryResp)
 }
-ActionProc::ActionProc(const ActionProc& from)
+InsertTcamEntryResp::InsertTcamEntryResp(const InsertTcamEntryResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ActionProc* const _this = this; (void)_this;
+  InsertTcamEntryResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.actionid_){}
-    , decltype(_impl_.procid_){}
+      decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.actionid_, &from._impl_.actionid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.procid_) -
-    reinterpret_cast<char*>(&_impl_.actionid_)) + sizeof(_impl_.procid_));
-  // @@protoc_insertion_point(copy_constructor:rp4.ActionProc)
+  _this->_impl_.res_ = from._impl_.res_;
+  // @@protoc_insertion_point(copy_constructor:rp4.InsertTcamEntryResp)
 }
 
-inline void ActionProc::SharedCtor(
+inline void InsertTcamEntryResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.actionid_){0}
-    , decltype(_impl_.procid_){0}
+      decltype(_impl_.res_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-ActionProc::~ActionProc() {
-  // @@protoc_insertion_point(destructor:rp4.ActionProc)
+InsertTcamEntryResp::~InsertTcamEntryResp() {
+  // @@protoc_insertion_point(destructor:rp4.InsertTcamEntryResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -7955,45 +13841,36 @@ ActionProc::~ActionProc() {
   SharedDtor();
 }
 
-inline void ActionProc::SharedDtor() {
+inline void InsertTcamEntryResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void ActionProc::SetCachedSize(int size) const {
+void InsertTcamEntryResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ActionProc::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.ActionProc)
+void InsertTcamEntryResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.InsertTcamEntryResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.actionid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.procid_) -
-      reinterpret_cast<char*>(&_impl_.actionid_)) + sizeof(_impl_.procid_));
+  _impl_.res_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ActionProc::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* InsertTcamEntryResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 actionId = 1;
+      // .rp4.Res res = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.actionid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 procId = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.procid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_res(static_cast<::rp4::Res>(val));
         } else
           goto handle_unusual;
         continue;
@@ -8020,147 +13897,160 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ActionProc::_InternalSerialize(
+uint8_t* InsertTcamEntryResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.ActionProc)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.InsertTcamEntryResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 actionId = 1;
-  if (this->_internal_actionid() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_actionid(), target);
-  }
-
-  // int32 procId = 2;
-  if (this->_internal_procid() != 0) {
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_procid(), target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_res(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.ActionProc)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.InsertTcamEntryResp)
   return target;
 }
 
-size_t ActionProc::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.ActionProc)
+size_t InsertTcamEntryResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.InsertTcamEntryResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 actionId = 1;
-  if (this->_internal_actionid() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_actionid());
-  }
-
-  // int32 procId = 2;
-  if (this->_internal_procid() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_procid());
+  // .rp4.Res res = 1;
+  if (this->_internal_res() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ActionProc::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertTcamEntryResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ActionProc::MergeImpl
+    InsertTcamEntryResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ActionProc::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertTcamEntryResp::GetClassData() const { return &_class_data_; }
 
 
-void ActionProc::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ActionProc*>(&to_msg);
-  auto& from = static_cast<const ActionProc&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ActionProc)
+void InsertTcamEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InsertTcamEntryResp*>(&to_msg);
+  auto& from = static_cast<const InsertTcamEntryResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.InsertTcamEntryResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_actionid() != 0) {
-    _this->_internal_set_actionid(from._internal_actionid());
-  }
-  if (from._internal_procid() != 0) {
-    _this->_internal_set_procid(from._internal_procid());
+  (void) cached_has_bits;
+
+  if (from._internal_res() != 0) {
+    _this->_internal_set_res(from._internal_res());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ActionProc::CopyFrom(const ActionProc& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ActionProc)
+void InsertTcamEntryResp::CopyFrom(const InsertTcamEntryResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.InsertTcamEntryResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ActionProc::IsInitialized() const {
+bool InsertTcamEntryResp::IsInitialized() const {
   return true;
 }
 
-void ActionProc::InternalSwap(ActionProc* other) {
+void InsertTcamEntryResp::InternalSwap(InsertTcamEntryResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ActionProc, _impl_.procid_)
-      + sizeof(ActionProc::_impl_.procid_)
-      - PROTOBUF_FIELD_OFFSET(ActionProc, _impl_.actionid_)>(
-          reinterpret_cast<char*>(&_impl_.actionid_),
-          reinterpret_cast<char*>(&other->_impl_.actionid_));
+  swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ActionProc::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata InsertTcamEntryResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[27]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[46]);
 }
 
 // ===================================================================
 
-class SetActionProcReq::_Internal {
+class ModSramEntryReq::_Internal {
  public:
 };
 
-SetActionProcReq::SetActionProcReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ModSramEntryReq::ModSramEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.SetActionProcReq)
+  // @@protoc_insertion_point(arena_constructor:rp4.ModSramEntryReq)
 }
-SetActionProcReq::SetActionProcReq(const SetActionProcReq& from)
+ModSramEntryReq::ModSramEntryReq(const ModSramEntryReq& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetActionProcReq* const _this = this; (void)_this;
+  ModSramEntryReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.actionprocs_){from._impl_.actionprocs_}
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
     , decltype(_impl_.procid_){}
     , decltype(_impl_.matcherid_){}
+    , decltype(_impl_.key_byte_len_){}
+    , decltype(_impl_.value_byte_len_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
   ::memcpy(&_impl_.procid_, &from._impl_.procid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.matcherid_) -
-    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.matcherid_));
-  // @@protoc_insertion_point(copy_constructor:rp4.SetActionProcReq)
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.value_byte_len_) -
+    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.value_byte_len_));
+  // @@protoc_insertion_point(copy_constructor:rp4.ModSramEntryReq)
 }
 
-inline void SetActionProcReq::SharedCtor(
+inline void ModSramEntryReq::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.actionprocs_){arena}
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
     , decltype(_impl_.procid_){0}
     , decltype(_impl_.matcherid_){0}
+    , decltype(_impl_.key_byte_len_){0}
+    , decltype(_impl_.value_byte_len_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SetActionProcReq::~SetActionProcReq() {
-  // @@protoc_insertion_point(destructor:rp4.SetActionProcReq)
+ModSramEntryReq::~ModSramEntryReq() {
+  // @@protoc_insertion_point(destructor:rp4.ModSramEntryReq)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -8168,29 +14058,31 @@ SetActionProcReq::~SetActionProcReq() {
   SharedDtor();
 }
 
-inline void SetActionProcReq::SharedDtor() {
+inline void ModSramEntryReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.actionprocs_.~RepeatedPtrField();
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
 }
 
-void SetActionProcReq::SetCachedSize(int size) const {
+void ModSramEntryReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetActionProcReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.SetActionProcReq)
+void ModSramEntryReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ModSramEntryReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.actionprocs_.Clear();
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
   ::memset(&_impl_.procid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.matcherid_) -
-      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.matcherid_));
+      reinterpret_cast<char*>(&_impl_.value_byte_len_) -
+      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.value_byte_len_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetActionProcReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ModSramEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -8212,16 +14104,37 @@ const char* SetActionProcReq::_InternalParse(const char* ptr, ::_pbi::ParseConte
         } else
           goto handle_unusual;
         continue;
-      // repeated .rp4.ActionProc actionProcs = 3;
+      // bytes key = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_actionprocs(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 key_byte_len = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.key_byte_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 value_byte_len = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.value_byte_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -8248,9 +14161,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetActionProcReq::_InternalSerialize(
+uint8_t* ModSramEntryReq::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetActionProcReq)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ModSramEntryReq)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -8266,35 +14179,58 @@ uint8_t* SetActionProcReq::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_matcherid(), target);
   }
 
-  // repeated .rp4.ActionProc actionProcs = 3;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_actionprocs_size()); i < n; i++) {
-    const auto& repfield = this->_internal_actionprocs(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  // bytes key = 3;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_key(), target);
+  }
+
+  // bytes value = 4;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_value(), target);
+  }
+
+  // int32 key_byte_len = 5;
+  if (this->_internal_key_byte_len() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_key_byte_len(), target);
+  }
+
+  // int32 value_byte_len = 6;
+  if (this->_internal_value_byte_len() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_value_byte_len(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetActionProcReq)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ModSramEntryReq)
   return target;
 }
 
-size_t SetActionProcReq::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.SetActionProcReq)
+size_t ModSramEntryReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ModSramEntryReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .rp4.ActionProc actionProcs = 3;
-  total_size += 1UL * this->_internal_actionprocs_size();
-  for (const auto& msg : this->_impl_.actionprocs_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // bytes key = 3;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes value = 4;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
   }
 
   // int32 procId = 1;
@@ -8307,88 +14243,118 @@ size_t SetActionProcReq::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_matcherid());
   }
 
+  // int32 key_byte_len = 5;
+  if (this->_internal_key_byte_len() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_key_byte_len());
+  }
+
+  // int32 value_byte_len = 6;
+  if (this->_internal_value_byte_len() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_value_byte_len());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetActionProcReq::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModSramEntryReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetActionProcReq::MergeImpl
+    ModSramEntryReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetActionProcReq::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModSramEntryReq::GetClassData() const { return &_class_data_; }
 
 
-void SetActionProcReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetActionProcReq*>(&to_msg);
-  auto& from = static_cast<const SetActionProcReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetActionProcReq)
+void ModSramEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ModSramEntryReq*>(&to_msg);
+  auto& from = static_cast<const ModSramEntryReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ModSramEntryReq)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.actionprocs_.MergeFrom(from._impl_.actionprocs_);
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
   if (from._internal_procid() != 0) {
     _this->_internal_set_procid(from._internal_procid());
   }
   if (from._internal_matcherid() != 0) {
     _this->_internal_set_matcherid(from._internal_matcherid());
   }
+  if (from._internal_key_byte_len() != 0) {
+    _this->_internal_set_key_byte_len(from._internal_key_byte_len());
+  }
+  if (from._internal_value_byte_len() != 0) {
+    _this->_internal_set_value_byte_len(from._internal_value_byte_len());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetActionProcReq::CopyFrom(const SetActionProcReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetActionProcReq)
+void ModSramEntryReq::CopyFrom(const ModSramEntryReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ModSramEntryReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetActionProcReq::IsInitialized() const {
+bool ModSramEntryReq::IsInitialized() const {
   return true;
 }
 
-void SetActionProcReq::InternalSwap(SetActionProcReq* other) {
+void ModSramEntryReq::InternalSwap(ModSramEntryReq* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.actionprocs_.InternalSwap(&other->_impl_.actionprocs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SetActionProcReq, _impl_.matcherid_)
-      + sizeof(SetActionProcReq::_impl_.matcherid_)
-      - PROTOBUF_FIELD_OFFSET(SetActionProcReq, _impl_.procid_)>(
+      PROTOBUF_FIELD_OFFSET(ModSramEntryReq, _impl_.value_byte_len_)
+      + sizeof(ModSramEntryReq::_impl_.value_byte_len_)
+      - PROTOBUF_FIELD_OFFSET(ModSramEntryReq, _impl_.procid_)>(
           reinterpret_cast<char*>(&_impl_.procid_),
           reinterpret_cast<char*>(&other->_impl_.procid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetActionProcReq::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ModSramEntryReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[28]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[47]);
 }
 
 // ===================================================================
 
-class SetActionProcResp::_Internal {
+class ModSramEntryResp::_Internal {
  public:
 };
 
-SetActionProcResp::SetActionProcResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ModSramEntryResp::ModSramEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.SetActionProcResp)
+  // @@protoc_insertion_point(arena_constructor:rp4.ModSramEntryResp)
 }
-SetActionProcResp::SetActionProcResp(const SetActionProcResp& from)
+ModSramEntryResp::ModSramEntryResp(const ModSramEntryResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetActionProcResp* const _this = this; (void)_this;
+  ModSramEntryResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.res_ = from._impl_.res_;
-  // @@protoc_insertion_point(copy_constructor:rp4.SetActionProcResp)
+  // @@protoc_insertion_point(copy_constructor:rp4.ModSramEntryResp)
 }
 
-inline void SetActionProcResp::SharedCtor(
+inline void ModSramEntryResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -8398,8 +14364,8 @@ inline void SetActionProcResp::SharedCtor(
   };
 }
 
-SetActionProcResp::~SetActionProcResp() {
-  // @@protoc_insertion_point(destructor:rp4.SetActionProcResp)
+ModSramEntryResp::~ModSramEntryResp() {
+  // @@protoc_insertion_point(destructor:rp4.ModSramEntryResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -8407,16 +14373,16 @@ SetActionProcResp::~SetActionProcResp() {
   SharedDtor();
 }
 
-inline void SetActionProcResp::SharedDtor() {
+inline void ModSramEntryResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void SetActionProcResp::SetCachedSize(int size) const {
+void ModSramEntryResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetActionProcResp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.SetActionProcResp)
+void ModSramEntryResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ModSramEntryResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -8425,7 +14391,7 @@ void SetActionProcResp::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetActionProcResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ModSramEntryResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -8463,9 +14429,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetActionProcResp::_InternalSerialize(
+uint8_t* ModSramEntryResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetActionProcResp)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ModSramEntryResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -8480,12 +14446,12 @@ uint8_t* SetActionProcResp::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetActionProcResp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ModSramEntryResp)
   return target;
 }
 
-size_t SetActionProcResp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.SetActionProcResp)
+size_t ModSramEntryResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ModSramEntryResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -8501,17 +14467,17 @@ size_t SetActionProcResp::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetActionProcResp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModSramEntryResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetActionProcResp::MergeImpl
+    ModSramEntryResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetActionProcResp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModSramEntryResp::GetClassData() const { return &_class_data_; }
 
 
-void SetActionProcResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetActionProcResp*>(&to_msg);
-  auto& from = static_cast<const SetActionProcResp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetActionProcResp)
+void ModSramEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ModSramEntryResp*>(&to_msg);
+  auto& from = static_cast<const ModSramEntryResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ModSramEntryResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -8522,107 +14488,85 @@ void SetActionProcResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, cons
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetActionProcResp::CopyFrom(const SetActionProcResp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetActionProcResp)
+void ModSramEntryResp::CopyFrom(const ModSramEntryResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ModSramEntryResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetActionProcResp::IsInitialized() const {
+bool ModSramEntryResp::IsInitialized() const {
   return true;
 }
 
-void SetActionProcResp::InternalSwap(SetActionProcResp* other) {
+void ModSramEntryResp::InternalSwap(ModSramEntryResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetActionProcResp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ModSramEntryResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[29]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[48]);
 }
 
 // ===================================================================
 
-class SetMemConfigReq::_Internal {
+class DelSramEntryReq::_Internal {
  public:
 };
 
-SetMemConfigReq::SetMemConfigReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+DelSramEntryReq::DelSramEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.SetMemConfigReq)
+  // @@protoc_insertion_point(arena_constructor:rp4.DelSramEntryReq)
 }
-SetMemConfigReq::SetMemConfigReq(const SetMemConfigReq& from)
+DelSramEntryReq::DelSramEntryReq(const DelSramEntryReq& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetMemConfigReq* const _this = this; (void)_this;
+  DelSramEntryReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.keyconfig_){}
-    , decltype(_impl_.valueconfig_){}
+      decltype(_impl_.key_){}
     , decltype(_impl_.procid_){}
     , decltype(_impl_.matcherid_){}
-    , decltype(_impl_.keywidth_){}
-    , decltype(_impl_.valuewidth_){}
-    , decltype(_impl_.matchtype_){}
-    , decltype(_impl_.depth_){}
-    , decltype(_impl_.missactid_){}
+    , decltype(_impl_.key_byte_len_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.keyconfig_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.keyconfig_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_keyconfig().empty()) {
-    _this->_impl_.keyconfig_.Set(from._internal_keyconfig(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.valueconfig_.InitDefault();
+  _impl_.key_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.valueconfig_.Set("", GetArenaForAllocation());
+    _impl_.key_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_valueconfig().empty()) {
-    _this->_impl_.valueconfig_.Set(from._internal_valueconfig(), 
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.procid_, &from._impl_.procid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.missactid_) -
-    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.missactid_));
-  // @@protoc_insertion_point(copy_constructor:rp4.SetMemConfigReq)
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.key_byte_len_) -
+    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.key_byte_len_));
+  // @@protoc_insertion_point(copy_constructor:rp4.DelSramEntryReq)
 }
 
-inline void SetMemConfigReq::SharedCtor(
+inline void DelSramEntryReq::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.keyconfig_){}
-    , decltype(_impl_.valueconfig_){}
+      decltype(_impl_.key_){}
     , decltype(_impl_.procid_){0}
     , decltype(_impl_.matcherid_){0}
-    , decltype(_impl_.keywidth_){0}
-    , decltype(_impl_.valuewidth_){0}
-    , decltype(_impl_.matchtype_){0}
-    , decltype(_impl_.depth_){0}
-    , decltype(_impl_.missactid_){0}
+    , decltype(_impl_.key_byte_len_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.keyconfig_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.keyconfig_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.valueconfig_.InitDefault();
+  _impl_.key_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.valueconfig_.Set("", GetArenaForAllocation());
+    _impl_.key_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SetMemConfigReq::~SetMemConfigReq() {
-  // @@protoc_insertion_point(destructor:rp4.SetMemConfigReq)
+DelSramEntryReq::~DelSramEntryReq() {
+  // @@protoc_insertion_point(destructor:rp4.DelSramEntryReq)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -8630,31 +14574,29 @@ SetMemConfigReq::~SetMemConfigReq() {
   SharedDtor();
 }
 
-inline void SetMemConfigReq::SharedDtor() {
+inline void DelSramEntryReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.keyconfig_.Destroy();
-  _impl_.valueconfig_.Destroy();
+  _impl_.key_.Destroy();
 }
 
-void SetMemConfigReq::SetCachedSize(int size) const {
+void DelSramEntryReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetMemConfigReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.SetMemConfigReq)
+void DelSramEntryReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.DelSramEntryReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.keyconfig_.ClearToEmpty();
-  _impl_.valueconfig_.ClearToEmpty();
+  _impl_.key_.ClearToEmpty();
   ::memset(&_impl_.procid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.missactid_) -
-      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.missactid_));
+      reinterpret_cast<char*>(&_impl_.key_byte_len_) -
+      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.key_byte_len_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetMemConfigReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* DelSramEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -8676,61 +14618,19 @@ const char* SetMemConfigReq::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
-      // int32 keyWidth = 3;
+      // bytes key = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.keywidth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // int32 valueWidth = 4;
+      // int32 key_byte_len = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          _impl_.valuewidth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // bytes keyConfig = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          auto str = _internal_mutable_keyconfig();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // bytes valueConfig = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
-          auto str = _internal_mutable_valueconfig();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .rp4.MatchType matchType = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-          _internal_set_matchtype(static_cast<::rp4::MatchType>(val));
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 depth = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
-          _impl_.depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 missActId = 9;
-      case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
-          _impl_.missactid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.key_byte_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -8758,9 +14658,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetMemConfigReq::_InternalSerialize(
+uint8_t* DelSramEntryReq::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetMemConfigReq)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.DelSramEntryReq)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -8776,77 +14676,39 @@ uint8_t* SetMemConfigReq::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_matcherid(), target);
   }
 
-  // int32 keyWidth = 3;
-  if (this->_internal_keywidth() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_keywidth(), target);
-  }
-
-  // int32 valueWidth = 4;
-  if (this->_internal_valuewidth() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_valuewidth(), target);
-  }
-
-  // bytes keyConfig = 5;
-  if (!this->_internal_keyconfig().empty()) {
-    target = stream->WriteBytesMaybeAliased(
-        5, this->_internal_keyconfig(), target);
-  }
-
-  // bytes valueConfig = 6;
-  if (!this->_internal_valueconfig().empty()) {
+  // bytes key = 3;
+  if (!this->_internal_key().empty()) {
     target = stream->WriteBytesMaybeAliased(
-        6, this->_internal_valueconfig(), target);
-  }
-
-  // .rp4.MatchType matchType = 7;
-  if (this->_internal_matchtype() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      7, this->_internal_matchtype(), target);
-  }
-
-  // int32 depth = 8;
-  if (this->_internal_depth() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_depth(), target);
+        3, this->_internal_key(), target);
   }
 
-  // int32 missActId = 9;
-  if (this->_internal_missactid() != 0) {
+  // int32 key_byte_len = 4;
+  if (this->_internal_key_byte_len() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_missactid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_key_byte_len(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetMemConfigReq)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.DelSramEntryReq)
   return target;
 }
 
-size_t SetMemConfigReq::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.SetMemConfigReq)
+size_t DelSramEntryReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.DelSramEntryReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // bytes keyConfig = 5;
-  if (!this->_internal_keyconfig().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_keyconfig());
-  }
-
-  // bytes valueConfig = 6;
-  if (!this->_internal_valueconfig().empty()) {
+  // bytes key = 3;
+  if (!this->_internal_key().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_valueconfig());
+        this->_internal_key());
   }
 
   // int32 procId = 1;
@@ -8859,55 +14721,31 @@ size_t SetMemConfigReq::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_matcherid());
   }
 
-  // int32 keyWidth = 3;
-  if (this->_internal_keywidth() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_keywidth());
-  }
-
-  // int32 valueWidth = 4;
-  if (this->_internal_valuewidth() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_valuewidth());
-  }
-
-  // .rp4.MatchType matchType = 7;
-  if (this->_internal_matchtype() != 0) {
-    total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_matchtype());
-  }
-
-  // int32 depth = 8;
-  if (this->_internal_depth() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_depth());
-  }
-
-  // int32 missActId = 9;
-  if (this->_internal_missactid() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_missactid());
+  // int32 key_byte_len = 4;
+  if (this->_internal_key_byte_len() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_key_byte_len());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetMemConfigReq::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DelSramEntryReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetMemConfigReq::MergeImpl
+    DelSramEntryReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetMemConfigReq::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DelSramEntryReq::GetClassData() const { return &_class_data_; }
 
 
-void SetMemConfigReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetMemConfigReq*>(&to_msg);
-  auto& from = static_cast<const SetMemConfigReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetMemConfigReq)
+void DelSramEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DelSramEntryReq*>(&to_msg);
+  auto& from = static_cast<const DelSramEntryReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.DelSramEntryReq)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_keyconfig().empty()) {
-    _this->_internal_set_keyconfig(from._internal_keyconfig());
-  }
-  if (!from._internal_valueconfig().empty()) {
-    _this->_internal_set_valueconfig(from._internal_valueconfig());
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
   }
   if (from._internal_procid() != 0) {
     _this->_internal_set_procid(from._internal_procid());
@@ -8915,98 +14753,86 @@ void SetMemConfigReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   if (from._internal_matcherid() != 0) {
     _this->_internal_set_matcherid(from._internal_matcherid());
   }
-  if (from._internal_keywidth() != 0) {
-    _this->_internal_set_keywidth(from._internal_keywidth());
-  }
-  if (from._internal_valuewidth() != 0) {
-    _this->_internal_set_valuewidth(from._internal_valuewidth());
-  }
-  if (from._internal_matchtype() != 0) {
-    _this->_internal_set_matchtype(from._internal_matchtype());
-  }
-  if (from._internal_depth() != 0) {
-    _this->_internal_set_depth(from._internal_depth());
-  }
-  if (from._internal_missactid() != 0) {
-    _this->_internal_set_missactid(from._internal_missactid());
+  if (from._internal_key_byte_len() != 0) {
+    _this->_internal_set_key_byte_len(from._internal_key_byte_len());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetMemConfigReq::CopyFrom(const SetMemConfigReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetMemConfigReq)
+void DelSramEntryReq::CopyFrom(const DelSramEntryReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.DelSramEntryReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetMemConfigReq::IsInitialized() const {
+bool DelSramEntryReq::IsInitialized() const {
   return true;
 }
 
-void SetMemConfigReq::InternalSwap(SetMemConfigReq* other) {
+void DelSramEntryReq::InternalSwap(DelSramEntryReq* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.keyconfig_, lhs_arena,
-      &other->_impl_.keyconfig_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.valueconfig_, lhs_arena,
-      &other->_impl_.valueconfig_, rhs_arena
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SetMemConfigReq, _impl_.missactid_)
-      + sizeof(SetMemConfigReq::_impl_.missactid_)
-      - PROTOBUF_FIELD_OFFSET(SetMemConfigReq, _impl_.procid_)>(
+      PROTOBUF_FIELD_OFFSET(DelSramEntryReq, _impl_.key_byte_len_)
+      + sizeof(DelSramEntryReq::_impl_.key_byte_len_)
+      - PROTOBUF_FIELD_OFFSET(DelSramEntryReq, _impl_.procid_)>(
           reinterpret_cast<char*>(&_impl_.procid_),
           reinterpret_cast<char*>(&other->_impl_.procid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetMemConfigReq::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata DelSramEntryReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[30]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[49]);
 }
 
 // ===================================================================
 
-class SetMemConfigResp::_Internal {
+class DelSramEntryResp::_Internal {
  public:
 };
 
-SetMemConfigResp::SetMemConfigResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+DelSramEntryResp::DelSramEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.SetMemConfigResp)
+  // @@protoc_insertion_point(arena_constructor:rp4.DelSramEntryResp)
 }
-SetMemConfigResp::SetMemConfigResp(const SetMemConfigResp& from)
+DelSramEntryResp::DelSramEntryResp(const DelSramEntryResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetMemConfigResp* const _this = this; (void)_this;
+  DelSramEntryResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.res_){}
+    , decltype(_impl_.occupancy_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.res_ = from._impl_.res_;
-  // @@protoc_insertion_point(copy_constructor:rp4.SetMemConfigResp)
+  ::memcpy(&_impl_.res_, &from._impl_.res_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.occupancy_) -
+    reinterpret_cast<char*>(&_impl_.res_)) + sizeof(_impl_.occupancy_));
+  // @@protoc_insertion_point(copy_constructor:rp4.DelSramEntryResp)
 }
 
-inline void SetMemConfigResp::SharedCtor(
+inline void DelSramEntryResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.res_){0}
+    , decltype(_impl_.occupancy_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-SetMemConfigResp::~SetMemConfigResp() {
-  // @@protoc_insertion_point(destructor:rp4.SetMemConfigResp)
+DelSramEntryResp::~DelSramEntryResp() {
+  // @@protoc_insertion_point(destructor:rp4.DelSramEntryResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -9014,25 +14840,27 @@ SetMemConfigResp::~SetMemConfigResp() {
   SharedDtor();
 }
 
-inline void SetMemConfigResp::SharedDtor() {
+inline void DelSramEntryResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void SetMemConfigResp::SetCachedSize(int size) const {
+void DelSramEntryResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetMemConfigResp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.SetMemConfigResp)
+void DelSramEntryResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.DelSramEntryResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.res_ = 0;
+  ::memset(&_impl_.res_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.occupancy_) -
+      reinterpret_cast<char*>(&_impl_.res_)) + sizeof(_impl_.occupancy_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetMemConfigResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* DelSramEntryResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -9047,6 +14875,14 @@ const char* SetMemConfigResp::_InternalParse(const char* ptr, ::_pbi::ParseConte
         } else
           goto handle_unusual;
         continue;
+      // int32 occupancy = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.occupancy_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -9070,9 +14906,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetMemConfigResp::_InternalSerialize(
+uint8_t* DelSramEntryResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetMemConfigResp)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.DelSramEntryResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -9083,16 +14919,22 @@ uint8_t* SetMemConfigResp::_InternalSerialize(
       1, this->_internal_res(), target);
   }
 
+  // int32 occupancy = 2;
+  if (this->_internal_occupancy() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_occupancy(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetMemConfigResp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.DelSramEntryResp)
   return target;
 }
 
-size_t SetMemConfigResp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.SetMemConfigResp)
+size_t DelSramEntryResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.DelSramEntryResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -9105,20 +14947,25 @@ size_t SetMemConfigResp::ByteSizeLong() const {
       ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
   }
 
+  // int32 occupancy = 2;
+  if (this->_internal_occupancy() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_occupancy());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetMemConfigResp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DelSramEntryResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetMemConfigResp::MergeImpl
+    DelSramEntryResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetMemConfigResp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DelSramEntryResp::GetClassData() const { return &_class_data_; }
 
 
-void SetMemConfigResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetMemConfigResp*>(&to_msg);
-  auto& from = static_cast<const SetMemConfigResp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetMemConfigResp)
+void DelSramEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DelSramEntryResp*>(&to_msg);
+  auto& from = static_cast<const DelSramEntryResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.DelSramEntryResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -9126,74 +14973,126 @@ void SetMemConfigResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   if (from._internal_res() != 0) {
     _this->_internal_set_res(from._internal_res());
   }
+  if (from._internal_occupancy() != 0) {
+    _this->_internal_set_occupancy(from._internal_occupancy());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetMemConfigResp::CopyFrom(const SetMemConfigResp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetMemConfigResp)
+void DelSramEntryResp::CopyFrom(const DelSramEntryResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.DelSramEntryResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetMemConfigResp::IsInitialized() const {
+bool DelSramEntryResp::IsInitialized() const {
   return true;
 }
 
-void SetMemConfigResp::InternalSwap(SetMemConfigResp* other) {
+void DelSramEntryResp::InternalSwap(DelSramEntryResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.res_, other->_impl_.res_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DelSramEntryResp, _impl_.occupancy_)
+      + sizeof(DelSramEntryResp::_impl_.occupancy_)
+      - PROTOBUF_FIELD_OFFSET(DelSramEntryResp, _impl_.res_)>(
+          reinterpret_cast<char*>(&_impl_.res_),
+          reinterpret_cast<char*>(&other->_impl_.res_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetMemConfigResp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata DelSramEntryResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[31]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[50]);
 }
 
 // ===================================================================
 
-class SetFieldInfoReq::_Internal {
+class ModTcamEntryReq::_Internal {
  public:
 };
 
-SetFieldInfoReq::SetFieldInfoReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ModTcamEntryReq::ModTcamEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.SetFieldInfoReq)
+  // @@protoc_insertion_point(arena_constructor:rp4.ModTcamEntryReq)
 }
-SetFieldInfoReq::SetFieldInfoReq(const SetFieldInfoReq& from)
+ModTcamEntryReq::ModTcamEntryReq(const ModTcamEntryReq& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetFieldInfoReq* const _this = this; (void)_this;
+  ModTcamEntryReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.fdinfos_){from._impl_.fdinfos_}
+      decltype(_impl_.key_){}
+    , decltype(_impl_.mask_){}
+    , decltype(_impl_.value_){}
     , decltype(_impl_.procid_){}
     , decltype(_impl_.matcherid_){}
+    , decltype(_impl_.key_byte_len_){}
+    , decltype(_impl_.value_byte_len_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.mask_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mask_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_mask().empty()) {
+    _this->_impl_.mask_.Set(from._internal_mask(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
   ::memcpy(&_impl_.procid_, &from._impl_.procid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.matcherid_) -
-    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.matcherid_));
-  // @@protoc_insertion_point(copy_constructor:rp4.SetFieldInfoReq)
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.value_byte_len_) -
+    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.value_byte_len_));
+  // @@protoc_insertion_point(copy_constructor:rp4.ModTcamEntryReq)
 }
 
-inline void SetFieldInfoReq::SharedCtor(
+inline void ModTcamEntryReq::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.fdinfos_){arena}
+      decltype(_impl_.key_){}
+    , decltype(_impl_.mask_){}
+    , decltype(_impl_.value_){}
     , decltype(_impl_.procid_){0}
     , decltype(_impl_.matcherid_){0}
+    , decltype(_impl_.key_byte_len_){0}
+    , decltype(_impl_.value_byte_len_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.mask_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mask_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SetFieldInfoReq::~SetFieldInfoReq() {
-  // @@protoc_insertion_point(destructor:rp4.SetFieldInfoReq)
+ModTcamEntryReq::~ModTcamEntryReq() {
+  // @@protoc_insertion_point(destructor:rp4.ModTcamEntryReq)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -9201,29 +15100,33 @@ SetFieldInfoReq::~SetFieldInfoReq() {
   SharedDtor();
 }
 
-inline void SetFieldInfoReq::SharedDtor() {
+inline void ModTcamEntryReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.fdinfos_.~RepeatedPtrField();
+  _impl_.key_.Destroy();
+  _impl_.mask_.Destroy();
+  _impl_.value_.Destroy();
 }
 
-void SetFieldInfoReq::SetCachedSize(int size) const {
+void ModTcamEntryReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetFieldInfoReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.SetFieldInfoReq)
+void ModTcamEntryReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ModTcamEntryReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.fdinfos_.Clear();
+  _impl_.key_.ClearToEmpty();
+  _impl_.mask_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
   ::memset(&_impl_.procid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.matcherid_) -
-      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.matcherid_));
+      reinterpret_cast<char*>(&_impl_.value_byte_len_) -
+      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.value_byte_len_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetFieldInfoReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ModTcamEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -9245,16 +15148,46 @@ const char* SetFieldInfoReq::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
-      // repeated .rp4.FieldInfo fdInfos = 3;
+      // bytes key = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_fdinfos(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes mask = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_mask();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes value = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 key_byte_len = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.key_byte_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 value_byte_len = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.value_byte_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -9281,9 +15214,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetFieldInfoReq::_InternalSerialize(
+uint8_t* ModTcamEntryReq::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetFieldInfoReq)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ModTcamEntryReq)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -9299,35 +15232,71 @@ uint8_t* SetFieldInfoReq::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_matcherid(), target);
   }
 
-  // repeated .rp4.FieldInfo fdInfos = 3;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_fdinfos_size()); i < n; i++) {
-    const auto& repfield = this->_internal_fdinfos(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  // bytes key = 3;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_key(), target);
+  }
+
+  // bytes mask = 4;
+  if (!this->_internal_mask().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_mask(), target);
+  }
+
+  // bytes value = 5;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_value(), target);
+  }
+
+  // int32 key_byte_len = 6;
+  if (this->_internal_key_byte_len() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_key_byte_len(), target);
+  }
+
+  // int32 value_byte_len = 7;
+  if (this->_internal_value_byte_len() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_value_byte_len(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetFieldInfoReq)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ModTcamEntryReq)
   return target;
 }
 
-size_t SetFieldInfoReq::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.SetFieldInfoReq)
+size_t ModTcamEntryReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ModTcamEntryReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .rp4.FieldInfo fdInfos = 3;
-  total_size += 1UL * this->_internal_fdinfos_size();
-  for (const auto& msg : this->_impl_.fdinfos_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // bytes key = 3;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes mask = 4;
+  if (!this->_internal_mask().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_mask());
+  }
+
+  // bytes value = 5;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
   }
 
   // int32 procId = 1;
@@ -9340,88 +15309,125 @@ size_t SetFieldInfoReq::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_matcherid());
   }
 
+  // int32 key_byte_len = 6;
+  if (this->_internal_key_byte_len() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_key_byte_len());
+  }
+
+  // int32 value_byte_len = 7;
+  if (this->_internal_value_byte_len() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_value_byte_len());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetFieldInfoReq::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModTcamEntryReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetFieldInfoReq::MergeImpl
+    ModTcamEntryReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetFieldInfoReq::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModTcamEntryReq::GetClassData() const { return &_class_data_; }
 
 
-void SetFieldInfoReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetFieldInfoReq*>(&to_msg);
-  auto& from = static_cast<const SetFieldInfoReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetFieldInfoReq)
+void ModTcamEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ModTcamEntryReq*>(&to_msg);
+  auto& from = static_cast<const ModTcamEntryReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ModTcamEntryReq)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.fdinfos_.MergeFrom(from._impl_.fdinfos_);
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_mask().empty()) {
+    _this->_internal_set_mask(from._internal_mask());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
   if (from._internal_procid() != 0) {
     _this->_internal_set_procid(from._internal_procid());
   }
   if (from._internal_matcherid() != 0) {
     _this->_internal_set_matcherid(from._internal_matcherid());
   }
+  if (from._internal_key_byte_len() != 0) {
+    _this->_internal_set_key_byte_len(from._internal_key_byte_len());
+  }
+  if (from._internal_value_byte_len() != 0) {
+    _this->_internal_set_value_byte_len(from._internal_value_byte_len());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetFieldInfoReq::CopyFrom(const SetFieldInfoReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetFieldInfoReq)
+void ModTcamEntryReq::CopyFrom(const ModTcamEntryReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ModTcamEntryReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetFieldInfoReq::IsInitialized() const {
+bool ModTcamEntryReq::IsInitialized() const {
   return true;
 }
 
-void SetFieldInfoReq::InternalSwap(SetFieldInfoReq* other) {
+void ModTcamEntryReq::InternalSwap(ModTcamEntryReq* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.fdinfos_.InternalSwap(&other->_impl_.fdinfos_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.mask_, lhs_arena,
+      &other->_impl_.mask_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SetFieldInfoReq, _impl_.matcherid_)
-      + sizeof(SetFieldInfoReq::_impl_.matcherid_)
-      - PROTOBUF_FIELD_OFFSET(SetFieldInfoReq, _impl_.procid_)>(
+      PROTOBUF_FIELD_OFFSET(ModTcamEntryReq, _impl_.value_byte_len_)
+      + sizeof(ModTcamEntryReq::_impl_.value_byte_len_)
+      - PROTOBUF_FIELD_OFFSET(ModTcamEntryReq, _impl_.procid_)>(
           reinterpret_cast<char*>(&_impl_.procid_),
           reinterpret_cast<char*>(&other->_impl_.procid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetFieldInfoReq::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ModTcamEntryReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[32]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[51]);
 }
 
 // ===================================================================
 
-class SetFieldInfoResp::_Internal {
+class ModTcamEntryResp::_Internal {
  public:
 };
 
-SetFieldInfoResp::SetFieldInfoResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ModTcamEntryResp::ModTcamEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.SetFieldInfoResp)
+  // @@protoc_insertion_point(arena_constructor:rp4.ModTcamEntryResp)
 }
-SetFieldInfoResp::SetFieldInfoResp(const SetFieldInfoResp& from)
+ModTcamEntryResp::ModTcamEntryResp(const ModTcamEntryResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetFieldInfoResp* const _this = this; (void)_this;
+  ModTcamEntryResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.res_ = from._impl_.res_;
-  // @@protoc_insertion_point(copy_constructor:rp4.SetFieldInfoResp)
+  // @@protoc_insertion_point(copy_constructor:rp4.ModTcamEntryResp)
 }
 
-inline void SetFieldInfoResp::SharedCtor(
+inline void ModTcamEntryResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -9431,8 +15437,8 @@ inline void SetFieldInfoResp::SharedCtor(
   };
 }
 
-SetFieldInfoResp::~SetFieldInfoResp() {
-  // @@protoc_insertion_point(destructor:rp4.SetFieldInfoResp)
+ModTcamEntryResp::~ModTcamEntryResp() {
+  // @@protoc_insertion_point(destructor:rp4.ModTcamEntryResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -9440,16 +15446,16 @@ SetFieldInfoResp::~SetFieldInfoResp() {
   SharedDtor();
 }
 
-inline void SetFieldInfoResp::SharedDtor() {
+inline void ModTcamEntryResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void SetFieldInfoResp::SetCachedSize(int size) const {
+void ModTcamEntryResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetFieldInfoResp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.SetFieldInfoResp)
+void ModTcamEntryResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.ModTcamEntryResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -9458,7 +15464,7 @@ void SetFieldInfoResp::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetFieldInfoResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ModTcamEntryResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -9496,9 +15502,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetFieldInfoResp::_InternalSerialize(
+uint8_t* ModTcamEntryResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.SetFieldInfoResp)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.ModTcamEntryResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -9513,12 +15519,12 @@ uint8_t* SetFieldInfoResp::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.SetFieldInfoResp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.ModTcamEntryResp)
   return target;
 }
 
-size_t SetFieldInfoResp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.SetFieldInfoResp)
+size_t ModTcamEntryResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.ModTcamEntryResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -9534,17 +15540,17 @@ size_t SetFieldInfoResp::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetFieldInfoResp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModTcamEntryResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetFieldInfoResp::MergeImpl
+    ModTcamEntryResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetFieldInfoResp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModTcamEntryResp::GetClassData() const { return &_class_data_; }
 
 
-void SetFieldInfoResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetFieldInfoResp*>(&to_msg);
-  auto& from = static_cast<const SetFieldInfoResp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.SetFieldInfoResp)
+void ModTcamEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ModTcamEntryResp*>(&to_msg);
+  auto& from = static_cast<const ModTcamEntryResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.ModTcamEntryResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -9555,51 +15561,50 @@ void SetFieldInfoResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetFieldInfoResp::CopyFrom(const SetFieldInfoResp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.SetFieldInfoResp)
+void ModTcamEntryResp::CopyFrom(const ModTcamEntryResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.ModTcamEntryResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetFieldInfoResp::IsInitialized() const {
+bool ModTcamEntryResp::IsInitialized() const {
   return true;
 }
 
-void SetFieldInfoResp::InternalSwap(SetFieldInfoResp* other) {
+void ModTcamEntryResp::InternalSwap(ModTcamEntryResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetFieldInfoResp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ModTcamEntryResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[33]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[52]);
 }
 
 // ===================================================================
 
-class InsertSramEntryReq::_Internal {
+class DelTcamEntryReq::_Internal {
  public:
 };
 
-InsertSramEntryReq::InsertSramEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+DelTcamEntryReq::DelTcamEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.InsertSramEntryReq)
+  // @@protoc_insertion_point(arena_constructor:rp4.DelTcamEntryReq)
 }
-InsertSramEntryReq::InsertSramEntryReq(const InsertSramEntryReq& from)
+DelTcamEntryReq::DelTcamEntryReq(const DelTcamEntryReq& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  InsertSramEntryReq* const _this = this; (void)_this;
+  DelTcamEntryReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.key_){}
-    , decltype(_impl_.value_){}
+    , decltype(_impl_.mask_){}
     , decltype(_impl_.procid_){}
     , decltype(_impl_.matcherid_){}
     , decltype(_impl_.key_byte_len_){}
-    , decltype(_impl_.value_byte_len_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -9611,45 +15616,44 @@ InsertSramEntryReq::InsertSramEntryReq(const InsertSramEntryReq& from)
     _this->_impl_.key_.Set(from._internal_key(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.value_.InitDefault();
+  _impl_.mask_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.value_.Set("", GetArenaForAllocation());
+    _impl_.mask_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_value().empty()) {
-    _this->_impl_.value_.Set(from._internal_value(), 
+  if (!from._internal_mask().empty()) {
+    _this->_impl_.mask_.Set(from._internal_mask(), 
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.procid_, &from._impl_.procid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.value_byte_len_) -
-    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.value_byte_len_));
-  // @@protoc_insertion_point(copy_constructor:rp4.InsertSramEntryReq)
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.key_byte_len_) -
+    reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.key_byte_len_));
+  // @@protoc_insertion_point(copy_constructor:rp4.DelTcamEntryReq)
 }
 
-inline void InsertSramEntryReq::SharedCtor(
+inline void DelTcamEntryReq::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.key_){}
-    , decltype(_impl_.value_){}
+    , decltype(_impl_.mask_){}
     , decltype(_impl_.procid_){0}
     , decltype(_impl_.matcherid_){0}
     , decltype(_impl_.key_byte_len_){0}
-    , decltype(_impl_.value_byte_len_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.key_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.key_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.value_.InitDefault();
+  _impl_.mask_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.value_.Set("", GetArenaForAllocation());
+    _impl_.mask_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-InsertSramEntryReq::~InsertSramEntryReq() {
-  // @@protoc_insertion_point(destructor:rp4.InsertSramEntryReq)
+DelTcamEntryReq::~DelTcamEntryReq() {
+  // @@protoc_insertion_point(destructor:rp4.DelTcamEntryReq)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -9657,31 +15661,31 @@ InsertSramEntryReq::~InsertSramEntryReq() {
   SharedDtor();
 }
 
-inline void InsertSramEntryReq::SharedDtor() {
+inline void DelTcamEntryReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.key_.Destroy();
-  _impl_.value_.Destroy();
+  _impl_.mask_.Destroy();
 }
 
-void InsertSramEntryReq::SetCachedSize(int size) const {
+void DelTcamEntryReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void InsertSramEntryReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.InsertSramEntryReq)
+void DelTcamEntryReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.DelTcamEntryReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.key_.ClearToEmpty();
-  _impl_.value_.ClearToEmpty();
+  _impl_.mask_.ClearToEmpty();
   ::memset(&_impl_.procid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.value_byte_len_) -
-      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.value_byte_len_));
+      reinterpret_cast<char*>(&_impl_.key_byte_len_) -
+      reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.key_byte_len_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* InsertSramEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* DelTcamEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -9712,10 +15716,10 @@ const char* InsertSramEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseCon
         } else
           goto handle_unusual;
         continue;
-      // bytes value = 4;
+      // bytes mask = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_value();
+          auto str = _internal_mutable_mask();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
@@ -9729,14 +15733,6 @@ const char* InsertSramEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseCon
         } else
           goto handle_unusual;
         continue;
-      // int32 value_byte_len = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
-          _impl_.value_byte_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -9760,9 +15756,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* InsertSramEntryReq::_InternalSerialize(
+uint8_t* DelTcamEntryReq::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.InsertSramEntryReq)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.DelTcamEntryReq)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -9784,10 +15780,10 @@ uint8_t* InsertSramEntryReq::_InternalSerialize(
         3, this->_internal_key(), target);
   }
 
-  // bytes value = 4;
-  if (!this->_internal_value().empty()) {
+  // bytes mask = 4;
+  if (!this->_internal_mask().empty()) {
     target = stream->WriteBytesMaybeAliased(
-        4, this->_internal_value(), target);
+        4, this->_internal_mask(), target);
   }
 
   // int32 key_byte_len = 5;
@@ -9796,22 +15792,16 @@ uint8_t* InsertSramEntryReq::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_key_byte_len(), target);
   }
 
-  // int32 value_byte_len = 6;
-  if (this->_internal_value_byte_len() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_value_byte_len(), target);
-  }
-
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.InsertSramEntryReq)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.DelTcamEntryReq)
   return target;
 }
 
-size_t InsertSramEntryReq::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.InsertSramEntryReq)
+size_t DelTcamEntryReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.DelTcamEntryReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -9825,11 +15815,11 @@ size_t InsertSramEntryReq::ByteSizeLong() const {
         this->_internal_key());
   }
 
-  // bytes value = 4;
-  if (!this->_internal_value().empty()) {
+  // bytes mask = 4;
+  if (!this->_internal_mask().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_value());
+        this->_internal_mask());
   }
 
   // int32 procId = 1;
@@ -9847,25 +15837,20 @@ size_t InsertSramEntryReq::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_key_byte_len());
   }
 
-  // int32 value_byte_len = 6;
-  if (this->_internal_value_byte_len() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_value_byte_len());
-  }
-
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertSramEntryReq::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DelTcamEntryReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    InsertSramEntryReq::MergeImpl
+    DelTcamEntryReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertSramEntryReq::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DelTcamEntryReq::GetClassData() const { return &_class_data_; }
 
 
-void InsertSramEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<InsertSramEntryReq*>(&to_msg);
-  auto& from = static_cast<const InsertSramEntryReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.InsertSramEntryReq)
+void DelTcamEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DelTcamEntryReq*>(&to_msg);
+  auto& from = static_cast<const DelTcamEntryReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.DelTcamEntryReq)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -9873,8 +15858,8 @@ void InsertSramEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, con
   if (!from._internal_key().empty()) {
     _this->_internal_set_key(from._internal_key());
   }
-  if (!from._internal_value().empty()) {
-    _this->_internal_set_value(from._internal_value());
+  if (!from._internal_mask().empty()) {
+    _this->_internal_set_mask(from._internal_mask());
   }
   if (from._internal_procid() != 0) {
     _this->_internal_set_procid(from._internal_procid());
@@ -9885,24 +15870,21 @@ void InsertSramEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, con
   if (from._internal_key_byte_len() != 0) {
     _this->_internal_set_key_byte_len(from._internal_key_byte_len());
   }
-  if (from._internal_value_byte_len() != 0) {
-    _this->_internal_set_value_byte_len(from._internal_value_byte_len());
-  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InsertSramEntryReq::CopyFrom(const InsertSramEntryReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.InsertSramEntryReq)
+void DelTcamEntryReq::CopyFrom(const DelTcamEntryReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.DelTcamEntryReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InsertSramEntryReq::IsInitialized() const {
+bool DelTcamEntryReq::IsInitialized() const {
   return true;
 }
 
-void InsertSramEntryReq::InternalSwap(InsertSramEntryReq* other) {
+void DelTcamEntryReq::InternalSwap(DelTcamEntryReq* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
@@ -9912,48 +15894,48 @@ void InsertSramEntryReq::InternalSwap(InsertSramEntryReq* other) {
       &other->_impl_.key_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.value_, lhs_arena,
-      &other->_impl_.value_, rhs_arena
+      &_impl_.mask_, lhs_arena,
+      &other->_impl_.mask_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(InsertSramEntryReq, _impl_.value_byte_len_)
-      + sizeof(InsertSramEntryReq::_impl_.value_byte_len_)
-      - PROTOBUF_FIELD_OFFSET(InsertSramEntryReq, _impl_.procid_)>(
+      PROTOBUF_FIELD_OFFSET(DelTcamEntryReq, _impl_.key_byte_len_)
+      + sizeof(DelTcamEntryReq::_impl_.key_byte_len_)
+      - PROTOBUF_FIELD_OFFSET(DelTcamEntryReq, _impl_.procid_)>(
           reinterpret_cast<char*>(&_impl_.procid_),
           reinterpret_cast<char*>(&other->_impl_.procid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata InsertSramEntryReq::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata DelTcamEntryReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[34]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[53]);
 }
 
 // ===================================================================
 
-class InsertSramEntryResp::_Internal {
+class DelTcamEntryResp::_Internal {
  public:
 };
 
-InsertSramEntryResp::InsertSramEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+DelTcamEntryResp::DelTcamEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.InsertSramEntryResp)
+  // @@protoc_insertion_point(arena_constructor:rp4.DelTcamEntryResp)
 }
-InsertSramEntryResp::InsertSramEntryResp(const InsertSramEntryResp& from)
+DelTcamEntryResp::DelTcamEntryResp(const DelTcamEntryResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  InsertSramEntryResp* const _this = this; (void)_this;
+  DelTcamEntryResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.res_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.res_ = from._impl_.res_;
-  // @@protoc_insertion_point(copy_constructor:rp4.InsertSramEntryResp)
+  // @@protoc_insertion_point(copy_constructor:rp4.DelTcamEntryResp)
 }
 
-inline void InsertSramEntryResp::SharedCtor(
+inline void DelTcamEntryResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -9963,8 +15945,8 @@ inline void InsertSramEntryResp::SharedCtor(
   };
 }
 
-InsertSramEntryResp::~InsertSramEntryResp() {
-  // @@protoc_insertion_point(destructor:rp4.InsertSramEntryResp)
+DelTcamEntryResp::~DelTcamEntryResp() {
+  // @@protoc_insertion_point(destructor:rp4.DelTcamEntryResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -9972,16 +15954,16 @@ InsertSramEntryResp::~InsertSramEntryResp() {
   SharedDtor();
 }
 
-inline void InsertSramEntryResp::SharedDtor() {
+inline void DelTcamEntryResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void InsertSramEntryResp::SetCachedSize(int size) const {
+void DelTcamEntryResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void InsertSramEntryResp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.InsertSramEntryResp)
+void DelTcamEntryResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.DelTcamEntryResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -9990,7 +15972,7 @@ void InsertSramEntryResp::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* InsertSramEntryResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* DelTcamEntryResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -10028,9 +16010,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* InsertSramEntryResp::_InternalSerialize(
+uint8_t* DelTcamEntryResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.InsertSramEntryResp)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.DelTcamEntryResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -10045,12 +16027,12 @@ uint8_t* InsertSramEntryResp::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.InsertSramEntryResp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.DelTcamEntryResp)
   return target;
 }
 
-size_t InsertSramEntryResp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.InsertSramEntryResp)
+size_t DelTcamEntryResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.DelTcamEntryResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -10066,17 +16048,17 @@ size_t InsertSramEntryResp::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertSramEntryResp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DelTcamEntryResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    InsertSramEntryResp::MergeImpl
+    DelTcamEntryResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertSramEntryResp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DelTcamEntryResp::GetClassData() const { return &_class_data_; }
 
 
-void InsertSramEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<InsertSramEntryResp*>(&to_msg);
-  auto& from = static_cast<const InsertSramEntryResp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.InsertSramEntryResp)
+void DelTcamEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DelTcamEntryResp*>(&to_msg);
+  auto& from = static_cast<const DelTcamEntryResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.DelTcamEntryResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -10087,115 +16069,89 @@ void InsertSramEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, co
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InsertSramEntryResp::CopyFrom(const InsertSramEntryResp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.InsertSramEntryResp)
+void DelTcamEntryResp::CopyFrom(const DelTcamEntryResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.DelTcamEntryResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InsertSramEntryResp::IsInitialized() const {
+bool DelTcamEntryResp::IsInitialized() const {
   return true;
 }
 
-void InsertSramEntryResp::InternalSwap(InsertSramEntryResp* other) {
+void DelTcamEntryResp::InternalSwap(DelTcamEntryResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_.res_, other->_impl_.res_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata InsertSramEntryResp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata DelTcamEntryResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[35]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[54]);
 }
 
 // ===================================================================
 
-class InsertTcamEntryReq::_Internal {
+class InsertEntriesReq::_Internal {
  public:
 };
 
-InsertTcamEntryReq::InsertTcamEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+InsertEntriesReq::InsertEntriesReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.InsertTcamEntryReq)
+  // @@protoc_insertion_point(arena_constructor:rp4.InsertEntriesReq)
 }
-InsertTcamEntryReq::InsertTcamEntryReq(const InsertTcamEntryReq& from)
+InsertEntriesReq::InsertEntriesReq(const InsertEntriesReq& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  InsertTcamEntryReq* const _this = this; (void)_this;
+  InsertEntriesReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.key_){}
-    , decltype(_impl_.mask_){}
-    , decltype(_impl_.value_){}
+      decltype(_impl_.entries_){}
     , decltype(_impl_.procid_){}
     , decltype(_impl_.matcherid_){}
+    , decltype(_impl_.ternary_){}
     , decltype(_impl_.key_byte_len_){}
     , decltype(_impl_.value_byte_len_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.key_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.key_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_key().empty()) {
-    _this->_impl_.key_.Set(from._internal_key(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.mask_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.mask_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_mask().empty()) {
-    _this->_impl_.mask_.Set(from._internal_mask(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.value_.InitDefault();
+  _impl_.entries_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.value_.Set("", GetArenaForAllocation());
+    _impl_.entries_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_value().empty()) {
-    _this->_impl_.value_.Set(from._internal_value(), 
+  if (!from._internal_entries().empty()) {
+    _this->_impl_.entries_.Set(from._internal_entries(), 
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.procid_, &from._impl_.procid_,
     static_cast<size_t>(reinterpret_cast<char*>(&_impl_.value_byte_len_) -
     reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.value_byte_len_));
-  // @@protoc_insertion_point(copy_constructor:rp4.InsertTcamEntryReq)
+  // @@protoc_insertion_point(copy_constructor:rp4.InsertEntriesReq)
 }
 
-inline void InsertTcamEntryReq::SharedCtor(
+inline void InsertEntriesReq::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.key_){}
-    , decltype(_impl_.mask_){}
-    , decltype(_impl_.value_){}
-    , decltype(_impl_.procid_){0}
-    , decltype(_impl_.matcherid_){0}
-    , decltype(_impl_.key_byte_len_){0}
-    , decltype(_impl_.value_byte_len_){0}
-    , /*decltype(_impl_._cached_size_)*/{}
-  };
-  _impl_.key_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.key_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.mask_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.mask_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.value_.InitDefault();
+      decltype(_impl_.entries_){}
+    , decltype(_impl_.procid_){0}
+    , decltype(_impl_.matcherid_){0}
+    , decltype(_impl_.ternary_){false}
+    , decltype(_impl_.key_byte_len_){0}
+    , decltype(_impl_.value_byte_len_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.entries_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.value_.Set("", GetArenaForAllocation());
+    _impl_.entries_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-InsertTcamEntryReq::~InsertTcamEntryReq() {
-  // @@protoc_insertion_point(destructor:rp4.InsertTcamEntryReq)
+InsertEntriesReq::~InsertEntriesReq() {
+  // @@protoc_insertion_point(destructor:rp4.InsertEntriesReq)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -10203,33 +16159,29 @@ InsertTcamEntryReq::~InsertTcamEntryReq() {
   SharedDtor();
 }
 
-inline void InsertTcamEntryReq::SharedDtor() {
+inline void InsertEntriesReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.key_.Destroy();
-  _impl_.mask_.Destroy();
-  _impl_.value_.Destroy();
+  _impl_.entries_.Destroy();
 }
 
-void InsertTcamEntryReq::SetCachedSize(int size) const {
+void InsertEntriesReq::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void InsertTcamEntryReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.InsertTcamEntryReq)
+void InsertEntriesReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.InsertEntriesReq)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.key_.ClearToEmpty();
-  _impl_.mask_.ClearToEmpty();
-  _impl_.value_.ClearToEmpty();
+  _impl_.entries_.ClearToEmpty();
   ::memset(&_impl_.procid_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&_impl_.value_byte_len_) -
       reinterpret_cast<char*>(&_impl_.procid_)) + sizeof(_impl_.value_byte_len_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* InsertTcamEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* InsertEntriesReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -10251,45 +16203,35 @@ const char* InsertTcamEntryReq::_InternalParse(const char* ptr, ::_pbi::ParseCon
         } else
           goto handle_unusual;
         continue;
-      // bytes key = 3;
+      // bool ternary = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_key();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.ternary_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // bytes mask = 4;
+      // int32 key_byte_len = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_mask();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.key_byte_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // bytes value = 5;
+      // int32 value_byte_len = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          auto str = _internal_mutable_value();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.value_byte_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // int32 key_byte_len = 6;
+      // bytes entries = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
-          _impl_.key_byte_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 value_byte_len = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
-          _impl_.value_byte_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_entries();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -10317,9 +16259,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* InsertTcamEntryReq::_InternalSerialize(
+uint8_t* InsertEntriesReq::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.InsertTcamEntryReq)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.InsertEntriesReq)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -10335,71 +16277,51 @@ uint8_t* InsertTcamEntryReq::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_matcherid(), target);
   }
 
-  // bytes key = 3;
-  if (!this->_internal_key().empty()) {
-    target = stream->WriteBytesMaybeAliased(
-        3, this->_internal_key(), target);
-  }
-
-  // bytes mask = 4;
-  if (!this->_internal_mask().empty()) {
-    target = stream->WriteBytesMaybeAliased(
-        4, this->_internal_mask(), target);
-  }
-
-  // bytes value = 5;
-  if (!this->_internal_value().empty()) {
-    target = stream->WriteBytesMaybeAliased(
-        5, this->_internal_value(), target);
+  // bool ternary = 3;
+  if (this->_internal_ternary() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_ternary(), target);
   }
 
-  // int32 key_byte_len = 6;
+  // int32 key_byte_len = 4;
   if (this->_internal_key_byte_len() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_key_byte_len(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_key_byte_len(), target);
   }
 
-  // int32 value_byte_len = 7;
+  // int32 value_byte_len = 5;
   if (this->_internal_value_byte_len() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_value_byte_len(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_value_byte_len(), target);
+  }
+
+  // bytes entries = 6;
+  if (!this->_internal_entries().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_entries(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.InsertTcamEntryReq)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.InsertEntriesReq)
   return target;
 }
 
-size_t InsertTcamEntryReq::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.InsertTcamEntryReq)
+size_t InsertEntriesReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.InsertEntriesReq)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // bytes key = 3;
-  if (!this->_internal_key().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_key());
-  }
-
-  // bytes mask = 4;
-  if (!this->_internal_mask().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_mask());
-  }
-
-  // bytes value = 5;
-  if (!this->_internal_value().empty()) {
+  // bytes entries = 6;
+  if (!this->_internal_entries().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_value());
+        this->_internal_entries());
   }
 
   // int32 procId = 1;
@@ -10412,12 +16334,17 @@ size_t InsertTcamEntryReq::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_matcherid());
   }
 
-  // int32 key_byte_len = 6;
+  // bool ternary = 3;
+  if (this->_internal_ternary() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 key_byte_len = 4;
   if (this->_internal_key_byte_len() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_key_byte_len());
   }
 
-  // int32 value_byte_len = 7;
+  // int32 value_byte_len = 5;
   if (this->_internal_value_byte_len() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_value_byte_len());
   }
@@ -10425,29 +16352,23 @@ size_t InsertTcamEntryReq::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertTcamEntryReq::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertEntriesReq::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    InsertTcamEntryReq::MergeImpl
+    InsertEntriesReq::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertTcamEntryReq::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertEntriesReq::GetClassData() const { return &_class_data_; }
 
 
-void InsertTcamEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<InsertTcamEntryReq*>(&to_msg);
-  auto& from = static_cast<const InsertTcamEntryReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.InsertTcamEntryReq)
+void InsertEntriesReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InsertEntriesReq*>(&to_msg);
+  auto& from = static_cast<const InsertEntriesReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.InsertEntriesReq)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_key().empty()) {
-    _this->_internal_set_key(from._internal_key());
-  }
-  if (!from._internal_mask().empty()) {
-    _this->_internal_set_mask(from._internal_mask());
-  }
-  if (!from._internal_value().empty()) {
-    _this->_internal_set_value(from._internal_value());
+  if (!from._internal_entries().empty()) {
+    _this->_internal_set_entries(from._internal_entries());
   }
   if (from._internal_procid() != 0) {
     _this->_internal_set_procid(from._internal_procid());
@@ -10455,6 +16376,9 @@ void InsertTcamEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, con
   if (from._internal_matcherid() != 0) {
     _this->_internal_set_matcherid(from._internal_matcherid());
   }
+  if (from._internal_ternary() != 0) {
+    _this->_internal_set_ternary(from._internal_ternary());
+  }
   if (from._internal_key_byte_len() != 0) {
     _this->_internal_set_key_byte_len(from._internal_key_byte_len());
   }
@@ -10464,84 +16388,82 @@ void InsertTcamEntryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, con
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InsertTcamEntryReq::CopyFrom(const InsertTcamEntryReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.InsertTcamEntryReq)
+void InsertEntriesReq::CopyFrom(const InsertEntriesReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.InsertEntriesReq)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InsertTcamEntryReq::IsInitialized() const {
+bool InsertEntriesReq::IsInitialized() const {
   return true;
 }
 
-void InsertTcamEntryReq::InternalSwap(InsertTcamEntryReq* other) {
+void InsertEntriesReq::InternalSwap(InsertEntriesReq* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.key_, lhs_arena,
-      &other->_impl_.key_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.mask_, lhs_arena,
-      &other->_impl_.mask_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.value_, lhs_arena,
-      &other->_impl_.value_, rhs_arena
+      &_impl_.entries_, lhs_arena,
+      &other->_impl_.entries_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(InsertTcamEntryReq, _impl_.value_byte_len_)
-      + sizeof(InsertTcamEntryReq::_impl_.value_byte_len_)
-      - PROTOBUF_FIELD_OFFSET(InsertTcamEntryReq, _impl_.procid_)>(
+      PROTOBUF_FIELD_OFFSET(InsertEntriesReq, _impl_.value_byte_len_)
+      + sizeof(InsertEntriesReq::_impl_.value_byte_len_)
+      - PROTOBUF_FIELD_OFFSET(InsertEntriesReq, _impl_.procid_)>(
           reinterpret_cast<char*>(&_impl_.procid_),
           reinterpret_cast<char*>(&other->_impl_.procid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata InsertTcamEntryReq::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata InsertEntriesReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[36]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[55]);
 }
 
 // ===================================================================
 
-class InsertTcamEntryResp::_Internal {
+class InsertEntriesResp::_Internal {
  public:
 };
 
-InsertTcamEntryResp::InsertTcamEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+InsertEntriesResp::InsertEntriesResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:rp4.InsertTcamEntryResp)
+  // @@protoc_insertion_point(arena_constructor:rp4.InsertEntriesResp)
 }
-InsertTcamEntryResp::InsertTcamEntryResp(const InsertTcamEntryResp& from)
+InsertEntriesResp::InsertEntriesResp(const InsertEntriesResp& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  InsertTcamEntryResp* const _this = this; (void)_this;
+  InsertEntriesResp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.res_){}
+    , decltype(_impl_.inserted_){}
+    , decltype(_impl_.failed_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.res_ = from._impl_.res_;
-  // @@protoc_insertion_point(copy_constructor:rp4.InsertTcamEntryResp)
+  ::memcpy(&_impl_.res_, &from._impl_.res_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.failed_) -
+    reinterpret_cast<char*>(&_impl_.res_)) + sizeof(_impl_.failed_));
+  // @@protoc_insertion_point(copy_constructor:rp4.InsertEntriesResp)
 }
 
-inline void InsertTcamEntryResp::SharedCtor(
+inline void InsertEntriesResp::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.res_){0}
+    , decltype(_impl_.inserted_){0}
+    , decltype(_impl_.failed_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-InsertTcamEntryResp::~InsertTcamEntryResp() {
-  // @@protoc_insertion_point(destructor:rp4.InsertTcamEntryResp)
+InsertEntriesResp::~InsertEntriesResp() {
+  // @@protoc_insertion_point(destructor:rp4.InsertEntriesResp)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -10549,25 +16471,27 @@ InsertTcamEntryResp::~InsertTcamEntryResp() {
   SharedDtor();
 }
 
-inline void InsertTcamEntryResp::SharedDtor() {
+inline void InsertEntriesResp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void InsertTcamEntryResp::SetCachedSize(int size) const {
+void InsertEntriesResp::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void InsertTcamEntryResp::Clear() {
-// @@protoc_insertion_point(message_clear_start:rp4.InsertTcamEntryResp)
+void InsertEntriesResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:rp4.InsertEntriesResp)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.res_ = 0;
+  ::memset(&_impl_.res_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.failed_) -
+      reinterpret_cast<char*>(&_impl_.res_)) + sizeof(_impl_.failed_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* InsertTcamEntryResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* InsertEntriesResp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -10582,6 +16506,22 @@ const char* InsertTcamEntryResp::_InternalParse(const char* ptr, ::_pbi::ParseCo
         } else
           goto handle_unusual;
         continue;
+      // int32 inserted = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.inserted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 failed = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.failed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -10605,9 +16545,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* InsertTcamEntryResp::_InternalSerialize(
+uint8_t* InsertEntriesResp::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rp4.InsertTcamEntryResp)
+  // @@protoc_insertion_point(serialize_to_array_start:rp4.InsertEntriesResp)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -10618,16 +16558,28 @@ uint8_t* InsertTcamEntryResp::_InternalSerialize(
       1, this->_internal_res(), target);
   }
 
+  // int32 inserted = 2;
+  if (this->_internal_inserted() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_inserted(), target);
+  }
+
+  // int32 failed = 3;
+  if (this->_internal_failed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_failed(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rp4.InsertTcamEntryResp)
+  // @@protoc_insertion_point(serialize_to_array_end:rp4.InsertEntriesResp)
   return target;
 }
 
-size_t InsertTcamEntryResp::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:rp4.InsertTcamEntryResp)
+size_t InsertEntriesResp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rp4.InsertEntriesResp)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -10640,20 +16592,30 @@ size_t InsertTcamEntryResp::ByteSizeLong() const {
       ::_pbi::WireFormatLite::EnumSize(this->_internal_res());
   }
 
+  // int32 inserted = 2;
+  if (this->_internal_inserted() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_inserted());
+  }
+
+  // int32 failed = 3;
+  if (this->_internal_failed() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_failed());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertTcamEntryResp::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertEntriesResp::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    InsertTcamEntryResp::MergeImpl
+    InsertEntriesResp::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertTcamEntryResp::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertEntriesResp::GetClassData() const { return &_class_data_; }
 
 
-void InsertTcamEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<InsertTcamEntryResp*>(&to_msg);
-  auto& from = static_cast<const InsertTcamEntryResp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.InsertTcamEntryResp)
+void InsertEntriesResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InsertEntriesResp*>(&to_msg);
+  auto& from = static_cast<const InsertEntriesResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rp4.InsertEntriesResp)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -10661,30 +16623,41 @@ void InsertTcamEntryResp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, co
   if (from._internal_res() != 0) {
     _this->_internal_set_res(from._internal_res());
   }
+  if (from._internal_inserted() != 0) {
+    _this->_internal_set_inserted(from._internal_inserted());
+  }
+  if (from._internal_failed() != 0) {
+    _this->_internal_set_failed(from._internal_failed());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InsertTcamEntryResp::CopyFrom(const InsertTcamEntryResp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rp4.InsertTcamEntryResp)
+void InsertEntriesResp::CopyFrom(const InsertEntriesResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rp4.InsertEntriesResp)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InsertTcamEntryResp::IsInitialized() const {
+bool InsertEntriesResp::IsInitialized() const {
   return true;
 }
 
-void InsertTcamEntryResp::InternalSwap(InsertTcamEntryResp* other) {
+void InsertEntriesResp::InternalSwap(InsertEntriesResp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.res_, other->_impl_.res_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InsertEntriesResp, _impl_.failed_)
+      + sizeof(InsertEntriesResp::_impl_.failed_)
+      - PROTOBUF_FIELD_OFFSET(InsertEntriesResp, _impl_.res_)>(
+          reinterpret_cast<char*>(&_impl_.res_),
+          reinterpret_cast<char*>(&other->_impl_.res_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata InsertTcamEntryResp::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata InsertEntriesResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[37]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[56]);
 }
 
 // ===================================================================
@@ -10895,7 +16868,7 @@ void ClearOldConfigReq::InternalSwap(ClearOldConfigReq* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ClearOldConfigReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[38]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[57]);
 }
 
 // ===================================================================
@@ -11076,7 +17049,7 @@ void ClearOldConfigResp::InternalSwap(ClearOldConfigResp* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ClearOldConfigResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[39]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[58]);
 }
 
 // ===================================================================
@@ -11311,7 +17284,7 @@ void SetMissActIdReq::InternalSwap(SetMissActIdReq* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata SetMissActIdReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[40]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[59]);
 }
 
 // ===================================================================
@@ -11492,7 +17465,7 @@ void SetMissActIdResp::InternalSwap(SetMissActIdResp* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata SetMissActIdResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[41]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[60]);
 }
 
 // ===================================================================
@@ -11923,7 +17896,7 @@ void Parameter::InternalSwap(Parameter* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata Parameter::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[42]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[61]);
 }
 
 // ===================================================================
@@ -12203,7 +18176,7 @@ void ExpTreeNode::InternalSwap(ExpTreeNode* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ExpTreeNode::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[43]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[62]);
 }
 
 // ===================================================================
@@ -12442,7 +18415,7 @@ void Prim::InternalSwap(Prim* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata Prim::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[44]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[63]);
 }
 
 // ===================================================================
@@ -12696,7 +18669,7 @@ void Action::InternalSwap(Action* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata Action::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[45]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[64]);
 }
 
 // ===================================================================
@@ -12948,7 +18921,7 @@ void InsertActionReq::InternalSwap(InsertActionReq* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata InsertActionReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[46]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[65]);
 }
 
 // ===================================================================
@@ -13129,7 +19102,7 @@ void InsertActionResp::InternalSwap(InsertActionResp* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata InsertActionResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[47]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[66]);
 }
 
 // ===================================================================
@@ -13307,7 +19280,7 @@ void ClearActionReq::InternalSwap(ClearActionReq* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ClearActionReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[48]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[67]);
 }
 
 // ===================================================================
@@ -13488,7 +19461,7 @@ void ClearActionResp::InternalSwap(ClearActionResp* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ClearActionResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[49]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[68]);
 }
 
 // ===================================================================
@@ -13699,7 +19672,7 @@ void DelActionReq::InternalSwap(DelActionReq* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata DelActionReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[50]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[69]);
 }
 
 // ===================================================================
@@ -13880,7 +19853,7 @@ void DelActionResp::InternalSwap(DelActionResp* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata DelActionResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[51]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[70]);
 }
 
 // ===================================================================
@@ -14091,7 +20064,7 @@ void SigmoidPoint::InternalSwap(SigmoidPoint* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata SigmoidPoint::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[52]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[71]);
 }
 
 // ===================================================================
@@ -14336,7 +20309,7 @@ void LoadSigmoidTableReq::InternalSwap(LoadSigmoidTableReq* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata LoadSigmoidTableReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[53]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[72]);
 }
 
 // ===================================================================
@@ -14517,7 +20490,7 @@ void LoadSigmoidTableResp::InternalSwap(LoadSigmoidTableResp* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata LoadSigmoidTableResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[54]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[73]);
 }
 
 // ===================================================================
@@ -14557,7 +20530,7 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearSigmoidTableReq::GetClass
 ::PROTOBUF_NAMESPACE_ID::Metadata ClearSigmoidTableReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[55]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[74]);
 }
 
 // ===================================================================
@@ -14738,7 +20711,7 @@ void ClearSigmoidTableResp::InternalSwap(ClearSigmoidTableResp* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ClearSigmoidTableResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[56]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[75]);
 }
 
 // ===================================================================
@@ -14949,7 +20922,7 @@ void ExpPoint::InternalSwap(ExpPoint* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ExpPoint::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[57]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[76]);
 }
 
 // ===================================================================
@@ -15194,7 +21167,7 @@ void LoadExpTableReq::InternalSwap(LoadExpTableReq* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata LoadExpTableReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[58]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[77]);
 }
 
 // ===================================================================
@@ -15375,7 +21348,7 @@ void LoadExpTableResp::InternalSwap(LoadExpTableResp* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata LoadExpTableResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[59]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[78]);
 }
 
 // ===================================================================
@@ -15415,7 +21388,7 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearExpTableReq::GetClassData
 ::PROTOBUF_NAMESPACE_ID::Metadata ClearExpTableReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[60]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[79]);
 }
 
 // ===================================================================
@@ -15596,7 +21569,7 @@ void ClearExpTableResp::InternalSwap(ClearExpTableResp* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ClearExpTableResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[61]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[80]);
 }
 
 // ===================================================================
@@ -16062,7 +22035,7 @@ void NeuronPrimitiveContext::InternalSwap(NeuronPrimitiveContext* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata NeuronPrimitiveContext::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[62]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[81]);
 }
 
 // ===================================================================
@@ -16255,7 +22228,7 @@ void LoadNeuronPrimitiveContextReq::InternalSwap(LoadNeuronPrimitiveContextReq*
 ::PROTOBUF_NAMESPACE_ID::Metadata LoadNeuronPrimitiveContextReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[63]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[82]);
 }
 
 // ===================================================================
@@ -16436,7 +22409,7 @@ void LoadNeuronPrimitiveContextResp::InternalSwap(LoadNeuronPrimitiveContextResp
 ::PROTOBUF_NAMESPACE_ID::Metadata LoadNeuronPrimitiveContextResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[64]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[83]);
 }
 
 // ===================================================================
@@ -16476,7 +22449,7 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClearNeuronPrimitiveContextsRe
 ::PROTOBUF_NAMESPACE_ID::Metadata ClearNeuronPrimitiveContextsReq::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[65]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[84]);
 }
 
 // ===================================================================
@@ -16657,7 +22630,7 @@ void ClearNeuronPrimitiveContextsResp::InternalSwap(ClearNeuronPrimitiveContexts
 ::PROTOBUF_NAMESPACE_ID::Metadata ClearNeuronPrimitiveContextsResp::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_controller_5fto_5fdataplane_2eproto_getter, &descriptor_table_controller_5fto_5fdataplane_2eproto_once,
-      file_level_metadata_controller_5fto_5fdataplane_2eproto[66]);
+      file_level_metadata_controller_5fto_5fdataplane_2eproto[85]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -16679,6 +22652,42 @@ template<> PROTOBUF_NOINLINE ::rp4::ClearStageReq*
 Arena::CreateMaybeMessage< ::rp4::ClearStageReq >(Arena* arena) {
   return Arena::CreateMessageInternal< ::rp4::ClearStageReq >(arena);
 }
+template<> PROTOBUF_NOINLINE ::rp4::BeginConfigReq*
+Arena::CreateMaybeMessage< ::rp4::BeginConfigReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::BeginConfigReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::BeginConfigResp*
+Arena::CreateMaybeMessage< ::rp4::BeginConfigResp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::BeginConfigResp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::CommitConfigReq*
+Arena::CreateMaybeMessage< ::rp4::CommitConfigReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::CommitConfigReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::CommitConfigResp*
+Arena::CreateMaybeMessage< ::rp4::CommitConfigResp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::CommitConfigResp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::AbortConfigReq*
+Arena::CreateMaybeMessage< ::rp4::AbortConfigReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::AbortConfigReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::AbortConfigResp*
+Arena::CreateMaybeMessage< ::rp4::AbortConfigResp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::AbortConfigResp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::ConfigOp*
+Arena::CreateMaybeMessage< ::rp4::ConfigOp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::ConfigOp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::ApplyConfigReq*
+Arena::CreateMaybeMessage< ::rp4::ApplyConfigReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::ApplyConfigReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::ApplyConfigResp*
+Arena::CreateMaybeMessage< ::rp4::ApplyConfigResp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::ApplyConfigResp >(arena);
+}
 template<> PROTOBUF_NOINLINE ::rp4::ParserLevelReq*
 Arena::CreateMaybeMessage< ::rp4::ParserLevelReq >(Arena* arena) {
   return Arena::CreateMessageInternal< ::rp4::ParserLevelReq >(arena);
@@ -16815,6 +22824,46 @@ template<> PROTOBUF_NOINLINE ::rp4::InsertTcamEntryResp*
 Arena::CreateMaybeMessage< ::rp4::InsertTcamEntryResp >(Arena* arena) {
   return Arena::CreateMessageInternal< ::rp4::InsertTcamEntryResp >(arena);
 }
+template<> PROTOBUF_NOINLINE ::rp4::ModSramEntryReq*
+Arena::CreateMaybeMessage< ::rp4::ModSramEntryReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::ModSramEntryReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::ModSramEntryResp*
+Arena::CreateMaybeMessage< ::rp4::ModSramEntryResp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::ModSramEntryResp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::DelSramEntryReq*
+Arena::CreateMaybeMessage< ::rp4::DelSramEntryReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::DelSramEntryReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::DelSramEntryResp*
+Arena::CreateMaybeMessage< ::rp4::DelSramEntryResp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::DelSramEntryResp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::ModTcamEntryReq*
+Arena::CreateMaybeMessage< ::rp4::ModTcamEntryReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::ModTcamEntryReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::ModTcamEntryResp*
+Arena::CreateMaybeMessage< ::rp4::ModTcamEntryResp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::ModTcamEntryResp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::DelTcamEntryReq*
+Arena::CreateMaybeMessage< ::rp4::DelTcamEntryReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::DelTcamEntryReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::DelTcamEntryResp*
+Arena::CreateMaybeMessage< ::rp4::DelTcamEntryResp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::DelTcamEntryResp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::InsertEntriesReq*
+Arena::CreateMaybeMessage< ::rp4::InsertEntriesReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::InsertEntriesReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rp4::InsertEntriesResp*
+Arena::CreateMaybeMessage< ::rp4::InsertEntriesResp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rp4::InsertEntriesResp >(arena);
+}
 template<> PROTOBUF_NOINLINE ::rp4::ClearOldConfigReq*
 Arena::CreateMaybeMessage< ::rp4::ClearOldConfigReq >(Arena* arena) {
   return Arena::CreateMessageInternal< ::rp4::ClearOldConfigReq >(arena);
@@ -47,12 +47,30 @@ struct TableStruct_controller_5fto_5fdataplane_2eproto {
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_controller_5fto_5fdataplane_2eproto;
 namespace rp4 {
+class AbortConfigReq;
+struct AbortConfigReqDefaultTypeInternal;
+extern AbortConfigReqDefaultTypeInternal _AbortConfigReq_default_instance_;
+class AbortConfigResp;
+struct AbortConfigRespDefaultTypeInternal;
+extern AbortConfigRespDefaultTypeInternal _AbortConfigResp_default_instance_;
 class Action;
 struct ActionDefaultTypeInternal;
 extern ActionDefaultTypeInternal _Action_default_instance_;
 class ActionProc;
 struct ActionProcDefaultTypeInternal;
 extern ActionProcDefaultTypeInternal _ActionProc_default_instance_;
+class ApplyConfigReq;
+struct ApplyConfigReqDefaultTypeInternal;
+extern ApplyConfigReqDefaultTypeInternal _ApplyConfigReq_default_instance_;
+class ApplyConfigResp;
+struct ApplyConfigRespDefaultTypeInternal;
+extern ApplyConfigRespDefaultTypeInternal _ApplyConfigResp_default_instance_;
+class BeginConfigReq;
+struct BeginConfigReqDefaultTypeInternal;
+extern BeginConfigReqDefaultTypeInternal _BeginConfigReq_default_instance_;
+class BeginConfigResp;
+struct BeginConfigRespDefaultTypeInternal;
+extern BeginConfigRespDefaultTypeInternal _BeginConfigResp_default_instance_;
 class ClearActionReq;
 struct ClearActionReqDefaultTypeInternal;
 extern ClearActionReqDefaultTypeInternal _ClearActionReq_default_instance_;
@@ -104,6 +122,15 @@ extern ClearSigmoidTableRespDefaultTypeInternal _ClearSigmoidTableResp_default_i
 class ClearStageReq;
 struct ClearStageReqDefaultTypeInternal;
 extern ClearStageReqDefaultTypeInternal _ClearStageReq_default_instance_;
+class CommitConfigReq;
+struct CommitConfigReqDefaultTypeInternal;
+extern CommitConfigReqDefaultTypeInternal _CommitConfigReq_default_instance_;
+class CommitConfigResp;
+struct CommitConfigRespDefaultTypeInternal;
+extern CommitConfigRespDefaultTypeInternal _CommitConfigResp_default_instance_;
+class ConfigOp;
+struct ConfigOpDefaultTypeInternal;
+extern ConfigOpDefaultTypeInternal _ConfigOp_default_instance_;
 class Data;
 struct DataDefaultTypeInternal;
 extern DataDefaultTypeInternal _Data_default_instance_;
@@ -113,6 +140,18 @@ extern DelActionReqDefaultTypeInternal _DelActionReq_default_instance_;
 class DelActionResp;
 struct DelActionRespDefaultTypeInternal;
 extern DelActionRespDefaultTypeInternal _DelActionResp_default_instance_;
+class DelSramEntryReq;
+struct DelSramEntryReqDefaultTypeInternal;
+extern DelSramEntryReqDefaultTypeInternal _DelSramEntryReq_default_instance_;
+class DelSramEntryResp;
+struct DelSramEntryRespDefaultTypeInternal;
+extern DelSramEntryRespDefaultTypeInternal _DelSramEntryResp_default_instance_;
+class DelTcamEntryReq;
+struct DelTcamEntryReqDefaultTypeInternal;
+extern DelTcamEntryReqDefaultTypeInternal _DelTcamEntryReq_default_instance_;
+class DelTcamEntryResp;
+struct DelTcamEntryRespDefaultTypeInternal;
+extern DelTcamEntryRespDefaultTypeInternal _DelTcamEntryResp_default_instance_;
 class ExpPoint;
 struct ExpPointDefaultTypeInternal;
 extern ExpPointDefaultTypeInternal _ExpPoint_default_instance_;
@@ -137,6 +176,12 @@ extern InsertActionReqDefaultTypeInternal _InsertActionReq_default_instance_;
 class InsertActionResp;
 struct InsertActionRespDefaultTypeInternal;
 extern InsertActionRespDefaultTypeInternal _InsertActionResp_default_instance_;
+class InsertEntriesReq;
+struct InsertEntriesReqDefaultTypeInternal;
+extern InsertEntriesReqDefaultTypeInternal _InsertEntriesReq_default_instance_;
+class InsertEntriesResp;
+struct InsertEntriesRespDefaultTypeInternal;
+extern InsertEntriesRespDefaultTypeInternal _InsertEntriesResp_default_instance_;
 class InsertRelationExpReq;
 struct InsertRelationExpReqDefaultTypeInternal;
 extern InsertRelationExpReqDefaultTypeInternal _InsertRelationExpReq_default_instance_;
@@ -185,6 +230,18 @@ extern ModResMapReqDefaultTypeInternal _ModResMapReq_default_instance_;
 class ModResMapResp;
 struct ModResMapRespDefaultTypeInternal;
 extern ModResMapRespDefaultTypeInternal _ModResMapResp_default_instance_;
+class ModSramEntryReq;
+struct ModSramEntryReqDefaultTypeInternal;
+extern ModSramEntryReqDefaultTypeInternal _ModSramEntryReq_default_instance_;
+class ModSramEntryResp;
+struct ModSramEntryRespDefaultTypeInternal;
+extern ModSramEntryRespDefaultTypeInternal _ModSramEntryResp_default_instance_;
+class ModTcamEntryReq;
+struct ModTcamEntryReqDefaultTypeInternal;
+extern ModTcamEntryReqDefaultTypeInternal _ModTcamEntryReq_default_instance_;
+class ModTcamEntryResp;
+struct ModTcamEntryRespDefaultTypeInternal;
+extern ModTcamEntryRespDefaultTypeInternal _ModTcamEntryResp_default_instance_;
 class NeuronPrimitiveContext;
 struct NeuronPrimitiveContextDefaultTypeInternal;
 extern NeuronPrimitiveContextDefaultTypeInternal _NeuronPrimitiveContext_default_instance_;
@@ -250,8 +307,14 @@ struct SigmoidPointDefaultTypeInternal;
 extern SigmoidPointDefaultTypeInternal _SigmoidPoint_default_instance_;
 }  // namespace rp4
 PROTOBUF_NAMESPACE_OPEN
+template<> ::rp4::AbortConfigReq* Arena::CreateMaybeMessage<::rp4::AbortConfigReq>(Arena*);
+template<> ::rp4::AbortConfigResp* Arena::CreateMaybeMessage<::rp4::AbortConfigResp>(Arena*);
 template<> ::rp4::Action* Arena::CreateMaybeMessage<::rp4::Action>(Arena*);
 template<> ::rp4::ActionProc* Arena::CreateMaybeMessage<::rp4::ActionProc>(Arena*);
+template<> ::rp4::ApplyConfigReq* Arena::CreateMaybeMessage<::rp4::ApplyConfigReq>(Arena*);
+template<> ::rp4::ApplyConfigResp* Arena::CreateMaybeMessage<::rp4::ApplyConfigResp>(Arena*);
+template<> ::rp4::BeginConfigReq* Arena::CreateMaybeMessage<::rp4::BeginConfigReq>(Arena*);
+template<> ::rp4::BeginConfigResp* Arena::CreateMaybeMessage<::rp4::BeginConfigResp>(Arena*);
 template<> ::rp4::ClearActionReq* Arena::CreateMaybeMessage<::rp4::ClearActionReq>(Arena*);
 template<> ::rp4::ClearActionResp* Arena::CreateMaybeMessage<::rp4::ClearActionResp>(Arena*);
 template<> ::rp4::ClearExpTableReq* Arena::CreateMaybeMessage<::rp4::ClearExpTableReq>(Arena*);
@@ -269,9 +332,16 @@ template<> ::rp4::ClearResMapResp* Arena::CreateMaybeMessage<::rp4::ClearResMapR
 template<> ::rp4::ClearSigmoidTableReq* Arena::CreateMaybeMessage<::rp4::ClearSigmoidTableReq>(Arena*);
 template<> ::rp4::ClearSigmoidTableResp* Arena::CreateMaybeMessage<::rp4::ClearSigmoidTableResp>(Arena*);
 template<> ::rp4::ClearStageReq* Arena::CreateMaybeMessage<::rp4::ClearStageReq>(Arena*);
+template<> ::rp4::CommitConfigReq* Arena::CreateMaybeMessage<::rp4::CommitConfigReq>(Arena*);
+template<> ::rp4::CommitConfigResp* Arena::CreateMaybeMessage<::rp4::CommitConfigResp>(Arena*);
+template<> ::rp4::ConfigOp* Arena::CreateMaybeMessage<::rp4::ConfigOp>(Arena*);
 template<> ::rp4::Data* Arena::CreateMaybeMessage<::rp4::Data>(Arena*);
 template<> ::rp4::DelActionReq* Arena::CreateMaybeMessage<::rp4::DelActionReq>(Arena*);
 template<> ::rp4::DelActionResp* Arena::CreateMaybeMessage<::rp4::DelActionResp>(Arena*);
+template<> ::rp4::DelSramEntryReq* Arena::CreateMaybeMessage<::rp4::DelSramEntryReq>(Arena*);
+template<> ::rp4::DelSramEntryResp* Arena::CreateMaybeMessage<::rp4::DelSramEntryResp>(Arena*);
+template<> ::rp4::DelTcamEntryReq* Arena::CreateMaybeMessage<::rp4::DelTcamEntryReq>(Arena*);
+template<> ::rp4::DelTcamEntryResp* Arena::CreateMaybeMessage<::rp4::DelTcamEntryResp>(Arena*);
 template<> ::rp4::ExpPoint* Arena::CreateMaybeMessage<::rp4::ExpPoint>(Arena*);
 template<> ::rp4::ExpTreeNode* Arena::CreateMaybeMessage<::rp4::ExpTreeNode>(Arena*);
 template<> ::rp4::FieldInfo* Arena::CreateMaybeMessage<::rp4::FieldInfo>(Arena*);
@@ -280,6 +350,8 @@ template<> ::rp4::GatewayParam* Arena::CreateMaybeMessage<::rp4::GatewayParam>(A
 template<> ::rp4::HeaderInfo* Arena::CreateMaybeMessage<::rp4::HeaderInfo>(Arena*);
 template<> ::rp4::InsertActionReq* Arena::CreateMaybeMessage<::rp4::InsertActionReq>(Arena*);
 template<> ::rp4::InsertActionResp* Arena::CreateMaybeMessage<::rp4::InsertActionResp>(Arena*);
+template<> ::rp4::InsertEntriesReq* Arena::CreateMaybeMessage<::rp4::InsertEntriesReq>(Arena*);
+template<> ::rp4::InsertEntriesResp* Arena::CreateMaybeMessage<::rp4::InsertEntriesResp>(Arena*);
 template<> ::rp4::InsertRelationExpReq* Arena::CreateMaybeMessage<::rp4::InsertRelationExpReq>(Arena*);
 template<> ::rp4::InsertRelationExpResp* Arena::CreateMaybeMessage<::rp4::InsertRelationExpResp>(Arena*);
 template<> ::rp4::InsertSramEntryReq* Arena::CreateMaybeMessage<::rp4::InsertSramEntryReq>(Arena*);
@@ -296,6 +368,10 @@ template<> ::rp4::ModParserEntryReq* Arena::CreateMaybeMessage<::rp4::ModParserE
 template<> ::rp4::ModParserEntryResp* Arena::CreateMaybeMessage<::rp4::ModParserEntryResp>(Arena*);
 template<> ::rp4::ModResMapReq* Arena::CreateMaybeMessage<::rp4::ModResMapReq>(Arena*);
 template<> ::rp4::ModResMapResp* Arena::CreateMaybeMessage<::rp4::ModResMapResp>(Arena*);
+template<> ::rp4::ModSramEntryReq* Arena::CreateMaybeMessage<::rp4::ModSramEntryReq>(Arena*);
+template<> ::rp4::ModSramEntryResp* Arena::CreateMaybeMessage<::rp4::ModSramEntryResp>(Arena*);
+template<> ::rp4::ModTcamEntryReq* Arena::CreateMaybeMessage<::rp4::ModTcamEntryReq>(Arena*);
+template<> ::rp4::ModTcamEntryResp* Arena::CreateMaybeMessage<::rp4::ModTcamEntryResp>(Arena*);
 template<> ::rp4::NeuronPrimitiveContext* Arena::CreateMaybeMessage<::rp4::NeuronPrimitiveContext>(Arena*);
 template<> ::rp4::Parameter* Arena::CreateMaybeMessage<::rp4::Parameter>(Arena*);
 template<> ::rp4::ParserLevelReq* Arena::CreateMaybeMessage<::rp4::ParserLevelReq>(Arena*);
@@ -1169,24 +1245,23 @@ class ClearStageReq final :
 };
 // -------------------------------------------------------------------
 
-class ParserLevelReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ParserLevelReq) */ {
+class BeginConfigReq final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:rp4.BeginConfigReq) */ {
  public:
-  inline ParserLevelReq() : ParserLevelReq(nullptr) {}
-  ~ParserLevelReq() override;
-  explicit PROTOBUF_CONSTEXPR ParserLevelReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BeginConfigReq() : BeginConfigReq(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR BeginConfigReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ParserLevelReq(const ParserLevelReq& from);
-  ParserLevelReq(ParserLevelReq&& from) noexcept
-    : ParserLevelReq() {
+  BeginConfigReq(const BeginConfigReq& from);
+  BeginConfigReq(BeginConfigReq&& from) noexcept
+    : BeginConfigReq() {
     *this = ::std::move(from);
   }
 
-  inline ParserLevelReq& operator=(const ParserLevelReq& from) {
+  inline BeginConfigReq& operator=(const BeginConfigReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ParserLevelReq& operator=(ParserLevelReq&& from) noexcept {
+  inline BeginConfigReq& operator=(BeginConfigReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1209,20 +1284,20 @@ class ParserLevelReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ParserLevelReq& default_instance() {
+  static const BeginConfigReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ParserLevelReq* internal_default_instance() {
-    return reinterpret_cast<const ParserLevelReq*>(
-               &_ParserLevelReq_default_instance_);
+  static inline const BeginConfigReq* internal_default_instance() {
+    return reinterpret_cast<const BeginConfigReq*>(
+               &_BeginConfigReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     4;
 
-  friend void swap(ParserLevelReq& a, ParserLevelReq& b) {
+  friend void swap(BeginConfigReq& a, BeginConfigReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(ParserLevelReq* other) {
+  inline void Swap(BeginConfigReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1235,7 +1310,7 @@ class ParserLevelReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ParserLevelReq* other) {
+  void UnsafeArenaSwap(BeginConfigReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1243,40 +1318,26 @@ class ParserLevelReq final :
 
   // implements Message ----------------------------------------------
 
-  ParserLevelReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ParserLevelReq>(arena);
+  BeginConfigReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BeginConfigReq>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ParserLevelReq& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ParserLevelReq& from) {
-    ParserLevelReq::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const BeginConfigReq& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const BeginConfigReq& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ParserLevelReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ParserLevelReq";
+    return "rp4.BeginConfigReq";
   }
   protected:
-  explicit ParserLevelReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BeginConfigReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1289,29 +1350,7 @@ class ParserLevelReq final :
 
   // accessors -------------------------------------------------------
 
-  enum : int {
-    kProcIdFieldNumber = 1,
-    kParserLevelFieldNumber = 2,
-  };
-  // int32 procId = 1;
-  void clear_procid();
-  int32_t procid() const;
-  void set_procid(int32_t value);
-  private:
-  int32_t _internal_procid() const;
-  void _internal_set_procid(int32_t value);
-  public:
-
-  // int32 parserLevel = 2;
-  void clear_parserlevel();
-  int32_t parserlevel() const;
-  void set_parserlevel(int32_t value);
-  private:
-  int32_t _internal_parserlevel() const;
-  void _internal_set_parserlevel(int32_t value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:rp4.ParserLevelReq)
+  // @@protoc_insertion_point(class_scope:rp4.BeginConfigReq)
  private:
   class _Internal;
 
@@ -1319,33 +1358,29 @@ class ParserLevelReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t procid_;
-    int32_t parserlevel_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
-  union { Impl_ _impl_; };
   friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ParserLevelResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ParserLevelResp) */ {
+class BeginConfigResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.BeginConfigResp) */ {
  public:
-  inline ParserLevelResp() : ParserLevelResp(nullptr) {}
-  ~ParserLevelResp() override;
-  explicit PROTOBUF_CONSTEXPR ParserLevelResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BeginConfigResp() : BeginConfigResp(nullptr) {}
+  ~BeginConfigResp() override;
+  explicit PROTOBUF_CONSTEXPR BeginConfigResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ParserLevelResp(const ParserLevelResp& from);
-  ParserLevelResp(ParserLevelResp&& from) noexcept
-    : ParserLevelResp() {
+  BeginConfigResp(const BeginConfigResp& from);
+  BeginConfigResp(BeginConfigResp&& from) noexcept
+    : BeginConfigResp() {
     *this = ::std::move(from);
   }
 
-  inline ParserLevelResp& operator=(const ParserLevelResp& from) {
+  inline BeginConfigResp& operator=(const BeginConfigResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ParserLevelResp& operator=(ParserLevelResp&& from) noexcept {
+  inline BeginConfigResp& operator=(BeginConfigResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1368,20 +1403,20 @@ class ParserLevelResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ParserLevelResp& default_instance() {
+  static const BeginConfigResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ParserLevelResp* internal_default_instance() {
-    return reinterpret_cast<const ParserLevelResp*>(
-               &_ParserLevelResp_default_instance_);
+  static inline const BeginConfigResp* internal_default_instance() {
+    return reinterpret_cast<const BeginConfigResp*>(
+               &_BeginConfigResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     5;
 
-  friend void swap(ParserLevelResp& a, ParserLevelResp& b) {
+  friend void swap(BeginConfigResp& a, BeginConfigResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(ParserLevelResp* other) {
+  inline void Swap(BeginConfigResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1394,7 +1429,7 @@ class ParserLevelResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ParserLevelResp* other) {
+  void UnsafeArenaSwap(BeginConfigResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1402,14 +1437,14 @@ class ParserLevelResp final :
 
   // implements Message ----------------------------------------------
 
-  ParserLevelResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ParserLevelResp>(arena);
+  BeginConfigResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BeginConfigResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ParserLevelResp& from);
+  void CopyFrom(const BeginConfigResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ParserLevelResp& from) {
-    ParserLevelResp::MergeImpl(*this, from);
+  void MergeFrom( const BeginConfigResp& from) {
+    BeginConfigResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1427,15 +1462,15 @@ class ParserLevelResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ParserLevelResp* other);
+  void InternalSwap(BeginConfigResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ParserLevelResp";
+    return "rp4.BeginConfigResp";
   }
   protected:
-  explicit ParserLevelResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BeginConfigResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1460,7 +1495,7 @@ class ParserLevelResp final :
   void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ParserLevelResp)
+  // @@protoc_insertion_point(class_scope:rp4.BeginConfigResp)
  private:
   class _Internal;
 
@@ -1476,24 +1511,23 @@ class ParserLevelResp final :
 };
 // -------------------------------------------------------------------
 
-class FieldInfo final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.FieldInfo) */ {
+class CommitConfigReq final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:rp4.CommitConfigReq) */ {
  public:
-  inline FieldInfo() : FieldInfo(nullptr) {}
-  ~FieldInfo() override;
-  explicit PROTOBUF_CONSTEXPR FieldInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline CommitConfigReq() : CommitConfigReq(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR CommitConfigReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  FieldInfo(const FieldInfo& from);
-  FieldInfo(FieldInfo&& from) noexcept
-    : FieldInfo() {
+  CommitConfigReq(const CommitConfigReq& from);
+  CommitConfigReq(CommitConfigReq&& from) noexcept
+    : CommitConfigReq() {
     *this = ::std::move(from);
   }
 
-  inline FieldInfo& operator=(const FieldInfo& from) {
+  inline CommitConfigReq& operator=(const CommitConfigReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline FieldInfo& operator=(FieldInfo&& from) noexcept {
+  inline CommitConfigReq& operator=(CommitConfigReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1516,20 +1550,20 @@ class FieldInfo final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const FieldInfo& default_instance() {
+  static const CommitConfigReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const FieldInfo* internal_default_instance() {
-    return reinterpret_cast<const FieldInfo*>(
-               &_FieldInfo_default_instance_);
+  static inline const CommitConfigReq* internal_default_instance() {
+    return reinterpret_cast<const CommitConfigReq*>(
+               &_CommitConfigReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     6;
 
-  friend void swap(FieldInfo& a, FieldInfo& b) {
+  friend void swap(CommitConfigReq& a, CommitConfigReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(FieldInfo* other) {
+  inline void Swap(CommitConfigReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1542,7 +1576,7 @@ class FieldInfo final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(FieldInfo* other) {
+  void UnsafeArenaSwap(CommitConfigReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1550,40 +1584,26 @@ class FieldInfo final :
 
   // implements Message ----------------------------------------------
 
-  FieldInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<FieldInfo>(arena);
+  CommitConfigReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommitConfigReq>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const FieldInfo& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const FieldInfo& from) {
-    FieldInfo::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CommitConfigReq& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CommitConfigReq& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(FieldInfo* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.FieldInfo";
+    return "rp4.CommitConfigReq";
   }
   protected:
-  explicit FieldInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit CommitConfigReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1596,49 +1616,7 @@ class FieldInfo final :
 
   // accessors -------------------------------------------------------
 
-  enum : int {
-    kHdrIdFieldNumber = 1,
-    kInternalOffsetFieldNumber = 2,
-    kFieldLenFieldNumber = 3,
-    kFieldTypeFieldNumber = 4,
-  };
-  // int32 hdrId = 1;
-  void clear_hdrid();
-  int32_t hdrid() const;
-  void set_hdrid(int32_t value);
-  private:
-  int32_t _internal_hdrid() const;
-  void _internal_set_hdrid(int32_t value);
-  public:
-
-  // int32 internalOffset = 2;
-  void clear_internaloffset();
-  int32_t internaloffset() const;
-  void set_internaloffset(int32_t value);
-  private:
-  int32_t _internal_internaloffset() const;
-  void _internal_set_internaloffset(int32_t value);
-  public:
-
-  // int32 fieldLen = 3;
-  void clear_fieldlen();
-  int32_t fieldlen() const;
-  void set_fieldlen(int32_t value);
-  private:
-  int32_t _internal_fieldlen() const;
-  void _internal_set_fieldlen(int32_t value);
-  public:
-
-  // .rp4.FieldType fieldType = 4;
-  void clear_fieldtype();
-  ::rp4::FieldType fieldtype() const;
-  void set_fieldtype(::rp4::FieldType value);
-  private:
-  ::rp4::FieldType _internal_fieldtype() const;
-  void _internal_set_fieldtype(::rp4::FieldType value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:rp4.FieldInfo)
+  // @@protoc_insertion_point(class_scope:rp4.CommitConfigReq)
  private:
   class _Internal;
 
@@ -1646,35 +1624,29 @@ class FieldInfo final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t hdrid_;
-    int32_t internaloffset_;
-    int32_t fieldlen_;
-    int fieldtype_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
-  union { Impl_ _impl_; };
   friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ModParserEntryReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ModParserEntryReq) */ {
+class CommitConfigResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.CommitConfigResp) */ {
  public:
-  inline ModParserEntryReq() : ModParserEntryReq(nullptr) {}
-  ~ModParserEntryReq() override;
-  explicit PROTOBUF_CONSTEXPR ModParserEntryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline CommitConfigResp() : CommitConfigResp(nullptr) {}
+  ~CommitConfigResp() override;
+  explicit PROTOBUF_CONSTEXPR CommitConfigResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ModParserEntryReq(const ModParserEntryReq& from);
-  ModParserEntryReq(ModParserEntryReq&& from) noexcept
-    : ModParserEntryReq() {
+  CommitConfigResp(const CommitConfigResp& from);
+  CommitConfigResp(CommitConfigResp&& from) noexcept
+    : CommitConfigResp() {
     *this = ::std::move(from);
   }
 
-  inline ModParserEntryReq& operator=(const ModParserEntryReq& from) {
+  inline CommitConfigResp& operator=(const CommitConfigResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ModParserEntryReq& operator=(ModParserEntryReq&& from) noexcept {
+  inline CommitConfigResp& operator=(CommitConfigResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1697,20 +1669,20 @@ class ModParserEntryReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ModParserEntryReq& default_instance() {
+  static const CommitConfigResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ModParserEntryReq* internal_default_instance() {
-    return reinterpret_cast<const ModParserEntryReq*>(
-               &_ModParserEntryReq_default_instance_);
+  static inline const CommitConfigResp* internal_default_instance() {
+    return reinterpret_cast<const CommitConfigResp*>(
+               &_CommitConfigResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     7;
 
-  friend void swap(ModParserEntryReq& a, ModParserEntryReq& b) {
+  friend void swap(CommitConfigResp& a, CommitConfigResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(ModParserEntryReq* other) {
+  inline void Swap(CommitConfigResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1723,7 +1695,7 @@ class ModParserEntryReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ModParserEntryReq* other) {
+  void UnsafeArenaSwap(CommitConfigResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1731,14 +1703,14 @@ class ModParserEntryReq final :
 
   // implements Message ----------------------------------------------
 
-  ModParserEntryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ModParserEntryReq>(arena);
+  CommitConfigResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommitConfigResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ModParserEntryReq& from);
+  void CopyFrom(const CommitConfigResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ModParserEntryReq& from) {
-    ModParserEntryReq::MergeImpl(*this, from);
+  void MergeFrom( const CommitConfigResp& from) {
+    CommitConfigResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1756,15 +1728,15 @@ class ModParserEntryReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ModParserEntryReq* other);
+  void InternalSwap(CommitConfigResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ModParserEntryReq";
+    return "rp4.CommitConfigResp";
   }
   protected:
-  explicit ModParserEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit CommitConfigResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1778,127 +1750,18 @@ class ModParserEntryReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kTransFdsFieldNumber = 10,
-    kProcIdFieldNumber = 1,
-    kParserLevelFieldNumber = 2,
-    kStateFieldNumber = 3,
-    kKeyFieldNumber = 4,
-    kMaskFieldNumber = 5,
-    kHdrIdFieldNumber = 6,
-    kHdrLenFieldNumber = 7,
-    kNextStateFieldNumber = 8,
-    kTransFieldNumFieldNumber = 9,
-    kMissActFieldNumber = 11,
+    kResFieldNumber = 1,
   };
-  // repeated .rp4.FieldInfo transFds = 10;
-  int transfds_size() const;
-  private:
-  int _internal_transfds_size() const;
-  public:
-  void clear_transfds();
-  ::rp4::FieldInfo* mutable_transfds(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >*
-      mutable_transfds();
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  const ::rp4::FieldInfo& _internal_transfds(int index) const;
-  ::rp4::FieldInfo* _internal_add_transfds();
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
-  const ::rp4::FieldInfo& transfds(int index) const;
-  ::rp4::FieldInfo* add_transfds();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >&
-      transfds() const;
 
-  // int32 procId = 1;
-  void clear_procid();
-  int32_t procid() const;
-  void set_procid(int32_t value);
-  private:
-  int32_t _internal_procid() const;
-  void _internal_set_procid(int32_t value);
-  public:
-
-  // int32 parserLevel = 2;
-  void clear_parserlevel();
-  int32_t parserlevel() const;
-  void set_parserlevel(int32_t value);
-  private:
-  int32_t _internal_parserlevel() const;
-  void _internal_set_parserlevel(int32_t value);
-  public:
-
-  // int32 state = 3;
-  void clear_state();
-  int32_t state() const;
-  void set_state(int32_t value);
-  private:
-  int32_t _internal_state() const;
-  void _internal_set_state(int32_t value);
-  public:
-
-  // uint32 key = 4;
-  void clear_key();
-  uint32_t key() const;
-  void set_key(uint32_t value);
-  private:
-  uint32_t _internal_key() const;
-  void _internal_set_key(uint32_t value);
-  public:
-
-  // int32 mask = 5;
-  void clear_mask();
-  int32_t mask() const;
-  void set_mask(int32_t value);
-  private:
-  int32_t _internal_mask() const;
-  void _internal_set_mask(int32_t value);
-  public:
-
-  // int32 hdrId = 6;
-  void clear_hdrid();
-  int32_t hdrid() const;
-  void set_hdrid(int32_t value);
-  private:
-  int32_t _internal_hdrid() const;
-  void _internal_set_hdrid(int32_t value);
-  public:
-
-  // int32 hdrLen = 7;
-  void clear_hdrlen();
-  int32_t hdrlen() const;
-  void set_hdrlen(int32_t value);
-  private:
-  int32_t _internal_hdrlen() const;
-  void _internal_set_hdrlen(int32_t value);
-  public:
-
-  // int32 nextState = 8;
-  void clear_nextstate();
-  int32_t nextstate() const;
-  void set_nextstate(int32_t value);
-  private:
-  int32_t _internal_nextstate() const;
-  void _internal_set_nextstate(int32_t value);
-  public:
-
-  // int32 transFieldNum = 9;
-  void clear_transfieldnum();
-  int32_t transfieldnum() const;
-  void set_transfieldnum(int32_t value);
-  private:
-  int32_t _internal_transfieldnum() const;
-  void _internal_set_transfieldnum(int32_t value);
-  public:
-
-  // int32 miss_act = 11;
-  void clear_miss_act();
-  int32_t miss_act() const;
-  void set_miss_act(int32_t value);
-  private:
-  int32_t _internal_miss_act() const;
-  void _internal_set_miss_act(int32_t value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:rp4.ModParserEntryReq)
+  // @@protoc_insertion_point(class_scope:rp4.CommitConfigResp)
  private:
   class _Internal;
 
@@ -1906,17 +1769,7 @@ class ModParserEntryReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo > transfds_;
-    int32_t procid_;
-    int32_t parserlevel_;
-    int32_t state_;
-    uint32_t key_;
-    int32_t mask_;
-    int32_t hdrid_;
-    int32_t hdrlen_;
-    int32_t nextstate_;
-    int32_t transfieldnum_;
-    int32_t miss_act_;
+    int res_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1924,24 +1777,23 @@ class ModParserEntryReq final :
 };
 // -------------------------------------------------------------------
 
-class ModParserEntryResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ModParserEntryResp) */ {
+class AbortConfigReq final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:rp4.AbortConfigReq) */ {
  public:
-  inline ModParserEntryResp() : ModParserEntryResp(nullptr) {}
-  ~ModParserEntryResp() override;
-  explicit PROTOBUF_CONSTEXPR ModParserEntryResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline AbortConfigReq() : AbortConfigReq(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR AbortConfigReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ModParserEntryResp(const ModParserEntryResp& from);
-  ModParserEntryResp(ModParserEntryResp&& from) noexcept
-    : ModParserEntryResp() {
+  AbortConfigReq(const AbortConfigReq& from);
+  AbortConfigReq(AbortConfigReq&& from) noexcept
+    : AbortConfigReq() {
     *this = ::std::move(from);
   }
 
-  inline ModParserEntryResp& operator=(const ModParserEntryResp& from) {
+  inline AbortConfigReq& operator=(const AbortConfigReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ModParserEntryResp& operator=(ModParserEntryResp&& from) noexcept {
+  inline AbortConfigReq& operator=(AbortConfigReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1964,20 +1816,20 @@ class ModParserEntryResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ModParserEntryResp& default_instance() {
+  static const AbortConfigReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ModParserEntryResp* internal_default_instance() {
-    return reinterpret_cast<const ModParserEntryResp*>(
-               &_ModParserEntryResp_default_instance_);
+  static inline const AbortConfigReq* internal_default_instance() {
+    return reinterpret_cast<const AbortConfigReq*>(
+               &_AbortConfigReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     8;
 
-  friend void swap(ModParserEntryResp& a, ModParserEntryResp& b) {
+  friend void swap(AbortConfigReq& a, AbortConfigReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(ModParserEntryResp* other) {
+  inline void Swap(AbortConfigReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1990,7 +1842,7 @@ class ModParserEntryResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ModParserEntryResp* other) {
+  void UnsafeArenaSwap(AbortConfigReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1998,40 +1850,26 @@ class ModParserEntryResp final :
 
   // implements Message ----------------------------------------------
 
-  ModParserEntryResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ModParserEntryResp>(arena);
+  AbortConfigReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AbortConfigReq>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ModParserEntryResp& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ModParserEntryResp& from) {
-    ModParserEntryResp::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const AbortConfigReq& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const AbortConfigReq& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ModParserEntryResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ModParserEntryResp";
+    return "rp4.AbortConfigReq";
   }
   protected:
-  explicit ModParserEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit AbortConfigReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2044,19 +1882,7 @@ class ModParserEntryResp final :
 
   // accessors -------------------------------------------------------
 
-  enum : int {
-    kResFieldNumber = 1,
-  };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
-  private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:rp4.ModParserEntryResp)
+  // @@protoc_insertion_point(class_scope:rp4.AbortConfigReq)
  private:
   class _Internal;
 
@@ -2064,32 +1890,29 @@ class ModParserEntryResp final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
-  union { Impl_ _impl_; };
   friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ClearParserReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearParserReq) */ {
+class AbortConfigResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.AbortConfigResp) */ {
  public:
-  inline ClearParserReq() : ClearParserReq(nullptr) {}
-  ~ClearParserReq() override;
-  explicit PROTOBUF_CONSTEXPR ClearParserReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline AbortConfigResp() : AbortConfigResp(nullptr) {}
+  ~AbortConfigResp() override;
+  explicit PROTOBUF_CONSTEXPR AbortConfigResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearParserReq(const ClearParserReq& from);
-  ClearParserReq(ClearParserReq&& from) noexcept
-    : ClearParserReq() {
+  AbortConfigResp(const AbortConfigResp& from);
+  AbortConfigResp(AbortConfigResp&& from) noexcept
+    : AbortConfigResp() {
     *this = ::std::move(from);
   }
 
-  inline ClearParserReq& operator=(const ClearParserReq& from) {
+  inline AbortConfigResp& operator=(const AbortConfigResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearParserReq& operator=(ClearParserReq&& from) noexcept {
+  inline AbortConfigResp& operator=(AbortConfigResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2112,20 +1935,20 @@ class ClearParserReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearParserReq& default_instance() {
+  static const AbortConfigResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearParserReq* internal_default_instance() {
-    return reinterpret_cast<const ClearParserReq*>(
-               &_ClearParserReq_default_instance_);
+  static inline const AbortConfigResp* internal_default_instance() {
+    return reinterpret_cast<const AbortConfigResp*>(
+               &_AbortConfigResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     9;
 
-  friend void swap(ClearParserReq& a, ClearParserReq& b) {
+  friend void swap(AbortConfigResp& a, AbortConfigResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearParserReq* other) {
+  inline void Swap(AbortConfigResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2138,7 +1961,7 @@ class ClearParserReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearParserReq* other) {
+  void UnsafeArenaSwap(AbortConfigResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2146,14 +1969,14 @@ class ClearParserReq final :
 
   // implements Message ----------------------------------------------
 
-  ClearParserReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearParserReq>(arena);
+  AbortConfigResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AbortConfigResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClearParserReq& from);
+  void CopyFrom(const AbortConfigResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ClearParserReq& from) {
-    ClearParserReq::MergeImpl(*this, from);
+  void MergeFrom( const AbortConfigResp& from) {
+    AbortConfigResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2171,15 +1994,15 @@ class ClearParserReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClearParserReq* other);
+  void InternalSwap(AbortConfigResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearParserReq";
+    return "rp4.AbortConfigResp";
   }
   protected:
-  explicit ClearParserReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit AbortConfigResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2193,18 +2016,18 @@ class ClearParserReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kProcIdFieldNumber = 1,
+    kResFieldNumber = 1,
   };
-  // int32 procId = 1;
-  void clear_procid();
-  int32_t procid() const;
-  void set_procid(int32_t value);
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  int32_t _internal_procid() const;
-  void _internal_set_procid(int32_t value);
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearParserReq)
+  // @@protoc_insertion_point(class_scope:rp4.AbortConfigResp)
  private:
   class _Internal;
 
@@ -2212,7 +2035,7 @@ class ClearParserReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t procid_;
+    int res_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2220,24 +2043,24 @@ class ClearParserReq final :
 };
 // -------------------------------------------------------------------
 
-class ClearParserResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearParserResp) */ {
+class ConfigOp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ConfigOp) */ {
  public:
-  inline ClearParserResp() : ClearParserResp(nullptr) {}
-  ~ClearParserResp() override;
-  explicit PROTOBUF_CONSTEXPR ClearParserResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ConfigOp() : ConfigOp(nullptr) {}
+  ~ConfigOp() override;
+  explicit PROTOBUF_CONSTEXPR ConfigOp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearParserResp(const ClearParserResp& from);
-  ClearParserResp(ClearParserResp&& from) noexcept
-    : ClearParserResp() {
+  ConfigOp(const ConfigOp& from);
+  ConfigOp(ConfigOp&& from) noexcept
+    : ConfigOp() {
     *this = ::std::move(from);
   }
 
-  inline ClearParserResp& operator=(const ClearParserResp& from) {
+  inline ConfigOp& operator=(const ConfigOp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearParserResp& operator=(ClearParserResp&& from) noexcept {
+  inline ConfigOp& operator=(ConfigOp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2260,20 +2083,48 @@ class ClearParserResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearParserResp& default_instance() {
+  static const ConfigOp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearParserResp* internal_default_instance() {
-    return reinterpret_cast<const ClearParserResp*>(
-               &_ClearParserResp_default_instance_);
+  enum OpCase {
+    kSetMetadata = 1,
+    kInitParserLevel = 2,
+    kModParserEntry = 3,
+    kClearParser = 4,
+    kInsertRelationExp = 5,
+    kClearRelationExp = 6,
+    kClearResMap = 7,
+    kModResMap = 8,
+    kSetDefaultGateEntry = 9,
+    kSetNoTable = 10,
+    kSetActionProc = 11,
+    kSetMemConfig = 12,
+    kSetFieldInfo = 13,
+    kClearOldConfig = 14,
+    kSetMissActId = 15,
+    kInsertAction = 16,
+    kClearAction = 17,
+    kDelAction = 18,
+    kLoadSigmoidTable = 19,
+    kClearSigmoidTable = 20,
+    kLoadExpTable = 21,
+    kClearExpTable = 22,
+    kLoadNeuronPrimitiveContext = 23,
+    kClearNeuronPrimitiveContexts = 24,
+    OP_NOT_SET = 0,
+  };
+
+  static inline const ConfigOp* internal_default_instance() {
+    return reinterpret_cast<const ConfigOp*>(
+               &_ConfigOp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     10;
 
-  friend void swap(ClearParserResp& a, ClearParserResp& b) {
+  friend void swap(ConfigOp& a, ConfigOp& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearParserResp* other) {
+  inline void Swap(ConfigOp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2286,7 +2137,7 @@ class ClearParserResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearParserResp* other) {
+  void UnsafeArenaSwap(ConfigOp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2294,14 +2145,14 @@ class ClearParserResp final :
 
   // implements Message ----------------------------------------------
 
-  ClearParserResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearParserResp>(arena);
+  ConfigOp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConfigOp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClearParserResp& from);
+  void CopyFrom(const ConfigOp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ClearParserResp& from) {
-    ClearParserResp::MergeImpl(*this, from);
+  void MergeFrom( const ConfigOp& from) {
+    ConfigOp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2319,15 +2170,15 @@ class ClearParserResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClearParserResp* other);
+  void InternalSwap(ConfigOp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearParserResp";
+    return "rp4.ConfigOp";
   }
   protected:
-  explicit ClearParserResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ConfigOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2341,51 +2192,555 @@ class ClearParserResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kSetMetadataFieldNumber = 1,
+    kInitParserLevelFieldNumber = 2,
+    kModParserEntryFieldNumber = 3,
+    kClearParserFieldNumber = 4,
+    kInsertRelationExpFieldNumber = 5,
+    kClearRelationExpFieldNumber = 6,
+    kClearResMapFieldNumber = 7,
+    kModResMapFieldNumber = 8,
+    kSetDefaultGateEntryFieldNumber = 9,
+    kSetNoTableFieldNumber = 10,
+    kSetActionProcFieldNumber = 11,
+    kSetMemConfigFieldNumber = 12,
+    kSetFieldInfoFieldNumber = 13,
+    kClearOldConfigFieldNumber = 14,
+    kSetMissActIdFieldNumber = 15,
+    kInsertActionFieldNumber = 16,
+    kClearActionFieldNumber = 17,
+    kDelActionFieldNumber = 18,
+    kLoadSigmoidTableFieldNumber = 19,
+    kClearSigmoidTableFieldNumber = 20,
+    kLoadExpTableFieldNumber = 21,
+    kClearExpTableFieldNumber = 22,
+    kLoadNeuronPrimitiveContextFieldNumber = 23,
+    kClearNeuronPrimitiveContextsFieldNumber = 24,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
+  // .rp4.SetMetadataReq setMetadata = 1;
+  bool has_setmetadata() const;
   private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  bool _internal_has_setmetadata() const;
   public:
+  void clear_setmetadata();
+  const ::rp4::SetMetadataReq& setmetadata() const;
+  PROTOBUF_NODISCARD ::rp4::SetMetadataReq* release_setmetadata();
+  ::rp4::SetMetadataReq* mutable_setmetadata();
+  void set_allocated_setmetadata(::rp4::SetMetadataReq* setmetadata);
+  private:
+  const ::rp4::SetMetadataReq& _internal_setmetadata() const;
+  ::rp4::SetMetadataReq* _internal_mutable_setmetadata();
+  public:
+  void unsafe_arena_set_allocated_setmetadata(
+      ::rp4::SetMetadataReq* setmetadata);
+  ::rp4::SetMetadataReq* unsafe_arena_release_setmetadata();
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearParserResp)
- private:
-  class _Internal;
+  // .rp4.ParserLevelReq initParserLevel = 2;
+  bool has_initparserlevel() const;
+  private:
+  bool _internal_has_initparserlevel() const;
+  public:
+  void clear_initparserlevel();
+  const ::rp4::ParserLevelReq& initparserlevel() const;
+  PROTOBUF_NODISCARD ::rp4::ParserLevelReq* release_initparserlevel();
+  ::rp4::ParserLevelReq* mutable_initparserlevel();
+  void set_allocated_initparserlevel(::rp4::ParserLevelReq* initparserlevel);
+  private:
+  const ::rp4::ParserLevelReq& _internal_initparserlevel() const;
+  ::rp4::ParserLevelReq* _internal_mutable_initparserlevel();
+  public:
+  void unsafe_arena_set_allocated_initparserlevel(
+      ::rp4::ParserLevelReq* initparserlevel);
+  ::rp4::ParserLevelReq* unsafe_arena_release_initparserlevel();
 
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  struct Impl_ {
-    int res_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  };
+  // .rp4.ModParserEntryReq modParserEntry = 3;
+  bool has_modparserentry() const;
+  private:
+  bool _internal_has_modparserentry() const;
+  public:
+  void clear_modparserentry();
+  const ::rp4::ModParserEntryReq& modparserentry() const;
+  PROTOBUF_NODISCARD ::rp4::ModParserEntryReq* release_modparserentry();
+  ::rp4::ModParserEntryReq* mutable_modparserentry();
+  void set_allocated_modparserentry(::rp4::ModParserEntryReq* modparserentry);
+  private:
+  const ::rp4::ModParserEntryReq& _internal_modparserentry() const;
+  ::rp4::ModParserEntryReq* _internal_mutable_modparserentry();
+  public:
+  void unsafe_arena_set_allocated_modparserentry(
+      ::rp4::ModParserEntryReq* modparserentry);
+  ::rp4::ModParserEntryReq* unsafe_arena_release_modparserentry();
+
+  // .rp4.ClearParserReq clearParser = 4;
+  bool has_clearparser() const;
+  private:
+  bool _internal_has_clearparser() const;
+  public:
+  void clear_clearparser();
+  const ::rp4::ClearParserReq& clearparser() const;
+  PROTOBUF_NODISCARD ::rp4::ClearParserReq* release_clearparser();
+  ::rp4::ClearParserReq* mutable_clearparser();
+  void set_allocated_clearparser(::rp4::ClearParserReq* clearparser);
+  private:
+  const ::rp4::ClearParserReq& _internal_clearparser() const;
+  ::rp4::ClearParserReq* _internal_mutable_clearparser();
+  public:
+  void unsafe_arena_set_allocated_clearparser(
+      ::rp4::ClearParserReq* clearparser);
+  ::rp4::ClearParserReq* unsafe_arena_release_clearparser();
+
+  // .rp4.InsertRelationExpReq insertRelationExp = 5;
+  bool has_insertrelationexp() const;
+  private:
+  bool _internal_has_insertrelationexp() const;
+  public:
+  void clear_insertrelationexp();
+  const ::rp4::InsertRelationExpReq& insertrelationexp() const;
+  PROTOBUF_NODISCARD ::rp4::InsertRelationExpReq* release_insertrelationexp();
+  ::rp4::InsertRelationExpReq* mutable_insertrelationexp();
+  void set_allocated_insertrelationexp(::rp4::InsertRelationExpReq* insertrelationexp);
+  private:
+  const ::rp4::InsertRelationExpReq& _internal_insertrelationexp() const;
+  ::rp4::InsertRelationExpReq* _internal_mutable_insertrelationexp();
+  public:
+  void unsafe_arena_set_allocated_insertrelationexp(
+      ::rp4::InsertRelationExpReq* insertrelationexp);
+  ::rp4::InsertRelationExpReq* unsafe_arena_release_insertrelationexp();
+
+  // .rp4.ClearRelationExpReq clearRelationExp = 6;
+  bool has_clearrelationexp() const;
+  private:
+  bool _internal_has_clearrelationexp() const;
+  public:
+  void clear_clearrelationexp();
+  const ::rp4::ClearRelationExpReq& clearrelationexp() const;
+  PROTOBUF_NODISCARD ::rp4::ClearRelationExpReq* release_clearrelationexp();
+  ::rp4::ClearRelationExpReq* mutable_clearrelationexp();
+  void set_allocated_clearrelationexp(::rp4::ClearRelationExpReq* clearrelationexp);
+  private:
+  const ::rp4::ClearRelationExpReq& _internal_clearrelationexp() const;
+  ::rp4::ClearRelationExpReq* _internal_mutable_clearrelationexp();
+  public:
+  void unsafe_arena_set_allocated_clearrelationexp(
+      ::rp4::ClearRelationExpReq* clearrelationexp);
+  ::rp4::ClearRelationExpReq* unsafe_arena_release_clearrelationexp();
+
+  // .rp4.ClearResMapReq clearResMap = 7;
+  bool has_clearresmap() const;
+  private:
+  bool _internal_has_clearresmap() const;
+  public:
+  void clear_clearresmap();
+  const ::rp4::ClearResMapReq& clearresmap() const;
+  PROTOBUF_NODISCARD ::rp4::ClearResMapReq* release_clearresmap();
+  ::rp4::ClearResMapReq* mutable_clearresmap();
+  void set_allocated_clearresmap(::rp4::ClearResMapReq* clearresmap);
+  private:
+  const ::rp4::ClearResMapReq& _internal_clearresmap() const;
+  ::rp4::ClearResMapReq* _internal_mutable_clearresmap();
+  public:
+  void unsafe_arena_set_allocated_clearresmap(
+      ::rp4::ClearResMapReq* clearresmap);
+  ::rp4::ClearResMapReq* unsafe_arena_release_clearresmap();
+
+  // .rp4.ModResMapReq modResMap = 8;
+  bool has_modresmap() const;
+  private:
+  bool _internal_has_modresmap() const;
+  public:
+  void clear_modresmap();
+  const ::rp4::ModResMapReq& modresmap() const;
+  PROTOBUF_NODISCARD ::rp4::ModResMapReq* release_modresmap();
+  ::rp4::ModResMapReq* mutable_modresmap();
+  void set_allocated_modresmap(::rp4::ModResMapReq* modresmap);
+  private:
+  const ::rp4::ModResMapReq& _internal_modresmap() const;
+  ::rp4::ModResMapReq* _internal_mutable_modresmap();
+  public:
+  void unsafe_arena_set_allocated_modresmap(
+      ::rp4::ModResMapReq* modresmap);
+  ::rp4::ModResMapReq* unsafe_arena_release_modresmap();
+
+  // .rp4.SetDefaultGateEntryReq setDefaultGateEntry = 9;
+  bool has_setdefaultgateentry() const;
+  private:
+  bool _internal_has_setdefaultgateentry() const;
+  public:
+  void clear_setdefaultgateentry();
+  const ::rp4::SetDefaultGateEntryReq& setdefaultgateentry() const;
+  PROTOBUF_NODISCARD ::rp4::SetDefaultGateEntryReq* release_setdefaultgateentry();
+  ::rp4::SetDefaultGateEntryReq* mutable_setdefaultgateentry();
+  void set_allocated_setdefaultgateentry(::rp4::SetDefaultGateEntryReq* setdefaultgateentry);
+  private:
+  const ::rp4::SetDefaultGateEntryReq& _internal_setdefaultgateentry() const;
+  ::rp4::SetDefaultGateEntryReq* _internal_mutable_setdefaultgateentry();
+  public:
+  void unsafe_arena_set_allocated_setdefaultgateentry(
+      ::rp4::SetDefaultGateEntryReq* setdefaultgateentry);
+  ::rp4::SetDefaultGateEntryReq* unsafe_arena_release_setdefaultgateentry();
+
+  // .rp4.SetNoTableReq setNoTable = 10;
+  bool has_setnotable() const;
+  private:
+  bool _internal_has_setnotable() const;
+  public:
+  void clear_setnotable();
+  const ::rp4::SetNoTableReq& setnotable() const;
+  PROTOBUF_NODISCARD ::rp4::SetNoTableReq* release_setnotable();
+  ::rp4::SetNoTableReq* mutable_setnotable();
+  void set_allocated_setnotable(::rp4::SetNoTableReq* setnotable);
+  private:
+  const ::rp4::SetNoTableReq& _internal_setnotable() const;
+  ::rp4::SetNoTableReq* _internal_mutable_setnotable();
+  public:
+  void unsafe_arena_set_allocated_setnotable(
+      ::rp4::SetNoTableReq* setnotable);
+  ::rp4::SetNoTableReq* unsafe_arena_release_setnotable();
+
+  // .rp4.SetActionProcReq setActionProc = 11;
+  bool has_setactionproc() const;
+  private:
+  bool _internal_has_setactionproc() const;
+  public:
+  void clear_setactionproc();
+  const ::rp4::SetActionProcReq& setactionproc() const;
+  PROTOBUF_NODISCARD ::rp4::SetActionProcReq* release_setactionproc();
+  ::rp4::SetActionProcReq* mutable_setactionproc();
+  void set_allocated_setactionproc(::rp4::SetActionProcReq* setactionproc);
+  private:
+  const ::rp4::SetActionProcReq& _internal_setactionproc() const;
+  ::rp4::SetActionProcReq* _internal_mutable_setactionproc();
+  public:
+  void unsafe_arena_set_allocated_setactionproc(
+      ::rp4::SetActionProcReq* setactionproc);
+  ::rp4::SetActionProcReq* unsafe_arena_release_setactionproc();
+
+  // .rp4.SetMemConfigReq setMemConfig = 12;
+  bool has_setmemconfig() const;
+  private:
+  bool _internal_has_setmemconfig() const;
+  public:
+  void clear_setmemconfig();
+  const ::rp4::SetMemConfigReq& setmemconfig() const;
+  PROTOBUF_NODISCARD ::rp4::SetMemConfigReq* release_setmemconfig();
+  ::rp4::SetMemConfigReq* mutable_setmemconfig();
+  void set_allocated_setmemconfig(::rp4::SetMemConfigReq* setmemconfig);
+  private:
+  const ::rp4::SetMemConfigReq& _internal_setmemconfig() const;
+  ::rp4::SetMemConfigReq* _internal_mutable_setmemconfig();
+  public:
+  void unsafe_arena_set_allocated_setmemconfig(
+      ::rp4::SetMemConfigReq* setmemconfig);
+  ::rp4::SetMemConfigReq* unsafe_arena_release_setmemconfig();
+
+  // .rp4.SetFieldInfoReq setFieldInfo = 13;
+  bool has_setfieldinfo() const;
+  private:
+  bool _internal_has_setfieldinfo() const;
+  public:
+  void clear_setfieldinfo();
+  const ::rp4::SetFieldInfoReq& setfieldinfo() const;
+  PROTOBUF_NODISCARD ::rp4::SetFieldInfoReq* release_setfieldinfo();
+  ::rp4::SetFieldInfoReq* mutable_setfieldinfo();
+  void set_allocated_setfieldinfo(::rp4::SetFieldInfoReq* setfieldinfo);
+  private:
+  const ::rp4::SetFieldInfoReq& _internal_setfieldinfo() const;
+  ::rp4::SetFieldInfoReq* _internal_mutable_setfieldinfo();
+  public:
+  void unsafe_arena_set_allocated_setfieldinfo(
+      ::rp4::SetFieldInfoReq* setfieldinfo);
+  ::rp4::SetFieldInfoReq* unsafe_arena_release_setfieldinfo();
+
+  // .rp4.ClearOldConfigReq clearOldConfig = 14;
+  bool has_clearoldconfig() const;
+  private:
+  bool _internal_has_clearoldconfig() const;
+  public:
+  void clear_clearoldconfig();
+  const ::rp4::ClearOldConfigReq& clearoldconfig() const;
+  PROTOBUF_NODISCARD ::rp4::ClearOldConfigReq* release_clearoldconfig();
+  ::rp4::ClearOldConfigReq* mutable_clearoldconfig();
+  void set_allocated_clearoldconfig(::rp4::ClearOldConfigReq* clearoldconfig);
+  private:
+  const ::rp4::ClearOldConfigReq& _internal_clearoldconfig() const;
+  ::rp4::ClearOldConfigReq* _internal_mutable_clearoldconfig();
+  public:
+  void unsafe_arena_set_allocated_clearoldconfig(
+      ::rp4::ClearOldConfigReq* clearoldconfig);
+  ::rp4::ClearOldConfigReq* unsafe_arena_release_clearoldconfig();
+
+  // .rp4.SetMissActIdReq setMissActId = 15;
+  bool has_setmissactid() const;
+  private:
+  bool _internal_has_setmissactid() const;
+  public:
+  void clear_setmissactid();
+  const ::rp4::SetMissActIdReq& setmissactid() const;
+  PROTOBUF_NODISCARD ::rp4::SetMissActIdReq* release_setmissactid();
+  ::rp4::SetMissActIdReq* mutable_setmissactid();
+  void set_allocated_setmissactid(::rp4::SetMissActIdReq* setmissactid);
+  private:
+  const ::rp4::SetMissActIdReq& _internal_setmissactid() const;
+  ::rp4::SetMissActIdReq* _internal_mutable_setmissactid();
+  public:
+  void unsafe_arena_set_allocated_setmissactid(
+      ::rp4::SetMissActIdReq* setmissactid);
+  ::rp4::SetMissActIdReq* unsafe_arena_release_setmissactid();
+
+  // .rp4.InsertActionReq insertAction = 16;
+  bool has_insertaction() const;
+  private:
+  bool _internal_has_insertaction() const;
+  public:
+  void clear_insertaction();
+  const ::rp4::InsertActionReq& insertaction() const;
+  PROTOBUF_NODISCARD ::rp4::InsertActionReq* release_insertaction();
+  ::rp4::InsertActionReq* mutable_insertaction();
+  void set_allocated_insertaction(::rp4::InsertActionReq* insertaction);
+  private:
+  const ::rp4::InsertActionReq& _internal_insertaction() const;
+  ::rp4::InsertActionReq* _internal_mutable_insertaction();
+  public:
+  void unsafe_arena_set_allocated_insertaction(
+      ::rp4::InsertActionReq* insertaction);
+  ::rp4::InsertActionReq* unsafe_arena_release_insertaction();
+
+  // .rp4.ClearActionReq clearAction = 17;
+  bool has_clearaction() const;
+  private:
+  bool _internal_has_clearaction() const;
+  public:
+  void clear_clearaction();
+  const ::rp4::ClearActionReq& clearaction() const;
+  PROTOBUF_NODISCARD ::rp4::ClearActionReq* release_clearaction();
+  ::rp4::ClearActionReq* mutable_clearaction();
+  void set_allocated_clearaction(::rp4::ClearActionReq* clearaction);
+  private:
+  const ::rp4::ClearActionReq& _internal_clearaction() const;
+  ::rp4::ClearActionReq* _internal_mutable_clearaction();
+  public:
+  void unsafe_arena_set_allocated_clearaction(
+      ::rp4::ClearActionReq* clearaction);
+  ::rp4::ClearActionReq* unsafe_arena_release_clearaction();
+
+  // .rp4.DelActionReq delAction = 18;
+  bool has_delaction() const;
+  private:
+  bool _internal_has_delaction() const;
+  public:
+  void clear_delaction();
+  const ::rp4::DelActionReq& delaction() const;
+  PROTOBUF_NODISCARD ::rp4::DelActionReq* release_delaction();
+  ::rp4::DelActionReq* mutable_delaction();
+  void set_allocated_delaction(::rp4::DelActionReq* delaction);
+  private:
+  const ::rp4::DelActionReq& _internal_delaction() const;
+  ::rp4::DelActionReq* _internal_mutable_delaction();
+  public:
+  void unsafe_arena_set_allocated_delaction(
+      ::rp4::DelActionReq* delaction);
+  ::rp4::DelActionReq* unsafe_arena_release_delaction();
+
+  // .rp4.LoadSigmoidTableReq loadSigmoidTable = 19;
+  bool has_loadsigmoidtable() const;
+  private:
+  bool _internal_has_loadsigmoidtable() const;
+  public:
+  void clear_loadsigmoidtable();
+  const ::rp4::LoadSigmoidTableReq& loadsigmoidtable() const;
+  PROTOBUF_NODISCARD ::rp4::LoadSigmoidTableReq* release_loadsigmoidtable();
+  ::rp4::LoadSigmoidTableReq* mutable_loadsigmoidtable();
+  void set_allocated_loadsigmoidtable(::rp4::LoadSigmoidTableReq* loadsigmoidtable);
+  private:
+  const ::rp4::LoadSigmoidTableReq& _internal_loadsigmoidtable() const;
+  ::rp4::LoadSigmoidTableReq* _internal_mutable_loadsigmoidtable();
+  public:
+  void unsafe_arena_set_allocated_loadsigmoidtable(
+      ::rp4::LoadSigmoidTableReq* loadsigmoidtable);
+  ::rp4::LoadSigmoidTableReq* unsafe_arena_release_loadsigmoidtable();
+
+  // .rp4.ClearSigmoidTableReq clearSigmoidTable = 20;
+  bool has_clearsigmoidtable() const;
+  private:
+  bool _internal_has_clearsigmoidtable() const;
+  public:
+  void clear_clearsigmoidtable();
+  const ::rp4::ClearSigmoidTableReq& clearsigmoidtable() const;
+  PROTOBUF_NODISCARD ::rp4::ClearSigmoidTableReq* release_clearsigmoidtable();
+  ::rp4::ClearSigmoidTableReq* mutable_clearsigmoidtable();
+  void set_allocated_clearsigmoidtable(::rp4::ClearSigmoidTableReq* clearsigmoidtable);
+  private:
+  const ::rp4::ClearSigmoidTableReq& _internal_clearsigmoidtable() const;
+  ::rp4::ClearSigmoidTableReq* _internal_mutable_clearsigmoidtable();
+  public:
+  void unsafe_arena_set_allocated_clearsigmoidtable(
+      ::rp4::ClearSigmoidTableReq* clearsigmoidtable);
+  ::rp4::ClearSigmoidTableReq* unsafe_arena_release_clearsigmoidtable();
+
+  // .rp4.LoadExpTableReq loadExpTable = 21;
+  bool has_loadexptable() const;
+  private:
+  bool _internal_has_loadexptable() const;
+  public:
+  void clear_loadexptable();
+  const ::rp4::LoadExpTableReq& loadexptable() const;
+  PROTOBUF_NODISCARD ::rp4::LoadExpTableReq* release_loadexptable();
+  ::rp4::LoadExpTableReq* mutable_loadexptable();
+  void set_allocated_loadexptable(::rp4::LoadExpTableReq* loadexptable);
+  private:
+  const ::rp4::LoadExpTableReq& _internal_loadexptable() const;
+  ::rp4::LoadExpTableReq* _internal_mutable_loadexptable();
+  public:
+  void unsafe_arena_set_allocated_loadexptable(
+      ::rp4::LoadExpTableReq* loadexptable);
+  ::rp4::LoadExpTableReq* unsafe_arena_release_loadexptable();
+
+  // .rp4.ClearExpTableReq clearExpTable = 22;
+  bool has_clearexptable() const;
+  private:
+  bool _internal_has_clearexptable() const;
+  public:
+  void clear_clearexptable();
+  const ::rp4::ClearExpTableReq& clearexptable() const;
+  PROTOBUF_NODISCARD ::rp4::ClearExpTableReq* release_clearexptable();
+  ::rp4::ClearExpTableReq* mutable_clearexptable();
+  void set_allocated_clearexptable(::rp4::ClearExpTableReq* clearexptable);
+  private:
+  const ::rp4::ClearExpTableReq& _internal_clearexptable() const;
+  ::rp4::ClearExpTableReq* _internal_mutable_clearexptable();
+  public:
+  void unsafe_arena_set_allocated_clearexptable(
+      ::rp4::ClearExpTableReq* clearexptable);
+  ::rp4::ClearExpTableReq* unsafe_arena_release_clearexptable();
+
+  // .rp4.LoadNeuronPrimitiveContextReq loadNeuronPrimitiveContext = 23;
+  bool has_loadneuronprimitivecontext() const;
+  private:
+  bool _internal_has_loadneuronprimitivecontext() const;
+  public:
+  void clear_loadneuronprimitivecontext();
+  const ::rp4::LoadNeuronPrimitiveContextReq& loadneuronprimitivecontext() const;
+  PROTOBUF_NODISCARD ::rp4::LoadNeuronPrimitiveContextReq* release_loadneuronprimitivecontext();
+  ::rp4::LoadNeuronPrimitiveContextReq* mutable_loadneuronprimitivecontext();
+  void set_allocated_loadneuronprimitivecontext(::rp4::LoadNeuronPrimitiveContextReq* loadneuronprimitivecontext);
+  private:
+  const ::rp4::LoadNeuronPrimitiveContextReq& _internal_loadneuronprimitivecontext() const;
+  ::rp4::LoadNeuronPrimitiveContextReq* _internal_mutable_loadneuronprimitivecontext();
+  public:
+  void unsafe_arena_set_allocated_loadneuronprimitivecontext(
+      ::rp4::LoadNeuronPrimitiveContextReq* loadneuronprimitivecontext);
+  ::rp4::LoadNeuronPrimitiveContextReq* unsafe_arena_release_loadneuronprimitivecontext();
+
+  // .rp4.ClearNeuronPrimitiveContextsReq clearNeuronPrimitiveContexts = 24;
+  bool has_clearneuronprimitivecontexts() const;
+  private:
+  bool _internal_has_clearneuronprimitivecontexts() const;
+  public:
+  void clear_clearneuronprimitivecontexts();
+  const ::rp4::ClearNeuronPrimitiveContextsReq& clearneuronprimitivecontexts() const;
+  PROTOBUF_NODISCARD ::rp4::ClearNeuronPrimitiveContextsReq* release_clearneuronprimitivecontexts();
+  ::rp4::ClearNeuronPrimitiveContextsReq* mutable_clearneuronprimitivecontexts();
+  void set_allocated_clearneuronprimitivecontexts(::rp4::ClearNeuronPrimitiveContextsReq* clearneuronprimitivecontexts);
+  private:
+  const ::rp4::ClearNeuronPrimitiveContextsReq& _internal_clearneuronprimitivecontexts() const;
+  ::rp4::ClearNeuronPrimitiveContextsReq* _internal_mutable_clearneuronprimitivecontexts();
+  public:
+  void unsafe_arena_set_allocated_clearneuronprimitivecontexts(
+      ::rp4::ClearNeuronPrimitiveContextsReq* clearneuronprimitivecontexts);
+  ::rp4::ClearNeuronPrimitiveContextsReq* unsafe_arena_release_clearneuronprimitivecontexts();
+
+  void clear_op();
+  OpCase op_case() const;
+  // @@protoc_insertion_point(class_scope:rp4.ConfigOp)
+ private:
+  class _Internal;
+  void set_has_setmetadata();
+  void set_has_initparserlevel();
+  void set_has_modparserentry();
+  void set_has_clearparser();
+  void set_has_insertrelationexp();
+  void set_has_clearrelationexp();
+  void set_has_clearresmap();
+  void set_has_modresmap();
+  void set_has_setdefaultgateentry();
+  void set_has_setnotable();
+  void set_has_setactionproc();
+  void set_has_setmemconfig();
+  void set_has_setfieldinfo();
+  void set_has_clearoldconfig();
+  void set_has_setmissactid();
+  void set_has_insertaction();
+  void set_has_clearaction();
+  void set_has_delaction();
+  void set_has_loadsigmoidtable();
+  void set_has_clearsigmoidtable();
+  void set_has_loadexptable();
+  void set_has_clearexptable();
+  void set_has_loadneuronprimitivecontext();
+  void set_has_clearneuronprimitivecontexts();
+
+  inline bool has_op() const;
+  inline void clear_has_op();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union OpUnion {
+      constexpr OpUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::rp4::SetMetadataReq* setmetadata_;
+      ::rp4::ParserLevelReq* initparserlevel_;
+      ::rp4::ModParserEntryReq* modparserentry_;
+      ::rp4::ClearParserReq* clearparser_;
+      ::rp4::InsertRelationExpReq* insertrelationexp_;
+      ::rp4::ClearRelationExpReq* clearrelationexp_;
+      ::rp4::ClearResMapReq* clearresmap_;
+      ::rp4::ModResMapReq* modresmap_;
+      ::rp4::SetDefaultGateEntryReq* setdefaultgateentry_;
+      ::rp4::SetNoTableReq* setnotable_;
+      ::rp4::SetActionProcReq* setactionproc_;
+      ::rp4::SetMemConfigReq* setmemconfig_;
+      ::rp4::SetFieldInfoReq* setfieldinfo_;
+      ::rp4::ClearOldConfigReq* clearoldconfig_;
+      ::rp4::SetMissActIdReq* setmissactid_;
+      ::rp4::InsertActionReq* insertaction_;
+      ::rp4::ClearActionReq* clearaction_;
+      ::rp4::DelActionReq* delaction_;
+      ::rp4::LoadSigmoidTableReq* loadsigmoidtable_;
+      ::rp4::ClearSigmoidTableReq* clearsigmoidtable_;
+      ::rp4::LoadExpTableReq* loadexptable_;
+      ::rp4::ClearExpTableReq* clearexptable_;
+      ::rp4::LoadNeuronPrimitiveContextReq* loadneuronprimitivecontext_;
+      ::rp4::ClearNeuronPrimitiveContextsReq* clearneuronprimitivecontexts_;
+    } op_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Data final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.Data) */ {
+class ApplyConfigReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ApplyConfigReq) */ {
  public:
-  inline Data() : Data(nullptr) {}
-  ~Data() override;
-  explicit PROTOBUF_CONSTEXPR Data(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ApplyConfigReq() : ApplyConfigReq(nullptr) {}
+  ~ApplyConfigReq() override;
+  explicit PROTOBUF_CONSTEXPR ApplyConfigReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Data(const Data& from);
-  Data(Data&& from) noexcept
-    : Data() {
+  ApplyConfigReq(const ApplyConfigReq& from);
+  ApplyConfigReq(ApplyConfigReq&& from) noexcept
+    : ApplyConfigReq() {
     *this = ::std::move(from);
   }
 
-  inline Data& operator=(const Data& from) {
+  inline ApplyConfigReq& operator=(const ApplyConfigReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Data& operator=(Data&& from) noexcept {
+  inline ApplyConfigReq& operator=(ApplyConfigReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2408,20 +2763,20 @@ class Data final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Data& default_instance() {
+  static const ApplyConfigReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Data* internal_default_instance() {
-    return reinterpret_cast<const Data*>(
-               &_Data_default_instance_);
+  static inline const ApplyConfigReq* internal_default_instance() {
+    return reinterpret_cast<const ApplyConfigReq*>(
+               &_ApplyConfigReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     11;
 
-  friend void swap(Data& a, Data& b) {
+  friend void swap(ApplyConfigReq& a, ApplyConfigReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(Data* other) {
+  inline void Swap(ApplyConfigReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2434,7 +2789,7 @@ class Data final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Data* other) {
+  void UnsafeArenaSwap(ApplyConfigReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2442,14 +2797,14 @@ class Data final :
 
   // implements Message ----------------------------------------------
 
-  Data* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Data>(arena);
+  ApplyConfigReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ApplyConfigReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Data& from);
+  void CopyFrom(const ApplyConfigReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Data& from) {
-    Data::MergeImpl(*this, from);
+  void MergeFrom( const ApplyConfigReq& from) {
+    ApplyConfigReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2467,15 +2822,15 @@ class Data final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Data* other);
+  void InternalSwap(ApplyConfigReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.Data";
+    return "rp4.ApplyConfigReq";
   }
   protected:
-  explicit Data(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ApplyConfigReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2489,33 +2844,27 @@ class Data final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kValFieldNumber = 2,
-    kLenFieldNumber = 1,
+    kOpsFieldNumber = 1,
   };
-  // bytes val = 2;
-  void clear_val();
-  const std::string& val() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_val(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_val();
-  PROTOBUF_NODISCARD std::string* release_val();
-  void set_allocated_val(std::string* val);
+  // repeated .rp4.ConfigOp ops = 1;
+  int ops_size() const;
   private:
-  const std::string& _internal_val() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_val(const std::string& value);
-  std::string* _internal_mutable_val();
+  int _internal_ops_size() const;
   public:
-
-  // int32 len = 1;
-  void clear_len();
-  int32_t len() const;
-  void set_len(int32_t value);
+  void clear_ops();
+  ::rp4::ConfigOp* mutable_ops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ConfigOp >*
+      mutable_ops();
   private:
-  int32_t _internal_len() const;
-  void _internal_set_len(int32_t value);
+  const ::rp4::ConfigOp& _internal_ops(int index) const;
+  ::rp4::ConfigOp* _internal_add_ops();
   public:
+  const ::rp4::ConfigOp& ops(int index) const;
+  ::rp4::ConfigOp* add_ops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ConfigOp >&
+      ops() const;
 
-  // @@protoc_insertion_point(class_scope:rp4.Data)
+  // @@protoc_insertion_point(class_scope:rp4.ApplyConfigReq)
  private:
   class _Internal;
 
@@ -2523,8 +2872,7 @@ class Data final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr val_;
-    int32_t len_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ConfigOp > ops_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2532,24 +2880,24 @@ class Data final :
 };
 // -------------------------------------------------------------------
 
-class GateEntry final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.GateEntry) */ {
+class ApplyConfigResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ApplyConfigResp) */ {
  public:
-  inline GateEntry() : GateEntry(nullptr) {}
-  ~GateEntry() override;
-  explicit PROTOBUF_CONSTEXPR GateEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ApplyConfigResp() : ApplyConfigResp(nullptr) {}
+  ~ApplyConfigResp() override;
+  explicit PROTOBUF_CONSTEXPR ApplyConfigResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  GateEntry(const GateEntry& from);
-  GateEntry(GateEntry&& from) noexcept
-    : GateEntry() {
+  ApplyConfigResp(const ApplyConfigResp& from);
+  ApplyConfigResp(ApplyConfigResp&& from) noexcept
+    : ApplyConfigResp() {
     *this = ::std::move(from);
   }
 
-  inline GateEntry& operator=(const GateEntry& from) {
+  inline ApplyConfigResp& operator=(const ApplyConfigResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline GateEntry& operator=(GateEntry&& from) noexcept {
+  inline ApplyConfigResp& operator=(ApplyConfigResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2572,20 +2920,20 @@ class GateEntry final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const GateEntry& default_instance() {
+  static const ApplyConfigResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const GateEntry* internal_default_instance() {
-    return reinterpret_cast<const GateEntry*>(
-               &_GateEntry_default_instance_);
+  static inline const ApplyConfigResp* internal_default_instance() {
+    return reinterpret_cast<const ApplyConfigResp*>(
+               &_ApplyConfigResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     12;
 
-  friend void swap(GateEntry& a, GateEntry& b) {
+  friend void swap(ApplyConfigResp& a, ApplyConfigResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(GateEntry* other) {
+  inline void Swap(ApplyConfigResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2598,7 +2946,7 @@ class GateEntry final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(GateEntry* other) {
+  void UnsafeArenaSwap(ApplyConfigResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2606,14 +2954,14 @@ class GateEntry final :
 
   // implements Message ----------------------------------------------
 
-  GateEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<GateEntry>(arena);
+  ApplyConfigResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ApplyConfigResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const GateEntry& from);
+  void CopyFrom(const ApplyConfigResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const GateEntry& from) {
-    GateEntry::MergeImpl(*this, from);
+  void MergeFrom( const ApplyConfigResp& from) {
+    ApplyConfigResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2631,15 +2979,15 @@ class GateEntry final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(GateEntry* other);
+  void InternalSwap(ApplyConfigResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.GateEntry";
+    return "rp4.ApplyConfigResp";
   }
   protected:
-  explicit GateEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ApplyConfigResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2653,28 +3001,28 @@ class GateEntry final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kTypeFieldNumber = 1,
-    kValFieldNumber = 2,
+    kResFieldNumber = 1,
+    kAppliedFieldNumber = 2,
   };
-  // .rp4.GateEntryType type = 1;
-  void clear_type();
-  ::rp4::GateEntryType type() const;
-  void set_type(::rp4::GateEntryType value);
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  ::rp4::GateEntryType _internal_type() const;
-  void _internal_set_type(::rp4::GateEntryType value);
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
 
-  // int32 val = 2;
-  void clear_val();
-  int32_t val() const;
-  void set_val(int32_t value);
+  // int32 applied = 2;
+  void clear_applied();
+  int32_t applied() const;
+  void set_applied(int32_t value);
   private:
-  int32_t _internal_val() const;
-  void _internal_set_val(int32_t value);
+  int32_t _internal_applied() const;
+  void _internal_set_applied(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.GateEntry)
+  // @@protoc_insertion_point(class_scope:rp4.ApplyConfigResp)
  private:
   class _Internal;
 
@@ -2682,8 +3030,8 @@ class GateEntry final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int type_;
-    int32_t val_;
+    int res_;
+    int32_t applied_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2691,24 +3039,24 @@ class GateEntry final :
 };
 // -------------------------------------------------------------------
 
-class SetDefaultGateEntryReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetDefaultGateEntryReq) */ {
+class ParserLevelReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ParserLevelReq) */ {
  public:
-  inline SetDefaultGateEntryReq() : SetDefaultGateEntryReq(nullptr) {}
-  ~SetDefaultGateEntryReq() override;
-  explicit PROTOBUF_CONSTEXPR SetDefaultGateEntryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ParserLevelReq() : ParserLevelReq(nullptr) {}
+  ~ParserLevelReq() override;
+  explicit PROTOBUF_CONSTEXPR ParserLevelReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetDefaultGateEntryReq(const SetDefaultGateEntryReq& from);
-  SetDefaultGateEntryReq(SetDefaultGateEntryReq&& from) noexcept
-    : SetDefaultGateEntryReq() {
+  ParserLevelReq(const ParserLevelReq& from);
+  ParserLevelReq(ParserLevelReq&& from) noexcept
+    : ParserLevelReq() {
     *this = ::std::move(from);
   }
 
-  inline SetDefaultGateEntryReq& operator=(const SetDefaultGateEntryReq& from) {
+  inline ParserLevelReq& operator=(const ParserLevelReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetDefaultGateEntryReq& operator=(SetDefaultGateEntryReq&& from) noexcept {
+  inline ParserLevelReq& operator=(ParserLevelReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2731,20 +3079,20 @@ class SetDefaultGateEntryReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetDefaultGateEntryReq& default_instance() {
+  static const ParserLevelReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetDefaultGateEntryReq* internal_default_instance() {
-    return reinterpret_cast<const SetDefaultGateEntryReq*>(
-               &_SetDefaultGateEntryReq_default_instance_);
+  static inline const ParserLevelReq* internal_default_instance() {
+    return reinterpret_cast<const ParserLevelReq*>(
+               &_ParserLevelReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     13;
 
-  friend void swap(SetDefaultGateEntryReq& a, SetDefaultGateEntryReq& b) {
+  friend void swap(ParserLevelReq& a, ParserLevelReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetDefaultGateEntryReq* other) {
+  inline void Swap(ParserLevelReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2757,7 +3105,7 @@ class SetDefaultGateEntryReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetDefaultGateEntryReq* other) {
+  void UnsafeArenaSwap(ParserLevelReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2765,14 +3113,14 @@ class SetDefaultGateEntryReq final :
 
   // implements Message ----------------------------------------------
 
-  SetDefaultGateEntryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetDefaultGateEntryReq>(arena);
+  ParserLevelReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ParserLevelReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetDefaultGateEntryReq& from);
+  void CopyFrom(const ParserLevelReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetDefaultGateEntryReq& from) {
-    SetDefaultGateEntryReq::MergeImpl(*this, from);
+  void MergeFrom( const ParserLevelReq& from) {
+    ParserLevelReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2790,15 +3138,15 @@ class SetDefaultGateEntryReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetDefaultGateEntryReq* other);
+  void InternalSwap(ParserLevelReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.SetDefaultGateEntryReq";
+    return "rp4.ParserLevelReq";
   }
   protected:
-  explicit SetDefaultGateEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ParserLevelReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2812,37 +3160,28 @@ class SetDefaultGateEntryReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kDefaultEntryFieldNumber = 2,
     kProcIdFieldNumber = 1,
+    kParserLevelFieldNumber = 2,
   };
-  // .rp4.GateEntry default_entry = 2;
-  bool has_default_entry() const;
-  private:
-  bool _internal_has_default_entry() const;
-  public:
-  void clear_default_entry();
-  const ::rp4::GateEntry& default_entry() const;
-  PROTOBUF_NODISCARD ::rp4::GateEntry* release_default_entry();
-  ::rp4::GateEntry* mutable_default_entry();
-  void set_allocated_default_entry(::rp4::GateEntry* default_entry);
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
   private:
-  const ::rp4::GateEntry& _internal_default_entry() const;
-  ::rp4::GateEntry* _internal_mutable_default_entry();
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
   public:
-  void unsafe_arena_set_allocated_default_entry(
-      ::rp4::GateEntry* default_entry);
-  ::rp4::GateEntry* unsafe_arena_release_default_entry();
 
-  // int32 proc_id = 1;
-  void clear_proc_id();
-  int32_t proc_id() const;
-  void set_proc_id(int32_t value);
+  // int32 parserLevel = 2;
+  void clear_parserlevel();
+  int32_t parserlevel() const;
+  void set_parserlevel(int32_t value);
   private:
-  int32_t _internal_proc_id() const;
-  void _internal_set_proc_id(int32_t value);
+  int32_t _internal_parserlevel() const;
+  void _internal_set_parserlevel(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.SetDefaultGateEntryReq)
+  // @@protoc_insertion_point(class_scope:rp4.ParserLevelReq)
  private:
   class _Internal;
 
@@ -2850,8 +3189,8 @@ class SetDefaultGateEntryReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::rp4::GateEntry* default_entry_;
-    int32_t proc_id_;
+    int32_t procid_;
+    int32_t parserlevel_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2859,24 +3198,24 @@ class SetDefaultGateEntryReq final :
 };
 // -------------------------------------------------------------------
 
-class SetDefaultGateEntryResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetDefaultGateEntryResp) */ {
+class ParserLevelResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ParserLevelResp) */ {
  public:
-  inline SetDefaultGateEntryResp() : SetDefaultGateEntryResp(nullptr) {}
-  ~SetDefaultGateEntryResp() override;
-  explicit PROTOBUF_CONSTEXPR SetDefaultGateEntryResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ParserLevelResp() : ParserLevelResp(nullptr) {}
+  ~ParserLevelResp() override;
+  explicit PROTOBUF_CONSTEXPR ParserLevelResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetDefaultGateEntryResp(const SetDefaultGateEntryResp& from);
-  SetDefaultGateEntryResp(SetDefaultGateEntryResp&& from) noexcept
-    : SetDefaultGateEntryResp() {
+  ParserLevelResp(const ParserLevelResp& from);
+  ParserLevelResp(ParserLevelResp&& from) noexcept
+    : ParserLevelResp() {
     *this = ::std::move(from);
   }
 
-  inline SetDefaultGateEntryResp& operator=(const SetDefaultGateEntryResp& from) {
+  inline ParserLevelResp& operator=(const ParserLevelResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetDefaultGateEntryResp& operator=(SetDefaultGateEntryResp&& from) noexcept {
+  inline ParserLevelResp& operator=(ParserLevelResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2899,20 +3238,20 @@ class SetDefaultGateEntryResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetDefaultGateEntryResp& default_instance() {
+  static const ParserLevelResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetDefaultGateEntryResp* internal_default_instance() {
-    return reinterpret_cast<const SetDefaultGateEntryResp*>(
-               &_SetDefaultGateEntryResp_default_instance_);
+  static inline const ParserLevelResp* internal_default_instance() {
+    return reinterpret_cast<const ParserLevelResp*>(
+               &_ParserLevelResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     14;
 
-  friend void swap(SetDefaultGateEntryResp& a, SetDefaultGateEntryResp& b) {
+  friend void swap(ParserLevelResp& a, ParserLevelResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetDefaultGateEntryResp* other) {
+  inline void Swap(ParserLevelResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2925,7 +3264,7 @@ class SetDefaultGateEntryResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetDefaultGateEntryResp* other) {
+  void UnsafeArenaSwap(ParserLevelResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2933,14 +3272,14 @@ class SetDefaultGateEntryResp final :
 
   // implements Message ----------------------------------------------
 
-  SetDefaultGateEntryResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetDefaultGateEntryResp>(arena);
+  ParserLevelResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ParserLevelResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetDefaultGateEntryResp& from);
+  void CopyFrom(const ParserLevelResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetDefaultGateEntryResp& from) {
-    SetDefaultGateEntryResp::MergeImpl(*this, from);
+  void MergeFrom( const ParserLevelResp& from) {
+    ParserLevelResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2958,15 +3297,15 @@ class SetDefaultGateEntryResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetDefaultGateEntryResp* other);
+  void InternalSwap(ParserLevelResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.SetDefaultGateEntryResp";
+    return "rp4.ParserLevelResp";
   }
   protected:
-  explicit SetDefaultGateEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ParserLevelResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2991,7 +3330,7 @@ class SetDefaultGateEntryResp final :
   void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.SetDefaultGateEntryResp)
+  // @@protoc_insertion_point(class_scope:rp4.ParserLevelResp)
  private:
   class _Internal;
 
@@ -3007,24 +3346,24 @@ class SetDefaultGateEntryResp final :
 };
 // -------------------------------------------------------------------
 
-class GatewayParam final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.GatewayParam) */ {
+class FieldInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.FieldInfo) */ {
  public:
-  inline GatewayParam() : GatewayParam(nullptr) {}
-  ~GatewayParam() override;
-  explicit PROTOBUF_CONSTEXPR GatewayParam(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline FieldInfo() : FieldInfo(nullptr) {}
+  ~FieldInfo() override;
+  explicit PROTOBUF_CONSTEXPR FieldInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  GatewayParam(const GatewayParam& from);
-  GatewayParam(GatewayParam&& from) noexcept
-    : GatewayParam() {
+  FieldInfo(const FieldInfo& from);
+  FieldInfo(FieldInfo&& from) noexcept
+    : FieldInfo() {
     *this = ::std::move(from);
   }
 
-  inline GatewayParam& operator=(const GatewayParam& from) {
+  inline FieldInfo& operator=(const FieldInfo& from) {
     CopyFrom(from);
     return *this;
   }
-  inline GatewayParam& operator=(GatewayParam&& from) noexcept {
+  inline FieldInfo& operator=(FieldInfo&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3047,26 +3386,20 @@ class GatewayParam final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const GatewayParam& default_instance() {
+  static const FieldInfo& default_instance() {
     return *internal_default_instance();
   }
-  enum ValueCase {
-    kField = 2,
-    kData = 3,
-    VALUE_NOT_SET = 0,
-  };
-
-  static inline const GatewayParam* internal_default_instance() {
-    return reinterpret_cast<const GatewayParam*>(
-               &_GatewayParam_default_instance_);
+  static inline const FieldInfo* internal_default_instance() {
+    return reinterpret_cast<const FieldInfo*>(
+               &_FieldInfo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     15;
 
-  friend void swap(GatewayParam& a, GatewayParam& b) {
+  friend void swap(FieldInfo& a, FieldInfo& b) {
     a.Swap(&b);
   }
-  inline void Swap(GatewayParam* other) {
+  inline void Swap(FieldInfo* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3079,7 +3412,7 @@ class GatewayParam final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(GatewayParam* other) {
+  void UnsafeArenaSwap(FieldInfo* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3087,14 +3420,14 @@ class GatewayParam final :
 
   // implements Message ----------------------------------------------
 
-  GatewayParam* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<GatewayParam>(arena);
+  FieldInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FieldInfo>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const GatewayParam& from);
+  void CopyFrom(const FieldInfo& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const GatewayParam& from) {
-    GatewayParam::MergeImpl(*this, from);
+  void MergeFrom( const FieldInfo& from) {
+    FieldInfo::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -3112,15 +3445,15 @@ class GatewayParam final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(GatewayParam* other);
+  void InternalSwap(FieldInfo* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.GatewayParam";
+    return "rp4.FieldInfo";
   }
   protected:
-  explicit GatewayParam(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit FieldInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3134,104 +3467,84 @@ class GatewayParam final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kParamTypeFieldNumber = 1,
-    kFieldFieldNumber = 2,
-    kDataFieldNumber = 3,
+    kHdrIdFieldNumber = 1,
+    kInternalOffsetFieldNumber = 2,
+    kFieldLenFieldNumber = 3,
+    kFieldTypeFieldNumber = 4,
   };
-  // .rp4.ParameterType paramType = 1;
-  void clear_paramtype();
-  ::rp4::ParameterType paramtype() const;
-  void set_paramtype(::rp4::ParameterType value);
+  // int32 hdrId = 1;
+  void clear_hdrid();
+  int32_t hdrid() const;
+  void set_hdrid(int32_t value);
   private:
-  ::rp4::ParameterType _internal_paramtype() const;
-  void _internal_set_paramtype(::rp4::ParameterType value);
+  int32_t _internal_hdrid() const;
+  void _internal_set_hdrid(int32_t value);
   public:
 
-  // .rp4.FieldInfo field = 2;
-  bool has_field() const;
-  private:
-  bool _internal_has_field() const;
-  public:
-  void clear_field();
-  const ::rp4::FieldInfo& field() const;
-  PROTOBUF_NODISCARD ::rp4::FieldInfo* release_field();
-  ::rp4::FieldInfo* mutable_field();
-  void set_allocated_field(::rp4::FieldInfo* field);
+  // int32 internalOffset = 2;
+  void clear_internaloffset();
+  int32_t internaloffset() const;
+  void set_internaloffset(int32_t value);
   private:
-  const ::rp4::FieldInfo& _internal_field() const;
-  ::rp4::FieldInfo* _internal_mutable_field();
+  int32_t _internal_internaloffset() const;
+  void _internal_set_internaloffset(int32_t value);
   public:
-  void unsafe_arena_set_allocated_field(
-      ::rp4::FieldInfo* field);
-  ::rp4::FieldInfo* unsafe_arena_release_field();
 
-  // .rp4.Data data = 3;
-  bool has_data() const;
+  // int32 fieldLen = 3;
+  void clear_fieldlen();
+  int32_t fieldlen() const;
+  void set_fieldlen(int32_t value);
   private:
-  bool _internal_has_data() const;
+  int32_t _internal_fieldlen() const;
+  void _internal_set_fieldlen(int32_t value);
   public:
-  void clear_data();
-  const ::rp4::Data& data() const;
-  PROTOBUF_NODISCARD ::rp4::Data* release_data();
-  ::rp4::Data* mutable_data();
-  void set_allocated_data(::rp4::Data* data);
+
+  // .rp4.FieldType fieldType = 4;
+  void clear_fieldtype();
+  ::rp4::FieldType fieldtype() const;
+  void set_fieldtype(::rp4::FieldType value);
   private:
-  const ::rp4::Data& _internal_data() const;
-  ::rp4::Data* _internal_mutable_data();
+  ::rp4::FieldType _internal_fieldtype() const;
+  void _internal_set_fieldtype(::rp4::FieldType value);
   public:
-  void unsafe_arena_set_allocated_data(
-      ::rp4::Data* data);
-  ::rp4::Data* unsafe_arena_release_data();
 
-  void clear_value();
-  ValueCase value_case() const;
-  // @@protoc_insertion_point(class_scope:rp4.GatewayParam)
+  // @@protoc_insertion_point(class_scope:rp4.FieldInfo)
  private:
   class _Internal;
-  void set_has_field();
-  void set_has_data();
-
-  inline bool has_value() const;
-  inline void clear_has_value();
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int paramtype_;
-    union ValueUnion {
-      constexpr ValueUnion() : _constinit_{} {}
-        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
-      ::rp4::FieldInfo* field_;
-      ::rp4::Data* data_;
-    } value_;
+    int32_t hdrid_;
+    int32_t internaloffset_;
+    int32_t fieldlen_;
+    int fieldtype_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-    uint32_t _oneof_case_[1];
-
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RelationExp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.RelationExp) */ {
+class ModParserEntryReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ModParserEntryReq) */ {
  public:
-  inline RelationExp() : RelationExp(nullptr) {}
-  ~RelationExp() override;
-  explicit PROTOBUF_CONSTEXPR RelationExp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ModParserEntryReq() : ModParserEntryReq(nullptr) {}
+  ~ModParserEntryReq() override;
+  explicit PROTOBUF_CONSTEXPR ModParserEntryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RelationExp(const RelationExp& from);
-  RelationExp(RelationExp&& from) noexcept
-    : RelationExp() {
+  ModParserEntryReq(const ModParserEntryReq& from);
+  ModParserEntryReq(ModParserEntryReq&& from) noexcept
+    : ModParserEntryReq() {
     *this = ::std::move(from);
   }
 
-  inline RelationExp& operator=(const RelationExp& from) {
+  inline ModParserEntryReq& operator=(const ModParserEntryReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RelationExp& operator=(RelationExp&& from) noexcept {
+  inline ModParserEntryReq& operator=(ModParserEntryReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3254,20 +3567,20 @@ class RelationExp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const RelationExp& default_instance() {
+  static const ModParserEntryReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const RelationExp* internal_default_instance() {
-    return reinterpret_cast<const RelationExp*>(
-               &_RelationExp_default_instance_);
+  static inline const ModParserEntryReq* internal_default_instance() {
+    return reinterpret_cast<const ModParserEntryReq*>(
+               &_ModParserEntryReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     16;
 
-  friend void swap(RelationExp& a, RelationExp& b) {
+  friend void swap(ModParserEntryReq& a, ModParserEntryReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(RelationExp* other) {
+  inline void Swap(ModParserEntryReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3280,7 +3593,7 @@ class RelationExp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RelationExp* other) {
+  void UnsafeArenaSwap(ModParserEntryReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3288,14 +3601,14 @@ class RelationExp final :
 
   // implements Message ----------------------------------------------
 
-  RelationExp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<RelationExp>(arena);
+  ModParserEntryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ModParserEntryReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const RelationExp& from);
+  void CopyFrom(const ModParserEntryReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const RelationExp& from) {
-    RelationExp::MergeImpl(*this, from);
+  void MergeFrom( const ModParserEntryReq& from) {
+    ModParserEntryReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -3313,15 +3626,15 @@ class RelationExp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RelationExp* other);
+  void InternalSwap(ModParserEntryReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.RelationExp";
+    return "rp4.ModParserEntryReq";
   }
   protected:
-  explicit RelationExp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ModParserEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3335,56 +3648,127 @@ class RelationExp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kParam1FieldNumber = 1,
-    kParam2FieldNumber = 2,
-    kRelationFieldNumber = 3,
+    kTransFdsFieldNumber = 10,
+    kProcIdFieldNumber = 1,
+    kParserLevelFieldNumber = 2,
+    kStateFieldNumber = 3,
+    kKeyFieldNumber = 4,
+    kMaskFieldNumber = 5,
+    kHdrIdFieldNumber = 6,
+    kHdrLenFieldNumber = 7,
+    kNextStateFieldNumber = 8,
+    kTransFieldNumFieldNumber = 9,
+    kMissActFieldNumber = 11,
   };
-  // .rp4.GatewayParam param1 = 1;
-  bool has_param1() const;
+  // repeated .rp4.FieldInfo transFds = 10;
+  int transfds_size() const;
   private:
-  bool _internal_has_param1() const;
+  int _internal_transfds_size() const;
   public:
-  void clear_param1();
-  const ::rp4::GatewayParam& param1() const;
-  PROTOBUF_NODISCARD ::rp4::GatewayParam* release_param1();
-  ::rp4::GatewayParam* mutable_param1();
-  void set_allocated_param1(::rp4::GatewayParam* param1);
+  void clear_transfds();
+  ::rp4::FieldInfo* mutable_transfds(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >*
+      mutable_transfds();
   private:
-  const ::rp4::GatewayParam& _internal_param1() const;
-  ::rp4::GatewayParam* _internal_mutable_param1();
+  const ::rp4::FieldInfo& _internal_transfds(int index) const;
+  ::rp4::FieldInfo* _internal_add_transfds();
   public:
-  void unsafe_arena_set_allocated_param1(
-      ::rp4::GatewayParam* param1);
-  ::rp4::GatewayParam* unsafe_arena_release_param1();
+  const ::rp4::FieldInfo& transfds(int index) const;
+  ::rp4::FieldInfo* add_transfds();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >&
+      transfds() const;
 
-  // .rp4.GatewayParam param2 = 2;
-  bool has_param2() const;
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
   private:
-  bool _internal_has_param2() const;
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
   public:
-  void clear_param2();
-  const ::rp4::GatewayParam& param2() const;
-  PROTOBUF_NODISCARD ::rp4::GatewayParam* release_param2();
-  ::rp4::GatewayParam* mutable_param2();
-  void set_allocated_param2(::rp4::GatewayParam* param2);
+
+  // int32 parserLevel = 2;
+  void clear_parserlevel();
+  int32_t parserlevel() const;
+  void set_parserlevel(int32_t value);
   private:
-  const ::rp4::GatewayParam& _internal_param2() const;
-  ::rp4::GatewayParam* _internal_mutable_param2();
+  int32_t _internal_parserlevel() const;
+  void _internal_set_parserlevel(int32_t value);
   public:
-  void unsafe_arena_set_allocated_param2(
-      ::rp4::GatewayParam* param2);
-  ::rp4::GatewayParam* unsafe_arena_release_param2();
 
-  // .rp4.RelationCode relation = 3;
-  void clear_relation();
-  ::rp4::RelationCode relation() const;
-  void set_relation(::rp4::RelationCode value);
+  // int32 state = 3;
+  void clear_state();
+  int32_t state() const;
+  void set_state(int32_t value);
   private:
-  ::rp4::RelationCode _internal_relation() const;
-  void _internal_set_relation(::rp4::RelationCode value);
+  int32_t _internal_state() const;
+  void _internal_set_state(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.RelationExp)
+  // uint32 key = 4;
+  void clear_key();
+  uint32_t key() const;
+  void set_key(uint32_t value);
+  private:
+  uint32_t _internal_key() const;
+  void _internal_set_key(uint32_t value);
+  public:
+
+  // int32 mask = 5;
+  void clear_mask();
+  int32_t mask() const;
+  void set_mask(int32_t value);
+  private:
+  int32_t _internal_mask() const;
+  void _internal_set_mask(int32_t value);
+  public:
+
+  // int32 hdrId = 6;
+  void clear_hdrid();
+  int32_t hdrid() const;
+  void set_hdrid(int32_t value);
+  private:
+  int32_t _internal_hdrid() const;
+  void _internal_set_hdrid(int32_t value);
+  public:
+
+  // int32 hdrLen = 7;
+  void clear_hdrlen();
+  int32_t hdrlen() const;
+  void set_hdrlen(int32_t value);
+  private:
+  int32_t _internal_hdrlen() const;
+  void _internal_set_hdrlen(int32_t value);
+  public:
+
+  // int32 nextState = 8;
+  void clear_nextstate();
+  int32_t nextstate() const;
+  void set_nextstate(int32_t value);
+  private:
+  int32_t _internal_nextstate() const;
+  void _internal_set_nextstate(int32_t value);
+  public:
+
+  // int32 transFieldNum = 9;
+  void clear_transfieldnum();
+  int32_t transfieldnum() const;
+  void set_transfieldnum(int32_t value);
+  private:
+  int32_t _internal_transfieldnum() const;
+  void _internal_set_transfieldnum(int32_t value);
+  public:
+
+  // int32 miss_act = 11;
+  void clear_miss_act();
+  int32_t miss_act() const;
+  void set_miss_act(int32_t value);
+  private:
+  int32_t _internal_miss_act() const;
+  void _internal_set_miss_act(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.ModParserEntryReq)
  private:
   class _Internal;
 
@@ -3392,9 +3776,17 @@ class RelationExp final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::rp4::GatewayParam* param1_;
-    ::rp4::GatewayParam* param2_;
-    int relation_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo > transfds_;
+    int32_t procid_;
+    int32_t parserlevel_;
+    int32_t state_;
+    uint32_t key_;
+    int32_t mask_;
+    int32_t hdrid_;
+    int32_t hdrlen_;
+    int32_t nextstate_;
+    int32_t transfieldnum_;
+    int32_t miss_act_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -3402,24 +3794,24 @@ class RelationExp final :
 };
 // -------------------------------------------------------------------
 
-class InsertRelationExpReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertRelationExpReq) */ {
+class ModParserEntryResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ModParserEntryResp) */ {
  public:
-  inline InsertRelationExpReq() : InsertRelationExpReq(nullptr) {}
-  ~InsertRelationExpReq() override;
-  explicit PROTOBUF_CONSTEXPR InsertRelationExpReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ModParserEntryResp() : ModParserEntryResp(nullptr) {}
+  ~ModParserEntryResp() override;
+  explicit PROTOBUF_CONSTEXPR ModParserEntryResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  InsertRelationExpReq(const InsertRelationExpReq& from);
-  InsertRelationExpReq(InsertRelationExpReq&& from) noexcept
-    : InsertRelationExpReq() {
+  ModParserEntryResp(const ModParserEntryResp& from);
+  ModParserEntryResp(ModParserEntryResp&& from) noexcept
+    : ModParserEntryResp() {
     *this = ::std::move(from);
   }
 
-  inline InsertRelationExpReq& operator=(const InsertRelationExpReq& from) {
+  inline ModParserEntryResp& operator=(const ModParserEntryResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline InsertRelationExpReq& operator=(InsertRelationExpReq&& from) noexcept {
+  inline ModParserEntryResp& operator=(ModParserEntryResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3442,20 +3834,20 @@ class InsertRelationExpReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const InsertRelationExpReq& default_instance() {
+  static const ModParserEntryResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const InsertRelationExpReq* internal_default_instance() {
-    return reinterpret_cast<const InsertRelationExpReq*>(
-               &_InsertRelationExpReq_default_instance_);
+  static inline const ModParserEntryResp* internal_default_instance() {
+    return reinterpret_cast<const ModParserEntryResp*>(
+               &_ModParserEntryResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     17;
 
-  friend void swap(InsertRelationExpReq& a, InsertRelationExpReq& b) {
+  friend void swap(ModParserEntryResp& a, ModParserEntryResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(InsertRelationExpReq* other) {
+  inline void Swap(ModParserEntryResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3468,7 +3860,7 @@ class InsertRelationExpReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(InsertRelationExpReq* other) {
+  void UnsafeArenaSwap(ModParserEntryResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3476,14 +3868,14 @@ class InsertRelationExpReq final :
 
   // implements Message ----------------------------------------------
 
-  InsertRelationExpReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<InsertRelationExpReq>(arena);
+  ModParserEntryResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ModParserEntryResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const InsertRelationExpReq& from);
+  void CopyFrom(const ModParserEntryResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const InsertRelationExpReq& from) {
-    InsertRelationExpReq::MergeImpl(*this, from);
+  void MergeFrom( const ModParserEntryResp& from) {
+    ModParserEntryResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -3501,15 +3893,15 @@ class InsertRelationExpReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(InsertRelationExpReq* other);
+  void InternalSwap(ModParserEntryResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.InsertRelationExpReq";
+    return "rp4.ModParserEntryResp";
   }
   protected:
-  explicit InsertRelationExpReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ModParserEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3523,66 +3915,18 @@ class InsertRelationExpReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kParam1FieldNumber = 2,
-    kParam2FieldNumber = 3,
-    kProcIdFieldNumber = 1,
-    kRelationFieldNumber = 4,
+    kResFieldNumber = 1,
   };
-  // .rp4.GatewayParam param1 = 2;
-  bool has_param1() const;
-  private:
-  bool _internal_has_param1() const;
-  public:
-  void clear_param1();
-  const ::rp4::GatewayParam& param1() const;
-  PROTOBUF_NODISCARD ::rp4::GatewayParam* release_param1();
-  ::rp4::GatewayParam* mutable_param1();
-  void set_allocated_param1(::rp4::GatewayParam* param1);
-  private:
-  const ::rp4::GatewayParam& _internal_param1() const;
-  ::rp4::GatewayParam* _internal_mutable_param1();
-  public:
-  void unsafe_arena_set_allocated_param1(
-      ::rp4::GatewayParam* param1);
-  ::rp4::GatewayParam* unsafe_arena_release_param1();
-
-  // .rp4.GatewayParam param2 = 3;
-  bool has_param2() const;
-  private:
-  bool _internal_has_param2() const;
-  public:
-  void clear_param2();
-  const ::rp4::GatewayParam& param2() const;
-  PROTOBUF_NODISCARD ::rp4::GatewayParam* release_param2();
-  ::rp4::GatewayParam* mutable_param2();
-  void set_allocated_param2(::rp4::GatewayParam* param2);
-  private:
-  const ::rp4::GatewayParam& _internal_param2() const;
-  ::rp4::GatewayParam* _internal_mutable_param2();
-  public:
-  void unsafe_arena_set_allocated_param2(
-      ::rp4::GatewayParam* param2);
-  ::rp4::GatewayParam* unsafe_arena_release_param2();
-
-  // int32 procId = 1;
-  void clear_procid();
-  int32_t procid() const;
-  void set_procid(int32_t value);
-  private:
-  int32_t _internal_procid() const;
-  void _internal_set_procid(int32_t value);
-  public:
-
-  // .rp4.RelationCode relation = 4;
-  void clear_relation();
-  ::rp4::RelationCode relation() const;
-  void set_relation(::rp4::RelationCode value);
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  ::rp4::RelationCode _internal_relation() const;
-  void _internal_set_relation(::rp4::RelationCode value);
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.InsertRelationExpReq)
+  // @@protoc_insertion_point(class_scope:rp4.ModParserEntryResp)
  private:
   class _Internal;
 
@@ -3590,10 +3934,7 @@ class InsertRelationExpReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::rp4::GatewayParam* param1_;
-    ::rp4::GatewayParam* param2_;
-    int32_t procid_;
-    int relation_;
+    int res_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -3601,24 +3942,24 @@ class InsertRelationExpReq final :
 };
 // -------------------------------------------------------------------
 
-class InsertRelationExpResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertRelationExpResp) */ {
+class ClearParserReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearParserReq) */ {
  public:
-  inline InsertRelationExpResp() : InsertRelationExpResp(nullptr) {}
-  ~InsertRelationExpResp() override;
-  explicit PROTOBUF_CONSTEXPR InsertRelationExpResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ClearParserReq() : ClearParserReq(nullptr) {}
+  ~ClearParserReq() override;
+  explicit PROTOBUF_CONSTEXPR ClearParserReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  InsertRelationExpResp(const InsertRelationExpResp& from);
-  InsertRelationExpResp(InsertRelationExpResp&& from) noexcept
-    : InsertRelationExpResp() {
+  ClearParserReq(const ClearParserReq& from);
+  ClearParserReq(ClearParserReq&& from) noexcept
+    : ClearParserReq() {
     *this = ::std::move(from);
   }
 
-  inline InsertRelationExpResp& operator=(const InsertRelationExpResp& from) {
+  inline ClearParserReq& operator=(const ClearParserReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline InsertRelationExpResp& operator=(InsertRelationExpResp&& from) noexcept {
+  inline ClearParserReq& operator=(ClearParserReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3641,20 +3982,20 @@ class InsertRelationExpResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const InsertRelationExpResp& default_instance() {
+  static const ClearParserReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const InsertRelationExpResp* internal_default_instance() {
-    return reinterpret_cast<const InsertRelationExpResp*>(
-               &_InsertRelationExpResp_default_instance_);
+  static inline const ClearParserReq* internal_default_instance() {
+    return reinterpret_cast<const ClearParserReq*>(
+               &_ClearParserReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     18;
 
-  friend void swap(InsertRelationExpResp& a, InsertRelationExpResp& b) {
+  friend void swap(ClearParserReq& a, ClearParserReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(InsertRelationExpResp* other) {
+  inline void Swap(ClearParserReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3667,7 +4008,7 @@ class InsertRelationExpResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(InsertRelationExpResp* other) {
+  void UnsafeArenaSwap(ClearParserReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3675,14 +4016,14 @@ class InsertRelationExpResp final :
 
   // implements Message ----------------------------------------------
 
-  InsertRelationExpResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<InsertRelationExpResp>(arena);
+  ClearParserReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearParserReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const InsertRelationExpResp& from);
+  void CopyFrom(const ClearParserReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const InsertRelationExpResp& from) {
-    InsertRelationExpResp::MergeImpl(*this, from);
+  void MergeFrom( const ClearParserReq& from) {
+    ClearParserReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -3700,15 +4041,15 @@ class InsertRelationExpResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(InsertRelationExpResp* other);
+  void InternalSwap(ClearParserReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.InsertRelationExpResp";
+    return "rp4.ClearParserReq";
   }
   protected:
-  explicit InsertRelationExpResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ClearParserReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3722,18 +4063,18 @@ class InsertRelationExpResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kProcIdFieldNumber = 1,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
   private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.InsertRelationExpResp)
+  // @@protoc_insertion_point(class_scope:rp4.ClearParserReq)
  private:
   class _Internal;
 
@@ -3741,7 +4082,7 @@ class InsertRelationExpResp final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
+    int32_t procid_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -3749,24 +4090,24 @@ class InsertRelationExpResp final :
 };
 // -------------------------------------------------------------------
 
-class ClearRelationExpReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearRelationExpReq) */ {
+class ClearParserResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearParserResp) */ {
  public:
-  inline ClearRelationExpReq() : ClearRelationExpReq(nullptr) {}
-  ~ClearRelationExpReq() override;
-  explicit PROTOBUF_CONSTEXPR ClearRelationExpReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ClearParserResp() : ClearParserResp(nullptr) {}
+  ~ClearParserResp() override;
+  explicit PROTOBUF_CONSTEXPR ClearParserResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearRelationExpReq(const ClearRelationExpReq& from);
-  ClearRelationExpReq(ClearRelationExpReq&& from) noexcept
-    : ClearRelationExpReq() {
+  ClearParserResp(const ClearParserResp& from);
+  ClearParserResp(ClearParserResp&& from) noexcept
+    : ClearParserResp() {
     *this = ::std::move(from);
   }
 
-  inline ClearRelationExpReq& operator=(const ClearRelationExpReq& from) {
+  inline ClearParserResp& operator=(const ClearParserResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearRelationExpReq& operator=(ClearRelationExpReq&& from) noexcept {
+  inline ClearParserResp& operator=(ClearParserResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3789,20 +4130,20 @@ class ClearRelationExpReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearRelationExpReq& default_instance() {
+  static const ClearParserResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearRelationExpReq* internal_default_instance() {
-    return reinterpret_cast<const ClearRelationExpReq*>(
-               &_ClearRelationExpReq_default_instance_);
+  static inline const ClearParserResp* internal_default_instance() {
+    return reinterpret_cast<const ClearParserResp*>(
+               &_ClearParserResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     19;
 
-  friend void swap(ClearRelationExpReq& a, ClearRelationExpReq& b) {
+  friend void swap(ClearParserResp& a, ClearParserResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearRelationExpReq* other) {
+  inline void Swap(ClearParserResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3815,7 +4156,7 @@ class ClearRelationExpReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearRelationExpReq* other) {
+  void UnsafeArenaSwap(ClearParserResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3823,14 +4164,14 @@ class ClearRelationExpReq final :
 
   // implements Message ----------------------------------------------
 
-  ClearRelationExpReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearRelationExpReq>(arena);
+  ClearParserResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearParserResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClearRelationExpReq& from);
+  void CopyFrom(const ClearParserResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ClearRelationExpReq& from) {
-    ClearRelationExpReq::MergeImpl(*this, from);
+  void MergeFrom( const ClearParserResp& from) {
+    ClearParserResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -3848,15 +4189,15 @@ class ClearRelationExpReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClearRelationExpReq* other);
+  void InternalSwap(ClearParserResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearRelationExpReq";
+    return "rp4.ClearParserResp";
   }
   protected:
-  explicit ClearRelationExpReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ClearParserResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3870,18 +4211,18 @@ class ClearRelationExpReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kProcIdFieldNumber = 1,
+    kResFieldNumber = 1,
   };
-  // int32 procId = 1;
-  void clear_procid();
-  int32_t procid() const;
-  void set_procid(int32_t value);
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  int32_t _internal_procid() const;
-  void _internal_set_procid(int32_t value);
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearRelationExpReq)
+  // @@protoc_insertion_point(class_scope:rp4.ClearParserResp)
  private:
   class _Internal;
 
@@ -3889,7 +4230,7 @@ class ClearRelationExpReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t procid_;
+    int res_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -3897,24 +4238,24 @@ class ClearRelationExpReq final :
 };
 // -------------------------------------------------------------------
 
-class ClearRelationExpResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearRelationExpResp) */ {
+class Data final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.Data) */ {
  public:
-  inline ClearRelationExpResp() : ClearRelationExpResp(nullptr) {}
-  ~ClearRelationExpResp() override;
-  explicit PROTOBUF_CONSTEXPR ClearRelationExpResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline Data() : Data(nullptr) {}
+  ~Data() override;
+  explicit PROTOBUF_CONSTEXPR Data(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearRelationExpResp(const ClearRelationExpResp& from);
-  ClearRelationExpResp(ClearRelationExpResp&& from) noexcept
-    : ClearRelationExpResp() {
+  Data(const Data& from);
+  Data(Data&& from) noexcept
+    : Data() {
     *this = ::std::move(from);
   }
 
-  inline ClearRelationExpResp& operator=(const ClearRelationExpResp& from) {
+  inline Data& operator=(const Data& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearRelationExpResp& operator=(ClearRelationExpResp&& from) noexcept {
+  inline Data& operator=(Data&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3937,20 +4278,20 @@ class ClearRelationExpResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearRelationExpResp& default_instance() {
+  static const Data& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearRelationExpResp* internal_default_instance() {
-    return reinterpret_cast<const ClearRelationExpResp*>(
-               &_ClearRelationExpResp_default_instance_);
+  static inline const Data* internal_default_instance() {
+    return reinterpret_cast<const Data*>(
+               &_Data_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     20;
 
-  friend void swap(ClearRelationExpResp& a, ClearRelationExpResp& b) {
+  friend void swap(Data& a, Data& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearRelationExpResp* other) {
+  inline void Swap(Data* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3963,7 +4304,7 @@ class ClearRelationExpResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearRelationExpResp* other) {
+  void UnsafeArenaSwap(Data* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3971,14 +4312,14 @@ class ClearRelationExpResp final :
 
   // implements Message ----------------------------------------------
 
-  ClearRelationExpResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearRelationExpResp>(arena);
+  Data* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Data>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClearRelationExpResp& from);
+  void CopyFrom(const Data& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ClearRelationExpResp& from) {
-    ClearRelationExpResp::MergeImpl(*this, from);
+  void MergeFrom( const Data& from) {
+    Data::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -3996,15 +4337,15 @@ class ClearRelationExpResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClearRelationExpResp* other);
+  void InternalSwap(Data* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearRelationExpResp";
+    return "rp4.Data";
   }
   protected:
-  explicit ClearRelationExpResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit Data(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -4018,18 +4359,33 @@ class ClearRelationExpResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kValFieldNumber = 2,
+    kLenFieldNumber = 1,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
+  // bytes val = 2;
+  void clear_val();
+  const std::string& val() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_val(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_val();
+  PROTOBUF_NODISCARD std::string* release_val();
+  void set_allocated_val(std::string* val);
   private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  const std::string& _internal_val() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_val(const std::string& value);
+  std::string* _internal_mutable_val();
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearRelationExpResp)
+  // int32 len = 1;
+  void clear_len();
+  int32_t len() const;
+  void set_len(int32_t value);
+  private:
+  int32_t _internal_len() const;
+  void _internal_set_len(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.Data)
  private:
   class _Internal;
 
@@ -4037,7 +4393,8 @@ class ClearRelationExpResp final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr val_;
+    int32_t len_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -4045,24 +4402,24 @@ class ClearRelationExpResp final :
 };
 // -------------------------------------------------------------------
 
-class ClearResMapReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearResMapReq) */ {
+class GateEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.GateEntry) */ {
  public:
-  inline ClearResMapReq() : ClearResMapReq(nullptr) {}
-  ~ClearResMapReq() override;
-  explicit PROTOBUF_CONSTEXPR ClearResMapReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline GateEntry() : GateEntry(nullptr) {}
+  ~GateEntry() override;
+  explicit PROTOBUF_CONSTEXPR GateEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearResMapReq(const ClearResMapReq& from);
-  ClearResMapReq(ClearResMapReq&& from) noexcept
-    : ClearResMapReq() {
+  GateEntry(const GateEntry& from);
+  GateEntry(GateEntry&& from) noexcept
+    : GateEntry() {
     *this = ::std::move(from);
   }
 
-  inline ClearResMapReq& operator=(const ClearResMapReq& from) {
+  inline GateEntry& operator=(const GateEntry& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearResMapReq& operator=(ClearResMapReq&& from) noexcept {
+  inline GateEntry& operator=(GateEntry&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4085,20 +4442,20 @@ class ClearResMapReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearResMapReq& default_instance() {
+  static const GateEntry& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearResMapReq* internal_default_instance() {
-    return reinterpret_cast<const ClearResMapReq*>(
-               &_ClearResMapReq_default_instance_);
+  static inline const GateEntry* internal_default_instance() {
+    return reinterpret_cast<const GateEntry*>(
+               &_GateEntry_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     21;
 
-  friend void swap(ClearResMapReq& a, ClearResMapReq& b) {
+  friend void swap(GateEntry& a, GateEntry& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearResMapReq* other) {
+  inline void Swap(GateEntry* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4111,7 +4468,7 @@ class ClearResMapReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearResMapReq* other) {
+  void UnsafeArenaSwap(GateEntry* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4119,14 +4476,14 @@ class ClearResMapReq final :
 
   // implements Message ----------------------------------------------
 
-  ClearResMapReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearResMapReq>(arena);
+  GateEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GateEntry>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClearResMapReq& from);
+  void CopyFrom(const GateEntry& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ClearResMapReq& from) {
-    ClearResMapReq::MergeImpl(*this, from);
+  void MergeFrom( const GateEntry& from) {
+    GateEntry::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -4144,15 +4501,15 @@ class ClearResMapReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClearResMapReq* other);
+  void InternalSwap(GateEntry* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearResMapReq";
+    return "rp4.GateEntry";
   }
   protected:
-  explicit ClearResMapReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit GateEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -4166,18 +4523,28 @@ class ClearResMapReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kProcIdFieldNumber = 1,
+    kTypeFieldNumber = 1,
+    kValFieldNumber = 2,
   };
-  // int32 procId = 1;
-  void clear_procid();
-  int32_t procid() const;
-  void set_procid(int32_t value);
+  // .rp4.GateEntryType type = 1;
+  void clear_type();
+  ::rp4::GateEntryType type() const;
+  void set_type(::rp4::GateEntryType value);
   private:
-  int32_t _internal_procid() const;
-  void _internal_set_procid(int32_t value);
+  ::rp4::GateEntryType _internal_type() const;
+  void _internal_set_type(::rp4::GateEntryType value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearResMapReq)
+  // int32 val = 2;
+  void clear_val();
+  int32_t val() const;
+  void set_val(int32_t value);
+  private:
+  int32_t _internal_val() const;
+  void _internal_set_val(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.GateEntry)
  private:
   class _Internal;
 
@@ -4185,7 +4552,8 @@ class ClearResMapReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t procid_;
+    int type_;
+    int32_t val_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -4193,24 +4561,24 @@ class ClearResMapReq final :
 };
 // -------------------------------------------------------------------
 
-class ClearResMapResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearResMapResp) */ {
+class SetDefaultGateEntryReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetDefaultGateEntryReq) */ {
  public:
-  inline ClearResMapResp() : ClearResMapResp(nullptr) {}
-  ~ClearResMapResp() override;
-  explicit PROTOBUF_CONSTEXPR ClearResMapResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetDefaultGateEntryReq() : SetDefaultGateEntryReq(nullptr) {}
+  ~SetDefaultGateEntryReq() override;
+  explicit PROTOBUF_CONSTEXPR SetDefaultGateEntryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearResMapResp(const ClearResMapResp& from);
-  ClearResMapResp(ClearResMapResp&& from) noexcept
-    : ClearResMapResp() {
+  SetDefaultGateEntryReq(const SetDefaultGateEntryReq& from);
+  SetDefaultGateEntryReq(SetDefaultGateEntryReq&& from) noexcept
+    : SetDefaultGateEntryReq() {
     *this = ::std::move(from);
   }
 
-  inline ClearResMapResp& operator=(const ClearResMapResp& from) {
+  inline SetDefaultGateEntryReq& operator=(const SetDefaultGateEntryReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearResMapResp& operator=(ClearResMapResp&& from) noexcept {
+  inline SetDefaultGateEntryReq& operator=(SetDefaultGateEntryReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4233,20 +4601,20 @@ class ClearResMapResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearResMapResp& default_instance() {
+  static const SetDefaultGateEntryReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearResMapResp* internal_default_instance() {
-    return reinterpret_cast<const ClearResMapResp*>(
-               &_ClearResMapResp_default_instance_);
+  static inline const SetDefaultGateEntryReq* internal_default_instance() {
+    return reinterpret_cast<const SetDefaultGateEntryReq*>(
+               &_SetDefaultGateEntryReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     22;
 
-  friend void swap(ClearResMapResp& a, ClearResMapResp& b) {
+  friend void swap(SetDefaultGateEntryReq& a, SetDefaultGateEntryReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearResMapResp* other) {
+  inline void Swap(SetDefaultGateEntryReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4259,7 +4627,7 @@ class ClearResMapResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearResMapResp* other) {
+  void UnsafeArenaSwap(SetDefaultGateEntryReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4267,14 +4635,14 @@ class ClearResMapResp final :
 
   // implements Message ----------------------------------------------
 
-  ClearResMapResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearResMapResp>(arena);
+  SetDefaultGateEntryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetDefaultGateEntryReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClearResMapResp& from);
+  void CopyFrom(const SetDefaultGateEntryReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ClearResMapResp& from) {
-    ClearResMapResp::MergeImpl(*this, from);
+  void MergeFrom( const SetDefaultGateEntryReq& from) {
+    SetDefaultGateEntryReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -4292,15 +4660,15 @@ class ClearResMapResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClearResMapResp* other);
+  void InternalSwap(SetDefaultGateEntryReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearResMapResp";
+    return "rp4.SetDefaultGateEntryReq";
   }
   protected:
-  explicit ClearResMapResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetDefaultGateEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -4314,18 +4682,37 @@ class ClearResMapResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kDefaultEntryFieldNumber = 2,
+    kProcIdFieldNumber = 1,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
+  // .rp4.GateEntry default_entry = 2;
+  bool has_default_entry() const;
   private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  bool _internal_has_default_entry() const;
+  public:
+  void clear_default_entry();
+  const ::rp4::GateEntry& default_entry() const;
+  PROTOBUF_NODISCARD ::rp4::GateEntry* release_default_entry();
+  ::rp4::GateEntry* mutable_default_entry();
+  void set_allocated_default_entry(::rp4::GateEntry* default_entry);
+  private:
+  const ::rp4::GateEntry& _internal_default_entry() const;
+  ::rp4::GateEntry* _internal_mutable_default_entry();
   public:
+  void unsafe_arena_set_allocated_default_entry(
+      ::rp4::GateEntry* default_entry);
+  ::rp4::GateEntry* unsafe_arena_release_default_entry();
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearResMapResp)
+  // int32 proc_id = 1;
+  void clear_proc_id();
+  int32_t proc_id() const;
+  void set_proc_id(int32_t value);
+  private:
+  int32_t _internal_proc_id() const;
+  void _internal_set_proc_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.SetDefaultGateEntryReq)
  private:
   class _Internal;
 
@@ -4333,7 +4720,8 @@ class ClearResMapResp final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
+    ::rp4::GateEntry* default_entry_;
+    int32_t proc_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -4341,24 +4729,24 @@ class ClearResMapResp final :
 };
 // -------------------------------------------------------------------
 
-class ModResMapReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ModResMapReq) */ {
+class SetDefaultGateEntryResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetDefaultGateEntryResp) */ {
  public:
-  inline ModResMapReq() : ModResMapReq(nullptr) {}
-  ~ModResMapReq() override;
-  explicit PROTOBUF_CONSTEXPR ModResMapReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetDefaultGateEntryResp() : SetDefaultGateEntryResp(nullptr) {}
+  ~SetDefaultGateEntryResp() override;
+  explicit PROTOBUF_CONSTEXPR SetDefaultGateEntryResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ModResMapReq(const ModResMapReq& from);
-  ModResMapReq(ModResMapReq&& from) noexcept
-    : ModResMapReq() {
+  SetDefaultGateEntryResp(const SetDefaultGateEntryResp& from);
+  SetDefaultGateEntryResp(SetDefaultGateEntryResp&& from) noexcept
+    : SetDefaultGateEntryResp() {
     *this = ::std::move(from);
   }
 
-  inline ModResMapReq& operator=(const ModResMapReq& from) {
+  inline SetDefaultGateEntryResp& operator=(const SetDefaultGateEntryResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ModResMapReq& operator=(ModResMapReq&& from) noexcept {
+  inline SetDefaultGateEntryResp& operator=(SetDefaultGateEntryResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4381,20 +4769,20 @@ class ModResMapReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ModResMapReq& default_instance() {
+  static const SetDefaultGateEntryResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ModResMapReq* internal_default_instance() {
-    return reinterpret_cast<const ModResMapReq*>(
-               &_ModResMapReq_default_instance_);
+  static inline const SetDefaultGateEntryResp* internal_default_instance() {
+    return reinterpret_cast<const SetDefaultGateEntryResp*>(
+               &_SetDefaultGateEntryResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     23;
 
-  friend void swap(ModResMapReq& a, ModResMapReq& b) {
+  friend void swap(SetDefaultGateEntryResp& a, SetDefaultGateEntryResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(ModResMapReq* other) {
+  inline void Swap(SetDefaultGateEntryResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4407,7 +4795,7 @@ class ModResMapReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ModResMapReq* other) {
+  void UnsafeArenaSwap(SetDefaultGateEntryResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4415,14 +4803,14 @@ class ModResMapReq final :
 
   // implements Message ----------------------------------------------
 
-  ModResMapReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ModResMapReq>(arena);
+  SetDefaultGateEntryResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetDefaultGateEntryResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ModResMapReq& from);
+  void CopyFrom(const SetDefaultGateEntryResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ModResMapReq& from) {
-    ModResMapReq::MergeImpl(*this, from);
+  void MergeFrom( const SetDefaultGateEntryResp& from) {
+    SetDefaultGateEntryResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -4440,15 +4828,15 @@ class ModResMapReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ModResMapReq* other);
+  void InternalSwap(SetDefaultGateEntryResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ModResMapReq";
+    return "rp4.SetDefaultGateEntryResp";
   }
   protected:
-  explicit ModResMapReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetDefaultGateEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -4462,47 +4850,18 @@ class ModResMapReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kEntryFieldNumber = 3,
-    kProcIdFieldNumber = 1,
-    kKeyFieldNumber = 2,
+    kResFieldNumber = 1,
   };
-  // .rp4.GateEntry entry = 3;
-  bool has_entry() const;
-  private:
-  bool _internal_has_entry() const;
-  public:
-  void clear_entry();
-  const ::rp4::GateEntry& entry() const;
-  PROTOBUF_NODISCARD ::rp4::GateEntry* release_entry();
-  ::rp4::GateEntry* mutable_entry();
-  void set_allocated_entry(::rp4::GateEntry* entry);
-  private:
-  const ::rp4::GateEntry& _internal_entry() const;
-  ::rp4::GateEntry* _internal_mutable_entry();
-  public:
-  void unsafe_arena_set_allocated_entry(
-      ::rp4::GateEntry* entry);
-  ::rp4::GateEntry* unsafe_arena_release_entry();
-
-  // int32 procId = 1;
-  void clear_procid();
-  int32_t procid() const;
-  void set_procid(int32_t value);
-  private:
-  int32_t _internal_procid() const;
-  void _internal_set_procid(int32_t value);
-  public:
-
-  // int32 key = 2;
-  void clear_key();
-  int32_t key() const;
-  void set_key(int32_t value);
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  int32_t _internal_key() const;
-  void _internal_set_key(int32_t value);
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ModResMapReq)
+  // @@protoc_insertion_point(class_scope:rp4.SetDefaultGateEntryResp)
  private:
   class _Internal;
 
@@ -4510,9 +4869,7 @@ class ModResMapReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::rp4::GateEntry* entry_;
-    int32_t procid_;
-    int32_t key_;
+    int res_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -4520,24 +4877,24 @@ class ModResMapReq final :
 };
 // -------------------------------------------------------------------
 
-class ModResMapResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ModResMapResp) */ {
+class GatewayParam final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.GatewayParam) */ {
  public:
-  inline ModResMapResp() : ModResMapResp(nullptr) {}
-  ~ModResMapResp() override;
-  explicit PROTOBUF_CONSTEXPR ModResMapResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline GatewayParam() : GatewayParam(nullptr) {}
+  ~GatewayParam() override;
+  explicit PROTOBUF_CONSTEXPR GatewayParam(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ModResMapResp(const ModResMapResp& from);
-  ModResMapResp(ModResMapResp&& from) noexcept
-    : ModResMapResp() {
+  GatewayParam(const GatewayParam& from);
+  GatewayParam(GatewayParam&& from) noexcept
+    : GatewayParam() {
     *this = ::std::move(from);
   }
 
-  inline ModResMapResp& operator=(const ModResMapResp& from) {
+  inline GatewayParam& operator=(const GatewayParam& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ModResMapResp& operator=(ModResMapResp&& from) noexcept {
+  inline GatewayParam& operator=(GatewayParam&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4560,20 +4917,26 @@ class ModResMapResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ModResMapResp& default_instance() {
+  static const GatewayParam& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ModResMapResp* internal_default_instance() {
-    return reinterpret_cast<const ModResMapResp*>(
-               &_ModResMapResp_default_instance_);
+  enum ValueCase {
+    kField = 2,
+    kData = 3,
+    VALUE_NOT_SET = 0,
+  };
+
+  static inline const GatewayParam* internal_default_instance() {
+    return reinterpret_cast<const GatewayParam*>(
+               &_GatewayParam_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     24;
 
-  friend void swap(ModResMapResp& a, ModResMapResp& b) {
+  friend void swap(GatewayParam& a, GatewayParam& b) {
     a.Swap(&b);
   }
-  inline void Swap(ModResMapResp* other) {
+  inline void Swap(GatewayParam* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4586,7 +4949,7 @@ class ModResMapResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ModResMapResp* other) {
+  void UnsafeArenaSwap(GatewayParam* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4594,14 +4957,14 @@ class ModResMapResp final :
 
   // implements Message ----------------------------------------------
 
-  ModResMapResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ModResMapResp>(arena);
+  GatewayParam* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GatewayParam>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ModResMapResp& from);
+  void CopyFrom(const GatewayParam& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ModResMapResp& from) {
-    ModResMapResp::MergeImpl(*this, from);
+  void MergeFrom( const GatewayParam& from) {
+    GatewayParam::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -4619,15 +4982,15 @@ class ModResMapResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ModResMapResp* other);
+  void InternalSwap(GatewayParam* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ModResMapResp";
+    return "rp4.GatewayParam";
   }
   protected:
-  explicit ModResMapResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit GatewayParam(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -4641,51 +5004,104 @@ class ModResMapResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kParamTypeFieldNumber = 1,
+    kFieldFieldNumber = 2,
+    kDataFieldNumber = 3,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
+  // .rp4.ParameterType paramType = 1;
+  void clear_paramtype();
+  ::rp4::ParameterType paramtype() const;
+  void set_paramtype(::rp4::ParameterType value);
   private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  ::rp4::ParameterType _internal_paramtype() const;
+  void _internal_set_paramtype(::rp4::ParameterType value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ModResMapResp)
+  // .rp4.FieldInfo field = 2;
+  bool has_field() const;
+  private:
+  bool _internal_has_field() const;
+  public:
+  void clear_field();
+  const ::rp4::FieldInfo& field() const;
+  PROTOBUF_NODISCARD ::rp4::FieldInfo* release_field();
+  ::rp4::FieldInfo* mutable_field();
+  void set_allocated_field(::rp4::FieldInfo* field);
+  private:
+  const ::rp4::FieldInfo& _internal_field() const;
+  ::rp4::FieldInfo* _internal_mutable_field();
+  public:
+  void unsafe_arena_set_allocated_field(
+      ::rp4::FieldInfo* field);
+  ::rp4::FieldInfo* unsafe_arena_release_field();
+
+  // .rp4.Data data = 3;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const ::rp4::Data& data() const;
+  PROTOBUF_NODISCARD ::rp4::Data* release_data();
+  ::rp4::Data* mutable_data();
+  void set_allocated_data(::rp4::Data* data);
+  private:
+  const ::rp4::Data& _internal_data() const;
+  ::rp4::Data* _internal_mutable_data();
+  public:
+  void unsafe_arena_set_allocated_data(
+      ::rp4::Data* data);
+  ::rp4::Data* unsafe_arena_release_data();
+
+  void clear_value();
+  ValueCase value_case() const;
+  // @@protoc_insertion_point(class_scope:rp4.GatewayParam)
  private:
   class _Internal;
+  void set_has_field();
+  void set_has_data();
+
+  inline bool has_value() const;
+  inline void clear_has_value();
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
+    int paramtype_;
+    union ValueUnion {
+      constexpr ValueUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::rp4::FieldInfo* field_;
+      ::rp4::Data* data_;
+    } value_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SetNoTableReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetNoTableReq) */ {
+class RelationExp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.RelationExp) */ {
  public:
-  inline SetNoTableReq() : SetNoTableReq(nullptr) {}
-  ~SetNoTableReq() override;
-  explicit PROTOBUF_CONSTEXPR SetNoTableReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline RelationExp() : RelationExp(nullptr) {}
+  ~RelationExp() override;
+  explicit PROTOBUF_CONSTEXPR RelationExp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetNoTableReq(const SetNoTableReq& from);
-  SetNoTableReq(SetNoTableReq&& from) noexcept
-    : SetNoTableReq() {
+  RelationExp(const RelationExp& from);
+  RelationExp(RelationExp&& from) noexcept
+    : RelationExp() {
     *this = ::std::move(from);
   }
 
-  inline SetNoTableReq& operator=(const SetNoTableReq& from) {
+  inline RelationExp& operator=(const RelationExp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetNoTableReq& operator=(SetNoTableReq&& from) noexcept {
+  inline RelationExp& operator=(RelationExp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4708,20 +5124,20 @@ class SetNoTableReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetNoTableReq& default_instance() {
+  static const RelationExp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetNoTableReq* internal_default_instance() {
-    return reinterpret_cast<const SetNoTableReq*>(
-               &_SetNoTableReq_default_instance_);
+  static inline const RelationExp* internal_default_instance() {
+    return reinterpret_cast<const RelationExp*>(
+               &_RelationExp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     25;
 
-  friend void swap(SetNoTableReq& a, SetNoTableReq& b) {
+  friend void swap(RelationExp& a, RelationExp& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetNoTableReq* other) {
+  inline void Swap(RelationExp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4734,7 +5150,7 @@ class SetNoTableReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetNoTableReq* other) {
+  void UnsafeArenaSwap(RelationExp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4742,14 +5158,14 @@ class SetNoTableReq final :
 
   // implements Message ----------------------------------------------
 
-  SetNoTableReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetNoTableReq>(arena);
+  RelationExp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RelationExp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetNoTableReq& from);
+  void CopyFrom(const RelationExp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetNoTableReq& from) {
-    SetNoTableReq::MergeImpl(*this, from);
+  void MergeFrom( const RelationExp& from) {
+    RelationExp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -4767,15 +5183,15 @@ class SetNoTableReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetNoTableReq* other);
+  void InternalSwap(RelationExp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.SetNoTableReq";
+    return "rp4.RelationExp";
   }
   protected:
-  explicit SetNoTableReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit RelationExp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -4789,38 +5205,56 @@ class SetNoTableReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kProcIdFieldNumber = 1,
-    kMatcherIdFieldNumber = 2,
-    kNoTableFieldNumber = 3,
+    kParam1FieldNumber = 1,
+    kParam2FieldNumber = 2,
+    kRelationFieldNumber = 3,
   };
-  // int32 procId = 1;
-  void clear_procid();
-  int32_t procid() const;
-  void set_procid(int32_t value);
+  // .rp4.GatewayParam param1 = 1;
+  bool has_param1() const;
   private:
-  int32_t _internal_procid() const;
-  void _internal_set_procid(int32_t value);
+  bool _internal_has_param1() const;
   public:
-
-  // int32 matcherId = 2;
-  void clear_matcherid();
-  int32_t matcherid() const;
-  void set_matcherid(int32_t value);
+  void clear_param1();
+  const ::rp4::GatewayParam& param1() const;
+  PROTOBUF_NODISCARD ::rp4::GatewayParam* release_param1();
+  ::rp4::GatewayParam* mutable_param1();
+  void set_allocated_param1(::rp4::GatewayParam* param1);
   private:
-  int32_t _internal_matcherid() const;
-  void _internal_set_matcherid(int32_t value);
+  const ::rp4::GatewayParam& _internal_param1() const;
+  ::rp4::GatewayParam* _internal_mutable_param1();
   public:
+  void unsafe_arena_set_allocated_param1(
+      ::rp4::GatewayParam* param1);
+  ::rp4::GatewayParam* unsafe_arena_release_param1();
 
-  // bool noTable = 3;
-  void clear_notable();
-  bool notable() const;
-  void set_notable(bool value);
+  // .rp4.GatewayParam param2 = 2;
+  bool has_param2() const;
   private:
-  bool _internal_notable() const;
-  void _internal_set_notable(bool value);
+  bool _internal_has_param2() const;
+  public:
+  void clear_param2();
+  const ::rp4::GatewayParam& param2() const;
+  PROTOBUF_NODISCARD ::rp4::GatewayParam* release_param2();
+  ::rp4::GatewayParam* mutable_param2();
+  void set_allocated_param2(::rp4::GatewayParam* param2);
+  private:
+  const ::rp4::GatewayParam& _internal_param2() const;
+  ::rp4::GatewayParam* _internal_mutable_param2();
   public:
+  void unsafe_arena_set_allocated_param2(
+      ::rp4::GatewayParam* param2);
+  ::rp4::GatewayParam* unsafe_arena_release_param2();
 
-  // @@protoc_insertion_point(class_scope:rp4.SetNoTableReq)
+  // .rp4.RelationCode relation = 3;
+  void clear_relation();
+  ::rp4::RelationCode relation() const;
+  void set_relation(::rp4::RelationCode value);
+  private:
+  ::rp4::RelationCode _internal_relation() const;
+  void _internal_set_relation(::rp4::RelationCode value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.RelationExp)
  private:
   class _Internal;
 
@@ -4828,9 +5262,9 @@ class SetNoTableReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t procid_;
-    int32_t matcherid_;
-    bool notable_;
+    ::rp4::GatewayParam* param1_;
+    ::rp4::GatewayParam* param2_;
+    int relation_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -4838,24 +5272,24 @@ class SetNoTableReq final :
 };
 // -------------------------------------------------------------------
 
-class SetNoTableResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetNoTableResp) */ {
+class InsertRelationExpReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertRelationExpReq) */ {
  public:
-  inline SetNoTableResp() : SetNoTableResp(nullptr) {}
-  ~SetNoTableResp() override;
-  explicit PROTOBUF_CONSTEXPR SetNoTableResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline InsertRelationExpReq() : InsertRelationExpReq(nullptr) {}
+  ~InsertRelationExpReq() override;
+  explicit PROTOBUF_CONSTEXPR InsertRelationExpReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetNoTableResp(const SetNoTableResp& from);
-  SetNoTableResp(SetNoTableResp&& from) noexcept
-    : SetNoTableResp() {
+  InsertRelationExpReq(const InsertRelationExpReq& from);
+  InsertRelationExpReq(InsertRelationExpReq&& from) noexcept
+    : InsertRelationExpReq() {
     *this = ::std::move(from);
   }
 
-  inline SetNoTableResp& operator=(const SetNoTableResp& from) {
+  inline InsertRelationExpReq& operator=(const InsertRelationExpReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetNoTableResp& operator=(SetNoTableResp&& from) noexcept {
+  inline InsertRelationExpReq& operator=(InsertRelationExpReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4878,20 +5312,20 @@ class SetNoTableResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetNoTableResp& default_instance() {
+  static const InsertRelationExpReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetNoTableResp* internal_default_instance() {
-    return reinterpret_cast<const SetNoTableResp*>(
-               &_SetNoTableResp_default_instance_);
+  static inline const InsertRelationExpReq* internal_default_instance() {
+    return reinterpret_cast<const InsertRelationExpReq*>(
+               &_InsertRelationExpReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     26;
 
-  friend void swap(SetNoTableResp& a, SetNoTableResp& b) {
+  friend void swap(InsertRelationExpReq& a, InsertRelationExpReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetNoTableResp* other) {
+  inline void Swap(InsertRelationExpReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4904,7 +5338,7 @@ class SetNoTableResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetNoTableResp* other) {
+  void UnsafeArenaSwap(InsertRelationExpReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4912,14 +5346,14 @@ class SetNoTableResp final :
 
   // implements Message ----------------------------------------------
 
-  SetNoTableResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetNoTableResp>(arena);
+  InsertRelationExpReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InsertRelationExpReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetNoTableResp& from);
+  void CopyFrom(const InsertRelationExpReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetNoTableResp& from) {
-    SetNoTableResp::MergeImpl(*this, from);
+  void MergeFrom( const InsertRelationExpReq& from) {
+    InsertRelationExpReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -4937,15 +5371,15 @@ class SetNoTableResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetNoTableResp* other);
+  void InternalSwap(InsertRelationExpReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.SetNoTableResp";
+    return "rp4.InsertRelationExpReq";
   }
   protected:
-  explicit SetNoTableResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit InsertRelationExpReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -4959,18 +5393,66 @@ class SetNoTableResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kParam1FieldNumber = 2,
+    kParam2FieldNumber = 3,
+    kProcIdFieldNumber = 1,
+    kRelationFieldNumber = 4,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
+  // .rp4.GatewayParam param1 = 2;
+  bool has_param1() const;
   private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  bool _internal_has_param1() const;
+  public:
+  void clear_param1();
+  const ::rp4::GatewayParam& param1() const;
+  PROTOBUF_NODISCARD ::rp4::GatewayParam* release_param1();
+  ::rp4::GatewayParam* mutable_param1();
+  void set_allocated_param1(::rp4::GatewayParam* param1);
+  private:
+  const ::rp4::GatewayParam& _internal_param1() const;
+  ::rp4::GatewayParam* _internal_mutable_param1();
   public:
+  void unsafe_arena_set_allocated_param1(
+      ::rp4::GatewayParam* param1);
+  ::rp4::GatewayParam* unsafe_arena_release_param1();
 
-  // @@protoc_insertion_point(class_scope:rp4.SetNoTableResp)
+  // .rp4.GatewayParam param2 = 3;
+  bool has_param2() const;
+  private:
+  bool _internal_has_param2() const;
+  public:
+  void clear_param2();
+  const ::rp4::GatewayParam& param2() const;
+  PROTOBUF_NODISCARD ::rp4::GatewayParam* release_param2();
+  ::rp4::GatewayParam* mutable_param2();
+  void set_allocated_param2(::rp4::GatewayParam* param2);
+  private:
+  const ::rp4::GatewayParam& _internal_param2() const;
+  ::rp4::GatewayParam* _internal_mutable_param2();
+  public:
+  void unsafe_arena_set_allocated_param2(
+      ::rp4::GatewayParam* param2);
+  ::rp4::GatewayParam* unsafe_arena_release_param2();
+
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
+  private:
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
+  public:
+
+  // .rp4.RelationCode relation = 4;
+  void clear_relation();
+  ::rp4::RelationCode relation() const;
+  void set_relation(::rp4::RelationCode value);
+  private:
+  ::rp4::RelationCode _internal_relation() const;
+  void _internal_set_relation(::rp4::RelationCode value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.InsertRelationExpReq)
  private:
   class _Internal;
 
@@ -4978,7 +5460,10 @@ class SetNoTableResp final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
+    ::rp4::GatewayParam* param1_;
+    ::rp4::GatewayParam* param2_;
+    int32_t procid_;
+    int relation_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -4986,24 +5471,24 @@ class SetNoTableResp final :
 };
 // -------------------------------------------------------------------
 
-class ActionProc final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ActionProc) */ {
+class InsertRelationExpResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertRelationExpResp) */ {
  public:
-  inline ActionProc() : ActionProc(nullptr) {}
-  ~ActionProc() override;
-  explicit PROTOBUF_CONSTEXPR ActionProc(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline InsertRelationExpResp() : InsertRelationExpResp(nullptr) {}
+  ~InsertRelationExpResp() override;
+  explicit PROTOBUF_CONSTEXPR InsertRelationExpResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ActionProc(const ActionProc& from);
-  ActionProc(ActionProc&& from) noexcept
-    : ActionProc() {
+  InsertRelationExpResp(const InsertRelationExpResp& from);
+  InsertRelationExpResp(InsertRelationExpResp&& from) noexcept
+    : InsertRelationExpResp() {
     *this = ::std::move(from);
   }
 
-  inline ActionProc& operator=(const ActionProc& from) {
+  inline InsertRelationExpResp& operator=(const InsertRelationExpResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ActionProc& operator=(ActionProc&& from) noexcept {
+  inline InsertRelationExpResp& operator=(InsertRelationExpResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5026,20 +5511,20 @@ class ActionProc final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ActionProc& default_instance() {
+  static const InsertRelationExpResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ActionProc* internal_default_instance() {
-    return reinterpret_cast<const ActionProc*>(
-               &_ActionProc_default_instance_);
+  static inline const InsertRelationExpResp* internal_default_instance() {
+    return reinterpret_cast<const InsertRelationExpResp*>(
+               &_InsertRelationExpResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     27;
 
-  friend void swap(ActionProc& a, ActionProc& b) {
+  friend void swap(InsertRelationExpResp& a, InsertRelationExpResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(ActionProc* other) {
+  inline void Swap(InsertRelationExpResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5052,7 +5537,7 @@ class ActionProc final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ActionProc* other) {
+  void UnsafeArenaSwap(InsertRelationExpResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5060,14 +5545,14 @@ class ActionProc final :
 
   // implements Message ----------------------------------------------
 
-  ActionProc* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ActionProc>(arena);
+  InsertRelationExpResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InsertRelationExpResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ActionProc& from);
+  void CopyFrom(const InsertRelationExpResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ActionProc& from) {
-    ActionProc::MergeImpl(*this, from);
+  void MergeFrom( const InsertRelationExpResp& from) {
+    InsertRelationExpResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -5085,15 +5570,15 @@ class ActionProc final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ActionProc* other);
+  void InternalSwap(InsertRelationExpResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ActionProc";
+    return "rp4.InsertRelationExpResp";
   }
   protected:
-  explicit ActionProc(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit InsertRelationExpResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -5107,28 +5592,18 @@ class ActionProc final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kActionIdFieldNumber = 1,
-    kProcIdFieldNumber = 2,
+    kResFieldNumber = 1,
   };
-  // int32 actionId = 1;
-  void clear_actionid();
-  int32_t actionid() const;
-  void set_actionid(int32_t value);
-  private:
-  int32_t _internal_actionid() const;
-  void _internal_set_actionid(int32_t value);
-  public:
-
-  // int32 procId = 2;
-  void clear_procid();
-  int32_t procid() const;
-  void set_procid(int32_t value);
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  int32_t _internal_procid() const;
-  void _internal_set_procid(int32_t value);
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ActionProc)
+  // @@protoc_insertion_point(class_scope:rp4.InsertRelationExpResp)
  private:
   class _Internal;
 
@@ -5136,8 +5611,7 @@ class ActionProc final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t actionid_;
-    int32_t procid_;
+    int res_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -5145,24 +5619,24 @@ class ActionProc final :
 };
 // -------------------------------------------------------------------
 
-class SetActionProcReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetActionProcReq) */ {
+class ClearRelationExpReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearRelationExpReq) */ {
  public:
-  inline SetActionProcReq() : SetActionProcReq(nullptr) {}
-  ~SetActionProcReq() override;
-  explicit PROTOBUF_CONSTEXPR SetActionProcReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ClearRelationExpReq() : ClearRelationExpReq(nullptr) {}
+  ~ClearRelationExpReq() override;
+  explicit PROTOBUF_CONSTEXPR ClearRelationExpReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetActionProcReq(const SetActionProcReq& from);
-  SetActionProcReq(SetActionProcReq&& from) noexcept
-    : SetActionProcReq() {
+  ClearRelationExpReq(const ClearRelationExpReq& from);
+  ClearRelationExpReq(ClearRelationExpReq&& from) noexcept
+    : ClearRelationExpReq() {
     *this = ::std::move(from);
   }
 
-  inline SetActionProcReq& operator=(const SetActionProcReq& from) {
+  inline ClearRelationExpReq& operator=(const ClearRelationExpReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetActionProcReq& operator=(SetActionProcReq&& from) noexcept {
+  inline ClearRelationExpReq& operator=(ClearRelationExpReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5185,20 +5659,20 @@ class SetActionProcReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetActionProcReq& default_instance() {
+  static const ClearRelationExpReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetActionProcReq* internal_default_instance() {
-    return reinterpret_cast<const SetActionProcReq*>(
-               &_SetActionProcReq_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
+  static inline const ClearRelationExpReq* internal_default_instance() {
+    return reinterpret_cast<const ClearRelationExpReq*>(
+               &_ClearRelationExpReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
     28;
 
-  friend void swap(SetActionProcReq& a, SetActionProcReq& b) {
+  friend void swap(ClearRelationExpReq& a, ClearRelationExpReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetActionProcReq* other) {
+  inline void Swap(ClearRelationExpReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5211,7 +5685,7 @@ class SetActionProcReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetActionProcReq* other) {
+  void UnsafeArenaSwap(ClearRelationExpReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5219,14 +5693,14 @@ class SetActionProcReq final :
 
   // implements Message ----------------------------------------------
 
-  SetActionProcReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetActionProcReq>(arena);
+  ClearRelationExpReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearRelationExpReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetActionProcReq& from);
+  void CopyFrom(const ClearRelationExpReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetActionProcReq& from) {
-    SetActionProcReq::MergeImpl(*this, from);
+  void MergeFrom( const ClearRelationExpReq& from) {
+    ClearRelationExpReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -5244,15 +5718,15 @@ class SetActionProcReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetActionProcReq* other);
+  void InternalSwap(ClearRelationExpReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.SetActionProcReq";
+    return "rp4.ClearRelationExpReq";
   }
   protected:
-  explicit SetActionProcReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ClearRelationExpReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -5266,28 +5740,8 @@ class SetActionProcReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kActionProcsFieldNumber = 3,
     kProcIdFieldNumber = 1,
-    kMatcherIdFieldNumber = 2,
   };
-  // repeated .rp4.ActionProc actionProcs = 3;
-  int actionprocs_size() const;
-  private:
-  int _internal_actionprocs_size() const;
-  public:
-  void clear_actionprocs();
-  ::rp4::ActionProc* mutable_actionprocs(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ActionProc >*
-      mutable_actionprocs();
-  private:
-  const ::rp4::ActionProc& _internal_actionprocs(int index) const;
-  ::rp4::ActionProc* _internal_add_actionprocs();
-  public:
-  const ::rp4::ActionProc& actionprocs(int index) const;
-  ::rp4::ActionProc* add_actionprocs();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ActionProc >&
-      actionprocs() const;
-
   // int32 procId = 1;
   void clear_procid();
   int32_t procid() const;
@@ -5297,16 +5751,7 @@ class SetActionProcReq final :
   void _internal_set_procid(int32_t value);
   public:
 
-  // int32 matcherId = 2;
-  void clear_matcherid();
-  int32_t matcherid() const;
-  void set_matcherid(int32_t value);
-  private:
-  int32_t _internal_matcherid() const;
-  void _internal_set_matcherid(int32_t value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:rp4.SetActionProcReq)
+  // @@protoc_insertion_point(class_scope:rp4.ClearRelationExpReq)
  private:
   class _Internal;
 
@@ -5314,9 +5759,7 @@ class SetActionProcReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ActionProc > actionprocs_;
     int32_t procid_;
-    int32_t matcherid_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -5324,24 +5767,24 @@ class SetActionProcReq final :
 };
 // -------------------------------------------------------------------
 
-class SetActionProcResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetActionProcResp) */ {
+class ClearRelationExpResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearRelationExpResp) */ {
  public:
-  inline SetActionProcResp() : SetActionProcResp(nullptr) {}
-  ~SetActionProcResp() override;
-  explicit PROTOBUF_CONSTEXPR SetActionProcResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ClearRelationExpResp() : ClearRelationExpResp(nullptr) {}
+  ~ClearRelationExpResp() override;
+  explicit PROTOBUF_CONSTEXPR ClearRelationExpResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetActionProcResp(const SetActionProcResp& from);
-  SetActionProcResp(SetActionProcResp&& from) noexcept
-    : SetActionProcResp() {
+  ClearRelationExpResp(const ClearRelationExpResp& from);
+  ClearRelationExpResp(ClearRelationExpResp&& from) noexcept
+    : ClearRelationExpResp() {
     *this = ::std::move(from);
   }
 
-  inline SetActionProcResp& operator=(const SetActionProcResp& from) {
+  inline ClearRelationExpResp& operator=(const ClearRelationExpResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetActionProcResp& operator=(SetActionProcResp&& from) noexcept {
+  inline ClearRelationExpResp& operator=(ClearRelationExpResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5364,20 +5807,20 @@ class SetActionProcResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetActionProcResp& default_instance() {
+  static const ClearRelationExpResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetActionProcResp* internal_default_instance() {
-    return reinterpret_cast<const SetActionProcResp*>(
-               &_SetActionProcResp_default_instance_);
+  static inline const ClearRelationExpResp* internal_default_instance() {
+    return reinterpret_cast<const ClearRelationExpResp*>(
+               &_ClearRelationExpResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     29;
 
-  friend void swap(SetActionProcResp& a, SetActionProcResp& b) {
+  friend void swap(ClearRelationExpResp& a, ClearRelationExpResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetActionProcResp* other) {
+  inline void Swap(ClearRelationExpResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5390,7 +5833,7 @@ class SetActionProcResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetActionProcResp* other) {
+  void UnsafeArenaSwap(ClearRelationExpResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5398,14 +5841,14 @@ class SetActionProcResp final :
 
   // implements Message ----------------------------------------------
 
-  SetActionProcResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetActionProcResp>(arena);
+  ClearRelationExpResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearRelationExpResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetActionProcResp& from);
+  void CopyFrom(const ClearRelationExpResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetActionProcResp& from) {
-    SetActionProcResp::MergeImpl(*this, from);
+  void MergeFrom( const ClearRelationExpResp& from) {
+    ClearRelationExpResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -5423,15 +5866,15 @@ class SetActionProcResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetActionProcResp* other);
+  void InternalSwap(ClearRelationExpResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.SetActionProcResp";
+    return "rp4.ClearRelationExpResp";
   }
   protected:
-  explicit SetActionProcResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ClearRelationExpResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -5456,7 +5899,7 @@ class SetActionProcResp final :
   void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.SetActionProcResp)
+  // @@protoc_insertion_point(class_scope:rp4.ClearRelationExpResp)
  private:
   class _Internal;
 
@@ -5472,24 +5915,24 @@ class SetActionProcResp final :
 };
 // -------------------------------------------------------------------
 
-class SetMemConfigReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetMemConfigReq) */ {
+class ClearResMapReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearResMapReq) */ {
  public:
-  inline SetMemConfigReq() : SetMemConfigReq(nullptr) {}
-  ~SetMemConfigReq() override;
-  explicit PROTOBUF_CONSTEXPR SetMemConfigReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ClearResMapReq() : ClearResMapReq(nullptr) {}
+  ~ClearResMapReq() override;
+  explicit PROTOBUF_CONSTEXPR ClearResMapReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetMemConfigReq(const SetMemConfigReq& from);
-  SetMemConfigReq(SetMemConfigReq&& from) noexcept
-    : SetMemConfigReq() {
+  ClearResMapReq(const ClearResMapReq& from);
+  ClearResMapReq(ClearResMapReq&& from) noexcept
+    : ClearResMapReq() {
     *this = ::std::move(from);
   }
 
-  inline SetMemConfigReq& operator=(const SetMemConfigReq& from) {
+  inline ClearResMapReq& operator=(const ClearResMapReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetMemConfigReq& operator=(SetMemConfigReq&& from) noexcept {
+  inline ClearResMapReq& operator=(ClearResMapReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5512,20 +5955,20 @@ class SetMemConfigReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetMemConfigReq& default_instance() {
+  static const ClearResMapReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetMemConfigReq* internal_default_instance() {
-    return reinterpret_cast<const SetMemConfigReq*>(
-               &_SetMemConfigReq_default_instance_);
+  static inline const ClearResMapReq* internal_default_instance() {
+    return reinterpret_cast<const ClearResMapReq*>(
+               &_ClearResMapReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     30;
 
-  friend void swap(SetMemConfigReq& a, SetMemConfigReq& b) {
+  friend void swap(ClearResMapReq& a, ClearResMapReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetMemConfigReq* other) {
+  inline void Swap(ClearResMapReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5538,7 +5981,7 @@ class SetMemConfigReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetMemConfigReq* other) {
+  void UnsafeArenaSwap(ClearResMapReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5546,14 +5989,14 @@ class SetMemConfigReq final :
 
   // implements Message ----------------------------------------------
 
-  SetMemConfigReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetMemConfigReq>(arena);
+  ClearResMapReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearResMapReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetMemConfigReq& from);
+  void CopyFrom(const ClearResMapReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetMemConfigReq& from) {
-    SetMemConfigReq::MergeImpl(*this, from);
+  void MergeFrom( const ClearResMapReq& from) {
+    ClearResMapReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -5571,15 +6014,15 @@ class SetMemConfigReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetMemConfigReq* other);
+  void InternalSwap(ClearResMapReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.SetMemConfigReq";
+    return "rp4.ClearResMapReq";
   }
   protected:
-  explicit SetMemConfigReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ClearResMapReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -5593,44 +6036,8 @@ class SetMemConfigReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kKeyConfigFieldNumber = 5,
-    kValueConfigFieldNumber = 6,
     kProcIdFieldNumber = 1,
-    kMatcherIdFieldNumber = 2,
-    kKeyWidthFieldNumber = 3,
-    kValueWidthFieldNumber = 4,
-    kMatchTypeFieldNumber = 7,
-    kDepthFieldNumber = 8,
-    kMissActIdFieldNumber = 9,
   };
-  // bytes keyConfig = 5;
-  void clear_keyconfig();
-  const std::string& keyconfig() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_keyconfig(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_keyconfig();
-  PROTOBUF_NODISCARD std::string* release_keyconfig();
-  void set_allocated_keyconfig(std::string* keyconfig);
-  private:
-  const std::string& _internal_keyconfig() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_keyconfig(const std::string& value);
-  std::string* _internal_mutable_keyconfig();
-  public:
-
-  // bytes valueConfig = 6;
-  void clear_valueconfig();
-  const std::string& valueconfig() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_valueconfig(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_valueconfig();
-  PROTOBUF_NODISCARD std::string* release_valueconfig();
-  void set_allocated_valueconfig(std::string* valueconfig);
-  private:
-  const std::string& _internal_valueconfig() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_valueconfig(const std::string& value);
-  std::string* _internal_mutable_valueconfig();
-  public:
-
   // int32 procId = 1;
   void clear_procid();
   int32_t procid() const;
@@ -5640,61 +6047,7 @@ class SetMemConfigReq final :
   void _internal_set_procid(int32_t value);
   public:
 
-  // int32 matcherId = 2;
-  void clear_matcherid();
-  int32_t matcherid() const;
-  void set_matcherid(int32_t value);
-  private:
-  int32_t _internal_matcherid() const;
-  void _internal_set_matcherid(int32_t value);
-  public:
-
-  // int32 keyWidth = 3;
-  void clear_keywidth();
-  int32_t keywidth() const;
-  void set_keywidth(int32_t value);
-  private:
-  int32_t _internal_keywidth() const;
-  void _internal_set_keywidth(int32_t value);
-  public:
-
-  // int32 valueWidth = 4;
-  void clear_valuewidth();
-  int32_t valuewidth() const;
-  void set_valuewidth(int32_t value);
-  private:
-  int32_t _internal_valuewidth() const;
-  void _internal_set_valuewidth(int32_t value);
-  public:
-
-  // .rp4.MatchType matchType = 7;
-  void clear_matchtype();
-  ::rp4::MatchType matchtype() const;
-  void set_matchtype(::rp4::MatchType value);
-  private:
-  ::rp4::MatchType _internal_matchtype() const;
-  void _internal_set_matchtype(::rp4::MatchType value);
-  public:
-
-  // int32 depth = 8;
-  void clear_depth();
-  int32_t depth() const;
-  void set_depth(int32_t value);
-  private:
-  int32_t _internal_depth() const;
-  void _internal_set_depth(int32_t value);
-  public:
-
-  // int32 missActId = 9;
-  void clear_missactid();
-  int32_t missactid() const;
-  void set_missactid(int32_t value);
-  private:
-  int32_t _internal_missactid() const;
-  void _internal_set_missactid(int32_t value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:rp4.SetMemConfigReq)
+  // @@protoc_insertion_point(class_scope:rp4.ClearResMapReq)
  private:
   class _Internal;
 
@@ -5702,15 +6055,7 @@ class SetMemConfigReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr keyconfig_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr valueconfig_;
     int32_t procid_;
-    int32_t matcherid_;
-    int32_t keywidth_;
-    int32_t valuewidth_;
-    int matchtype_;
-    int32_t depth_;
-    int32_t missactid_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -5718,24 +6063,24 @@ class SetMemConfigReq final :
 };
 // -------------------------------------------------------------------
 
-class SetMemConfigResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetMemConfigResp) */ {
+class ClearResMapResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearResMapResp) */ {
  public:
-  inline SetMemConfigResp() : SetMemConfigResp(nullptr) {}
-  ~SetMemConfigResp() override;
-  explicit PROTOBUF_CONSTEXPR SetMemConfigResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ClearResMapResp() : ClearResMapResp(nullptr) {}
+  ~ClearResMapResp() override;
+  explicit PROTOBUF_CONSTEXPR ClearResMapResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetMemConfigResp(const SetMemConfigResp& from);
-  SetMemConfigResp(SetMemConfigResp&& from) noexcept
-    : SetMemConfigResp() {
+  ClearResMapResp(const ClearResMapResp& from);
+  ClearResMapResp(ClearResMapResp&& from) noexcept
+    : ClearResMapResp() {
     *this = ::std::move(from);
   }
 
-  inline SetMemConfigResp& operator=(const SetMemConfigResp& from) {
+  inline ClearResMapResp& operator=(const ClearResMapResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetMemConfigResp& operator=(SetMemConfigResp&& from) noexcept {
+  inline ClearResMapResp& operator=(ClearResMapResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5758,20 +6103,20 @@ class SetMemConfigResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetMemConfigResp& default_instance() {
+  static const ClearResMapResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetMemConfigResp* internal_default_instance() {
-    return reinterpret_cast<const SetMemConfigResp*>(
-               &_SetMemConfigResp_default_instance_);
+  static inline const ClearResMapResp* internal_default_instance() {
+    return reinterpret_cast<const ClearResMapResp*>(
+               &_ClearResMapResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     31;
 
-  friend void swap(SetMemConfigResp& a, SetMemConfigResp& b) {
+  friend void swap(ClearResMapResp& a, ClearResMapResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetMemConfigResp* other) {
+  inline void Swap(ClearResMapResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5784,7 +6129,7 @@ class SetMemConfigResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetMemConfigResp* other) {
+  void UnsafeArenaSwap(ClearResMapResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5792,14 +6137,14 @@ class SetMemConfigResp final :
 
   // implements Message ----------------------------------------------
 
-  SetMemConfigResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetMemConfigResp>(arena);
+  ClearResMapResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearResMapResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetMemConfigResp& from);
+  void CopyFrom(const ClearResMapResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetMemConfigResp& from) {
-    SetMemConfigResp::MergeImpl(*this, from);
+  void MergeFrom( const ClearResMapResp& from) {
+    ClearResMapResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -5817,15 +6162,15 @@ class SetMemConfigResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetMemConfigResp* other);
+  void InternalSwap(ClearResMapResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.SetMemConfigResp";
+    return "rp4.ClearResMapResp";
   }
   protected:
-  explicit SetMemConfigResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ClearResMapResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -5850,7 +6195,7 @@ class SetMemConfigResp final :
   void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.SetMemConfigResp)
+  // @@protoc_insertion_point(class_scope:rp4.ClearResMapResp)
  private:
   class _Internal;
 
@@ -5866,24 +6211,24 @@ class SetMemConfigResp final :
 };
 // -------------------------------------------------------------------
 
-class SetFieldInfoReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetFieldInfoReq) */ {
+class ModResMapReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ModResMapReq) */ {
  public:
-  inline SetFieldInfoReq() : SetFieldInfoReq(nullptr) {}
-  ~SetFieldInfoReq() override;
-  explicit PROTOBUF_CONSTEXPR SetFieldInfoReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ModResMapReq() : ModResMapReq(nullptr) {}
+  ~ModResMapReq() override;
+  explicit PROTOBUF_CONSTEXPR ModResMapReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetFieldInfoReq(const SetFieldInfoReq& from);
-  SetFieldInfoReq(SetFieldInfoReq&& from) noexcept
-    : SetFieldInfoReq() {
+  ModResMapReq(const ModResMapReq& from);
+  ModResMapReq(ModResMapReq&& from) noexcept
+    : ModResMapReq() {
     *this = ::std::move(from);
   }
 
-  inline SetFieldInfoReq& operator=(const SetFieldInfoReq& from) {
+  inline ModResMapReq& operator=(const ModResMapReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetFieldInfoReq& operator=(SetFieldInfoReq&& from) noexcept {
+  inline ModResMapReq& operator=(ModResMapReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5906,20 +6251,20 @@ class SetFieldInfoReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetFieldInfoReq& default_instance() {
+  static const ModResMapReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetFieldInfoReq* internal_default_instance() {
-    return reinterpret_cast<const SetFieldInfoReq*>(
-               &_SetFieldInfoReq_default_instance_);
+  static inline const ModResMapReq* internal_default_instance() {
+    return reinterpret_cast<const ModResMapReq*>(
+               &_ModResMapReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     32;
 
-  friend void swap(SetFieldInfoReq& a, SetFieldInfoReq& b) {
+  friend void swap(ModResMapReq& a, ModResMapReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetFieldInfoReq* other) {
+  inline void Swap(ModResMapReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5932,7 +6277,7 @@ class SetFieldInfoReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetFieldInfoReq* other) {
+  void UnsafeArenaSwap(ModResMapReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5940,14 +6285,14 @@ class SetFieldInfoReq final :
 
   // implements Message ----------------------------------------------
 
-  SetFieldInfoReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetFieldInfoReq>(arena);
+  ModResMapReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ModResMapReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetFieldInfoReq& from);
+  void CopyFrom(const ModResMapReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetFieldInfoReq& from) {
-    SetFieldInfoReq::MergeImpl(*this, from);
+  void MergeFrom( const ModResMapReq& from) {
+    ModResMapReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -5965,15 +6310,15 @@ class SetFieldInfoReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetFieldInfoReq* other);
+  void InternalSwap(ModResMapReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.SetFieldInfoReq";
+    return "rp4.ModResMapReq";
   }
   protected:
-  explicit SetFieldInfoReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ModResMapReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -5987,27 +6332,27 @@ class SetFieldInfoReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kFdInfosFieldNumber = 3,
+    kEntryFieldNumber = 3,
     kProcIdFieldNumber = 1,
-    kMatcherIdFieldNumber = 2,
+    kKeyFieldNumber = 2,
   };
-  // repeated .rp4.FieldInfo fdInfos = 3;
-  int fdinfos_size() const;
+  // .rp4.GateEntry entry = 3;
+  bool has_entry() const;
   private:
-  int _internal_fdinfos_size() const;
+  bool _internal_has_entry() const;
   public:
-  void clear_fdinfos();
-  ::rp4::FieldInfo* mutable_fdinfos(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >*
-      mutable_fdinfos();
+  void clear_entry();
+  const ::rp4::GateEntry& entry() const;
+  PROTOBUF_NODISCARD ::rp4::GateEntry* release_entry();
+  ::rp4::GateEntry* mutable_entry();
+  void set_allocated_entry(::rp4::GateEntry* entry);
   private:
-  const ::rp4::FieldInfo& _internal_fdinfos(int index) const;
-  ::rp4::FieldInfo* _internal_add_fdinfos();
+  const ::rp4::GateEntry& _internal_entry() const;
+  ::rp4::GateEntry* _internal_mutable_entry();
   public:
-  const ::rp4::FieldInfo& fdinfos(int index) const;
-  ::rp4::FieldInfo* add_fdinfos();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >&
-      fdinfos() const;
+  void unsafe_arena_set_allocated_entry(
+      ::rp4::GateEntry* entry);
+  ::rp4::GateEntry* unsafe_arena_release_entry();
 
   // int32 procId = 1;
   void clear_procid();
@@ -6018,16 +6363,16 @@ class SetFieldInfoReq final :
   void _internal_set_procid(int32_t value);
   public:
 
-  // int32 matcherId = 2;
-  void clear_matcherid();
-  int32_t matcherid() const;
-  void set_matcherid(int32_t value);
+  // int32 key = 2;
+  void clear_key();
+  int32_t key() const;
+  void set_key(int32_t value);
   private:
-  int32_t _internal_matcherid() const;
-  void _internal_set_matcherid(int32_t value);
+  int32_t _internal_key() const;
+  void _internal_set_key(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.SetFieldInfoReq)
+  // @@protoc_insertion_point(class_scope:rp4.ModResMapReq)
  private:
   class _Internal;
 
@@ -6035,9 +6380,9 @@ class SetFieldInfoReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo > fdinfos_;
+    ::rp4::GateEntry* entry_;
     int32_t procid_;
-    int32_t matcherid_;
+    int32_t key_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -6045,24 +6390,24 @@ class SetFieldInfoReq final :
 };
 // -------------------------------------------------------------------
 
-class SetFieldInfoResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetFieldInfoResp) */ {
+class ModResMapResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ModResMapResp) */ {
  public:
-  inline SetFieldInfoResp() : SetFieldInfoResp(nullptr) {}
-  ~SetFieldInfoResp() override;
-  explicit PROTOBUF_CONSTEXPR SetFieldInfoResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ModResMapResp() : ModResMapResp(nullptr) {}
+  ~ModResMapResp() override;
+  explicit PROTOBUF_CONSTEXPR ModResMapResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetFieldInfoResp(const SetFieldInfoResp& from);
-  SetFieldInfoResp(SetFieldInfoResp&& from) noexcept
-    : SetFieldInfoResp() {
+  ModResMapResp(const ModResMapResp& from);
+  ModResMapResp(ModResMapResp&& from) noexcept
+    : ModResMapResp() {
     *this = ::std::move(from);
   }
 
-  inline SetFieldInfoResp& operator=(const SetFieldInfoResp& from) {
+  inline ModResMapResp& operator=(const ModResMapResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetFieldInfoResp& operator=(SetFieldInfoResp&& from) noexcept {
+  inline ModResMapResp& operator=(ModResMapResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6085,20 +6430,20 @@ class SetFieldInfoResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetFieldInfoResp& default_instance() {
+  static const ModResMapResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetFieldInfoResp* internal_default_instance() {
-    return reinterpret_cast<const SetFieldInfoResp*>(
-               &_SetFieldInfoResp_default_instance_);
+  static inline const ModResMapResp* internal_default_instance() {
+    return reinterpret_cast<const ModResMapResp*>(
+               &_ModResMapResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     33;
 
-  friend void swap(SetFieldInfoResp& a, SetFieldInfoResp& b) {
+  friend void swap(ModResMapResp& a, ModResMapResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetFieldInfoResp* other) {
+  inline void Swap(ModResMapResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6111,7 +6456,7 @@ class SetFieldInfoResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetFieldInfoResp* other) {
+  void UnsafeArenaSwap(ModResMapResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6119,14 +6464,14 @@ class SetFieldInfoResp final :
 
   // implements Message ----------------------------------------------
 
-  SetFieldInfoResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetFieldInfoResp>(arena);
+  ModResMapResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ModResMapResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetFieldInfoResp& from);
+  void CopyFrom(const ModResMapResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetFieldInfoResp& from) {
-    SetFieldInfoResp::MergeImpl(*this, from);
+  void MergeFrom( const ModResMapResp& from) {
+    ModResMapResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -6144,15 +6489,15 @@ class SetFieldInfoResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetFieldInfoResp* other);
+  void InternalSwap(ModResMapResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.SetFieldInfoResp";
+    return "rp4.ModResMapResp";
   }
   protected:
-  explicit SetFieldInfoResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ModResMapResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -6177,7 +6522,7 @@ class SetFieldInfoResp final :
   void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.SetFieldInfoResp)
+  // @@protoc_insertion_point(class_scope:rp4.ModResMapResp)
  private:
   class _Internal;
 
@@ -6193,24 +6538,24 @@ class SetFieldInfoResp final :
 };
 // -------------------------------------------------------------------
 
-class InsertSramEntryReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertSramEntryReq) */ {
+class SetNoTableReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetNoTableReq) */ {
  public:
-  inline InsertSramEntryReq() : InsertSramEntryReq(nullptr) {}
-  ~InsertSramEntryReq() override;
-  explicit PROTOBUF_CONSTEXPR InsertSramEntryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetNoTableReq() : SetNoTableReq(nullptr) {}
+  ~SetNoTableReq() override;
+  explicit PROTOBUF_CONSTEXPR SetNoTableReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  InsertSramEntryReq(const InsertSramEntryReq& from);
-  InsertSramEntryReq(InsertSramEntryReq&& from) noexcept
-    : InsertSramEntryReq() {
+  SetNoTableReq(const SetNoTableReq& from);
+  SetNoTableReq(SetNoTableReq&& from) noexcept
+    : SetNoTableReq() {
     *this = ::std::move(from);
   }
 
-  inline InsertSramEntryReq& operator=(const InsertSramEntryReq& from) {
+  inline SetNoTableReq& operator=(const SetNoTableReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline InsertSramEntryReq& operator=(InsertSramEntryReq&& from) noexcept {
+  inline SetNoTableReq& operator=(SetNoTableReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6233,20 +6578,20 @@ class InsertSramEntryReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const InsertSramEntryReq& default_instance() {
+  static const SetNoTableReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const InsertSramEntryReq* internal_default_instance() {
-    return reinterpret_cast<const InsertSramEntryReq*>(
-               &_InsertSramEntryReq_default_instance_);
+  static inline const SetNoTableReq* internal_default_instance() {
+    return reinterpret_cast<const SetNoTableReq*>(
+               &_SetNoTableReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     34;
 
-  friend void swap(InsertSramEntryReq& a, InsertSramEntryReq& b) {
+  friend void swap(SetNoTableReq& a, SetNoTableReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(InsertSramEntryReq* other) {
+  inline void Swap(SetNoTableReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6259,7 +6604,7 @@ class InsertSramEntryReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(InsertSramEntryReq* other) {
+  void UnsafeArenaSwap(SetNoTableReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6267,14 +6612,14 @@ class InsertSramEntryReq final :
 
   // implements Message ----------------------------------------------
 
-  InsertSramEntryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<InsertSramEntryReq>(arena);
+  SetNoTableReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetNoTableReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const InsertSramEntryReq& from);
+  void CopyFrom(const SetNoTableReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const InsertSramEntryReq& from) {
-    InsertSramEntryReq::MergeImpl(*this, from);
+  void MergeFrom( const SetNoTableReq& from) {
+    SetNoTableReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -6292,15 +6637,15 @@ class InsertSramEntryReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(InsertSramEntryReq* other);
+  void InternalSwap(SetNoTableReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.InsertSramEntryReq";
+    return "rp4.SetNoTableReq";
   }
   protected:
-  explicit InsertSramEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetNoTableReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -6314,41 +6659,10 @@ class InsertSramEntryReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kKeyFieldNumber = 3,
-    kValueFieldNumber = 4,
     kProcIdFieldNumber = 1,
     kMatcherIdFieldNumber = 2,
-    kKeyByteLenFieldNumber = 5,
-    kValueByteLenFieldNumber = 6,
+    kNoTableFieldNumber = 3,
   };
-  // bytes key = 3;
-  void clear_key();
-  const std::string& key() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_key(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_key();
-  PROTOBUF_NODISCARD std::string* release_key();
-  void set_allocated_key(std::string* key);
-  private:
-  const std::string& _internal_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
-  std::string* _internal_mutable_key();
-  public:
-
-  // bytes value = 4;
-  void clear_value();
-  const std::string& value() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_value(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_value();
-  PROTOBUF_NODISCARD std::string* release_value();
-  void set_allocated_value(std::string* value);
-  private:
-  const std::string& _internal_value() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
-  std::string* _internal_mutable_value();
-  public:
-
   // int32 procId = 1;
   void clear_procid();
   int32_t procid() const;
@@ -6367,25 +6681,16 @@ class InsertSramEntryReq final :
   void _internal_set_matcherid(int32_t value);
   public:
 
-  // int32 key_byte_len = 5;
-  void clear_key_byte_len();
-  int32_t key_byte_len() const;
-  void set_key_byte_len(int32_t value);
-  private:
-  int32_t _internal_key_byte_len() const;
-  void _internal_set_key_byte_len(int32_t value);
-  public:
-
-  // int32 value_byte_len = 6;
-  void clear_value_byte_len();
-  int32_t value_byte_len() const;
-  void set_value_byte_len(int32_t value);
+  // bool noTable = 3;
+  void clear_notable();
+  bool notable() const;
+  void set_notable(bool value);
   private:
-  int32_t _internal_value_byte_len() const;
-  void _internal_set_value_byte_len(int32_t value);
+  bool _internal_notable() const;
+  void _internal_set_notable(bool value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.InsertSramEntryReq)
+  // @@protoc_insertion_point(class_scope:rp4.SetNoTableReq)
  private:
   class _Internal;
 
@@ -6393,12 +6698,9 @@ class InsertSramEntryReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
     int32_t procid_;
     int32_t matcherid_;
-    int32_t key_byte_len_;
-    int32_t value_byte_len_;
+    bool notable_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -6406,24 +6708,24 @@ class InsertSramEntryReq final :
 };
 // -------------------------------------------------------------------
 
-class InsertSramEntryResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertSramEntryResp) */ {
+class SetNoTableResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetNoTableResp) */ {
  public:
-  inline InsertSramEntryResp() : InsertSramEntryResp(nullptr) {}
-  ~InsertSramEntryResp() override;
-  explicit PROTOBUF_CONSTEXPR InsertSramEntryResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetNoTableResp() : SetNoTableResp(nullptr) {}
+  ~SetNoTableResp() override;
+  explicit PROTOBUF_CONSTEXPR SetNoTableResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  InsertSramEntryResp(const InsertSramEntryResp& from);
-  InsertSramEntryResp(InsertSramEntryResp&& from) noexcept
-    : InsertSramEntryResp() {
+  SetNoTableResp(const SetNoTableResp& from);
+  SetNoTableResp(SetNoTableResp&& from) noexcept
+    : SetNoTableResp() {
     *this = ::std::move(from);
   }
 
-  inline InsertSramEntryResp& operator=(const InsertSramEntryResp& from) {
+  inline SetNoTableResp& operator=(const SetNoTableResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline InsertSramEntryResp& operator=(InsertSramEntryResp&& from) noexcept {
+  inline SetNoTableResp& operator=(SetNoTableResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6446,20 +6748,20 @@ class InsertSramEntryResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const InsertSramEntryResp& default_instance() {
+  static const SetNoTableResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const InsertSramEntryResp* internal_default_instance() {
-    return reinterpret_cast<const InsertSramEntryResp*>(
-               &_InsertSramEntryResp_default_instance_);
+  static inline const SetNoTableResp* internal_default_instance() {
+    return reinterpret_cast<const SetNoTableResp*>(
+               &_SetNoTableResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     35;
 
-  friend void swap(InsertSramEntryResp& a, InsertSramEntryResp& b) {
+  friend void swap(SetNoTableResp& a, SetNoTableResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(InsertSramEntryResp* other) {
+  inline void Swap(SetNoTableResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6472,7 +6774,7 @@ class InsertSramEntryResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(InsertSramEntryResp* other) {
+  void UnsafeArenaSwap(SetNoTableResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6480,14 +6782,14 @@ class InsertSramEntryResp final :
 
   // implements Message ----------------------------------------------
 
-  InsertSramEntryResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<InsertSramEntryResp>(arena);
+  SetNoTableResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetNoTableResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const InsertSramEntryResp& from);
+  void CopyFrom(const SetNoTableResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const InsertSramEntryResp& from) {
-    InsertSramEntryResp::MergeImpl(*this, from);
+  void MergeFrom( const SetNoTableResp& from) {
+    SetNoTableResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -6505,15 +6807,15 @@ class InsertSramEntryResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(InsertSramEntryResp* other);
+  void InternalSwap(SetNoTableResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.InsertSramEntryResp";
+    return "rp4.SetNoTableResp";
   }
   protected:
-  explicit InsertSramEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetNoTableResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -6538,7 +6840,7 @@ class InsertSramEntryResp final :
   void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.InsertSramEntryResp)
+  // @@protoc_insertion_point(class_scope:rp4.SetNoTableResp)
  private:
   class _Internal;
 
@@ -6554,24 +6856,24 @@ class InsertSramEntryResp final :
 };
 // -------------------------------------------------------------------
 
-class InsertTcamEntryReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertTcamEntryReq) */ {
+class ActionProc final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ActionProc) */ {
  public:
-  inline InsertTcamEntryReq() : InsertTcamEntryReq(nullptr) {}
-  ~InsertTcamEntryReq() override;
-  explicit PROTOBUF_CONSTEXPR InsertTcamEntryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ActionProc() : ActionProc(nullptr) {}
+  ~ActionProc() override;
+  explicit PROTOBUF_CONSTEXPR ActionProc(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  InsertTcamEntryReq(const InsertTcamEntryReq& from);
-  InsertTcamEntryReq(InsertTcamEntryReq&& from) noexcept
-    : InsertTcamEntryReq() {
+  ActionProc(const ActionProc& from);
+  ActionProc(ActionProc&& from) noexcept
+    : ActionProc() {
     *this = ::std::move(from);
   }
 
-  inline InsertTcamEntryReq& operator=(const InsertTcamEntryReq& from) {
+  inline ActionProc& operator=(const ActionProc& from) {
     CopyFrom(from);
     return *this;
   }
-  inline InsertTcamEntryReq& operator=(InsertTcamEntryReq&& from) noexcept {
+  inline ActionProc& operator=(ActionProc&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6594,20 +6896,20 @@ class InsertTcamEntryReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const InsertTcamEntryReq& default_instance() {
+  static const ActionProc& default_instance() {
     return *internal_default_instance();
   }
-  static inline const InsertTcamEntryReq* internal_default_instance() {
-    return reinterpret_cast<const InsertTcamEntryReq*>(
-               &_InsertTcamEntryReq_default_instance_);
+  static inline const ActionProc* internal_default_instance() {
+    return reinterpret_cast<const ActionProc*>(
+               &_ActionProc_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     36;
 
-  friend void swap(InsertTcamEntryReq& a, InsertTcamEntryReq& b) {
+  friend void swap(ActionProc& a, ActionProc& b) {
     a.Swap(&b);
   }
-  inline void Swap(InsertTcamEntryReq* other) {
+  inline void Swap(ActionProc* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6620,7 +6922,7 @@ class InsertTcamEntryReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(InsertTcamEntryReq* other) {
+  void UnsafeArenaSwap(ActionProc* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6628,14 +6930,14 @@ class InsertTcamEntryReq final :
 
   // implements Message ----------------------------------------------
 
-  InsertTcamEntryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<InsertTcamEntryReq>(arena);
+  ActionProc* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ActionProc>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const InsertTcamEntryReq& from);
+  void CopyFrom(const ActionProc& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const InsertTcamEntryReq& from) {
-    InsertTcamEntryReq::MergeImpl(*this, from);
+  void MergeFrom( const ActionProc& from) {
+    ActionProc::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -6653,15 +6955,15 @@ class InsertTcamEntryReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(InsertTcamEntryReq* other);
+  void InternalSwap(ActionProc* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.InsertTcamEntryReq";
+    return "rp4.ActionProc";
   }
   protected:
-  explicit InsertTcamEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ActionProc(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -6675,57 +6977,19 @@ class InsertTcamEntryReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kKeyFieldNumber = 3,
-    kMaskFieldNumber = 4,
-    kValueFieldNumber = 5,
-    kProcIdFieldNumber = 1,
-    kMatcherIdFieldNumber = 2,
-    kKeyByteLenFieldNumber = 6,
-    kValueByteLenFieldNumber = 7,
+    kActionIdFieldNumber = 1,
+    kProcIdFieldNumber = 2,
   };
-  // bytes key = 3;
-  void clear_key();
-  const std::string& key() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_key(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_key();
-  PROTOBUF_NODISCARD std::string* release_key();
-  void set_allocated_key(std::string* key);
-  private:
-  const std::string& _internal_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
-  std::string* _internal_mutable_key();
-  public:
-
-  // bytes mask = 4;
-  void clear_mask();
-  const std::string& mask() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_mask(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_mask();
-  PROTOBUF_NODISCARD std::string* release_mask();
-  void set_allocated_mask(std::string* mask);
-  private:
-  const std::string& _internal_mask() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mask(const std::string& value);
-  std::string* _internal_mutable_mask();
-  public:
-
-  // bytes value = 5;
-  void clear_value();
-  const std::string& value() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_value(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_value();
-  PROTOBUF_NODISCARD std::string* release_value();
-  void set_allocated_value(std::string* value);
+  // int32 actionId = 1;
+  void clear_actionid();
+  int32_t actionid() const;
+  void set_actionid(int32_t value);
   private:
-  const std::string& _internal_value() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
-  std::string* _internal_mutable_value();
+  int32_t _internal_actionid() const;
+  void _internal_set_actionid(int32_t value);
   public:
 
-  // int32 procId = 1;
+  // int32 procId = 2;
   void clear_procid();
   int32_t procid() const;
   void set_procid(int32_t value);
@@ -6734,34 +6998,7 @@ class InsertTcamEntryReq final :
   void _internal_set_procid(int32_t value);
   public:
 
-  // int32 matcherId = 2;
-  void clear_matcherid();
-  int32_t matcherid() const;
-  void set_matcherid(int32_t value);
-  private:
-  int32_t _internal_matcherid() const;
-  void _internal_set_matcherid(int32_t value);
-  public:
-
-  // int32 key_byte_len = 6;
-  void clear_key_byte_len();
-  int32_t key_byte_len() const;
-  void set_key_byte_len(int32_t value);
-  private:
-  int32_t _internal_key_byte_len() const;
-  void _internal_set_key_byte_len(int32_t value);
-  public:
-
-  // int32 value_byte_len = 7;
-  void clear_value_byte_len();
-  int32_t value_byte_len() const;
-  void set_value_byte_len(int32_t value);
-  private:
-  int32_t _internal_value_byte_len() const;
-  void _internal_set_value_byte_len(int32_t value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:rp4.InsertTcamEntryReq)
+  // @@protoc_insertion_point(class_scope:rp4.ActionProc)
  private:
   class _Internal;
 
@@ -6769,13 +7006,8 @@ class InsertTcamEntryReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mask_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t actionid_;
     int32_t procid_;
-    int32_t matcherid_;
-    int32_t key_byte_len_;
-    int32_t value_byte_len_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -6783,24 +7015,24 @@ class InsertTcamEntryReq final :
 };
 // -------------------------------------------------------------------
 
-class InsertTcamEntryResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertTcamEntryResp) */ {
+class SetActionProcReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetActionProcReq) */ {
  public:
-  inline InsertTcamEntryResp() : InsertTcamEntryResp(nullptr) {}
-  ~InsertTcamEntryResp() override;
-  explicit PROTOBUF_CONSTEXPR InsertTcamEntryResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetActionProcReq() : SetActionProcReq(nullptr) {}
+  ~SetActionProcReq() override;
+  explicit PROTOBUF_CONSTEXPR SetActionProcReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  InsertTcamEntryResp(const InsertTcamEntryResp& from);
-  InsertTcamEntryResp(InsertTcamEntryResp&& from) noexcept
-    : InsertTcamEntryResp() {
+  SetActionProcReq(const SetActionProcReq& from);
+  SetActionProcReq(SetActionProcReq&& from) noexcept
+    : SetActionProcReq() {
     *this = ::std::move(from);
   }
 
-  inline InsertTcamEntryResp& operator=(const InsertTcamEntryResp& from) {
+  inline SetActionProcReq& operator=(const SetActionProcReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline InsertTcamEntryResp& operator=(InsertTcamEntryResp&& from) noexcept {
+  inline SetActionProcReq& operator=(SetActionProcReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6823,20 +7055,20 @@ class InsertTcamEntryResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const InsertTcamEntryResp& default_instance() {
+  static const SetActionProcReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const InsertTcamEntryResp* internal_default_instance() {
-    return reinterpret_cast<const InsertTcamEntryResp*>(
-               &_InsertTcamEntryResp_default_instance_);
+  static inline const SetActionProcReq* internal_default_instance() {
+    return reinterpret_cast<const SetActionProcReq*>(
+               &_SetActionProcReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     37;
 
-  friend void swap(InsertTcamEntryResp& a, InsertTcamEntryResp& b) {
+  friend void swap(SetActionProcReq& a, SetActionProcReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(InsertTcamEntryResp* other) {
+  inline void Swap(SetActionProcReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6849,7 +7081,7 @@ class InsertTcamEntryResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(InsertTcamEntryResp* other) {
+  void UnsafeArenaSwap(SetActionProcReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6857,14 +7089,14 @@ class InsertTcamEntryResp final :
 
   // implements Message ----------------------------------------------
 
-  InsertTcamEntryResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<InsertTcamEntryResp>(arena);
+  SetActionProcReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetActionProcReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const InsertTcamEntryResp& from);
+  void CopyFrom(const SetActionProcReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const InsertTcamEntryResp& from) {
-    InsertTcamEntryResp::MergeImpl(*this, from);
+  void MergeFrom( const SetActionProcReq& from) {
+    SetActionProcReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -6882,15 +7114,15 @@ class InsertTcamEntryResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(InsertTcamEntryResp* other);
+  void InternalSwap(SetActionProcReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.InsertTcamEntryResp";
+    return "rp4.SetActionProcReq";
   }
   protected:
-  explicit InsertTcamEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetActionProcReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -6904,18 +7136,47 @@ class InsertTcamEntryResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kActionProcsFieldNumber = 3,
+    kProcIdFieldNumber = 1,
+    kMatcherIdFieldNumber = 2,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
+  // repeated .rp4.ActionProc actionProcs = 3;
+  int actionprocs_size() const;
   private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  int _internal_actionprocs_size() const;
   public:
+  void clear_actionprocs();
+  ::rp4::ActionProc* mutable_actionprocs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ActionProc >*
+      mutable_actionprocs();
+  private:
+  const ::rp4::ActionProc& _internal_actionprocs(int index) const;
+  ::rp4::ActionProc* _internal_add_actionprocs();
+  public:
+  const ::rp4::ActionProc& actionprocs(int index) const;
+  ::rp4::ActionProc* add_actionprocs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ActionProc >&
+      actionprocs() const;
 
-  // @@protoc_insertion_point(class_scope:rp4.InsertTcamEntryResp)
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
+  private:
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
+  public:
+
+  // int32 matcherId = 2;
+  void clear_matcherid();
+  int32_t matcherid() const;
+  void set_matcherid(int32_t value);
+  private:
+  int32_t _internal_matcherid() const;
+  void _internal_set_matcherid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.SetActionProcReq)
  private:
   class _Internal;
 
@@ -6923,7 +7184,9 @@ class InsertTcamEntryResp final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ActionProc > actionprocs_;
+    int32_t procid_;
+    int32_t matcherid_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -6931,24 +7194,24 @@ class InsertTcamEntryResp final :
 };
 // -------------------------------------------------------------------
 
-class ClearOldConfigReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearOldConfigReq) */ {
+class SetActionProcResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetActionProcResp) */ {
  public:
-  inline ClearOldConfigReq() : ClearOldConfigReq(nullptr) {}
-  ~ClearOldConfigReq() override;
-  explicit PROTOBUF_CONSTEXPR ClearOldConfigReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetActionProcResp() : SetActionProcResp(nullptr) {}
+  ~SetActionProcResp() override;
+  explicit PROTOBUF_CONSTEXPR SetActionProcResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearOldConfigReq(const ClearOldConfigReq& from);
-  ClearOldConfigReq(ClearOldConfigReq&& from) noexcept
-    : ClearOldConfigReq() {
+  SetActionProcResp(const SetActionProcResp& from);
+  SetActionProcResp(SetActionProcResp&& from) noexcept
+    : SetActionProcResp() {
     *this = ::std::move(from);
   }
 
-  inline ClearOldConfigReq& operator=(const ClearOldConfigReq& from) {
+  inline SetActionProcResp& operator=(const SetActionProcResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearOldConfigReq& operator=(ClearOldConfigReq&& from) noexcept {
+  inline SetActionProcResp& operator=(SetActionProcResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6971,20 +7234,20 @@ class ClearOldConfigReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearOldConfigReq& default_instance() {
+  static const SetActionProcResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearOldConfigReq* internal_default_instance() {
-    return reinterpret_cast<const ClearOldConfigReq*>(
-               &_ClearOldConfigReq_default_instance_);
+  static inline const SetActionProcResp* internal_default_instance() {
+    return reinterpret_cast<const SetActionProcResp*>(
+               &_SetActionProcResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     38;
 
-  friend void swap(ClearOldConfigReq& a, ClearOldConfigReq& b) {
+  friend void swap(SetActionProcResp& a, SetActionProcResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearOldConfigReq* other) {
+  inline void Swap(SetActionProcResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6997,7 +7260,7 @@ class ClearOldConfigReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearOldConfigReq* other) {
+  void UnsafeArenaSwap(SetActionProcResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -7005,14 +7268,14 @@ class ClearOldConfigReq final :
 
   // implements Message ----------------------------------------------
 
-  ClearOldConfigReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearOldConfigReq>(arena);
+  SetActionProcResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetActionProcResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClearOldConfigReq& from);
+  void CopyFrom(const SetActionProcResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ClearOldConfigReq& from) {
-    ClearOldConfigReq::MergeImpl(*this, from);
+  void MergeFrom( const SetActionProcResp& from) {
+    SetActionProcResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -7030,15 +7293,15 @@ class ClearOldConfigReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClearOldConfigReq* other);
+  void InternalSwap(SetActionProcResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearOldConfigReq";
+    return "rp4.SetActionProcResp";
   }
   protected:
-  explicit ClearOldConfigReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetActionProcResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -7052,28 +7315,18 @@ class ClearOldConfigReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kProcIdFieldNumber = 1,
-    kMatcherIdFieldNumber = 2,
+    kResFieldNumber = 1,
   };
-  // int32 procId = 1;
-  void clear_procid();
-  int32_t procid() const;
-  void set_procid(int32_t value);
-  private:
-  int32_t _internal_procid() const;
-  void _internal_set_procid(int32_t value);
-  public:
-
-  // int32 matcherId = 2;
-  void clear_matcherid();
-  int32_t matcherid() const;
-  void set_matcherid(int32_t value);
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  int32_t _internal_matcherid() const;
-  void _internal_set_matcherid(int32_t value);
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearOldConfigReq)
+  // @@protoc_insertion_point(class_scope:rp4.SetActionProcResp)
  private:
   class _Internal;
 
@@ -7081,8 +7334,7 @@ class ClearOldConfigReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t procid_;
-    int32_t matcherid_;
+    int res_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -7090,24 +7342,24 @@ class ClearOldConfigReq final :
 };
 // -------------------------------------------------------------------
 
-class ClearOldConfigResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearOldConfigResp) */ {
+class SetMemConfigReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetMemConfigReq) */ {
  public:
-  inline ClearOldConfigResp() : ClearOldConfigResp(nullptr) {}
-  ~ClearOldConfigResp() override;
-  explicit PROTOBUF_CONSTEXPR ClearOldConfigResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetMemConfigReq() : SetMemConfigReq(nullptr) {}
+  ~SetMemConfigReq() override;
+  explicit PROTOBUF_CONSTEXPR SetMemConfigReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearOldConfigResp(const ClearOldConfigResp& from);
-  ClearOldConfigResp(ClearOldConfigResp&& from) noexcept
-    : ClearOldConfigResp() {
+  SetMemConfigReq(const SetMemConfigReq& from);
+  SetMemConfigReq(SetMemConfigReq&& from) noexcept
+    : SetMemConfigReq() {
     *this = ::std::move(from);
   }
 
-  inline ClearOldConfigResp& operator=(const ClearOldConfigResp& from) {
+  inline SetMemConfigReq& operator=(const SetMemConfigReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearOldConfigResp& operator=(ClearOldConfigResp&& from) noexcept {
+  inline SetMemConfigReq& operator=(SetMemConfigReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -7130,20 +7382,20 @@ class ClearOldConfigResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearOldConfigResp& default_instance() {
+  static const SetMemConfigReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearOldConfigResp* internal_default_instance() {
-    return reinterpret_cast<const ClearOldConfigResp*>(
-               &_ClearOldConfigResp_default_instance_);
+  static inline const SetMemConfigReq* internal_default_instance() {
+    return reinterpret_cast<const SetMemConfigReq*>(
+               &_SetMemConfigReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     39;
 
-  friend void swap(ClearOldConfigResp& a, ClearOldConfigResp& b) {
+  friend void swap(SetMemConfigReq& a, SetMemConfigReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearOldConfigResp* other) {
+  inline void Swap(SetMemConfigReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -7156,7 +7408,7 @@ class ClearOldConfigResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearOldConfigResp* other) {
+  void UnsafeArenaSwap(SetMemConfigReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -7164,14 +7416,14 @@ class ClearOldConfigResp final :
 
   // implements Message ----------------------------------------------
 
-  ClearOldConfigResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearOldConfigResp>(arena);
+  SetMemConfigReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetMemConfigReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClearOldConfigResp& from);
+  void CopyFrom(const SetMemConfigReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ClearOldConfigResp& from) {
-    ClearOldConfigResp::MergeImpl(*this, from);
+  void MergeFrom( const SetMemConfigReq& from) {
+    SetMemConfigReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -7189,15 +7441,15 @@ class ClearOldConfigResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClearOldConfigResp* other);
+  void InternalSwap(SetMemConfigReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearOldConfigResp";
+    return "rp4.SetMemConfigReq";
   }
   protected:
-  explicit ClearOldConfigResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetMemConfigReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -7211,18 +7463,108 @@ class ClearOldConfigResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kKeyConfigFieldNumber = 5,
+    kValueConfigFieldNumber = 6,
+    kProcIdFieldNumber = 1,
+    kMatcherIdFieldNumber = 2,
+    kKeyWidthFieldNumber = 3,
+    kValueWidthFieldNumber = 4,
+    kMatchTypeFieldNumber = 7,
+    kDepthFieldNumber = 8,
+    kMissActIdFieldNumber = 9,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
+  // bytes keyConfig = 5;
+  void clear_keyconfig();
+  const std::string& keyconfig() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_keyconfig(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_keyconfig();
+  PROTOBUF_NODISCARD std::string* release_keyconfig();
+  void set_allocated_keyconfig(std::string* keyconfig);
   private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  const std::string& _internal_keyconfig() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_keyconfig(const std::string& value);
+  std::string* _internal_mutable_keyconfig();
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearOldConfigResp)
+  // bytes valueConfig = 6;
+  void clear_valueconfig();
+  const std::string& valueconfig() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_valueconfig(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_valueconfig();
+  PROTOBUF_NODISCARD std::string* release_valueconfig();
+  void set_allocated_valueconfig(std::string* valueconfig);
+  private:
+  const std::string& _internal_valueconfig() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_valueconfig(const std::string& value);
+  std::string* _internal_mutable_valueconfig();
+  public:
+
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
+  private:
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
+  public:
+
+  // int32 matcherId = 2;
+  void clear_matcherid();
+  int32_t matcherid() const;
+  void set_matcherid(int32_t value);
+  private:
+  int32_t _internal_matcherid() const;
+  void _internal_set_matcherid(int32_t value);
+  public:
+
+  // int32 keyWidth = 3;
+  void clear_keywidth();
+  int32_t keywidth() const;
+  void set_keywidth(int32_t value);
+  private:
+  int32_t _internal_keywidth() const;
+  void _internal_set_keywidth(int32_t value);
+  public:
+
+  // int32 valueWidth = 4;
+  void clear_valuewidth();
+  int32_t valuewidth() const;
+  void set_valuewidth(int32_t value);
+  private:
+  int32_t _internal_valuewidth() const;
+  void _internal_set_valuewidth(int32_t value);
+  public:
+
+  // .rp4.MatchType matchType = 7;
+  void clear_matchtype();
+  ::rp4::MatchType matchtype() const;
+  void set_matchtype(::rp4::MatchType value);
+  private:
+  ::rp4::MatchType _internal_matchtype() const;
+  void _internal_set_matchtype(::rp4::MatchType value);
+  public:
+
+  // int32 depth = 8;
+  void clear_depth();
+  int32_t depth() const;
+  void set_depth(int32_t value);
+  private:
+  int32_t _internal_depth() const;
+  void _internal_set_depth(int32_t value);
+  public:
+
+  // int32 missActId = 9;
+  void clear_missactid();
+  int32_t missactid() const;
+  void set_missactid(int32_t value);
+  private:
+  int32_t _internal_missactid() const;
+  void _internal_set_missactid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.SetMemConfigReq)
  private:
   class _Internal;
 
@@ -7230,7 +7572,15 @@ class ClearOldConfigResp final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr keyconfig_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr valueconfig_;
+    int32_t procid_;
+    int32_t matcherid_;
+    int32_t keywidth_;
+    int32_t valuewidth_;
+    int matchtype_;
+    int32_t depth_;
+    int32_t missactid_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -7238,24 +7588,24 @@ class ClearOldConfigResp final :
 };
 // -------------------------------------------------------------------
 
-class SetMissActIdReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetMissActIdReq) */ {
+class SetMemConfigResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetMemConfigResp) */ {
  public:
-  inline SetMissActIdReq() : SetMissActIdReq(nullptr) {}
-  ~SetMissActIdReq() override;
-  explicit PROTOBUF_CONSTEXPR SetMissActIdReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetMemConfigResp() : SetMemConfigResp(nullptr) {}
+  ~SetMemConfigResp() override;
+  explicit PROTOBUF_CONSTEXPR SetMemConfigResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetMissActIdReq(const SetMissActIdReq& from);
-  SetMissActIdReq(SetMissActIdReq&& from) noexcept
-    : SetMissActIdReq() {
+  SetMemConfigResp(const SetMemConfigResp& from);
+  SetMemConfigResp(SetMemConfigResp&& from) noexcept
+    : SetMemConfigResp() {
     *this = ::std::move(from);
   }
 
-  inline SetMissActIdReq& operator=(const SetMissActIdReq& from) {
+  inline SetMemConfigResp& operator=(const SetMemConfigResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetMissActIdReq& operator=(SetMissActIdReq&& from) noexcept {
+  inline SetMemConfigResp& operator=(SetMemConfigResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -7278,20 +7628,20 @@ class SetMissActIdReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetMissActIdReq& default_instance() {
+  static const SetMemConfigResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetMissActIdReq* internal_default_instance() {
-    return reinterpret_cast<const SetMissActIdReq*>(
-               &_SetMissActIdReq_default_instance_);
+  static inline const SetMemConfigResp* internal_default_instance() {
+    return reinterpret_cast<const SetMemConfigResp*>(
+               &_SetMemConfigResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     40;
 
-  friend void swap(SetMissActIdReq& a, SetMissActIdReq& b) {
+  friend void swap(SetMemConfigResp& a, SetMemConfigResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetMissActIdReq* other) {
+  inline void Swap(SetMemConfigResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -7304,7 +7654,7 @@ class SetMissActIdReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetMissActIdReq* other) {
+  void UnsafeArenaSwap(SetMemConfigResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -7312,14 +7662,14 @@ class SetMissActIdReq final :
 
   // implements Message ----------------------------------------------
 
-  SetMissActIdReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetMissActIdReq>(arena);
+  SetMemConfigResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetMemConfigResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetMissActIdReq& from);
+  void CopyFrom(const SetMemConfigResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetMissActIdReq& from) {
-    SetMissActIdReq::MergeImpl(*this, from);
+  void MergeFrom( const SetMemConfigResp& from) {
+    SetMemConfigResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -7337,15 +7687,15 @@ class SetMissActIdReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetMissActIdReq* other);
+  void InternalSwap(SetMemConfigResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.SetMissActIdReq";
+    return "rp4.SetMemConfigResp";
   }
   protected:
-  explicit SetMissActIdReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetMemConfigResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -7359,38 +7709,18 @@ class SetMissActIdReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kProcIdFieldNumber = 1,
-    kMatcherIdFieldNumber = 2,
-    kMissActIdFieldNumber = 3,
+    kResFieldNumber = 1,
   };
-  // int32 procId = 1;
-  void clear_procid();
-  int32_t procid() const;
-  void set_procid(int32_t value);
-  private:
-  int32_t _internal_procid() const;
-  void _internal_set_procid(int32_t value);
-  public:
-
-  // int32 matcherId = 2;
-  void clear_matcherid();
-  int32_t matcherid() const;
-  void set_matcherid(int32_t value);
-  private:
-  int32_t _internal_matcherid() const;
-  void _internal_set_matcherid(int32_t value);
-  public:
-
-  // int32 miss_act_id = 3;
-  void clear_miss_act_id();
-  int32_t miss_act_id() const;
-  void set_miss_act_id(int32_t value);
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  int32_t _internal_miss_act_id() const;
-  void _internal_set_miss_act_id(int32_t value);
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.SetMissActIdReq)
+  // @@protoc_insertion_point(class_scope:rp4.SetMemConfigResp)
  private:
   class _Internal;
 
@@ -7398,9 +7728,7 @@ class SetMissActIdReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t procid_;
-    int32_t matcherid_;
-    int32_t miss_act_id_;
+    int res_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -7408,24 +7736,24 @@ class SetMissActIdReq final :
 };
 // -------------------------------------------------------------------
 
-class SetMissActIdResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetMissActIdResp) */ {
+class SetFieldInfoReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetFieldInfoReq) */ {
  public:
-  inline SetMissActIdResp() : SetMissActIdResp(nullptr) {}
-  ~SetMissActIdResp() override;
-  explicit PROTOBUF_CONSTEXPR SetMissActIdResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetFieldInfoReq() : SetFieldInfoReq(nullptr) {}
+  ~SetFieldInfoReq() override;
+  explicit PROTOBUF_CONSTEXPR SetFieldInfoReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetMissActIdResp(const SetMissActIdResp& from);
-  SetMissActIdResp(SetMissActIdResp&& from) noexcept
-    : SetMissActIdResp() {
+  SetFieldInfoReq(const SetFieldInfoReq& from);
+  SetFieldInfoReq(SetFieldInfoReq&& from) noexcept
+    : SetFieldInfoReq() {
     *this = ::std::move(from);
   }
 
-  inline SetMissActIdResp& operator=(const SetMissActIdResp& from) {
+  inline SetFieldInfoReq& operator=(const SetFieldInfoReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetMissActIdResp& operator=(SetMissActIdResp&& from) noexcept {
+  inline SetFieldInfoReq& operator=(SetFieldInfoReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -7448,20 +7776,20 @@ class SetMissActIdResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetMissActIdResp& default_instance() {
+  static const SetFieldInfoReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetMissActIdResp* internal_default_instance() {
-    return reinterpret_cast<const SetMissActIdResp*>(
-               &_SetMissActIdResp_default_instance_);
+  static inline const SetFieldInfoReq* internal_default_instance() {
+    return reinterpret_cast<const SetFieldInfoReq*>(
+               &_SetFieldInfoReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     41;
 
-  friend void swap(SetMissActIdResp& a, SetMissActIdResp& b) {
+  friend void swap(SetFieldInfoReq& a, SetFieldInfoReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetMissActIdResp* other) {
+  inline void Swap(SetFieldInfoReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -7474,7 +7802,7 @@ class SetMissActIdResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetMissActIdResp* other) {
+  void UnsafeArenaSwap(SetFieldInfoReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -7482,14 +7810,14 @@ class SetMissActIdResp final :
 
   // implements Message ----------------------------------------------
 
-  SetMissActIdResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetMissActIdResp>(arena);
+  SetFieldInfoReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetFieldInfoReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetMissActIdResp& from);
+  void CopyFrom(const SetFieldInfoReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetMissActIdResp& from) {
-    SetMissActIdResp::MergeImpl(*this, from);
+  void MergeFrom( const SetFieldInfoReq& from) {
+    SetFieldInfoReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -7507,15 +7835,15 @@ class SetMissActIdResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetMissActIdResp* other);
+  void InternalSwap(SetFieldInfoReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.SetMissActIdResp";
+    return "rp4.SetFieldInfoReq";
   }
   protected:
-  explicit SetMissActIdResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetFieldInfoReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -7529,26 +7857,57 @@ class SetMissActIdResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kFdInfosFieldNumber = 3,
+    kProcIdFieldNumber = 1,
+    kMatcherIdFieldNumber = 2,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
+  // repeated .rp4.FieldInfo fdInfos = 3;
+  int fdinfos_size() const;
   private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  int _internal_fdinfos_size() const;
+  public:
+  void clear_fdinfos();
+  ::rp4::FieldInfo* mutable_fdinfos(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >*
+      mutable_fdinfos();
+  private:
+  const ::rp4::FieldInfo& _internal_fdinfos(int index) const;
+  ::rp4::FieldInfo* _internal_add_fdinfos();
   public:
+  const ::rp4::FieldInfo& fdinfos(int index) const;
+  ::rp4::FieldInfo* add_fdinfos();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >&
+      fdinfos() const;
 
-  // @@protoc_insertion_point(class_scope:rp4.SetMissActIdResp)
- private:
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
+  private:
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
+  public:
+
+  // int32 matcherId = 2;
+  void clear_matcherid();
+  int32_t matcherid() const;
+  void set_matcherid(int32_t value);
+  private:
+  int32_t _internal_matcherid() const;
+  void _internal_set_matcherid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.SetFieldInfoReq)
+ private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo > fdinfos_;
+    int32_t procid_;
+    int32_t matcherid_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -7556,24 +7915,24 @@ class SetMissActIdResp final :
 };
 // -------------------------------------------------------------------
 
-class Parameter final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.Parameter) */ {
+class SetFieldInfoResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetFieldInfoResp) */ {
  public:
-  inline Parameter() : Parameter(nullptr) {}
-  ~Parameter() override;
-  explicit PROTOBUF_CONSTEXPR Parameter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetFieldInfoResp() : SetFieldInfoResp(nullptr) {}
+  ~SetFieldInfoResp() override;
+  explicit PROTOBUF_CONSTEXPR SetFieldInfoResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Parameter(const Parameter& from);
-  Parameter(Parameter&& from) noexcept
-    : Parameter() {
+  SetFieldInfoResp(const SetFieldInfoResp& from);
+  SetFieldInfoResp(SetFieldInfoResp&& from) noexcept
+    : SetFieldInfoResp() {
     *this = ::std::move(from);
   }
 
-  inline Parameter& operator=(const Parameter& from) {
+  inline SetFieldInfoResp& operator=(const SetFieldInfoResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Parameter& operator=(Parameter&& from) noexcept {
+  inline SetFieldInfoResp& operator=(SetFieldInfoResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -7596,29 +7955,20 @@ class Parameter final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Parameter& default_instance() {
+  static const SetFieldInfoResp& default_instance() {
     return *internal_default_instance();
   }
-  enum ValCase {
-    kHdrId = 2,
-    kField = 3,
-    kConstantData = 4,
-    kActionParaId = 5,
-    kOp = 6,
-    VAL_NOT_SET = 0,
-  };
-
-  static inline const Parameter* internal_default_instance() {
-    return reinterpret_cast<const Parameter*>(
-               &_Parameter_default_instance_);
+  static inline const SetFieldInfoResp* internal_default_instance() {
+    return reinterpret_cast<const SetFieldInfoResp*>(
+               &_SetFieldInfoResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     42;
 
-  friend void swap(Parameter& a, Parameter& b) {
+  friend void swap(SetFieldInfoResp& a, SetFieldInfoResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(Parameter* other) {
+  inline void Swap(SetFieldInfoResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -7631,7 +7981,7 @@ class Parameter final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Parameter* other) {
+  void UnsafeArenaSwap(SetFieldInfoResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -7639,14 +7989,14 @@ class Parameter final :
 
   // implements Message ----------------------------------------------
 
-  Parameter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Parameter>(arena);
+  SetFieldInfoResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetFieldInfoResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Parameter& from);
+  void CopyFrom(const SetFieldInfoResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Parameter& from) {
-    Parameter::MergeImpl(*this, from);
+  void MergeFrom( const SetFieldInfoResp& from) {
+    SetFieldInfoResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -7664,15 +8014,15 @@ class Parameter final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Parameter* other);
+  void InternalSwap(SetFieldInfoResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.Parameter";
+    return "rp4.SetFieldInfoResp";
   }
   protected:
-  explicit Parameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetFieldInfoResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -7686,152 +8036,51 @@ class Parameter final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kTypeFieldNumber = 1,
-    kHdrIdFieldNumber = 2,
-    kFieldFieldNumber = 3,
-    kConstantDataFieldNumber = 4,
-    kActionParaIdFieldNumber = 5,
-    kOpFieldNumber = 6,
+    kResFieldNumber = 1,
   };
-  // .rp4.ParameterType type = 1;
-  void clear_type();
-  ::rp4::ParameterType type() const;
-  void set_type(::rp4::ParameterType value);
-  private:
-  ::rp4::ParameterType _internal_type() const;
-  void _internal_set_type(::rp4::ParameterType value);
-  public:
-
-  // int32 hdrId = 2;
-  bool has_hdrid() const;
-  private:
-  bool _internal_has_hdrid() const;
-  public:
-  void clear_hdrid();
-  int32_t hdrid() const;
-  void set_hdrid(int32_t value);
-  private:
-  int32_t _internal_hdrid() const;
-  void _internal_set_hdrid(int32_t value);
-  public:
-
-  // .rp4.FieldInfo field = 3;
-  bool has_field() const;
-  private:
-  bool _internal_has_field() const;
-  public:
-  void clear_field();
-  const ::rp4::FieldInfo& field() const;
-  PROTOBUF_NODISCARD ::rp4::FieldInfo* release_field();
-  ::rp4::FieldInfo* mutable_field();
-  void set_allocated_field(::rp4::FieldInfo* field);
-  private:
-  const ::rp4::FieldInfo& _internal_field() const;
-  ::rp4::FieldInfo* _internal_mutable_field();
-  public:
-  void unsafe_arena_set_allocated_field(
-      ::rp4::FieldInfo* field);
-  ::rp4::FieldInfo* unsafe_arena_release_field();
-
-  // .rp4.Data constantData = 4;
-  bool has_constantdata() const;
-  private:
-  bool _internal_has_constantdata() const;
-  public:
-  void clear_constantdata();
-  const ::rp4::Data& constantdata() const;
-  PROTOBUF_NODISCARD ::rp4::Data* release_constantdata();
-  ::rp4::Data* mutable_constantdata();
-  void set_allocated_constantdata(::rp4::Data* constantdata);
-  private:
-  const ::rp4::Data& _internal_constantdata() const;
-  ::rp4::Data* _internal_mutable_constantdata();
-  public:
-  void unsafe_arena_set_allocated_constantdata(
-      ::rp4::Data* constantdata);
-  ::rp4::Data* unsafe_arena_release_constantdata();
-
-  // int32 actionParaId = 5;
-  bool has_actionparaid() const;
-  private:
-  bool _internal_has_actionparaid() const;
-  public:
-  void clear_actionparaid();
-  int32_t actionparaid() const;
-  void set_actionparaid(int32_t value);
-  private:
-  int32_t _internal_actionparaid() const;
-  void _internal_set_actionparaid(int32_t value);
-  public:
-
-  // .rp4.OpCode op = 6;
-  bool has_op() const;
-  private:
-  bool _internal_has_op() const;
-  public:
-  void clear_op();
-  ::rp4::OpCode op() const;
-  void set_op(::rp4::OpCode value);
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  ::rp4::OpCode _internal_op() const;
-  void _internal_set_op(::rp4::OpCode value);
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
 
-  void clear_val();
-  ValCase val_case() const;
-  // @@protoc_insertion_point(class_scope:rp4.Parameter)
+  // @@protoc_insertion_point(class_scope:rp4.SetFieldInfoResp)
  private:
   class _Internal;
-  void set_has_hdrid();
-  void set_has_field();
-  void set_has_constantdata();
-  void set_has_actionparaid();
-  void set_has_op();
-
-  inline bool has_val() const;
-  inline void clear_has_val();
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int type_;
-    union ValUnion {
-      constexpr ValUnion() : _constinit_{} {}
-        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
-      int32_t hdrid_;
-      ::rp4::FieldInfo* field_;
-      ::rp4::Data* constantdata_;
-      int32_t actionparaid_;
-      int op_;
-    } val_;
+    int res_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-    uint32_t _oneof_case_[1];
-
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ExpTreeNode final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ExpTreeNode) */ {
+class InsertSramEntryReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertSramEntryReq) */ {
  public:
-  inline ExpTreeNode() : ExpTreeNode(nullptr) {}
-  ~ExpTreeNode() override;
-  explicit PROTOBUF_CONSTEXPR ExpTreeNode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline InsertSramEntryReq() : InsertSramEntryReq(nullptr) {}
+  ~InsertSramEntryReq() override;
+  explicit PROTOBUF_CONSTEXPR InsertSramEntryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ExpTreeNode(const ExpTreeNode& from);
-  ExpTreeNode(ExpTreeNode&& from) noexcept
-    : ExpTreeNode() {
+  InsertSramEntryReq(const InsertSramEntryReq& from);
+  InsertSramEntryReq(InsertSramEntryReq&& from) noexcept
+    : InsertSramEntryReq() {
     *this = ::std::move(from);
   }
 
-  inline ExpTreeNode& operator=(const ExpTreeNode& from) {
+  inline InsertSramEntryReq& operator=(const InsertSramEntryReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ExpTreeNode& operator=(ExpTreeNode&& from) noexcept {
+  inline InsertSramEntryReq& operator=(InsertSramEntryReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -7854,20 +8103,20 @@ class ExpTreeNode final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ExpTreeNode& default_instance() {
+  static const InsertSramEntryReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ExpTreeNode* internal_default_instance() {
-    return reinterpret_cast<const ExpTreeNode*>(
-               &_ExpTreeNode_default_instance_);
+  static inline const InsertSramEntryReq* internal_default_instance() {
+    return reinterpret_cast<const InsertSramEntryReq*>(
+               &_InsertSramEntryReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     43;
 
-  friend void swap(ExpTreeNode& a, ExpTreeNode& b) {
+  friend void swap(InsertSramEntryReq& a, InsertSramEntryReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(ExpTreeNode* other) {
+  inline void Swap(InsertSramEntryReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -7880,7 +8129,7 @@ class ExpTreeNode final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ExpTreeNode* other) {
+  void UnsafeArenaSwap(InsertSramEntryReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -7888,14 +8137,14 @@ class ExpTreeNode final :
 
   // implements Message ----------------------------------------------
 
-  ExpTreeNode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ExpTreeNode>(arena);
+  InsertSramEntryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InsertSramEntryReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ExpTreeNode& from);
+  void CopyFrom(const InsertSramEntryReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ExpTreeNode& from) {
-    ExpTreeNode::MergeImpl(*this, from);
+  void MergeFrom( const InsertSramEntryReq& from) {
+    InsertSramEntryReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -7913,15 +8162,15 @@ class ExpTreeNode final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ExpTreeNode* other);
+  void InternalSwap(InsertSramEntryReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ExpTreeNode";
+    return "rp4.InsertSramEntryReq";
   }
   protected:
-  explicit ExpTreeNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit InsertSramEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -7935,65 +8184,78 @@ class ExpTreeNode final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kOptFieldNumber = 1,
-    kLeftFieldNumber = 2,
-    kRightFieldNumber = 3,
-  };
-  // .rp4.Parameter opt = 1;
-  bool has_opt() const;
+    kKeyFieldNumber = 3,
+    kValueFieldNumber = 4,
+    kProcIdFieldNumber = 1,
+    kMatcherIdFieldNumber = 2,
+    kKeyByteLenFieldNumber = 5,
+    kValueByteLenFieldNumber = 6,
+  };
+  // bytes key = 3;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
   private:
-  bool _internal_has_opt() const;
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
   public:
-  void clear_opt();
-  const ::rp4::Parameter& opt() const;
-  PROTOBUF_NODISCARD ::rp4::Parameter* release_opt();
-  ::rp4::Parameter* mutable_opt();
-  void set_allocated_opt(::rp4::Parameter* opt);
+
+  // bytes value = 4;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
   private:
-  const ::rp4::Parameter& _internal_opt() const;
-  ::rp4::Parameter* _internal_mutable_opt();
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
   public:
-  void unsafe_arena_set_allocated_opt(
-      ::rp4::Parameter* opt);
-  ::rp4::Parameter* unsafe_arena_release_opt();
 
-  // .rp4.ExpTreeNode left = 2;
-  bool has_left() const;
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
   private:
-  bool _internal_has_left() const;
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
   public:
-  void clear_left();
-  const ::rp4::ExpTreeNode& left() const;
-  PROTOBUF_NODISCARD ::rp4::ExpTreeNode* release_left();
-  ::rp4::ExpTreeNode* mutable_left();
-  void set_allocated_left(::rp4::ExpTreeNode* left);
+
+  // int32 matcherId = 2;
+  void clear_matcherid();
+  int32_t matcherid() const;
+  void set_matcherid(int32_t value);
   private:
-  const ::rp4::ExpTreeNode& _internal_left() const;
-  ::rp4::ExpTreeNode* _internal_mutable_left();
+  int32_t _internal_matcherid() const;
+  void _internal_set_matcherid(int32_t value);
   public:
-  void unsafe_arena_set_allocated_left(
-      ::rp4::ExpTreeNode* left);
-  ::rp4::ExpTreeNode* unsafe_arena_release_left();
 
-  // .rp4.ExpTreeNode right = 3;
-  bool has_right() const;
+  // int32 key_byte_len = 5;
+  void clear_key_byte_len();
+  int32_t key_byte_len() const;
+  void set_key_byte_len(int32_t value);
   private:
-  bool _internal_has_right() const;
+  int32_t _internal_key_byte_len() const;
+  void _internal_set_key_byte_len(int32_t value);
   public:
-  void clear_right();
-  const ::rp4::ExpTreeNode& right() const;
-  PROTOBUF_NODISCARD ::rp4::ExpTreeNode* release_right();
-  ::rp4::ExpTreeNode* mutable_right();
-  void set_allocated_right(::rp4::ExpTreeNode* right);
+
+  // int32 value_byte_len = 6;
+  void clear_value_byte_len();
+  int32_t value_byte_len() const;
+  void set_value_byte_len(int32_t value);
   private:
-  const ::rp4::ExpTreeNode& _internal_right() const;
-  ::rp4::ExpTreeNode* _internal_mutable_right();
+  int32_t _internal_value_byte_len() const;
+  void _internal_set_value_byte_len(int32_t value);
   public:
-  void unsafe_arena_set_allocated_right(
-      ::rp4::ExpTreeNode* right);
-  ::rp4::ExpTreeNode* unsafe_arena_release_right();
 
-  // @@protoc_insertion_point(class_scope:rp4.ExpTreeNode)
+  // @@protoc_insertion_point(class_scope:rp4.InsertSramEntryReq)
  private:
   class _Internal;
 
@@ -8001,9 +8263,12 @@ class ExpTreeNode final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::rp4::Parameter* opt_;
-    ::rp4::ExpTreeNode* left_;
-    ::rp4::ExpTreeNode* right_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t procid_;
+    int32_t matcherid_;
+    int32_t key_byte_len_;
+    int32_t value_byte_len_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -8011,24 +8276,24 @@ class ExpTreeNode final :
 };
 // -------------------------------------------------------------------
 
-class Prim final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.Prim) */ {
+class InsertSramEntryResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertSramEntryResp) */ {
  public:
-  inline Prim() : Prim(nullptr) {}
-  ~Prim() override;
-  explicit PROTOBUF_CONSTEXPR Prim(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline InsertSramEntryResp() : InsertSramEntryResp(nullptr) {}
+  ~InsertSramEntryResp() override;
+  explicit PROTOBUF_CONSTEXPR InsertSramEntryResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Prim(const Prim& from);
-  Prim(Prim&& from) noexcept
-    : Prim() {
+  InsertSramEntryResp(const InsertSramEntryResp& from);
+  InsertSramEntryResp(InsertSramEntryResp&& from) noexcept
+    : InsertSramEntryResp() {
     *this = ::std::move(from);
   }
 
-  inline Prim& operator=(const Prim& from) {
+  inline InsertSramEntryResp& operator=(const InsertSramEntryResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Prim& operator=(Prim&& from) noexcept {
+  inline InsertSramEntryResp& operator=(InsertSramEntryResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -8051,20 +8316,20 @@ class Prim final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Prim& default_instance() {
+  static const InsertSramEntryResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Prim* internal_default_instance() {
-    return reinterpret_cast<const Prim*>(
-               &_Prim_default_instance_);
+  static inline const InsertSramEntryResp* internal_default_instance() {
+    return reinterpret_cast<const InsertSramEntryResp*>(
+               &_InsertSramEntryResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     44;
 
-  friend void swap(Prim& a, Prim& b) {
+  friend void swap(InsertSramEntryResp& a, InsertSramEntryResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(Prim* other) {
+  inline void Swap(InsertSramEntryResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -8077,7 +8342,7 @@ class Prim final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Prim* other) {
+  void UnsafeArenaSwap(InsertSramEntryResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -8085,14 +8350,14 @@ class Prim final :
 
   // implements Message ----------------------------------------------
 
-  Prim* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Prim>(arena);
+  InsertSramEntryResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InsertSramEntryResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Prim& from);
+  void CopyFrom(const InsertSramEntryResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Prim& from) {
-    Prim::MergeImpl(*this, from);
+  void MergeFrom( const InsertSramEntryResp& from) {
+    InsertSramEntryResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -8110,15 +8375,15 @@ class Prim final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Prim* other);
+  void InternalSwap(InsertSramEntryResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.Prim";
+    return "rp4.InsertSramEntryResp";
   }
   protected:
-  explicit Prim(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit InsertSramEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -8132,46 +8397,48 @@ class Prim final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kLvalueFieldNumber = 1,
-    kRootFieldNumber = 2,
+    kResFieldNumber = 1,
+    kOccupancyFieldNumber = 2,
+    kCapacityFieldNumber = 3,
+    kStashUsedFieldNumber = 4,
   };
-  // .rp4.FieldInfo lvalue = 1;
-  bool has_lvalue() const;
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  bool _internal_has_lvalue() const;
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
-  void clear_lvalue();
-  const ::rp4::FieldInfo& lvalue() const;
-  PROTOBUF_NODISCARD ::rp4::FieldInfo* release_lvalue();
-  ::rp4::FieldInfo* mutable_lvalue();
-  void set_allocated_lvalue(::rp4::FieldInfo* lvalue);
+
+  // int32 occupancy = 2;
+  void clear_occupancy();
+  int32_t occupancy() const;
+  void set_occupancy(int32_t value);
   private:
-  const ::rp4::FieldInfo& _internal_lvalue() const;
-  ::rp4::FieldInfo* _internal_mutable_lvalue();
+  int32_t _internal_occupancy() const;
+  void _internal_set_occupancy(int32_t value);
   public:
-  void unsafe_arena_set_allocated_lvalue(
-      ::rp4::FieldInfo* lvalue);
-  ::rp4::FieldInfo* unsafe_arena_release_lvalue();
 
-  // .rp4.ExpTreeNode root = 2;
-  bool has_root() const;
+  // int32 capacity = 3;
+  void clear_capacity();
+  int32_t capacity() const;
+  void set_capacity(int32_t value);
   private:
-  bool _internal_has_root() const;
+  int32_t _internal_capacity() const;
+  void _internal_set_capacity(int32_t value);
   public:
-  void clear_root();
-  const ::rp4::ExpTreeNode& root() const;
-  PROTOBUF_NODISCARD ::rp4::ExpTreeNode* release_root();
-  ::rp4::ExpTreeNode* mutable_root();
-  void set_allocated_root(::rp4::ExpTreeNode* root);
+
+  // int32 stash_used = 4;
+  void clear_stash_used();
+  int32_t stash_used() const;
+  void set_stash_used(int32_t value);
   private:
-  const ::rp4::ExpTreeNode& _internal_root() const;
-  ::rp4::ExpTreeNode* _internal_mutable_root();
+  int32_t _internal_stash_used() const;
+  void _internal_set_stash_used(int32_t value);
   public:
-  void unsafe_arena_set_allocated_root(
-      ::rp4::ExpTreeNode* root);
-  ::rp4::ExpTreeNode* unsafe_arena_release_root();
 
-  // @@protoc_insertion_point(class_scope:rp4.Prim)
+  // @@protoc_insertion_point(class_scope:rp4.InsertSramEntryResp)
  private:
   class _Internal;
 
@@ -8179,8 +8446,10 @@ class Prim final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::rp4::FieldInfo* lvalue_;
-    ::rp4::ExpTreeNode* root_;
+    int res_;
+    int32_t occupancy_;
+    int32_t capacity_;
+    int32_t stash_used_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -8188,24 +8457,24 @@ class Prim final :
 };
 // -------------------------------------------------------------------
 
-class Action final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.Action) */ {
+class InsertTcamEntryReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertTcamEntryReq) */ {
  public:
-  inline Action() : Action(nullptr) {}
-  ~Action() override;
-  explicit PROTOBUF_CONSTEXPR Action(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline InsertTcamEntryReq() : InsertTcamEntryReq(nullptr) {}
+  ~InsertTcamEntryReq() override;
+  explicit PROTOBUF_CONSTEXPR InsertTcamEntryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Action(const Action& from);
-  Action(Action&& from) noexcept
-    : Action() {
+  InsertTcamEntryReq(const InsertTcamEntryReq& from);
+  InsertTcamEntryReq(InsertTcamEntryReq&& from) noexcept
+    : InsertTcamEntryReq() {
     *this = ::std::move(from);
   }
 
-  inline Action& operator=(const Action& from) {
+  inline InsertTcamEntryReq& operator=(const InsertTcamEntryReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Action& operator=(Action&& from) noexcept {
+  inline InsertTcamEntryReq& operator=(InsertTcamEntryReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -8228,20 +8497,20 @@ class Action final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Action& default_instance() {
+  static const InsertTcamEntryReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Action* internal_default_instance() {
-    return reinterpret_cast<const Action*>(
-               &_Action_default_instance_);
+  static inline const InsertTcamEntryReq* internal_default_instance() {
+    return reinterpret_cast<const InsertTcamEntryReq*>(
+               &_InsertTcamEntryReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     45;
 
-  friend void swap(Action& a, Action& b) {
+  friend void swap(InsertTcamEntryReq& a, InsertTcamEntryReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(Action* other) {
+  inline void Swap(InsertTcamEntryReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -8254,7 +8523,7 @@ class Action final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Action* other) {
+  void UnsafeArenaSwap(InsertTcamEntryReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -8262,14 +8531,14 @@ class Action final :
 
   // implements Message ----------------------------------------------
 
-  Action* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Action>(arena);
+  InsertTcamEntryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InsertTcamEntryReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Action& from);
+  void CopyFrom(const InsertTcamEntryReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Action& from) {
-    Action::MergeImpl(*this, from);
+  void MergeFrom( const InsertTcamEntryReq& from) {
+    InsertTcamEntryReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -8287,15 +8556,15 @@ class Action final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Action* other);
+  void InternalSwap(InsertTcamEntryReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.Action";
+    return "rp4.InsertTcamEntryReq";
   }
   protected:
-  explicit Action(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit InsertTcamEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -8309,60 +8578,93 @@ class Action final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPrimsFieldNumber = 2,
-    kActionParaLensFieldNumber = 4,
-    kParaNumFieldNumber = 1,
-  };
-  // repeated .rp4.Prim prims = 2;
-  int prims_size() const;
-  private:
-  int _internal_prims_size() const;
+    kKeyFieldNumber = 3,
+    kMaskFieldNumber = 4,
+    kValueFieldNumber = 5,
+    kProcIdFieldNumber = 1,
+    kMatcherIdFieldNumber = 2,
+    kKeyByteLenFieldNumber = 6,
+    kValueByteLenFieldNumber = 7,
+  };
+  // bytes key = 3;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
   public:
-  void clear_prims();
-  ::rp4::Prim* mutable_prims(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::Prim >*
-      mutable_prims();
+
+  // bytes mask = 4;
+  void clear_mask();
+  const std::string& mask() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_mask(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_mask();
+  PROTOBUF_NODISCARD std::string* release_mask();
+  void set_allocated_mask(std::string* mask);
   private:
-  const ::rp4::Prim& _internal_prims(int index) const;
-  ::rp4::Prim* _internal_add_prims();
+  const std::string& _internal_mask() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mask(const std::string& value);
+  std::string* _internal_mutable_mask();
   public:
-  const ::rp4::Prim& prims(int index) const;
-  ::rp4::Prim* add_prims();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::Prim >&
-      prims() const;
 
-  // repeated int32 actionParaLens = 4;
-  int actionparalens_size() const;
+  // bytes value = 5;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
   private:
-  int _internal_actionparalens_size() const;
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
   public:
-  void clear_actionparalens();
+
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
   private:
-  int32_t _internal_actionparalens(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      _internal_actionparalens() const;
-  void _internal_add_actionparalens(int32_t value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      _internal_mutable_actionparalens();
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
   public:
-  int32_t actionparalens(int index) const;
-  void set_actionparalens(int index, int32_t value);
-  void add_actionparalens(int32_t value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      actionparalens() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      mutable_actionparalens();
 
-  // int32 paraNum = 1;
-  void clear_paranum();
-  int32_t paranum() const;
-  void set_paranum(int32_t value);
+  // int32 matcherId = 2;
+  void clear_matcherid();
+  int32_t matcherid() const;
+  void set_matcherid(int32_t value);
   private:
-  int32_t _internal_paranum() const;
-  void _internal_set_paranum(int32_t value);
+  int32_t _internal_matcherid() const;
+  void _internal_set_matcherid(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.Action)
+  // int32 key_byte_len = 6;
+  void clear_key_byte_len();
+  int32_t key_byte_len() const;
+  void set_key_byte_len(int32_t value);
+  private:
+  int32_t _internal_key_byte_len() const;
+  void _internal_set_key_byte_len(int32_t value);
+  public:
+
+  // int32 value_byte_len = 7;
+  void clear_value_byte_len();
+  int32_t value_byte_len() const;
+  void set_value_byte_len(int32_t value);
+  private:
+  int32_t _internal_value_byte_len() const;
+  void _internal_set_value_byte_len(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.InsertTcamEntryReq)
  private:
   class _Internal;
 
@@ -8370,10 +8672,13 @@ class Action final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::Prim > prims_;
-    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > actionparalens_;
-    mutable std::atomic<int> _actionparalens_cached_byte_size_;
-    int32_t paranum_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mask_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t procid_;
+    int32_t matcherid_;
+    int32_t key_byte_len_;
+    int32_t value_byte_len_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -8381,24 +8686,24 @@ class Action final :
 };
 // -------------------------------------------------------------------
 
-class InsertActionReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertActionReq) */ {
+class InsertTcamEntryResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertTcamEntryResp) */ {
  public:
-  inline InsertActionReq() : InsertActionReq(nullptr) {}
-  ~InsertActionReq() override;
-  explicit PROTOBUF_CONSTEXPR InsertActionReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline InsertTcamEntryResp() : InsertTcamEntryResp(nullptr) {}
+  ~InsertTcamEntryResp() override;
+  explicit PROTOBUF_CONSTEXPR InsertTcamEntryResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  InsertActionReq(const InsertActionReq& from);
-  InsertActionReq(InsertActionReq&& from) noexcept
-    : InsertActionReq() {
+  InsertTcamEntryResp(const InsertTcamEntryResp& from);
+  InsertTcamEntryResp(InsertTcamEntryResp&& from) noexcept
+    : InsertTcamEntryResp() {
     *this = ::std::move(from);
   }
 
-  inline InsertActionReq& operator=(const InsertActionReq& from) {
+  inline InsertTcamEntryResp& operator=(const InsertTcamEntryResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline InsertActionReq& operator=(InsertActionReq&& from) noexcept {
+  inline InsertTcamEntryResp& operator=(InsertTcamEntryResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -8421,20 +8726,20 @@ class InsertActionReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const InsertActionReq& default_instance() {
+  static const InsertTcamEntryResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const InsertActionReq* internal_default_instance() {
-    return reinterpret_cast<const InsertActionReq*>(
-               &_InsertActionReq_default_instance_);
+  static inline const InsertTcamEntryResp* internal_default_instance() {
+    return reinterpret_cast<const InsertTcamEntryResp*>(
+               &_InsertTcamEntryResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     46;
 
-  friend void swap(InsertActionReq& a, InsertActionReq& b) {
+  friend void swap(InsertTcamEntryResp& a, InsertTcamEntryResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(InsertActionReq* other) {
+  inline void Swap(InsertTcamEntryResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -8447,7 +8752,7 @@ class InsertActionReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(InsertActionReq* other) {
+  void UnsafeArenaSwap(InsertTcamEntryResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -8455,14 +8760,14 @@ class InsertActionReq final :
 
   // implements Message ----------------------------------------------
 
-  InsertActionReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<InsertActionReq>(arena);
+  InsertTcamEntryResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InsertTcamEntryResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const InsertActionReq& from);
+  void CopyFrom(const InsertTcamEntryResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const InsertActionReq& from) {
-    InsertActionReq::MergeImpl(*this, from);
+  void MergeFrom( const InsertTcamEntryResp& from) {
+    InsertTcamEntryResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -8480,15 +8785,15 @@ class InsertActionReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(InsertActionReq* other);
+  void InternalSwap(InsertTcamEntryResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.InsertActionReq";
+    return "rp4.InsertTcamEntryResp";
   }
   protected:
-  explicit InsertActionReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit InsertTcamEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -8502,47 +8807,18 @@ class InsertActionReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kActionFieldNumber = 2,
-    kProcIdFieldNumber = 1,
-    kActionIdFieldNumber = 3,
+    kResFieldNumber = 1,
   };
-  // .rp4.Action action = 2;
-  bool has_action() const;
-  private:
-  bool _internal_has_action() const;
-  public:
-  void clear_action();
-  const ::rp4::Action& action() const;
-  PROTOBUF_NODISCARD ::rp4::Action* release_action();
-  ::rp4::Action* mutable_action();
-  void set_allocated_action(::rp4::Action* action);
-  private:
-  const ::rp4::Action& _internal_action() const;
-  ::rp4::Action* _internal_mutable_action();
-  public:
-  void unsafe_arena_set_allocated_action(
-      ::rp4::Action* action);
-  ::rp4::Action* unsafe_arena_release_action();
-
-  // int32 procId = 1;
-  void clear_procid();
-  int32_t procid() const;
-  void set_procid(int32_t value);
-  private:
-  int32_t _internal_procid() const;
-  void _internal_set_procid(int32_t value);
-  public:
-
-  // int32 actionId = 3;
-  void clear_actionid();
-  int32_t actionid() const;
-  void set_actionid(int32_t value);
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  int32_t _internal_actionid() const;
-  void _internal_set_actionid(int32_t value);
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.InsertActionReq)
+  // @@protoc_insertion_point(class_scope:rp4.InsertTcamEntryResp)
  private:
   class _Internal;
 
@@ -8550,9 +8826,7 @@ class InsertActionReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::rp4::Action* action_;
-    int32_t procid_;
-    int32_t actionid_;
+    int res_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -8560,24 +8834,24 @@ class InsertActionReq final :
 };
 // -------------------------------------------------------------------
 
-class InsertActionResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertActionResp) */ {
+class ModSramEntryReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ModSramEntryReq) */ {
  public:
-  inline InsertActionResp() : InsertActionResp(nullptr) {}
-  ~InsertActionResp() override;
-  explicit PROTOBUF_CONSTEXPR InsertActionResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ModSramEntryReq() : ModSramEntryReq(nullptr) {}
+  ~ModSramEntryReq() override;
+  explicit PROTOBUF_CONSTEXPR ModSramEntryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  InsertActionResp(const InsertActionResp& from);
-  InsertActionResp(InsertActionResp&& from) noexcept
-    : InsertActionResp() {
+  ModSramEntryReq(const ModSramEntryReq& from);
+  ModSramEntryReq(ModSramEntryReq&& from) noexcept
+    : ModSramEntryReq() {
     *this = ::std::move(from);
   }
 
-  inline InsertActionResp& operator=(const InsertActionResp& from) {
+  inline ModSramEntryReq& operator=(const ModSramEntryReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline InsertActionResp& operator=(InsertActionResp&& from) noexcept {
+  inline ModSramEntryReq& operator=(ModSramEntryReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -8600,20 +8874,20 @@ class InsertActionResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const InsertActionResp& default_instance() {
+  static const ModSramEntryReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const InsertActionResp* internal_default_instance() {
-    return reinterpret_cast<const InsertActionResp*>(
-               &_InsertActionResp_default_instance_);
+  static inline const ModSramEntryReq* internal_default_instance() {
+    return reinterpret_cast<const ModSramEntryReq*>(
+               &_ModSramEntryReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     47;
 
-  friend void swap(InsertActionResp& a, InsertActionResp& b) {
+  friend void swap(ModSramEntryReq& a, ModSramEntryReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(InsertActionResp* other) {
+  inline void Swap(ModSramEntryReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -8626,7 +8900,7 @@ class InsertActionResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(InsertActionResp* other) {
+  void UnsafeArenaSwap(ModSramEntryReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -8634,14 +8908,14 @@ class InsertActionResp final :
 
   // implements Message ----------------------------------------------
 
-  InsertActionResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<InsertActionResp>(arena);
+  ModSramEntryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ModSramEntryReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const InsertActionResp& from);
+  void CopyFrom(const ModSramEntryReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const InsertActionResp& from) {
-    InsertActionResp::MergeImpl(*this, from);
+  void MergeFrom( const ModSramEntryReq& from) {
+    ModSramEntryReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -8659,15 +8933,15 @@ class InsertActionResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(InsertActionResp* other);
+  void InternalSwap(ModSramEntryReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.InsertActionResp";
+    return "rp4.ModSramEntryReq";
   }
   protected:
-  explicit InsertActionResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ModSramEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -8681,18 +8955,78 @@ class InsertActionResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kKeyFieldNumber = 3,
+    kValueFieldNumber = 4,
+    kProcIdFieldNumber = 1,
+    kMatcherIdFieldNumber = 2,
+    kKeyByteLenFieldNumber = 5,
+    kValueByteLenFieldNumber = 6,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
-  private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  // bytes key = 3;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.InsertActionResp)
+  // bytes value = 4;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
+  private:
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
+  public:
+
+  // int32 matcherId = 2;
+  void clear_matcherid();
+  int32_t matcherid() const;
+  void set_matcherid(int32_t value);
+  private:
+  int32_t _internal_matcherid() const;
+  void _internal_set_matcherid(int32_t value);
+  public:
+
+  // int32 key_byte_len = 5;
+  void clear_key_byte_len();
+  int32_t key_byte_len() const;
+  void set_key_byte_len(int32_t value);
+  private:
+  int32_t _internal_key_byte_len() const;
+  void _internal_set_key_byte_len(int32_t value);
+  public:
+
+  // int32 value_byte_len = 6;
+  void clear_value_byte_len();
+  int32_t value_byte_len() const;
+  void set_value_byte_len(int32_t value);
+  private:
+  int32_t _internal_value_byte_len() const;
+  void _internal_set_value_byte_len(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.ModSramEntryReq)
  private:
   class _Internal;
 
@@ -8700,7 +9034,12 @@ class InsertActionResp final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t procid_;
+    int32_t matcherid_;
+    int32_t key_byte_len_;
+    int32_t value_byte_len_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -8708,24 +9047,24 @@ class InsertActionResp final :
 };
 // -------------------------------------------------------------------
 
-class ClearActionReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearActionReq) */ {
+class ModSramEntryResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ModSramEntryResp) */ {
  public:
-  inline ClearActionReq() : ClearActionReq(nullptr) {}
-  ~ClearActionReq() override;
-  explicit PROTOBUF_CONSTEXPR ClearActionReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ModSramEntryResp() : ModSramEntryResp(nullptr) {}
+  ~ModSramEntryResp() override;
+  explicit PROTOBUF_CONSTEXPR ModSramEntryResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearActionReq(const ClearActionReq& from);
-  ClearActionReq(ClearActionReq&& from) noexcept
-    : ClearActionReq() {
+  ModSramEntryResp(const ModSramEntryResp& from);
+  ModSramEntryResp(ModSramEntryResp&& from) noexcept
+    : ModSramEntryResp() {
     *this = ::std::move(from);
   }
 
-  inline ClearActionReq& operator=(const ClearActionReq& from) {
+  inline ModSramEntryResp& operator=(const ModSramEntryResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearActionReq& operator=(ClearActionReq&& from) noexcept {
+  inline ModSramEntryResp& operator=(ModSramEntryResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -8748,20 +9087,20 @@ class ClearActionReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearActionReq& default_instance() {
+  static const ModSramEntryResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearActionReq* internal_default_instance() {
-    return reinterpret_cast<const ClearActionReq*>(
-               &_ClearActionReq_default_instance_);
+  static inline const ModSramEntryResp* internal_default_instance() {
+    return reinterpret_cast<const ModSramEntryResp*>(
+               &_ModSramEntryResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     48;
 
-  friend void swap(ClearActionReq& a, ClearActionReq& b) {
+  friend void swap(ModSramEntryResp& a, ModSramEntryResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearActionReq* other) {
+  inline void Swap(ModSramEntryResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -8774,7 +9113,7 @@ class ClearActionReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearActionReq* other) {
+  void UnsafeArenaSwap(ModSramEntryResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -8782,14 +9121,14 @@ class ClearActionReq final :
 
   // implements Message ----------------------------------------------
 
-  ClearActionReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearActionReq>(arena);
+  ModSramEntryResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ModSramEntryResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClearActionReq& from);
+  void CopyFrom(const ModSramEntryResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ClearActionReq& from) {
-    ClearActionReq::MergeImpl(*this, from);
+  void MergeFrom( const ModSramEntryResp& from) {
+    ModSramEntryResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -8807,15 +9146,15 @@ class ClearActionReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClearActionReq* other);
+  void InternalSwap(ModSramEntryResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearActionReq";
+    return "rp4.ModSramEntryResp";
   }
   protected:
-  explicit ClearActionReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ModSramEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -8829,18 +9168,18 @@ class ClearActionReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kProcIdFieldNumber = 1,
+    kResFieldNumber = 1,
   };
-  // int32 procId = 1;
-  void clear_procid();
-  int32_t procid() const;
-  void set_procid(int32_t value);
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  int32_t _internal_procid() const;
-  void _internal_set_procid(int32_t value);
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearActionReq)
+  // @@protoc_insertion_point(class_scope:rp4.ModSramEntryResp)
  private:
   class _Internal;
 
@@ -8848,7 +9187,7 @@ class ClearActionReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t procid_;
+    int res_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -8856,24 +9195,24 @@ class ClearActionReq final :
 };
 // -------------------------------------------------------------------
 
-class ClearActionResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearActionResp) */ {
+class DelSramEntryReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.DelSramEntryReq) */ {
  public:
-  inline ClearActionResp() : ClearActionResp(nullptr) {}
-  ~ClearActionResp() override;
-  explicit PROTOBUF_CONSTEXPR ClearActionResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline DelSramEntryReq() : DelSramEntryReq(nullptr) {}
+  ~DelSramEntryReq() override;
+  explicit PROTOBUF_CONSTEXPR DelSramEntryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearActionResp(const ClearActionResp& from);
-  ClearActionResp(ClearActionResp&& from) noexcept
-    : ClearActionResp() {
+  DelSramEntryReq(const DelSramEntryReq& from);
+  DelSramEntryReq(DelSramEntryReq&& from) noexcept
+    : DelSramEntryReq() {
     *this = ::std::move(from);
   }
 
-  inline ClearActionResp& operator=(const ClearActionResp& from) {
+  inline DelSramEntryReq& operator=(const DelSramEntryReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearActionResp& operator=(ClearActionResp&& from) noexcept {
+  inline DelSramEntryReq& operator=(DelSramEntryReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -8896,20 +9235,20 @@ class ClearActionResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearActionResp& default_instance() {
+  static const DelSramEntryReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearActionResp* internal_default_instance() {
-    return reinterpret_cast<const ClearActionResp*>(
-               &_ClearActionResp_default_instance_);
+  static inline const DelSramEntryReq* internal_default_instance() {
+    return reinterpret_cast<const DelSramEntryReq*>(
+               &_DelSramEntryReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     49;
 
-  friend void swap(ClearActionResp& a, ClearActionResp& b) {
+  friend void swap(DelSramEntryReq& a, DelSramEntryReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearActionResp* other) {
+  inline void Swap(DelSramEntryReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -8922,7 +9261,7 @@ class ClearActionResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearActionResp* other) {
+  void UnsafeArenaSwap(DelSramEntryReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -8930,14 +9269,14 @@ class ClearActionResp final :
 
   // implements Message ----------------------------------------------
 
-  ClearActionResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearActionResp>(arena);
+  DelSramEntryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DelSramEntryReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClearActionResp& from);
+  void CopyFrom(const DelSramEntryReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ClearActionResp& from) {
-    ClearActionResp::MergeImpl(*this, from);
+  void MergeFrom( const DelSramEntryReq& from) {
+    DelSramEntryReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -8955,15 +9294,15 @@ class ClearActionResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClearActionResp* other);
+  void InternalSwap(DelSramEntryReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearActionResp";
+    return "rp4.DelSramEntryReq";
   }
   protected:
-  explicit ClearActionResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit DelSramEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -8977,18 +9316,53 @@ class ClearActionResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kKeyFieldNumber = 3,
+    kProcIdFieldNumber = 1,
+    kMatcherIdFieldNumber = 2,
+    kKeyByteLenFieldNumber = 4,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
+  // bytes key = 3;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
   private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearActionResp)
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
+  private:
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
+  public:
+
+  // int32 matcherId = 2;
+  void clear_matcherid();
+  int32_t matcherid() const;
+  void set_matcherid(int32_t value);
+  private:
+  int32_t _internal_matcherid() const;
+  void _internal_set_matcherid(int32_t value);
+  public:
+
+  // int32 key_byte_len = 4;
+  void clear_key_byte_len();
+  int32_t key_byte_len() const;
+  void set_key_byte_len(int32_t value);
+  private:
+  int32_t _internal_key_byte_len() const;
+  void _internal_set_key_byte_len(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.DelSramEntryReq)
  private:
   class _Internal;
 
@@ -8996,7 +9370,10 @@ class ClearActionResp final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    int32_t procid_;
+    int32_t matcherid_;
+    int32_t key_byte_len_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -9004,24 +9381,24 @@ class ClearActionResp final :
 };
 // -------------------------------------------------------------------
 
-class DelActionReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.DelActionReq) */ {
+class DelSramEntryResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.DelSramEntryResp) */ {
  public:
-  inline DelActionReq() : DelActionReq(nullptr) {}
-  ~DelActionReq() override;
-  explicit PROTOBUF_CONSTEXPR DelActionReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline DelSramEntryResp() : DelSramEntryResp(nullptr) {}
+  ~DelSramEntryResp() override;
+  explicit PROTOBUF_CONSTEXPR DelSramEntryResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  DelActionReq(const DelActionReq& from);
-  DelActionReq(DelActionReq&& from) noexcept
-    : DelActionReq() {
+  DelSramEntryResp(const DelSramEntryResp& from);
+  DelSramEntryResp(DelSramEntryResp&& from) noexcept
+    : DelSramEntryResp() {
     *this = ::std::move(from);
   }
 
-  inline DelActionReq& operator=(const DelActionReq& from) {
+  inline DelSramEntryResp& operator=(const DelSramEntryResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline DelActionReq& operator=(DelActionReq&& from) noexcept {
+  inline DelSramEntryResp& operator=(DelSramEntryResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -9044,20 +9421,20 @@ class DelActionReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const DelActionReq& default_instance() {
+  static const DelSramEntryResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const DelActionReq* internal_default_instance() {
-    return reinterpret_cast<const DelActionReq*>(
-               &_DelActionReq_default_instance_);
+  static inline const DelSramEntryResp* internal_default_instance() {
+    return reinterpret_cast<const DelSramEntryResp*>(
+               &_DelSramEntryResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     50;
 
-  friend void swap(DelActionReq& a, DelActionReq& b) {
+  friend void swap(DelSramEntryResp& a, DelSramEntryResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(DelActionReq* other) {
+  inline void Swap(DelSramEntryResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -9070,7 +9447,7 @@ class DelActionReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(DelActionReq* other) {
+  void UnsafeArenaSwap(DelSramEntryResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -9078,14 +9455,14 @@ class DelActionReq final :
 
   // implements Message ----------------------------------------------
 
-  DelActionReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<DelActionReq>(arena);
+  DelSramEntryResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DelSramEntryResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const DelActionReq& from);
+  void CopyFrom(const DelSramEntryResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const DelActionReq& from) {
-    DelActionReq::MergeImpl(*this, from);
+  void MergeFrom( const DelSramEntryResp& from) {
+    DelSramEntryResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -9103,15 +9480,15 @@ class DelActionReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(DelActionReq* other);
+  void InternalSwap(DelSramEntryResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.DelActionReq";
+    return "rp4.DelSramEntryResp";
   }
   protected:
-  explicit DelActionReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit DelSramEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -9125,28 +9502,28 @@ class DelActionReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kProcIdFieldNumber = 1,
-    kActionIdFieldNumber = 2,
+    kResFieldNumber = 1,
+    kOccupancyFieldNumber = 2,
   };
-  // int32 procId = 1;
-  void clear_procid();
-  int32_t procid() const;
-  void set_procid(int32_t value);
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  int32_t _internal_procid() const;
-  void _internal_set_procid(int32_t value);
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
 
-  // int32 actionId = 2;
-  void clear_actionid();
-  int32_t actionid() const;
-  void set_actionid(int32_t value);
+  // int32 occupancy = 2;
+  void clear_occupancy();
+  int32_t occupancy() const;
+  void set_occupancy(int32_t value);
   private:
-  int32_t _internal_actionid() const;
-  void _internal_set_actionid(int32_t value);
+  int32_t _internal_occupancy() const;
+  void _internal_set_occupancy(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.DelActionReq)
+  // @@protoc_insertion_point(class_scope:rp4.DelSramEntryResp)
  private:
   class _Internal;
 
@@ -9154,8 +9531,8 @@ class DelActionReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t procid_;
-    int32_t actionid_;
+    int res_;
+    int32_t occupancy_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -9163,24 +9540,24 @@ class DelActionReq final :
 };
 // -------------------------------------------------------------------
 
-class DelActionResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.DelActionResp) */ {
+class ModTcamEntryReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ModTcamEntryReq) */ {
  public:
-  inline DelActionResp() : DelActionResp(nullptr) {}
-  ~DelActionResp() override;
-  explicit PROTOBUF_CONSTEXPR DelActionResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ModTcamEntryReq() : ModTcamEntryReq(nullptr) {}
+  ~ModTcamEntryReq() override;
+  explicit PROTOBUF_CONSTEXPR ModTcamEntryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  DelActionResp(const DelActionResp& from);
-  DelActionResp(DelActionResp&& from) noexcept
-    : DelActionResp() {
+  ModTcamEntryReq(const ModTcamEntryReq& from);
+  ModTcamEntryReq(ModTcamEntryReq&& from) noexcept
+    : ModTcamEntryReq() {
     *this = ::std::move(from);
   }
 
-  inline DelActionResp& operator=(const DelActionResp& from) {
+  inline ModTcamEntryReq& operator=(const ModTcamEntryReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline DelActionResp& operator=(DelActionResp&& from) noexcept {
+  inline ModTcamEntryReq& operator=(ModTcamEntryReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -9203,20 +9580,20 @@ class DelActionResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const DelActionResp& default_instance() {
+  static const ModTcamEntryReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const DelActionResp* internal_default_instance() {
-    return reinterpret_cast<const DelActionResp*>(
-               &_DelActionResp_default_instance_);
+  static inline const ModTcamEntryReq* internal_default_instance() {
+    return reinterpret_cast<const ModTcamEntryReq*>(
+               &_ModTcamEntryReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     51;
 
-  friend void swap(DelActionResp& a, DelActionResp& b) {
+  friend void swap(ModTcamEntryReq& a, ModTcamEntryReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(DelActionResp* other) {
+  inline void Swap(ModTcamEntryReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -9229,7 +9606,7 @@ class DelActionResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(DelActionResp* other) {
+  void UnsafeArenaSwap(ModTcamEntryReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -9237,14 +9614,14 @@ class DelActionResp final :
 
   // implements Message ----------------------------------------------
 
-  DelActionResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<DelActionResp>(arena);
+  ModTcamEntryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ModTcamEntryReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const DelActionResp& from);
+  void CopyFrom(const ModTcamEntryReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const DelActionResp& from) {
-    DelActionResp::MergeImpl(*this, from);
+  void MergeFrom( const ModTcamEntryReq& from) {
+    ModTcamEntryReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -9262,15 +9639,15 @@ class DelActionResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(DelActionResp* other);
+  void InternalSwap(ModTcamEntryReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.DelActionResp";
+    return "rp4.ModTcamEntryReq";
   }
   protected:
-  explicit DelActionResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ModTcamEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -9284,18 +9661,93 @@ class DelActionResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kKeyFieldNumber = 3,
+    kMaskFieldNumber = 4,
+    kValueFieldNumber = 5,
+    kProcIdFieldNumber = 1,
+    kMatcherIdFieldNumber = 2,
+    kKeyByteLenFieldNumber = 6,
+    kValueByteLenFieldNumber = 7,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
+  // bytes key = 3;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
   private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.DelActionResp)
+  // bytes mask = 4;
+  void clear_mask();
+  const std::string& mask() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_mask(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_mask();
+  PROTOBUF_NODISCARD std::string* release_mask();
+  void set_allocated_mask(std::string* mask);
+  private:
+  const std::string& _internal_mask() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mask(const std::string& value);
+  std::string* _internal_mutable_mask();
+  public:
+
+  // bytes value = 5;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
+  private:
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
+  public:
+
+  // int32 matcherId = 2;
+  void clear_matcherid();
+  int32_t matcherid() const;
+  void set_matcherid(int32_t value);
+  private:
+  int32_t _internal_matcherid() const;
+  void _internal_set_matcherid(int32_t value);
+  public:
+
+  // int32 key_byte_len = 6;
+  void clear_key_byte_len();
+  int32_t key_byte_len() const;
+  void set_key_byte_len(int32_t value);
+  private:
+  int32_t _internal_key_byte_len() const;
+  void _internal_set_key_byte_len(int32_t value);
+  public:
+
+  // int32 value_byte_len = 7;
+  void clear_value_byte_len();
+  int32_t value_byte_len() const;
+  void set_value_byte_len(int32_t value);
+  private:
+  int32_t _internal_value_byte_len() const;
+  void _internal_set_value_byte_len(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.ModTcamEntryReq)
  private:
   class _Internal;
 
@@ -9303,7 +9755,13 @@ class DelActionResp final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mask_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t procid_;
+    int32_t matcherid_;
+    int32_t key_byte_len_;
+    int32_t value_byte_len_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -9311,24 +9769,24 @@ class DelActionResp final :
 };
 // -------------------------------------------------------------------
 
-class SigmoidPoint final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SigmoidPoint) */ {
+class ModTcamEntryResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ModTcamEntryResp) */ {
  public:
-  inline SigmoidPoint() : SigmoidPoint(nullptr) {}
-  ~SigmoidPoint() override;
-  explicit PROTOBUF_CONSTEXPR SigmoidPoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ModTcamEntryResp() : ModTcamEntryResp(nullptr) {}
+  ~ModTcamEntryResp() override;
+  explicit PROTOBUF_CONSTEXPR ModTcamEntryResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SigmoidPoint(const SigmoidPoint& from);
-  SigmoidPoint(SigmoidPoint&& from) noexcept
-    : SigmoidPoint() {
+  ModTcamEntryResp(const ModTcamEntryResp& from);
+  ModTcamEntryResp(ModTcamEntryResp&& from) noexcept
+    : ModTcamEntryResp() {
     *this = ::std::move(from);
   }
 
-  inline SigmoidPoint& operator=(const SigmoidPoint& from) {
+  inline ModTcamEntryResp& operator=(const ModTcamEntryResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SigmoidPoint& operator=(SigmoidPoint&& from) noexcept {
+  inline ModTcamEntryResp& operator=(ModTcamEntryResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -9351,20 +9809,20 @@ class SigmoidPoint final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SigmoidPoint& default_instance() {
+  static const ModTcamEntryResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SigmoidPoint* internal_default_instance() {
-    return reinterpret_cast<const SigmoidPoint*>(
-               &_SigmoidPoint_default_instance_);
+  static inline const ModTcamEntryResp* internal_default_instance() {
+    return reinterpret_cast<const ModTcamEntryResp*>(
+               &_ModTcamEntryResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     52;
 
-  friend void swap(SigmoidPoint& a, SigmoidPoint& b) {
+  friend void swap(ModTcamEntryResp& a, ModTcamEntryResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(SigmoidPoint* other) {
+  inline void Swap(ModTcamEntryResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -9377,7 +9835,7 @@ class SigmoidPoint final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SigmoidPoint* other) {
+  void UnsafeArenaSwap(ModTcamEntryResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -9385,14 +9843,14 @@ class SigmoidPoint final :
 
   // implements Message ----------------------------------------------
 
-  SigmoidPoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SigmoidPoint>(arena);
+  ModTcamEntryResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ModTcamEntryResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SigmoidPoint& from);
+  void CopyFrom(const ModTcamEntryResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SigmoidPoint& from) {
-    SigmoidPoint::MergeImpl(*this, from);
+  void MergeFrom( const ModTcamEntryResp& from) {
+    ModTcamEntryResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -9410,15 +9868,15 @@ class SigmoidPoint final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SigmoidPoint* other);
+  void InternalSwap(ModTcamEntryResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.SigmoidPoint";
+    return "rp4.ModTcamEntryResp";
   }
   protected:
-  explicit SigmoidPoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ModTcamEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -9432,28 +9890,18 @@ class SigmoidPoint final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kInputFieldNumber = 1,
-    kValueFieldNumber = 2,
+    kResFieldNumber = 1,
   };
-  // int32 input = 1;
-  void clear_input();
-  int32_t input() const;
-  void set_input(int32_t value);
-  private:
-  int32_t _internal_input() const;
-  void _internal_set_input(int32_t value);
-  public:
-
-  // uint32 value = 2;
-  void clear_value();
-  uint32_t value() const;
-  void set_value(uint32_t value);
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  uint32_t _internal_value() const;
-  void _internal_set_value(uint32_t value);
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.SigmoidPoint)
+  // @@protoc_insertion_point(class_scope:rp4.ModTcamEntryResp)
  private:
   class _Internal;
 
@@ -9461,8 +9909,7 @@ class SigmoidPoint final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t input_;
-    uint32_t value_;
+    int res_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -9470,24 +9917,24 @@ class SigmoidPoint final :
 };
 // -------------------------------------------------------------------
 
-class LoadSigmoidTableReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.LoadSigmoidTableReq) */ {
+class DelTcamEntryReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.DelTcamEntryReq) */ {
  public:
-  inline LoadSigmoidTableReq() : LoadSigmoidTableReq(nullptr) {}
-  ~LoadSigmoidTableReq() override;
-  explicit PROTOBUF_CONSTEXPR LoadSigmoidTableReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline DelTcamEntryReq() : DelTcamEntryReq(nullptr) {}
+  ~DelTcamEntryReq() override;
+  explicit PROTOBUF_CONSTEXPR DelTcamEntryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LoadSigmoidTableReq(const LoadSigmoidTableReq& from);
-  LoadSigmoidTableReq(LoadSigmoidTableReq&& from) noexcept
-    : LoadSigmoidTableReq() {
+  DelTcamEntryReq(const DelTcamEntryReq& from);
+  DelTcamEntryReq(DelTcamEntryReq&& from) noexcept
+    : DelTcamEntryReq() {
     *this = ::std::move(from);
   }
 
-  inline LoadSigmoidTableReq& operator=(const LoadSigmoidTableReq& from) {
+  inline DelTcamEntryReq& operator=(const DelTcamEntryReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline LoadSigmoidTableReq& operator=(LoadSigmoidTableReq&& from) noexcept {
+  inline DelTcamEntryReq& operator=(DelTcamEntryReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -9510,20 +9957,20 @@ class LoadSigmoidTableReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const LoadSigmoidTableReq& default_instance() {
+  static const DelTcamEntryReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const LoadSigmoidTableReq* internal_default_instance() {
-    return reinterpret_cast<const LoadSigmoidTableReq*>(
-               &_LoadSigmoidTableReq_default_instance_);
+  static inline const DelTcamEntryReq* internal_default_instance() {
+    return reinterpret_cast<const DelTcamEntryReq*>(
+               &_DelTcamEntryReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     53;
 
-  friend void swap(LoadSigmoidTableReq& a, LoadSigmoidTableReq& b) {
+  friend void swap(DelTcamEntryReq& a, DelTcamEntryReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(LoadSigmoidTableReq* other) {
+  inline void Swap(DelTcamEntryReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -9536,7 +9983,7 @@ class LoadSigmoidTableReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(LoadSigmoidTableReq* other) {
+  void UnsafeArenaSwap(DelTcamEntryReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -9544,14 +9991,14 @@ class LoadSigmoidTableReq final :
 
   // implements Message ----------------------------------------------
 
-  LoadSigmoidTableReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<LoadSigmoidTableReq>(arena);
+  DelTcamEntryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DelTcamEntryReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const LoadSigmoidTableReq& from);
+  void CopyFrom(const DelTcamEntryReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const LoadSigmoidTableReq& from) {
-    LoadSigmoidTableReq::MergeImpl(*this, from);
+  void MergeFrom( const DelTcamEntryReq& from) {
+    DelTcamEntryReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -9569,15 +10016,15 @@ class LoadSigmoidTableReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(LoadSigmoidTableReq* other);
+  void InternalSwap(DelTcamEntryReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.LoadSigmoidTableReq";
+    return "rp4.DelTcamEntryReq";
   }
   protected:
-  explicit LoadSigmoidTableReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit DelTcamEntryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -9591,47 +10038,68 @@ class LoadSigmoidTableReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPointsFieldNumber = 1,
-    kValueBitwidthFieldNumber = 2,
-    kInputMultiplierFieldNumber = 3,
+    kKeyFieldNumber = 3,
+    kMaskFieldNumber = 4,
+    kProcIdFieldNumber = 1,
+    kMatcherIdFieldNumber = 2,
+    kKeyByteLenFieldNumber = 5,
   };
-  // repeated .rp4.SigmoidPoint points = 1;
-  int points_size() const;
+  // bytes key = 3;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
   private:
-  int _internal_points_size() const;
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
   public:
-  void clear_points();
-  ::rp4::SigmoidPoint* mutable_points(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::SigmoidPoint >*
-      mutable_points();
+
+  // bytes mask = 4;
+  void clear_mask();
+  const std::string& mask() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_mask(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_mask();
+  PROTOBUF_NODISCARD std::string* release_mask();
+  void set_allocated_mask(std::string* mask);
   private:
-  const ::rp4::SigmoidPoint& _internal_points(int index) const;
-  ::rp4::SigmoidPoint* _internal_add_points();
+  const std::string& _internal_mask() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mask(const std::string& value);
+  std::string* _internal_mutable_mask();
   public:
-  const ::rp4::SigmoidPoint& points(int index) const;
-  ::rp4::SigmoidPoint* add_points();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::SigmoidPoint >&
-      points() const;
 
-  // int32 value_bitwidth = 2;
-  void clear_value_bitwidth();
-  int32_t value_bitwidth() const;
-  void set_value_bitwidth(int32_t value);
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
   private:
-  int32_t _internal_value_bitwidth() const;
-  void _internal_set_value_bitwidth(int32_t value);
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
   public:
 
-  // uint32 inputMultiplier = 3;
-  void clear_inputmultiplier();
-  uint32_t inputmultiplier() const;
-  void set_inputmultiplier(uint32_t value);
+  // int32 matcherId = 2;
+  void clear_matcherid();
+  int32_t matcherid() const;
+  void set_matcherid(int32_t value);
   private:
-  uint32_t _internal_inputmultiplier() const;
-  void _internal_set_inputmultiplier(uint32_t value);
+  int32_t _internal_matcherid() const;
+  void _internal_set_matcherid(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.LoadSigmoidTableReq)
+  // int32 key_byte_len = 5;
+  void clear_key_byte_len();
+  int32_t key_byte_len() const;
+  void set_key_byte_len(int32_t value);
+  private:
+  int32_t _internal_key_byte_len() const;
+  void _internal_set_key_byte_len(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.DelTcamEntryReq)
  private:
   class _Internal;
 
@@ -9639,9 +10107,11 @@ class LoadSigmoidTableReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::SigmoidPoint > points_;
-    int32_t value_bitwidth_;
-    uint32_t inputmultiplier_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mask_;
+    int32_t procid_;
+    int32_t matcherid_;
+    int32_t key_byte_len_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -9649,24 +10119,24 @@ class LoadSigmoidTableReq final :
 };
 // -------------------------------------------------------------------
 
-class LoadSigmoidTableResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.LoadSigmoidTableResp) */ {
+class DelTcamEntryResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.DelTcamEntryResp) */ {
  public:
-  inline LoadSigmoidTableResp() : LoadSigmoidTableResp(nullptr) {}
-  ~LoadSigmoidTableResp() override;
-  explicit PROTOBUF_CONSTEXPR LoadSigmoidTableResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline DelTcamEntryResp() : DelTcamEntryResp(nullptr) {}
+  ~DelTcamEntryResp() override;
+  explicit PROTOBUF_CONSTEXPR DelTcamEntryResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LoadSigmoidTableResp(const LoadSigmoidTableResp& from);
-  LoadSigmoidTableResp(LoadSigmoidTableResp&& from) noexcept
-    : LoadSigmoidTableResp() {
+  DelTcamEntryResp(const DelTcamEntryResp& from);
+  DelTcamEntryResp(DelTcamEntryResp&& from) noexcept
+    : DelTcamEntryResp() {
     *this = ::std::move(from);
   }
 
-  inline LoadSigmoidTableResp& operator=(const LoadSigmoidTableResp& from) {
+  inline DelTcamEntryResp& operator=(const DelTcamEntryResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline LoadSigmoidTableResp& operator=(LoadSigmoidTableResp&& from) noexcept {
+  inline DelTcamEntryResp& operator=(DelTcamEntryResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -9689,20 +10159,20 @@ class LoadSigmoidTableResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const LoadSigmoidTableResp& default_instance() {
+  static const DelTcamEntryResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const LoadSigmoidTableResp* internal_default_instance() {
-    return reinterpret_cast<const LoadSigmoidTableResp*>(
-               &_LoadSigmoidTableResp_default_instance_);
+  static inline const DelTcamEntryResp* internal_default_instance() {
+    return reinterpret_cast<const DelTcamEntryResp*>(
+               &_DelTcamEntryResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     54;
 
-  friend void swap(LoadSigmoidTableResp& a, LoadSigmoidTableResp& b) {
+  friend void swap(DelTcamEntryResp& a, DelTcamEntryResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(LoadSigmoidTableResp* other) {
+  inline void Swap(DelTcamEntryResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -9715,7 +10185,7 @@ class LoadSigmoidTableResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(LoadSigmoidTableResp* other) {
+  void UnsafeArenaSwap(DelTcamEntryResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -9723,14 +10193,14 @@ class LoadSigmoidTableResp final :
 
   // implements Message ----------------------------------------------
 
-  LoadSigmoidTableResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<LoadSigmoidTableResp>(arena);
+  DelTcamEntryResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DelTcamEntryResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const LoadSigmoidTableResp& from);
+  void CopyFrom(const DelTcamEntryResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const LoadSigmoidTableResp& from) {
-    LoadSigmoidTableResp::MergeImpl(*this, from);
+  void MergeFrom( const DelTcamEntryResp& from) {
+    DelTcamEntryResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -9748,15 +10218,15 @@ class LoadSigmoidTableResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(LoadSigmoidTableResp* other);
+  void InternalSwap(DelTcamEntryResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.LoadSigmoidTableResp";
+    return "rp4.DelTcamEntryResp";
   }
   protected:
-  explicit LoadSigmoidTableResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit DelTcamEntryResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -9781,7 +10251,7 @@ class LoadSigmoidTableResp final :
   void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.LoadSigmoidTableResp)
+  // @@protoc_insertion_point(class_scope:rp4.DelTcamEntryResp)
  private:
   class _Internal;
 
@@ -9797,23 +10267,24 @@ class LoadSigmoidTableResp final :
 };
 // -------------------------------------------------------------------
 
-class ClearSigmoidTableReq final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:rp4.ClearSigmoidTableReq) */ {
+class InsertEntriesReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertEntriesReq) */ {
  public:
-  inline ClearSigmoidTableReq() : ClearSigmoidTableReq(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR ClearSigmoidTableReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline InsertEntriesReq() : InsertEntriesReq(nullptr) {}
+  ~InsertEntriesReq() override;
+  explicit PROTOBUF_CONSTEXPR InsertEntriesReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearSigmoidTableReq(const ClearSigmoidTableReq& from);
-  ClearSigmoidTableReq(ClearSigmoidTableReq&& from) noexcept
-    : ClearSigmoidTableReq() {
+  InsertEntriesReq(const InsertEntriesReq& from);
+  InsertEntriesReq(InsertEntriesReq&& from) noexcept
+    : InsertEntriesReq() {
     *this = ::std::move(from);
   }
 
-  inline ClearSigmoidTableReq& operator=(const ClearSigmoidTableReq& from) {
+  inline InsertEntriesReq& operator=(const InsertEntriesReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearSigmoidTableReq& operator=(ClearSigmoidTableReq&& from) noexcept {
+  inline InsertEntriesReq& operator=(InsertEntriesReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -9836,20 +10307,20 @@ class ClearSigmoidTableReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearSigmoidTableReq& default_instance() {
+  static const InsertEntriesReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearSigmoidTableReq* internal_default_instance() {
-    return reinterpret_cast<const ClearSigmoidTableReq*>(
-               &_ClearSigmoidTableReq_default_instance_);
+  static inline const InsertEntriesReq* internal_default_instance() {
+    return reinterpret_cast<const InsertEntriesReq*>(
+               &_InsertEntriesReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     55;
 
-  friend void swap(ClearSigmoidTableReq& a, ClearSigmoidTableReq& b) {
+  friend void swap(InsertEntriesReq& a, InsertEntriesReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearSigmoidTableReq* other) {
+  inline void Swap(InsertEntriesReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -9862,7 +10333,7 @@ class ClearSigmoidTableReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearSigmoidTableReq* other) {
+  void UnsafeArenaSwap(InsertEntriesReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -9870,26 +10341,40 @@ class ClearSigmoidTableReq final :
 
   // implements Message ----------------------------------------------
 
-  ClearSigmoidTableReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearSigmoidTableReq>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const ClearSigmoidTableReq& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  InsertEntriesReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InsertEntriesReq>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const ClearSigmoidTableReq& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InsertEntriesReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InsertEntriesReq& from) {
+    InsertEntriesReq::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InsertEntriesReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearSigmoidTableReq";
+    return "rp4.InsertEntriesReq";
   }
   protected:
-  explicit ClearSigmoidTableReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit InsertEntriesReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -9902,7 +10387,74 @@ class ClearSigmoidTableReq final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearSigmoidTableReq)
+  enum : int {
+    kEntriesFieldNumber = 6,
+    kProcIdFieldNumber = 1,
+    kMatcherIdFieldNumber = 2,
+    kTernaryFieldNumber = 3,
+    kKeyByteLenFieldNumber = 4,
+    kValueByteLenFieldNumber = 5,
+  };
+  // bytes entries = 6;
+  void clear_entries();
+  const std::string& entries() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_entries(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_entries();
+  PROTOBUF_NODISCARD std::string* release_entries();
+  void set_allocated_entries(std::string* entries);
+  private:
+  const std::string& _internal_entries() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_entries(const std::string& value);
+  std::string* _internal_mutable_entries();
+  public:
+
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
+  private:
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
+  public:
+
+  // int32 matcherId = 2;
+  void clear_matcherid();
+  int32_t matcherid() const;
+  void set_matcherid(int32_t value);
+  private:
+  int32_t _internal_matcherid() const;
+  void _internal_set_matcherid(int32_t value);
+  public:
+
+  // bool ternary = 3;
+  void clear_ternary();
+  bool ternary() const;
+  void set_ternary(bool value);
+  private:
+  bool _internal_ternary() const;
+  void _internal_set_ternary(bool value);
+  public:
+
+  // int32 key_byte_len = 4;
+  void clear_key_byte_len();
+  int32_t key_byte_len() const;
+  void set_key_byte_len(int32_t value);
+  private:
+  int32_t _internal_key_byte_len() const;
+  void _internal_set_key_byte_len(int32_t value);
+  public:
+
+  // int32 value_byte_len = 5;
+  void clear_value_byte_len();
+  int32_t value_byte_len() const;
+  void set_value_byte_len(int32_t value);
+  private:
+  int32_t _internal_value_byte_len() const;
+  void _internal_set_value_byte_len(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.InsertEntriesReq)
  private:
   class _Internal;
 
@@ -9910,29 +10462,37 @@ class ClearSigmoidTableReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr entries_;
+    int32_t procid_;
+    int32_t matcherid_;
+    bool ternary_;
+    int32_t key_byte_len_;
+    int32_t value_byte_len_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ClearSigmoidTableResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearSigmoidTableResp) */ {
+class InsertEntriesResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertEntriesResp) */ {
  public:
-  inline ClearSigmoidTableResp() : ClearSigmoidTableResp(nullptr) {}
-  ~ClearSigmoidTableResp() override;
-  explicit PROTOBUF_CONSTEXPR ClearSigmoidTableResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline InsertEntriesResp() : InsertEntriesResp(nullptr) {}
+  ~InsertEntriesResp() override;
+  explicit PROTOBUF_CONSTEXPR InsertEntriesResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearSigmoidTableResp(const ClearSigmoidTableResp& from);
-  ClearSigmoidTableResp(ClearSigmoidTableResp&& from) noexcept
-    : ClearSigmoidTableResp() {
+  InsertEntriesResp(const InsertEntriesResp& from);
+  InsertEntriesResp(InsertEntriesResp&& from) noexcept
+    : InsertEntriesResp() {
     *this = ::std::move(from);
   }
 
-  inline ClearSigmoidTableResp& operator=(const ClearSigmoidTableResp& from) {
+  inline InsertEntriesResp& operator=(const InsertEntriesResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearSigmoidTableResp& operator=(ClearSigmoidTableResp&& from) noexcept {
+  inline InsertEntriesResp& operator=(InsertEntriesResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -9955,20 +10515,20 @@ class ClearSigmoidTableResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearSigmoidTableResp& default_instance() {
+  static const InsertEntriesResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearSigmoidTableResp* internal_default_instance() {
-    return reinterpret_cast<const ClearSigmoidTableResp*>(
-               &_ClearSigmoidTableResp_default_instance_);
+  static inline const InsertEntriesResp* internal_default_instance() {
+    return reinterpret_cast<const InsertEntriesResp*>(
+               &_InsertEntriesResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     56;
 
-  friend void swap(ClearSigmoidTableResp& a, ClearSigmoidTableResp& b) {
+  friend void swap(InsertEntriesResp& a, InsertEntriesResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearSigmoidTableResp* other) {
+  inline void Swap(InsertEntriesResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -9981,7 +10541,7 @@ class ClearSigmoidTableResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearSigmoidTableResp* other) {
+  void UnsafeArenaSwap(InsertEntriesResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -9989,14 +10549,14 @@ class ClearSigmoidTableResp final :
 
   // implements Message ----------------------------------------------
 
-  ClearSigmoidTableResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearSigmoidTableResp>(arena);
+  InsertEntriesResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InsertEntriesResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClearSigmoidTableResp& from);
+  void CopyFrom(const InsertEntriesResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ClearSigmoidTableResp& from) {
-    ClearSigmoidTableResp::MergeImpl(*this, from);
+  void MergeFrom( const InsertEntriesResp& from) {
+    InsertEntriesResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -10014,15 +10574,15 @@ class ClearSigmoidTableResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClearSigmoidTableResp* other);
+  void InternalSwap(InsertEntriesResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearSigmoidTableResp";
+    return "rp4.InsertEntriesResp";
   }
   protected:
-  explicit ClearSigmoidTableResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit InsertEntriesResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -10037,6 +10597,8 @@ class ClearSigmoidTableResp final :
 
   enum : int {
     kResFieldNumber = 1,
+    kInsertedFieldNumber = 2,
+    kFailedFieldNumber = 3,
   };
   // .rp4.Res res = 1;
   void clear_res();
@@ -10047,7 +10609,25 @@ class ClearSigmoidTableResp final :
   void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearSigmoidTableResp)
+  // int32 inserted = 2;
+  void clear_inserted();
+  int32_t inserted() const;
+  void set_inserted(int32_t value);
+  private:
+  int32_t _internal_inserted() const;
+  void _internal_set_inserted(int32_t value);
+  public:
+
+  // int32 failed = 3;
+  void clear_failed();
+  int32_t failed() const;
+  void set_failed(int32_t value);
+  private:
+  int32_t _internal_failed() const;
+  void _internal_set_failed(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.InsertEntriesResp)
  private:
   class _Internal;
 
@@ -10056,6 +10636,8 @@ class ClearSigmoidTableResp final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     int res_;
+    int32_t inserted_;
+    int32_t failed_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -10063,24 +10645,24 @@ class ClearSigmoidTableResp final :
 };
 // -------------------------------------------------------------------
 
-class ExpPoint final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ExpPoint) */ {
+class ClearOldConfigReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearOldConfigReq) */ {
  public:
-  inline ExpPoint() : ExpPoint(nullptr) {}
-  ~ExpPoint() override;
-  explicit PROTOBUF_CONSTEXPR ExpPoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ClearOldConfigReq() : ClearOldConfigReq(nullptr) {}
+  ~ClearOldConfigReq() override;
+  explicit PROTOBUF_CONSTEXPR ClearOldConfigReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ExpPoint(const ExpPoint& from);
-  ExpPoint(ExpPoint&& from) noexcept
-    : ExpPoint() {
+  ClearOldConfigReq(const ClearOldConfigReq& from);
+  ClearOldConfigReq(ClearOldConfigReq&& from) noexcept
+    : ClearOldConfigReq() {
     *this = ::std::move(from);
   }
 
-  inline ExpPoint& operator=(const ExpPoint& from) {
+  inline ClearOldConfigReq& operator=(const ClearOldConfigReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ExpPoint& operator=(ExpPoint&& from) noexcept {
+  inline ClearOldConfigReq& operator=(ClearOldConfigReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -10103,20 +10685,20 @@ class ExpPoint final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ExpPoint& default_instance() {
+  static const ClearOldConfigReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ExpPoint* internal_default_instance() {
-    return reinterpret_cast<const ExpPoint*>(
-               &_ExpPoint_default_instance_);
+  static inline const ClearOldConfigReq* internal_default_instance() {
+    return reinterpret_cast<const ClearOldConfigReq*>(
+               &_ClearOldConfigReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     57;
 
-  friend void swap(ExpPoint& a, ExpPoint& b) {
+  friend void swap(ClearOldConfigReq& a, ClearOldConfigReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(ExpPoint* other) {
+  inline void Swap(ClearOldConfigReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -10129,7 +10711,7 @@ class ExpPoint final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ExpPoint* other) {
+  void UnsafeArenaSwap(ClearOldConfigReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -10137,14 +10719,14 @@ class ExpPoint final :
 
   // implements Message ----------------------------------------------
 
-  ExpPoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ExpPoint>(arena);
+  ClearOldConfigReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearOldConfigReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ExpPoint& from);
+  void CopyFrom(const ClearOldConfigReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ExpPoint& from) {
-    ExpPoint::MergeImpl(*this, from);
+  void MergeFrom( const ClearOldConfigReq& from) {
+    ClearOldConfigReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -10162,15 +10744,15 @@ class ExpPoint final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ExpPoint* other);
+  void InternalSwap(ClearOldConfigReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ExpPoint";
+    return "rp4.ClearOldConfigReq";
   }
   protected:
-  explicit ExpPoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ClearOldConfigReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -10184,28 +10766,28 @@ class ExpPoint final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kInputFieldNumber = 1,
-    kValueFieldNumber = 2,
+    kProcIdFieldNumber = 1,
+    kMatcherIdFieldNumber = 2,
   };
-  // int32 input = 1;
-  void clear_input();
-  int32_t input() const;
-  void set_input(int32_t value);
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
   private:
-  int32_t _internal_input() const;
-  void _internal_set_input(int32_t value);
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
   public:
 
-  // uint32 value = 2;
-  void clear_value();
-  uint32_t value() const;
-  void set_value(uint32_t value);
+  // int32 matcherId = 2;
+  void clear_matcherid();
+  int32_t matcherid() const;
+  void set_matcherid(int32_t value);
   private:
-  uint32_t _internal_value() const;
-  void _internal_set_value(uint32_t value);
+  int32_t _internal_matcherid() const;
+  void _internal_set_matcherid(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ExpPoint)
+  // @@protoc_insertion_point(class_scope:rp4.ClearOldConfigReq)
  private:
   class _Internal;
 
@@ -10213,8 +10795,8 @@ class ExpPoint final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t input_;
-    uint32_t value_;
+    int32_t procid_;
+    int32_t matcherid_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -10222,24 +10804,24 @@ class ExpPoint final :
 };
 // -------------------------------------------------------------------
 
-class LoadExpTableReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.LoadExpTableReq) */ {
+class ClearOldConfigResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearOldConfigResp) */ {
  public:
-  inline LoadExpTableReq() : LoadExpTableReq(nullptr) {}
-  ~LoadExpTableReq() override;
-  explicit PROTOBUF_CONSTEXPR LoadExpTableReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ClearOldConfigResp() : ClearOldConfigResp(nullptr) {}
+  ~ClearOldConfigResp() override;
+  explicit PROTOBUF_CONSTEXPR ClearOldConfigResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LoadExpTableReq(const LoadExpTableReq& from);
-  LoadExpTableReq(LoadExpTableReq&& from) noexcept
-    : LoadExpTableReq() {
+  ClearOldConfigResp(const ClearOldConfigResp& from);
+  ClearOldConfigResp(ClearOldConfigResp&& from) noexcept
+    : ClearOldConfigResp() {
     *this = ::std::move(from);
   }
 
-  inline LoadExpTableReq& operator=(const LoadExpTableReq& from) {
+  inline ClearOldConfigResp& operator=(const ClearOldConfigResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline LoadExpTableReq& operator=(LoadExpTableReq&& from) noexcept {
+  inline ClearOldConfigResp& operator=(ClearOldConfigResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -10262,20 +10844,20 @@ class LoadExpTableReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const LoadExpTableReq& default_instance() {
+  static const ClearOldConfigResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const LoadExpTableReq* internal_default_instance() {
-    return reinterpret_cast<const LoadExpTableReq*>(
-               &_LoadExpTableReq_default_instance_);
+  static inline const ClearOldConfigResp* internal_default_instance() {
+    return reinterpret_cast<const ClearOldConfigResp*>(
+               &_ClearOldConfigResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     58;
 
-  friend void swap(LoadExpTableReq& a, LoadExpTableReq& b) {
+  friend void swap(ClearOldConfigResp& a, ClearOldConfigResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(LoadExpTableReq* other) {
+  inline void Swap(ClearOldConfigResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -10288,7 +10870,7 @@ class LoadExpTableReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(LoadExpTableReq* other) {
+  void UnsafeArenaSwap(ClearOldConfigResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -10296,14 +10878,14 @@ class LoadExpTableReq final :
 
   // implements Message ----------------------------------------------
 
-  LoadExpTableReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<LoadExpTableReq>(arena);
+  ClearOldConfigResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearOldConfigResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const LoadExpTableReq& from);
+  void CopyFrom(const ClearOldConfigResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const LoadExpTableReq& from) {
-    LoadExpTableReq::MergeImpl(*this, from);
+  void MergeFrom( const ClearOldConfigResp& from) {
+    ClearOldConfigResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -10321,15 +10903,15 @@ class LoadExpTableReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(LoadExpTableReq* other);
+  void InternalSwap(ClearOldConfigResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.LoadExpTableReq";
+    return "rp4.ClearOldConfigResp";
   }
   protected:
-  explicit LoadExpTableReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ClearOldConfigResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -10343,47 +10925,18 @@ class LoadExpTableReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPointsFieldNumber = 1,
-    kInputMultiplierFieldNumber = 2,
-    kValueScaleFieldNumber = 3,
+    kResFieldNumber = 1,
   };
-  // repeated .rp4.ExpPoint points = 1;
-  int points_size() const;
-  private:
-  int _internal_points_size() const;
-  public:
-  void clear_points();
-  ::rp4::ExpPoint* mutable_points(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ExpPoint >*
-      mutable_points();
-  private:
-  const ::rp4::ExpPoint& _internal_points(int index) const;
-  ::rp4::ExpPoint* _internal_add_points();
-  public:
-  const ::rp4::ExpPoint& points(int index) const;
-  ::rp4::ExpPoint* add_points();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ExpPoint >&
-      points() const;
-
-  // uint32 inputMultiplier = 2;
-  void clear_inputmultiplier();
-  uint32_t inputmultiplier() const;
-  void set_inputmultiplier(uint32_t value);
-  private:
-  uint32_t _internal_inputmultiplier() const;
-  void _internal_set_inputmultiplier(uint32_t value);
-  public:
-
-  // uint32 valueScale = 3;
-  void clear_valuescale();
-  uint32_t valuescale() const;
-  void set_valuescale(uint32_t value);
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
   private:
-  uint32_t _internal_valuescale() const;
-  void _internal_set_valuescale(uint32_t value);
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.LoadExpTableReq)
+  // @@protoc_insertion_point(class_scope:rp4.ClearOldConfigResp)
  private:
   class _Internal;
 
@@ -10391,9 +10944,7 @@ class LoadExpTableReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ExpPoint > points_;
-    uint32_t inputmultiplier_;
-    uint32_t valuescale_;
+    int res_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -10401,24 +10952,24 @@ class LoadExpTableReq final :
 };
 // -------------------------------------------------------------------
 
-class LoadExpTableResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.LoadExpTableResp) */ {
+class SetMissActIdReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetMissActIdReq) */ {
  public:
-  inline LoadExpTableResp() : LoadExpTableResp(nullptr) {}
-  ~LoadExpTableResp() override;
-  explicit PROTOBUF_CONSTEXPR LoadExpTableResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetMissActIdReq() : SetMissActIdReq(nullptr) {}
+  ~SetMissActIdReq() override;
+  explicit PROTOBUF_CONSTEXPR SetMissActIdReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LoadExpTableResp(const LoadExpTableResp& from);
-  LoadExpTableResp(LoadExpTableResp&& from) noexcept
-    : LoadExpTableResp() {
+  SetMissActIdReq(const SetMissActIdReq& from);
+  SetMissActIdReq(SetMissActIdReq&& from) noexcept
+    : SetMissActIdReq() {
     *this = ::std::move(from);
   }
 
-  inline LoadExpTableResp& operator=(const LoadExpTableResp& from) {
+  inline SetMissActIdReq& operator=(const SetMissActIdReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline LoadExpTableResp& operator=(LoadExpTableResp&& from) noexcept {
+  inline SetMissActIdReq& operator=(SetMissActIdReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -10441,20 +10992,20 @@ class LoadExpTableResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const LoadExpTableResp& default_instance() {
+  static const SetMissActIdReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const LoadExpTableResp* internal_default_instance() {
-    return reinterpret_cast<const LoadExpTableResp*>(
-               &_LoadExpTableResp_default_instance_);
+  static inline const SetMissActIdReq* internal_default_instance() {
+    return reinterpret_cast<const SetMissActIdReq*>(
+               &_SetMissActIdReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     59;
 
-  friend void swap(LoadExpTableResp& a, LoadExpTableResp& b) {
+  friend void swap(SetMissActIdReq& a, SetMissActIdReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(LoadExpTableResp* other) {
+  inline void Swap(SetMissActIdReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -10467,7 +11018,7 @@ class LoadExpTableResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(LoadExpTableResp* other) {
+  void UnsafeArenaSwap(SetMissActIdReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -10475,14 +11026,14 @@ class LoadExpTableResp final :
 
   // implements Message ----------------------------------------------
 
-  LoadExpTableResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<LoadExpTableResp>(arena);
+  SetMissActIdReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetMissActIdReq>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const LoadExpTableResp& from);
+  void CopyFrom(const SetMissActIdReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const LoadExpTableResp& from) {
-    LoadExpTableResp::MergeImpl(*this, from);
+  void MergeFrom( const SetMissActIdReq& from) {
+    SetMissActIdReq::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -10500,15 +11051,15 @@ class LoadExpTableResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(LoadExpTableResp* other);
+  void InternalSwap(SetMissActIdReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.LoadExpTableResp";
+    return "rp4.SetMissActIdReq";
   }
   protected:
-  explicit LoadExpTableResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetMissActIdReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -10522,18 +11073,38 @@ class LoadExpTableResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kProcIdFieldNumber = 1,
+    kMatcherIdFieldNumber = 2,
+    kMissActIdFieldNumber = 3,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
   private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.LoadExpTableResp)
+  // int32 matcherId = 2;
+  void clear_matcherid();
+  int32_t matcherid() const;
+  void set_matcherid(int32_t value);
+  private:
+  int32_t _internal_matcherid() const;
+  void _internal_set_matcherid(int32_t value);
+  public:
+
+  // int32 miss_act_id = 3;
+  void clear_miss_act_id();
+  int32_t miss_act_id() const;
+  void set_miss_act_id(int32_t value);
+  private:
+  int32_t _internal_miss_act_id() const;
+  void _internal_set_miss_act_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.SetMissActIdReq)
  private:
   class _Internal;
 
@@ -10541,7 +11112,9 @@ class LoadExpTableResp final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
+    int32_t procid_;
+    int32_t matcherid_;
+    int32_t miss_act_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -10549,23 +11122,24 @@ class LoadExpTableResp final :
 };
 // -------------------------------------------------------------------
 
-class ClearExpTableReq final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:rp4.ClearExpTableReq) */ {
+class SetMissActIdResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SetMissActIdResp) */ {
  public:
-  inline ClearExpTableReq() : ClearExpTableReq(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR ClearExpTableReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetMissActIdResp() : SetMissActIdResp(nullptr) {}
+  ~SetMissActIdResp() override;
+  explicit PROTOBUF_CONSTEXPR SetMissActIdResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearExpTableReq(const ClearExpTableReq& from);
-  ClearExpTableReq(ClearExpTableReq&& from) noexcept
-    : ClearExpTableReq() {
+  SetMissActIdResp(const SetMissActIdResp& from);
+  SetMissActIdResp(SetMissActIdResp&& from) noexcept
+    : SetMissActIdResp() {
     *this = ::std::move(from);
   }
 
-  inline ClearExpTableReq& operator=(const ClearExpTableReq& from) {
+  inline SetMissActIdResp& operator=(const SetMissActIdResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearExpTableReq& operator=(ClearExpTableReq&& from) noexcept {
+  inline SetMissActIdResp& operator=(SetMissActIdResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -10588,20 +11162,20 @@ class ClearExpTableReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearExpTableReq& default_instance() {
+  static const SetMissActIdResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearExpTableReq* internal_default_instance() {
-    return reinterpret_cast<const ClearExpTableReq*>(
-               &_ClearExpTableReq_default_instance_);
+  static inline const SetMissActIdResp* internal_default_instance() {
+    return reinterpret_cast<const SetMissActIdResp*>(
+               &_SetMissActIdResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     60;
 
-  friend void swap(ClearExpTableReq& a, ClearExpTableReq& b) {
+  friend void swap(SetMissActIdResp& a, SetMissActIdResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearExpTableReq* other) {
+  inline void Swap(SetMissActIdResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -10614,7 +11188,7 @@ class ClearExpTableReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearExpTableReq* other) {
+  void UnsafeArenaSwap(SetMissActIdResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -10622,26 +11196,40 @@ class ClearExpTableReq final :
 
   // implements Message ----------------------------------------------
 
-  ClearExpTableReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearExpTableReq>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const ClearExpTableReq& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  SetMissActIdResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetMissActIdResp>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const ClearExpTableReq& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetMissActIdResp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetMissActIdResp& from) {
+    SetMissActIdResp::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetMissActIdResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearExpTableReq";
+    return "rp4.SetMissActIdResp";
   }
   protected:
-  explicit ClearExpTableReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetMissActIdResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -10654,7 +11242,19 @@ class ClearExpTableReq final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearExpTableReq)
+  enum : int {
+    kResFieldNumber = 1,
+  };
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
+  private:
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.SetMissActIdResp)
  private:
   class _Internal;
 
@@ -10662,29 +11262,32 @@ class ClearExpTableReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    int res_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ClearExpTableResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearExpTableResp) */ {
+class Parameter final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.Parameter) */ {
  public:
-  inline ClearExpTableResp() : ClearExpTableResp(nullptr) {}
-  ~ClearExpTableResp() override;
-  explicit PROTOBUF_CONSTEXPR ClearExpTableResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline Parameter() : Parameter(nullptr) {}
+  ~Parameter() override;
+  explicit PROTOBUF_CONSTEXPR Parameter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearExpTableResp(const ClearExpTableResp& from);
-  ClearExpTableResp(ClearExpTableResp&& from) noexcept
-    : ClearExpTableResp() {
+  Parameter(const Parameter& from);
+  Parameter(Parameter&& from) noexcept
+    : Parameter() {
     *this = ::std::move(from);
   }
 
-  inline ClearExpTableResp& operator=(const ClearExpTableResp& from) {
+  inline Parameter& operator=(const Parameter& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearExpTableResp& operator=(ClearExpTableResp&& from) noexcept {
+  inline Parameter& operator=(Parameter&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -10707,20 +11310,29 @@ class ClearExpTableResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearExpTableResp& default_instance() {
+  static const Parameter& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearExpTableResp* internal_default_instance() {
-    return reinterpret_cast<const ClearExpTableResp*>(
-               &_ClearExpTableResp_default_instance_);
+  enum ValCase {
+    kHdrId = 2,
+    kField = 3,
+    kConstantData = 4,
+    kActionParaId = 5,
+    kOp = 6,
+    VAL_NOT_SET = 0,
+  };
+
+  static inline const Parameter* internal_default_instance() {
+    return reinterpret_cast<const Parameter*>(
+               &_Parameter_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     61;
 
-  friend void swap(ClearExpTableResp& a, ClearExpTableResp& b) {
+  friend void swap(Parameter& a, Parameter& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearExpTableResp* other) {
+  inline void Swap(Parameter* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -10733,7 +11345,7 @@ class ClearExpTableResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearExpTableResp* other) {
+  void UnsafeArenaSwap(Parameter* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -10741,14 +11353,14 @@ class ClearExpTableResp final :
 
   // implements Message ----------------------------------------------
 
-  ClearExpTableResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearExpTableResp>(arena);
+  Parameter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Parameter>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClearExpTableResp& from);
+  void CopyFrom(const Parameter& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ClearExpTableResp& from) {
-    ClearExpTableResp::MergeImpl(*this, from);
+  void MergeFrom( const Parameter& from) {
+    Parameter::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -10766,15 +11378,15 @@ class ClearExpTableResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClearExpTableResp* other);
+  void InternalSwap(Parameter* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearExpTableResp";
+    return "rp4.Parameter";
   }
   protected:
-  explicit ClearExpTableResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit Parameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -10788,51 +11400,152 @@ class ClearExpTableResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kTypeFieldNumber = 1,
+    kHdrIdFieldNumber = 2,
+    kFieldFieldNumber = 3,
+    kConstantDataFieldNumber = 4,
+    kActionParaIdFieldNumber = 5,
+    kOpFieldNumber = 6,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
+  // .rp4.ParameterType type = 1;
+  void clear_type();
+  ::rp4::ParameterType type() const;
+  void set_type(::rp4::ParameterType value);
   private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  ::rp4::ParameterType _internal_type() const;
+  void _internal_set_type(::rp4::ParameterType value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearExpTableResp)
+  // int32 hdrId = 2;
+  bool has_hdrid() const;
+  private:
+  bool _internal_has_hdrid() const;
+  public:
+  void clear_hdrid();
+  int32_t hdrid() const;
+  void set_hdrid(int32_t value);
+  private:
+  int32_t _internal_hdrid() const;
+  void _internal_set_hdrid(int32_t value);
+  public:
+
+  // .rp4.FieldInfo field = 3;
+  bool has_field() const;
+  private:
+  bool _internal_has_field() const;
+  public:
+  void clear_field();
+  const ::rp4::FieldInfo& field() const;
+  PROTOBUF_NODISCARD ::rp4::FieldInfo* release_field();
+  ::rp4::FieldInfo* mutable_field();
+  void set_allocated_field(::rp4::FieldInfo* field);
+  private:
+  const ::rp4::FieldInfo& _internal_field() const;
+  ::rp4::FieldInfo* _internal_mutable_field();
+  public:
+  void unsafe_arena_set_allocated_field(
+      ::rp4::FieldInfo* field);
+  ::rp4::FieldInfo* unsafe_arena_release_field();
+
+  // .rp4.Data constantData = 4;
+  bool has_constantdata() const;
+  private:
+  bool _internal_has_constantdata() const;
+  public:
+  void clear_constantdata();
+  const ::rp4::Data& constantdata() const;
+  PROTOBUF_NODISCARD ::rp4::Data* release_constantdata();
+  ::rp4::Data* mutable_constantdata();
+  void set_allocated_constantdata(::rp4::Data* constantdata);
+  private:
+  const ::rp4::Data& _internal_constantdata() const;
+  ::rp4::Data* _internal_mutable_constantdata();
+  public:
+  void unsafe_arena_set_allocated_constantdata(
+      ::rp4::Data* constantdata);
+  ::rp4::Data* unsafe_arena_release_constantdata();
+
+  // int32 actionParaId = 5;
+  bool has_actionparaid() const;
+  private:
+  bool _internal_has_actionparaid() const;
+  public:
+  void clear_actionparaid();
+  int32_t actionparaid() const;
+  void set_actionparaid(int32_t value);
+  private:
+  int32_t _internal_actionparaid() const;
+  void _internal_set_actionparaid(int32_t value);
+  public:
+
+  // .rp4.OpCode op = 6;
+  bool has_op() const;
+  private:
+  bool _internal_has_op() const;
+  public:
+  void clear_op();
+  ::rp4::OpCode op() const;
+  void set_op(::rp4::OpCode value);
+  private:
+  ::rp4::OpCode _internal_op() const;
+  void _internal_set_op(::rp4::OpCode value);
+  public:
+
+  void clear_val();
+  ValCase val_case() const;
+  // @@protoc_insertion_point(class_scope:rp4.Parameter)
  private:
   class _Internal;
+  void set_has_hdrid();
+  void set_has_field();
+  void set_has_constantdata();
+  void set_has_actionparaid();
+  void set_has_op();
+
+  inline bool has_val() const;
+  inline void clear_has_val();
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
+    int type_;
+    union ValUnion {
+      constexpr ValUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      int32_t hdrid_;
+      ::rp4::FieldInfo* field_;
+      ::rp4::Data* constantdata_;
+      int32_t actionparaid_;
+      int op_;
+    } val_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NeuronPrimitiveContext final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.NeuronPrimitiveContext) */ {
+class ExpTreeNode final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ExpTreeNode) */ {
  public:
-  inline NeuronPrimitiveContext() : NeuronPrimitiveContext(nullptr) {}
-  ~NeuronPrimitiveContext() override;
-  explicit PROTOBUF_CONSTEXPR NeuronPrimitiveContext(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ExpTreeNode() : ExpTreeNode(nullptr) {}
+  ~ExpTreeNode() override;
+  explicit PROTOBUF_CONSTEXPR ExpTreeNode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  NeuronPrimitiveContext(const NeuronPrimitiveContext& from);
-  NeuronPrimitiveContext(NeuronPrimitiveContext&& from) noexcept
-    : NeuronPrimitiveContext() {
+  ExpTreeNode(const ExpTreeNode& from);
+  ExpTreeNode(ExpTreeNode&& from) noexcept
+    : ExpTreeNode() {
     *this = ::std::move(from);
   }
 
-  inline NeuronPrimitiveContext& operator=(const NeuronPrimitiveContext& from) {
+  inline ExpTreeNode& operator=(const ExpTreeNode& from) {
     CopyFrom(from);
     return *this;
   }
-  inline NeuronPrimitiveContext& operator=(NeuronPrimitiveContext&& from) noexcept {
+  inline ExpTreeNode& operator=(ExpTreeNode&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -10855,20 +11568,20 @@ class NeuronPrimitiveContext final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const NeuronPrimitiveContext& default_instance() {
+  static const ExpTreeNode& default_instance() {
     return *internal_default_instance();
   }
-  static inline const NeuronPrimitiveContext* internal_default_instance() {
-    return reinterpret_cast<const NeuronPrimitiveContext*>(
-               &_NeuronPrimitiveContext_default_instance_);
+  static inline const ExpTreeNode* internal_default_instance() {
+    return reinterpret_cast<const ExpTreeNode*>(
+               &_ExpTreeNode_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     62;
 
-  friend void swap(NeuronPrimitiveContext& a, NeuronPrimitiveContext& b) {
+  friend void swap(ExpTreeNode& a, ExpTreeNode& b) {
     a.Swap(&b);
   }
-  inline void Swap(NeuronPrimitiveContext* other) {
+  inline void Swap(ExpTreeNode* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -10881,7 +11594,7 @@ class NeuronPrimitiveContext final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(NeuronPrimitiveContext* other) {
+  void UnsafeArenaSwap(ExpTreeNode* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -10889,14 +11602,14 @@ class NeuronPrimitiveContext final :
 
   // implements Message ----------------------------------------------
 
-  NeuronPrimitiveContext* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<NeuronPrimitiveContext>(arena);
+  ExpTreeNode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExpTreeNode>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const NeuronPrimitiveContext& from);
+  void CopyFrom(const ExpTreeNode& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const NeuronPrimitiveContext& from) {
-    NeuronPrimitiveContext::MergeImpl(*this, from);
+  void MergeFrom( const ExpTreeNode& from) {
+    ExpTreeNode::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -10914,15 +11627,15 @@ class NeuronPrimitiveContext final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(NeuronPrimitiveContext* other);
+  void InternalSwap(ExpTreeNode* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.NeuronPrimitiveContext";
+    return "rp4.ExpTreeNode";
   }
   protected:
-  explicit NeuronPrimitiveContext(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ExpTreeNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -10936,144 +11649,65 @@ class NeuronPrimitiveContext final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kWeightsFieldNumber = 9,
-    kBiasesFieldNumber = 10,
-    kContextIdFieldNumber = 1,
-    kNumInputsFieldNumber = 2,
-    kNumNeuronsFieldNumber = 3,
-    kInputBitwidthFieldNumber = 4,
-    kOutputBitwidthFieldNumber = 5,
-    kOutputShiftFieldNumber = 6,
-    kInputsAreSignedFieldNumber = 7,
-    kWeightsAreSignedFieldNumber = 8,
-    kActivationFieldNumber = 11,
+    kOptFieldNumber = 1,
+    kLeftFieldNumber = 2,
+    kRightFieldNumber = 3,
   };
-  // repeated sint32 weights = 9;
-  int weights_size() const;
-  private:
-  int _internal_weights_size() const;
-  public:
-  void clear_weights();
-  private:
-  int32_t _internal_weights(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      _internal_weights() const;
-  void _internal_add_weights(int32_t value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      _internal_mutable_weights();
-  public:
-  int32_t weights(int index) const;
-  void set_weights(int index, int32_t value);
-  void add_weights(int32_t value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      weights() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      mutable_weights();
-
-  // repeated sint32 biases = 10;
-  int biases_size() const;
-  private:
-  int _internal_biases_size() const;
-  public:
-  void clear_biases();
-  private:
-  int32_t _internal_biases(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      _internal_biases() const;
-  void _internal_add_biases(int32_t value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      _internal_mutable_biases();
-  public:
-  int32_t biases(int index) const;
-  void set_biases(int index, int32_t value);
-  void add_biases(int32_t value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      biases() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      mutable_biases();
-
-  // uint32 contextId = 1;
-  void clear_contextid();
-  uint32_t contextid() const;
-  void set_contextid(uint32_t value);
-  private:
-  uint32_t _internal_contextid() const;
-  void _internal_set_contextid(uint32_t value);
-  public:
-
-  // uint32 numInputs = 2;
-  void clear_numinputs();
-  uint32_t numinputs() const;
-  void set_numinputs(uint32_t value);
-  private:
-  uint32_t _internal_numinputs() const;
-  void _internal_set_numinputs(uint32_t value);
-  public:
-
-  // uint32 numNeurons = 3;
-  void clear_numneurons();
-  uint32_t numneurons() const;
-  void set_numneurons(uint32_t value);
-  private:
-  uint32_t _internal_numneurons() const;
-  void _internal_set_numneurons(uint32_t value);
-  public:
-
-  // uint32 inputBitwidth = 4;
-  void clear_inputbitwidth();
-  uint32_t inputbitwidth() const;
-  void set_inputbitwidth(uint32_t value);
+  // .rp4.Parameter opt = 1;
+  bool has_opt() const;
   private:
-  uint32_t _internal_inputbitwidth() const;
-  void _internal_set_inputbitwidth(uint32_t value);
+  bool _internal_has_opt() const;
   public:
-
-  // uint32 outputBitwidth = 5;
-  void clear_outputbitwidth();
-  uint32_t outputbitwidth() const;
-  void set_outputbitwidth(uint32_t value);
+  void clear_opt();
+  const ::rp4::Parameter& opt() const;
+  PROTOBUF_NODISCARD ::rp4::Parameter* release_opt();
+  ::rp4::Parameter* mutable_opt();
+  void set_allocated_opt(::rp4::Parameter* opt);
   private:
-  uint32_t _internal_outputbitwidth() const;
-  void _internal_set_outputbitwidth(uint32_t value);
+  const ::rp4::Parameter& _internal_opt() const;
+  ::rp4::Parameter* _internal_mutable_opt();
   public:
+  void unsafe_arena_set_allocated_opt(
+      ::rp4::Parameter* opt);
+  ::rp4::Parameter* unsafe_arena_release_opt();
 
-  // uint32 outputShift = 6;
-  void clear_outputshift();
-  uint32_t outputshift() const;
-  void set_outputshift(uint32_t value);
+  // .rp4.ExpTreeNode left = 2;
+  bool has_left() const;
   private:
-  uint32_t _internal_outputshift() const;
-  void _internal_set_outputshift(uint32_t value);
+  bool _internal_has_left() const;
   public:
-
-  // bool inputsAreSigned = 7;
-  void clear_inputsaresigned();
-  bool inputsaresigned() const;
-  void set_inputsaresigned(bool value);
+  void clear_left();
+  const ::rp4::ExpTreeNode& left() const;
+  PROTOBUF_NODISCARD ::rp4::ExpTreeNode* release_left();
+  ::rp4::ExpTreeNode* mutable_left();
+  void set_allocated_left(::rp4::ExpTreeNode* left);
   private:
-  bool _internal_inputsaresigned() const;
-  void _internal_set_inputsaresigned(bool value);
+  const ::rp4::ExpTreeNode& _internal_left() const;
+  ::rp4::ExpTreeNode* _internal_mutable_left();
   public:
+  void unsafe_arena_set_allocated_left(
+      ::rp4::ExpTreeNode* left);
+  ::rp4::ExpTreeNode* unsafe_arena_release_left();
 
-  // bool weightsAreSigned = 8;
-  void clear_weightsaresigned();
-  bool weightsaresigned() const;
-  void set_weightsaresigned(bool value);
+  // .rp4.ExpTreeNode right = 3;
+  bool has_right() const;
   private:
-  bool _internal_weightsaresigned() const;
-  void _internal_set_weightsaresigned(bool value);
+  bool _internal_has_right() const;
   public:
-
-  // .rp4.ActivationFunction activation = 11;
-  void clear_activation();
-  ::rp4::ActivationFunction activation() const;
-  void set_activation(::rp4::ActivationFunction value);
+  void clear_right();
+  const ::rp4::ExpTreeNode& right() const;
+  PROTOBUF_NODISCARD ::rp4::ExpTreeNode* release_right();
+  ::rp4::ExpTreeNode* mutable_right();
+  void set_allocated_right(::rp4::ExpTreeNode* right);
   private:
-  ::rp4::ActivationFunction _internal_activation() const;
-  void _internal_set_activation(::rp4::ActivationFunction value);
+  const ::rp4::ExpTreeNode& _internal_right() const;
+  ::rp4::ExpTreeNode* _internal_mutable_right();
   public:
+  void unsafe_arena_set_allocated_right(
+      ::rp4::ExpTreeNode* right);
+  ::rp4::ExpTreeNode* unsafe_arena_release_right();
 
-  // @@protoc_insertion_point(class_scope:rp4.NeuronPrimitiveContext)
+  // @@protoc_insertion_point(class_scope:rp4.ExpTreeNode)
  private:
   class _Internal;
 
@@ -11081,19 +11715,9 @@ class NeuronPrimitiveContext final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > weights_;
-    mutable std::atomic<int> _weights_cached_byte_size_;
-    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > biases_;
-    mutable std::atomic<int> _biases_cached_byte_size_;
-    uint32_t contextid_;
-    uint32_t numinputs_;
-    uint32_t numneurons_;
-    uint32_t inputbitwidth_;
-    uint32_t outputbitwidth_;
-    uint32_t outputshift_;
-    bool inputsaresigned_;
-    bool weightsaresigned_;
-    int activation_;
+    ::rp4::Parameter* opt_;
+    ::rp4::ExpTreeNode* left_;
+    ::rp4::ExpTreeNode* right_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -11101,24 +11725,24 @@ class NeuronPrimitiveContext final :
 };
 // -------------------------------------------------------------------
 
-class LoadNeuronPrimitiveContextReq final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.LoadNeuronPrimitiveContextReq) */ {
+class Prim final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.Prim) */ {
  public:
-  inline LoadNeuronPrimitiveContextReq() : LoadNeuronPrimitiveContextReq(nullptr) {}
-  ~LoadNeuronPrimitiveContextReq() override;
-  explicit PROTOBUF_CONSTEXPR LoadNeuronPrimitiveContextReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline Prim() : Prim(nullptr) {}
+  ~Prim() override;
+  explicit PROTOBUF_CONSTEXPR Prim(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LoadNeuronPrimitiveContextReq(const LoadNeuronPrimitiveContextReq& from);
-  LoadNeuronPrimitiveContextReq(LoadNeuronPrimitiveContextReq&& from) noexcept
-    : LoadNeuronPrimitiveContextReq() {
+  Prim(const Prim& from);
+  Prim(Prim&& from) noexcept
+    : Prim() {
     *this = ::std::move(from);
   }
 
-  inline LoadNeuronPrimitiveContextReq& operator=(const LoadNeuronPrimitiveContextReq& from) {
+  inline Prim& operator=(const Prim& from) {
     CopyFrom(from);
     return *this;
   }
-  inline LoadNeuronPrimitiveContextReq& operator=(LoadNeuronPrimitiveContextReq&& from) noexcept {
+  inline Prim& operator=(Prim&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -11141,20 +11765,20 @@ class LoadNeuronPrimitiveContextReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const LoadNeuronPrimitiveContextReq& default_instance() {
+  static const Prim& default_instance() {
     return *internal_default_instance();
   }
-  static inline const LoadNeuronPrimitiveContextReq* internal_default_instance() {
-    return reinterpret_cast<const LoadNeuronPrimitiveContextReq*>(
-               &_LoadNeuronPrimitiveContextReq_default_instance_);
+  static inline const Prim* internal_default_instance() {
+    return reinterpret_cast<const Prim*>(
+               &_Prim_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     63;
 
-  friend void swap(LoadNeuronPrimitiveContextReq& a, LoadNeuronPrimitiveContextReq& b) {
+  friend void swap(Prim& a, Prim& b) {
     a.Swap(&b);
   }
-  inline void Swap(LoadNeuronPrimitiveContextReq* other) {
+  inline void Swap(Prim* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -11167,7 +11791,7 @@ class LoadNeuronPrimitiveContextReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(LoadNeuronPrimitiveContextReq* other) {
+  void UnsafeArenaSwap(Prim* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -11175,14 +11799,14 @@ class LoadNeuronPrimitiveContextReq final :
 
   // implements Message ----------------------------------------------
 
-  LoadNeuronPrimitiveContextReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<LoadNeuronPrimitiveContextReq>(arena);
+  Prim* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Prim>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const LoadNeuronPrimitiveContextReq& from);
+  void CopyFrom(const Prim& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const LoadNeuronPrimitiveContextReq& from) {
-    LoadNeuronPrimitiveContextReq::MergeImpl(*this, from);
+  void MergeFrom( const Prim& from) {
+    Prim::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -11200,15 +11824,15 @@ class LoadNeuronPrimitiveContextReq final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(LoadNeuronPrimitiveContextReq* other);
+  void InternalSwap(Prim* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.LoadNeuronPrimitiveContextReq";
+    return "rp4.Prim";
   }
   protected:
-  explicit LoadNeuronPrimitiveContextReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit Prim(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -11222,35 +11846,55 @@ class LoadNeuronPrimitiveContextReq final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kContextFieldNumber = 1,
+    kLvalueFieldNumber = 1,
+    kRootFieldNumber = 2,
   };
-  // .rp4.NeuronPrimitiveContext context = 1;
-  bool has_context() const;
+  // .rp4.FieldInfo lvalue = 1;
+  bool has_lvalue() const;
   private:
-  bool _internal_has_context() const;
+  bool _internal_has_lvalue() const;
   public:
-  void clear_context();
-  const ::rp4::NeuronPrimitiveContext& context() const;
-  PROTOBUF_NODISCARD ::rp4::NeuronPrimitiveContext* release_context();
-  ::rp4::NeuronPrimitiveContext* mutable_context();
-  void set_allocated_context(::rp4::NeuronPrimitiveContext* context);
+  void clear_lvalue();
+  const ::rp4::FieldInfo& lvalue() const;
+  PROTOBUF_NODISCARD ::rp4::FieldInfo* release_lvalue();
+  ::rp4::FieldInfo* mutable_lvalue();
+  void set_allocated_lvalue(::rp4::FieldInfo* lvalue);
   private:
-  const ::rp4::NeuronPrimitiveContext& _internal_context() const;
-  ::rp4::NeuronPrimitiveContext* _internal_mutable_context();
+  const ::rp4::FieldInfo& _internal_lvalue() const;
+  ::rp4::FieldInfo* _internal_mutable_lvalue();
   public:
-  void unsafe_arena_set_allocated_context(
-      ::rp4::NeuronPrimitiveContext* context);
-  ::rp4::NeuronPrimitiveContext* unsafe_arena_release_context();
-
-  // @@protoc_insertion_point(class_scope:rp4.LoadNeuronPrimitiveContextReq)
- private:
-  class _Internal;
+  void unsafe_arena_set_allocated_lvalue(
+      ::rp4::FieldInfo* lvalue);
+  ::rp4::FieldInfo* unsafe_arena_release_lvalue();
 
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
+  // .rp4.ExpTreeNode root = 2;
+  bool has_root() const;
+  private:
+  bool _internal_has_root() const;
+  public:
+  void clear_root();
+  const ::rp4::ExpTreeNode& root() const;
+  PROTOBUF_NODISCARD ::rp4::ExpTreeNode* release_root();
+  ::rp4::ExpTreeNode* mutable_root();
+  void set_allocated_root(::rp4::ExpTreeNode* root);
+  private:
+  const ::rp4::ExpTreeNode& _internal_root() const;
+  ::rp4::ExpTreeNode* _internal_mutable_root();
+  public:
+  void unsafe_arena_set_allocated_root(
+      ::rp4::ExpTreeNode* root);
+  ::rp4::ExpTreeNode* unsafe_arena_release_root();
+
+  // @@protoc_insertion_point(class_scope:rp4.Prim)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::rp4::NeuronPrimitiveContext* context_;
+    ::rp4::FieldInfo* lvalue_;
+    ::rp4::ExpTreeNode* root_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -11258,24 +11902,24 @@ class LoadNeuronPrimitiveContextReq final :
 };
 // -------------------------------------------------------------------
 
-class LoadNeuronPrimitiveContextResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.LoadNeuronPrimitiveContextResp) */ {
+class Action final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.Action) */ {
  public:
-  inline LoadNeuronPrimitiveContextResp() : LoadNeuronPrimitiveContextResp(nullptr) {}
-  ~LoadNeuronPrimitiveContextResp() override;
-  explicit PROTOBUF_CONSTEXPR LoadNeuronPrimitiveContextResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline Action() : Action(nullptr) {}
+  ~Action() override;
+  explicit PROTOBUF_CONSTEXPR Action(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LoadNeuronPrimitiveContextResp(const LoadNeuronPrimitiveContextResp& from);
-  LoadNeuronPrimitiveContextResp(LoadNeuronPrimitiveContextResp&& from) noexcept
-    : LoadNeuronPrimitiveContextResp() {
+  Action(const Action& from);
+  Action(Action&& from) noexcept
+    : Action() {
     *this = ::std::move(from);
   }
 
-  inline LoadNeuronPrimitiveContextResp& operator=(const LoadNeuronPrimitiveContextResp& from) {
+  inline Action& operator=(const Action& from) {
     CopyFrom(from);
     return *this;
   }
-  inline LoadNeuronPrimitiveContextResp& operator=(LoadNeuronPrimitiveContextResp&& from) noexcept {
+  inline Action& operator=(Action&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -11298,20 +11942,20 @@ class LoadNeuronPrimitiveContextResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const LoadNeuronPrimitiveContextResp& default_instance() {
+  static const Action& default_instance() {
     return *internal_default_instance();
   }
-  static inline const LoadNeuronPrimitiveContextResp* internal_default_instance() {
-    return reinterpret_cast<const LoadNeuronPrimitiveContextResp*>(
-               &_LoadNeuronPrimitiveContextResp_default_instance_);
+  static inline const Action* internal_default_instance() {
+    return reinterpret_cast<const Action*>(
+               &_Action_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     64;
 
-  friend void swap(LoadNeuronPrimitiveContextResp& a, LoadNeuronPrimitiveContextResp& b) {
+  friend void swap(Action& a, Action& b) {
     a.Swap(&b);
   }
-  inline void Swap(LoadNeuronPrimitiveContextResp* other) {
+  inline void Swap(Action* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -11324,7 +11968,7 @@ class LoadNeuronPrimitiveContextResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(LoadNeuronPrimitiveContextResp* other) {
+  void UnsafeArenaSwap(Action* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -11332,14 +11976,14 @@ class LoadNeuronPrimitiveContextResp final :
 
   // implements Message ----------------------------------------------
 
-  LoadNeuronPrimitiveContextResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<LoadNeuronPrimitiveContextResp>(arena);
+  Action* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Action>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const LoadNeuronPrimitiveContextResp& from);
+  void CopyFrom(const Action& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const LoadNeuronPrimitiveContextResp& from) {
-    LoadNeuronPrimitiveContextResp::MergeImpl(*this, from);
+  void MergeFrom( const Action& from) {
+    Action::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -11357,15 +12001,15 @@ class LoadNeuronPrimitiveContextResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(LoadNeuronPrimitiveContextResp* other);
+  void InternalSwap(Action* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.LoadNeuronPrimitiveContextResp";
+    return "rp4.Action";
   }
   protected:
-  explicit LoadNeuronPrimitiveContextResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit Action(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -11379,18 +12023,60 @@ class LoadNeuronPrimitiveContextResp final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResFieldNumber = 1,
+    kPrimsFieldNumber = 2,
+    kActionParaLensFieldNumber = 4,
+    kParaNumFieldNumber = 1,
   };
-  // .rp4.Res res = 1;
-  void clear_res();
-  ::rp4::Res res() const;
-  void set_res(::rp4::Res value);
+  // repeated .rp4.Prim prims = 2;
+  int prims_size() const;
   private:
-  ::rp4::Res _internal_res() const;
-  void _internal_set_res(::rp4::Res value);
+  int _internal_prims_size() const;
+  public:
+  void clear_prims();
+  ::rp4::Prim* mutable_prims(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::Prim >*
+      mutable_prims();
+  private:
+  const ::rp4::Prim& _internal_prims(int index) const;
+  ::rp4::Prim* _internal_add_prims();
   public:
+  const ::rp4::Prim& prims(int index) const;
+  ::rp4::Prim* add_prims();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::Prim >&
+      prims() const;
 
-  // @@protoc_insertion_point(class_scope:rp4.LoadNeuronPrimitiveContextResp)
+  // repeated int32 actionParaLens = 4;
+  int actionparalens_size() const;
+  private:
+  int _internal_actionparalens_size() const;
+  public:
+  void clear_actionparalens();
+  private:
+  int32_t _internal_actionparalens(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_actionparalens() const;
+  void _internal_add_actionparalens(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_actionparalens();
+  public:
+  int32_t actionparalens(int index) const;
+  void set_actionparalens(int index, int32_t value);
+  void add_actionparalens(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      actionparalens() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_actionparalens();
+
+  // int32 paraNum = 1;
+  void clear_paranum();
+  int32_t paranum() const;
+  void set_paranum(int32_t value);
+  private:
+  int32_t _internal_paranum() const;
+  void _internal_set_paranum(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.Action)
  private:
   class _Internal;
 
@@ -11398,7 +12084,10 @@ class LoadNeuronPrimitiveContextResp final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int res_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::Prim > prims_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > actionparalens_;
+    mutable std::atomic<int> _actionparalens_cached_byte_size_;
+    int32_t paranum_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -11406,23 +12095,24 @@ class LoadNeuronPrimitiveContextResp final :
 };
 // -------------------------------------------------------------------
 
-class ClearNeuronPrimitiveContextsReq final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:rp4.ClearNeuronPrimitiveContextsReq) */ {
+class InsertActionReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertActionReq) */ {
  public:
-  inline ClearNeuronPrimitiveContextsReq() : ClearNeuronPrimitiveContextsReq(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR ClearNeuronPrimitiveContextsReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline InsertActionReq() : InsertActionReq(nullptr) {}
+  ~InsertActionReq() override;
+  explicit PROTOBUF_CONSTEXPR InsertActionReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearNeuronPrimitiveContextsReq(const ClearNeuronPrimitiveContextsReq& from);
-  ClearNeuronPrimitiveContextsReq(ClearNeuronPrimitiveContextsReq&& from) noexcept
-    : ClearNeuronPrimitiveContextsReq() {
+  InsertActionReq(const InsertActionReq& from);
+  InsertActionReq(InsertActionReq&& from) noexcept
+    : InsertActionReq() {
     *this = ::std::move(from);
   }
 
-  inline ClearNeuronPrimitiveContextsReq& operator=(const ClearNeuronPrimitiveContextsReq& from) {
+  inline InsertActionReq& operator=(const InsertActionReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearNeuronPrimitiveContextsReq& operator=(ClearNeuronPrimitiveContextsReq&& from) noexcept {
+  inline InsertActionReq& operator=(InsertActionReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -11445,20 +12135,20 @@ class ClearNeuronPrimitiveContextsReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearNeuronPrimitiveContextsReq& default_instance() {
+  static const InsertActionReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearNeuronPrimitiveContextsReq* internal_default_instance() {
-    return reinterpret_cast<const ClearNeuronPrimitiveContextsReq*>(
-               &_ClearNeuronPrimitiveContextsReq_default_instance_);
+  static inline const InsertActionReq* internal_default_instance() {
+    return reinterpret_cast<const InsertActionReq*>(
+               &_InsertActionReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     65;
 
-  friend void swap(ClearNeuronPrimitiveContextsReq& a, ClearNeuronPrimitiveContextsReq& b) {
+  friend void swap(InsertActionReq& a, InsertActionReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearNeuronPrimitiveContextsReq* other) {
+  inline void Swap(InsertActionReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -11471,7 +12161,7 @@ class ClearNeuronPrimitiveContextsReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearNeuronPrimitiveContextsReq* other) {
+  void UnsafeArenaSwap(InsertActionReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -11479,26 +12169,40 @@ class ClearNeuronPrimitiveContextsReq final :
 
   // implements Message ----------------------------------------------
 
-  ClearNeuronPrimitiveContextsReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearNeuronPrimitiveContextsReq>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const ClearNeuronPrimitiveContextsReq& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  InsertActionReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InsertActionReq>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const ClearNeuronPrimitiveContextsReq& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InsertActionReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InsertActionReq& from) {
+    InsertActionReq::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InsertActionReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearNeuronPrimitiveContextsReq";
+    return "rp4.InsertActionReq";
   }
   protected:
-  explicit ClearNeuronPrimitiveContextsReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit InsertActionReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -11511,7 +12215,48 @@ class ClearNeuronPrimitiveContextsReq final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearNeuronPrimitiveContextsReq)
+  enum : int {
+    kActionFieldNumber = 2,
+    kProcIdFieldNumber = 1,
+    kActionIdFieldNumber = 3,
+  };
+  // .rp4.Action action = 2;
+  bool has_action() const;
+  private:
+  bool _internal_has_action() const;
+  public:
+  void clear_action();
+  const ::rp4::Action& action() const;
+  PROTOBUF_NODISCARD ::rp4::Action* release_action();
+  ::rp4::Action* mutable_action();
+  void set_allocated_action(::rp4::Action* action);
+  private:
+  const ::rp4::Action& _internal_action() const;
+  ::rp4::Action* _internal_mutable_action();
+  public:
+  void unsafe_arena_set_allocated_action(
+      ::rp4::Action* action);
+  ::rp4::Action* unsafe_arena_release_action();
+
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
+  private:
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
+  public:
+
+  // int32 actionId = 3;
+  void clear_actionid();
+  int32_t actionid() const;
+  void set_actionid(int32_t value);
+  private:
+  int32_t _internal_actionid() const;
+  void _internal_set_actionid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.InsertActionReq)
  private:
   class _Internal;
 
@@ -11519,29 +12264,34 @@ class ClearNeuronPrimitiveContextsReq final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::rp4::Action* action_;
+    int32_t procid_;
+    int32_t actionid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ClearNeuronPrimitiveContextsResp final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearNeuronPrimitiveContextsResp) */ {
+class InsertActionResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.InsertActionResp) */ {
  public:
-  inline ClearNeuronPrimitiveContextsResp() : ClearNeuronPrimitiveContextsResp(nullptr) {}
-  ~ClearNeuronPrimitiveContextsResp() override;
-  explicit PROTOBUF_CONSTEXPR ClearNeuronPrimitiveContextsResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline InsertActionResp() : InsertActionResp(nullptr) {}
+  ~InsertActionResp() override;
+  explicit PROTOBUF_CONSTEXPR InsertActionResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClearNeuronPrimitiveContextsResp(const ClearNeuronPrimitiveContextsResp& from);
-  ClearNeuronPrimitiveContextsResp(ClearNeuronPrimitiveContextsResp&& from) noexcept
-    : ClearNeuronPrimitiveContextsResp() {
+  InsertActionResp(const InsertActionResp& from);
+  InsertActionResp(InsertActionResp&& from) noexcept
+    : InsertActionResp() {
     *this = ::std::move(from);
   }
 
-  inline ClearNeuronPrimitiveContextsResp& operator=(const ClearNeuronPrimitiveContextsResp& from) {
+  inline InsertActionResp& operator=(const InsertActionResp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClearNeuronPrimitiveContextsResp& operator=(ClearNeuronPrimitiveContextsResp&& from) noexcept {
+  inline InsertActionResp& operator=(InsertActionResp&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -11564,20 +12314,20 @@ class ClearNeuronPrimitiveContextsResp final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClearNeuronPrimitiveContextsResp& default_instance() {
+  static const InsertActionResp& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClearNeuronPrimitiveContextsResp* internal_default_instance() {
-    return reinterpret_cast<const ClearNeuronPrimitiveContextsResp*>(
-               &_ClearNeuronPrimitiveContextsResp_default_instance_);
+  static inline const InsertActionResp* internal_default_instance() {
+    return reinterpret_cast<const InsertActionResp*>(
+               &_InsertActionResp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     66;
 
-  friend void swap(ClearNeuronPrimitiveContextsResp& a, ClearNeuronPrimitiveContextsResp& b) {
+  friend void swap(InsertActionResp& a, InsertActionResp& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClearNeuronPrimitiveContextsResp* other) {
+  inline void Swap(InsertActionResp* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -11590,7 +12340,7 @@ class ClearNeuronPrimitiveContextsResp final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClearNeuronPrimitiveContextsResp* other) {
+  void UnsafeArenaSwap(InsertActionResp* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -11598,14 +12348,14 @@ class ClearNeuronPrimitiveContextsResp final :
 
   // implements Message ----------------------------------------------
 
-  ClearNeuronPrimitiveContextsResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClearNeuronPrimitiveContextsResp>(arena);
+  InsertActionResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InsertActionResp>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClearNeuronPrimitiveContextsResp& from);
+  void CopyFrom(const InsertActionResp& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ClearNeuronPrimitiveContextsResp& from) {
-    ClearNeuronPrimitiveContextsResp::MergeImpl(*this, from);
+  void MergeFrom( const InsertActionResp& from) {
+    InsertActionResp::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -11623,15 +12373,15 @@ class ClearNeuronPrimitiveContextsResp final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClearNeuronPrimitiveContextsResp* other);
+  void InternalSwap(InsertActionResp* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "rp4.ClearNeuronPrimitiveContextsResp";
+    return "rp4.InsertActionResp";
   }
   protected:
-  explicit ClearNeuronPrimitiveContextsResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit InsertActionResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -11656,7 +12406,7 @@ class ClearNeuronPrimitiveContextsResp final :
   void _internal_set_res(::rp4::Res value);
   public:
 
-  // @@protoc_insertion_point(class_scope:rp4.ClearNeuronPrimitiveContextsResp)
+  // @@protoc_insertion_point(class_scope:rp4.InsertActionResp)
  private:
   class _Internal;
 
@@ -11670,818 +12420,6630 @@ class ClearNeuronPrimitiveContextsResp final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
 };
-// ===================================================================
-
-
-// ===================================================================
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// HeaderInfo
+class ClearActionReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearActionReq) */ {
+ public:
+  inline ClearActionReq() : ClearActionReq(nullptr) {}
+  ~ClearActionReq() override;
+  explicit PROTOBUF_CONSTEXPR ClearActionReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// int32 headerId = 1;
-inline void HeaderInfo::clear_headerid() {
-  _impl_.headerid_ = 0;
-}
-inline int32_t HeaderInfo::_internal_headerid() const {
-  return _impl_.headerid_;
-}
-inline int32_t HeaderInfo::headerid() const {
-  // @@protoc_insertion_point(field_get:rp4.HeaderInfo.headerId)
-  return _internal_headerid();
-}
-inline void HeaderInfo::_internal_set_headerid(int32_t value) {
-  
-  _impl_.headerid_ = value;
-}
-inline void HeaderInfo::set_headerid(int32_t value) {
-  _internal_set_headerid(value);
-  // @@protoc_insertion_point(field_set:rp4.HeaderInfo.headerId)
-}
+  ClearActionReq(const ClearActionReq& from);
+  ClearActionReq(ClearActionReq&& from) noexcept
+    : ClearActionReq() {
+    *this = ::std::move(from);
+  }
 
-// int32 headerLength = 2;
-inline void HeaderInfo::clear_headerlength() {
-  _impl_.headerlength_ = 0;
-}
-inline int32_t HeaderInfo::_internal_headerlength() const {
-  return _impl_.headerlength_;
-}
-inline int32_t HeaderInfo::headerlength() const {
-  // @@protoc_insertion_point(field_get:rp4.HeaderInfo.headerLength)
-  return _internal_headerlength();
-}
-inline void HeaderInfo::_internal_set_headerlength(int32_t value) {
-  
-  _impl_.headerlength_ = value;
-}
-inline void HeaderInfo::set_headerlength(int32_t value) {
-  _internal_set_headerlength(value);
-  // @@protoc_insertion_point(field_set:rp4.HeaderInfo.headerLength)
-}
+  inline ClearActionReq& operator=(const ClearActionReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClearActionReq& operator=(ClearActionReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// int32 headerOffset = 3;
-inline void HeaderInfo::clear_headeroffset() {
-  _impl_.headeroffset_ = 0;
-}
-inline int32_t HeaderInfo::_internal_headeroffset() const {
-  return _impl_.headeroffset_;
-}
-inline int32_t HeaderInfo::headeroffset() const {
-  // @@protoc_insertion_point(field_get:rp4.HeaderInfo.headerOffset)
-  return _internal_headeroffset();
-}
-inline void HeaderInfo::_internal_set_headeroffset(int32_t value) {
-  
-  _impl_.headeroffset_ = value;
-}
-inline void HeaderInfo::set_headeroffset(int32_t value) {
-  _internal_set_headeroffset(value);
-  // @@protoc_insertion_point(field_set:rp4.HeaderInfo.headerOffset)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClearActionReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClearActionReq* internal_default_instance() {
+    return reinterpret_cast<const ClearActionReq*>(
+               &_ClearActionReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    67;
 
-// -------------------------------------------------------------------
+  friend void swap(ClearActionReq& a, ClearActionReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClearActionReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClearActionReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// SetMetadataReq
+  // implements Message ----------------------------------------------
 
-// repeated .rp4.HeaderInfo headerInfos = 1;
-inline int SetMetadataReq::_internal_headerinfos_size() const {
-  return _impl_.headerinfos_.size();
-}
-inline int SetMetadataReq::headerinfos_size() const {
-  return _internal_headerinfos_size();
-}
-inline void SetMetadataReq::clear_headerinfos() {
-  _impl_.headerinfos_.Clear();
-}
-inline ::rp4::HeaderInfo* SetMetadataReq::mutable_headerinfos(int index) {
-  // @@protoc_insertion_point(field_mutable:rp4.SetMetadataReq.headerInfos)
-  return _impl_.headerinfos_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::HeaderInfo >*
-SetMetadataReq::mutable_headerinfos() {
-  // @@protoc_insertion_point(field_mutable_list:rp4.SetMetadataReq.headerInfos)
-  return &_impl_.headerinfos_;
-}
-inline const ::rp4::HeaderInfo& SetMetadataReq::_internal_headerinfos(int index) const {
-  return _impl_.headerinfos_.Get(index);
-}
-inline const ::rp4::HeaderInfo& SetMetadataReq::headerinfos(int index) const {
-  // @@protoc_insertion_point(field_get:rp4.SetMetadataReq.headerInfos)
-  return _internal_headerinfos(index);
-}
-inline ::rp4::HeaderInfo* SetMetadataReq::_internal_add_headerinfos() {
-  return _impl_.headerinfos_.Add();
-}
-inline ::rp4::HeaderInfo* SetMetadataReq::add_headerinfos() {
-  ::rp4::HeaderInfo* _add = _internal_add_headerinfos();
-  // @@protoc_insertion_point(field_add:rp4.SetMetadataReq.headerInfos)
-  return _add;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::HeaderInfo >&
-SetMetadataReq::headerinfos() const {
-  // @@protoc_insertion_point(field_list:rp4.SetMetadataReq.headerInfos)
-  return _impl_.headerinfos_;
-}
+  ClearActionReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearActionReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClearActionReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClearActionReq& from) {
+    ClearActionReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// -------------------------------------------------------------------
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// SetMetadataResp
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClearActionReq* other);
 
-// .rp4.Res res = 1;
-inline void SetMetadataResp::clear_res() {
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.ClearActionReq";
+  }
+  protected:
+  explicit ClearActionReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kProcIdFieldNumber = 1,
+  };
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
+  private:
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.ClearActionReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t procid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClearActionResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearActionResp) */ {
+ public:
+  inline ClearActionResp() : ClearActionResp(nullptr) {}
+  ~ClearActionResp() override;
+  explicit PROTOBUF_CONSTEXPR ClearActionResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClearActionResp(const ClearActionResp& from);
+  ClearActionResp(ClearActionResp&& from) noexcept
+    : ClearActionResp() {
+    *this = ::std::move(from);
+  }
+
+  inline ClearActionResp& operator=(const ClearActionResp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClearActionResp& operator=(ClearActionResp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClearActionResp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClearActionResp* internal_default_instance() {
+    return reinterpret_cast<const ClearActionResp*>(
+               &_ClearActionResp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    68;
+
+  friend void swap(ClearActionResp& a, ClearActionResp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClearActionResp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClearActionResp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClearActionResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearActionResp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClearActionResp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClearActionResp& from) {
+    ClearActionResp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClearActionResp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.ClearActionResp";
+  }
+  protected:
+  explicit ClearActionResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResFieldNumber = 1,
+  };
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
+  private:
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.ClearActionResp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int res_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DelActionReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.DelActionReq) */ {
+ public:
+  inline DelActionReq() : DelActionReq(nullptr) {}
+  ~DelActionReq() override;
+  explicit PROTOBUF_CONSTEXPR DelActionReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DelActionReq(const DelActionReq& from);
+  DelActionReq(DelActionReq&& from) noexcept
+    : DelActionReq() {
+    *this = ::std::move(from);
+  }
+
+  inline DelActionReq& operator=(const DelActionReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DelActionReq& operator=(DelActionReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DelActionReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DelActionReq* internal_default_instance() {
+    return reinterpret_cast<const DelActionReq*>(
+               &_DelActionReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    69;
+
+  friend void swap(DelActionReq& a, DelActionReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DelActionReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DelActionReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DelActionReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DelActionReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DelActionReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DelActionReq& from) {
+    DelActionReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DelActionReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.DelActionReq";
+  }
+  protected:
+  explicit DelActionReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kProcIdFieldNumber = 1,
+    kActionIdFieldNumber = 2,
+  };
+  // int32 procId = 1;
+  void clear_procid();
+  int32_t procid() const;
+  void set_procid(int32_t value);
+  private:
+  int32_t _internal_procid() const;
+  void _internal_set_procid(int32_t value);
+  public:
+
+  // int32 actionId = 2;
+  void clear_actionid();
+  int32_t actionid() const;
+  void set_actionid(int32_t value);
+  private:
+  int32_t _internal_actionid() const;
+  void _internal_set_actionid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.DelActionReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t procid_;
+    int32_t actionid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DelActionResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.DelActionResp) */ {
+ public:
+  inline DelActionResp() : DelActionResp(nullptr) {}
+  ~DelActionResp() override;
+  explicit PROTOBUF_CONSTEXPR DelActionResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DelActionResp(const DelActionResp& from);
+  DelActionResp(DelActionResp&& from) noexcept
+    : DelActionResp() {
+    *this = ::std::move(from);
+  }
+
+  inline DelActionResp& operator=(const DelActionResp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DelActionResp& operator=(DelActionResp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DelActionResp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DelActionResp* internal_default_instance() {
+    return reinterpret_cast<const DelActionResp*>(
+               &_DelActionResp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    70;
+
+  friend void swap(DelActionResp& a, DelActionResp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DelActionResp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DelActionResp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DelActionResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DelActionResp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DelActionResp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DelActionResp& from) {
+    DelActionResp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DelActionResp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.DelActionResp";
+  }
+  protected:
+  explicit DelActionResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResFieldNumber = 1,
+  };
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
+  private:
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.DelActionResp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int res_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SigmoidPoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.SigmoidPoint) */ {
+ public:
+  inline SigmoidPoint() : SigmoidPoint(nullptr) {}
+  ~SigmoidPoint() override;
+  explicit PROTOBUF_CONSTEXPR SigmoidPoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SigmoidPoint(const SigmoidPoint& from);
+  SigmoidPoint(SigmoidPoint&& from) noexcept
+    : SigmoidPoint() {
+    *this = ::std::move(from);
+  }
+
+  inline SigmoidPoint& operator=(const SigmoidPoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SigmoidPoint& operator=(SigmoidPoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SigmoidPoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SigmoidPoint* internal_default_instance() {
+    return reinterpret_cast<const SigmoidPoint*>(
+               &_SigmoidPoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    71;
+
+  friend void swap(SigmoidPoint& a, SigmoidPoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SigmoidPoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SigmoidPoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SigmoidPoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SigmoidPoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SigmoidPoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SigmoidPoint& from) {
+    SigmoidPoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SigmoidPoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.SigmoidPoint";
+  }
+  protected:
+  explicit SigmoidPoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInputFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // int32 input = 1;
+  void clear_input();
+  int32_t input() const;
+  void set_input(int32_t value);
+  private:
+  int32_t _internal_input() const;
+  void _internal_set_input(int32_t value);
+  public:
+
+  // uint32 value = 2;
+  void clear_value();
+  uint32_t value() const;
+  void set_value(uint32_t value);
+  private:
+  uint32_t _internal_value() const;
+  void _internal_set_value(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.SigmoidPoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t input_;
+    uint32_t value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LoadSigmoidTableReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.LoadSigmoidTableReq) */ {
+ public:
+  inline LoadSigmoidTableReq() : LoadSigmoidTableReq(nullptr) {}
+  ~LoadSigmoidTableReq() override;
+  explicit PROTOBUF_CONSTEXPR LoadSigmoidTableReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LoadSigmoidTableReq(const LoadSigmoidTableReq& from);
+  LoadSigmoidTableReq(LoadSigmoidTableReq&& from) noexcept
+    : LoadSigmoidTableReq() {
+    *this = ::std::move(from);
+  }
+
+  inline LoadSigmoidTableReq& operator=(const LoadSigmoidTableReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LoadSigmoidTableReq& operator=(LoadSigmoidTableReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoadSigmoidTableReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LoadSigmoidTableReq* internal_default_instance() {
+    return reinterpret_cast<const LoadSigmoidTableReq*>(
+               &_LoadSigmoidTableReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    72;
+
+  friend void swap(LoadSigmoidTableReq& a, LoadSigmoidTableReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LoadSigmoidTableReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoadSigmoidTableReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LoadSigmoidTableReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LoadSigmoidTableReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LoadSigmoidTableReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoadSigmoidTableReq& from) {
+    LoadSigmoidTableReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LoadSigmoidTableReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.LoadSigmoidTableReq";
+  }
+  protected:
+  explicit LoadSigmoidTableReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPointsFieldNumber = 1,
+    kValueBitwidthFieldNumber = 2,
+    kInputMultiplierFieldNumber = 3,
+  };
+  // repeated .rp4.SigmoidPoint points = 1;
+  int points_size() const;
+  private:
+  int _internal_points_size() const;
+  public:
+  void clear_points();
+  ::rp4::SigmoidPoint* mutable_points(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::SigmoidPoint >*
+      mutable_points();
+  private:
+  const ::rp4::SigmoidPoint& _internal_points(int index) const;
+  ::rp4::SigmoidPoint* _internal_add_points();
+  public:
+  const ::rp4::SigmoidPoint& points(int index) const;
+  ::rp4::SigmoidPoint* add_points();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::SigmoidPoint >&
+      points() const;
+
+  // int32 value_bitwidth = 2;
+  void clear_value_bitwidth();
+  int32_t value_bitwidth() const;
+  void set_value_bitwidth(int32_t value);
+  private:
+  int32_t _internal_value_bitwidth() const;
+  void _internal_set_value_bitwidth(int32_t value);
+  public:
+
+  // uint32 inputMultiplier = 3;
+  void clear_inputmultiplier();
+  uint32_t inputmultiplier() const;
+  void set_inputmultiplier(uint32_t value);
+  private:
+  uint32_t _internal_inputmultiplier() const;
+  void _internal_set_inputmultiplier(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.LoadSigmoidTableReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::SigmoidPoint > points_;
+    int32_t value_bitwidth_;
+    uint32_t inputmultiplier_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LoadSigmoidTableResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.LoadSigmoidTableResp) */ {
+ public:
+  inline LoadSigmoidTableResp() : LoadSigmoidTableResp(nullptr) {}
+  ~LoadSigmoidTableResp() override;
+  explicit PROTOBUF_CONSTEXPR LoadSigmoidTableResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LoadSigmoidTableResp(const LoadSigmoidTableResp& from);
+  LoadSigmoidTableResp(LoadSigmoidTableResp&& from) noexcept
+    : LoadSigmoidTableResp() {
+    *this = ::std::move(from);
+  }
+
+  inline LoadSigmoidTableResp& operator=(const LoadSigmoidTableResp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LoadSigmoidTableResp& operator=(LoadSigmoidTableResp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoadSigmoidTableResp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LoadSigmoidTableResp* internal_default_instance() {
+    return reinterpret_cast<const LoadSigmoidTableResp*>(
+               &_LoadSigmoidTableResp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    73;
+
+  friend void swap(LoadSigmoidTableResp& a, LoadSigmoidTableResp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LoadSigmoidTableResp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoadSigmoidTableResp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LoadSigmoidTableResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LoadSigmoidTableResp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LoadSigmoidTableResp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoadSigmoidTableResp& from) {
+    LoadSigmoidTableResp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LoadSigmoidTableResp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.LoadSigmoidTableResp";
+  }
+  protected:
+  explicit LoadSigmoidTableResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResFieldNumber = 1,
+  };
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
+  private:
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.LoadSigmoidTableResp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int res_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClearSigmoidTableReq final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:rp4.ClearSigmoidTableReq) */ {
+ public:
+  inline ClearSigmoidTableReq() : ClearSigmoidTableReq(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ClearSigmoidTableReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClearSigmoidTableReq(const ClearSigmoidTableReq& from);
+  ClearSigmoidTableReq(ClearSigmoidTableReq&& from) noexcept
+    : ClearSigmoidTableReq() {
+    *this = ::std::move(from);
+  }
+
+  inline ClearSigmoidTableReq& operator=(const ClearSigmoidTableReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClearSigmoidTableReq& operator=(ClearSigmoidTableReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClearSigmoidTableReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClearSigmoidTableReq* internal_default_instance() {
+    return reinterpret_cast<const ClearSigmoidTableReq*>(
+               &_ClearSigmoidTableReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    74;
+
+  friend void swap(ClearSigmoidTableReq& a, ClearSigmoidTableReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClearSigmoidTableReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClearSigmoidTableReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClearSigmoidTableReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearSigmoidTableReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ClearSigmoidTableReq& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ClearSigmoidTableReq& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.ClearSigmoidTableReq";
+  }
+  protected:
+  explicit ClearSigmoidTableReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:rp4.ClearSigmoidTableReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClearSigmoidTableResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearSigmoidTableResp) */ {
+ public:
+  inline ClearSigmoidTableResp() : ClearSigmoidTableResp(nullptr) {}
+  ~ClearSigmoidTableResp() override;
+  explicit PROTOBUF_CONSTEXPR ClearSigmoidTableResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClearSigmoidTableResp(const ClearSigmoidTableResp& from);
+  ClearSigmoidTableResp(ClearSigmoidTableResp&& from) noexcept
+    : ClearSigmoidTableResp() {
+    *this = ::std::move(from);
+  }
+
+  inline ClearSigmoidTableResp& operator=(const ClearSigmoidTableResp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClearSigmoidTableResp& operator=(ClearSigmoidTableResp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClearSigmoidTableResp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClearSigmoidTableResp* internal_default_instance() {
+    return reinterpret_cast<const ClearSigmoidTableResp*>(
+               &_ClearSigmoidTableResp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    75;
+
+  friend void swap(ClearSigmoidTableResp& a, ClearSigmoidTableResp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClearSigmoidTableResp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClearSigmoidTableResp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClearSigmoidTableResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearSigmoidTableResp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClearSigmoidTableResp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClearSigmoidTableResp& from) {
+    ClearSigmoidTableResp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClearSigmoidTableResp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.ClearSigmoidTableResp";
+  }
+  protected:
+  explicit ClearSigmoidTableResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResFieldNumber = 1,
+  };
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
+  private:
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.ClearSigmoidTableResp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int res_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExpPoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ExpPoint) */ {
+ public:
+  inline ExpPoint() : ExpPoint(nullptr) {}
+  ~ExpPoint() override;
+  explicit PROTOBUF_CONSTEXPR ExpPoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExpPoint(const ExpPoint& from);
+  ExpPoint(ExpPoint&& from) noexcept
+    : ExpPoint() {
+    *this = ::std::move(from);
+  }
+
+  inline ExpPoint& operator=(const ExpPoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExpPoint& operator=(ExpPoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExpPoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExpPoint* internal_default_instance() {
+    return reinterpret_cast<const ExpPoint*>(
+               &_ExpPoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    76;
+
+  friend void swap(ExpPoint& a, ExpPoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExpPoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExpPoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExpPoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExpPoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExpPoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExpPoint& from) {
+    ExpPoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExpPoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.ExpPoint";
+  }
+  protected:
+  explicit ExpPoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInputFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // int32 input = 1;
+  void clear_input();
+  int32_t input() const;
+  void set_input(int32_t value);
+  private:
+  int32_t _internal_input() const;
+  void _internal_set_input(int32_t value);
+  public:
+
+  // uint32 value = 2;
+  void clear_value();
+  uint32_t value() const;
+  void set_value(uint32_t value);
+  private:
+  uint32_t _internal_value() const;
+  void _internal_set_value(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.ExpPoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t input_;
+    uint32_t value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LoadExpTableReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.LoadExpTableReq) */ {
+ public:
+  inline LoadExpTableReq() : LoadExpTableReq(nullptr) {}
+  ~LoadExpTableReq() override;
+  explicit PROTOBUF_CONSTEXPR LoadExpTableReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LoadExpTableReq(const LoadExpTableReq& from);
+  LoadExpTableReq(LoadExpTableReq&& from) noexcept
+    : LoadExpTableReq() {
+    *this = ::std::move(from);
+  }
+
+  inline LoadExpTableReq& operator=(const LoadExpTableReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LoadExpTableReq& operator=(LoadExpTableReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoadExpTableReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LoadExpTableReq* internal_default_instance() {
+    return reinterpret_cast<const LoadExpTableReq*>(
+               &_LoadExpTableReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    77;
+
+  friend void swap(LoadExpTableReq& a, LoadExpTableReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LoadExpTableReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoadExpTableReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LoadExpTableReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LoadExpTableReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LoadExpTableReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoadExpTableReq& from) {
+    LoadExpTableReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LoadExpTableReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.LoadExpTableReq";
+  }
+  protected:
+  explicit LoadExpTableReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPointsFieldNumber = 1,
+    kInputMultiplierFieldNumber = 2,
+    kValueScaleFieldNumber = 3,
+  };
+  // repeated .rp4.ExpPoint points = 1;
+  int points_size() const;
+  private:
+  int _internal_points_size() const;
+  public:
+  void clear_points();
+  ::rp4::ExpPoint* mutable_points(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ExpPoint >*
+      mutable_points();
+  private:
+  const ::rp4::ExpPoint& _internal_points(int index) const;
+  ::rp4::ExpPoint* _internal_add_points();
+  public:
+  const ::rp4::ExpPoint& points(int index) const;
+  ::rp4::ExpPoint* add_points();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ExpPoint >&
+      points() const;
+
+  // uint32 inputMultiplier = 2;
+  void clear_inputmultiplier();
+  uint32_t inputmultiplier() const;
+  void set_inputmultiplier(uint32_t value);
+  private:
+  uint32_t _internal_inputmultiplier() const;
+  void _internal_set_inputmultiplier(uint32_t value);
+  public:
+
+  // uint32 valueScale = 3;
+  void clear_valuescale();
+  uint32_t valuescale() const;
+  void set_valuescale(uint32_t value);
+  private:
+  uint32_t _internal_valuescale() const;
+  void _internal_set_valuescale(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.LoadExpTableReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ExpPoint > points_;
+    uint32_t inputmultiplier_;
+    uint32_t valuescale_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LoadExpTableResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.LoadExpTableResp) */ {
+ public:
+  inline LoadExpTableResp() : LoadExpTableResp(nullptr) {}
+  ~LoadExpTableResp() override;
+  explicit PROTOBUF_CONSTEXPR LoadExpTableResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LoadExpTableResp(const LoadExpTableResp& from);
+  LoadExpTableResp(LoadExpTableResp&& from) noexcept
+    : LoadExpTableResp() {
+    *this = ::std::move(from);
+  }
+
+  inline LoadExpTableResp& operator=(const LoadExpTableResp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LoadExpTableResp& operator=(LoadExpTableResp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoadExpTableResp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LoadExpTableResp* internal_default_instance() {
+    return reinterpret_cast<const LoadExpTableResp*>(
+               &_LoadExpTableResp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    78;
+
+  friend void swap(LoadExpTableResp& a, LoadExpTableResp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LoadExpTableResp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoadExpTableResp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LoadExpTableResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LoadExpTableResp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LoadExpTableResp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoadExpTableResp& from) {
+    LoadExpTableResp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LoadExpTableResp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.LoadExpTableResp";
+  }
+  protected:
+  explicit LoadExpTableResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResFieldNumber = 1,
+  };
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
+  private:
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.LoadExpTableResp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int res_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClearExpTableReq final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:rp4.ClearExpTableReq) */ {
+ public:
+  inline ClearExpTableReq() : ClearExpTableReq(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ClearExpTableReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClearExpTableReq(const ClearExpTableReq& from);
+  ClearExpTableReq(ClearExpTableReq&& from) noexcept
+    : ClearExpTableReq() {
+    *this = ::std::move(from);
+  }
+
+  inline ClearExpTableReq& operator=(const ClearExpTableReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClearExpTableReq& operator=(ClearExpTableReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClearExpTableReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClearExpTableReq* internal_default_instance() {
+    return reinterpret_cast<const ClearExpTableReq*>(
+               &_ClearExpTableReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    79;
+
+  friend void swap(ClearExpTableReq& a, ClearExpTableReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClearExpTableReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClearExpTableReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClearExpTableReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearExpTableReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ClearExpTableReq& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ClearExpTableReq& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.ClearExpTableReq";
+  }
+  protected:
+  explicit ClearExpTableReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:rp4.ClearExpTableReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClearExpTableResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearExpTableResp) */ {
+ public:
+  inline ClearExpTableResp() : ClearExpTableResp(nullptr) {}
+  ~ClearExpTableResp() override;
+  explicit PROTOBUF_CONSTEXPR ClearExpTableResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClearExpTableResp(const ClearExpTableResp& from);
+  ClearExpTableResp(ClearExpTableResp&& from) noexcept
+    : ClearExpTableResp() {
+    *this = ::std::move(from);
+  }
+
+  inline ClearExpTableResp& operator=(const ClearExpTableResp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClearExpTableResp& operator=(ClearExpTableResp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClearExpTableResp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClearExpTableResp* internal_default_instance() {
+    return reinterpret_cast<const ClearExpTableResp*>(
+               &_ClearExpTableResp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    80;
+
+  friend void swap(ClearExpTableResp& a, ClearExpTableResp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClearExpTableResp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClearExpTableResp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClearExpTableResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearExpTableResp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClearExpTableResp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClearExpTableResp& from) {
+    ClearExpTableResp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClearExpTableResp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.ClearExpTableResp";
+  }
+  protected:
+  explicit ClearExpTableResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResFieldNumber = 1,
+  };
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
+  private:
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.ClearExpTableResp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int res_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NeuronPrimitiveContext final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.NeuronPrimitiveContext) */ {
+ public:
+  inline NeuronPrimitiveContext() : NeuronPrimitiveContext(nullptr) {}
+  ~NeuronPrimitiveContext() override;
+  explicit PROTOBUF_CONSTEXPR NeuronPrimitiveContext(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NeuronPrimitiveContext(const NeuronPrimitiveContext& from);
+  NeuronPrimitiveContext(NeuronPrimitiveContext&& from) noexcept
+    : NeuronPrimitiveContext() {
+    *this = ::std::move(from);
+  }
+
+  inline NeuronPrimitiveContext& operator=(const NeuronPrimitiveContext& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NeuronPrimitiveContext& operator=(NeuronPrimitiveContext&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NeuronPrimitiveContext& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NeuronPrimitiveContext* internal_default_instance() {
+    return reinterpret_cast<const NeuronPrimitiveContext*>(
+               &_NeuronPrimitiveContext_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    81;
+
+  friend void swap(NeuronPrimitiveContext& a, NeuronPrimitiveContext& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NeuronPrimitiveContext* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NeuronPrimitiveContext* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NeuronPrimitiveContext* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NeuronPrimitiveContext>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NeuronPrimitiveContext& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NeuronPrimitiveContext& from) {
+    NeuronPrimitiveContext::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NeuronPrimitiveContext* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.NeuronPrimitiveContext";
+  }
+  protected:
+  explicit NeuronPrimitiveContext(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWeightsFieldNumber = 9,
+    kBiasesFieldNumber = 10,
+    kContextIdFieldNumber = 1,
+    kNumInputsFieldNumber = 2,
+    kNumNeuronsFieldNumber = 3,
+    kInputBitwidthFieldNumber = 4,
+    kOutputBitwidthFieldNumber = 5,
+    kOutputShiftFieldNumber = 6,
+    kInputsAreSignedFieldNumber = 7,
+    kWeightsAreSignedFieldNumber = 8,
+    kActivationFieldNumber = 11,
+  };
+  // repeated sint32 weights = 9;
+  int weights_size() const;
+  private:
+  int _internal_weights_size() const;
+  public:
+  void clear_weights();
+  private:
+  int32_t _internal_weights(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_weights() const;
+  void _internal_add_weights(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_weights();
+  public:
+  int32_t weights(int index) const;
+  void set_weights(int index, int32_t value);
+  void add_weights(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      weights() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_weights();
+
+  // repeated sint32 biases = 10;
+  int biases_size() const;
+  private:
+  int _internal_biases_size() const;
+  public:
+  void clear_biases();
+  private:
+  int32_t _internal_biases(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_biases() const;
+  void _internal_add_biases(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_biases();
+  public:
+  int32_t biases(int index) const;
+  void set_biases(int index, int32_t value);
+  void add_biases(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      biases() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_biases();
+
+  // uint32 contextId = 1;
+  void clear_contextid();
+  uint32_t contextid() const;
+  void set_contextid(uint32_t value);
+  private:
+  uint32_t _internal_contextid() const;
+  void _internal_set_contextid(uint32_t value);
+  public:
+
+  // uint32 numInputs = 2;
+  void clear_numinputs();
+  uint32_t numinputs() const;
+  void set_numinputs(uint32_t value);
+  private:
+  uint32_t _internal_numinputs() const;
+  void _internal_set_numinputs(uint32_t value);
+  public:
+
+  // uint32 numNeurons = 3;
+  void clear_numneurons();
+  uint32_t numneurons() const;
+  void set_numneurons(uint32_t value);
+  private:
+  uint32_t _internal_numneurons() const;
+  void _internal_set_numneurons(uint32_t value);
+  public:
+
+  // uint32 inputBitwidth = 4;
+  void clear_inputbitwidth();
+  uint32_t inputbitwidth() const;
+  void set_inputbitwidth(uint32_t value);
+  private:
+  uint32_t _internal_inputbitwidth() const;
+  void _internal_set_inputbitwidth(uint32_t value);
+  public:
+
+  // uint32 outputBitwidth = 5;
+  void clear_outputbitwidth();
+  uint32_t outputbitwidth() const;
+  void set_outputbitwidth(uint32_t value);
+  private:
+  uint32_t _internal_outputbitwidth() const;
+  void _internal_set_outputbitwidth(uint32_t value);
+  public:
+
+  // uint32 outputShift = 6;
+  void clear_outputshift();
+  uint32_t outputshift() const;
+  void set_outputshift(uint32_t value);
+  private:
+  uint32_t _internal_outputshift() const;
+  void _internal_set_outputshift(uint32_t value);
+  public:
+
+  // bool inputsAreSigned = 7;
+  void clear_inputsaresigned();
+  bool inputsaresigned() const;
+  void set_inputsaresigned(bool value);
+  private:
+  bool _internal_inputsaresigned() const;
+  void _internal_set_inputsaresigned(bool value);
+  public:
+
+  // bool weightsAreSigned = 8;
+  void clear_weightsaresigned();
+  bool weightsaresigned() const;
+  void set_weightsaresigned(bool value);
+  private:
+  bool _internal_weightsaresigned() const;
+  void _internal_set_weightsaresigned(bool value);
+  public:
+
+  // .rp4.ActivationFunction activation = 11;
+  void clear_activation();
+  ::rp4::ActivationFunction activation() const;
+  void set_activation(::rp4::ActivationFunction value);
+  private:
+  ::rp4::ActivationFunction _internal_activation() const;
+  void _internal_set_activation(::rp4::ActivationFunction value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.NeuronPrimitiveContext)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > weights_;
+    mutable std::atomic<int> _weights_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > biases_;
+    mutable std::atomic<int> _biases_cached_byte_size_;
+    uint32_t contextid_;
+    uint32_t numinputs_;
+    uint32_t numneurons_;
+    uint32_t inputbitwidth_;
+    uint32_t outputbitwidth_;
+    uint32_t outputshift_;
+    bool inputsaresigned_;
+    bool weightsaresigned_;
+    int activation_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LoadNeuronPrimitiveContextReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.LoadNeuronPrimitiveContextReq) */ {
+ public:
+  inline LoadNeuronPrimitiveContextReq() : LoadNeuronPrimitiveContextReq(nullptr) {}
+  ~LoadNeuronPrimitiveContextReq() override;
+  explicit PROTOBUF_CONSTEXPR LoadNeuronPrimitiveContextReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LoadNeuronPrimitiveContextReq(const LoadNeuronPrimitiveContextReq& from);
+  LoadNeuronPrimitiveContextReq(LoadNeuronPrimitiveContextReq&& from) noexcept
+    : LoadNeuronPrimitiveContextReq() {
+    *this = ::std::move(from);
+  }
+
+  inline LoadNeuronPrimitiveContextReq& operator=(const LoadNeuronPrimitiveContextReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LoadNeuronPrimitiveContextReq& operator=(LoadNeuronPrimitiveContextReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoadNeuronPrimitiveContextReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LoadNeuronPrimitiveContextReq* internal_default_instance() {
+    return reinterpret_cast<const LoadNeuronPrimitiveContextReq*>(
+               &_LoadNeuronPrimitiveContextReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    82;
+
+  friend void swap(LoadNeuronPrimitiveContextReq& a, LoadNeuronPrimitiveContextReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LoadNeuronPrimitiveContextReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoadNeuronPrimitiveContextReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LoadNeuronPrimitiveContextReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LoadNeuronPrimitiveContextReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LoadNeuronPrimitiveContextReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoadNeuronPrimitiveContextReq& from) {
+    LoadNeuronPrimitiveContextReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LoadNeuronPrimitiveContextReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.LoadNeuronPrimitiveContextReq";
+  }
+  protected:
+  explicit LoadNeuronPrimitiveContextReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContextFieldNumber = 1,
+  };
+  // .rp4.NeuronPrimitiveContext context = 1;
+  bool has_context() const;
+  private:
+  bool _internal_has_context() const;
+  public:
+  void clear_context();
+  const ::rp4::NeuronPrimitiveContext& context() const;
+  PROTOBUF_NODISCARD ::rp4::NeuronPrimitiveContext* release_context();
+  ::rp4::NeuronPrimitiveContext* mutable_context();
+  void set_allocated_context(::rp4::NeuronPrimitiveContext* context);
+  private:
+  const ::rp4::NeuronPrimitiveContext& _internal_context() const;
+  ::rp4::NeuronPrimitiveContext* _internal_mutable_context();
+  public:
+  void unsafe_arena_set_allocated_context(
+      ::rp4::NeuronPrimitiveContext* context);
+  ::rp4::NeuronPrimitiveContext* unsafe_arena_release_context();
+
+  // @@protoc_insertion_point(class_scope:rp4.LoadNeuronPrimitiveContextReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::rp4::NeuronPrimitiveContext* context_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LoadNeuronPrimitiveContextResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.LoadNeuronPrimitiveContextResp) */ {
+ public:
+  inline LoadNeuronPrimitiveContextResp() : LoadNeuronPrimitiveContextResp(nullptr) {}
+  ~LoadNeuronPrimitiveContextResp() override;
+  explicit PROTOBUF_CONSTEXPR LoadNeuronPrimitiveContextResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LoadNeuronPrimitiveContextResp(const LoadNeuronPrimitiveContextResp& from);
+  LoadNeuronPrimitiveContextResp(LoadNeuronPrimitiveContextResp&& from) noexcept
+    : LoadNeuronPrimitiveContextResp() {
+    *this = ::std::move(from);
+  }
+
+  inline LoadNeuronPrimitiveContextResp& operator=(const LoadNeuronPrimitiveContextResp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LoadNeuronPrimitiveContextResp& operator=(LoadNeuronPrimitiveContextResp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoadNeuronPrimitiveContextResp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LoadNeuronPrimitiveContextResp* internal_default_instance() {
+    return reinterpret_cast<const LoadNeuronPrimitiveContextResp*>(
+               &_LoadNeuronPrimitiveContextResp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    83;
+
+  friend void swap(LoadNeuronPrimitiveContextResp& a, LoadNeuronPrimitiveContextResp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LoadNeuronPrimitiveContextResp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoadNeuronPrimitiveContextResp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LoadNeuronPrimitiveContextResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LoadNeuronPrimitiveContextResp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LoadNeuronPrimitiveContextResp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoadNeuronPrimitiveContextResp& from) {
+    LoadNeuronPrimitiveContextResp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LoadNeuronPrimitiveContextResp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.LoadNeuronPrimitiveContextResp";
+  }
+  protected:
+  explicit LoadNeuronPrimitiveContextResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResFieldNumber = 1,
+  };
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
+  private:
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.LoadNeuronPrimitiveContextResp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int res_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClearNeuronPrimitiveContextsReq final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:rp4.ClearNeuronPrimitiveContextsReq) */ {
+ public:
+  inline ClearNeuronPrimitiveContextsReq() : ClearNeuronPrimitiveContextsReq(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ClearNeuronPrimitiveContextsReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClearNeuronPrimitiveContextsReq(const ClearNeuronPrimitiveContextsReq& from);
+  ClearNeuronPrimitiveContextsReq(ClearNeuronPrimitiveContextsReq&& from) noexcept
+    : ClearNeuronPrimitiveContextsReq() {
+    *this = ::std::move(from);
+  }
+
+  inline ClearNeuronPrimitiveContextsReq& operator=(const ClearNeuronPrimitiveContextsReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClearNeuronPrimitiveContextsReq& operator=(ClearNeuronPrimitiveContextsReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClearNeuronPrimitiveContextsReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClearNeuronPrimitiveContextsReq* internal_default_instance() {
+    return reinterpret_cast<const ClearNeuronPrimitiveContextsReq*>(
+               &_ClearNeuronPrimitiveContextsReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    84;
+
+  friend void swap(ClearNeuronPrimitiveContextsReq& a, ClearNeuronPrimitiveContextsReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClearNeuronPrimitiveContextsReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClearNeuronPrimitiveContextsReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClearNeuronPrimitiveContextsReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearNeuronPrimitiveContextsReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ClearNeuronPrimitiveContextsReq& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ClearNeuronPrimitiveContextsReq& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.ClearNeuronPrimitiveContextsReq";
+  }
+  protected:
+  explicit ClearNeuronPrimitiveContextsReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:rp4.ClearNeuronPrimitiveContextsReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClearNeuronPrimitiveContextsResp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rp4.ClearNeuronPrimitiveContextsResp) */ {
+ public:
+  inline ClearNeuronPrimitiveContextsResp() : ClearNeuronPrimitiveContextsResp(nullptr) {}
+  ~ClearNeuronPrimitiveContextsResp() override;
+  explicit PROTOBUF_CONSTEXPR ClearNeuronPrimitiveContextsResp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClearNeuronPrimitiveContextsResp(const ClearNeuronPrimitiveContextsResp& from);
+  ClearNeuronPrimitiveContextsResp(ClearNeuronPrimitiveContextsResp&& from) noexcept
+    : ClearNeuronPrimitiveContextsResp() {
+    *this = ::std::move(from);
+  }
+
+  inline ClearNeuronPrimitiveContextsResp& operator=(const ClearNeuronPrimitiveContextsResp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClearNeuronPrimitiveContextsResp& operator=(ClearNeuronPrimitiveContextsResp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClearNeuronPrimitiveContextsResp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClearNeuronPrimitiveContextsResp* internal_default_instance() {
+    return reinterpret_cast<const ClearNeuronPrimitiveContextsResp*>(
+               &_ClearNeuronPrimitiveContextsResp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    85;
+
+  friend void swap(ClearNeuronPrimitiveContextsResp& a, ClearNeuronPrimitiveContextsResp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClearNeuronPrimitiveContextsResp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClearNeuronPrimitiveContextsResp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClearNeuronPrimitiveContextsResp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClearNeuronPrimitiveContextsResp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClearNeuronPrimitiveContextsResp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClearNeuronPrimitiveContextsResp& from) {
+    ClearNeuronPrimitiveContextsResp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClearNeuronPrimitiveContextsResp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rp4.ClearNeuronPrimitiveContextsResp";
+  }
+  protected:
+  explicit ClearNeuronPrimitiveContextsResp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResFieldNumber = 1,
+  };
+  // .rp4.Res res = 1;
+  void clear_res();
+  ::rp4::Res res() const;
+  void set_res(::rp4::Res value);
+  private:
+  ::rp4::Res _internal_res() const;
+  void _internal_set_res(::rp4::Res value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rp4.ClearNeuronPrimitiveContextsResp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int res_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_5fto_5fdataplane_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// HeaderInfo
+
+// int32 headerId = 1;
+inline void HeaderInfo::clear_headerid() {
+  _impl_.headerid_ = 0;
+}
+inline int32_t HeaderInfo::_internal_headerid() const {
+  return _impl_.headerid_;
+}
+inline int32_t HeaderInfo::headerid() const {
+  // @@protoc_insertion_point(field_get:rp4.HeaderInfo.headerId)
+  return _internal_headerid();
+}
+inline void HeaderInfo::_internal_set_headerid(int32_t value) {
+  
+  _impl_.headerid_ = value;
+}
+inline void HeaderInfo::set_headerid(int32_t value) {
+  _internal_set_headerid(value);
+  // @@protoc_insertion_point(field_set:rp4.HeaderInfo.headerId)
+}
+
+// int32 headerLength = 2;
+inline void HeaderInfo::clear_headerlength() {
+  _impl_.headerlength_ = 0;
+}
+inline int32_t HeaderInfo::_internal_headerlength() const {
+  return _impl_.headerlength_;
+}
+inline int32_t HeaderInfo::headerlength() const {
+  // @@protoc_insertion_point(field_get:rp4.HeaderInfo.headerLength)
+  return _internal_headerlength();
+}
+inline void HeaderInfo::_internal_set_headerlength(int32_t value) {
+  
+  _impl_.headerlength_ = value;
+}
+inline void HeaderInfo::set_headerlength(int32_t value) {
+  _internal_set_headerlength(value);
+  // @@protoc_insertion_point(field_set:rp4.HeaderInfo.headerLength)
+}
+
+// int32 headerOffset = 3;
+inline void HeaderInfo::clear_headeroffset() {
+  _impl_.headeroffset_ = 0;
+}
+inline int32_t HeaderInfo::_internal_headeroffset() const {
+  return _impl_.headeroffset_;
+}
+inline int32_t HeaderInfo::headeroffset() const {
+  // @@protoc_insertion_point(field_get:rp4.HeaderInfo.headerOffset)
+  return _internal_headeroffset();
+}
+inline void HeaderInfo::_internal_set_headeroffset(int32_t value) {
+  
+  _impl_.headeroffset_ = value;
+}
+inline void HeaderInfo::set_headeroffset(int32_t value) {
+  _internal_set_headeroffset(value);
+  // @@protoc_insertion_point(field_set:rp4.HeaderInfo.headerOffset)
+}
+
+// -------------------------------------------------------------------
+
+// SetMetadataReq
+
+// repeated .rp4.HeaderInfo headerInfos = 1;
+inline int SetMetadataReq::_internal_headerinfos_size() const {
+  return _impl_.headerinfos_.size();
+}
+inline int SetMetadataReq::headerinfos_size() const {
+  return _internal_headerinfos_size();
+}
+inline void SetMetadataReq::clear_headerinfos() {
+  _impl_.headerinfos_.Clear();
+}
+inline ::rp4::HeaderInfo* SetMetadataReq::mutable_headerinfos(int index) {
+  // @@protoc_insertion_point(field_mutable:rp4.SetMetadataReq.headerInfos)
+  return _impl_.headerinfos_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::HeaderInfo >*
+SetMetadataReq::mutable_headerinfos() {
+  // @@protoc_insertion_point(field_mutable_list:rp4.SetMetadataReq.headerInfos)
+  return &_impl_.headerinfos_;
+}
+inline const ::rp4::HeaderInfo& SetMetadataReq::_internal_headerinfos(int index) const {
+  return _impl_.headerinfos_.Get(index);
+}
+inline const ::rp4::HeaderInfo& SetMetadataReq::headerinfos(int index) const {
+  // @@protoc_insertion_point(field_get:rp4.SetMetadataReq.headerInfos)
+  return _internal_headerinfos(index);
+}
+inline ::rp4::HeaderInfo* SetMetadataReq::_internal_add_headerinfos() {
+  return _impl_.headerinfos_.Add();
+}
+inline ::rp4::HeaderInfo* SetMetadataReq::add_headerinfos() {
+  ::rp4::HeaderInfo* _add = _internal_add_headerinfos();
+  // @@protoc_insertion_point(field_add:rp4.SetMetadataReq.headerInfos)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::HeaderInfo >&
+SetMetadataReq::headerinfos() const {
+  // @@protoc_insertion_point(field_list:rp4.SetMetadataReq.headerInfos)
+  return _impl_.headerinfos_;
+}
+
+// -------------------------------------------------------------------
+
+// SetMetadataResp
+
+// .rp4.Res res = 1;
+inline void SetMetadataResp::clear_res() {
+  _impl_.res_ = 0;
+}
+inline ::rp4::Res SetMetadataResp::_internal_res() const {
+  return static_cast< ::rp4::Res >(_impl_.res_);
+}
+inline ::rp4::Res SetMetadataResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.SetMetadataResp.res)
+  return _internal_res();
+}
+inline void SetMetadataResp::_internal_set_res(::rp4::Res value) {
+  
+  _impl_.res_ = value;
+}
+inline void SetMetadataResp::set_res(::rp4::Res value) {
+  _internal_set_res(value);
+  // @@protoc_insertion_point(field_set:rp4.SetMetadataResp.res)
+}
+
+// -------------------------------------------------------------------
+
+// ClearStageReq
+
+// int32 procId = 1;
+inline void ClearStageReq::clear_procid() {
+  _impl_.procid_ = 0;
+}
+inline int32_t ClearStageReq::_internal_procid() const {
+  return _impl_.procid_;
+}
+inline int32_t ClearStageReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.ClearStageReq.procId)
+  return _internal_procid();
+}
+inline void ClearStageReq::_internal_set_procid(int32_t value) {
+  
+  _impl_.procid_ = value;
+}
+inline void ClearStageReq::set_procid(int32_t value) {
+  _internal_set_procid(value);
+  // @@protoc_insertion_point(field_set:rp4.ClearStageReq.procId)
+}
+
+// -------------------------------------------------------------------
+
+// BeginConfigReq
+
+// -------------------------------------------------------------------
+
+// BeginConfigResp
+
+// .rp4.Res res = 1;
+inline void BeginConfigResp::clear_res() {
+  _impl_.res_ = 0;
+}
+inline ::rp4::Res BeginConfigResp::_internal_res() const {
+  return static_cast< ::rp4::Res >(_impl_.res_);
+}
+inline ::rp4::Res BeginConfigResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.BeginConfigResp.res)
+  return _internal_res();
+}
+inline void BeginConfigResp::_internal_set_res(::rp4::Res value) {
+  
+  _impl_.res_ = value;
+}
+inline void BeginConfigResp::set_res(::rp4::Res value) {
+  _internal_set_res(value);
+  // @@protoc_insertion_point(field_set:rp4.BeginConfigResp.res)
+}
+
+// -------------------------------------------------------------------
+
+// CommitConfigReq
+
+// -------------------------------------------------------------------
+
+// CommitConfigResp
+
+// .rp4.Res res = 1;
+inline void CommitConfigResp::clear_res() {
+  _impl_.res_ = 0;
+}
+inline ::rp4::Res CommitConfigResp::_internal_res() const {
+  return static_cast< ::rp4::Res >(_impl_.res_);
+}
+inline ::rp4::Res CommitConfigResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.CommitConfigResp.res)
+  return _internal_res();
+}
+inline void CommitConfigResp::_internal_set_res(::rp4::Res value) {
+  
+  _impl_.res_ = value;
+}
+inline void CommitConfigResp::set_res(::rp4::Res value) {
+  _internal_set_res(value);
+  // @@protoc_insertion_point(field_set:rp4.CommitConfigResp.res)
+}
+
+// -------------------------------------------------------------------
+
+// AbortConfigReq
+
+// -------------------------------------------------------------------
+
+// AbortConfigResp
+
+// .rp4.Res res = 1;
+inline void AbortConfigResp::clear_res() {
+  _impl_.res_ = 0;
+}
+inline ::rp4::Res AbortConfigResp::_internal_res() const {
+  return static_cast< ::rp4::Res >(_impl_.res_);
+}
+inline ::rp4::Res AbortConfigResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.AbortConfigResp.res)
+  return _internal_res();
+}
+inline void AbortConfigResp::_internal_set_res(::rp4::Res value) {
+  
+  _impl_.res_ = value;
+}
+inline void AbortConfigResp::set_res(::rp4::Res value) {
+  _internal_set_res(value);
+  // @@protoc_insertion_point(field_set:rp4.AbortConfigResp.res)
+}
+
+// -------------------------------------------------------------------
+
+// ConfigOp
+
+// .rp4.SetMetadataReq setMetadata = 1;
+inline bool ConfigOp::_internal_has_setmetadata() const {
+  return op_case() == kSetMetadata;
+}
+inline bool ConfigOp::has_setmetadata() const {
+  return _internal_has_setmetadata();
+}
+inline void ConfigOp::set_has_setmetadata() {
+  _impl_._oneof_case_[0] = kSetMetadata;
+}
+inline void ConfigOp::clear_setmetadata() {
+  if (_internal_has_setmetadata()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.setmetadata_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::SetMetadataReq* ConfigOp::release_setmetadata() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.setMetadata)
+  if (_internal_has_setmetadata()) {
+    clear_has_op();
+    ::rp4::SetMetadataReq* temp = _impl_.op_.setmetadata_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.setmetadata_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::SetMetadataReq& ConfigOp::_internal_setmetadata() const {
+  return _internal_has_setmetadata()
+      ? *_impl_.op_.setmetadata_
+      : reinterpret_cast< ::rp4::SetMetadataReq&>(::rp4::_SetMetadataReq_default_instance_);
+}
+inline const ::rp4::SetMetadataReq& ConfigOp::setmetadata() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.setMetadata)
+  return _internal_setmetadata();
+}
+inline ::rp4::SetMetadataReq* ConfigOp::unsafe_arena_release_setmetadata() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.setMetadata)
+  if (_internal_has_setmetadata()) {
+    clear_has_op();
+    ::rp4::SetMetadataReq* temp = _impl_.op_.setmetadata_;
+    _impl_.op_.setmetadata_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_setmetadata(::rp4::SetMetadataReq* setmetadata) {
+  clear_op();
+  if (setmetadata) {
+    set_has_setmetadata();
+    _impl_.op_.setmetadata_ = setmetadata;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.setMetadata)
+}
+inline ::rp4::SetMetadataReq* ConfigOp::_internal_mutable_setmetadata() {
+  if (!_internal_has_setmetadata()) {
+    clear_op();
+    set_has_setmetadata();
+    _impl_.op_.setmetadata_ = CreateMaybeMessage< ::rp4::SetMetadataReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.setmetadata_;
+}
+inline ::rp4::SetMetadataReq* ConfigOp::mutable_setmetadata() {
+  ::rp4::SetMetadataReq* _msg = _internal_mutable_setmetadata();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.setMetadata)
+  return _msg;
+}
+
+// .rp4.ParserLevelReq initParserLevel = 2;
+inline bool ConfigOp::_internal_has_initparserlevel() const {
+  return op_case() == kInitParserLevel;
+}
+inline bool ConfigOp::has_initparserlevel() const {
+  return _internal_has_initparserlevel();
+}
+inline void ConfigOp::set_has_initparserlevel() {
+  _impl_._oneof_case_[0] = kInitParserLevel;
+}
+inline void ConfigOp::clear_initparserlevel() {
+  if (_internal_has_initparserlevel()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.initparserlevel_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::ParserLevelReq* ConfigOp::release_initparserlevel() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.initParserLevel)
+  if (_internal_has_initparserlevel()) {
+    clear_has_op();
+    ::rp4::ParserLevelReq* temp = _impl_.op_.initparserlevel_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.initparserlevel_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::ParserLevelReq& ConfigOp::_internal_initparserlevel() const {
+  return _internal_has_initparserlevel()
+      ? *_impl_.op_.initparserlevel_
+      : reinterpret_cast< ::rp4::ParserLevelReq&>(::rp4::_ParserLevelReq_default_instance_);
+}
+inline const ::rp4::ParserLevelReq& ConfigOp::initparserlevel() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.initParserLevel)
+  return _internal_initparserlevel();
+}
+inline ::rp4::ParserLevelReq* ConfigOp::unsafe_arena_release_initparserlevel() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.initParserLevel)
+  if (_internal_has_initparserlevel()) {
+    clear_has_op();
+    ::rp4::ParserLevelReq* temp = _impl_.op_.initparserlevel_;
+    _impl_.op_.initparserlevel_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_initparserlevel(::rp4::ParserLevelReq* initparserlevel) {
+  clear_op();
+  if (initparserlevel) {
+    set_has_initparserlevel();
+    _impl_.op_.initparserlevel_ = initparserlevel;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.initParserLevel)
+}
+inline ::rp4::ParserLevelReq* ConfigOp::_internal_mutable_initparserlevel() {
+  if (!_internal_has_initparserlevel()) {
+    clear_op();
+    set_has_initparserlevel();
+    _impl_.op_.initparserlevel_ = CreateMaybeMessage< ::rp4::ParserLevelReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.initparserlevel_;
+}
+inline ::rp4::ParserLevelReq* ConfigOp::mutable_initparserlevel() {
+  ::rp4::ParserLevelReq* _msg = _internal_mutable_initparserlevel();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.initParserLevel)
+  return _msg;
+}
+
+// .rp4.ModParserEntryReq modParserEntry = 3;
+inline bool ConfigOp::_internal_has_modparserentry() const {
+  return op_case() == kModParserEntry;
+}
+inline bool ConfigOp::has_modparserentry() const {
+  return _internal_has_modparserentry();
+}
+inline void ConfigOp::set_has_modparserentry() {
+  _impl_._oneof_case_[0] = kModParserEntry;
+}
+inline void ConfigOp::clear_modparserentry() {
+  if (_internal_has_modparserentry()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.modparserentry_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::ModParserEntryReq* ConfigOp::release_modparserentry() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.modParserEntry)
+  if (_internal_has_modparserentry()) {
+    clear_has_op();
+    ::rp4::ModParserEntryReq* temp = _impl_.op_.modparserentry_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.modparserentry_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::ModParserEntryReq& ConfigOp::_internal_modparserentry() const {
+  return _internal_has_modparserentry()
+      ? *_impl_.op_.modparserentry_
+      : reinterpret_cast< ::rp4::ModParserEntryReq&>(::rp4::_ModParserEntryReq_default_instance_);
+}
+inline const ::rp4::ModParserEntryReq& ConfigOp::modparserentry() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.modParserEntry)
+  return _internal_modparserentry();
+}
+inline ::rp4::ModParserEntryReq* ConfigOp::unsafe_arena_release_modparserentry() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.modParserEntry)
+  if (_internal_has_modparserentry()) {
+    clear_has_op();
+    ::rp4::ModParserEntryReq* temp = _impl_.op_.modparserentry_;
+    _impl_.op_.modparserentry_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_modparserentry(::rp4::ModParserEntryReq* modparserentry) {
+  clear_op();
+  if (modparserentry) {
+    set_has_modparserentry();
+    _impl_.op_.modparserentry_ = modparserentry;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.modParserEntry)
+}
+inline ::rp4::ModParserEntryReq* ConfigOp::_internal_mutable_modparserentry() {
+  if (!_internal_has_modparserentry()) {
+    clear_op();
+    set_has_modparserentry();
+    _impl_.op_.modparserentry_ = CreateMaybeMessage< ::rp4::ModParserEntryReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.modparserentry_;
+}
+inline ::rp4::ModParserEntryReq* ConfigOp::mutable_modparserentry() {
+  ::rp4::ModParserEntryReq* _msg = _internal_mutable_modparserentry();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.modParserEntry)
+  return _msg;
+}
+
+// .rp4.ClearParserReq clearParser = 4;
+inline bool ConfigOp::_internal_has_clearparser() const {
+  return op_case() == kClearParser;
+}
+inline bool ConfigOp::has_clearparser() const {
+  return _internal_has_clearparser();
+}
+inline void ConfigOp::set_has_clearparser() {
+  _impl_._oneof_case_[0] = kClearParser;
+}
+inline void ConfigOp::clear_clearparser() {
+  if (_internal_has_clearparser()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.clearparser_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::ClearParserReq* ConfigOp::release_clearparser() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.clearParser)
+  if (_internal_has_clearparser()) {
+    clear_has_op();
+    ::rp4::ClearParserReq* temp = _impl_.op_.clearparser_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.clearparser_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::ClearParserReq& ConfigOp::_internal_clearparser() const {
+  return _internal_has_clearparser()
+      ? *_impl_.op_.clearparser_
+      : reinterpret_cast< ::rp4::ClearParserReq&>(::rp4::_ClearParserReq_default_instance_);
+}
+inline const ::rp4::ClearParserReq& ConfigOp::clearparser() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.clearParser)
+  return _internal_clearparser();
+}
+inline ::rp4::ClearParserReq* ConfigOp::unsafe_arena_release_clearparser() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.clearParser)
+  if (_internal_has_clearparser()) {
+    clear_has_op();
+    ::rp4::ClearParserReq* temp = _impl_.op_.clearparser_;
+    _impl_.op_.clearparser_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_clearparser(::rp4::ClearParserReq* clearparser) {
+  clear_op();
+  if (clearparser) {
+    set_has_clearparser();
+    _impl_.op_.clearparser_ = clearparser;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.clearParser)
+}
+inline ::rp4::ClearParserReq* ConfigOp::_internal_mutable_clearparser() {
+  if (!_internal_has_clearparser()) {
+    clear_op();
+    set_has_clearparser();
+    _impl_.op_.clearparser_ = CreateMaybeMessage< ::rp4::ClearParserReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.clearparser_;
+}
+inline ::rp4::ClearParserReq* ConfigOp::mutable_clearparser() {
+  ::rp4::ClearParserReq* _msg = _internal_mutable_clearparser();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.clearParser)
+  return _msg;
+}
+
+// .rp4.InsertRelationExpReq insertRelationExp = 5;
+inline bool ConfigOp::_internal_has_insertrelationexp() const {
+  return op_case() == kInsertRelationExp;
+}
+inline bool ConfigOp::has_insertrelationexp() const {
+  return _internal_has_insertrelationexp();
+}
+inline void ConfigOp::set_has_insertrelationexp() {
+  _impl_._oneof_case_[0] = kInsertRelationExp;
+}
+inline void ConfigOp::clear_insertrelationexp() {
+  if (_internal_has_insertrelationexp()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.insertrelationexp_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::InsertRelationExpReq* ConfigOp::release_insertrelationexp() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.insertRelationExp)
+  if (_internal_has_insertrelationexp()) {
+    clear_has_op();
+    ::rp4::InsertRelationExpReq* temp = _impl_.op_.insertrelationexp_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.insertrelationexp_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::InsertRelationExpReq& ConfigOp::_internal_insertrelationexp() const {
+  return _internal_has_insertrelationexp()
+      ? *_impl_.op_.insertrelationexp_
+      : reinterpret_cast< ::rp4::InsertRelationExpReq&>(::rp4::_InsertRelationExpReq_default_instance_);
+}
+inline const ::rp4::InsertRelationExpReq& ConfigOp::insertrelationexp() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.insertRelationExp)
+  return _internal_insertrelationexp();
+}
+inline ::rp4::InsertRelationExpReq* ConfigOp::unsafe_arena_release_insertrelationexp() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.insertRelationExp)
+  if (_internal_has_insertrelationexp()) {
+    clear_has_op();
+    ::rp4::InsertRelationExpReq* temp = _impl_.op_.insertrelationexp_;
+    _impl_.op_.insertrelationexp_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_insertrelationexp(::rp4::InsertRelationExpReq* insertrelationexp) {
+  clear_op();
+  if (insertrelationexp) {
+    set_has_insertrelationexp();
+    _impl_.op_.insertrelationexp_ = insertrelationexp;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.insertRelationExp)
+}
+inline ::rp4::InsertRelationExpReq* ConfigOp::_internal_mutable_insertrelationexp() {
+  if (!_internal_has_insertrelationexp()) {
+    clear_op();
+    set_has_insertrelationexp();
+    _impl_.op_.insertrelationexp_ = CreateMaybeMessage< ::rp4::InsertRelationExpReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.insertrelationexp_;
+}
+inline ::rp4::InsertRelationExpReq* ConfigOp::mutable_insertrelationexp() {
+  ::rp4::InsertRelationExpReq* _msg = _internal_mutable_insertrelationexp();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.insertRelationExp)
+  return _msg;
+}
+
+// .rp4.ClearRelationExpReq clearRelationExp = 6;
+inline bool ConfigOp::_internal_has_clearrelationexp() const {
+  return op_case() == kClearRelationExp;
+}
+inline bool ConfigOp::has_clearrelationexp() const {
+  return _internal_has_clearrelationexp();
+}
+inline void ConfigOp::set_has_clearrelationexp() {
+  _impl_._oneof_case_[0] = kClearRelationExp;
+}
+inline void ConfigOp::clear_clearrelationexp() {
+  if (_internal_has_clearrelationexp()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.clearrelationexp_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::ClearRelationExpReq* ConfigOp::release_clearrelationexp() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.clearRelationExp)
+  if (_internal_has_clearrelationexp()) {
+    clear_has_op();
+    ::rp4::ClearRelationExpReq* temp = _impl_.op_.clearrelationexp_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.clearrelationexp_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::ClearRelationExpReq& ConfigOp::_internal_clearrelationexp() const {
+  return _internal_has_clearrelationexp()
+      ? *_impl_.op_.clearrelationexp_
+      : reinterpret_cast< ::rp4::ClearRelationExpReq&>(::rp4::_ClearRelationExpReq_default_instance_);
+}
+inline const ::rp4::ClearRelationExpReq& ConfigOp::clearrelationexp() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.clearRelationExp)
+  return _internal_clearrelationexp();
+}
+inline ::rp4::ClearRelationExpReq* ConfigOp::unsafe_arena_release_clearrelationexp() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.clearRelationExp)
+  if (_internal_has_clearrelationexp()) {
+    clear_has_op();
+    ::rp4::ClearRelationExpReq* temp = _impl_.op_.clearrelationexp_;
+    _impl_.op_.clearrelationexp_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_clearrelationexp(::rp4::ClearRelationExpReq* clearrelationexp) {
+  clear_op();
+  if (clearrelationexp) {
+    set_has_clearrelationexp();
+    _impl_.op_.clearrelationexp_ = clearrelationexp;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.clearRelationExp)
+}
+inline ::rp4::ClearRelationExpReq* ConfigOp::_internal_mutable_clearrelationexp() {
+  if (!_internal_has_clearrelationexp()) {
+    clear_op();
+    set_has_clearrelationexp();
+    _impl_.op_.clearrelationexp_ = CreateMaybeMessage< ::rp4::ClearRelationExpReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.clearrelationexp_;
+}
+inline ::rp4::ClearRelationExpReq* ConfigOp::mutable_clearrelationexp() {
+  ::rp4::ClearRelationExpReq* _msg = _internal_mutable_clearrelationexp();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.clearRelationExp)
+  return _msg;
+}
+
+// .rp4.ClearResMapReq clearResMap = 7;
+inline bool ConfigOp::_internal_has_clearresmap() const {
+  return op_case() == kClearResMap;
+}
+inline bool ConfigOp::has_clearresmap() const {
+  return _internal_has_clearresmap();
+}
+inline void ConfigOp::set_has_clearresmap() {
+  _impl_._oneof_case_[0] = kClearResMap;
+}
+inline void ConfigOp::clear_clearresmap() {
+  if (_internal_has_clearresmap()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.clearresmap_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::ClearResMapReq* ConfigOp::release_clearresmap() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.clearResMap)
+  if (_internal_has_clearresmap()) {
+    clear_has_op();
+    ::rp4::ClearResMapReq* temp = _impl_.op_.clearresmap_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.clearresmap_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::ClearResMapReq& ConfigOp::_internal_clearresmap() const {
+  return _internal_has_clearresmap()
+      ? *_impl_.op_.clearresmap_
+      : reinterpret_cast< ::rp4::ClearResMapReq&>(::rp4::_ClearResMapReq_default_instance_);
+}
+inline const ::rp4::ClearResMapReq& ConfigOp::clearresmap() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.clearResMap)
+  return _internal_clearresmap();
+}
+inline ::rp4::ClearResMapReq* ConfigOp::unsafe_arena_release_clearresmap() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.clearResMap)
+  if (_internal_has_clearresmap()) {
+    clear_has_op();
+    ::rp4::ClearResMapReq* temp = _impl_.op_.clearresmap_;
+    _impl_.op_.clearresmap_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_clearresmap(::rp4::ClearResMapReq* clearresmap) {
+  clear_op();
+  if (clearresmap) {
+    set_has_clearresmap();
+    _impl_.op_.clearresmap_ = clearresmap;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.clearResMap)
+}
+inline ::rp4::ClearResMapReq* ConfigOp::_internal_mutable_clearresmap() {
+  if (!_internal_has_clearresmap()) {
+    clear_op();
+    set_has_clearresmap();
+    _impl_.op_.clearresmap_ = CreateMaybeMessage< ::rp4::ClearResMapReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.clearresmap_;
+}
+inline ::rp4::ClearResMapReq* ConfigOp::mutable_clearresmap() {
+  ::rp4::ClearResMapReq* _msg = _internal_mutable_clearresmap();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.clearResMap)
+  return _msg;
+}
+
+// .rp4.ModResMapReq modResMap = 8;
+inline bool ConfigOp::_internal_has_modresmap() const {
+  return op_case() == kModResMap;
+}
+inline bool ConfigOp::has_modresmap() const {
+  return _internal_has_modresmap();
+}
+inline void ConfigOp::set_has_modresmap() {
+  _impl_._oneof_case_[0] = kModResMap;
+}
+inline void ConfigOp::clear_modresmap() {
+  if (_internal_has_modresmap()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.modresmap_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::ModResMapReq* ConfigOp::release_modresmap() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.modResMap)
+  if (_internal_has_modresmap()) {
+    clear_has_op();
+    ::rp4::ModResMapReq* temp = _impl_.op_.modresmap_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.modresmap_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::ModResMapReq& ConfigOp::_internal_modresmap() const {
+  return _internal_has_modresmap()
+      ? *_impl_.op_.modresmap_
+      : reinterpret_cast< ::rp4::ModResMapReq&>(::rp4::_ModResMapReq_default_instance_);
+}
+inline const ::rp4::ModResMapReq& ConfigOp::modresmap() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.modResMap)
+  return _internal_modresmap();
+}
+inline ::rp4::ModResMapReq* ConfigOp::unsafe_arena_release_modresmap() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.modResMap)
+  if (_internal_has_modresmap()) {
+    clear_has_op();
+    ::rp4::ModResMapReq* temp = _impl_.op_.modresmap_;
+    _impl_.op_.modresmap_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_modresmap(::rp4::ModResMapReq* modresmap) {
+  clear_op();
+  if (modresmap) {
+    set_has_modresmap();
+    _impl_.op_.modresmap_ = modresmap;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.modResMap)
+}
+inline ::rp4::ModResMapReq* ConfigOp::_internal_mutable_modresmap() {
+  if (!_internal_has_modresmap()) {
+    clear_op();
+    set_has_modresmap();
+    _impl_.op_.modresmap_ = CreateMaybeMessage< ::rp4::ModResMapReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.modresmap_;
+}
+inline ::rp4::ModResMapReq* ConfigOp::mutable_modresmap() {
+  ::rp4::ModResMapReq* _msg = _internal_mutable_modresmap();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.modResMap)
+  return _msg;
+}
+
+// .rp4.SetDefaultGateEntryReq setDefaultGateEntry = 9;
+inline bool ConfigOp::_internal_has_setdefaultgateentry() const {
+  return op_case() == kSetDefaultGateEntry;
+}
+inline bool ConfigOp::has_setdefaultgateentry() const {
+  return _internal_has_setdefaultgateentry();
+}
+inline void ConfigOp::set_has_setdefaultgateentry() {
+  _impl_._oneof_case_[0] = kSetDefaultGateEntry;
+}
+inline void ConfigOp::clear_setdefaultgateentry() {
+  if (_internal_has_setdefaultgateentry()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.setdefaultgateentry_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::SetDefaultGateEntryReq* ConfigOp::release_setdefaultgateentry() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.setDefaultGateEntry)
+  if (_internal_has_setdefaultgateentry()) {
+    clear_has_op();
+    ::rp4::SetDefaultGateEntryReq* temp = _impl_.op_.setdefaultgateentry_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.setdefaultgateentry_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::SetDefaultGateEntryReq& ConfigOp::_internal_setdefaultgateentry() const {
+  return _internal_has_setdefaultgateentry()
+      ? *_impl_.op_.setdefaultgateentry_
+      : reinterpret_cast< ::rp4::SetDefaultGateEntryReq&>(::rp4::_SetDefaultGateEntryReq_default_instance_);
+}
+inline const ::rp4::SetDefaultGateEntryReq& ConfigOp::setdefaultgateentry() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.setDefaultGateEntry)
+  return _internal_setdefaultgateentry();
+}
+inline ::rp4::SetDefaultGateEntryReq* ConfigOp::unsafe_arena_release_setdefaultgateentry() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.setDefaultGateEntry)
+  if (_internal_has_setdefaultgateentry()) {
+    clear_has_op();
+    ::rp4::SetDefaultGateEntryReq* temp = _impl_.op_.setdefaultgateentry_;
+    _impl_.op_.setdefaultgateentry_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_setdefaultgateentry(::rp4::SetDefaultGateEntryReq* setdefaultgateentry) {
+  clear_op();
+  if (setdefaultgateentry) {
+    set_has_setdefaultgateentry();
+    _impl_.op_.setdefaultgateentry_ = setdefaultgateentry;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.setDefaultGateEntry)
+}
+inline ::rp4::SetDefaultGateEntryReq* ConfigOp::_internal_mutable_setdefaultgateentry() {
+  if (!_internal_has_setdefaultgateentry()) {
+    clear_op();
+    set_has_setdefaultgateentry();
+    _impl_.op_.setdefaultgateentry_ = CreateMaybeMessage< ::rp4::SetDefaultGateEntryReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.setdefaultgateentry_;
+}
+inline ::rp4::SetDefaultGateEntryReq* ConfigOp::mutable_setdefaultgateentry() {
+  ::rp4::SetDefaultGateEntryReq* _msg = _internal_mutable_setdefaultgateentry();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.setDefaultGateEntry)
+  return _msg;
+}
+
+// .rp4.SetNoTableReq setNoTable = 10;
+inline bool ConfigOp::_internal_has_setnotable() const {
+  return op_case() == kSetNoTable;
+}
+inline bool ConfigOp::has_setnotable() const {
+  return _internal_has_setnotable();
+}
+inline void ConfigOp::set_has_setnotable() {
+  _impl_._oneof_case_[0] = kSetNoTable;
+}
+inline void ConfigOp::clear_setnotable() {
+  if (_internal_has_setnotable()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.setnotable_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::SetNoTableReq* ConfigOp::release_setnotable() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.setNoTable)
+  if (_internal_has_setnotable()) {
+    clear_has_op();
+    ::rp4::SetNoTableReq* temp = _impl_.op_.setnotable_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.setnotable_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::SetNoTableReq& ConfigOp::_internal_setnotable() const {
+  return _internal_has_setnotable()
+      ? *_impl_.op_.setnotable_
+      : reinterpret_cast< ::rp4::SetNoTableReq&>(::rp4::_SetNoTableReq_default_instance_);
+}
+inline const ::rp4::SetNoTableReq& ConfigOp::setnotable() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.setNoTable)
+  return _internal_setnotable();
+}
+inline ::rp4::SetNoTableReq* ConfigOp::unsafe_arena_release_setnotable() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.setNoTable)
+  if (_internal_has_setnotable()) {
+    clear_has_op();
+    ::rp4::SetNoTableReq* temp = _impl_.op_.setnotable_;
+    _impl_.op_.setnotable_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_setnotable(::rp4::SetNoTableReq* setnotable) {
+  clear_op();
+  if (setnotable) {
+    set_has_setnotable();
+    _impl_.op_.setnotable_ = setnotable;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.setNoTable)
+}
+inline ::rp4::SetNoTableReq* ConfigOp::_internal_mutable_setnotable() {
+  if (!_internal_has_setnotable()) {
+    clear_op();
+    set_has_setnotable();
+    _impl_.op_.setnotable_ = CreateMaybeMessage< ::rp4::SetNoTableReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.setnotable_;
+}
+inline ::rp4::SetNoTableReq* ConfigOp::mutable_setnotable() {
+  ::rp4::SetNoTableReq* _msg = _internal_mutable_setnotable();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.setNoTable)
+  return _msg;
+}
+
+// .rp4.SetActionProcReq setActionProc = 11;
+inline bool ConfigOp::_internal_has_setactionproc() const {
+  return op_case() == kSetActionProc;
+}
+inline bool ConfigOp::has_setactionproc() const {
+  return _internal_has_setactionproc();
+}
+inline void ConfigOp::set_has_setactionproc() {
+  _impl_._oneof_case_[0] = kSetActionProc;
+}
+inline void ConfigOp::clear_setactionproc() {
+  if (_internal_has_setactionproc()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.setactionproc_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::SetActionProcReq* ConfigOp::release_setactionproc() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.setActionProc)
+  if (_internal_has_setactionproc()) {
+    clear_has_op();
+    ::rp4::SetActionProcReq* temp = _impl_.op_.setactionproc_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.setactionproc_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::SetActionProcReq& ConfigOp::_internal_setactionproc() const {
+  return _internal_has_setactionproc()
+      ? *_impl_.op_.setactionproc_
+      : reinterpret_cast< ::rp4::SetActionProcReq&>(::rp4::_SetActionProcReq_default_instance_);
+}
+inline const ::rp4::SetActionProcReq& ConfigOp::setactionproc() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.setActionProc)
+  return _internal_setactionproc();
+}
+inline ::rp4::SetActionProcReq* ConfigOp::unsafe_arena_release_setactionproc() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.setActionProc)
+  if (_internal_has_setactionproc()) {
+    clear_has_op();
+    ::rp4::SetActionProcReq* temp = _impl_.op_.setactionproc_;
+    _impl_.op_.setactionproc_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_setactionproc(::rp4::SetActionProcReq* setactionproc) {
+  clear_op();
+  if (setactionproc) {
+    set_has_setactionproc();
+    _impl_.op_.setactionproc_ = setactionproc;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.setActionProc)
+}
+inline ::rp4::SetActionProcReq* ConfigOp::_internal_mutable_setactionproc() {
+  if (!_internal_has_setactionproc()) {
+    clear_op();
+    set_has_setactionproc();
+    _impl_.op_.setactionproc_ = CreateMaybeMessage< ::rp4::SetActionProcReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.setactionproc_;
+}
+inline ::rp4::SetActionProcReq* ConfigOp::mutable_setactionproc() {
+  ::rp4::SetActionProcReq* _msg = _internal_mutable_setactionproc();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.setActionProc)
+  return _msg;
+}
+
+// .rp4.SetMemConfigReq setMemConfig = 12;
+inline bool ConfigOp::_internal_has_setmemconfig() const {
+  return op_case() == kSetMemConfig;
+}
+inline bool ConfigOp::has_setmemconfig() const {
+  return _internal_has_setmemconfig();
+}
+inline void ConfigOp::set_has_setmemconfig() {
+  _impl_._oneof_case_[0] = kSetMemConfig;
+}
+inline void ConfigOp::clear_setmemconfig() {
+  if (_internal_has_setmemconfig()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.setmemconfig_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::SetMemConfigReq* ConfigOp::release_setmemconfig() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.setMemConfig)
+  if (_internal_has_setmemconfig()) {
+    clear_has_op();
+    ::rp4::SetMemConfigReq* temp = _impl_.op_.setmemconfig_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.setmemconfig_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::SetMemConfigReq& ConfigOp::_internal_setmemconfig() const {
+  return _internal_has_setmemconfig()
+      ? *_impl_.op_.setmemconfig_
+      : reinterpret_cast< ::rp4::SetMemConfigReq&>(::rp4::_SetMemConfigReq_default_instance_);
+}
+inline const ::rp4::SetMemConfigReq& ConfigOp::setmemconfig() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.setMemConfig)
+  return _internal_setmemconfig();
+}
+inline ::rp4::SetMemConfigReq* ConfigOp::unsafe_arena_release_setmemconfig() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.setMemConfig)
+  if (_internal_has_setmemconfig()) {
+    clear_has_op();
+    ::rp4::SetMemConfigReq* temp = _impl_.op_.setmemconfig_;
+    _impl_.op_.setmemconfig_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_setmemconfig(::rp4::SetMemConfigReq* setmemconfig) {
+  clear_op();
+  if (setmemconfig) {
+    set_has_setmemconfig();
+    _impl_.op_.setmemconfig_ = setmemconfig;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.setMemConfig)
+}
+inline ::rp4::SetMemConfigReq* ConfigOp::_internal_mutable_setmemconfig() {
+  if (!_internal_has_setmemconfig()) {
+    clear_op();
+    set_has_setmemconfig();
+    _impl_.op_.setmemconfig_ = CreateMaybeMessage< ::rp4::SetMemConfigReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.setmemconfig_;
+}
+inline ::rp4::SetMemConfigReq* ConfigOp::mutable_setmemconfig() {
+  ::rp4::SetMemConfigReq* _msg = _internal_mutable_setmemconfig();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.setMemConfig)
+  return _msg;
+}
+
+// .rp4.SetFieldInfoReq setFieldInfo = 13;
+inline bool ConfigOp::_internal_has_setfieldinfo() const {
+  return op_case() == kSetFieldInfo;
+}
+inline bool ConfigOp::has_setfieldinfo() const {
+  return _internal_has_setfieldinfo();
+}
+inline void ConfigOp::set_has_setfieldinfo() {
+  _impl_._oneof_case_[0] = kSetFieldInfo;
+}
+inline void ConfigOp::clear_setfieldinfo() {
+  if (_internal_has_setfieldinfo()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.setfieldinfo_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::SetFieldInfoReq* ConfigOp::release_setfieldinfo() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.setFieldInfo)
+  if (_internal_has_setfieldinfo()) {
+    clear_has_op();
+    ::rp4::SetFieldInfoReq* temp = _impl_.op_.setfieldinfo_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.setfieldinfo_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::SetFieldInfoReq& ConfigOp::_internal_setfieldinfo() const {
+  return _internal_has_setfieldinfo()
+      ? *_impl_.op_.setfieldinfo_
+      : reinterpret_cast< ::rp4::SetFieldInfoReq&>(::rp4::_SetFieldInfoReq_default_instance_);
+}
+inline const ::rp4::SetFieldInfoReq& ConfigOp::setfieldinfo() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.setFieldInfo)
+  return _internal_setfieldinfo();
+}
+inline ::rp4::SetFieldInfoReq* ConfigOp::unsafe_arena_release_setfieldinfo() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.setFieldInfo)
+  if (_internal_has_setfieldinfo()) {
+    clear_has_op();
+    ::rp4::SetFieldInfoReq* temp = _impl_.op_.setfieldinfo_;
+    _impl_.op_.setfieldinfo_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_setfieldinfo(::rp4::SetFieldInfoReq* setfieldinfo) {
+  clear_op();
+  if (setfieldinfo) {
+    set_has_setfieldinfo();
+    _impl_.op_.setfieldinfo_ = setfieldinfo;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.setFieldInfo)
+}
+inline ::rp4::SetFieldInfoReq* ConfigOp::_internal_mutable_setfieldinfo() {
+  if (!_internal_has_setfieldinfo()) {
+    clear_op();
+    set_has_setfieldinfo();
+    _impl_.op_.setfieldinfo_ = CreateMaybeMessage< ::rp4::SetFieldInfoReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.setfieldinfo_;
+}
+inline ::rp4::SetFieldInfoReq* ConfigOp::mutable_setfieldinfo() {
+  ::rp4::SetFieldInfoReq* _msg = _internal_mutable_setfieldinfo();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.setFieldInfo)
+  return _msg;
+}
+
+// .rp4.ClearOldConfigReq clearOldConfig = 14;
+inline bool ConfigOp::_internal_has_clearoldconfig() const {
+  return op_case() == kClearOldConfig;
+}
+inline bool ConfigOp::has_clearoldconfig() const {
+  return _internal_has_clearoldconfig();
+}
+inline void ConfigOp::set_has_clearoldconfig() {
+  _impl_._oneof_case_[0] = kClearOldConfig;
+}
+inline void ConfigOp::clear_clearoldconfig() {
+  if (_internal_has_clearoldconfig()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.clearoldconfig_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::ClearOldConfigReq* ConfigOp::release_clearoldconfig() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.clearOldConfig)
+  if (_internal_has_clearoldconfig()) {
+    clear_has_op();
+    ::rp4::ClearOldConfigReq* temp = _impl_.op_.clearoldconfig_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.clearoldconfig_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::ClearOldConfigReq& ConfigOp::_internal_clearoldconfig() const {
+  return _internal_has_clearoldconfig()
+      ? *_impl_.op_.clearoldconfig_
+      : reinterpret_cast< ::rp4::ClearOldConfigReq&>(::rp4::_ClearOldConfigReq_default_instance_);
+}
+inline const ::rp4::ClearOldConfigReq& ConfigOp::clearoldconfig() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.clearOldConfig)
+  return _internal_clearoldconfig();
+}
+inline ::rp4::ClearOldConfigReq* ConfigOp::unsafe_arena_release_clearoldconfig() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.clearOldConfig)
+  if (_internal_has_clearoldconfig()) {
+    clear_has_op();
+    ::rp4::ClearOldConfigReq* temp = _impl_.op_.clearoldconfig_;
+    _impl_.op_.clearoldconfig_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_clearoldconfig(::rp4::ClearOldConfigReq* clearoldconfig) {
+  clear_op();
+  if (clearoldconfig) {
+    set_has_clearoldconfig();
+    _impl_.op_.clearoldconfig_ = clearoldconfig;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.clearOldConfig)
+}
+inline ::rp4::ClearOldConfigReq* ConfigOp::_internal_mutable_clearoldconfig() {
+  if (!_internal_has_clearoldconfig()) {
+    clear_op();
+    set_has_clearoldconfig();
+    _impl_.op_.clearoldconfig_ = CreateMaybeMessage< ::rp4::ClearOldConfigReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.clearoldconfig_;
+}
+inline ::rp4::ClearOldConfigReq* ConfigOp::mutable_clearoldconfig() {
+  ::rp4::ClearOldConfigReq* _msg = _internal_mutable_clearoldconfig();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.clearOldConfig)
+  return _msg;
+}
+
+// .rp4.SetMissActIdReq setMissActId = 15;
+inline bool ConfigOp::_internal_has_setmissactid() const {
+  return op_case() == kSetMissActId;
+}
+inline bool ConfigOp::has_setmissactid() const {
+  return _internal_has_setmissactid();
+}
+inline void ConfigOp::set_has_setmissactid() {
+  _impl_._oneof_case_[0] = kSetMissActId;
+}
+inline void ConfigOp::clear_setmissactid() {
+  if (_internal_has_setmissactid()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.setmissactid_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::SetMissActIdReq* ConfigOp::release_setmissactid() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.setMissActId)
+  if (_internal_has_setmissactid()) {
+    clear_has_op();
+    ::rp4::SetMissActIdReq* temp = _impl_.op_.setmissactid_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.setmissactid_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::SetMissActIdReq& ConfigOp::_internal_setmissactid() const {
+  return _internal_has_setmissactid()
+      ? *_impl_.op_.setmissactid_
+      : reinterpret_cast< ::rp4::SetMissActIdReq&>(::rp4::_SetMissActIdReq_default_instance_);
+}
+inline const ::rp4::SetMissActIdReq& ConfigOp::setmissactid() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.setMissActId)
+  return _internal_setmissactid();
+}
+inline ::rp4::SetMissActIdReq* ConfigOp::unsafe_arena_release_setmissactid() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.setMissActId)
+  if (_internal_has_setmissactid()) {
+    clear_has_op();
+    ::rp4::SetMissActIdReq* temp = _impl_.op_.setmissactid_;
+    _impl_.op_.setmissactid_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_setmissactid(::rp4::SetMissActIdReq* setmissactid) {
+  clear_op();
+  if (setmissactid) {
+    set_has_setmissactid();
+    _impl_.op_.setmissactid_ = setmissactid;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.setMissActId)
+}
+inline ::rp4::SetMissActIdReq* ConfigOp::_internal_mutable_setmissactid() {
+  if (!_internal_has_setmissactid()) {
+    clear_op();
+    set_has_setmissactid();
+    _impl_.op_.setmissactid_ = CreateMaybeMessage< ::rp4::SetMissActIdReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.setmissactid_;
+}
+inline ::rp4::SetMissActIdReq* ConfigOp::mutable_setmissactid() {
+  ::rp4::SetMissActIdReq* _msg = _internal_mutable_setmissactid();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.setMissActId)
+  return _msg;
+}
+
+// .rp4.InsertActionReq insertAction = 16;
+inline bool ConfigOp::_internal_has_insertaction() const {
+  return op_case() == kInsertAction;
+}
+inline bool ConfigOp::has_insertaction() const {
+  return _internal_has_insertaction();
+}
+inline void ConfigOp::set_has_insertaction() {
+  _impl_._oneof_case_[0] = kInsertAction;
+}
+inline void ConfigOp::clear_insertaction() {
+  if (_internal_has_insertaction()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.insertaction_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::InsertActionReq* ConfigOp::release_insertaction() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.insertAction)
+  if (_internal_has_insertaction()) {
+    clear_has_op();
+    ::rp4::InsertActionReq* temp = _impl_.op_.insertaction_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.insertaction_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::InsertActionReq& ConfigOp::_internal_insertaction() const {
+  return _internal_has_insertaction()
+      ? *_impl_.op_.insertaction_
+      : reinterpret_cast< ::rp4::InsertActionReq&>(::rp4::_InsertActionReq_default_instance_);
+}
+inline const ::rp4::InsertActionReq& ConfigOp::insertaction() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.insertAction)
+  return _internal_insertaction();
+}
+inline ::rp4::InsertActionReq* ConfigOp::unsafe_arena_release_insertaction() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.insertAction)
+  if (_internal_has_insertaction()) {
+    clear_has_op();
+    ::rp4::InsertActionReq* temp = _impl_.op_.insertaction_;
+    _impl_.op_.insertaction_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_insertaction(::rp4::InsertActionReq* insertaction) {
+  clear_op();
+  if (insertaction) {
+    set_has_insertaction();
+    _impl_.op_.insertaction_ = insertaction;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.insertAction)
+}
+inline ::rp4::InsertActionReq* ConfigOp::_internal_mutable_insertaction() {
+  if (!_internal_has_insertaction()) {
+    clear_op();
+    set_has_insertaction();
+    _impl_.op_.insertaction_ = CreateMaybeMessage< ::rp4::InsertActionReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.insertaction_;
+}
+inline ::rp4::InsertActionReq* ConfigOp::mutable_insertaction() {
+  ::rp4::InsertActionReq* _msg = _internal_mutable_insertaction();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.insertAction)
+  return _msg;
+}
+
+// .rp4.ClearActionReq clearAction = 17;
+inline bool ConfigOp::_internal_has_clearaction() const {
+  return op_case() == kClearAction;
+}
+inline bool ConfigOp::has_clearaction() const {
+  return _internal_has_clearaction();
+}
+inline void ConfigOp::set_has_clearaction() {
+  _impl_._oneof_case_[0] = kClearAction;
+}
+inline void ConfigOp::clear_clearaction() {
+  if (_internal_has_clearaction()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.clearaction_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::ClearActionReq* ConfigOp::release_clearaction() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.clearAction)
+  if (_internal_has_clearaction()) {
+    clear_has_op();
+    ::rp4::ClearActionReq* temp = _impl_.op_.clearaction_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.clearaction_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::ClearActionReq& ConfigOp::_internal_clearaction() const {
+  return _internal_has_clearaction()
+      ? *_impl_.op_.clearaction_
+      : reinterpret_cast< ::rp4::ClearActionReq&>(::rp4::_ClearActionReq_default_instance_);
+}
+inline const ::rp4::ClearActionReq& ConfigOp::clearaction() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.clearAction)
+  return _internal_clearaction();
+}
+inline ::rp4::ClearActionReq* ConfigOp::unsafe_arena_release_clearaction() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.clearAction)
+  if (_internal_has_clearaction()) {
+    clear_has_op();
+    ::rp4::ClearActionReq* temp = _impl_.op_.clearaction_;
+    _impl_.op_.clearaction_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_clearaction(::rp4::ClearActionReq* clearaction) {
+  clear_op();
+  if (clearaction) {
+    set_has_clearaction();
+    _impl_.op_.clearaction_ = clearaction;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.clearAction)
+}
+inline ::rp4::ClearActionReq* ConfigOp::_internal_mutable_clearaction() {
+  if (!_internal_has_clearaction()) {
+    clear_op();
+    set_has_clearaction();
+    _impl_.op_.clearaction_ = CreateMaybeMessage< ::rp4::ClearActionReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.clearaction_;
+}
+inline ::rp4::ClearActionReq* ConfigOp::mutable_clearaction() {
+  ::rp4::ClearActionReq* _msg = _internal_mutable_clearaction();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.clearAction)
+  return _msg;
+}
+
+// .rp4.DelActionReq delAction = 18;
+inline bool ConfigOp::_internal_has_delaction() const {
+  return op_case() == kDelAction;
+}
+inline bool ConfigOp::has_delaction() const {
+  return _internal_has_delaction();
+}
+inline void ConfigOp::set_has_delaction() {
+  _impl_._oneof_case_[0] = kDelAction;
+}
+inline void ConfigOp::clear_delaction() {
+  if (_internal_has_delaction()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.delaction_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::DelActionReq* ConfigOp::release_delaction() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.delAction)
+  if (_internal_has_delaction()) {
+    clear_has_op();
+    ::rp4::DelActionReq* temp = _impl_.op_.delaction_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.delaction_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::DelActionReq& ConfigOp::_internal_delaction() const {
+  return _internal_has_delaction()
+      ? *_impl_.op_.delaction_
+      : reinterpret_cast< ::rp4::DelActionReq&>(::rp4::_DelActionReq_default_instance_);
+}
+inline const ::rp4::DelActionReq& ConfigOp::delaction() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.delAction)
+  return _internal_delaction();
+}
+inline ::rp4::DelActionReq* ConfigOp::unsafe_arena_release_delaction() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.delAction)
+  if (_internal_has_delaction()) {
+    clear_has_op();
+    ::rp4::DelActionReq* temp = _impl_.op_.delaction_;
+    _impl_.op_.delaction_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_delaction(::rp4::DelActionReq* delaction) {
+  clear_op();
+  if (delaction) {
+    set_has_delaction();
+    _impl_.op_.delaction_ = delaction;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.delAction)
+}
+inline ::rp4::DelActionReq* ConfigOp::_internal_mutable_delaction() {
+  if (!_internal_has_delaction()) {
+    clear_op();
+    set_has_delaction();
+    _impl_.op_.delaction_ = CreateMaybeMessage< ::rp4::DelActionReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.delaction_;
+}
+inline ::rp4::DelActionReq* ConfigOp::mutable_delaction() {
+  ::rp4::DelActionReq* _msg = _internal_mutable_delaction();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.delAction)
+  return _msg;
+}
+
+// .rp4.LoadSigmoidTableReq loadSigmoidTable = 19;
+inline bool ConfigOp::_internal_has_loadsigmoidtable() const {
+  return op_case() == kLoadSigmoidTable;
+}
+inline bool ConfigOp::has_loadsigmoidtable() const {
+  return _internal_has_loadsigmoidtable();
+}
+inline void ConfigOp::set_has_loadsigmoidtable() {
+  _impl_._oneof_case_[0] = kLoadSigmoidTable;
+}
+inline void ConfigOp::clear_loadsigmoidtable() {
+  if (_internal_has_loadsigmoidtable()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.loadsigmoidtable_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::LoadSigmoidTableReq* ConfigOp::release_loadsigmoidtable() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.loadSigmoidTable)
+  if (_internal_has_loadsigmoidtable()) {
+    clear_has_op();
+    ::rp4::LoadSigmoidTableReq* temp = _impl_.op_.loadsigmoidtable_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.loadsigmoidtable_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::LoadSigmoidTableReq& ConfigOp::_internal_loadsigmoidtable() const {
+  return _internal_has_loadsigmoidtable()
+      ? *_impl_.op_.loadsigmoidtable_
+      : reinterpret_cast< ::rp4::LoadSigmoidTableReq&>(::rp4::_LoadSigmoidTableReq_default_instance_);
+}
+inline const ::rp4::LoadSigmoidTableReq& ConfigOp::loadsigmoidtable() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.loadSigmoidTable)
+  return _internal_loadsigmoidtable();
+}
+inline ::rp4::LoadSigmoidTableReq* ConfigOp::unsafe_arena_release_loadsigmoidtable() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.loadSigmoidTable)
+  if (_internal_has_loadsigmoidtable()) {
+    clear_has_op();
+    ::rp4::LoadSigmoidTableReq* temp = _impl_.op_.loadsigmoidtable_;
+    _impl_.op_.loadsigmoidtable_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_loadsigmoidtable(::rp4::LoadSigmoidTableReq* loadsigmoidtable) {
+  clear_op();
+  if (loadsigmoidtable) {
+    set_has_loadsigmoidtable();
+    _impl_.op_.loadsigmoidtable_ = loadsigmoidtable;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.loadSigmoidTable)
+}
+inline ::rp4::LoadSigmoidTableReq* ConfigOp::_internal_mutable_loadsigmoidtable() {
+  if (!_internal_has_loadsigmoidtable()) {
+    clear_op();
+    set_has_loadsigmoidtable();
+    _impl_.op_.loadsigmoidtable_ = CreateMaybeMessage< ::rp4::LoadSigmoidTableReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.loadsigmoidtable_;
+}
+inline ::rp4::LoadSigmoidTableReq* ConfigOp::mutable_loadsigmoidtable() {
+  ::rp4::LoadSigmoidTableReq* _msg = _internal_mutable_loadsigmoidtable();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.loadSigmoidTable)
+  return _msg;
+}
+
+// .rp4.ClearSigmoidTableReq clearSigmoidTable = 20;
+inline bool ConfigOp::_internal_has_clearsigmoidtable() const {
+  return op_case() == kClearSigmoidTable;
+}
+inline bool ConfigOp::has_clearsigmoidtable() const {
+  return _internal_has_clearsigmoidtable();
+}
+inline void ConfigOp::set_has_clearsigmoidtable() {
+  _impl_._oneof_case_[0] = kClearSigmoidTable;
+}
+inline void ConfigOp::clear_clearsigmoidtable() {
+  if (_internal_has_clearsigmoidtable()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.clearsigmoidtable_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::ClearSigmoidTableReq* ConfigOp::release_clearsigmoidtable() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.clearSigmoidTable)
+  if (_internal_has_clearsigmoidtable()) {
+    clear_has_op();
+    ::rp4::ClearSigmoidTableReq* temp = _impl_.op_.clearsigmoidtable_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.clearsigmoidtable_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::ClearSigmoidTableReq& ConfigOp::_internal_clearsigmoidtable() const {
+  return _internal_has_clearsigmoidtable()
+      ? *_impl_.op_.clearsigmoidtable_
+      : reinterpret_cast< ::rp4::ClearSigmoidTableReq&>(::rp4::_ClearSigmoidTableReq_default_instance_);
+}
+inline const ::rp4::ClearSigmoidTableReq& ConfigOp::clearsigmoidtable() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.clearSigmoidTable)
+  return _internal_clearsigmoidtable();
+}
+inline ::rp4::ClearSigmoidTableReq* ConfigOp::unsafe_arena_release_clearsigmoidtable() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.clearSigmoidTable)
+  if (_internal_has_clearsigmoidtable()) {
+    clear_has_op();
+    ::rp4::ClearSigmoidTableReq* temp = _impl_.op_.clearsigmoidtable_;
+    _impl_.op_.clearsigmoidtable_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_clearsigmoidtable(::rp4::ClearSigmoidTableReq* clearsigmoidtable) {
+  clear_op();
+  if (clearsigmoidtable) {
+    set_has_clearsigmoidtable();
+    _impl_.op_.clearsigmoidtable_ = clearsigmoidtable;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.clearSigmoidTable)
+}
+inline ::rp4::ClearSigmoidTableReq* ConfigOp::_internal_mutable_clearsigmoidtable() {
+  if (!_internal_has_clearsigmoidtable()) {
+    clear_op();
+    set_has_clearsigmoidtable();
+    _impl_.op_.clearsigmoidtable_ = CreateMaybeMessage< ::rp4::ClearSigmoidTableReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.clearsigmoidtable_;
+}
+inline ::rp4::ClearSigmoidTableReq* ConfigOp::mutable_clearsigmoidtable() {
+  ::rp4::ClearSigmoidTableReq* _msg = _internal_mutable_clearsigmoidtable();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.clearSigmoidTable)
+  return _msg;
+}
+
+// .rp4.LoadExpTableReq loadExpTable = 21;
+inline bool ConfigOp::_internal_has_loadexptable() const {
+  return op_case() == kLoadExpTable;
+}
+inline bool ConfigOp::has_loadexptable() const {
+  return _internal_has_loadexptable();
+}
+inline void ConfigOp::set_has_loadexptable() {
+  _impl_._oneof_case_[0] = kLoadExpTable;
+}
+inline void ConfigOp::clear_loadexptable() {
+  if (_internal_has_loadexptable()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.loadexptable_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::LoadExpTableReq* ConfigOp::release_loadexptable() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.loadExpTable)
+  if (_internal_has_loadexptable()) {
+    clear_has_op();
+    ::rp4::LoadExpTableReq* temp = _impl_.op_.loadexptable_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.loadexptable_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::LoadExpTableReq& ConfigOp::_internal_loadexptable() const {
+  return _internal_has_loadexptable()
+      ? *_impl_.op_.loadexptable_
+      : reinterpret_cast< ::rp4::LoadExpTableReq&>(::rp4::_LoadExpTableReq_default_instance_);
+}
+inline const ::rp4::LoadExpTableReq& ConfigOp::loadexptable() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.loadExpTable)
+  return _internal_loadexptable();
+}
+inline ::rp4::LoadExpTableReq* ConfigOp::unsafe_arena_release_loadexptable() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.loadExpTable)
+  if (_internal_has_loadexptable()) {
+    clear_has_op();
+    ::rp4::LoadExpTableReq* temp = _impl_.op_.loadexptable_;
+    _impl_.op_.loadexptable_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_loadexptable(::rp4::LoadExpTableReq* loadexptable) {
+  clear_op();
+  if (loadexptable) {
+    set_has_loadexptable();
+    _impl_.op_.loadexptable_ = loadexptable;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.loadExpTable)
+}
+inline ::rp4::LoadExpTableReq* ConfigOp::_internal_mutable_loadexptable() {
+  if (!_internal_has_loadexptable()) {
+    clear_op();
+    set_has_loadexptable();
+    _impl_.op_.loadexptable_ = CreateMaybeMessage< ::rp4::LoadExpTableReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.loadexptable_;
+}
+inline ::rp4::LoadExpTableReq* ConfigOp::mutable_loadexptable() {
+  ::rp4::LoadExpTableReq* _msg = _internal_mutable_loadexptable();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.loadExpTable)
+  return _msg;
+}
+
+// .rp4.ClearExpTableReq clearExpTable = 22;
+inline bool ConfigOp::_internal_has_clearexptable() const {
+  return op_case() == kClearExpTable;
+}
+inline bool ConfigOp::has_clearexptable() const {
+  return _internal_has_clearexptable();
+}
+inline void ConfigOp::set_has_clearexptable() {
+  _impl_._oneof_case_[0] = kClearExpTable;
+}
+inline void ConfigOp::clear_clearexptable() {
+  if (_internal_has_clearexptable()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.clearexptable_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::ClearExpTableReq* ConfigOp::release_clearexptable() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.clearExpTable)
+  if (_internal_has_clearexptable()) {
+    clear_has_op();
+    ::rp4::ClearExpTableReq* temp = _impl_.op_.clearexptable_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.clearexptable_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::ClearExpTableReq& ConfigOp::_internal_clearexptable() const {
+  return _internal_has_clearexptable()
+      ? *_impl_.op_.clearexptable_
+      : reinterpret_cast< ::rp4::ClearExpTableReq&>(::rp4::_ClearExpTableReq_default_instance_);
+}
+inline const ::rp4::ClearExpTableReq& ConfigOp::clearexptable() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.clearExpTable)
+  return _internal_clearexptable();
+}
+inline ::rp4::ClearExpTableReq* ConfigOp::unsafe_arena_release_clearexptable() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.clearExpTable)
+  if (_internal_has_clearexptable()) {
+    clear_has_op();
+    ::rp4::ClearExpTableReq* temp = _impl_.op_.clearexptable_;
+    _impl_.op_.clearexptable_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_clearexptable(::rp4::ClearExpTableReq* clearexptable) {
+  clear_op();
+  if (clearexptable) {
+    set_has_clearexptable();
+    _impl_.op_.clearexptable_ = clearexptable;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.clearExpTable)
+}
+inline ::rp4::ClearExpTableReq* ConfigOp::_internal_mutable_clearexptable() {
+  if (!_internal_has_clearexptable()) {
+    clear_op();
+    set_has_clearexptable();
+    _impl_.op_.clearexptable_ = CreateMaybeMessage< ::rp4::ClearExpTableReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.clearexptable_;
+}
+inline ::rp4::ClearExpTableReq* ConfigOp::mutable_clearexptable() {
+  ::rp4::ClearExpTableReq* _msg = _internal_mutable_clearexptable();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.clearExpTable)
+  return _msg;
+}
+
+// .rp4.LoadNeuronPrimitiveContextReq loadNeuronPrimitiveContext = 23;
+inline bool ConfigOp::_internal_has_loadneuronprimitivecontext() const {
+  return op_case() == kLoadNeuronPrimitiveContext;
+}
+inline bool ConfigOp::has_loadneuronprimitivecontext() const {
+  return _internal_has_loadneuronprimitivecontext();
+}
+inline void ConfigOp::set_has_loadneuronprimitivecontext() {
+  _impl_._oneof_case_[0] = kLoadNeuronPrimitiveContext;
+}
+inline void ConfigOp::clear_loadneuronprimitivecontext() {
+  if (_internal_has_loadneuronprimitivecontext()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.loadneuronprimitivecontext_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::LoadNeuronPrimitiveContextReq* ConfigOp::release_loadneuronprimitivecontext() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.loadNeuronPrimitiveContext)
+  if (_internal_has_loadneuronprimitivecontext()) {
+    clear_has_op();
+    ::rp4::LoadNeuronPrimitiveContextReq* temp = _impl_.op_.loadneuronprimitivecontext_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.loadneuronprimitivecontext_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::LoadNeuronPrimitiveContextReq& ConfigOp::_internal_loadneuronprimitivecontext() const {
+  return _internal_has_loadneuronprimitivecontext()
+      ? *_impl_.op_.loadneuronprimitivecontext_
+      : reinterpret_cast< ::rp4::LoadNeuronPrimitiveContextReq&>(::rp4::_LoadNeuronPrimitiveContextReq_default_instance_);
+}
+inline const ::rp4::LoadNeuronPrimitiveContextReq& ConfigOp::loadneuronprimitivecontext() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.loadNeuronPrimitiveContext)
+  return _internal_loadneuronprimitivecontext();
+}
+inline ::rp4::LoadNeuronPrimitiveContextReq* ConfigOp::unsafe_arena_release_loadneuronprimitivecontext() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.loadNeuronPrimitiveContext)
+  if (_internal_has_loadneuronprimitivecontext()) {
+    clear_has_op();
+    ::rp4::LoadNeuronPrimitiveContextReq* temp = _impl_.op_.loadneuronprimitivecontext_;
+    _impl_.op_.loadneuronprimitivecontext_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_loadneuronprimitivecontext(::rp4::LoadNeuronPrimitiveContextReq* loadneuronprimitivecontext) {
+  clear_op();
+  if (loadneuronprimitivecontext) {
+    set_has_loadneuronprimitivecontext();
+    _impl_.op_.loadneuronprimitivecontext_ = loadneuronprimitivecontext;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.loadNeuronPrimitiveContext)
+}
+inline ::rp4::LoadNeuronPrimitiveContextReq* ConfigOp::_internal_mutable_loadneuronprimitivecontext() {
+  if (!_internal_has_loadneuronprimitivecontext()) {
+    clear_op();
+    set_has_loadneuronprimitivecontext();
+    _impl_.op_.loadneuronprimitivecontext_ = CreateMaybeMessage< ::rp4::LoadNeuronPrimitiveContextReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.loadneuronprimitivecontext_;
+}
+inline ::rp4::LoadNeuronPrimitiveContextReq* ConfigOp::mutable_loadneuronprimitivecontext() {
+  ::rp4::LoadNeuronPrimitiveContextReq* _msg = _internal_mutable_loadneuronprimitivecontext();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.loadNeuronPrimitiveContext)
+  return _msg;
+}
+
+// .rp4.ClearNeuronPrimitiveContextsReq clearNeuronPrimitiveContexts = 24;
+inline bool ConfigOp::_internal_has_clearneuronprimitivecontexts() const {
+  return op_case() == kClearNeuronPrimitiveContexts;
+}
+inline bool ConfigOp::has_clearneuronprimitivecontexts() const {
+  return _internal_has_clearneuronprimitivecontexts();
+}
+inline void ConfigOp::set_has_clearneuronprimitivecontexts() {
+  _impl_._oneof_case_[0] = kClearNeuronPrimitiveContexts;
+}
+inline void ConfigOp::clear_clearneuronprimitivecontexts() {
+  if (_internal_has_clearneuronprimitivecontexts()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.clearneuronprimitivecontexts_;
+    }
+    clear_has_op();
+  }
+}
+inline ::rp4::ClearNeuronPrimitiveContextsReq* ConfigOp::release_clearneuronprimitivecontexts() {
+  // @@protoc_insertion_point(field_release:rp4.ConfigOp.clearNeuronPrimitiveContexts)
+  if (_internal_has_clearneuronprimitivecontexts()) {
+    clear_has_op();
+    ::rp4::ClearNeuronPrimitiveContextsReq* temp = _impl_.op_.clearneuronprimitivecontexts_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.clearneuronprimitivecontexts_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::ClearNeuronPrimitiveContextsReq& ConfigOp::_internal_clearneuronprimitivecontexts() const {
+  return _internal_has_clearneuronprimitivecontexts()
+      ? *_impl_.op_.clearneuronprimitivecontexts_
+      : reinterpret_cast< ::rp4::ClearNeuronPrimitiveContextsReq&>(::rp4::_ClearNeuronPrimitiveContextsReq_default_instance_);
+}
+inline const ::rp4::ClearNeuronPrimitiveContextsReq& ConfigOp::clearneuronprimitivecontexts() const {
+  // @@protoc_insertion_point(field_get:rp4.ConfigOp.clearNeuronPrimitiveContexts)
+  return _internal_clearneuronprimitivecontexts();
+}
+inline ::rp4::ClearNeuronPrimitiveContextsReq* ConfigOp::unsafe_arena_release_clearneuronprimitivecontexts() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.ConfigOp.clearNeuronPrimitiveContexts)
+  if (_internal_has_clearneuronprimitivecontexts()) {
+    clear_has_op();
+    ::rp4::ClearNeuronPrimitiveContextsReq* temp = _impl_.op_.clearneuronprimitivecontexts_;
+    _impl_.op_.clearneuronprimitivecontexts_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConfigOp::unsafe_arena_set_allocated_clearneuronprimitivecontexts(::rp4::ClearNeuronPrimitiveContextsReq* clearneuronprimitivecontexts) {
+  clear_op();
+  if (clearneuronprimitivecontexts) {
+    set_has_clearneuronprimitivecontexts();
+    _impl_.op_.clearneuronprimitivecontexts_ = clearneuronprimitivecontexts;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ConfigOp.clearNeuronPrimitiveContexts)
+}
+inline ::rp4::ClearNeuronPrimitiveContextsReq* ConfigOp::_internal_mutable_clearneuronprimitivecontexts() {
+  if (!_internal_has_clearneuronprimitivecontexts()) {
+    clear_op();
+    set_has_clearneuronprimitivecontexts();
+    _impl_.op_.clearneuronprimitivecontexts_ = CreateMaybeMessage< ::rp4::ClearNeuronPrimitiveContextsReq >(GetArenaForAllocation());
+  }
+  return _impl_.op_.clearneuronprimitivecontexts_;
+}
+inline ::rp4::ClearNeuronPrimitiveContextsReq* ConfigOp::mutable_clearneuronprimitivecontexts() {
+  ::rp4::ClearNeuronPrimitiveContextsReq* _msg = _internal_mutable_clearneuronprimitivecontexts();
+  // @@protoc_insertion_point(field_mutable:rp4.ConfigOp.clearNeuronPrimitiveContexts)
+  return _msg;
+}
+
+inline bool ConfigOp::has_op() const {
+  return op_case() != OP_NOT_SET;
+}
+inline void ConfigOp::clear_has_op() {
+  _impl_._oneof_case_[0] = OP_NOT_SET;
+}
+inline ConfigOp::OpCase ConfigOp::op_case() const {
+  return ConfigOp::OpCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// ApplyConfigReq
+
+// repeated .rp4.ConfigOp ops = 1;
+inline int ApplyConfigReq::_internal_ops_size() const {
+  return _impl_.ops_.size();
+}
+inline int ApplyConfigReq::ops_size() const {
+  return _internal_ops_size();
+}
+inline void ApplyConfigReq::clear_ops() {
+  _impl_.ops_.Clear();
+}
+inline ::rp4::ConfigOp* ApplyConfigReq::mutable_ops(int index) {
+  // @@protoc_insertion_point(field_mutable:rp4.ApplyConfigReq.ops)
+  return _impl_.ops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ConfigOp >*
+ApplyConfigReq::mutable_ops() {
+  // @@protoc_insertion_point(field_mutable_list:rp4.ApplyConfigReq.ops)
+  return &_impl_.ops_;
+}
+inline const ::rp4::ConfigOp& ApplyConfigReq::_internal_ops(int index) const {
+  return _impl_.ops_.Get(index);
+}
+inline const ::rp4::ConfigOp& ApplyConfigReq::ops(int index) const {
+  // @@protoc_insertion_point(field_get:rp4.ApplyConfigReq.ops)
+  return _internal_ops(index);
+}
+inline ::rp4::ConfigOp* ApplyConfigReq::_internal_add_ops() {
+  return _impl_.ops_.Add();
+}
+inline ::rp4::ConfigOp* ApplyConfigReq::add_ops() {
+  ::rp4::ConfigOp* _add = _internal_add_ops();
+  // @@protoc_insertion_point(field_add:rp4.ApplyConfigReq.ops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ConfigOp >&
+ApplyConfigReq::ops() const {
+  // @@protoc_insertion_point(field_list:rp4.ApplyConfigReq.ops)
+  return _impl_.ops_;
+}
+
+// -------------------------------------------------------------------
+
+// ApplyConfigResp
+
+// .rp4.Res res = 1;
+inline void ApplyConfigResp::clear_res() {
+  _impl_.res_ = 0;
+}
+inline ::rp4::Res ApplyConfigResp::_internal_res() const {
+  return static_cast< ::rp4::Res >(_impl_.res_);
+}
+inline ::rp4::Res ApplyConfigResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.ApplyConfigResp.res)
+  return _internal_res();
+}
+inline void ApplyConfigResp::_internal_set_res(::rp4::Res value) {
+  
+  _impl_.res_ = value;
+}
+inline void ApplyConfigResp::set_res(::rp4::Res value) {
+  _internal_set_res(value);
+  // @@protoc_insertion_point(field_set:rp4.ApplyConfigResp.res)
+}
+
+// int32 applied = 2;
+inline void ApplyConfigResp::clear_applied() {
+  _impl_.applied_ = 0;
+}
+inline int32_t ApplyConfigResp::_internal_applied() const {
+  return _impl_.applied_;
+}
+inline int32_t ApplyConfigResp::applied() const {
+  // @@protoc_insertion_point(field_get:rp4.ApplyConfigResp.applied)
+  return _internal_applied();
+}
+inline void ApplyConfigResp::_internal_set_applied(int32_t value) {
+  
+  _impl_.applied_ = value;
+}
+inline void ApplyConfigResp::set_applied(int32_t value) {
+  _internal_set_applied(value);
+  // @@protoc_insertion_point(field_set:rp4.ApplyConfigResp.applied)
+}
+
+// -------------------------------------------------------------------
+
+// ParserLevelReq
+
+// int32 procId = 1;
+inline void ParserLevelReq::clear_procid() {
+  _impl_.procid_ = 0;
+}
+inline int32_t ParserLevelReq::_internal_procid() const {
+  return _impl_.procid_;
+}
+inline int32_t ParserLevelReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.ParserLevelReq.procId)
+  return _internal_procid();
+}
+inline void ParserLevelReq::_internal_set_procid(int32_t value) {
+  
+  _impl_.procid_ = value;
+}
+inline void ParserLevelReq::set_procid(int32_t value) {
+  _internal_set_procid(value);
+  // @@protoc_insertion_point(field_set:rp4.ParserLevelReq.procId)
+}
+
+// int32 parserLevel = 2;
+inline void ParserLevelReq::clear_parserlevel() {
+  _impl_.parserlevel_ = 0;
+}
+inline int32_t ParserLevelReq::_internal_parserlevel() const {
+  return _impl_.parserlevel_;
+}
+inline int32_t ParserLevelReq::parserlevel() const {
+  // @@protoc_insertion_point(field_get:rp4.ParserLevelReq.parserLevel)
+  return _internal_parserlevel();
+}
+inline void ParserLevelReq::_internal_set_parserlevel(int32_t value) {
+  
+  _impl_.parserlevel_ = value;
+}
+inline void ParserLevelReq::set_parserlevel(int32_t value) {
+  _internal_set_parserlevel(value);
+  // @@protoc_insertion_point(field_set:rp4.ParserLevelReq.parserLevel)
+}
+
+// -------------------------------------------------------------------
+
+// ParserLevelResp
+
+// .rp4.Res res = 1;
+inline void ParserLevelResp::clear_res() {
+  _impl_.res_ = 0;
+}
+inline ::rp4::Res ParserLevelResp::_internal_res() const {
+  return static_cast< ::rp4::Res >(_impl_.res_);
+}
+inline ::rp4::Res ParserLevelResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.ParserLevelResp.res)
+  return _internal_res();
+}
+inline void ParserLevelResp::_internal_set_res(::rp4::Res value) {
+  
+  _impl_.res_ = value;
+}
+inline void ParserLevelResp::set_res(::rp4::Res value) {
+  _internal_set_res(value);
+  // @@protoc_insertion_point(field_set:rp4.ParserLevelResp.res)
+}
+
+// -------------------------------------------------------------------
+
+// FieldInfo
+
+// int32 hdrId = 1;
+inline void FieldInfo::clear_hdrid() {
+  _impl_.hdrid_ = 0;
+}
+inline int32_t FieldInfo::_internal_hdrid() const {
+  return _impl_.hdrid_;
+}
+inline int32_t FieldInfo::hdrid() const {
+  // @@protoc_insertion_point(field_get:rp4.FieldInfo.hdrId)
+  return _internal_hdrid();
+}
+inline void FieldInfo::_internal_set_hdrid(int32_t value) {
+  
+  _impl_.hdrid_ = value;
+}
+inline void FieldInfo::set_hdrid(int32_t value) {
+  _internal_set_hdrid(value);
+  // @@protoc_insertion_point(field_set:rp4.FieldInfo.hdrId)
+}
+
+// int32 internalOffset = 2;
+inline void FieldInfo::clear_internaloffset() {
+  _impl_.internaloffset_ = 0;
+}
+inline int32_t FieldInfo::_internal_internaloffset() const {
+  return _impl_.internaloffset_;
+}
+inline int32_t FieldInfo::internaloffset() const {
+  // @@protoc_insertion_point(field_get:rp4.FieldInfo.internalOffset)
+  return _internal_internaloffset();
+}
+inline void FieldInfo::_internal_set_internaloffset(int32_t value) {
+  
+  _impl_.internaloffset_ = value;
+}
+inline void FieldInfo::set_internaloffset(int32_t value) {
+  _internal_set_internaloffset(value);
+  // @@protoc_insertion_point(field_set:rp4.FieldInfo.internalOffset)
+}
+
+// int32 fieldLen = 3;
+inline void FieldInfo::clear_fieldlen() {
+  _impl_.fieldlen_ = 0;
+}
+inline int32_t FieldInfo::_internal_fieldlen() const {
+  return _impl_.fieldlen_;
+}
+inline int32_t FieldInfo::fieldlen() const {
+  // @@protoc_insertion_point(field_get:rp4.FieldInfo.fieldLen)
+  return _internal_fieldlen();
+}
+inline void FieldInfo::_internal_set_fieldlen(int32_t value) {
+  
+  _impl_.fieldlen_ = value;
+}
+inline void FieldInfo::set_fieldlen(int32_t value) {
+  _internal_set_fieldlen(value);
+  // @@protoc_insertion_point(field_set:rp4.FieldInfo.fieldLen)
+}
+
+// .rp4.FieldType fieldType = 4;
+inline void FieldInfo::clear_fieldtype() {
+  _impl_.fieldtype_ = 0;
+}
+inline ::rp4::FieldType FieldInfo::_internal_fieldtype() const {
+  return static_cast< ::rp4::FieldType >(_impl_.fieldtype_);
+}
+inline ::rp4::FieldType FieldInfo::fieldtype() const {
+  // @@protoc_insertion_point(field_get:rp4.FieldInfo.fieldType)
+  return _internal_fieldtype();
+}
+inline void FieldInfo::_internal_set_fieldtype(::rp4::FieldType value) {
+  
+  _impl_.fieldtype_ = value;
+}
+inline void FieldInfo::set_fieldtype(::rp4::FieldType value) {
+  _internal_set_fieldtype(value);
+  // @@protoc_insertion_point(field_set:rp4.FieldInfo.fieldType)
+}
+
+// -------------------------------------------------------------------
+
+// ModParserEntryReq
+
+// int32 procId = 1;
+inline void ModParserEntryReq::clear_procid() {
+  _impl_.procid_ = 0;
+}
+inline int32_t ModParserEntryReq::_internal_procid() const {
+  return _impl_.procid_;
+}
+inline int32_t ModParserEntryReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.procId)
+  return _internal_procid();
+}
+inline void ModParserEntryReq::_internal_set_procid(int32_t value) {
+  
+  _impl_.procid_ = value;
+}
+inline void ModParserEntryReq::set_procid(int32_t value) {
+  _internal_set_procid(value);
+  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.procId)
+}
+
+// int32 parserLevel = 2;
+inline void ModParserEntryReq::clear_parserlevel() {
+  _impl_.parserlevel_ = 0;
+}
+inline int32_t ModParserEntryReq::_internal_parserlevel() const {
+  return _impl_.parserlevel_;
+}
+inline int32_t ModParserEntryReq::parserlevel() const {
+  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.parserLevel)
+  return _internal_parserlevel();
+}
+inline void ModParserEntryReq::_internal_set_parserlevel(int32_t value) {
+  
+  _impl_.parserlevel_ = value;
+}
+inline void ModParserEntryReq::set_parserlevel(int32_t value) {
+  _internal_set_parserlevel(value);
+  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.parserLevel)
+}
+
+// int32 state = 3;
+inline void ModParserEntryReq::clear_state() {
+  _impl_.state_ = 0;
+}
+inline int32_t ModParserEntryReq::_internal_state() const {
+  return _impl_.state_;
+}
+inline int32_t ModParserEntryReq::state() const {
+  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.state)
+  return _internal_state();
+}
+inline void ModParserEntryReq::_internal_set_state(int32_t value) {
+  
+  _impl_.state_ = value;
+}
+inline void ModParserEntryReq::set_state(int32_t value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.state)
+}
+
+// uint32 key = 4;
+inline void ModParserEntryReq::clear_key() {
+  _impl_.key_ = 0u;
+}
+inline uint32_t ModParserEntryReq::_internal_key() const {
+  return _impl_.key_;
+}
+inline uint32_t ModParserEntryReq::key() const {
+  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.key)
+  return _internal_key();
+}
+inline void ModParserEntryReq::_internal_set_key(uint32_t value) {
+  
+  _impl_.key_ = value;
+}
+inline void ModParserEntryReq::set_key(uint32_t value) {
+  _internal_set_key(value);
+  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.key)
+}
+
+// int32 mask = 5;
+inline void ModParserEntryReq::clear_mask() {
+  _impl_.mask_ = 0;
+}
+inline int32_t ModParserEntryReq::_internal_mask() const {
+  return _impl_.mask_;
+}
+inline int32_t ModParserEntryReq::mask() const {
+  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.mask)
+  return _internal_mask();
+}
+inline void ModParserEntryReq::_internal_set_mask(int32_t value) {
+  
+  _impl_.mask_ = value;
+}
+inline void ModParserEntryReq::set_mask(int32_t value) {
+  _internal_set_mask(value);
+  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.mask)
+}
+
+// int32 hdrId = 6;
+inline void ModParserEntryReq::clear_hdrid() {
+  _impl_.hdrid_ = 0;
+}
+inline int32_t ModParserEntryReq::_internal_hdrid() const {
+  return _impl_.hdrid_;
+}
+inline int32_t ModParserEntryReq::hdrid() const {
+  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.hdrId)
+  return _internal_hdrid();
+}
+inline void ModParserEntryReq::_internal_set_hdrid(int32_t value) {
+  
+  _impl_.hdrid_ = value;
+}
+inline void ModParserEntryReq::set_hdrid(int32_t value) {
+  _internal_set_hdrid(value);
+  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.hdrId)
+}
+
+// int32 hdrLen = 7;
+inline void ModParserEntryReq::clear_hdrlen() {
+  _impl_.hdrlen_ = 0;
+}
+inline int32_t ModParserEntryReq::_internal_hdrlen() const {
+  return _impl_.hdrlen_;
+}
+inline int32_t ModParserEntryReq::hdrlen() const {
+  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.hdrLen)
+  return _internal_hdrlen();
+}
+inline void ModParserEntryReq::_internal_set_hdrlen(int32_t value) {
+  
+  _impl_.hdrlen_ = value;
+}
+inline void ModParserEntryReq::set_hdrlen(int32_t value) {
+  _internal_set_hdrlen(value);
+  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.hdrLen)
+}
+
+// int32 nextState = 8;
+inline void ModParserEntryReq::clear_nextstate() {
+  _impl_.nextstate_ = 0;
+}
+inline int32_t ModParserEntryReq::_internal_nextstate() const {
+  return _impl_.nextstate_;
+}
+inline int32_t ModParserEntryReq::nextstate() const {
+  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.nextState)
+  return _internal_nextstate();
+}
+inline void ModParserEntryReq::_internal_set_nextstate(int32_t value) {
+  
+  _impl_.nextstate_ = value;
+}
+inline void ModParserEntryReq::set_nextstate(int32_t value) {
+  _internal_set_nextstate(value);
+  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.nextState)
+}
+
+// int32 transFieldNum = 9;
+inline void ModParserEntryReq::clear_transfieldnum() {
+  _impl_.transfieldnum_ = 0;
+}
+inline int32_t ModParserEntryReq::_internal_transfieldnum() const {
+  return _impl_.transfieldnum_;
+}
+inline int32_t ModParserEntryReq::transfieldnum() const {
+  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.transFieldNum)
+  return _internal_transfieldnum();
+}
+inline void ModParserEntryReq::_internal_set_transfieldnum(int32_t value) {
+  
+  _impl_.transfieldnum_ = value;
+}
+inline void ModParserEntryReq::set_transfieldnum(int32_t value) {
+  _internal_set_transfieldnum(value);
+  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.transFieldNum)
+}
+
+// repeated .rp4.FieldInfo transFds = 10;
+inline int ModParserEntryReq::_internal_transfds_size() const {
+  return _impl_.transfds_.size();
+}
+inline int ModParserEntryReq::transfds_size() const {
+  return _internal_transfds_size();
+}
+inline void ModParserEntryReq::clear_transfds() {
+  _impl_.transfds_.Clear();
+}
+inline ::rp4::FieldInfo* ModParserEntryReq::mutable_transfds(int index) {
+  // @@protoc_insertion_point(field_mutable:rp4.ModParserEntryReq.transFds)
+  return _impl_.transfds_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >*
+ModParserEntryReq::mutable_transfds() {
+  // @@protoc_insertion_point(field_mutable_list:rp4.ModParserEntryReq.transFds)
+  return &_impl_.transfds_;
+}
+inline const ::rp4::FieldInfo& ModParserEntryReq::_internal_transfds(int index) const {
+  return _impl_.transfds_.Get(index);
+}
+inline const ::rp4::FieldInfo& ModParserEntryReq::transfds(int index) const {
+  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.transFds)
+  return _internal_transfds(index);
+}
+inline ::rp4::FieldInfo* ModParserEntryReq::_internal_add_transfds() {
+  return _impl_.transfds_.Add();
+}
+inline ::rp4::FieldInfo* ModParserEntryReq::add_transfds() {
+  ::rp4::FieldInfo* _add = _internal_add_transfds();
+  // @@protoc_insertion_point(field_add:rp4.ModParserEntryReq.transFds)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >&
+ModParserEntryReq::transfds() const {
+  // @@protoc_insertion_point(field_list:rp4.ModParserEntryReq.transFds)
+  return _impl_.transfds_;
+}
+
+// int32 miss_act = 11;
+inline void ModParserEntryReq::clear_miss_act() {
+  _impl_.miss_act_ = 0;
+}
+inline int32_t ModParserEntryReq::_internal_miss_act() const {
+  return _impl_.miss_act_;
+}
+inline int32_t ModParserEntryReq::miss_act() const {
+  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.miss_act)
+  return _internal_miss_act();
+}
+inline void ModParserEntryReq::_internal_set_miss_act(int32_t value) {
+  
+  _impl_.miss_act_ = value;
+}
+inline void ModParserEntryReq::set_miss_act(int32_t value) {
+  _internal_set_miss_act(value);
+  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.miss_act)
+}
+
+// -------------------------------------------------------------------
+
+// ModParserEntryResp
+
+// .rp4.Res res = 1;
+inline void ModParserEntryResp::clear_res() {
   _impl_.res_ = 0;
 }
-inline ::rp4::Res SetMetadataResp::_internal_res() const {
+inline ::rp4::Res ModParserEntryResp::_internal_res() const {
   return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::Res SetMetadataResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.SetMetadataResp.res)
+inline ::rp4::Res ModParserEntryResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.ModParserEntryResp.res)
   return _internal_res();
 }
-inline void SetMetadataResp::_internal_set_res(::rp4::Res value) {
+inline void ModParserEntryResp::_internal_set_res(::rp4::Res value) {
   
   _impl_.res_ = value;
 }
-inline void SetMetadataResp::set_res(::rp4::Res value) {
+inline void ModParserEntryResp::set_res(::rp4::Res value) {
   _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.SetMetadataResp.res)
+  // @@protoc_insertion_point(field_set:rp4.ModParserEntryResp.res)
 }
 
 // -------------------------------------------------------------------
 
-// ClearStageReq
+// ClearParserReq
 
 // int32 procId = 1;
-inline void ClearStageReq::clear_procid() {
+inline void ClearParserReq::clear_procid() {
   _impl_.procid_ = 0;
 }
-inline int32_t ClearStageReq::_internal_procid() const {
+inline int32_t ClearParserReq::_internal_procid() const {
   return _impl_.procid_;
 }
-inline int32_t ClearStageReq::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.ClearStageReq.procId)
+inline int32_t ClearParserReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.ClearParserReq.procId)
   return _internal_procid();
 }
-inline void ClearStageReq::_internal_set_procid(int32_t value) {
+inline void ClearParserReq::_internal_set_procid(int32_t value) {
   
   _impl_.procid_ = value;
 }
-inline void ClearStageReq::set_procid(int32_t value) {
+inline void ClearParserReq::set_procid(int32_t value) {
   _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.ClearStageReq.procId)
+  // @@protoc_insertion_point(field_set:rp4.ClearParserReq.procId)
 }
 
 // -------------------------------------------------------------------
 
-// ParserLevelReq
+// ClearParserResp
 
-// int32 procId = 1;
-inline void ParserLevelReq::clear_procid() {
-  _impl_.procid_ = 0;
+// .rp4.Res res = 1;
+inline void ClearParserResp::clear_res() {
+  _impl_.res_ = 0;
 }
-inline int32_t ParserLevelReq::_internal_procid() const {
-  return _impl_.procid_;
+inline ::rp4::Res ClearParserResp::_internal_res() const {
+  return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline int32_t ParserLevelReq::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.ParserLevelReq.procId)
-  return _internal_procid();
+inline ::rp4::Res ClearParserResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.ClearParserResp.res)
+  return _internal_res();
 }
-inline void ParserLevelReq::_internal_set_procid(int32_t value) {
+inline void ClearParserResp::_internal_set_res(::rp4::Res value) {
   
-  _impl_.procid_ = value;
+  _impl_.res_ = value;
 }
-inline void ParserLevelReq::set_procid(int32_t value) {
-  _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.ParserLevelReq.procId)
+inline void ClearParserResp::set_res(::rp4::Res value) {
+  _internal_set_res(value);
+  // @@protoc_insertion_point(field_set:rp4.ClearParserResp.res)
 }
 
-// int32 parserLevel = 2;
-inline void ParserLevelReq::clear_parserlevel() {
-  _impl_.parserlevel_ = 0;
+// -------------------------------------------------------------------
+
+// Data
+
+// int32 len = 1;
+inline void Data::clear_len() {
+  _impl_.len_ = 0;
 }
-inline int32_t ParserLevelReq::_internal_parserlevel() const {
-  return _impl_.parserlevel_;
+inline int32_t Data::_internal_len() const {
+  return _impl_.len_;
 }
-inline int32_t ParserLevelReq::parserlevel() const {
-  // @@protoc_insertion_point(field_get:rp4.ParserLevelReq.parserLevel)
-  return _internal_parserlevel();
+inline int32_t Data::len() const {
+  // @@protoc_insertion_point(field_get:rp4.Data.len)
+  return _internal_len();
+}
+inline void Data::_internal_set_len(int32_t value) {
+  
+  _impl_.len_ = value;
+}
+inline void Data::set_len(int32_t value) {
+  _internal_set_len(value);
+  // @@protoc_insertion_point(field_set:rp4.Data.len)
+}
+
+// bytes val = 2;
+inline void Data::clear_val() {
+  _impl_.val_.ClearToEmpty();
+}
+inline const std::string& Data::val() const {
+  // @@protoc_insertion_point(field_get:rp4.Data.val)
+  return _internal_val();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Data::set_val(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.val_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rp4.Data.val)
+}
+inline std::string* Data::mutable_val() {
+  std::string* _s = _internal_mutable_val();
+  // @@protoc_insertion_point(field_mutable:rp4.Data.val)
+  return _s;
+}
+inline const std::string& Data::_internal_val() const {
+  return _impl_.val_.Get();
+}
+inline void Data::_internal_set_val(const std::string& value) {
+  
+  _impl_.val_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Data::_internal_mutable_val() {
+  
+  return _impl_.val_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Data::release_val() {
+  // @@protoc_insertion_point(field_release:rp4.Data.val)
+  return _impl_.val_.Release();
+}
+inline void Data::set_allocated_val(std::string* val) {
+  if (val != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.val_.SetAllocated(val, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.val_.IsDefault()) {
+    _impl_.val_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rp4.Data.val)
+}
+
+// -------------------------------------------------------------------
+
+// GateEntry
+
+// .rp4.GateEntryType type = 1;
+inline void GateEntry::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::rp4::GateEntryType GateEntry::_internal_type() const {
+  return static_cast< ::rp4::GateEntryType >(_impl_.type_);
+}
+inline ::rp4::GateEntryType GateEntry::type() const {
+  // @@protoc_insertion_point(field_get:rp4.GateEntry.type)
+  return _internal_type();
+}
+inline void GateEntry::_internal_set_type(::rp4::GateEntryType value) {
+  
+  _impl_.type_ = value;
+}
+inline void GateEntry::set_type(::rp4::GateEntryType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:rp4.GateEntry.type)
+}
+
+// int32 val = 2;
+inline void GateEntry::clear_val() {
+  _impl_.val_ = 0;
+}
+inline int32_t GateEntry::_internal_val() const {
+  return _impl_.val_;
+}
+inline int32_t GateEntry::val() const {
+  // @@protoc_insertion_point(field_get:rp4.GateEntry.val)
+  return _internal_val();
+}
+inline void GateEntry::_internal_set_val(int32_t value) {
+  
+  _impl_.val_ = value;
+}
+inline void GateEntry::set_val(int32_t value) {
+  _internal_set_val(value);
+  // @@protoc_insertion_point(field_set:rp4.GateEntry.val)
+}
+
+// -------------------------------------------------------------------
+
+// SetDefaultGateEntryReq
+
+// int32 proc_id = 1;
+inline void SetDefaultGateEntryReq::clear_proc_id() {
+  _impl_.proc_id_ = 0;
+}
+inline int32_t SetDefaultGateEntryReq::_internal_proc_id() const {
+  return _impl_.proc_id_;
+}
+inline int32_t SetDefaultGateEntryReq::proc_id() const {
+  // @@protoc_insertion_point(field_get:rp4.SetDefaultGateEntryReq.proc_id)
+  return _internal_proc_id();
+}
+inline void SetDefaultGateEntryReq::_internal_set_proc_id(int32_t value) {
+  
+  _impl_.proc_id_ = value;
+}
+inline void SetDefaultGateEntryReq::set_proc_id(int32_t value) {
+  _internal_set_proc_id(value);
+  // @@protoc_insertion_point(field_set:rp4.SetDefaultGateEntryReq.proc_id)
+}
+
+// .rp4.GateEntry default_entry = 2;
+inline bool SetDefaultGateEntryReq::_internal_has_default_entry() const {
+  return this != internal_default_instance() && _impl_.default_entry_ != nullptr;
+}
+inline bool SetDefaultGateEntryReq::has_default_entry() const {
+  return _internal_has_default_entry();
+}
+inline void SetDefaultGateEntryReq::clear_default_entry() {
+  if (GetArenaForAllocation() == nullptr && _impl_.default_entry_ != nullptr) {
+    delete _impl_.default_entry_;
+  }
+  _impl_.default_entry_ = nullptr;
+}
+inline const ::rp4::GateEntry& SetDefaultGateEntryReq::_internal_default_entry() const {
+  const ::rp4::GateEntry* p = _impl_.default_entry_;
+  return p != nullptr ? *p : reinterpret_cast<const ::rp4::GateEntry&>(
+      ::rp4::_GateEntry_default_instance_);
+}
+inline const ::rp4::GateEntry& SetDefaultGateEntryReq::default_entry() const {
+  // @@protoc_insertion_point(field_get:rp4.SetDefaultGateEntryReq.default_entry)
+  return _internal_default_entry();
+}
+inline void SetDefaultGateEntryReq::unsafe_arena_set_allocated_default_entry(
+    ::rp4::GateEntry* default_entry) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.default_entry_);
+  }
+  _impl_.default_entry_ = default_entry;
+  if (default_entry) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.SetDefaultGateEntryReq.default_entry)
+}
+inline ::rp4::GateEntry* SetDefaultGateEntryReq::release_default_entry() {
+  
+  ::rp4::GateEntry* temp = _impl_.default_entry_;
+  _impl_.default_entry_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::rp4::GateEntry* SetDefaultGateEntryReq::unsafe_arena_release_default_entry() {
+  // @@protoc_insertion_point(field_release:rp4.SetDefaultGateEntryReq.default_entry)
+  
+  ::rp4::GateEntry* temp = _impl_.default_entry_;
+  _impl_.default_entry_ = nullptr;
+  return temp;
 }
-inline void ParserLevelReq::_internal_set_parserlevel(int32_t value) {
+inline ::rp4::GateEntry* SetDefaultGateEntryReq::_internal_mutable_default_entry() {
   
-  _impl_.parserlevel_ = value;
+  if (_impl_.default_entry_ == nullptr) {
+    auto* p = CreateMaybeMessage<::rp4::GateEntry>(GetArenaForAllocation());
+    _impl_.default_entry_ = p;
+  }
+  return _impl_.default_entry_;
 }
-inline void ParserLevelReq::set_parserlevel(int32_t value) {
-  _internal_set_parserlevel(value);
-  // @@protoc_insertion_point(field_set:rp4.ParserLevelReq.parserLevel)
+inline ::rp4::GateEntry* SetDefaultGateEntryReq::mutable_default_entry() {
+  ::rp4::GateEntry* _msg = _internal_mutable_default_entry();
+  // @@protoc_insertion_point(field_mutable:rp4.SetDefaultGateEntryReq.default_entry)
+  return _msg;
+}
+inline void SetDefaultGateEntryReq::set_allocated_default_entry(::rp4::GateEntry* default_entry) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.default_entry_;
+  }
+  if (default_entry) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(default_entry);
+    if (message_arena != submessage_arena) {
+      default_entry = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, default_entry, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.default_entry_ = default_entry;
+  // @@protoc_insertion_point(field_set_allocated:rp4.SetDefaultGateEntryReq.default_entry)
 }
 
 // -------------------------------------------------------------------
 
-// ParserLevelResp
+// SetDefaultGateEntryResp
 
 // .rp4.Res res = 1;
-inline void ParserLevelResp::clear_res() {
+inline void SetDefaultGateEntryResp::clear_res() {
   _impl_.res_ = 0;
 }
-inline ::rp4::Res ParserLevelResp::_internal_res() const {
+inline ::rp4::Res SetDefaultGateEntryResp::_internal_res() const {
   return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::Res ParserLevelResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.ParserLevelResp.res)
+inline ::rp4::Res SetDefaultGateEntryResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.SetDefaultGateEntryResp.res)
   return _internal_res();
 }
-inline void ParserLevelResp::_internal_set_res(::rp4::Res value) {
+inline void SetDefaultGateEntryResp::_internal_set_res(::rp4::Res value) {
   
   _impl_.res_ = value;
 }
-inline void ParserLevelResp::set_res(::rp4::Res value) {
+inline void SetDefaultGateEntryResp::set_res(::rp4::Res value) {
   _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.ParserLevelResp.res)
+  // @@protoc_insertion_point(field_set:rp4.SetDefaultGateEntryResp.res)
 }
 
 // -------------------------------------------------------------------
 
-// FieldInfo
+// GatewayParam
 
-// int32 hdrId = 1;
-inline void FieldInfo::clear_hdrid() {
-  _impl_.hdrid_ = 0;
+// .rp4.ParameterType paramType = 1;
+inline void GatewayParam::clear_paramtype() {
+  _impl_.paramtype_ = 0;
 }
-inline int32_t FieldInfo::_internal_hdrid() const {
-  return _impl_.hdrid_;
+inline ::rp4::ParameterType GatewayParam::_internal_paramtype() const {
+  return static_cast< ::rp4::ParameterType >(_impl_.paramtype_);
 }
-inline int32_t FieldInfo::hdrid() const {
-  // @@protoc_insertion_point(field_get:rp4.FieldInfo.hdrId)
-  return _internal_hdrid();
+inline ::rp4::ParameterType GatewayParam::paramtype() const {
+  // @@protoc_insertion_point(field_get:rp4.GatewayParam.paramType)
+  return _internal_paramtype();
 }
-inline void FieldInfo::_internal_set_hdrid(int32_t value) {
+inline void GatewayParam::_internal_set_paramtype(::rp4::ParameterType value) {
   
-  _impl_.hdrid_ = value;
+  _impl_.paramtype_ = value;
 }
-inline void FieldInfo::set_hdrid(int32_t value) {
-  _internal_set_hdrid(value);
-  // @@protoc_insertion_point(field_set:rp4.FieldInfo.hdrId)
+inline void GatewayParam::set_paramtype(::rp4::ParameterType value) {
+  _internal_set_paramtype(value);
+  // @@protoc_insertion_point(field_set:rp4.GatewayParam.paramType)
 }
 
-// int32 internalOffset = 2;
-inline void FieldInfo::clear_internaloffset() {
-  _impl_.internaloffset_ = 0;
+// .rp4.FieldInfo field = 2;
+inline bool GatewayParam::_internal_has_field() const {
+  return value_case() == kField;
 }
-inline int32_t FieldInfo::_internal_internaloffset() const {
-  return _impl_.internaloffset_;
+inline bool GatewayParam::has_field() const {
+  return _internal_has_field();
 }
-inline int32_t FieldInfo::internaloffset() const {
-  // @@protoc_insertion_point(field_get:rp4.FieldInfo.internalOffset)
-  return _internal_internaloffset();
+inline void GatewayParam::set_has_field() {
+  _impl_._oneof_case_[0] = kField;
 }
-inline void FieldInfo::_internal_set_internaloffset(int32_t value) {
-  
-  _impl_.internaloffset_ = value;
+inline void GatewayParam::clear_field() {
+  if (_internal_has_field()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.value_.field_;
+    }
+    clear_has_value();
+  }
 }
-inline void FieldInfo::set_internaloffset(int32_t value) {
-  _internal_set_internaloffset(value);
-  // @@protoc_insertion_point(field_set:rp4.FieldInfo.internalOffset)
+inline ::rp4::FieldInfo* GatewayParam::release_field() {
+  // @@protoc_insertion_point(field_release:rp4.GatewayParam.field)
+  if (_internal_has_field()) {
+    clear_has_value();
+    ::rp4::FieldInfo* temp = _impl_.value_.field_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.value_.field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-
-// int32 fieldLen = 3;
-inline void FieldInfo::clear_fieldlen() {
-  _impl_.fieldlen_ = 0;
+inline const ::rp4::FieldInfo& GatewayParam::_internal_field() const {
+  return _internal_has_field()
+      ? *_impl_.value_.field_
+      : reinterpret_cast< ::rp4::FieldInfo&>(::rp4::_FieldInfo_default_instance_);
 }
-inline int32_t FieldInfo::_internal_fieldlen() const {
-  return _impl_.fieldlen_;
+inline const ::rp4::FieldInfo& GatewayParam::field() const {
+  // @@protoc_insertion_point(field_get:rp4.GatewayParam.field)
+  return _internal_field();
 }
-inline int32_t FieldInfo::fieldlen() const {
-  // @@protoc_insertion_point(field_get:rp4.FieldInfo.fieldLen)
-  return _internal_fieldlen();
+inline ::rp4::FieldInfo* GatewayParam::unsafe_arena_release_field() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.GatewayParam.field)
+  if (_internal_has_field()) {
+    clear_has_value();
+    ::rp4::FieldInfo* temp = _impl_.value_.field_;
+    _impl_.value_.field_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void FieldInfo::_internal_set_fieldlen(int32_t value) {
-  
-  _impl_.fieldlen_ = value;
+inline void GatewayParam::unsafe_arena_set_allocated_field(::rp4::FieldInfo* field) {
+  clear_value();
+  if (field) {
+    set_has_field();
+    _impl_.value_.field_ = field;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.GatewayParam.field)
 }
-inline void FieldInfo::set_fieldlen(int32_t value) {
-  _internal_set_fieldlen(value);
-  // @@protoc_insertion_point(field_set:rp4.FieldInfo.fieldLen)
+inline ::rp4::FieldInfo* GatewayParam::_internal_mutable_field() {
+  if (!_internal_has_field()) {
+    clear_value();
+    set_has_field();
+    _impl_.value_.field_ = CreateMaybeMessage< ::rp4::FieldInfo >(GetArenaForAllocation());
+  }
+  return _impl_.value_.field_;
+}
+inline ::rp4::FieldInfo* GatewayParam::mutable_field() {
+  ::rp4::FieldInfo* _msg = _internal_mutable_field();
+  // @@protoc_insertion_point(field_mutable:rp4.GatewayParam.field)
+  return _msg;
 }
 
-// .rp4.FieldType fieldType = 4;
-inline void FieldInfo::clear_fieldtype() {
-  _impl_.fieldtype_ = 0;
+// .rp4.Data data = 3;
+inline bool GatewayParam::_internal_has_data() const {
+  return value_case() == kData;
 }
-inline ::rp4::FieldType FieldInfo::_internal_fieldtype() const {
-  return static_cast< ::rp4::FieldType >(_impl_.fieldtype_);
+inline bool GatewayParam::has_data() const {
+  return _internal_has_data();
 }
-inline ::rp4::FieldType FieldInfo::fieldtype() const {
-  // @@protoc_insertion_point(field_get:rp4.FieldInfo.fieldType)
-  return _internal_fieldtype();
+inline void GatewayParam::set_has_data() {
+  _impl_._oneof_case_[0] = kData;
+}
+inline void GatewayParam::clear_data() {
+  if (_internal_has_data()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.value_.data_;
+    }
+    clear_has_value();
+  }
+}
+inline ::rp4::Data* GatewayParam::release_data() {
+  // @@protoc_insertion_point(field_release:rp4.GatewayParam.data)
+  if (_internal_has_data()) {
+    clear_has_value();
+    ::rp4::Data* temp = _impl_.value_.data_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.value_.data_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::rp4::Data& GatewayParam::_internal_data() const {
+  return _internal_has_data()
+      ? *_impl_.value_.data_
+      : reinterpret_cast< ::rp4::Data&>(::rp4::_Data_default_instance_);
+}
+inline const ::rp4::Data& GatewayParam::data() const {
+  // @@protoc_insertion_point(field_get:rp4.GatewayParam.data)
+  return _internal_data();
+}
+inline ::rp4::Data* GatewayParam::unsafe_arena_release_data() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.GatewayParam.data)
+  if (_internal_has_data()) {
+    clear_has_value();
+    ::rp4::Data* temp = _impl_.value_.data_;
+    _impl_.value_.data_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GatewayParam::unsafe_arena_set_allocated_data(::rp4::Data* data) {
+  clear_value();
+  if (data) {
+    set_has_data();
+    _impl_.value_.data_ = data;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.GatewayParam.data)
+}
+inline ::rp4::Data* GatewayParam::_internal_mutable_data() {
+  if (!_internal_has_data()) {
+    clear_value();
+    set_has_data();
+    _impl_.value_.data_ = CreateMaybeMessage< ::rp4::Data >(GetArenaForAllocation());
+  }
+  return _impl_.value_.data_;
+}
+inline ::rp4::Data* GatewayParam::mutable_data() {
+  ::rp4::Data* _msg = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:rp4.GatewayParam.data)
+  return _msg;
+}
+
+inline bool GatewayParam::has_value() const {
+  return value_case() != VALUE_NOT_SET;
 }
-inline void FieldInfo::_internal_set_fieldtype(::rp4::FieldType value) {
-  
-  _impl_.fieldtype_ = value;
+inline void GatewayParam::clear_has_value() {
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
 }
-inline void FieldInfo::set_fieldtype(::rp4::FieldType value) {
-  _internal_set_fieldtype(value);
-  // @@protoc_insertion_point(field_set:rp4.FieldInfo.fieldType)
+inline GatewayParam::ValueCase GatewayParam::value_case() const {
+  return GatewayParam::ValueCase(_impl_._oneof_case_[0]);
 }
-
 // -------------------------------------------------------------------
 
-// ModParserEntryReq
+// RelationExp
 
-// int32 procId = 1;
-inline void ModParserEntryReq::clear_procid() {
-  _impl_.procid_ = 0;
-}
-inline int32_t ModParserEntryReq::_internal_procid() const {
-  return _impl_.procid_;
-}
-inline int32_t ModParserEntryReq::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.procId)
-  return _internal_procid();
+// .rp4.GatewayParam param1 = 1;
+inline bool RelationExp::_internal_has_param1() const {
+  return this != internal_default_instance() && _impl_.param1_ != nullptr;
 }
-inline void ModParserEntryReq::_internal_set_procid(int32_t value) {
-  
-  _impl_.procid_ = value;
+inline bool RelationExp::has_param1() const {
+  return _internal_has_param1();
 }
-inline void ModParserEntryReq::set_procid(int32_t value) {
-  _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.procId)
+inline void RelationExp::clear_param1() {
+  if (GetArenaForAllocation() == nullptr && _impl_.param1_ != nullptr) {
+    delete _impl_.param1_;
+  }
+  _impl_.param1_ = nullptr;
 }
-
-// int32 parserLevel = 2;
-inline void ModParserEntryReq::clear_parserlevel() {
-  _impl_.parserlevel_ = 0;
+inline const ::rp4::GatewayParam& RelationExp::_internal_param1() const {
+  const ::rp4::GatewayParam* p = _impl_.param1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::rp4::GatewayParam&>(
+      ::rp4::_GatewayParam_default_instance_);
 }
-inline int32_t ModParserEntryReq::_internal_parserlevel() const {
-  return _impl_.parserlevel_;
+inline const ::rp4::GatewayParam& RelationExp::param1() const {
+  // @@protoc_insertion_point(field_get:rp4.RelationExp.param1)
+  return _internal_param1();
 }
-inline int32_t ModParserEntryReq::parserlevel() const {
-  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.parserLevel)
-  return _internal_parserlevel();
+inline void RelationExp::unsafe_arena_set_allocated_param1(
+    ::rp4::GatewayParam* param1) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.param1_);
+  }
+  _impl_.param1_ = param1;
+  if (param1) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.RelationExp.param1)
 }
-inline void ModParserEntryReq::_internal_set_parserlevel(int32_t value) {
+inline ::rp4::GatewayParam* RelationExp::release_param1() {
   
-  _impl_.parserlevel_ = value;
-}
-inline void ModParserEntryReq::set_parserlevel(int32_t value) {
-  _internal_set_parserlevel(value);
-  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.parserLevel)
-}
-
-// int32 state = 3;
-inline void ModParserEntryReq::clear_state() {
-  _impl_.state_ = 0;
-}
-inline int32_t ModParserEntryReq::_internal_state() const {
-  return _impl_.state_;
+  ::rp4::GatewayParam* temp = _impl_.param1_;
+  _impl_.param1_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline int32_t ModParserEntryReq::state() const {
-  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.state)
-  return _internal_state();
+inline ::rp4::GatewayParam* RelationExp::unsafe_arena_release_param1() {
+  // @@protoc_insertion_point(field_release:rp4.RelationExp.param1)
+  
+  ::rp4::GatewayParam* temp = _impl_.param1_;
+  _impl_.param1_ = nullptr;
+  return temp;
 }
-inline void ModParserEntryReq::_internal_set_state(int32_t value) {
+inline ::rp4::GatewayParam* RelationExp::_internal_mutable_param1() {
   
-  _impl_.state_ = value;
+  if (_impl_.param1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::rp4::GatewayParam>(GetArenaForAllocation());
+    _impl_.param1_ = p;
+  }
+  return _impl_.param1_;
 }
-inline void ModParserEntryReq::set_state(int32_t value) {
-  _internal_set_state(value);
-  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.state)
+inline ::rp4::GatewayParam* RelationExp::mutable_param1() {
+  ::rp4::GatewayParam* _msg = _internal_mutable_param1();
+  // @@protoc_insertion_point(field_mutable:rp4.RelationExp.param1)
+  return _msg;
+}
+inline void RelationExp::set_allocated_param1(::rp4::GatewayParam* param1) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.param1_;
+  }
+  if (param1) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(param1);
+    if (message_arena != submessage_arena) {
+      param1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, param1, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.param1_ = param1;
+  // @@protoc_insertion_point(field_set_allocated:rp4.RelationExp.param1)
 }
 
-// uint32 key = 4;
-inline void ModParserEntryReq::clear_key() {
-  _impl_.key_ = 0u;
+// .rp4.GatewayParam param2 = 2;
+inline bool RelationExp::_internal_has_param2() const {
+  return this != internal_default_instance() && _impl_.param2_ != nullptr;
 }
-inline uint32_t ModParserEntryReq::_internal_key() const {
-  return _impl_.key_;
+inline bool RelationExp::has_param2() const {
+  return _internal_has_param2();
 }
-inline uint32_t ModParserEntryReq::key() const {
-  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.key)
-  return _internal_key();
+inline void RelationExp::clear_param2() {
+  if (GetArenaForAllocation() == nullptr && _impl_.param2_ != nullptr) {
+    delete _impl_.param2_;
+  }
+  _impl_.param2_ = nullptr;
 }
-inline void ModParserEntryReq::_internal_set_key(uint32_t value) {
-  
-  _impl_.key_ = value;
+inline const ::rp4::GatewayParam& RelationExp::_internal_param2() const {
+  const ::rp4::GatewayParam* p = _impl_.param2_;
+  return p != nullptr ? *p : reinterpret_cast<const ::rp4::GatewayParam&>(
+      ::rp4::_GatewayParam_default_instance_);
 }
-inline void ModParserEntryReq::set_key(uint32_t value) {
-  _internal_set_key(value);
-  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.key)
+inline const ::rp4::GatewayParam& RelationExp::param2() const {
+  // @@protoc_insertion_point(field_get:rp4.RelationExp.param2)
+  return _internal_param2();
 }
-
-// int32 mask = 5;
-inline void ModParserEntryReq::clear_mask() {
-  _impl_.mask_ = 0;
+inline void RelationExp::unsafe_arena_set_allocated_param2(
+    ::rp4::GatewayParam* param2) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.param2_);
+  }
+  _impl_.param2_ = param2;
+  if (param2) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.RelationExp.param2)
 }
-inline int32_t ModParserEntryReq::_internal_mask() const {
-  return _impl_.mask_;
+inline ::rp4::GatewayParam* RelationExp::release_param2() {
+  
+  ::rp4::GatewayParam* temp = _impl_.param2_;
+  _impl_.param2_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline int32_t ModParserEntryReq::mask() const {
-  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.mask)
-  return _internal_mask();
+inline ::rp4::GatewayParam* RelationExp::unsafe_arena_release_param2() {
+  // @@protoc_insertion_point(field_release:rp4.RelationExp.param2)
+  
+  ::rp4::GatewayParam* temp = _impl_.param2_;
+  _impl_.param2_ = nullptr;
+  return temp;
 }
-inline void ModParserEntryReq::_internal_set_mask(int32_t value) {
+inline ::rp4::GatewayParam* RelationExp::_internal_mutable_param2() {
   
-  _impl_.mask_ = value;
+  if (_impl_.param2_ == nullptr) {
+    auto* p = CreateMaybeMessage<::rp4::GatewayParam>(GetArenaForAllocation());
+    _impl_.param2_ = p;
+  }
+  return _impl_.param2_;
 }
-inline void ModParserEntryReq::set_mask(int32_t value) {
-  _internal_set_mask(value);
-  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.mask)
+inline ::rp4::GatewayParam* RelationExp::mutable_param2() {
+  ::rp4::GatewayParam* _msg = _internal_mutable_param2();
+  // @@protoc_insertion_point(field_mutable:rp4.RelationExp.param2)
+  return _msg;
+}
+inline void RelationExp::set_allocated_param2(::rp4::GatewayParam* param2) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.param2_;
+  }
+  if (param2) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(param2);
+    if (message_arena != submessage_arena) {
+      param2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, param2, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.param2_ = param2;
+  // @@protoc_insertion_point(field_set_allocated:rp4.RelationExp.param2)
 }
 
-// int32 hdrId = 6;
-inline void ModParserEntryReq::clear_hdrid() {
-  _impl_.hdrid_ = 0;
+// .rp4.RelationCode relation = 3;
+inline void RelationExp::clear_relation() {
+  _impl_.relation_ = 0;
 }
-inline int32_t ModParserEntryReq::_internal_hdrid() const {
-  return _impl_.hdrid_;
+inline ::rp4::RelationCode RelationExp::_internal_relation() const {
+  return static_cast< ::rp4::RelationCode >(_impl_.relation_);
 }
-inline int32_t ModParserEntryReq::hdrid() const {
-  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.hdrId)
-  return _internal_hdrid();
+inline ::rp4::RelationCode RelationExp::relation() const {
+  // @@protoc_insertion_point(field_get:rp4.RelationExp.relation)
+  return _internal_relation();
 }
-inline void ModParserEntryReq::_internal_set_hdrid(int32_t value) {
+inline void RelationExp::_internal_set_relation(::rp4::RelationCode value) {
   
-  _impl_.hdrid_ = value;
+  _impl_.relation_ = value;
 }
-inline void ModParserEntryReq::set_hdrid(int32_t value) {
-  _internal_set_hdrid(value);
-  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.hdrId)
+inline void RelationExp::set_relation(::rp4::RelationCode value) {
+  _internal_set_relation(value);
+  // @@protoc_insertion_point(field_set:rp4.RelationExp.relation)
 }
 
-// int32 hdrLen = 7;
-inline void ModParserEntryReq::clear_hdrlen() {
-  _impl_.hdrlen_ = 0;
+// -------------------------------------------------------------------
+
+// InsertRelationExpReq
+
+// int32 procId = 1;
+inline void InsertRelationExpReq::clear_procid() {
+  _impl_.procid_ = 0;
 }
-inline int32_t ModParserEntryReq::_internal_hdrlen() const {
-  return _impl_.hdrlen_;
+inline int32_t InsertRelationExpReq::_internal_procid() const {
+  return _impl_.procid_;
 }
-inline int32_t ModParserEntryReq::hdrlen() const {
-  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.hdrLen)
-  return _internal_hdrlen();
+inline int32_t InsertRelationExpReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertRelationExpReq.procId)
+  return _internal_procid();
 }
-inline void ModParserEntryReq::_internal_set_hdrlen(int32_t value) {
+inline void InsertRelationExpReq::_internal_set_procid(int32_t value) {
   
-  _impl_.hdrlen_ = value;
+  _impl_.procid_ = value;
 }
-inline void ModParserEntryReq::set_hdrlen(int32_t value) {
-  _internal_set_hdrlen(value);
-  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.hdrLen)
+inline void InsertRelationExpReq::set_procid(int32_t value) {
+  _internal_set_procid(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertRelationExpReq.procId)
 }
 
-// int32 nextState = 8;
-inline void ModParserEntryReq::clear_nextstate() {
-  _impl_.nextstate_ = 0;
+// .rp4.GatewayParam param1 = 2;
+inline bool InsertRelationExpReq::_internal_has_param1() const {
+  return this != internal_default_instance() && _impl_.param1_ != nullptr;
 }
-inline int32_t ModParserEntryReq::_internal_nextstate() const {
-  return _impl_.nextstate_;
+inline bool InsertRelationExpReq::has_param1() const {
+  return _internal_has_param1();
 }
-inline int32_t ModParserEntryReq::nextstate() const {
-  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.nextState)
-  return _internal_nextstate();
+inline void InsertRelationExpReq::clear_param1() {
+  if (GetArenaForAllocation() == nullptr && _impl_.param1_ != nullptr) {
+    delete _impl_.param1_;
+  }
+  _impl_.param1_ = nullptr;
 }
-inline void ModParserEntryReq::_internal_set_nextstate(int32_t value) {
-  
-  _impl_.nextstate_ = value;
+inline const ::rp4::GatewayParam& InsertRelationExpReq::_internal_param1() const {
+  const ::rp4::GatewayParam* p = _impl_.param1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::rp4::GatewayParam&>(
+      ::rp4::_GatewayParam_default_instance_);
 }
-inline void ModParserEntryReq::set_nextstate(int32_t value) {
-  _internal_set_nextstate(value);
-  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.nextState)
+inline const ::rp4::GatewayParam& InsertRelationExpReq::param1() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertRelationExpReq.param1)
+  return _internal_param1();
 }
-
-// int32 transFieldNum = 9;
-inline void ModParserEntryReq::clear_transfieldnum() {
-  _impl_.transfieldnum_ = 0;
+inline void InsertRelationExpReq::unsafe_arena_set_allocated_param1(
+    ::rp4::GatewayParam* param1) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.param1_);
+  }
+  _impl_.param1_ = param1;
+  if (param1) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.InsertRelationExpReq.param1)
 }
-inline int32_t ModParserEntryReq::_internal_transfieldnum() const {
-  return _impl_.transfieldnum_;
+inline ::rp4::GatewayParam* InsertRelationExpReq::release_param1() {
+  
+  ::rp4::GatewayParam* temp = _impl_.param1_;
+  _impl_.param1_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline int32_t ModParserEntryReq::transfieldnum() const {
-  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.transFieldNum)
-  return _internal_transfieldnum();
+inline ::rp4::GatewayParam* InsertRelationExpReq::unsafe_arena_release_param1() {
+  // @@protoc_insertion_point(field_release:rp4.InsertRelationExpReq.param1)
+  
+  ::rp4::GatewayParam* temp = _impl_.param1_;
+  _impl_.param1_ = nullptr;
+  return temp;
 }
-inline void ModParserEntryReq::_internal_set_transfieldnum(int32_t value) {
+inline ::rp4::GatewayParam* InsertRelationExpReq::_internal_mutable_param1() {
   
-  _impl_.transfieldnum_ = value;
+  if (_impl_.param1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::rp4::GatewayParam>(GetArenaForAllocation());
+    _impl_.param1_ = p;
+  }
+  return _impl_.param1_;
 }
-inline void ModParserEntryReq::set_transfieldnum(int32_t value) {
-  _internal_set_transfieldnum(value);
-  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.transFieldNum)
+inline ::rp4::GatewayParam* InsertRelationExpReq::mutable_param1() {
+  ::rp4::GatewayParam* _msg = _internal_mutable_param1();
+  // @@protoc_insertion_point(field_mutable:rp4.InsertRelationExpReq.param1)
+  return _msg;
+}
+inline void InsertRelationExpReq::set_allocated_param1(::rp4::GatewayParam* param1) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.param1_;
+  }
+  if (param1) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(param1);
+    if (message_arena != submessage_arena) {
+      param1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, param1, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.param1_ = param1;
+  // @@protoc_insertion_point(field_set_allocated:rp4.InsertRelationExpReq.param1)
 }
 
-// repeated .rp4.FieldInfo transFds = 10;
-inline int ModParserEntryReq::_internal_transfds_size() const {
-  return _impl_.transfds_.size();
+// .rp4.GatewayParam param2 = 3;
+inline bool InsertRelationExpReq::_internal_has_param2() const {
+  return this != internal_default_instance() && _impl_.param2_ != nullptr;
 }
-inline int ModParserEntryReq::transfds_size() const {
-  return _internal_transfds_size();
+inline bool InsertRelationExpReq::has_param2() const {
+  return _internal_has_param2();
 }
-inline void ModParserEntryReq::clear_transfds() {
-  _impl_.transfds_.Clear();
+inline void InsertRelationExpReq::clear_param2() {
+  if (GetArenaForAllocation() == nullptr && _impl_.param2_ != nullptr) {
+    delete _impl_.param2_;
+  }
+  _impl_.param2_ = nullptr;
 }
-inline ::rp4::FieldInfo* ModParserEntryReq::mutable_transfds(int index) {
-  // @@protoc_insertion_point(field_mutable:rp4.ModParserEntryReq.transFds)
-  return _impl_.transfds_.Mutable(index);
+inline const ::rp4::GatewayParam& InsertRelationExpReq::_internal_param2() const {
+  const ::rp4::GatewayParam* p = _impl_.param2_;
+  return p != nullptr ? *p : reinterpret_cast<const ::rp4::GatewayParam&>(
+      ::rp4::_GatewayParam_default_instance_);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >*
-ModParserEntryReq::mutable_transfds() {
-  // @@protoc_insertion_point(field_mutable_list:rp4.ModParserEntryReq.transFds)
-  return &_impl_.transfds_;
+inline const ::rp4::GatewayParam& InsertRelationExpReq::param2() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertRelationExpReq.param2)
+  return _internal_param2();
 }
-inline const ::rp4::FieldInfo& ModParserEntryReq::_internal_transfds(int index) const {
-  return _impl_.transfds_.Get(index);
+inline void InsertRelationExpReq::unsafe_arena_set_allocated_param2(
+    ::rp4::GatewayParam* param2) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.param2_);
+  }
+  _impl_.param2_ = param2;
+  if (param2) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.InsertRelationExpReq.param2)
 }
-inline const ::rp4::FieldInfo& ModParserEntryReq::transfds(int index) const {
-  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.transFds)
-  return _internal_transfds(index);
+inline ::rp4::GatewayParam* InsertRelationExpReq::release_param2() {
+  
+  ::rp4::GatewayParam* temp = _impl_.param2_;
+  _impl_.param2_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::rp4::FieldInfo* ModParserEntryReq::_internal_add_transfds() {
-  return _impl_.transfds_.Add();
+inline ::rp4::GatewayParam* InsertRelationExpReq::unsafe_arena_release_param2() {
+  // @@protoc_insertion_point(field_release:rp4.InsertRelationExpReq.param2)
+  
+  ::rp4::GatewayParam* temp = _impl_.param2_;
+  _impl_.param2_ = nullptr;
+  return temp;
 }
-inline ::rp4::FieldInfo* ModParserEntryReq::add_transfds() {
-  ::rp4::FieldInfo* _add = _internal_add_transfds();
-  // @@protoc_insertion_point(field_add:rp4.ModParserEntryReq.transFds)
-  return _add;
+inline ::rp4::GatewayParam* InsertRelationExpReq::_internal_mutable_param2() {
+  
+  if (_impl_.param2_ == nullptr) {
+    auto* p = CreateMaybeMessage<::rp4::GatewayParam>(GetArenaForAllocation());
+    _impl_.param2_ = p;
+  }
+  return _impl_.param2_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >&
-ModParserEntryReq::transfds() const {
-  // @@protoc_insertion_point(field_list:rp4.ModParserEntryReq.transFds)
-  return _impl_.transfds_;
+inline ::rp4::GatewayParam* InsertRelationExpReq::mutable_param2() {
+  ::rp4::GatewayParam* _msg = _internal_mutable_param2();
+  // @@protoc_insertion_point(field_mutable:rp4.InsertRelationExpReq.param2)
+  return _msg;
+}
+inline void InsertRelationExpReq::set_allocated_param2(::rp4::GatewayParam* param2) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.param2_;
+  }
+  if (param2) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(param2);
+    if (message_arena != submessage_arena) {
+      param2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, param2, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.param2_ = param2;
+  // @@protoc_insertion_point(field_set_allocated:rp4.InsertRelationExpReq.param2)
 }
 
-// int32 miss_act = 11;
-inline void ModParserEntryReq::clear_miss_act() {
-  _impl_.miss_act_ = 0;
+// .rp4.RelationCode relation = 4;
+inline void InsertRelationExpReq::clear_relation() {
+  _impl_.relation_ = 0;
 }
-inline int32_t ModParserEntryReq::_internal_miss_act() const {
-  return _impl_.miss_act_;
+inline ::rp4::RelationCode InsertRelationExpReq::_internal_relation() const {
+  return static_cast< ::rp4::RelationCode >(_impl_.relation_);
 }
-inline int32_t ModParserEntryReq::miss_act() const {
-  // @@protoc_insertion_point(field_get:rp4.ModParserEntryReq.miss_act)
-  return _internal_miss_act();
+inline ::rp4::RelationCode InsertRelationExpReq::relation() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertRelationExpReq.relation)
+  return _internal_relation();
 }
-inline void ModParserEntryReq::_internal_set_miss_act(int32_t value) {
+inline void InsertRelationExpReq::_internal_set_relation(::rp4::RelationCode value) {
   
-  _impl_.miss_act_ = value;
+  _impl_.relation_ = value;
 }
-inline void ModParserEntryReq::set_miss_act(int32_t value) {
-  _internal_set_miss_act(value);
-  // @@protoc_insertion_point(field_set:rp4.ModParserEntryReq.miss_act)
+inline void InsertRelationExpReq::set_relation(::rp4::RelationCode value) {
+  _internal_set_relation(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertRelationExpReq.relation)
 }
 
 // -------------------------------------------------------------------
 
-// ModParserEntryResp
+// InsertRelationExpResp
 
 // .rp4.Res res = 1;
-inline void ModParserEntryResp::clear_res() {
+inline void InsertRelationExpResp::clear_res() {
   _impl_.res_ = 0;
 }
-inline ::rp4::Res ModParserEntryResp::_internal_res() const {
+inline ::rp4::Res InsertRelationExpResp::_internal_res() const {
   return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::Res ModParserEntryResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.ModParserEntryResp.res)
+inline ::rp4::Res InsertRelationExpResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertRelationExpResp.res)
   return _internal_res();
 }
-inline void ModParserEntryResp::_internal_set_res(::rp4::Res value) {
+inline void InsertRelationExpResp::_internal_set_res(::rp4::Res value) {
   
   _impl_.res_ = value;
 }
-inline void ModParserEntryResp::set_res(::rp4::Res value) {
+inline void InsertRelationExpResp::set_res(::rp4::Res value) {
   _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.ModParserEntryResp.res)
+  // @@protoc_insertion_point(field_set:rp4.InsertRelationExpResp.res)
 }
 
 // -------------------------------------------------------------------
 
-// ClearParserReq
+// ClearRelationExpReq
 
 // int32 procId = 1;
-inline void ClearParserReq::clear_procid() {
+inline void ClearRelationExpReq::clear_procid() {
   _impl_.procid_ = 0;
 }
-inline int32_t ClearParserReq::_internal_procid() const {
+inline int32_t ClearRelationExpReq::_internal_procid() const {
   return _impl_.procid_;
 }
-inline int32_t ClearParserReq::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.ClearParserReq.procId)
+inline int32_t ClearRelationExpReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.ClearRelationExpReq.procId)
   return _internal_procid();
 }
-inline void ClearParserReq::_internal_set_procid(int32_t value) {
+inline void ClearRelationExpReq::_internal_set_procid(int32_t value) {
   
   _impl_.procid_ = value;
 }
-inline void ClearParserReq::set_procid(int32_t value) {
+inline void ClearRelationExpReq::set_procid(int32_t value) {
   _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.ClearParserReq.procId)
+  // @@protoc_insertion_point(field_set:rp4.ClearRelationExpReq.procId)
 }
 
 // -------------------------------------------------------------------
 
-// ClearParserResp
+// ClearRelationExpResp
 
 // .rp4.Res res = 1;
-inline void ClearParserResp::clear_res() {
+inline void ClearRelationExpResp::clear_res() {
   _impl_.res_ = 0;
 }
-inline ::rp4::Res ClearParserResp::_internal_res() const {
+inline ::rp4::Res ClearRelationExpResp::_internal_res() const {
   return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::Res ClearParserResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.ClearParserResp.res)
+inline ::rp4::Res ClearRelationExpResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.ClearRelationExpResp.res)
   return _internal_res();
 }
-inline void ClearParserResp::_internal_set_res(::rp4::Res value) {
+inline void ClearRelationExpResp::_internal_set_res(::rp4::Res value) {
   
   _impl_.res_ = value;
 }
-inline void ClearParserResp::set_res(::rp4::Res value) {
+inline void ClearRelationExpResp::set_res(::rp4::Res value) {
   _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.ClearParserResp.res)
+  // @@protoc_insertion_point(field_set:rp4.ClearRelationExpResp.res)
 }
 
 // -------------------------------------------------------------------
 
-// Data
-
-// int32 len = 1;
-inline void Data::clear_len() {
-  _impl_.len_ = 0;
-}
-inline int32_t Data::_internal_len() const {
-  return _impl_.len_;
-}
-inline int32_t Data::len() const {
-  // @@protoc_insertion_point(field_get:rp4.Data.len)
-  return _internal_len();
-}
-inline void Data::_internal_set_len(int32_t value) {
-  
-  _impl_.len_ = value;
-}
-inline void Data::set_len(int32_t value) {
-  _internal_set_len(value);
-  // @@protoc_insertion_point(field_set:rp4.Data.len)
-}
+// ClearResMapReq
 
-// bytes val = 2;
-inline void Data::clear_val() {
-  _impl_.val_.ClearToEmpty();
-}
-inline const std::string& Data::val() const {
-  // @@protoc_insertion_point(field_get:rp4.Data.val)
-  return _internal_val();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Data::set_val(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.val_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:rp4.Data.val)
-}
-inline std::string* Data::mutable_val() {
-  std::string* _s = _internal_mutable_val();
-  // @@protoc_insertion_point(field_mutable:rp4.Data.val)
-  return _s;
+// int32 procId = 1;
+inline void ClearResMapReq::clear_procid() {
+  _impl_.procid_ = 0;
 }
-inline const std::string& Data::_internal_val() const {
-  return _impl_.val_.Get();
+inline int32_t ClearResMapReq::_internal_procid() const {
+  return _impl_.procid_;
 }
-inline void Data::_internal_set_val(const std::string& value) {
-  
-  _impl_.val_.Set(value, GetArenaForAllocation());
+inline int32_t ClearResMapReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.ClearResMapReq.procId)
+  return _internal_procid();
 }
-inline std::string* Data::_internal_mutable_val() {
+inline void ClearResMapReq::_internal_set_procid(int32_t value) {
   
-  return _impl_.val_.Mutable(GetArenaForAllocation());
-}
-inline std::string* Data::release_val() {
-  // @@protoc_insertion_point(field_release:rp4.Data.val)
-  return _impl_.val_.Release();
+  _impl_.procid_ = value;
 }
-inline void Data::set_allocated_val(std::string* val) {
-  if (val != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.val_.SetAllocated(val, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.val_.IsDefault()) {
-    _impl_.val_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:rp4.Data.val)
+inline void ClearResMapReq::set_procid(int32_t value) {
+  _internal_set_procid(value);
+  // @@protoc_insertion_point(field_set:rp4.ClearResMapReq.procId)
 }
 
 // -------------------------------------------------------------------
 
-// GateEntry
+// ClearResMapResp
 
-// .rp4.GateEntryType type = 1;
-inline void GateEntry::clear_type() {
-  _impl_.type_ = 0;
+// .rp4.Res res = 1;
+inline void ClearResMapResp::clear_res() {
+  _impl_.res_ = 0;
 }
-inline ::rp4::GateEntryType GateEntry::_internal_type() const {
-  return static_cast< ::rp4::GateEntryType >(_impl_.type_);
+inline ::rp4::Res ClearResMapResp::_internal_res() const {
+  return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::GateEntryType GateEntry::type() const {
-  // @@protoc_insertion_point(field_get:rp4.GateEntry.type)
-  return _internal_type();
+inline ::rp4::Res ClearResMapResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.ClearResMapResp.res)
+  return _internal_res();
 }
-inline void GateEntry::_internal_set_type(::rp4::GateEntryType value) {
+inline void ClearResMapResp::_internal_set_res(::rp4::Res value) {
   
-  _impl_.type_ = value;
+  _impl_.res_ = value;
 }
-inline void GateEntry::set_type(::rp4::GateEntryType value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:rp4.GateEntry.type)
+inline void ClearResMapResp::set_res(::rp4::Res value) {
+  _internal_set_res(value);
+  // @@protoc_insertion_point(field_set:rp4.ClearResMapResp.res)
 }
 
-// int32 val = 2;
-inline void GateEntry::clear_val() {
-  _impl_.val_ = 0;
+// -------------------------------------------------------------------
+
+// ModResMapReq
+
+// int32 procId = 1;
+inline void ModResMapReq::clear_procid() {
+  _impl_.procid_ = 0;
 }
-inline int32_t GateEntry::_internal_val() const {
-  return _impl_.val_;
+inline int32_t ModResMapReq::_internal_procid() const {
+  return _impl_.procid_;
 }
-inline int32_t GateEntry::val() const {
-  // @@protoc_insertion_point(field_get:rp4.GateEntry.val)
-  return _internal_val();
+inline int32_t ModResMapReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.ModResMapReq.procId)
+  return _internal_procid();
 }
-inline void GateEntry::_internal_set_val(int32_t value) {
+inline void ModResMapReq::_internal_set_procid(int32_t value) {
   
-  _impl_.val_ = value;
+  _impl_.procid_ = value;
 }
-inline void GateEntry::set_val(int32_t value) {
-  _internal_set_val(value);
-  // @@protoc_insertion_point(field_set:rp4.GateEntry.val)
+inline void ModResMapReq::set_procid(int32_t value) {
+  _internal_set_procid(value);
+  // @@protoc_insertion_point(field_set:rp4.ModResMapReq.procId)
 }
 
-// -------------------------------------------------------------------
-
-// SetDefaultGateEntryReq
-
-// int32 proc_id = 1;
-inline void SetDefaultGateEntryReq::clear_proc_id() {
-  _impl_.proc_id_ = 0;
+// int32 key = 2;
+inline void ModResMapReq::clear_key() {
+  _impl_.key_ = 0;
 }
-inline int32_t SetDefaultGateEntryReq::_internal_proc_id() const {
-  return _impl_.proc_id_;
+inline int32_t ModResMapReq::_internal_key() const {
+  return _impl_.key_;
 }
-inline int32_t SetDefaultGateEntryReq::proc_id() const {
-  // @@protoc_insertion_point(field_get:rp4.SetDefaultGateEntryReq.proc_id)
-  return _internal_proc_id();
+inline int32_t ModResMapReq::key() const {
+  // @@protoc_insertion_point(field_get:rp4.ModResMapReq.key)
+  return _internal_key();
 }
-inline void SetDefaultGateEntryReq::_internal_set_proc_id(int32_t value) {
+inline void ModResMapReq::_internal_set_key(int32_t value) {
   
-  _impl_.proc_id_ = value;
+  _impl_.key_ = value;
 }
-inline void SetDefaultGateEntryReq::set_proc_id(int32_t value) {
-  _internal_set_proc_id(value);
-  // @@protoc_insertion_point(field_set:rp4.SetDefaultGateEntryReq.proc_id)
+inline void ModResMapReq::set_key(int32_t value) {
+  _internal_set_key(value);
+  // @@protoc_insertion_point(field_set:rp4.ModResMapReq.key)
 }
 
-// .rp4.GateEntry default_entry = 2;
-inline bool SetDefaultGateEntryReq::_internal_has_default_entry() const {
-  return this != internal_default_instance() && _impl_.default_entry_ != nullptr;
+// .rp4.GateEntry entry = 3;
+inline bool ModResMapReq::_internal_has_entry() const {
+  return this != internal_default_instance() && _impl_.entry_ != nullptr;
 }
-inline bool SetDefaultGateEntryReq::has_default_entry() const {
-  return _internal_has_default_entry();
+inline bool ModResMapReq::has_entry() const {
+  return _internal_has_entry();
 }
-inline void SetDefaultGateEntryReq::clear_default_entry() {
-  if (GetArenaForAllocation() == nullptr && _impl_.default_entry_ != nullptr) {
-    delete _impl_.default_entry_;
+inline void ModResMapReq::clear_entry() {
+  if (GetArenaForAllocation() == nullptr && _impl_.entry_ != nullptr) {
+    delete _impl_.entry_;
   }
-  _impl_.default_entry_ = nullptr;
+  _impl_.entry_ = nullptr;
 }
-inline const ::rp4::GateEntry& SetDefaultGateEntryReq::_internal_default_entry() const {
-  const ::rp4::GateEntry* p = _impl_.default_entry_;
+inline const ::rp4::GateEntry& ModResMapReq::_internal_entry() const {
+  const ::rp4::GateEntry* p = _impl_.entry_;
   return p != nullptr ? *p : reinterpret_cast<const ::rp4::GateEntry&>(
       ::rp4::_GateEntry_default_instance_);
 }
-inline const ::rp4::GateEntry& SetDefaultGateEntryReq::default_entry() const {
-  // @@protoc_insertion_point(field_get:rp4.SetDefaultGateEntryReq.default_entry)
-  return _internal_default_entry();
+inline const ::rp4::GateEntry& ModResMapReq::entry() const {
+  // @@protoc_insertion_point(field_get:rp4.ModResMapReq.entry)
+  return _internal_entry();
 }
-inline void SetDefaultGateEntryReq::unsafe_arena_set_allocated_default_entry(
-    ::rp4::GateEntry* default_entry) {
+inline void ModResMapReq::unsafe_arena_set_allocated_entry(
+    ::rp4::GateEntry* entry) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.default_entry_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.entry_);
   }
-  _impl_.default_entry_ = default_entry;
-  if (default_entry) {
+  _impl_.entry_ = entry;
+  if (entry) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.SetDefaultGateEntryReq.default_entry)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ModResMapReq.entry)
 }
-inline ::rp4::GateEntry* SetDefaultGateEntryReq::release_default_entry() {
+inline ::rp4::GateEntry* ModResMapReq::release_entry() {
   
-  ::rp4::GateEntry* temp = _impl_.default_entry_;
-  _impl_.default_entry_ = nullptr;
+  ::rp4::GateEntry* temp = _impl_.entry_;
+  _impl_.entry_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -12493,1653 +19055,1658 @@ inline ::rp4::GateEntry* SetDefaultGateEntryReq::release_default_entry() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::rp4::GateEntry* SetDefaultGateEntryReq::unsafe_arena_release_default_entry() {
-  // @@protoc_insertion_point(field_release:rp4.SetDefaultGateEntryReq.default_entry)
+inline ::rp4::GateEntry* ModResMapReq::unsafe_arena_release_entry() {
+  // @@protoc_insertion_point(field_release:rp4.ModResMapReq.entry)
   
-  ::rp4::GateEntry* temp = _impl_.default_entry_;
-  _impl_.default_entry_ = nullptr;
+  ::rp4::GateEntry* temp = _impl_.entry_;
+  _impl_.entry_ = nullptr;
   return temp;
 }
-inline ::rp4::GateEntry* SetDefaultGateEntryReq::_internal_mutable_default_entry() {
+inline ::rp4::GateEntry* ModResMapReq::_internal_mutable_entry() {
   
-  if (_impl_.default_entry_ == nullptr) {
+  if (_impl_.entry_ == nullptr) {
     auto* p = CreateMaybeMessage<::rp4::GateEntry>(GetArenaForAllocation());
-    _impl_.default_entry_ = p;
+    _impl_.entry_ = p;
   }
-  return _impl_.default_entry_;
+  return _impl_.entry_;
 }
-inline ::rp4::GateEntry* SetDefaultGateEntryReq::mutable_default_entry() {
-  ::rp4::GateEntry* _msg = _internal_mutable_default_entry();
-  // @@protoc_insertion_point(field_mutable:rp4.SetDefaultGateEntryReq.default_entry)
+inline ::rp4::GateEntry* ModResMapReq::mutable_entry() {
+  ::rp4::GateEntry* _msg = _internal_mutable_entry();
+  // @@protoc_insertion_point(field_mutable:rp4.ModResMapReq.entry)
   return _msg;
 }
-inline void SetDefaultGateEntryReq::set_allocated_default_entry(::rp4::GateEntry* default_entry) {
+inline void ModResMapReq::set_allocated_entry(::rp4::GateEntry* entry) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.default_entry_;
+    delete _impl_.entry_;
   }
-  if (default_entry) {
+  if (entry) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(default_entry);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(entry);
     if (message_arena != submessage_arena) {
-      default_entry = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, default_entry, submessage_arena);
+      entry = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, entry, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.default_entry_ = default_entry;
-  // @@protoc_insertion_point(field_set_allocated:rp4.SetDefaultGateEntryReq.default_entry)
+  _impl_.entry_ = entry;
+  // @@protoc_insertion_point(field_set_allocated:rp4.ModResMapReq.entry)
 }
 
 // -------------------------------------------------------------------
 
-// SetDefaultGateEntryResp
+// ModResMapResp
 
 // .rp4.Res res = 1;
-inline void SetDefaultGateEntryResp::clear_res() {
+inline void ModResMapResp::clear_res() {
   _impl_.res_ = 0;
 }
-inline ::rp4::Res SetDefaultGateEntryResp::_internal_res() const {
+inline ::rp4::Res ModResMapResp::_internal_res() const {
   return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::Res SetDefaultGateEntryResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.SetDefaultGateEntryResp.res)
+inline ::rp4::Res ModResMapResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.ModResMapResp.res)
   return _internal_res();
 }
-inline void SetDefaultGateEntryResp::_internal_set_res(::rp4::Res value) {
+inline void ModResMapResp::_internal_set_res(::rp4::Res value) {
   
   _impl_.res_ = value;
 }
-inline void SetDefaultGateEntryResp::set_res(::rp4::Res value) {
+inline void ModResMapResp::set_res(::rp4::Res value) {
   _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.SetDefaultGateEntryResp.res)
+  // @@protoc_insertion_point(field_set:rp4.ModResMapResp.res)
 }
 
 // -------------------------------------------------------------------
 
-// GatewayParam
+// SetNoTableReq
 
-// .rp4.ParameterType paramType = 1;
-inline void GatewayParam::clear_paramtype() {
-  _impl_.paramtype_ = 0;
+// int32 procId = 1;
+inline void SetNoTableReq::clear_procid() {
+  _impl_.procid_ = 0;
 }
-inline ::rp4::ParameterType GatewayParam::_internal_paramtype() const {
-  return static_cast< ::rp4::ParameterType >(_impl_.paramtype_);
+inline int32_t SetNoTableReq::_internal_procid() const {
+  return _impl_.procid_;
 }
-inline ::rp4::ParameterType GatewayParam::paramtype() const {
-  // @@protoc_insertion_point(field_get:rp4.GatewayParam.paramType)
-  return _internal_paramtype();
+inline int32_t SetNoTableReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.SetNoTableReq.procId)
+  return _internal_procid();
 }
-inline void GatewayParam::_internal_set_paramtype(::rp4::ParameterType value) {
+inline void SetNoTableReq::_internal_set_procid(int32_t value) {
   
-  _impl_.paramtype_ = value;
+  _impl_.procid_ = value;
 }
-inline void GatewayParam::set_paramtype(::rp4::ParameterType value) {
-  _internal_set_paramtype(value);
-  // @@protoc_insertion_point(field_set:rp4.GatewayParam.paramType)
+inline void SetNoTableReq::set_procid(int32_t value) {
+  _internal_set_procid(value);
+  // @@protoc_insertion_point(field_set:rp4.SetNoTableReq.procId)
 }
 
-// .rp4.FieldInfo field = 2;
-inline bool GatewayParam::_internal_has_field() const {
-  return value_case() == kField;
-}
-inline bool GatewayParam::has_field() const {
-  return _internal_has_field();
+// int32 matcherId = 2;
+inline void SetNoTableReq::clear_matcherid() {
+  _impl_.matcherid_ = 0;
 }
-inline void GatewayParam::set_has_field() {
-  _impl_._oneof_case_[0] = kField;
+inline int32_t SetNoTableReq::_internal_matcherid() const {
+  return _impl_.matcherid_;
 }
-inline void GatewayParam::clear_field() {
-  if (_internal_has_field()) {
-    if (GetArenaForAllocation() == nullptr) {
-      delete _impl_.value_.field_;
-    }
-    clear_has_value();
-  }
+inline int32_t SetNoTableReq::matcherid() const {
+  // @@protoc_insertion_point(field_get:rp4.SetNoTableReq.matcherId)
+  return _internal_matcherid();
 }
-inline ::rp4::FieldInfo* GatewayParam::release_field() {
-  // @@protoc_insertion_point(field_release:rp4.GatewayParam.field)
-  if (_internal_has_field()) {
-    clear_has_value();
-    ::rp4::FieldInfo* temp = _impl_.value_.field_;
-    if (GetArenaForAllocation() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    _impl_.value_.field_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void SetNoTableReq::_internal_set_matcherid(int32_t value) {
+  
+  _impl_.matcherid_ = value;
 }
-inline const ::rp4::FieldInfo& GatewayParam::_internal_field() const {
-  return _internal_has_field()
-      ? *_impl_.value_.field_
-      : reinterpret_cast< ::rp4::FieldInfo&>(::rp4::_FieldInfo_default_instance_);
+inline void SetNoTableReq::set_matcherid(int32_t value) {
+  _internal_set_matcherid(value);
+  // @@protoc_insertion_point(field_set:rp4.SetNoTableReq.matcherId)
 }
-inline const ::rp4::FieldInfo& GatewayParam::field() const {
-  // @@protoc_insertion_point(field_get:rp4.GatewayParam.field)
-  return _internal_field();
+
+// bool noTable = 3;
+inline void SetNoTableReq::clear_notable() {
+  _impl_.notable_ = false;
 }
-inline ::rp4::FieldInfo* GatewayParam::unsafe_arena_release_field() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.GatewayParam.field)
-  if (_internal_has_field()) {
-    clear_has_value();
-    ::rp4::FieldInfo* temp = _impl_.value_.field_;
-    _impl_.value_.field_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline bool SetNoTableReq::_internal_notable() const {
+  return _impl_.notable_;
 }
-inline void GatewayParam::unsafe_arena_set_allocated_field(::rp4::FieldInfo* field) {
-  clear_value();
-  if (field) {
-    set_has_field();
-    _impl_.value_.field_ = field;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.GatewayParam.field)
+inline bool SetNoTableReq::notable() const {
+  // @@protoc_insertion_point(field_get:rp4.SetNoTableReq.noTable)
+  return _internal_notable();
 }
-inline ::rp4::FieldInfo* GatewayParam::_internal_mutable_field() {
-  if (!_internal_has_field()) {
-    clear_value();
-    set_has_field();
-    _impl_.value_.field_ = CreateMaybeMessage< ::rp4::FieldInfo >(GetArenaForAllocation());
-  }
-  return _impl_.value_.field_;
+inline void SetNoTableReq::_internal_set_notable(bool value) {
+  
+  _impl_.notable_ = value;
 }
-inline ::rp4::FieldInfo* GatewayParam::mutable_field() {
-  ::rp4::FieldInfo* _msg = _internal_mutable_field();
-  // @@protoc_insertion_point(field_mutable:rp4.GatewayParam.field)
-  return _msg;
+inline void SetNoTableReq::set_notable(bool value) {
+  _internal_set_notable(value);
+  // @@protoc_insertion_point(field_set:rp4.SetNoTableReq.noTable)
 }
 
-// .rp4.Data data = 3;
-inline bool GatewayParam::_internal_has_data() const {
-  return value_case() == kData;
+// -------------------------------------------------------------------
+
+// SetNoTableResp
+
+// .rp4.Res res = 1;
+inline void SetNoTableResp::clear_res() {
+  _impl_.res_ = 0;
 }
-inline bool GatewayParam::has_data() const {
-  return _internal_has_data();
+inline ::rp4::Res SetNoTableResp::_internal_res() const {
+  return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline void GatewayParam::set_has_data() {
-  _impl_._oneof_case_[0] = kData;
+inline ::rp4::Res SetNoTableResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.SetNoTableResp.res)
+  return _internal_res();
 }
-inline void GatewayParam::clear_data() {
-  if (_internal_has_data()) {
-    if (GetArenaForAllocation() == nullptr) {
-      delete _impl_.value_.data_;
-    }
-    clear_has_value();
-  }
+inline void SetNoTableResp::_internal_set_res(::rp4::Res value) {
+  
+  _impl_.res_ = value;
 }
-inline ::rp4::Data* GatewayParam::release_data() {
-  // @@protoc_insertion_point(field_release:rp4.GatewayParam.data)
-  if (_internal_has_data()) {
-    clear_has_value();
-    ::rp4::Data* temp = _impl_.value_.data_;
-    if (GetArenaForAllocation() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    _impl_.value_.data_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void SetNoTableResp::set_res(::rp4::Res value) {
+  _internal_set_res(value);
+  // @@protoc_insertion_point(field_set:rp4.SetNoTableResp.res)
+}
+
+// -------------------------------------------------------------------
+
+// ActionProc
+
+// int32 actionId = 1;
+inline void ActionProc::clear_actionid() {
+  _impl_.actionid_ = 0;
 }
-inline const ::rp4::Data& GatewayParam::_internal_data() const {
-  return _internal_has_data()
-      ? *_impl_.value_.data_
-      : reinterpret_cast< ::rp4::Data&>(::rp4::_Data_default_instance_);
+inline int32_t ActionProc::_internal_actionid() const {
+  return _impl_.actionid_;
 }
-inline const ::rp4::Data& GatewayParam::data() const {
-  // @@protoc_insertion_point(field_get:rp4.GatewayParam.data)
-  return _internal_data();
+inline int32_t ActionProc::actionid() const {
+  // @@protoc_insertion_point(field_get:rp4.ActionProc.actionId)
+  return _internal_actionid();
 }
-inline ::rp4::Data* GatewayParam::unsafe_arena_release_data() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:rp4.GatewayParam.data)
-  if (_internal_has_data()) {
-    clear_has_value();
-    ::rp4::Data* temp = _impl_.value_.data_;
-    _impl_.value_.data_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void ActionProc::_internal_set_actionid(int32_t value) {
+  
+  _impl_.actionid_ = value;
 }
-inline void GatewayParam::unsafe_arena_set_allocated_data(::rp4::Data* data) {
-  clear_value();
-  if (data) {
-    set_has_data();
-    _impl_.value_.data_ = data;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.GatewayParam.data)
+inline void ActionProc::set_actionid(int32_t value) {
+  _internal_set_actionid(value);
+  // @@protoc_insertion_point(field_set:rp4.ActionProc.actionId)
 }
-inline ::rp4::Data* GatewayParam::_internal_mutable_data() {
-  if (!_internal_has_data()) {
-    clear_value();
-    set_has_data();
-    _impl_.value_.data_ = CreateMaybeMessage< ::rp4::Data >(GetArenaForAllocation());
-  }
-  return _impl_.value_.data_;
+
+// int32 procId = 2;
+inline void ActionProc::clear_procid() {
+  _impl_.procid_ = 0;
 }
-inline ::rp4::Data* GatewayParam::mutable_data() {
-  ::rp4::Data* _msg = _internal_mutable_data();
-  // @@protoc_insertion_point(field_mutable:rp4.GatewayParam.data)
-  return _msg;
+inline int32_t ActionProc::_internal_procid() const {
+  return _impl_.procid_;
 }
-
-inline bool GatewayParam::has_value() const {
-  return value_case() != VALUE_NOT_SET;
+inline int32_t ActionProc::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.ActionProc.procId)
+  return _internal_procid();
 }
-inline void GatewayParam::clear_has_value() {
-  _impl_._oneof_case_[0] = VALUE_NOT_SET;
+inline void ActionProc::_internal_set_procid(int32_t value) {
+  
+  _impl_.procid_ = value;
 }
-inline GatewayParam::ValueCase GatewayParam::value_case() const {
-  return GatewayParam::ValueCase(_impl_._oneof_case_[0]);
+inline void ActionProc::set_procid(int32_t value) {
+  _internal_set_procid(value);
+  // @@protoc_insertion_point(field_set:rp4.ActionProc.procId)
 }
+
 // -------------------------------------------------------------------
 
-// RelationExp
+// SetActionProcReq
 
-// .rp4.GatewayParam param1 = 1;
-inline bool RelationExp::_internal_has_param1() const {
-  return this != internal_default_instance() && _impl_.param1_ != nullptr;
+// int32 procId = 1;
+inline void SetActionProcReq::clear_procid() {
+  _impl_.procid_ = 0;
 }
-inline bool RelationExp::has_param1() const {
-  return _internal_has_param1();
+inline int32_t SetActionProcReq::_internal_procid() const {
+  return _impl_.procid_;
 }
-inline void RelationExp::clear_param1() {
-  if (GetArenaForAllocation() == nullptr && _impl_.param1_ != nullptr) {
-    delete _impl_.param1_;
-  }
-  _impl_.param1_ = nullptr;
+inline int32_t SetActionProcReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.SetActionProcReq.procId)
+  return _internal_procid();
 }
-inline const ::rp4::GatewayParam& RelationExp::_internal_param1() const {
-  const ::rp4::GatewayParam* p = _impl_.param1_;
-  return p != nullptr ? *p : reinterpret_cast<const ::rp4::GatewayParam&>(
-      ::rp4::_GatewayParam_default_instance_);
+inline void SetActionProcReq::_internal_set_procid(int32_t value) {
+  
+  _impl_.procid_ = value;
 }
-inline const ::rp4::GatewayParam& RelationExp::param1() const {
-  // @@protoc_insertion_point(field_get:rp4.RelationExp.param1)
-  return _internal_param1();
+inline void SetActionProcReq::set_procid(int32_t value) {
+  _internal_set_procid(value);
+  // @@protoc_insertion_point(field_set:rp4.SetActionProcReq.procId)
 }
-inline void RelationExp::unsafe_arena_set_allocated_param1(
-    ::rp4::GatewayParam* param1) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.param1_);
-  }
-  _impl_.param1_ = param1;
-  if (param1) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.RelationExp.param1)
+
+// int32 matcherId = 2;
+inline void SetActionProcReq::clear_matcherid() {
+  _impl_.matcherid_ = 0;
 }
-inline ::rp4::GatewayParam* RelationExp::release_param1() {
-  
-  ::rp4::GatewayParam* temp = _impl_.param1_;
-  _impl_.param1_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline int32_t SetActionProcReq::_internal_matcherid() const {
+  return _impl_.matcherid_;
 }
-inline ::rp4::GatewayParam* RelationExp::unsafe_arena_release_param1() {
-  // @@protoc_insertion_point(field_release:rp4.RelationExp.param1)
-  
-  ::rp4::GatewayParam* temp = _impl_.param1_;
-  _impl_.param1_ = nullptr;
-  return temp;
+inline int32_t SetActionProcReq::matcherid() const {
+  // @@protoc_insertion_point(field_get:rp4.SetActionProcReq.matcherId)
+  return _internal_matcherid();
 }
-inline ::rp4::GatewayParam* RelationExp::_internal_mutable_param1() {
+inline void SetActionProcReq::_internal_set_matcherid(int32_t value) {
   
-  if (_impl_.param1_ == nullptr) {
-    auto* p = CreateMaybeMessage<::rp4::GatewayParam>(GetArenaForAllocation());
-    _impl_.param1_ = p;
-  }
-  return _impl_.param1_;
-}
-inline ::rp4::GatewayParam* RelationExp::mutable_param1() {
-  ::rp4::GatewayParam* _msg = _internal_mutable_param1();
-  // @@protoc_insertion_point(field_mutable:rp4.RelationExp.param1)
-  return _msg;
+  _impl_.matcherid_ = value;
 }
-inline void RelationExp::set_allocated_param1(::rp4::GatewayParam* param1) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.param1_;
-  }
-  if (param1) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(param1);
-    if (message_arena != submessage_arena) {
-      param1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, param1, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.param1_ = param1;
-  // @@protoc_insertion_point(field_set_allocated:rp4.RelationExp.param1)
+inline void SetActionProcReq::set_matcherid(int32_t value) {
+  _internal_set_matcherid(value);
+  // @@protoc_insertion_point(field_set:rp4.SetActionProcReq.matcherId)
 }
 
-// .rp4.GatewayParam param2 = 2;
-inline bool RelationExp::_internal_has_param2() const {
-  return this != internal_default_instance() && _impl_.param2_ != nullptr;
-}
-inline bool RelationExp::has_param2() const {
-  return _internal_has_param2();
-}
-inline void RelationExp::clear_param2() {
-  if (GetArenaForAllocation() == nullptr && _impl_.param2_ != nullptr) {
-    delete _impl_.param2_;
-  }
-  _impl_.param2_ = nullptr;
+// repeated .rp4.ActionProc actionProcs = 3;
+inline int SetActionProcReq::_internal_actionprocs_size() const {
+  return _impl_.actionprocs_.size();
 }
-inline const ::rp4::GatewayParam& RelationExp::_internal_param2() const {
-  const ::rp4::GatewayParam* p = _impl_.param2_;
-  return p != nullptr ? *p : reinterpret_cast<const ::rp4::GatewayParam&>(
-      ::rp4::_GatewayParam_default_instance_);
+inline int SetActionProcReq::actionprocs_size() const {
+  return _internal_actionprocs_size();
 }
-inline const ::rp4::GatewayParam& RelationExp::param2() const {
-  // @@protoc_insertion_point(field_get:rp4.RelationExp.param2)
-  return _internal_param2();
+inline void SetActionProcReq::clear_actionprocs() {
+  _impl_.actionprocs_.Clear();
 }
-inline void RelationExp::unsafe_arena_set_allocated_param2(
-    ::rp4::GatewayParam* param2) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.param2_);
-  }
-  _impl_.param2_ = param2;
-  if (param2) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.RelationExp.param2)
+inline ::rp4::ActionProc* SetActionProcReq::mutable_actionprocs(int index) {
+  // @@protoc_insertion_point(field_mutable:rp4.SetActionProcReq.actionProcs)
+  return _impl_.actionprocs_.Mutable(index);
 }
-inline ::rp4::GatewayParam* RelationExp::release_param2() {
-  
-  ::rp4::GatewayParam* temp = _impl_.param2_;
-  _impl_.param2_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ActionProc >*
+SetActionProcReq::mutable_actionprocs() {
+  // @@protoc_insertion_point(field_mutable_list:rp4.SetActionProcReq.actionProcs)
+  return &_impl_.actionprocs_;
 }
-inline ::rp4::GatewayParam* RelationExp::unsafe_arena_release_param2() {
-  // @@protoc_insertion_point(field_release:rp4.RelationExp.param2)
-  
-  ::rp4::GatewayParam* temp = _impl_.param2_;
-  _impl_.param2_ = nullptr;
-  return temp;
+inline const ::rp4::ActionProc& SetActionProcReq::_internal_actionprocs(int index) const {
+  return _impl_.actionprocs_.Get(index);
 }
-inline ::rp4::GatewayParam* RelationExp::_internal_mutable_param2() {
-  
-  if (_impl_.param2_ == nullptr) {
-    auto* p = CreateMaybeMessage<::rp4::GatewayParam>(GetArenaForAllocation());
-    _impl_.param2_ = p;
-  }
-  return _impl_.param2_;
+inline const ::rp4::ActionProc& SetActionProcReq::actionprocs(int index) const {
+  // @@protoc_insertion_point(field_get:rp4.SetActionProcReq.actionProcs)
+  return _internal_actionprocs(index);
 }
-inline ::rp4::GatewayParam* RelationExp::mutable_param2() {
-  ::rp4::GatewayParam* _msg = _internal_mutable_param2();
-  // @@protoc_insertion_point(field_mutable:rp4.RelationExp.param2)
-  return _msg;
+inline ::rp4::ActionProc* SetActionProcReq::_internal_add_actionprocs() {
+  return _impl_.actionprocs_.Add();
 }
-inline void RelationExp::set_allocated_param2(::rp4::GatewayParam* param2) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.param2_;
-  }
-  if (param2) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(param2);
-    if (message_arena != submessage_arena) {
-      param2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, param2, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.param2_ = param2;
-  // @@protoc_insertion_point(field_set_allocated:rp4.RelationExp.param2)
+inline ::rp4::ActionProc* SetActionProcReq::add_actionprocs() {
+  ::rp4::ActionProc* _add = _internal_add_actionprocs();
+  // @@protoc_insertion_point(field_add:rp4.SetActionProcReq.actionProcs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ActionProc >&
+SetActionProcReq::actionprocs() const {
+  // @@protoc_insertion_point(field_list:rp4.SetActionProcReq.actionProcs)
+  return _impl_.actionprocs_;
 }
 
-// .rp4.RelationCode relation = 3;
-inline void RelationExp::clear_relation() {
-  _impl_.relation_ = 0;
+// -------------------------------------------------------------------
+
+// SetActionProcResp
+
+// .rp4.Res res = 1;
+inline void SetActionProcResp::clear_res() {
+  _impl_.res_ = 0;
 }
-inline ::rp4::RelationCode RelationExp::_internal_relation() const {
-  return static_cast< ::rp4::RelationCode >(_impl_.relation_);
+inline ::rp4::Res SetActionProcResp::_internal_res() const {
+  return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::RelationCode RelationExp::relation() const {
-  // @@protoc_insertion_point(field_get:rp4.RelationExp.relation)
-  return _internal_relation();
+inline ::rp4::Res SetActionProcResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.SetActionProcResp.res)
+  return _internal_res();
 }
-inline void RelationExp::_internal_set_relation(::rp4::RelationCode value) {
+inline void SetActionProcResp::_internal_set_res(::rp4::Res value) {
   
-  _impl_.relation_ = value;
+  _impl_.res_ = value;
 }
-inline void RelationExp::set_relation(::rp4::RelationCode value) {
-  _internal_set_relation(value);
-  // @@protoc_insertion_point(field_set:rp4.RelationExp.relation)
+inline void SetActionProcResp::set_res(::rp4::Res value) {
+  _internal_set_res(value);
+  // @@protoc_insertion_point(field_set:rp4.SetActionProcResp.res)
 }
 
 // -------------------------------------------------------------------
 
-// InsertRelationExpReq
+// SetMemConfigReq
 
 // int32 procId = 1;
-inline void InsertRelationExpReq::clear_procid() {
+inline void SetMemConfigReq::clear_procid() {
   _impl_.procid_ = 0;
 }
-inline int32_t InsertRelationExpReq::_internal_procid() const {
+inline int32_t SetMemConfigReq::_internal_procid() const {
   return _impl_.procid_;
 }
-inline int32_t InsertRelationExpReq::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertRelationExpReq.procId)
+inline int32_t SetMemConfigReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.procId)
   return _internal_procid();
 }
-inline void InsertRelationExpReq::_internal_set_procid(int32_t value) {
+inline void SetMemConfigReq::_internal_set_procid(int32_t value) {
   
   _impl_.procid_ = value;
 }
-inline void InsertRelationExpReq::set_procid(int32_t value) {
+inline void SetMemConfigReq::set_procid(int32_t value) {
   _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.InsertRelationExpReq.procId)
+  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.procId)
 }
 
-// .rp4.GatewayParam param1 = 2;
-inline bool InsertRelationExpReq::_internal_has_param1() const {
-  return this != internal_default_instance() && _impl_.param1_ != nullptr;
+// int32 matcherId = 2;
+inline void SetMemConfigReq::clear_matcherid() {
+  _impl_.matcherid_ = 0;
 }
-inline bool InsertRelationExpReq::has_param1() const {
-  return _internal_has_param1();
+inline int32_t SetMemConfigReq::_internal_matcherid() const {
+  return _impl_.matcherid_;
 }
-inline void InsertRelationExpReq::clear_param1() {
-  if (GetArenaForAllocation() == nullptr && _impl_.param1_ != nullptr) {
-    delete _impl_.param1_;
-  }
-  _impl_.param1_ = nullptr;
+inline int32_t SetMemConfigReq::matcherid() const {
+  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.matcherId)
+  return _internal_matcherid();
 }
-inline const ::rp4::GatewayParam& InsertRelationExpReq::_internal_param1() const {
-  const ::rp4::GatewayParam* p = _impl_.param1_;
-  return p != nullptr ? *p : reinterpret_cast<const ::rp4::GatewayParam&>(
-      ::rp4::_GatewayParam_default_instance_);
+inline void SetMemConfigReq::_internal_set_matcherid(int32_t value) {
+  
+  _impl_.matcherid_ = value;
 }
-inline const ::rp4::GatewayParam& InsertRelationExpReq::param1() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertRelationExpReq.param1)
-  return _internal_param1();
+inline void SetMemConfigReq::set_matcherid(int32_t value) {
+  _internal_set_matcherid(value);
+  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.matcherId)
 }
-inline void InsertRelationExpReq::unsafe_arena_set_allocated_param1(
-    ::rp4::GatewayParam* param1) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.param1_);
-  }
-  _impl_.param1_ = param1;
-  if (param1) {
+
+// int32 keyWidth = 3;
+inline void SetMemConfigReq::clear_keywidth() {
+  _impl_.keywidth_ = 0;
+}
+inline int32_t SetMemConfigReq::_internal_keywidth() const {
+  return _impl_.keywidth_;
+}
+inline int32_t SetMemConfigReq::keywidth() const {
+  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.keyWidth)
+  return _internal_keywidth();
+}
+inline void SetMemConfigReq::_internal_set_keywidth(int32_t value) {
+  
+  _impl_.keywidth_ = value;
+}
+inline void SetMemConfigReq::set_keywidth(int32_t value) {
+  _internal_set_keywidth(value);
+  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.keyWidth)
+}
+
+// int32 valueWidth = 4;
+inline void SetMemConfigReq::clear_valuewidth() {
+  _impl_.valuewidth_ = 0;
+}
+inline int32_t SetMemConfigReq::_internal_valuewidth() const {
+  return _impl_.valuewidth_;
+}
+inline int32_t SetMemConfigReq::valuewidth() const {
+  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.valueWidth)
+  return _internal_valuewidth();
+}
+inline void SetMemConfigReq::_internal_set_valuewidth(int32_t value) {
+  
+  _impl_.valuewidth_ = value;
+}
+inline void SetMemConfigReq::set_valuewidth(int32_t value) {
+  _internal_set_valuewidth(value);
+  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.valueWidth)
+}
+
+// bytes keyConfig = 5;
+inline void SetMemConfigReq::clear_keyconfig() {
+  _impl_.keyconfig_.ClearToEmpty();
+}
+inline const std::string& SetMemConfigReq::keyconfig() const {
+  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.keyConfig)
+  return _internal_keyconfig();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SetMemConfigReq::set_keyconfig(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.keyconfig_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.keyConfig)
+}
+inline std::string* SetMemConfigReq::mutable_keyconfig() {
+  std::string* _s = _internal_mutable_keyconfig();
+  // @@protoc_insertion_point(field_mutable:rp4.SetMemConfigReq.keyConfig)
+  return _s;
+}
+inline const std::string& SetMemConfigReq::_internal_keyconfig() const {
+  return _impl_.keyconfig_.Get();
+}
+inline void SetMemConfigReq::_internal_set_keyconfig(const std::string& value) {
+  
+  _impl_.keyconfig_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SetMemConfigReq::_internal_mutable_keyconfig() {
+  
+  return _impl_.keyconfig_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SetMemConfigReq::release_keyconfig() {
+  // @@protoc_insertion_point(field_release:rp4.SetMemConfigReq.keyConfig)
+  return _impl_.keyconfig_.Release();
+}
+inline void SetMemConfigReq::set_allocated_keyconfig(std::string* keyconfig) {
+  if (keyconfig != nullptr) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.InsertRelationExpReq.param1)
-}
-inline ::rp4::GatewayParam* InsertRelationExpReq::release_param1() {
-  
-  ::rp4::GatewayParam* temp = _impl_.param1_;
-  _impl_.param1_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  _impl_.keyconfig_.SetAllocated(keyconfig, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.keyconfig_.IsDefault()) {
+    _impl_.keyconfig_.Set("", GetArenaForAllocation());
   }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rp4.SetMemConfigReq.keyConfig)
 }
-inline ::rp4::GatewayParam* InsertRelationExpReq::unsafe_arena_release_param1() {
-  // @@protoc_insertion_point(field_release:rp4.InsertRelationExpReq.param1)
-  
-  ::rp4::GatewayParam* temp = _impl_.param1_;
-  _impl_.param1_ = nullptr;
-  return temp;
+
+// bytes valueConfig = 6;
+inline void SetMemConfigReq::clear_valueconfig() {
+  _impl_.valueconfig_.ClearToEmpty();
 }
-inline ::rp4::GatewayParam* InsertRelationExpReq::_internal_mutable_param1() {
+inline const std::string& SetMemConfigReq::valueconfig() const {
+  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.valueConfig)
+  return _internal_valueconfig();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SetMemConfigReq::set_valueconfig(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.valueconfig_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.valueConfig)
+}
+inline std::string* SetMemConfigReq::mutable_valueconfig() {
+  std::string* _s = _internal_mutable_valueconfig();
+  // @@protoc_insertion_point(field_mutable:rp4.SetMemConfigReq.valueConfig)
+  return _s;
+}
+inline const std::string& SetMemConfigReq::_internal_valueconfig() const {
+  return _impl_.valueconfig_.Get();
+}
+inline void SetMemConfigReq::_internal_set_valueconfig(const std::string& value) {
   
-  if (_impl_.param1_ == nullptr) {
-    auto* p = CreateMaybeMessage<::rp4::GatewayParam>(GetArenaForAllocation());
-    _impl_.param1_ = p;
-  }
-  return _impl_.param1_;
+  _impl_.valueconfig_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SetMemConfigReq::_internal_mutable_valueconfig() {
+  
+  return _impl_.valueconfig_.Mutable(GetArenaForAllocation());
 }
-inline ::rp4::GatewayParam* InsertRelationExpReq::mutable_param1() {
-  ::rp4::GatewayParam* _msg = _internal_mutable_param1();
-  // @@protoc_insertion_point(field_mutable:rp4.InsertRelationExpReq.param1)
-  return _msg;
+inline std::string* SetMemConfigReq::release_valueconfig() {
+  // @@protoc_insertion_point(field_release:rp4.SetMemConfigReq.valueConfig)
+  return _impl_.valueconfig_.Release();
 }
-inline void InsertRelationExpReq::set_allocated_param1(::rp4::GatewayParam* param1) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.param1_;
-  }
-  if (param1) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(param1);
-    if (message_arena != submessage_arena) {
-      param1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, param1, submessage_arena);
-    }
+inline void SetMemConfigReq::set_allocated_valueconfig(std::string* valueconfig) {
+  if (valueconfig != nullptr) {
     
   } else {
     
   }
-  _impl_.param1_ = param1;
-  // @@protoc_insertion_point(field_set_allocated:rp4.InsertRelationExpReq.param1)
+  _impl_.valueconfig_.SetAllocated(valueconfig, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.valueconfig_.IsDefault()) {
+    _impl_.valueconfig_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rp4.SetMemConfigReq.valueConfig)
 }
 
-// .rp4.GatewayParam param2 = 3;
-inline bool InsertRelationExpReq::_internal_has_param2() const {
-  return this != internal_default_instance() && _impl_.param2_ != nullptr;
+// .rp4.MatchType matchType = 7;
+inline void SetMemConfigReq::clear_matchtype() {
+  _impl_.matchtype_ = 0;
 }
-inline bool InsertRelationExpReq::has_param2() const {
-  return _internal_has_param2();
+inline ::rp4::MatchType SetMemConfigReq::_internal_matchtype() const {
+  return static_cast< ::rp4::MatchType >(_impl_.matchtype_);
 }
-inline void InsertRelationExpReq::clear_param2() {
-  if (GetArenaForAllocation() == nullptr && _impl_.param2_ != nullptr) {
-    delete _impl_.param2_;
-  }
-  _impl_.param2_ = nullptr;
+inline ::rp4::MatchType SetMemConfigReq::matchtype() const {
+  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.matchType)
+  return _internal_matchtype();
 }
-inline const ::rp4::GatewayParam& InsertRelationExpReq::_internal_param2() const {
-  const ::rp4::GatewayParam* p = _impl_.param2_;
-  return p != nullptr ? *p : reinterpret_cast<const ::rp4::GatewayParam&>(
-      ::rp4::_GatewayParam_default_instance_);
+inline void SetMemConfigReq::_internal_set_matchtype(::rp4::MatchType value) {
+  
+  _impl_.matchtype_ = value;
 }
-inline const ::rp4::GatewayParam& InsertRelationExpReq::param2() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertRelationExpReq.param2)
-  return _internal_param2();
+inline void SetMemConfigReq::set_matchtype(::rp4::MatchType value) {
+  _internal_set_matchtype(value);
+  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.matchType)
 }
-inline void InsertRelationExpReq::unsafe_arena_set_allocated_param2(
-    ::rp4::GatewayParam* param2) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.param2_);
-  }
-  _impl_.param2_ = param2;
-  if (param2) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.InsertRelationExpReq.param2)
+
+// int32 depth = 8;
+inline void SetMemConfigReq::clear_depth() {
+  _impl_.depth_ = 0;
 }
-inline ::rp4::GatewayParam* InsertRelationExpReq::release_param2() {
-  
-  ::rp4::GatewayParam* temp = _impl_.param2_;
-  _impl_.param2_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline int32_t SetMemConfigReq::_internal_depth() const {
+  return _impl_.depth_;
 }
-inline ::rp4::GatewayParam* InsertRelationExpReq::unsafe_arena_release_param2() {
-  // @@protoc_insertion_point(field_release:rp4.InsertRelationExpReq.param2)
-  
-  ::rp4::GatewayParam* temp = _impl_.param2_;
-  _impl_.param2_ = nullptr;
-  return temp;
+inline int32_t SetMemConfigReq::depth() const {
+  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.depth)
+  return _internal_depth();
 }
-inline ::rp4::GatewayParam* InsertRelationExpReq::_internal_mutable_param2() {
+inline void SetMemConfigReq::_internal_set_depth(int32_t value) {
   
-  if (_impl_.param2_ == nullptr) {
-    auto* p = CreateMaybeMessage<::rp4::GatewayParam>(GetArenaForAllocation());
-    _impl_.param2_ = p;
-  }
-  return _impl_.param2_;
-}
-inline ::rp4::GatewayParam* InsertRelationExpReq::mutable_param2() {
-  ::rp4::GatewayParam* _msg = _internal_mutable_param2();
-  // @@protoc_insertion_point(field_mutable:rp4.InsertRelationExpReq.param2)
-  return _msg;
+  _impl_.depth_ = value;
 }
-inline void InsertRelationExpReq::set_allocated_param2(::rp4::GatewayParam* param2) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.param2_;
-  }
-  if (param2) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(param2);
-    if (message_arena != submessage_arena) {
-      param2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, param2, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.param2_ = param2;
-  // @@protoc_insertion_point(field_set_allocated:rp4.InsertRelationExpReq.param2)
+inline void SetMemConfigReq::set_depth(int32_t value) {
+  _internal_set_depth(value);
+  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.depth)
 }
 
-// .rp4.RelationCode relation = 4;
-inline void InsertRelationExpReq::clear_relation() {
-  _impl_.relation_ = 0;
+// int32 missActId = 9;
+inline void SetMemConfigReq::clear_missactid() {
+  _impl_.missactid_ = 0;
 }
-inline ::rp4::RelationCode InsertRelationExpReq::_internal_relation() const {
-  return static_cast< ::rp4::RelationCode >(_impl_.relation_);
+inline int32_t SetMemConfigReq::_internal_missactid() const {
+  return _impl_.missactid_;
 }
-inline ::rp4::RelationCode InsertRelationExpReq::relation() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertRelationExpReq.relation)
-  return _internal_relation();
+inline int32_t SetMemConfigReq::missactid() const {
+  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.missActId)
+  return _internal_missactid();
 }
-inline void InsertRelationExpReq::_internal_set_relation(::rp4::RelationCode value) {
+inline void SetMemConfigReq::_internal_set_missactid(int32_t value) {
   
-  _impl_.relation_ = value;
+  _impl_.missactid_ = value;
 }
-inline void InsertRelationExpReq::set_relation(::rp4::RelationCode value) {
-  _internal_set_relation(value);
-  // @@protoc_insertion_point(field_set:rp4.InsertRelationExpReq.relation)
+inline void SetMemConfigReq::set_missactid(int32_t value) {
+  _internal_set_missactid(value);
+  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.missActId)
 }
 
 // -------------------------------------------------------------------
 
-// InsertRelationExpResp
+// SetMemConfigResp
 
 // .rp4.Res res = 1;
-inline void InsertRelationExpResp::clear_res() {
+inline void SetMemConfigResp::clear_res() {
   _impl_.res_ = 0;
 }
-inline ::rp4::Res InsertRelationExpResp::_internal_res() const {
+inline ::rp4::Res SetMemConfigResp::_internal_res() const {
   return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::Res InsertRelationExpResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertRelationExpResp.res)
+inline ::rp4::Res SetMemConfigResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.SetMemConfigResp.res)
   return _internal_res();
 }
-inline void InsertRelationExpResp::_internal_set_res(::rp4::Res value) {
+inline void SetMemConfigResp::_internal_set_res(::rp4::Res value) {
   
   _impl_.res_ = value;
 }
-inline void InsertRelationExpResp::set_res(::rp4::Res value) {
+inline void SetMemConfigResp::set_res(::rp4::Res value) {
   _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.InsertRelationExpResp.res)
+  // @@protoc_insertion_point(field_set:rp4.SetMemConfigResp.res)
 }
 
 // -------------------------------------------------------------------
 
-// ClearRelationExpReq
+// SetFieldInfoReq
 
 // int32 procId = 1;
-inline void ClearRelationExpReq::clear_procid() {
+inline void SetFieldInfoReq::clear_procid() {
   _impl_.procid_ = 0;
 }
-inline int32_t ClearRelationExpReq::_internal_procid() const {
+inline int32_t SetFieldInfoReq::_internal_procid() const {
   return _impl_.procid_;
 }
-inline int32_t ClearRelationExpReq::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.ClearRelationExpReq.procId)
+inline int32_t SetFieldInfoReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.SetFieldInfoReq.procId)
   return _internal_procid();
 }
-inline void ClearRelationExpReq::_internal_set_procid(int32_t value) {
+inline void SetFieldInfoReq::_internal_set_procid(int32_t value) {
   
   _impl_.procid_ = value;
 }
-inline void ClearRelationExpReq::set_procid(int32_t value) {
+inline void SetFieldInfoReq::set_procid(int32_t value) {
   _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.ClearRelationExpReq.procId)
+  // @@protoc_insertion_point(field_set:rp4.SetFieldInfoReq.procId)
+}
+
+// int32 matcherId = 2;
+inline void SetFieldInfoReq::clear_matcherid() {
+  _impl_.matcherid_ = 0;
+}
+inline int32_t SetFieldInfoReq::_internal_matcherid() const {
+  return _impl_.matcherid_;
+}
+inline int32_t SetFieldInfoReq::matcherid() const {
+  // @@protoc_insertion_point(field_get:rp4.SetFieldInfoReq.matcherId)
+  return _internal_matcherid();
+}
+inline void SetFieldInfoReq::_internal_set_matcherid(int32_t value) {
+  
+  _impl_.matcherid_ = value;
+}
+inline void SetFieldInfoReq::set_matcherid(int32_t value) {
+  _internal_set_matcherid(value);
+  // @@protoc_insertion_point(field_set:rp4.SetFieldInfoReq.matcherId)
+}
+
+// repeated .rp4.FieldInfo fdInfos = 3;
+inline int SetFieldInfoReq::_internal_fdinfos_size() const {
+  return _impl_.fdinfos_.size();
+}
+inline int SetFieldInfoReq::fdinfos_size() const {
+  return _internal_fdinfos_size();
+}
+inline void SetFieldInfoReq::clear_fdinfos() {
+  _impl_.fdinfos_.Clear();
+}
+inline ::rp4::FieldInfo* SetFieldInfoReq::mutable_fdinfos(int index) {
+  // @@protoc_insertion_point(field_mutable:rp4.SetFieldInfoReq.fdInfos)
+  return _impl_.fdinfos_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >*
+SetFieldInfoReq::mutable_fdinfos() {
+  // @@protoc_insertion_point(field_mutable_list:rp4.SetFieldInfoReq.fdInfos)
+  return &_impl_.fdinfos_;
+}
+inline const ::rp4::FieldInfo& SetFieldInfoReq::_internal_fdinfos(int index) const {
+  return _impl_.fdinfos_.Get(index);
+}
+inline const ::rp4::FieldInfo& SetFieldInfoReq::fdinfos(int index) const {
+  // @@protoc_insertion_point(field_get:rp4.SetFieldInfoReq.fdInfos)
+  return _internal_fdinfos(index);
+}
+inline ::rp4::FieldInfo* SetFieldInfoReq::_internal_add_fdinfos() {
+  return _impl_.fdinfos_.Add();
+}
+inline ::rp4::FieldInfo* SetFieldInfoReq::add_fdinfos() {
+  ::rp4::FieldInfo* _add = _internal_add_fdinfos();
+  // @@protoc_insertion_point(field_add:rp4.SetFieldInfoReq.fdInfos)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >&
+SetFieldInfoReq::fdinfos() const {
+  // @@protoc_insertion_point(field_list:rp4.SetFieldInfoReq.fdInfos)
+  return _impl_.fdinfos_;
 }
 
 // -------------------------------------------------------------------
 
-// ClearRelationExpResp
+// SetFieldInfoResp
 
 // .rp4.Res res = 1;
-inline void ClearRelationExpResp::clear_res() {
+inline void SetFieldInfoResp::clear_res() {
   _impl_.res_ = 0;
 }
-inline ::rp4::Res ClearRelationExpResp::_internal_res() const {
+inline ::rp4::Res SetFieldInfoResp::_internal_res() const {
   return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::Res ClearRelationExpResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.ClearRelationExpResp.res)
+inline ::rp4::Res SetFieldInfoResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.SetFieldInfoResp.res)
   return _internal_res();
 }
-inline void ClearRelationExpResp::_internal_set_res(::rp4::Res value) {
+inline void SetFieldInfoResp::_internal_set_res(::rp4::Res value) {
   
   _impl_.res_ = value;
 }
-inline void ClearRelationExpResp::set_res(::rp4::Res value) {
+inline void SetFieldInfoResp::set_res(::rp4::Res value) {
   _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.ClearRelationExpResp.res)
+  // @@protoc_insertion_point(field_set:rp4.SetFieldInfoResp.res)
 }
 
 // -------------------------------------------------------------------
 
-// ClearResMapReq
+// InsertSramEntryReq
 
 // int32 procId = 1;
-inline void ClearResMapReq::clear_procid() {
+inline void InsertSramEntryReq::clear_procid() {
   _impl_.procid_ = 0;
 }
-inline int32_t ClearResMapReq::_internal_procid() const {
+inline int32_t InsertSramEntryReq::_internal_procid() const {
   return _impl_.procid_;
 }
-inline int32_t ClearResMapReq::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.ClearResMapReq.procId)
+inline int32_t InsertSramEntryReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryReq.procId)
   return _internal_procid();
 }
-inline void ClearResMapReq::_internal_set_procid(int32_t value) {
+inline void InsertSramEntryReq::_internal_set_procid(int32_t value) {
   
   _impl_.procid_ = value;
 }
-inline void ClearResMapReq::set_procid(int32_t value) {
+inline void InsertSramEntryReq::set_procid(int32_t value) {
   _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.ClearResMapReq.procId)
+  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryReq.procId)
 }
 
-// -------------------------------------------------------------------
-
-// ClearResMapResp
-
-// .rp4.Res res = 1;
-inline void ClearResMapResp::clear_res() {
-  _impl_.res_ = 0;
+// int32 matcherId = 2;
+inline void InsertSramEntryReq::clear_matcherid() {
+  _impl_.matcherid_ = 0;
 }
-inline ::rp4::Res ClearResMapResp::_internal_res() const {
-  return static_cast< ::rp4::Res >(_impl_.res_);
+inline int32_t InsertSramEntryReq::_internal_matcherid() const {
+  return _impl_.matcherid_;
 }
-inline ::rp4::Res ClearResMapResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.ClearResMapResp.res)
-  return _internal_res();
+inline int32_t InsertSramEntryReq::matcherid() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryReq.matcherId)
+  return _internal_matcherid();
 }
-inline void ClearResMapResp::_internal_set_res(::rp4::Res value) {
+inline void InsertSramEntryReq::_internal_set_matcherid(int32_t value) {
   
-  _impl_.res_ = value;
+  _impl_.matcherid_ = value;
 }
-inline void ClearResMapResp::set_res(::rp4::Res value) {
-  _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.ClearResMapResp.res)
+inline void InsertSramEntryReq::set_matcherid(int32_t value) {
+  _internal_set_matcherid(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryReq.matcherId)
 }
 
-// -------------------------------------------------------------------
-
-// ModResMapReq
-
-// int32 procId = 1;
-inline void ModResMapReq::clear_procid() {
-  _impl_.procid_ = 0;
+// bytes key = 3;
+inline void InsertSramEntryReq::clear_key() {
+  _impl_.key_.ClearToEmpty();
 }
-inline int32_t ModResMapReq::_internal_procid() const {
-  return _impl_.procid_;
+inline const std::string& InsertSramEntryReq::key() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryReq.key)
+  return _internal_key();
 }
-inline int32_t ModResMapReq::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.ModResMapReq.procId)
-  return _internal_procid();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InsertSramEntryReq::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryReq.key)
 }
-inline void ModResMapReq::_internal_set_procid(int32_t value) {
+inline std::string* InsertSramEntryReq::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:rp4.InsertSramEntryReq.key)
+  return _s;
+}
+inline const std::string& InsertSramEntryReq::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void InsertSramEntryReq::_internal_set_key(const std::string& value) {
   
-  _impl_.procid_ = value;
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline void ModResMapReq::set_procid(int32_t value) {
-  _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.ModResMapReq.procId)
+inline std::string* InsertSramEntryReq::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-
-// int32 key = 2;
-inline void ModResMapReq::clear_key() {
-  _impl_.key_ = 0;
+inline std::string* InsertSramEntryReq::release_key() {
+  // @@protoc_insertion_point(field_release:rp4.InsertSramEntryReq.key)
+  return _impl_.key_.Release();
 }
-inline int32_t ModResMapReq::_internal_key() const {
-  return _impl_.key_;
+inline void InsertSramEntryReq::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rp4.InsertSramEntryReq.key)
 }
-inline int32_t ModResMapReq::key() const {
-  // @@protoc_insertion_point(field_get:rp4.ModResMapReq.key)
-  return _internal_key();
+
+// bytes value = 4;
+inline void InsertSramEntryReq::clear_value() {
+  _impl_.value_.ClearToEmpty();
 }
-inline void ModResMapReq::_internal_set_key(int32_t value) {
-  
-  _impl_.key_ = value;
+inline const std::string& InsertSramEntryReq::value() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryReq.value)
+  return _internal_value();
 }
-inline void ModResMapReq::set_key(int32_t value) {
-  _internal_set_key(value);
-  // @@protoc_insertion_point(field_set:rp4.ModResMapReq.key)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InsertSramEntryReq::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryReq.value)
 }
-
-// .rp4.GateEntry entry = 3;
-inline bool ModResMapReq::_internal_has_entry() const {
-  return this != internal_default_instance() && _impl_.entry_ != nullptr;
+inline std::string* InsertSramEntryReq::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:rp4.InsertSramEntryReq.value)
+  return _s;
 }
-inline bool ModResMapReq::has_entry() const {
-  return _internal_has_entry();
+inline const std::string& InsertSramEntryReq::_internal_value() const {
+  return _impl_.value_.Get();
 }
-inline void ModResMapReq::clear_entry() {
-  if (GetArenaForAllocation() == nullptr && _impl_.entry_ != nullptr) {
-    delete _impl_.entry_;
-  }
-  _impl_.entry_ = nullptr;
+inline void InsertSramEntryReq::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
-inline const ::rp4::GateEntry& ModResMapReq::_internal_entry() const {
-  const ::rp4::GateEntry* p = _impl_.entry_;
-  return p != nullptr ? *p : reinterpret_cast<const ::rp4::GateEntry&>(
-      ::rp4::_GateEntry_default_instance_);
+inline std::string* InsertSramEntryReq::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
-inline const ::rp4::GateEntry& ModResMapReq::entry() const {
-  // @@protoc_insertion_point(field_get:rp4.ModResMapReq.entry)
-  return _internal_entry();
+inline std::string* InsertSramEntryReq::release_value() {
+  // @@protoc_insertion_point(field_release:rp4.InsertSramEntryReq.value)
+  return _impl_.value_.Release();
 }
-inline void ModResMapReq::unsafe_arena_set_allocated_entry(
-    ::rp4::GateEntry* entry) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.entry_);
-  }
-  _impl_.entry_ = entry;
-  if (entry) {
+inline void InsertSramEntryReq::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:rp4.ModResMapReq.entry)
-}
-inline ::rp4::GateEntry* ModResMapReq::release_entry() {
-  
-  ::rp4::GateEntry* temp = _impl_.entry_;
-  _impl_.entry_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
   }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rp4.InsertSramEntryReq.value)
 }
-inline ::rp4::GateEntry* ModResMapReq::unsafe_arena_release_entry() {
-  // @@protoc_insertion_point(field_release:rp4.ModResMapReq.entry)
-  
-  ::rp4::GateEntry* temp = _impl_.entry_;
-  _impl_.entry_ = nullptr;
-  return temp;
+
+// int32 key_byte_len = 5;
+inline void InsertSramEntryReq::clear_key_byte_len() {
+  _impl_.key_byte_len_ = 0;
 }
-inline ::rp4::GateEntry* ModResMapReq::_internal_mutable_entry() {
+inline int32_t InsertSramEntryReq::_internal_key_byte_len() const {
+  return _impl_.key_byte_len_;
+}
+inline int32_t InsertSramEntryReq::key_byte_len() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryReq.key_byte_len)
+  return _internal_key_byte_len();
+}
+inline void InsertSramEntryReq::_internal_set_key_byte_len(int32_t value) {
   
-  if (_impl_.entry_ == nullptr) {
-    auto* p = CreateMaybeMessage<::rp4::GateEntry>(GetArenaForAllocation());
-    _impl_.entry_ = p;
-  }
-  return _impl_.entry_;
+  _impl_.key_byte_len_ = value;
 }
-inline ::rp4::GateEntry* ModResMapReq::mutable_entry() {
-  ::rp4::GateEntry* _msg = _internal_mutable_entry();
-  // @@protoc_insertion_point(field_mutable:rp4.ModResMapReq.entry)
-  return _msg;
+inline void InsertSramEntryReq::set_key_byte_len(int32_t value) {
+  _internal_set_key_byte_len(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryReq.key_byte_len)
+}
+
+// int32 value_byte_len = 6;
+inline void InsertSramEntryReq::clear_value_byte_len() {
+  _impl_.value_byte_len_ = 0;
+}
+inline int32_t InsertSramEntryReq::_internal_value_byte_len() const {
+  return _impl_.value_byte_len_;
+}
+inline int32_t InsertSramEntryReq::value_byte_len() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryReq.value_byte_len)
+  return _internal_value_byte_len();
+}
+inline void InsertSramEntryReq::_internal_set_value_byte_len(int32_t value) {
+  
+  _impl_.value_byte_len_ = value;
 }
-inline void ModResMapReq::set_allocated_entry(::rp4::GateEntry* entry) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.entry_;
-  }
-  if (entry) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(entry);
-    if (message_arena != submessage_arena) {
-      entry = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, entry, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.entry_ = entry;
-  // @@protoc_insertion_point(field_set_allocated:rp4.ModResMapReq.entry)
+inline void InsertSramEntryReq::set_value_byte_len(int32_t value) {
+  _internal_set_value_byte_len(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryReq.value_byte_len)
 }
 
 // -------------------------------------------------------------------
 
-// ModResMapResp
+// InsertSramEntryResp
 
 // .rp4.Res res = 1;
-inline void ModResMapResp::clear_res() {
+inline void InsertSramEntryResp::clear_res() {
   _impl_.res_ = 0;
 }
-inline ::rp4::Res ModResMapResp::_internal_res() const {
+inline ::rp4::Res InsertSramEntryResp::_internal_res() const {
   return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::Res ModResMapResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.ModResMapResp.res)
+inline ::rp4::Res InsertSramEntryResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryResp.res)
   return _internal_res();
 }
-inline void ModResMapResp::_internal_set_res(::rp4::Res value) {
+inline void InsertSramEntryResp::_internal_set_res(::rp4::Res value) {
   
   _impl_.res_ = value;
 }
-inline void ModResMapResp::set_res(::rp4::Res value) {
+inline void InsertSramEntryResp::set_res(::rp4::Res value) {
   _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.ModResMapResp.res)
+  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryResp.res)
+}
+
+// int32 occupancy = 2;
+inline void InsertSramEntryResp::clear_occupancy() {
+  _impl_.occupancy_ = 0;
+}
+inline int32_t InsertSramEntryResp::_internal_occupancy() const {
+  return _impl_.occupancy_;
+}
+inline int32_t InsertSramEntryResp::occupancy() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryResp.occupancy)
+  return _internal_occupancy();
+}
+inline void InsertSramEntryResp::_internal_set_occupancy(int32_t value) {
+  
+  _impl_.occupancy_ = value;
+}
+inline void InsertSramEntryResp::set_occupancy(int32_t value) {
+  _internal_set_occupancy(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryResp.occupancy)
+}
+
+// int32 capacity = 3;
+inline void InsertSramEntryResp::clear_capacity() {
+  _impl_.capacity_ = 0;
+}
+inline int32_t InsertSramEntryResp::_internal_capacity() const {
+  return _impl_.capacity_;
+}
+inline int32_t InsertSramEntryResp::capacity() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryResp.capacity)
+  return _internal_capacity();
+}
+inline void InsertSramEntryResp::_internal_set_capacity(int32_t value) {
+  
+  _impl_.capacity_ = value;
+}
+inline void InsertSramEntryResp::set_capacity(int32_t value) {
+  _internal_set_capacity(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryResp.capacity)
+}
+
+// int32 stash_used = 4;
+inline void InsertSramEntryResp::clear_stash_used() {
+  _impl_.stash_used_ = 0;
+}
+inline int32_t InsertSramEntryResp::_internal_stash_used() const {
+  return _impl_.stash_used_;
+}
+inline int32_t InsertSramEntryResp::stash_used() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryResp.stash_used)
+  return _internal_stash_used();
+}
+inline void InsertSramEntryResp::_internal_set_stash_used(int32_t value) {
+  
+  _impl_.stash_used_ = value;
+}
+inline void InsertSramEntryResp::set_stash_used(int32_t value) {
+  _internal_set_stash_used(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryResp.stash_used)
 }
 
 // -------------------------------------------------------------------
 
-// SetNoTableReq
+// InsertTcamEntryReq
 
 // int32 procId = 1;
-inline void SetNoTableReq::clear_procid() {
+inline void InsertTcamEntryReq::clear_procid() {
   _impl_.procid_ = 0;
 }
-inline int32_t SetNoTableReq::_internal_procid() const {
+inline int32_t InsertTcamEntryReq::_internal_procid() const {
   return _impl_.procid_;
 }
-inline int32_t SetNoTableReq::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.SetNoTableReq.procId)
+inline int32_t InsertTcamEntryReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryReq.procId)
   return _internal_procid();
 }
-inline void SetNoTableReq::_internal_set_procid(int32_t value) {
+inline void InsertTcamEntryReq::_internal_set_procid(int32_t value) {
   
   _impl_.procid_ = value;
 }
-inline void SetNoTableReq::set_procid(int32_t value) {
+inline void InsertTcamEntryReq::set_procid(int32_t value) {
   _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.SetNoTableReq.procId)
+  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryReq.procId)
 }
 
 // int32 matcherId = 2;
-inline void SetNoTableReq::clear_matcherid() {
+inline void InsertTcamEntryReq::clear_matcherid() {
   _impl_.matcherid_ = 0;
 }
-inline int32_t SetNoTableReq::_internal_matcherid() const {
+inline int32_t InsertTcamEntryReq::_internal_matcherid() const {
   return _impl_.matcherid_;
 }
-inline int32_t SetNoTableReq::matcherid() const {
-  // @@protoc_insertion_point(field_get:rp4.SetNoTableReq.matcherId)
+inline int32_t InsertTcamEntryReq::matcherid() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryReq.matcherId)
   return _internal_matcherid();
 }
-inline void SetNoTableReq::_internal_set_matcherid(int32_t value) {
+inline void InsertTcamEntryReq::_internal_set_matcherid(int32_t value) {
   
   _impl_.matcherid_ = value;
 }
-inline void SetNoTableReq::set_matcherid(int32_t value) {
+inline void InsertTcamEntryReq::set_matcherid(int32_t value) {
   _internal_set_matcherid(value);
-  // @@protoc_insertion_point(field_set:rp4.SetNoTableReq.matcherId)
+  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryReq.matcherId)
 }
 
-// bool noTable = 3;
-inline void SetNoTableReq::clear_notable() {
-  _impl_.notable_ = false;
-}
-inline bool SetNoTableReq::_internal_notable() const {
-  return _impl_.notable_;
-}
-inline bool SetNoTableReq::notable() const {
-  // @@protoc_insertion_point(field_get:rp4.SetNoTableReq.noTable)
-  return _internal_notable();
-}
-inline void SetNoTableReq::_internal_set_notable(bool value) {
-  
-  _impl_.notable_ = value;
+// bytes key = 3;
+inline void InsertTcamEntryReq::clear_key() {
+  _impl_.key_.ClearToEmpty();
 }
-inline void SetNoTableReq::set_notable(bool value) {
-  _internal_set_notable(value);
-  // @@protoc_insertion_point(field_set:rp4.SetNoTableReq.noTable)
+inline const std::string& InsertTcamEntryReq::key() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryReq.key)
+  return _internal_key();
 }
-
-// -------------------------------------------------------------------
-
-// SetNoTableResp
-
-// .rp4.Res res = 1;
-inline void SetNoTableResp::clear_res() {
-  _impl_.res_ = 0;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InsertTcamEntryReq::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryReq.key)
 }
-inline ::rp4::Res SetNoTableResp::_internal_res() const {
-  return static_cast< ::rp4::Res >(_impl_.res_);
+inline std::string* InsertTcamEntryReq::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:rp4.InsertTcamEntryReq.key)
+  return _s;
 }
-inline ::rp4::Res SetNoTableResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.SetNoTableResp.res)
-  return _internal_res();
+inline const std::string& InsertTcamEntryReq::_internal_key() const {
+  return _impl_.key_.Get();
 }
-inline void SetNoTableResp::_internal_set_res(::rp4::Res value) {
+inline void InsertTcamEntryReq::_internal_set_key(const std::string& value) {
   
-  _impl_.res_ = value;
-}
-inline void SetNoTableResp::set_res(::rp4::Res value) {
-  _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.SetNoTableResp.res)
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
-
-// -------------------------------------------------------------------
-
-// ActionProc
-
-// int32 actionId = 1;
-inline void ActionProc::clear_actionid() {
-  _impl_.actionid_ = 0;
+inline std::string* InsertTcamEntryReq::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline int32_t ActionProc::_internal_actionid() const {
-  return _impl_.actionid_;
+inline std::string* InsertTcamEntryReq::release_key() {
+  // @@protoc_insertion_point(field_release:rp4.InsertTcamEntryReq.key)
+  return _impl_.key_.Release();
 }
-inline int32_t ActionProc::actionid() const {
-  // @@protoc_insertion_point(field_get:rp4.ActionProc.actionId)
-  return _internal_actionid();
+inline void InsertTcamEntryReq::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rp4.InsertTcamEntryReq.key)
 }
-inline void ActionProc::_internal_set_actionid(int32_t value) {
-  
-  _impl_.actionid_ = value;
+
+// bytes mask = 4;
+inline void InsertTcamEntryReq::clear_mask() {
+  _impl_.mask_.ClearToEmpty();
 }
-inline void ActionProc::set_actionid(int32_t value) {
-  _internal_set_actionid(value);
-  // @@protoc_insertion_point(field_set:rp4.ActionProc.actionId)
+inline const std::string& InsertTcamEntryReq::mask() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryReq.mask)
+  return _internal_mask();
 }
-
-// int32 procId = 2;
-inline void ActionProc::clear_procid() {
-  _impl_.procid_ = 0;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InsertTcamEntryReq::set_mask(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.mask_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryReq.mask)
 }
-inline int32_t ActionProc::_internal_procid() const {
-  return _impl_.procid_;
+inline std::string* InsertTcamEntryReq::mutable_mask() {
+  std::string* _s = _internal_mutable_mask();
+  // @@protoc_insertion_point(field_mutable:rp4.InsertTcamEntryReq.mask)
+  return _s;
 }
-inline int32_t ActionProc::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.ActionProc.procId)
-  return _internal_procid();
+inline const std::string& InsertTcamEntryReq::_internal_mask() const {
+  return _impl_.mask_.Get();
 }
-inline void ActionProc::_internal_set_procid(int32_t value) {
+inline void InsertTcamEntryReq::_internal_set_mask(const std::string& value) {
   
-  _impl_.procid_ = value;
+  _impl_.mask_.Set(value, GetArenaForAllocation());
 }
-inline void ActionProc::set_procid(int32_t value) {
-  _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.ActionProc.procId)
+inline std::string* InsertTcamEntryReq::_internal_mutable_mask() {
+  
+  return _impl_.mask_.Mutable(GetArenaForAllocation());
 }
-
-// -------------------------------------------------------------------
-
-// SetActionProcReq
-
-// int32 procId = 1;
-inline void SetActionProcReq::clear_procid() {
-  _impl_.procid_ = 0;
+inline std::string* InsertTcamEntryReq::release_mask() {
+  // @@protoc_insertion_point(field_release:rp4.InsertTcamEntryReq.mask)
+  return _impl_.mask_.Release();
 }
-inline int32_t SetActionProcReq::_internal_procid() const {
-  return _impl_.procid_;
+inline void InsertTcamEntryReq::set_allocated_mask(std::string* mask) {
+  if (mask != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.mask_.SetAllocated(mask, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mask_.IsDefault()) {
+    _impl_.mask_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rp4.InsertTcamEntryReq.mask)
 }
-inline int32_t SetActionProcReq::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.SetActionProcReq.procId)
-  return _internal_procid();
+
+// bytes value = 5;
+inline void InsertTcamEntryReq::clear_value() {
+  _impl_.value_.ClearToEmpty();
 }
-inline void SetActionProcReq::_internal_set_procid(int32_t value) {
-  
-  _impl_.procid_ = value;
+inline const std::string& InsertTcamEntryReq::value() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryReq.value)
+  return _internal_value();
 }
-inline void SetActionProcReq::set_procid(int32_t value) {
-  _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.SetActionProcReq.procId)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InsertTcamEntryReq::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryReq.value)
 }
-
-// int32 matcherId = 2;
-inline void SetActionProcReq::clear_matcherid() {
-  _impl_.matcherid_ = 0;
+inline std::string* InsertTcamEntryReq::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:rp4.InsertTcamEntryReq.value)
+  return _s;
 }
-inline int32_t SetActionProcReq::_internal_matcherid() const {
-  return _impl_.matcherid_;
+inline const std::string& InsertTcamEntryReq::_internal_value() const {
+  return _impl_.value_.Get();
 }
-inline int32_t SetActionProcReq::matcherid() const {
-  // @@protoc_insertion_point(field_get:rp4.SetActionProcReq.matcherId)
-  return _internal_matcherid();
+inline void InsertTcamEntryReq::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
-inline void SetActionProcReq::_internal_set_matcherid(int32_t value) {
+inline std::string* InsertTcamEntryReq::_internal_mutable_value() {
   
-  _impl_.matcherid_ = value;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
-inline void SetActionProcReq::set_matcherid(int32_t value) {
-  _internal_set_matcherid(value);
-  // @@protoc_insertion_point(field_set:rp4.SetActionProcReq.matcherId)
+inline std::string* InsertTcamEntryReq::release_value() {
+  // @@protoc_insertion_point(field_release:rp4.InsertTcamEntryReq.value)
+  return _impl_.value_.Release();
+}
+inline void InsertTcamEntryReq::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rp4.InsertTcamEntryReq.value)
 }
 
-// repeated .rp4.ActionProc actionProcs = 3;
-inline int SetActionProcReq::_internal_actionprocs_size() const {
-  return _impl_.actionprocs_.size();
+// int32 key_byte_len = 6;
+inline void InsertTcamEntryReq::clear_key_byte_len() {
+  _impl_.key_byte_len_ = 0;
 }
-inline int SetActionProcReq::actionprocs_size() const {
-  return _internal_actionprocs_size();
+inline int32_t InsertTcamEntryReq::_internal_key_byte_len() const {
+  return _impl_.key_byte_len_;
 }
-inline void SetActionProcReq::clear_actionprocs() {
-  _impl_.actionprocs_.Clear();
+inline int32_t InsertTcamEntryReq::key_byte_len() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryReq.key_byte_len)
+  return _internal_key_byte_len();
 }
-inline ::rp4::ActionProc* SetActionProcReq::mutable_actionprocs(int index) {
-  // @@protoc_insertion_point(field_mutable:rp4.SetActionProcReq.actionProcs)
-  return _impl_.actionprocs_.Mutable(index);
+inline void InsertTcamEntryReq::_internal_set_key_byte_len(int32_t value) {
+  
+  _impl_.key_byte_len_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ActionProc >*
-SetActionProcReq::mutable_actionprocs() {
-  // @@protoc_insertion_point(field_mutable_list:rp4.SetActionProcReq.actionProcs)
-  return &_impl_.actionprocs_;
+inline void InsertTcamEntryReq::set_key_byte_len(int32_t value) {
+  _internal_set_key_byte_len(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryReq.key_byte_len)
 }
-inline const ::rp4::ActionProc& SetActionProcReq::_internal_actionprocs(int index) const {
-  return _impl_.actionprocs_.Get(index);
+
+// int32 value_byte_len = 7;
+inline void InsertTcamEntryReq::clear_value_byte_len() {
+  _impl_.value_byte_len_ = 0;
 }
-inline const ::rp4::ActionProc& SetActionProcReq::actionprocs(int index) const {
-  // @@protoc_insertion_point(field_get:rp4.SetActionProcReq.actionProcs)
-  return _internal_actionprocs(index);
+inline int32_t InsertTcamEntryReq::_internal_value_byte_len() const {
+  return _impl_.value_byte_len_;
 }
-inline ::rp4::ActionProc* SetActionProcReq::_internal_add_actionprocs() {
-  return _impl_.actionprocs_.Add();
+inline int32_t InsertTcamEntryReq::value_byte_len() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryReq.value_byte_len)
+  return _internal_value_byte_len();
 }
-inline ::rp4::ActionProc* SetActionProcReq::add_actionprocs() {
-  ::rp4::ActionProc* _add = _internal_add_actionprocs();
-  // @@protoc_insertion_point(field_add:rp4.SetActionProcReq.actionProcs)
-  return _add;
+inline void InsertTcamEntryReq::_internal_set_value_byte_len(int32_t value) {
+  
+  _impl_.value_byte_len_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::ActionProc >&
-SetActionProcReq::actionprocs() const {
-  // @@protoc_insertion_point(field_list:rp4.SetActionProcReq.actionProcs)
-  return _impl_.actionprocs_;
+inline void InsertTcamEntryReq::set_value_byte_len(int32_t value) {
+  _internal_set_value_byte_len(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryReq.value_byte_len)
 }
 
 // -------------------------------------------------------------------
 
-// SetActionProcResp
+// InsertTcamEntryResp
 
 // .rp4.Res res = 1;
-inline void SetActionProcResp::clear_res() {
+inline void InsertTcamEntryResp::clear_res() {
   _impl_.res_ = 0;
 }
-inline ::rp4::Res SetActionProcResp::_internal_res() const {
+inline ::rp4::Res InsertTcamEntryResp::_internal_res() const {
   return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::Res SetActionProcResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.SetActionProcResp.res)
+inline ::rp4::Res InsertTcamEntryResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryResp.res)
   return _internal_res();
 }
-inline void SetActionProcResp::_internal_set_res(::rp4::Res value) {
+inline void InsertTcamEntryResp::_internal_set_res(::rp4::Res value) {
   
   _impl_.res_ = value;
 }
-inline void SetActionProcResp::set_res(::rp4::Res value) {
+inline void InsertTcamEntryResp::set_res(::rp4::Res value) {
   _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.SetActionProcResp.res)
+  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryResp.res)
 }
 
 // -------------------------------------------------------------------
 
-// SetMemConfigReq
+// ModSramEntryReq
 
 // int32 procId = 1;
-inline void SetMemConfigReq::clear_procid() {
+inline void ModSramEntryReq::clear_procid() {
   _impl_.procid_ = 0;
 }
-inline int32_t SetMemConfigReq::_internal_procid() const {
+inline int32_t ModSramEntryReq::_internal_procid() const {
   return _impl_.procid_;
 }
-inline int32_t SetMemConfigReq::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.procId)
+inline int32_t ModSramEntryReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.ModSramEntryReq.procId)
   return _internal_procid();
 }
-inline void SetMemConfigReq::_internal_set_procid(int32_t value) {
+inline void ModSramEntryReq::_internal_set_procid(int32_t value) {
   
   _impl_.procid_ = value;
 }
-inline void SetMemConfigReq::set_procid(int32_t value) {
+inline void ModSramEntryReq::set_procid(int32_t value) {
   _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.procId)
+  // @@protoc_insertion_point(field_set:rp4.ModSramEntryReq.procId)
 }
 
 // int32 matcherId = 2;
-inline void SetMemConfigReq::clear_matcherid() {
+inline void ModSramEntryReq::clear_matcherid() {
   _impl_.matcherid_ = 0;
 }
-inline int32_t SetMemConfigReq::_internal_matcherid() const {
+inline int32_t ModSramEntryReq::_internal_matcherid() const {
   return _impl_.matcherid_;
 }
-inline int32_t SetMemConfigReq::matcherid() const {
-  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.matcherId)
+inline int32_t ModSramEntryReq::matcherid() const {
+  // @@protoc_insertion_point(field_get:rp4.ModSramEntryReq.matcherId)
   return _internal_matcherid();
 }
-inline void SetMemConfigReq::_internal_set_matcherid(int32_t value) {
+inline void ModSramEntryReq::_internal_set_matcherid(int32_t value) {
   
   _impl_.matcherid_ = value;
 }
-inline void SetMemConfigReq::set_matcherid(int32_t value) {
+inline void ModSramEntryReq::set_matcherid(int32_t value) {
   _internal_set_matcherid(value);
-  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.matcherId)
-}
-
-// int32 keyWidth = 3;
-inline void SetMemConfigReq::clear_keywidth() {
-  _impl_.keywidth_ = 0;
-}
-inline int32_t SetMemConfigReq::_internal_keywidth() const {
-  return _impl_.keywidth_;
-}
-inline int32_t SetMemConfigReq::keywidth() const {
-  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.keyWidth)
-  return _internal_keywidth();
-}
-inline void SetMemConfigReq::_internal_set_keywidth(int32_t value) {
-  
-  _impl_.keywidth_ = value;
-}
-inline void SetMemConfigReq::set_keywidth(int32_t value) {
-  _internal_set_keywidth(value);
-  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.keyWidth)
-}
-
-// int32 valueWidth = 4;
-inline void SetMemConfigReq::clear_valuewidth() {
-  _impl_.valuewidth_ = 0;
-}
-inline int32_t SetMemConfigReq::_internal_valuewidth() const {
-  return _impl_.valuewidth_;
-}
-inline int32_t SetMemConfigReq::valuewidth() const {
-  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.valueWidth)
-  return _internal_valuewidth();
-}
-inline void SetMemConfigReq::_internal_set_valuewidth(int32_t value) {
-  
-  _impl_.valuewidth_ = value;
-}
-inline void SetMemConfigReq::set_valuewidth(int32_t value) {
-  _internal_set_valuewidth(value);
-  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.valueWidth)
+  // @@protoc_insertion_point(field_set:rp4.ModSramEntryReq.matcherId)
 }
 
-// bytes keyConfig = 5;
-inline void SetMemConfigReq::clear_keyconfig() {
-  _impl_.keyconfig_.ClearToEmpty();
+// bytes key = 3;
+inline void ModSramEntryReq::clear_key() {
+  _impl_.key_.ClearToEmpty();
 }
-inline const std::string& SetMemConfigReq::keyconfig() const {
-  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.keyConfig)
-  return _internal_keyconfig();
+inline const std::string& ModSramEntryReq::key() const {
+  // @@protoc_insertion_point(field_get:rp4.ModSramEntryReq.key)
+  return _internal_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SetMemConfigReq::set_keyconfig(ArgT0&& arg0, ArgT... args) {
+void ModSramEntryReq::set_key(ArgT0&& arg0, ArgT... args) {
  
- _impl_.keyconfig_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.keyConfig)
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rp4.ModSramEntryReq.key)
 }
-inline std::string* SetMemConfigReq::mutable_keyconfig() {
-  std::string* _s = _internal_mutable_keyconfig();
-  // @@protoc_insertion_point(field_mutable:rp4.SetMemConfigReq.keyConfig)
+inline std::string* ModSramEntryReq::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:rp4.ModSramEntryReq.key)
   return _s;
 }
-inline const std::string& SetMemConfigReq::_internal_keyconfig() const {
-  return _impl_.keyconfig_.Get();
+inline const std::string& ModSramEntryReq::_internal_key() const {
+  return _impl_.key_.Get();
 }
-inline void SetMemConfigReq::_internal_set_keyconfig(const std::string& value) {
+inline void ModSramEntryReq::_internal_set_key(const std::string& value) {
   
-  _impl_.keyconfig_.Set(value, GetArenaForAllocation());
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SetMemConfigReq::_internal_mutable_keyconfig() {
+inline std::string* ModSramEntryReq::_internal_mutable_key() {
   
-  return _impl_.keyconfig_.Mutable(GetArenaForAllocation());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SetMemConfigReq::release_keyconfig() {
-  // @@protoc_insertion_point(field_release:rp4.SetMemConfigReq.keyConfig)
-  return _impl_.keyconfig_.Release();
+inline std::string* ModSramEntryReq::release_key() {
+  // @@protoc_insertion_point(field_release:rp4.ModSramEntryReq.key)
+  return _impl_.key_.Release();
 }
-inline void SetMemConfigReq::set_allocated_keyconfig(std::string* keyconfig) {
-  if (keyconfig != nullptr) {
+inline void ModSramEntryReq::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
     
   } else {
     
   }
-  _impl_.keyconfig_.SetAllocated(keyconfig, GetArenaForAllocation());
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.keyconfig_.IsDefault()) {
-    _impl_.keyconfig_.Set("", GetArenaForAllocation());
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:rp4.SetMemConfigReq.keyConfig)
+  // @@protoc_insertion_point(field_set_allocated:rp4.ModSramEntryReq.key)
 }
 
-// bytes valueConfig = 6;
-inline void SetMemConfigReq::clear_valueconfig() {
-  _impl_.valueconfig_.ClearToEmpty();
+// bytes value = 4;
+inline void ModSramEntryReq::clear_value() {
+  _impl_.value_.ClearToEmpty();
 }
-inline const std::string& SetMemConfigReq::valueconfig() const {
-  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.valueConfig)
-  return _internal_valueconfig();
+inline const std::string& ModSramEntryReq::value() const {
+  // @@protoc_insertion_point(field_get:rp4.ModSramEntryReq.value)
+  return _internal_value();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SetMemConfigReq::set_valueconfig(ArgT0&& arg0, ArgT... args) {
+void ModSramEntryReq::set_value(ArgT0&& arg0, ArgT... args) {
  
- _impl_.valueconfig_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.valueConfig)
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rp4.ModSramEntryReq.value)
 }
-inline std::string* SetMemConfigReq::mutable_valueconfig() {
-  std::string* _s = _internal_mutable_valueconfig();
-  // @@protoc_insertion_point(field_mutable:rp4.SetMemConfigReq.valueConfig)
+inline std::string* ModSramEntryReq::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:rp4.ModSramEntryReq.value)
   return _s;
 }
-inline const std::string& SetMemConfigReq::_internal_valueconfig() const {
-  return _impl_.valueconfig_.Get();
+inline const std::string& ModSramEntryReq::_internal_value() const {
+  return _impl_.value_.Get();
 }
-inline void SetMemConfigReq::_internal_set_valueconfig(const std::string& value) {
+inline void ModSramEntryReq::_internal_set_value(const std::string& value) {
   
-  _impl_.valueconfig_.Set(value, GetArenaForAllocation());
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SetMemConfigReq::_internal_mutable_valueconfig() {
+inline std::string* ModSramEntryReq::_internal_mutable_value() {
   
-  return _impl_.valueconfig_.Mutable(GetArenaForAllocation());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SetMemConfigReq::release_valueconfig() {
-  // @@protoc_insertion_point(field_release:rp4.SetMemConfigReq.valueConfig)
-  return _impl_.valueconfig_.Release();
+inline std::string* ModSramEntryReq::release_value() {
+  // @@protoc_insertion_point(field_release:rp4.ModSramEntryReq.value)
+  return _impl_.value_.Release();
 }
-inline void SetMemConfigReq::set_allocated_valueconfig(std::string* valueconfig) {
-  if (valueconfig != nullptr) {
+inline void ModSramEntryReq::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
     
   } else {
     
   }
-  _impl_.valueconfig_.SetAllocated(valueconfig, GetArenaForAllocation());
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.valueconfig_.IsDefault()) {
-    _impl_.valueconfig_.Set("", GetArenaForAllocation());
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:rp4.SetMemConfigReq.valueConfig)
-}
-
-// .rp4.MatchType matchType = 7;
-inline void SetMemConfigReq::clear_matchtype() {
-  _impl_.matchtype_ = 0;
-}
-inline ::rp4::MatchType SetMemConfigReq::_internal_matchtype() const {
-  return static_cast< ::rp4::MatchType >(_impl_.matchtype_);
-}
-inline ::rp4::MatchType SetMemConfigReq::matchtype() const {
-  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.matchType)
-  return _internal_matchtype();
-}
-inline void SetMemConfigReq::_internal_set_matchtype(::rp4::MatchType value) {
-  
-  _impl_.matchtype_ = value;
-}
-inline void SetMemConfigReq::set_matchtype(::rp4::MatchType value) {
-  _internal_set_matchtype(value);
-  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.matchType)
+  // @@protoc_insertion_point(field_set_allocated:rp4.ModSramEntryReq.value)
 }
 
-// int32 depth = 8;
-inline void SetMemConfigReq::clear_depth() {
-  _impl_.depth_ = 0;
+// int32 key_byte_len = 5;
+inline void ModSramEntryReq::clear_key_byte_len() {
+  _impl_.key_byte_len_ = 0;
 }
-inline int32_t SetMemConfigReq::_internal_depth() const {
-  return _impl_.depth_;
+inline int32_t ModSramEntryReq::_internal_key_byte_len() const {
+  return _impl_.key_byte_len_;
 }
-inline int32_t SetMemConfigReq::depth() const {
-  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.depth)
-  return _internal_depth();
+inline int32_t ModSramEntryReq::key_byte_len() const {
+  // @@protoc_insertion_point(field_get:rp4.ModSramEntryReq.key_byte_len)
+  return _internal_key_byte_len();
 }
-inline void SetMemConfigReq::_internal_set_depth(int32_t value) {
+inline void ModSramEntryReq::_internal_set_key_byte_len(int32_t value) {
   
-  _impl_.depth_ = value;
+  _impl_.key_byte_len_ = value;
 }
-inline void SetMemConfigReq::set_depth(int32_t value) {
-  _internal_set_depth(value);
-  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.depth)
+inline void ModSramEntryReq::set_key_byte_len(int32_t value) {
+  _internal_set_key_byte_len(value);
+  // @@protoc_insertion_point(field_set:rp4.ModSramEntryReq.key_byte_len)
 }
 
-// int32 missActId = 9;
-inline void SetMemConfigReq::clear_missactid() {
-  _impl_.missactid_ = 0;
+// int32 value_byte_len = 6;
+inline void ModSramEntryReq::clear_value_byte_len() {
+  _impl_.value_byte_len_ = 0;
 }
-inline int32_t SetMemConfigReq::_internal_missactid() const {
-  return _impl_.missactid_;
+inline int32_t ModSramEntryReq::_internal_value_byte_len() const {
+  return _impl_.value_byte_len_;
 }
-inline int32_t SetMemConfigReq::missactid() const {
-  // @@protoc_insertion_point(field_get:rp4.SetMemConfigReq.missActId)
-  return _internal_missactid();
+inline int32_t ModSramEntryReq::value_byte_len() const {
+  // @@protoc_insertion_point(field_get:rp4.ModSramEntryReq.value_byte_len)
+  return _internal_value_byte_len();
 }
-inline void SetMemConfigReq::_internal_set_missactid(int32_t value) {
+inline void ModSramEntryReq::_internal_set_value_byte_len(int32_t value) {
   
-  _impl_.missactid_ = value;
+  _impl_.value_byte_len_ = value;
 }
-inline void SetMemConfigReq::set_missactid(int32_t value) {
-  _internal_set_missactid(value);
-  // @@protoc_insertion_point(field_set:rp4.SetMemConfigReq.missActId)
+inline void ModSramEntryReq::set_value_byte_len(int32_t value) {
+  _internal_set_value_byte_len(value);
+  // @@protoc_insertion_point(field_set:rp4.ModSramEntryReq.value_byte_len)
 }
 
 // -------------------------------------------------------------------
 
-// SetMemConfigResp
+// ModSramEntryResp
 
 // .rp4.Res res = 1;
-inline void SetMemConfigResp::clear_res() {
+inline void ModSramEntryResp::clear_res() {
   _impl_.res_ = 0;
 }
-inline ::rp4::Res SetMemConfigResp::_internal_res() const {
+inline ::rp4::Res ModSramEntryResp::_internal_res() const {
   return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::Res SetMemConfigResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.SetMemConfigResp.res)
+inline ::rp4::Res ModSramEntryResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.ModSramEntryResp.res)
   return _internal_res();
 }
-inline void SetMemConfigResp::_internal_set_res(::rp4::Res value) {
+inline void ModSramEntryResp::_internal_set_res(::rp4::Res value) {
   
   _impl_.res_ = value;
 }
-inline void SetMemConfigResp::set_res(::rp4::Res value) {
+inline void ModSramEntryResp::set_res(::rp4::Res value) {
   _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.SetMemConfigResp.res)
+  // @@protoc_insertion_point(field_set:rp4.ModSramEntryResp.res)
 }
 
 // -------------------------------------------------------------------
 
-// SetFieldInfoReq
+// DelSramEntryReq
 
 // int32 procId = 1;
-inline void SetFieldInfoReq::clear_procid() {
+inline void DelSramEntryReq::clear_procid() {
   _impl_.procid_ = 0;
 }
-inline int32_t SetFieldInfoReq::_internal_procid() const {
+inline int32_t DelSramEntryReq::_internal_procid() const {
   return _impl_.procid_;
 }
-inline int32_t SetFieldInfoReq::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.SetFieldInfoReq.procId)
+inline int32_t DelSramEntryReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.DelSramEntryReq.procId)
   return _internal_procid();
 }
-inline void SetFieldInfoReq::_internal_set_procid(int32_t value) {
+inline void DelSramEntryReq::_internal_set_procid(int32_t value) {
   
   _impl_.procid_ = value;
 }
-inline void SetFieldInfoReq::set_procid(int32_t value) {
+inline void DelSramEntryReq::set_procid(int32_t value) {
   _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.SetFieldInfoReq.procId)
+  // @@protoc_insertion_point(field_set:rp4.DelSramEntryReq.procId)
 }
 
 // int32 matcherId = 2;
-inline void SetFieldInfoReq::clear_matcherid() {
+inline void DelSramEntryReq::clear_matcherid() {
   _impl_.matcherid_ = 0;
 }
-inline int32_t SetFieldInfoReq::_internal_matcherid() const {
+inline int32_t DelSramEntryReq::_internal_matcherid() const {
   return _impl_.matcherid_;
 }
-inline int32_t SetFieldInfoReq::matcherid() const {
-  // @@protoc_insertion_point(field_get:rp4.SetFieldInfoReq.matcherId)
+inline int32_t DelSramEntryReq::matcherid() const {
+  // @@protoc_insertion_point(field_get:rp4.DelSramEntryReq.matcherId)
   return _internal_matcherid();
 }
-inline void SetFieldInfoReq::_internal_set_matcherid(int32_t value) {
+inline void DelSramEntryReq::_internal_set_matcherid(int32_t value) {
   
   _impl_.matcherid_ = value;
 }
-inline void SetFieldInfoReq::set_matcherid(int32_t value) {
+inline void DelSramEntryReq::set_matcherid(int32_t value) {
   _internal_set_matcherid(value);
-  // @@protoc_insertion_point(field_set:rp4.SetFieldInfoReq.matcherId)
+  // @@protoc_insertion_point(field_set:rp4.DelSramEntryReq.matcherId)
 }
 
-// repeated .rp4.FieldInfo fdInfos = 3;
-inline int SetFieldInfoReq::_internal_fdinfos_size() const {
-  return _impl_.fdinfos_.size();
+// bytes key = 3;
+inline void DelSramEntryReq::clear_key() {
+  _impl_.key_.ClearToEmpty();
 }
-inline int SetFieldInfoReq::fdinfos_size() const {
-  return _internal_fdinfos_size();
+inline const std::string& DelSramEntryReq::key() const {
+  // @@protoc_insertion_point(field_get:rp4.DelSramEntryReq.key)
+  return _internal_key();
 }
-inline void SetFieldInfoReq::clear_fdinfos() {
-  _impl_.fdinfos_.Clear();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DelSramEntryReq::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rp4.DelSramEntryReq.key)
 }
-inline ::rp4::FieldInfo* SetFieldInfoReq::mutable_fdinfos(int index) {
-  // @@protoc_insertion_point(field_mutable:rp4.SetFieldInfoReq.fdInfos)
-  return _impl_.fdinfos_.Mutable(index);
+inline std::string* DelSramEntryReq::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:rp4.DelSramEntryReq.key)
+  return _s;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >*
-SetFieldInfoReq::mutable_fdinfos() {
-  // @@protoc_insertion_point(field_mutable_list:rp4.SetFieldInfoReq.fdInfos)
-  return &_impl_.fdinfos_;
+inline const std::string& DelSramEntryReq::_internal_key() const {
+  return _impl_.key_.Get();
 }
-inline const ::rp4::FieldInfo& SetFieldInfoReq::_internal_fdinfos(int index) const {
-  return _impl_.fdinfos_.Get(index);
+inline void DelSramEntryReq::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline const ::rp4::FieldInfo& SetFieldInfoReq::fdinfos(int index) const {
-  // @@protoc_insertion_point(field_get:rp4.SetFieldInfoReq.fdInfos)
-  return _internal_fdinfos(index);
+inline std::string* DelSramEntryReq::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline ::rp4::FieldInfo* SetFieldInfoReq::_internal_add_fdinfos() {
-  return _impl_.fdinfos_.Add();
+inline std::string* DelSramEntryReq::release_key() {
+  // @@protoc_insertion_point(field_release:rp4.DelSramEntryReq.key)
+  return _impl_.key_.Release();
 }
-inline ::rp4::FieldInfo* SetFieldInfoReq::add_fdinfos() {
-  ::rp4::FieldInfo* _add = _internal_add_fdinfos();
-  // @@protoc_insertion_point(field_add:rp4.SetFieldInfoReq.fdInfos)
-  return _add;
+inline void DelSramEntryReq::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rp4.DelSramEntryReq.key)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::rp4::FieldInfo >&
-SetFieldInfoReq::fdinfos() const {
-  // @@protoc_insertion_point(field_list:rp4.SetFieldInfoReq.fdInfos)
-  return _impl_.fdinfos_;
+
+// int32 key_byte_len = 4;
+inline void DelSramEntryReq::clear_key_byte_len() {
+  _impl_.key_byte_len_ = 0;
+}
+inline int32_t DelSramEntryReq::_internal_key_byte_len() const {
+  return _impl_.key_byte_len_;
+}
+inline int32_t DelSramEntryReq::key_byte_len() const {
+  // @@protoc_insertion_point(field_get:rp4.DelSramEntryReq.key_byte_len)
+  return _internal_key_byte_len();
+}
+inline void DelSramEntryReq::_internal_set_key_byte_len(int32_t value) {
+  
+  _impl_.key_byte_len_ = value;
+}
+inline void DelSramEntryReq::set_key_byte_len(int32_t value) {
+  _internal_set_key_byte_len(value);
+  // @@protoc_insertion_point(field_set:rp4.DelSramEntryReq.key_byte_len)
 }
 
 // -------------------------------------------------------------------
 
-// SetFieldInfoResp
+// DelSramEntryResp
 
 // .rp4.Res res = 1;
-inline void SetFieldInfoResp::clear_res() {
+inline void DelSramEntryResp::clear_res() {
   _impl_.res_ = 0;
 }
-inline ::rp4::Res SetFieldInfoResp::_internal_res() const {
+inline ::rp4::Res DelSramEntryResp::_internal_res() const {
   return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::Res SetFieldInfoResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.SetFieldInfoResp.res)
+inline ::rp4::Res DelSramEntryResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.DelSramEntryResp.res)
   return _internal_res();
 }
-inline void SetFieldInfoResp::_internal_set_res(::rp4::Res value) {
+inline void DelSramEntryResp::_internal_set_res(::rp4::Res value) {
   
   _impl_.res_ = value;
 }
-inline void SetFieldInfoResp::set_res(::rp4::Res value) {
+inline void DelSramEntryResp::set_res(::rp4::Res value) {
   _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.SetFieldInfoResp.res)
+  // @@protoc_insertion_point(field_set:rp4.DelSramEntryResp.res)
+}
+
+// int32 occupancy = 2;
+inline void DelSramEntryResp::clear_occupancy() {
+  _impl_.occupancy_ = 0;
+}
+inline int32_t DelSramEntryResp::_internal_occupancy() const {
+  return _impl_.occupancy_;
+}
+inline int32_t DelSramEntryResp::occupancy() const {
+  // @@protoc_insertion_point(field_get:rp4.DelSramEntryResp.occupancy)
+  return _internal_occupancy();
+}
+inline void DelSramEntryResp::_internal_set_occupancy(int32_t value) {
+  
+  _impl_.occupancy_ = value;
+}
+inline void DelSramEntryResp::set_occupancy(int32_t value) {
+  _internal_set_occupancy(value);
+  // @@protoc_insertion_point(field_set:rp4.DelSramEntryResp.occupancy)
 }
 
 // -------------------------------------------------------------------
 
-// InsertSramEntryReq
+// ModTcamEntryReq
 
 // int32 procId = 1;
-inline void InsertSramEntryReq::clear_procid() {
+inline void ModTcamEntryReq::clear_procid() {
   _impl_.procid_ = 0;
 }
-inline int32_t InsertSramEntryReq::_internal_procid() const {
+inline int32_t ModTcamEntryReq::_internal_procid() const {
   return _impl_.procid_;
 }
-inline int32_t InsertSramEntryReq::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryReq.procId)
+inline int32_t ModTcamEntryReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.ModTcamEntryReq.procId)
   return _internal_procid();
 }
-inline void InsertSramEntryReq::_internal_set_procid(int32_t value) {
+inline void ModTcamEntryReq::_internal_set_procid(int32_t value) {
   
   _impl_.procid_ = value;
 }
-inline void InsertSramEntryReq::set_procid(int32_t value) {
+inline void ModTcamEntryReq::set_procid(int32_t value) {
   _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryReq.procId)
+  // @@protoc_insertion_point(field_set:rp4.ModTcamEntryReq.procId)
 }
 
 // int32 matcherId = 2;
-inline void InsertSramEntryReq::clear_matcherid() {
+inline void ModTcamEntryReq::clear_matcherid() {
   _impl_.matcherid_ = 0;
 }
-inline int32_t InsertSramEntryReq::_internal_matcherid() const {
+inline int32_t ModTcamEntryReq::_internal_matcherid() const {
   return _impl_.matcherid_;
 }
-inline int32_t InsertSramEntryReq::matcherid() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryReq.matcherId)
+inline int32_t ModTcamEntryReq::matcherid() const {
+  // @@protoc_insertion_point(field_get:rp4.ModTcamEntryReq.matcherId)
   return _internal_matcherid();
 }
-inline void InsertSramEntryReq::_internal_set_matcherid(int32_t value) {
+inline void ModTcamEntryReq::_internal_set_matcherid(int32_t value) {
   
   _impl_.matcherid_ = value;
 }
-inline void InsertSramEntryReq::set_matcherid(int32_t value) {
+inline void ModTcamEntryReq::set_matcherid(int32_t value) {
   _internal_set_matcherid(value);
-  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryReq.matcherId)
+  // @@protoc_insertion_point(field_set:rp4.ModTcamEntryReq.matcherId)
 }
 
 // bytes key = 3;
-inline void InsertSramEntryReq::clear_key() {
+inline void ModTcamEntryReq::clear_key() {
   _impl_.key_.ClearToEmpty();
 }
-inline const std::string& InsertSramEntryReq::key() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryReq.key)
+inline const std::string& ModTcamEntryReq::key() const {
+  // @@protoc_insertion_point(field_get:rp4.ModTcamEntryReq.key)
   return _internal_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void InsertSramEntryReq::set_key(ArgT0&& arg0, ArgT... args) {
+void ModTcamEntryReq::set_key(ArgT0&& arg0, ArgT... args) {
  
  _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryReq.key)
+  // @@protoc_insertion_point(field_set:rp4.ModTcamEntryReq.key)
 }
-inline std::string* InsertSramEntryReq::mutable_key() {
+inline std::string* ModTcamEntryReq::mutable_key() {
   std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:rp4.InsertSramEntryReq.key)
+  // @@protoc_insertion_point(field_mutable:rp4.ModTcamEntryReq.key)
   return _s;
 }
-inline const std::string& InsertSramEntryReq::_internal_key() const {
+inline const std::string& ModTcamEntryReq::_internal_key() const {
   return _impl_.key_.Get();
 }
-inline void InsertSramEntryReq::_internal_set_key(const std::string& value) {
+inline void ModTcamEntryReq::_internal_set_key(const std::string& value) {
   
   _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* InsertSramEntryReq::_internal_mutable_key() {
+inline std::string* ModTcamEntryReq::_internal_mutable_key() {
   
   return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* InsertSramEntryReq::release_key() {
-  // @@protoc_insertion_point(field_release:rp4.InsertSramEntryReq.key)
+inline std::string* ModTcamEntryReq::release_key() {
+  // @@protoc_insertion_point(field_release:rp4.ModTcamEntryReq.key)
   return _impl_.key_.Release();
 }
-inline void InsertSramEntryReq::set_allocated_key(std::string* key) {
+inline void ModTcamEntryReq::set_allocated_key(std::string* key) {
   if (key != nullptr) {
     
   } else {
@@ -14151,45 +20718,95 @@ inline void InsertSramEntryReq::set_allocated_key(std::string* key) {
     _impl_.key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:rp4.InsertSramEntryReq.key)
+  // @@protoc_insertion_point(field_set_allocated:rp4.ModTcamEntryReq.key)
 }
 
-// bytes value = 4;
-inline void InsertSramEntryReq::clear_value() {
+// bytes mask = 4;
+inline void ModTcamEntryReq::clear_mask() {
+  _impl_.mask_.ClearToEmpty();
+}
+inline const std::string& ModTcamEntryReq::mask() const {
+  // @@protoc_insertion_point(field_get:rp4.ModTcamEntryReq.mask)
+  return _internal_mask();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ModTcamEntryReq::set_mask(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.mask_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rp4.ModTcamEntryReq.mask)
+}
+inline std::string* ModTcamEntryReq::mutable_mask() {
+  std::string* _s = _internal_mutable_mask();
+  // @@protoc_insertion_point(field_mutable:rp4.ModTcamEntryReq.mask)
+  return _s;
+}
+inline const std::string& ModTcamEntryReq::_internal_mask() const {
+  return _impl_.mask_.Get();
+}
+inline void ModTcamEntryReq::_internal_set_mask(const std::string& value) {
+  
+  _impl_.mask_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ModTcamEntryReq::_internal_mutable_mask() {
+  
+  return _impl_.mask_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ModTcamEntryReq::release_mask() {
+  // @@protoc_insertion_point(field_release:rp4.ModTcamEntryReq.mask)
+  return _impl_.mask_.Release();
+}
+inline void ModTcamEntryReq::set_allocated_mask(std::string* mask) {
+  if (mask != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.mask_.SetAllocated(mask, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mask_.IsDefault()) {
+    _impl_.mask_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rp4.ModTcamEntryReq.mask)
+}
+
+// bytes value = 5;
+inline void ModTcamEntryReq::clear_value() {
   _impl_.value_.ClearToEmpty();
 }
-inline const std::string& InsertSramEntryReq::value() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryReq.value)
+inline const std::string& ModTcamEntryReq::value() const {
+  // @@protoc_insertion_point(field_get:rp4.ModTcamEntryReq.value)
   return _internal_value();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void InsertSramEntryReq::set_value(ArgT0&& arg0, ArgT... args) {
+void ModTcamEntryReq::set_value(ArgT0&& arg0, ArgT... args) {
  
  _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryReq.value)
+  // @@protoc_insertion_point(field_set:rp4.ModTcamEntryReq.value)
 }
-inline std::string* InsertSramEntryReq::mutable_value() {
+inline std::string* ModTcamEntryReq::mutable_value() {
   std::string* _s = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:rp4.InsertSramEntryReq.value)
+  // @@protoc_insertion_point(field_mutable:rp4.ModTcamEntryReq.value)
   return _s;
 }
-inline const std::string& InsertSramEntryReq::_internal_value() const {
+inline const std::string& ModTcamEntryReq::_internal_value() const {
   return _impl_.value_.Get();
 }
-inline void InsertSramEntryReq::_internal_set_value(const std::string& value) {
+inline void ModTcamEntryReq::_internal_set_value(const std::string& value) {
   
   _impl_.value_.Set(value, GetArenaForAllocation());
 }
-inline std::string* InsertSramEntryReq::_internal_mutable_value() {
+inline std::string* ModTcamEntryReq::_internal_mutable_value() {
   
   return _impl_.value_.Mutable(GetArenaForAllocation());
 }
-inline std::string* InsertSramEntryReq::release_value() {
-  // @@protoc_insertion_point(field_release:rp4.InsertSramEntryReq.value)
+inline std::string* ModTcamEntryReq::release_value() {
+  // @@protoc_insertion_point(field_release:rp4.ModTcamEntryReq.value)
   return _impl_.value_.Release();
 }
-inline void InsertSramEntryReq::set_allocated_value(std::string* value) {
+inline void ModTcamEntryReq::set_allocated_value(std::string* value) {
   if (value != nullptr) {
     
   } else {
@@ -14201,153 +20818,153 @@ inline void InsertSramEntryReq::set_allocated_value(std::string* value) {
     _impl_.value_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:rp4.InsertSramEntryReq.value)
+  // @@protoc_insertion_point(field_set_allocated:rp4.ModTcamEntryReq.value)
 }
 
-// int32 key_byte_len = 5;
-inline void InsertSramEntryReq::clear_key_byte_len() {
+// int32 key_byte_len = 6;
+inline void ModTcamEntryReq::clear_key_byte_len() {
   _impl_.key_byte_len_ = 0;
 }
-inline int32_t InsertSramEntryReq::_internal_key_byte_len() const {
+inline int32_t ModTcamEntryReq::_internal_key_byte_len() const {
   return _impl_.key_byte_len_;
 }
-inline int32_t InsertSramEntryReq::key_byte_len() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryReq.key_byte_len)
+inline int32_t ModTcamEntryReq::key_byte_len() const {
+  // @@protoc_insertion_point(field_get:rp4.ModTcamEntryReq.key_byte_len)
   return _internal_key_byte_len();
 }
-inline void InsertSramEntryReq::_internal_set_key_byte_len(int32_t value) {
+inline void ModTcamEntryReq::_internal_set_key_byte_len(int32_t value) {
   
   _impl_.key_byte_len_ = value;
 }
-inline void InsertSramEntryReq::set_key_byte_len(int32_t value) {
+inline void ModTcamEntryReq::set_key_byte_len(int32_t value) {
   _internal_set_key_byte_len(value);
-  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryReq.key_byte_len)
+  // @@protoc_insertion_point(field_set:rp4.ModTcamEntryReq.key_byte_len)
 }
 
-// int32 value_byte_len = 6;
-inline void InsertSramEntryReq::clear_value_byte_len() {
+// int32 value_byte_len = 7;
+inline void ModTcamEntryReq::clear_value_byte_len() {
   _impl_.value_byte_len_ = 0;
 }
-inline int32_t InsertSramEntryReq::_internal_value_byte_len() const {
+inline int32_t ModTcamEntryReq::_internal_value_byte_len() const {
   return _impl_.value_byte_len_;
 }
-inline int32_t InsertSramEntryReq::value_byte_len() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryReq.value_byte_len)
+inline int32_t ModTcamEntryReq::value_byte_len() const {
+  // @@protoc_insertion_point(field_get:rp4.ModTcamEntryReq.value_byte_len)
   return _internal_value_byte_len();
 }
-inline void InsertSramEntryReq::_internal_set_value_byte_len(int32_t value) {
+inline void ModTcamEntryReq::_internal_set_value_byte_len(int32_t value) {
   
   _impl_.value_byte_len_ = value;
 }
-inline void InsertSramEntryReq::set_value_byte_len(int32_t value) {
+inline void ModTcamEntryReq::set_value_byte_len(int32_t value) {
   _internal_set_value_byte_len(value);
-  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryReq.value_byte_len)
+  // @@protoc_insertion_point(field_set:rp4.ModTcamEntryReq.value_byte_len)
 }
 
 // -------------------------------------------------------------------
 
-// InsertSramEntryResp
+// ModTcamEntryResp
 
 // .rp4.Res res = 1;
-inline void InsertSramEntryResp::clear_res() {
+inline void ModTcamEntryResp::clear_res() {
   _impl_.res_ = 0;
 }
-inline ::rp4::Res InsertSramEntryResp::_internal_res() const {
+inline ::rp4::Res ModTcamEntryResp::_internal_res() const {
   return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::Res InsertSramEntryResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertSramEntryResp.res)
+inline ::rp4::Res ModTcamEntryResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.ModTcamEntryResp.res)
   return _internal_res();
 }
-inline void InsertSramEntryResp::_internal_set_res(::rp4::Res value) {
+inline void ModTcamEntryResp::_internal_set_res(::rp4::Res value) {
   
   _impl_.res_ = value;
 }
-inline void InsertSramEntryResp::set_res(::rp4::Res value) {
+inline void ModTcamEntryResp::set_res(::rp4::Res value) {
   _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.InsertSramEntryResp.res)
+  // @@protoc_insertion_point(field_set:rp4.ModTcamEntryResp.res)
 }
 
 // -------------------------------------------------------------------
 
-// InsertTcamEntryReq
+// DelTcamEntryReq
 
 // int32 procId = 1;
-inline void InsertTcamEntryReq::clear_procid() {
+inline void DelTcamEntryReq::clear_procid() {
   _impl_.procid_ = 0;
 }
-inline int32_t InsertTcamEntryReq::_internal_procid() const {
+inline int32_t DelTcamEntryReq::_internal_procid() const {
   return _impl_.procid_;
 }
-inline int32_t InsertTcamEntryReq::procid() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryReq.procId)
+inline int32_t DelTcamEntryReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.DelTcamEntryReq.procId)
   return _internal_procid();
 }
-inline void InsertTcamEntryReq::_internal_set_procid(int32_t value) {
+inline void DelTcamEntryReq::_internal_set_procid(int32_t value) {
   
   _impl_.procid_ = value;
 }
-inline void InsertTcamEntryReq::set_procid(int32_t value) {
+inline void DelTcamEntryReq::set_procid(int32_t value) {
   _internal_set_procid(value);
-  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryReq.procId)
+  // @@protoc_insertion_point(field_set:rp4.DelTcamEntryReq.procId)
 }
 
 // int32 matcherId = 2;
-inline void InsertTcamEntryReq::clear_matcherid() {
+inline void DelTcamEntryReq::clear_matcherid() {
   _impl_.matcherid_ = 0;
 }
-inline int32_t InsertTcamEntryReq::_internal_matcherid() const {
+inline int32_t DelTcamEntryReq::_internal_matcherid() const {
   return _impl_.matcherid_;
 }
-inline int32_t InsertTcamEntryReq::matcherid() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryReq.matcherId)
+inline int32_t DelTcamEntryReq::matcherid() const {
+  // @@protoc_insertion_point(field_get:rp4.DelTcamEntryReq.matcherId)
   return _internal_matcherid();
 }
-inline void InsertTcamEntryReq::_internal_set_matcherid(int32_t value) {
+inline void DelTcamEntryReq::_internal_set_matcherid(int32_t value) {
   
   _impl_.matcherid_ = value;
 }
-inline void InsertTcamEntryReq::set_matcherid(int32_t value) {
+inline void DelTcamEntryReq::set_matcherid(int32_t value) {
   _internal_set_matcherid(value);
-  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryReq.matcherId)
+  // @@protoc_insertion_point(field_set:rp4.DelTcamEntryReq.matcherId)
 }
 
 // bytes key = 3;
-inline void InsertTcamEntryReq::clear_key() {
+inline void DelTcamEntryReq::clear_key() {
   _impl_.key_.ClearToEmpty();
 }
-inline const std::string& InsertTcamEntryReq::key() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryReq.key)
+inline const std::string& DelTcamEntryReq::key() const {
+  // @@protoc_insertion_point(field_get:rp4.DelTcamEntryReq.key)
   return _internal_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void InsertTcamEntryReq::set_key(ArgT0&& arg0, ArgT... args) {
+void DelTcamEntryReq::set_key(ArgT0&& arg0, ArgT... args) {
  
  _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryReq.key)
+  // @@protoc_insertion_point(field_set:rp4.DelTcamEntryReq.key)
 }
-inline std::string* InsertTcamEntryReq::mutable_key() {
+inline std::string* DelTcamEntryReq::mutable_key() {
   std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:rp4.InsertTcamEntryReq.key)
+  // @@protoc_insertion_point(field_mutable:rp4.DelTcamEntryReq.key)
   return _s;
 }
-inline const std::string& InsertTcamEntryReq::_internal_key() const {
+inline const std::string& DelTcamEntryReq::_internal_key() const {
   return _impl_.key_.Get();
 }
-inline void InsertTcamEntryReq::_internal_set_key(const std::string& value) {
+inline void DelTcamEntryReq::_internal_set_key(const std::string& value) {
   
   _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* InsertTcamEntryReq::_internal_mutable_key() {
+inline std::string* DelTcamEntryReq::_internal_mutable_key() {
   
   return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* InsertTcamEntryReq::release_key() {
-  // @@protoc_insertion_point(field_release:rp4.InsertTcamEntryReq.key)
+inline std::string* DelTcamEntryReq::release_key() {
+  // @@protoc_insertion_point(field_release:rp4.DelTcamEntryReq.key)
   return _impl_.key_.Release();
 }
-inline void InsertTcamEntryReq::set_allocated_key(std::string* key) {
+inline void DelTcamEntryReq::set_allocated_key(std::string* key) {
   if (key != nullptr) {
     
   } else {
@@ -14359,45 +20976,45 @@ inline void InsertTcamEntryReq::set_allocated_key(std::string* key) {
     _impl_.key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:rp4.InsertTcamEntryReq.key)
+  // @@protoc_insertion_point(field_set_allocated:rp4.DelTcamEntryReq.key)
 }
 
 // bytes mask = 4;
-inline void InsertTcamEntryReq::clear_mask() {
+inline void DelTcamEntryReq::clear_mask() {
   _impl_.mask_.ClearToEmpty();
 }
-inline const std::string& InsertTcamEntryReq::mask() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryReq.mask)
+inline const std::string& DelTcamEntryReq::mask() const {
+  // @@protoc_insertion_point(field_get:rp4.DelTcamEntryReq.mask)
   return _internal_mask();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void InsertTcamEntryReq::set_mask(ArgT0&& arg0, ArgT... args) {
+void DelTcamEntryReq::set_mask(ArgT0&& arg0, ArgT... args) {
  
  _impl_.mask_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryReq.mask)
+  // @@protoc_insertion_point(field_set:rp4.DelTcamEntryReq.mask)
 }
-inline std::string* InsertTcamEntryReq::mutable_mask() {
+inline std::string* DelTcamEntryReq::mutable_mask() {
   std::string* _s = _internal_mutable_mask();
-  // @@protoc_insertion_point(field_mutable:rp4.InsertTcamEntryReq.mask)
+  // @@protoc_insertion_point(field_mutable:rp4.DelTcamEntryReq.mask)
   return _s;
 }
-inline const std::string& InsertTcamEntryReq::_internal_mask() const {
+inline const std::string& DelTcamEntryReq::_internal_mask() const {
   return _impl_.mask_.Get();
 }
-inline void InsertTcamEntryReq::_internal_set_mask(const std::string& value) {
+inline void DelTcamEntryReq::_internal_set_mask(const std::string& value) {
   
   _impl_.mask_.Set(value, GetArenaForAllocation());
 }
-inline std::string* InsertTcamEntryReq::_internal_mutable_mask() {
+inline std::string* DelTcamEntryReq::_internal_mutable_mask() {
   
   return _impl_.mask_.Mutable(GetArenaForAllocation());
 }
-inline std::string* InsertTcamEntryReq::release_mask() {
-  // @@protoc_insertion_point(field_release:rp4.InsertTcamEntryReq.mask)
+inline std::string* DelTcamEntryReq::release_mask() {
+  // @@protoc_insertion_point(field_release:rp4.DelTcamEntryReq.mask)
   return _impl_.mask_.Release();
 }
-inline void InsertTcamEntryReq::set_allocated_mask(std::string* mask) {
+inline void DelTcamEntryReq::set_allocated_mask(std::string* mask) {
   if (mask != nullptr) {
     
   } else {
@@ -14409,121 +21026,269 @@ inline void InsertTcamEntryReq::set_allocated_mask(std::string* mask) {
     _impl_.mask_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:rp4.InsertTcamEntryReq.mask)
+  // @@protoc_insertion_point(field_set_allocated:rp4.DelTcamEntryReq.mask)
 }
 
-// bytes value = 5;
-inline void InsertTcamEntryReq::clear_value() {
-  _impl_.value_.ClearToEmpty();
+// int32 key_byte_len = 5;
+inline void DelTcamEntryReq::clear_key_byte_len() {
+  _impl_.key_byte_len_ = 0;
 }
-inline const std::string& InsertTcamEntryReq::value() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryReq.value)
-  return _internal_value();
+inline int32_t DelTcamEntryReq::_internal_key_byte_len() const {
+  return _impl_.key_byte_len_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void InsertTcamEntryReq::set_value(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryReq.value)
+inline int32_t DelTcamEntryReq::key_byte_len() const {
+  // @@protoc_insertion_point(field_get:rp4.DelTcamEntryReq.key_byte_len)
+  return _internal_key_byte_len();
 }
-inline std::string* InsertTcamEntryReq::mutable_value() {
-  std::string* _s = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:rp4.InsertTcamEntryReq.value)
-  return _s;
+inline void DelTcamEntryReq::_internal_set_key_byte_len(int32_t value) {
+  
+  _impl_.key_byte_len_ = value;
 }
-inline const std::string& InsertTcamEntryReq::_internal_value() const {
-  return _impl_.value_.Get();
+inline void DelTcamEntryReq::set_key_byte_len(int32_t value) {
+  _internal_set_key_byte_len(value);
+  // @@protoc_insertion_point(field_set:rp4.DelTcamEntryReq.key_byte_len)
 }
-inline void InsertTcamEntryReq::_internal_set_value(const std::string& value) {
+
+// -------------------------------------------------------------------
+
+// DelTcamEntryResp
+
+// .rp4.Res res = 1;
+inline void DelTcamEntryResp::clear_res() {
+  _impl_.res_ = 0;
+}
+inline ::rp4::Res DelTcamEntryResp::_internal_res() const {
+  return static_cast< ::rp4::Res >(_impl_.res_);
+}
+inline ::rp4::Res DelTcamEntryResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.DelTcamEntryResp.res)
+  return _internal_res();
+}
+inline void DelTcamEntryResp::_internal_set_res(::rp4::Res value) {
   
-  _impl_.value_.Set(value, GetArenaForAllocation());
+  _impl_.res_ = value;
 }
-inline std::string* InsertTcamEntryReq::_internal_mutable_value() {
+inline void DelTcamEntryResp::set_res(::rp4::Res value) {
+  _internal_set_res(value);
+  // @@protoc_insertion_point(field_set:rp4.DelTcamEntryResp.res)
+}
+
+// -------------------------------------------------------------------
+
+// InsertEntriesReq
+
+// int32 procId = 1;
+inline void InsertEntriesReq::clear_procid() {
+  _impl_.procid_ = 0;
+}
+inline int32_t InsertEntriesReq::_internal_procid() const {
+  return _impl_.procid_;
+}
+inline int32_t InsertEntriesReq::procid() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertEntriesReq.procId)
+  return _internal_procid();
+}
+inline void InsertEntriesReq::_internal_set_procid(int32_t value) {
   
-  return _impl_.value_.Mutable(GetArenaForAllocation());
+  _impl_.procid_ = value;
 }
-inline std::string* InsertTcamEntryReq::release_value() {
-  // @@protoc_insertion_point(field_release:rp4.InsertTcamEntryReq.value)
-  return _impl_.value_.Release();
+inline void InsertEntriesReq::set_procid(int32_t value) {
+  _internal_set_procid(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertEntriesReq.procId)
 }
-inline void InsertTcamEntryReq::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.value_.IsDefault()) {
-    _impl_.value_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:rp4.InsertTcamEntryReq.value)
+
+// int32 matcherId = 2;
+inline void InsertEntriesReq::clear_matcherid() {
+  _impl_.matcherid_ = 0;
+}
+inline int32_t InsertEntriesReq::_internal_matcherid() const {
+  return _impl_.matcherid_;
+}
+inline int32_t InsertEntriesReq::matcherid() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertEntriesReq.matcherId)
+  return _internal_matcherid();
+}
+inline void InsertEntriesReq::_internal_set_matcherid(int32_t value) {
+  
+  _impl_.matcherid_ = value;
+}
+inline void InsertEntriesReq::set_matcherid(int32_t value) {
+  _internal_set_matcherid(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertEntriesReq.matcherId)
 }
 
-// int32 key_byte_len = 6;
-inline void InsertTcamEntryReq::clear_key_byte_len() {
+// bool ternary = 3;
+inline void InsertEntriesReq::clear_ternary() {
+  _impl_.ternary_ = false;
+}
+inline bool InsertEntriesReq::_internal_ternary() const {
+  return _impl_.ternary_;
+}
+inline bool InsertEntriesReq::ternary() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertEntriesReq.ternary)
+  return _internal_ternary();
+}
+inline void InsertEntriesReq::_internal_set_ternary(bool value) {
+  
+  _impl_.ternary_ = value;
+}
+inline void InsertEntriesReq::set_ternary(bool value) {
+  _internal_set_ternary(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertEntriesReq.ternary)
+}
+
+// int32 key_byte_len = 4;
+inline void InsertEntriesReq::clear_key_byte_len() {
   _impl_.key_byte_len_ = 0;
 }
-inline int32_t InsertTcamEntryReq::_internal_key_byte_len() const {
+inline int32_t InsertEntriesReq::_internal_key_byte_len() const {
   return _impl_.key_byte_len_;
 }
-inline int32_t InsertTcamEntryReq::key_byte_len() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryReq.key_byte_len)
+inline int32_t InsertEntriesReq::key_byte_len() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertEntriesReq.key_byte_len)
   return _internal_key_byte_len();
 }
-inline void InsertTcamEntryReq::_internal_set_key_byte_len(int32_t value) {
+inline void InsertEntriesReq::_internal_set_key_byte_len(int32_t value) {
   
   _impl_.key_byte_len_ = value;
 }
-inline void InsertTcamEntryReq::set_key_byte_len(int32_t value) {
+inline void InsertEntriesReq::set_key_byte_len(int32_t value) {
   _internal_set_key_byte_len(value);
-  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryReq.key_byte_len)
+  // @@protoc_insertion_point(field_set:rp4.InsertEntriesReq.key_byte_len)
 }
 
-// int32 value_byte_len = 7;
-inline void InsertTcamEntryReq::clear_value_byte_len() {
+// int32 value_byte_len = 5;
+inline void InsertEntriesReq::clear_value_byte_len() {
   _impl_.value_byte_len_ = 0;
 }
-inline int32_t InsertTcamEntryReq::_internal_value_byte_len() const {
+inline int32_t InsertEntriesReq::_internal_value_byte_len() const {
   return _impl_.value_byte_len_;
 }
-inline int32_t InsertTcamEntryReq::value_byte_len() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryReq.value_byte_len)
+inline int32_t InsertEntriesReq::value_byte_len() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertEntriesReq.value_byte_len)
   return _internal_value_byte_len();
 }
-inline void InsertTcamEntryReq::_internal_set_value_byte_len(int32_t value) {
+inline void InsertEntriesReq::_internal_set_value_byte_len(int32_t value) {
   
   _impl_.value_byte_len_ = value;
 }
-inline void InsertTcamEntryReq::set_value_byte_len(int32_t value) {
+inline void InsertEntriesReq::set_value_byte_len(int32_t value) {
   _internal_set_value_byte_len(value);
-  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryReq.value_byte_len)
+  // @@protoc_insertion_point(field_set:rp4.InsertEntriesReq.value_byte_len)
+}
+
+// bytes entries = 6;
+inline void InsertEntriesReq::clear_entries() {
+  _impl_.entries_.ClearToEmpty();
+}
+inline const std::string& InsertEntriesReq::entries() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertEntriesReq.entries)
+  return _internal_entries();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InsertEntriesReq::set_entries(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.entries_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rp4.InsertEntriesReq.entries)
+}
+inline std::string* InsertEntriesReq::mutable_entries() {
+  std::string* _s = _internal_mutable_entries();
+  // @@protoc_insertion_point(field_mutable:rp4.InsertEntriesReq.entries)
+  return _s;
+}
+inline const std::string& InsertEntriesReq::_internal_entries() const {
+  return _impl_.entries_.Get();
+}
+inline void InsertEntriesReq::_internal_set_entries(const std::string& value) {
+  
+  _impl_.entries_.Set(value, GetArenaForAllocation());
+}
+inline std::string* InsertEntriesReq::_internal_mutable_entries() {
+  
+  return _impl_.entries_.Mutable(GetArenaForAllocation());
+}
+inline std::string* InsertEntriesReq::release_entries() {
+  // @@protoc_insertion_point(field_release:rp4.InsertEntriesReq.entries)
+  return _impl_.entries_.Release();
+}
+inline void InsertEntriesReq::set_allocated_entries(std::string* entries) {
+  if (entries != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.entries_.SetAllocated(entries, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entries_.IsDefault()) {
+    _impl_.entries_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rp4.InsertEntriesReq.entries)
 }
 
 // -------------------------------------------------------------------
 
-// InsertTcamEntryResp
+// InsertEntriesResp
 
 // .rp4.Res res = 1;
-inline void InsertTcamEntryResp::clear_res() {
+inline void InsertEntriesResp::clear_res() {
   _impl_.res_ = 0;
 }
-inline ::rp4::Res InsertTcamEntryResp::_internal_res() const {
+inline ::rp4::Res InsertEntriesResp::_internal_res() const {
   return static_cast< ::rp4::Res >(_impl_.res_);
 }
-inline ::rp4::Res InsertTcamEntryResp::res() const {
-  // @@protoc_insertion_point(field_get:rp4.InsertTcamEntryResp.res)
+inline ::rp4::Res InsertEntriesResp::res() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertEntriesResp.res)
   return _internal_res();
 }
-inline void InsertTcamEntryResp::_internal_set_res(::rp4::Res value) {
+inline void InsertEntriesResp::_internal_set_res(::rp4::Res value) {
   
   _impl_.res_ = value;
 }
-inline void InsertTcamEntryResp::set_res(::rp4::Res value) {
+inline void InsertEntriesResp::set_res(::rp4::Res value) {
   _internal_set_res(value);
-  // @@protoc_insertion_point(field_set:rp4.InsertTcamEntryResp.res)
+  // @@protoc_insertion_point(field_set:rp4.InsertEntriesResp.res)
+}
+
+// int32 inserted = 2;
+inline void InsertEntriesResp::clear_inserted() {
+  _impl_.inserted_ = 0;
+}
+inline int32_t InsertEntriesResp::_internal_inserted() const {
+  return _impl_.inserted_;
+}
+inline int32_t InsertEntriesResp::inserted() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertEntriesResp.inserted)
+  return _internal_inserted();
+}
+inline void InsertEntriesResp::_internal_set_inserted(int32_t value) {
+  
+  _impl_.inserted_ = value;
+}
+inline void InsertEntriesResp::set_inserted(int32_t value) {
+  _internal_set_inserted(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertEntriesResp.inserted)
+}
+
+// int32 failed = 3;
+inline void InsertEntriesResp::clear_failed() {
+  _impl_.failed_ = 0;
+}
+inline int32_t InsertEntriesResp::_internal_failed() const {
+  return _impl_.failed_;
+}
+inline int32_t InsertEntriesResp::failed() const {
+  // @@protoc_insertion_point(field_get:rp4.InsertEntriesResp.failed)
+  return _internal_failed();
+}
+inline void InsertEntriesResp::_internal_set_failed(int32_t value) {
+  
+  _impl_.failed_ = value;
+}
+inline void InsertEntriesResp::set_failed(int32_t value) {
+  _internal_set_failed(value);
+  // @@protoc_insertion_point(field_set:rp4.InsertEntriesResp.failed)
 }
 
 // -------------------------------------------------------------------
@@ -16739,6 +23504,44 @@ inline void ClearNeuronPrimitiveContextsResp::set_res(::rp4::Res value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
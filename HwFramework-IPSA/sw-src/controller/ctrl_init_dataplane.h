@@ -641,6 +641,12 @@ void extract(const std::string & json_path, api::CfgClient & cfg) {
     json j;
     std::ifstream(json_path) >> j;
 
+#ifndef NO_CFG
+    // the calls below are collected and sent in one applyConfig; the dataplane applies them as one
+    // transaction and keeps forwarding with its old config until the whole new one is in place
+    cfg.start_bundle();
+#endif
+
     if (j.contains("neuron_primitive_contexts")) {
 #ifdef NO_CFG
         extract_neuron_primitives(j.at("neuron_primitive_contexts"));
@@ -707,6 +713,11 @@ void extract(const std::string & json_path, api::CfgClient & cfg) {
         extract_executor(executor, i, cfg);
 #endif
     }
+
+#ifndef NO_CFG
+    int rc = cfg.apply_bundle();
+    std::cout << "config applied: " << rc << std::endl;
+#endif
 }
 
 #endif //RECONF_SWITCH_IPSA_CTRL_INIT_DATAPLANE_H
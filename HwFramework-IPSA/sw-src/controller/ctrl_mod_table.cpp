@@ -13,7 +13,12 @@ int main (int argc, char * argv[]) {
                                            grpc::InsecureChannelCredentials()));
 
     #ifdef MAIN
-    extract(argv[1], cfg);
+    // ctrl_mod_table update.json, or ctrl_mod_table --bulk entries.txt
+    if(argc > 2 && std::string(argv[1]) == "--bulk") {
+        load_entries(argv[2], cfg);
+    } else {
+        extract(argv[1], cfg);
+    }
     #else
     extract("../../sw-src/controller/update.json", cfg);
     #endif
@@ -11,6 +11,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <cstring>
 
 #include "json.hpp"
@@ -247,12 +248,16 @@ void extract(const std::string & json_path, api::CfgClient & cfg) {
                 break;
     }
 
-    value = extract_action_para(j["action_para"], value_width);
+    // a delete only needs the key, whatever action it names
+    uint8_t * new_value = nullptr;
+    if(update_type != "DEL") {
+        value = extract_action_para(j["action_para"], value_width);
 
-    uint8_t * new_value = new uint8_t[2 + value_width];
-    new_value[0] = action_id >> 8;
-    new_value[1] = action_id;
-    memcpy(new_value+2, value, value_width * sizeof(uint8_t));
+        new_value = new uint8_t[2 + value_width];
+        new_value[0] = action_id >> 8;
+        new_value[1] = action_id;
+        memcpy(new_value+2, value, value_width * sizeof(uint8_t));
+    }
 
     LOG(INFO) << "Key: ";
     for(int i = 0 ; i < key_width; i++) {
@@ -266,23 +271,114 @@ void extract(const std::string & json_path, api::CfgClient & cfg) {
         }
     }
 
-    LOG(INFO) << "Result value: ";
-    for(int i = 0 ; i < value_width+2; i++) {
-        LOG(INFO) << "  [" << i << "]: " << (int)new_value[i];
+    if(new_value != nullptr) {
+        LOG(INFO) << "Result value: ";
+        for(int i = 0 ; i < value_width+2; i++) {
+            LOG(INFO) << "  [" << i << "]: " << (int)new_value[i];
+        }
     }
 
 #ifndef NO_CFG
     int rc;
-    if(match_type == MatchType::EXACT) {
-        rc = cfg.insert_sram_entry(proc_id, matcher_id, key, new_value, key_width, value_width + 2);
+    bool exact = match_type == MatchType::EXACT;
+    if(update_type == "MOD") {
+        rc = exact ? cfg.modify_sram_entry(proc_id, matcher_id, key, new_value, key_width, value_width + 2)
+                   : cfg.modify_tcam_entry(proc_id, matcher_id, key, mask, new_value, key_width, value_width + 2);
+        std::cout << "modify table entry: " << rc << std::endl;
+    } else if(update_type == "DEL") {
+        rc = exact ? cfg.delete_sram_entry(proc_id, matcher_id, key, key_width)
+                   : cfg.delete_tcam_entry(proc_id, matcher_id, key, mask, key_width);
+        std::cout << "delete table entry: " << rc << std::endl;
     } else {
-        rc = cfg.insert_tcam_entry(proc_id, matcher_id, key, mask, new_value, key_width, value_width + 2);
+        rc = exact ? cfg.insert_sram_entry(proc_id, matcher_id, key, new_value, key_width, value_width + 2)
+                   : cfg.insert_tcam_entry(proc_id, matcher_id, key, mask, new_value, key_width, value_width + 2);
+        std::cout << "insert table entry: " << rc << std::endl;
     }
-    std::cout << "insert table entry: " << rc << std::endl;
 #endif
 
     return;
 }
 
+int hex_digit(char c) {
+    if(c >= '0' && c <= '9') return c - '0';
+    if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+bool parse_hex(const std::string & hex, std::vector<uint8_t> & bytes) {
+    if(hex.size() % 2 != 0) {
+        return false;
+    }
+    bytes.resize(hex.size() / 2);
+    for(size_t i = 0; i < bytes.size(); i++) {
+        int hi = hex_digit(hex[2 * i]);
+        int lo = hex_digit(hex[2 * i + 1]);
+        if(hi < 0 || lo < 0) {
+            return false;
+        }
+        bytes[i] = hi << 4 | lo;
+    }
+    return true;
+}
+
+#ifndef NO_CFG
+/**
+ * bulk load of table entries, one per line:
+ *     proc_id matcher_id key value          exact table
+ *     proc_id matcher_id key/mask value     ternary or lpm table
+ * key, mask and value are hex, key and mask already combined into the match key of the table,
+ * value starting with the 2-byte action id like the value extract builds. lines starting with # are skipped
+ */
+void load_entries(const std::string & path, api::CfgClient & cfg) {
+    std::ifstream in(path);
+    if(!in) {
+        std::cerr << "cannot open " << path << std::endl;
+        return;
+    }
+
+    cfg.start_entries();
+    std::string line, key_s, value_s;
+    std::vector<uint8_t> key, mask, value;
+    int line_num = 0, entry_num = 0, bad = 0;
+    while(std::getline(in, line)) {
+        line_num++;
+        if(line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        int proc_id, matcher_id;
+        if(!(fields >> proc_id >> matcher_id >> key_s >> value_s)) {
+            std::cerr << path << ":" << line_num << ": expected proc_id matcher_id key value" << std::endl;
+            bad++;
+            continue;
+        }
+        auto slash = key_s.find('/');
+        bool ternary = slash != std::string::npos;
+        bool ok = ternary ? parse_hex(key_s.substr(0, slash), key) && parse_hex(key_s.substr(slash + 1), mask)
+                          && key.size() == mask.size()
+                          : parse_hex(key_s, key);
+        if(!ok || !parse_hex(value_s, value)) {
+            std::cerr << path << ":" << line_num << ": bad hex in key, mask or value" << std::endl;
+            bad++;
+            continue;
+        }
+        if(!cfg.add_entry(proc_id, matcher_id, key.data(), ternary ? mask.data() : nullptr, value.data(),
+                          key.size(), value.size())) {
+            std::cerr << "insertEntries stream broken at " << path << ":" << line_num << std::endl;
+            break;
+        }
+        entry_num++;
+    }
+
+    int rc = cfg.finish_entries();
+    std::cout << "bulk insert of " << entry_num << " entries: " << rc;
+    if(bad > 0) {
+        std::cout << ", " << bad << " lines skipped";
+    }
+    std::cout << std::endl;
+}
+#endif
+
 
 #endif //RECONF_SWITCH_IPSA_CTRL_MOD_TABLE_H
@@ -0,0 +1,90 @@
+//
+// Bump allocator for per-packet temporaries.
+//
+
+#ifndef RECONF_SWITCH_IPSA_ARENA_H
+#define RECONF_SWITCH_IPSA_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+
+// bytes reserved per packet; larger packets spill into extra heap chunks until the next reset
+const static size_t PACKET_ARENA_SIZE = 8 * 1024;
+
+/**
+ * Memory handed out stays valid until reset(), which releases everything at once in O(1)
+ * (plus freeing any overflow chunks). Nothing is ever freed individually and no destructors run,
+ * so only trivially destructible objects belong here.
+ */
+class Arena {
+    uint8_t * block;
+    size_t capacity;
+    size_t used = 0;
+    std::vector<uint8_t*> overflow;
+
+public:
+    explicit Arena(size_t _capacity = PACKET_ARENA_SIZE) : capacity(_capacity) {
+        block = (uint8_t *) malloc(capacity);
+        if(block == nullptr) {
+            throw std::bad_alloc();
+        }
+    }
+
+    Arena(const Arena &) = delete;
+    Arena & operator=(const Arena &) = delete;
+
+    ~Arena() {
+        reset();
+        free(block);
+    }
+
+    void * alloc(size_t size, size_t align = alignof(std::max_align_t)) {
+        size_t begin = (used + align - 1) & ~(align - 1);
+        if(begin + size <= capacity) {
+            used = begin + size;
+            return block + begin;
+        }
+        auto chunk = (uint8_t *) malloc(size == 0 ? 1 : size);
+        if(chunk == nullptr) {
+            throw std::bad_alloc();
+        }
+        overflow.push_back(chunk);
+        return chunk;
+    }
+
+    // uninitialised bytes
+    uint8_t * alloc_bytes(size_t n) {
+        return (uint8_t *) alloc(n, 1);
+    }
+
+    uint8_t * alloc_zeroed(size_t n) {
+        auto p = alloc_bytes(n);
+        memset(p, 0, n);
+        return p;
+    }
+
+    template <typename T, typename... Args>
+    T * make(Args&&... args) {
+        return new (alloc(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    T * alloc_array(size_t n) {
+        return (T *) alloc(sizeof(T) * n, alignof(T));
+    }
+
+    void reset() {
+        used = 0;
+        for(auto chunk : overflow) {
+            free(chunk);
+        }
+        overflow.clear();
+    }
+};
+
+#endif //RECONF_SWITCH_IPSA_ARENA_H
@@ -12,10 +12,14 @@
 #include <net/ethernet.h>
 #include <cinttypes>
 #include <cmath>
+#include <memory>
+#include <vector>
 
 #include <gflags/gflags.h>
 #include <glog/logging.h>
 
+#include "arena.h"
+
 typedef uint8_t *Buffer;
 typedef const uint8_t *InputBuffer;
 
@@ -47,9 +51,22 @@ const static int TCAM_NUM_ALL = 64;
 const static int TCAM_NUM_PER_CLUSTER = TCAM_NUM_ALL / CLUSTER_NUM;
 const static int TCAM_IDX_BASE = TCAM_NUM_ALL / CLUSTER_NUM;
 
-static const int FRONT_HEADER_LEN = 1500; 
+// parser levels (TCAM/SRAM stages) per processor
+const static int PARSER_LEVEL_NUM = 4;
+
+// largest frame received or sent, jumbo frames included
+static const int MAX_FRAME_LEN = 9216;
 static const int META_LEN = 100;
 
+// upper bound on frames pulled from the interfaces per main loop iteration
+const static int PKT_BURST_MAX = 32;
+// empty polling passes over all interfaces before the receiver sleeps in epoll_wait
+const static int RX_SPIN_DEFAULT = 2000;
+// packets a worker may have queued or in flight before the receiver drops its new arrivals
+const static int WORKER_RING_SIZE = 1024;
+// PHVs preallocated at start-up; the pool grows past this only if more packets are in flight
+const static int PHV_POOL_SIZE = 2048;
+
 enum class OpCode {
     ADD, SUB, MUL, DIV, MOD,
     SHIFT_LEFT, SHIFT_RIGHT, BIT_AND, BIT_OR, BIT_XOR, BIT_NEG,
@@ -155,21 +172,34 @@ struct GateEntry {
     int val;
 };
 
+// frame bytes written and read while a packet is recorded for the flow cache, see flow_cache.h
+struct FlowPatch;
+
+class Pipeline;
+
 struct PHV {
-    uint8_t packet[FRONT_HEADER_LEN + META_LEN]{};
-    HeaderInfo* parsed_headers[32]{};
+    // the frame, either in the receive buffer it arrived in (attach) or in own_frame (copy_in).
+    // actions rewrite it in place
+    uint8_t * packet = nullptr;
+    uint32_t packet_len = 0;
+    // metadata headers are laid out here instead of behind the frame
+    uint8_t meta[META_LEN]{};
+    // bit i set: header i is a metadata header, its offsets are relative to meta
+    uint32_t meta_headers = 0;
+    HeaderInfo parsed_headers[32]{};
     uint8_t valid_bitmap[32]{0};
     uint32_t bitmap = 0;
 
     int cur_state = 0;
     uint16_t cur_offset = 0;
     int cur_trans_fd_num = 0;
-    uint32_t cur_trans_key; 
-    bool tcam_miss;
+    uint32_t cur_trans_key = 0xffff; 
+    bool tcam_miss = true;
     uint8_t miss_act = 2;
 
-    uint8_t * match_value;
-    int match_value_len;
+    // value of the last hit, copied into the arena, so a later table write does not change it
+    const uint8_t * match_value = nullptr;
+    int match_value_len = 0;
 
     bool hit = false;
 
@@ -179,18 +209,101 @@ struct PHV {
     int next_matcher_id = 0;
     int next_action_id = 0;
 
-    GateEntry next_op;
+    GateEntry next_op{};
 
     int ig_if = 0;
     int eg_if = 0;
 
-    PHV() {
-        for(auto & parsed_header : parsed_headers) {
-            parsed_header = new HeaderInfo();
+    // the pipeline the packet runs on and the config epoch that came with it. the receive thread holds
+    // the PipelinePin they come from until the packet is done, so a commit cannot free it halfway
+    Pipeline * pipe = nullptr;
+    uint64_t config_epoch = 0;
+
+    // set while the flow cache records this packet, field writes and reads are noted in it
+    FlowPatch * flow_patch = nullptr;
+    // an action with state outside the packet ran, the result must not be cached
+    bool flow_uncacheable = false;
+
+    // per-packet temporaries (match keys, decoded action parameters, intermediate values),
+    // all released together when the PHV is reset
+    Arena arena;
+    std::vector<ActionParam*> action_paras;
+
+    // backing store for frames that must outlive the receive buffer
+    std::vector<uint8_t> own_frame;
+
+    PHV() = default;
+
+    // zero copy: the frame must stay valid until the PHV is reset
+    void attach(Buffer frame, uint32_t len) {
+        packet = frame;
+        packet_len = len;
+    }
+
+    void copy_in(InputBuffer frame, uint32_t len) {
+        if(own_frame.empty()) {
+            own_frame.resize(MAX_FRAME_LEN);
         }
-        tcam_miss = true;
-        cur_trans_key = 0xffff; 
+        if(len > (uint32_t) MAX_FRAME_LEN) {
+            len = MAX_FRAME_LEN;
+        }
+        memcpy(own_frame.data(), frame, len);
+        packet = own_frame.data();
+        packet_len = len;
+    }
+
+    // the buffer that bit offsets of header hdr_id index into
+    uint8_t * hdr_base(int hdr_id) {
+        return ((meta_headers >> hdr_id) & 1) ? meta : packet;
+    }
+
+    const uint8_t * hdr_base(int hdr_id) const {
+        return ((meta_headers >> hdr_id) & 1) ? meta : packet;
+    }
+
+    // bytes addressable from hdr_base(hdr_id)
+    uint32_t hdr_limit(int hdr_id) const {
+        return ((meta_headers >> hdr_id) & 1) ? META_LEN : packet_len;
+    }
+
+    // back to the state of a fresh PHV; the frame itself is left alone, it belongs to the receive buffer
+    void reset() {
+        packet = nullptr;
+        packet_len = 0;
+        memset(meta, 0, sizeof(meta));
+        meta_headers = 0;
+        memset(parsed_headers, 0, sizeof(parsed_headers));
+        memset(valid_bitmap, 0, sizeof(valid_bitmap));
         bitmap = 0;
+
+        cur_state = 0;
+        cur_offset = 0;
+        cur_trans_fd_num = 0;
+        cur_trans_key = 0xffff;
+        tcam_miss = true;
+        miss_act = 2;
+
+        match_value = nullptr;
+        match_value_len = 0;
+        hit = false;
+        drop = 0;
+
+        next_proc_id = 0;
+        next_matcher_id = 0;
+        next_action_id = 0;
+        next_op = GateEntry{};
+
+        ig_if = 0;
+        eg_if = 0;
+
+        pipe = nullptr;
+        config_epoch = 0;
+
+        flow_patch = nullptr;
+        flow_uncacheable = false;
+
+        action_paras.clear();
+        arena.reset();
     }
 };
 
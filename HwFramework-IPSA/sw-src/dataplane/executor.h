@@ -3,20 +3,22 @@
 
 #include "defs.h"
 #include "neuron_primitive.h"
+#include "field_access.h"
+#include "flow_cache.h"
 #include <cmath>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
-inline Data make_zero_data_bits(int bits) {
+inline Data make_zero_data_bits(int bits, Arena& arena) {
     Data zero{};
     zero.data_len = bits;
     int byte_len = bits <= 0 ? 0 : (bits + 7) / 8;
     if (byte_len > 0) {
-        zero.val = new uint8_t[byte_len];
-        std::memset(zero.val, 0, byte_len);
+        zero.val = arena.alloc_zeroed(byte_len);
     } else {
         zero.val = nullptr;
     }
@@ -69,16 +71,15 @@ inline bool extract_chunks_from_data(const Data& data,
     return true;
 }
 
-inline Data pack_chunks_into_data(const std::vector<uint64_t>& values, uint32_t chunk_width) {
+inline Data pack_chunks_into_data(const std::vector<uint64_t>& values, uint32_t chunk_width, Arena& arena) {
     if (values.empty() || chunk_width == 0) {
-        return make_zero_data_bits(0);
+        return make_zero_data_bits(0, arena);
     }
     uint32_t total_bits = chunk_width * static_cast<uint32_t>(values.size());
     Data packed{};
     packed.data_len = static_cast<int>(total_bits);
     int byte_len = (total_bits + 7) / 8;
-    packed.val = new uint8_t[byte_len];
-    std::memset(packed.val, 0, byte_len);
+    packed.val = arena.alloc_zeroed(byte_len);
     uint64_t mask = mask_for_width_u64(chunk_width);
     for (size_t idx = 0; idx < values.size(); ++idx) {
         uint64_t value = values[idx] & mask;
@@ -127,18 +128,19 @@ int32_t get_signed_value(Data data) {
     return static_cast<int32_t>(masked);
 }
 
-Data get_data (int len, uint32_t d) {
+Data get_data (int len, uint32_t d, Arena & arena) {
     Data data{};
     data.data_len = len;
     int byte_len = ceil(len * 1.0 / 8);
-    data.val = new uint8_t[byte_len];
+    data.val = arena.alloc_bytes(byte_len);
     for(int i = 0; i < byte_len; i++) {
         data.val[byte_len - 1 - i] = d >> (i * 8);
     }
     return data;
 }
 
-Data get_op_val_any(Parameter para, PHV * phv, std::vector<ActionParam*> action_paras) {
+Data get_op_val_any(const Parameter & para, const FieldAccessor & acc, PHV * phv,
+                    const std::vector<ActionParam*> & action_paras) {
     Data res{};
     LOG(INFO) << "      param type(constant, header, field, param): " << (int)para.type;
     switch(para.type) {
@@ -152,53 +154,20 @@ Data get_op_val_any(Parameter para, PHV * phv, std::vector<ActionParam*> action_
             break;
         }
         case PT::FIELD : {
-            int fd_len = para.val.field.fd_len;
-            int internal_offset = para.val.field.internal_offset;
-            HeaderInfo * hi = phv->parsed_headers[para.val.field.hdr_id];
-
             LOG(INFO) << "          obtained from:";
-            LOG(INFO) << "          hdr_id: " << (int)para.val.field.hdr_id;
-            LOG(INFO) << "          internal_offset: " << para.val.field.internal_offset;
-            LOG(INFO) << "          field_length: " << para.val.field.fd_len;
-
-
-            int start = hi->hdr_offset + internal_offset;
-            int end = start + fd_len;
-
-            int byte_start = start / 8;
-            int byte_end = end / 8; //ceil(end * 1.0 / 8);
-            int byte_len = byte_end - byte_start + 1;
-
-            LOG(INFO) << "          byte_start: " << byte_start;
-            LOG(INFO) << "          byte_end: " << byte_end;
-            LOG(INFO) << "          original value: ";
-            for(int i = byte_start ; i <= byte_end; i++) {
-                LOG(INFO) << "               " << (int)phv->packet[i];
-            }
-
-            int left_shift = start % 8;
-            int right_shift = 8 - end % 8;
-
-//            res.if_sign = false;
-            res.data_len = fd_len;
-            res.val = new uint8_t[(int)ceil(fd_len * 1.0 / 8)];
-            int fd_len_byte = ceil(fd_len * 1.0 / 8);
-
-            auto fd_backup = (uint8_t*) malloc(sizeof(uint8_t) * byte_len);
-            memset(fd_backup, 0, sizeof(uint8_t) * byte_len);
-            memcpy(fd_backup, phv->packet + byte_start, byte_len);
-            fd_backup[0] = fd_backup[0] << left_shift >> left_shift;
-            fd_backup[byte_len - 1] = fd_backup[byte_len - 1] >> right_shift << right_shift;
-
-            int idx = fd_len_byte - 1;
-            for(int i = byte_len - 1; i > 0; i--) {
-                res.val[idx] = (fd_backup[i] >> right_shift) + (fd_backup[i - 1] << (8 - right_shift));
-                idx--;
-//                std::cout << (int)res.val[idx+1] << std::endl;
+            LOG(INFO) << "          hdr_id: " << (int)acc.hdr_id;
+            LOG(INFO) << "          internal_offset: " << acc.internal_offset;
+            LOG(INFO) << "          field_length: " << acc.fd_len;
+
+            res.data_len = acc.fd_len;
+            res.val = phv->arena.alloc_bytes(acc.byte_len);
+            acc.read_right(phv, res.val);
+            if(phv->flow_patch != nullptr) {
+                phv->flow_patch->note_read(phv, acc);
             }
             LOG(INFO) << "          length: " << res.data_len;
             LOG(INFO) << "          value: ";
-            for(int i = 0 ; i < ceil(res.data_len*1.0/8); i++) {
+            for(int i = 0 ; i < acc.byte_len; i++) {
                 LOG(INFO) << "               " << (int)res.val[i];
             }
             break;
@@ -221,7 +190,7 @@ Data get_op_val_any(Parameter para, PHV * phv, std::vector<ActionParam*> action_
     return res;
 }
 
-Data bit_compute(int op, Data data1, Data data2) {
+Data bit_compute(int op, Data data1, Data data2, Arena & arena) {
     switch (op) {
         case 1: { // <<
             int left_shift_num = get_value(data2);
@@ -231,31 +200,31 @@ Data bit_compute(int op, Data data1, Data data2) {
                 bitmap -= 1 << (31 - i);
             }
             operand = (operand << left_shift_num) & bitmap;
-            return get_data(data1.data_len, operand);
+            return get_data(data1.data_len, operand, arena);
         }
         case 2 : { // >>
             int right_shift_num = get_value(data2);
             uint32_t operand = get_value(data1);
             operand = (operand >> right_shift_num);
-            return get_data(data1.data_len, operand);
+            return get_data(data1.data_len, operand, arena);
         }
         case 3 : { // &
             uint32_t left_operand = get_value(data1);
             uint32_t right_operand = get_value(data2);
             uint32_t res = left_operand & right_operand;
-            return get_data(data1.data_len, res);
+            return get_data(data1.data_len, res, arena);
         }
         case 4 : { // |
             uint32_t left_operand = get_value(data1);
             uint32_t right_operand = get_value(data2);
             uint32_t res = left_operand | right_operand;
-            return get_data(data1.data_len, res);
+            return get_data(data1.data_len, res, arena);
         }
         case 5 : { // ^
             uint32_t left_operand = get_value(data1);
             uint32_t right_operand = get_value(data2);
             uint32_t res = left_operand ^ right_operand;
-            return get_data(data1.data_len, res);
+            return get_data(data1.data_len, res, arena);
         }
         case 6 : { // ~
             uint32_t left_operand = get_value(data1);
@@ -267,7 +236,7 @@ Data bit_compute(int op, Data data1, Data data2) {
             } else if(data1.data_len <= 32) {
                 res = ~left_operand;
             }
-            return get_data(data1.data_len, res);
+            return get_data(data1.data_len, res, arena);
         }
         default:
             return Data();
@@ -279,11 +248,14 @@ public:
     Parameter opt;
     struct ExpTreeNode * left = nullptr;
     struct ExpTreeNode * right = nullptr;
+    // FIELD leaves only, filled in by Primitive::compile
+    FieldAccessor acc;
 };
 
 struct Primitive: public ExpTreeNode {
 public:
-    FieldInfo *lvalue;
+    FieldInfo *lvalue = nullptr;
+    FieldAccessor lvalue_acc;
 
     Primitive(struct ExpTreeNode * r = nullptr) : root(r){}
 
@@ -299,40 +271,87 @@ public:
         root = r;
     }
 
+    // compile the lvalue and every field leaf of the tree, done once when the action is installed
+    void compile() {
+        if(lvalue != nullptr) {
+            lvalue_acc = FieldAccessor(*lvalue);
+        }
+        compile_tree(root);
+    }
+
+    /**
+     * the opcodes that keep state from one packet to the next, so a packet running them cannot be
+     * replayed from the flow cache. every opcode is listed and there is no default, so a new one does
+     * not end up cacheable unnoticed. the cache itself sees to the packet fields an opcode reads
+     */
+    static bool stateful_op(OpCode op) {
+        switch(op) {
+            // functions of their operands
+            case OpCode::ADD: case OpCode::SUB: case OpCode::MUL: case OpCode::DIV: case OpCode::MOD:
+            case OpCode::SHIFT_LEFT: case OpCode::SHIFT_RIGHT:
+            case OpCode::BIT_AND: case OpCode::BIT_OR: case OpCode::BIT_XOR: case OpCode::BIT_NEG:
+            case OpCode::SUM_BLOCK:
+            case OpCode::SET_FIELD: case OpCode::COPY_FIELD:
+                return false;
+            // read the neuron contexts and the sigmoid table, which only the control plane writes, and each
+            // of its writes moves the config epoch on
+            case OpCode::NEURON_PRIMITIVE: case OpCode::SIGMOID_LOOKUP:
+                return false;
+            // rewrite the packet's own TTL and header stack; execute() does not implement them
+            case OpCode::SET_TTL: case OpCode::DECREMENT_TTL:
+            case OpCode::COPY_TTL_OUTWARDS: case OpCode::COPY_TTL_INWARDS:
+            case OpCode::PUSH: case OpCode::POP: case OpCode::DECREMENT:
+                return false;
+        }
+        // not an OpCode at all, keep the packet out of the cache
+        return true;
+    }
+
+    static bool stateful_tree(const ExpTreeNode * etn) {
+        if(etn == nullptr) {
+            return false;
+        }
+        if(etn->opt.type == ParameterType::OPERATOR && stateful_op(etn->opt.val.op)) {
+            return true;
+        }
+        return stateful_tree(etn->left) || stateful_tree(etn->right);
+    }
+
+    bool stateful() const {
+        return stateful_tree(root);
+    }
+
+    static void compile_tree(ExpTreeNode * etn) {
+        if(etn == nullptr) {
+            return;
+        }
+        if(etn->opt.type == ParameterType::FIELD) {
+            etn->acc = FieldAccessor(etn->opt.val.field);
+        }
+        compile_tree(etn->left);
+        compile_tree(etn->right);
+    }
+
     void run(PHV * phv, const std::vector<ActionParam*>& action_paras) {
         LOG(INFO) << "  Primitive run...";
         Data res = execute(phv, root, action_paras, 2);
 
-        auto *p = new Parameter();
-        p->type = ParameterType::FIELD;
-        p->val.field = {lvalue->hdr_id, lvalue->internal_offset,
-                        lvalue->fd_len, lvalue->fd_type};
         LOG(INFO) << "      modify_field: ";
-        LOG(INFO) << "          header_id: " << (int)p->val.field.hdr_id;
-        LOG(INFO) << "          header_offset: " << (int)phv->parsed_headers[p->val.field.hdr_id]->hdr_offset;
-        LOG(INFO) << "          internal_offset: " << (int)p->val.field.internal_offset;
-        LOG(INFO) << "          field_length: " << (int)p->val.field.fd_len;
-        LOG(INFO) << "          field_type: " << (int)p->val.field.fd_type;
-        modify_field_with_data(*p, res, phv);
+        LOG(INFO) << "          header_id: " << (int)lvalue_acc.hdr_id;
+        LOG(INFO) << "          header_offset: " << (int)phv->parsed_headers[lvalue_acc.hdr_id].hdr_offset;
+        LOG(INFO) << "          internal_offset: " << (int)lvalue_acc.internal_offset;
+        LOG(INFO) << "          field_length: " << (int)lvalue_acc.fd_len;
+        LOG(INFO) << "          field_type: " << (int)lvalue_acc.fd_type;
+        lvalue_acc.write_right(phv, res.val, res.data_len);
+        if(phv->flow_patch != nullptr) {
+            phv->flow_patch->note(phv, lvalue_acc);
+        }
         LOG(INFO) << "      modified with:";
         LOG(INFO) << "          length: " << res.data_len;
         LOG(INFO) << "          value: " << res.data_len;
         for(int i = 0; i < ceil(res.data_len*1.0/8);i++) {
             LOG(INFO) << "              " << (int)res.val[i];
         }
-        LOG(INFO) << "      Mod result: ";
-
-        int begin_bit = phv->parsed_headers[p->val.field.hdr_id]->hdr_offset + p->val.field.internal_offset;
-        int end_bit = begin_bit + p->val.field.fd_len - 1;
-
-        int begin_byte = begin_bit / 8;
-        int end_byte = end_bit / 8;
-
-        for(int i = begin_byte; i <= end_byte; i++) {
-            LOG(INFO) << "          " << (int) phv->packet[i];
-        }
-
-
     }
 
     void build_para_tree() {
@@ -358,89 +377,89 @@ public:
                     uint32_t res = get_value(execute(phv, etn->left, action_paras, of+1))
                             + get_value(execute(phv, etn->right, action_paras, of+1));
                     LOG(INFO) << off << "   value: " << res;
-                    return get_data(32, res);
+                    return get_data(32, res, phv->arena);
                 }
                 case OpCode::SUB : {
                     uint32_t res = get_value(execute(phv, etn->left, action_paras, of+1))
                                    - get_value(execute(phv, etn->right, action_paras, of+1));
                     LOG(INFO) << off << "   value: " << res;
-                    return get_data(32, res);
+                    return get_data(32, res, phv->arena);
                 }
                 case OpCode::MUL : {
                     uint64_t res = static_cast<uint64_t>(get_value(execute(phv, etn->left, action_paras, of+1))) *
                                    static_cast<uint64_t>(get_value(execute(phv, etn->right, action_paras, of+1)));
                     uint32_t narrowed = static_cast<uint32_t>(res & 0xffffffffu);
                     LOG(INFO) << off << "   value: " << res;
-                    return get_data(32, narrowed);
+                    return get_data(32, narrowed, phv->arena);
                 }
                 case OpCode::DIV : {
                     uint32_t divisor = get_value(execute(phv, etn->right, action_paras, of+1));
                     if (divisor == 0) {
                         LOG(WARNING) << off << "   divisor is zero, returning 0.";
-                        return get_data(32, 0);
+                        return get_data(32, 0, phv->arena);
                     }
                     uint32_t dividend = get_value(execute(phv, etn->left, action_paras, of+1));
                     uint32_t res = dividend / divisor;
                     LOG(INFO) << off << "   value: " << res;
-                    return get_data(32, res);
+                    return get_data(32, res, phv->arena);
                 }
                 case OpCode::SHIFT_LEFT : {
                     Data data = execute(phv, etn->left, action_paras, of+1);
                     Data shift = execute(phv, etn->right, action_paras, of+1);
-                    Data res = bit_compute(1, data, shift);
+                    Data res = bit_compute(1, data, shift, phv->arena);
                     return res;
                 }
                 case OpCode::SHIFT_RIGHT : {
                     Data data = execute(phv, etn->left, action_paras, of+1);
                     Data shift = execute(phv, etn->right, action_paras, of+1);
-                    Data res = bit_compute(2, data, shift);
+                    Data res = bit_compute(2, data, shift, phv->arena);
                     return res;
                 }
                 case OpCode::BIT_AND : {
                     Data data1 = execute(phv, etn->left, action_paras, of+1);
                     Data data2 = execute(phv, etn->right, action_paras, of+1);
-                    Data res = bit_compute(3, data1, data2);
+                    Data res = bit_compute(3, data1, data2, phv->arena);
                     return res;
                 }
                 case OpCode::BIT_OR : {
                     Data data1 = execute(phv, etn->left, action_paras, of+1);
                     Data data2 = execute(phv, etn->right, action_paras, of+1);
-                    Data res = bit_compute(4, data1, data2);
+                    Data res = bit_compute(4, data1, data2, phv->arena);
                     return res;
                 }
                 case OpCode::BIT_XOR : {
                     Data data1 = execute(phv, etn->left, action_paras, of+1);
                     Data data2 = execute(phv, etn->right, action_paras, of+1);
-                    Data res = bit_compute(5, data1, data2);
+                    Data res = bit_compute(5, data1, data2, phv->arena);
                     return res;
                 }
                 case OpCode::BIT_NEG : {
                     Data data1 = execute(phv, etn->left, action_paras, of+1);
-                    Data res = bit_compute(6, data1, Data{});
+                    Data res = bit_compute(6, data1, Data{}, phv->arena);
                     return res;
                 }
                 case OpCode::NEURON_PRIMITIVE : {
                     if (etn->left == nullptr || etn->right == nullptr) {
                         LOG(ERROR) << off << "   neuron primitive expects feature and context operands.";
                         int target_bits = lvalue ? lvalue->fd_len : 32;
-                        return make_zero_data_bits(target_bits);
+                        return make_zero_data_bits(target_bits, phv->arena);
                     }
 
                     Data features = execute(phv, etn->left, action_paras, of+1);
                     Data context_meta = execute(phv, etn->right, action_paras, of+1);
                     uint32_t context_id = get_value(context_meta);
-                    const auto *ctx = NeuronPrimitiveManager::instance().get_context(static_cast<uint16_t>(context_id));
+                    auto ctx = NeuronPrimitiveManager::instance().get_context(static_cast<uint16_t>(context_id));
                     if (ctx == nullptr) {
                         LOG(WARNING) << off << "   neuron primitive context " << context_id << " not found.";
                         int target_bits = lvalue ? lvalue->fd_len : 32;
-                        return make_zero_data_bits(target_bits);
+                        return make_zero_data_bits(target_bits, phv->arena);
                     }
                     int expected_bits = static_cast<int>(ctx->num_neurons * (ctx->output_bitwidth == 0 ? 32 : ctx->output_bitwidth));
                     if (lvalue && expected_bits != lvalue->fd_len) {
                         LOG(WARNING) << off << "   neuron primitive output width (" << expected_bits
                                      << ") mismatches field width " << lvalue->fd_len;
                     }
-                    return execute_neuron_primitive(*ctx, features);
+                    return execute_neuron_primitive(*ctx, features, phv->arena);
                 }
                 case OpCode::SIGMOID_LOOKUP : {
                     Data input_data = execute(phv, etn->left, action_paras, of+1);
@@ -449,14 +468,14 @@ public:
                         Data width_data = execute(phv, etn->right, action_paras, of+1);
                         out_bits = get_value(width_data);
                     }
-                    Data res = apply_sigmoid_lookup(input_data, out_bits);
+                    Data res = apply_sigmoid_lookup(input_data, out_bits, phv->arena);
                     return res;
                 }
                 case OpCode::SUM_BLOCK : {
                     auto zero_with_log = [&](const std::string &reason) -> Data {
                         LOG(ERROR) << off << "   sum_block: " << reason;
                         int target_bits = lvalue ? lvalue->fd_len : 32;
-                        return make_zero_data_bits(target_bits);
+                        return make_zero_data_bits(target_bits, phv->arena);
                     };
 
                     std::vector<Data> operand_blocks;
@@ -523,7 +542,7 @@ public:
                         }
                     }
 
-                    Data packed = pack_chunks_into_data(accum, chunk_width);
+                    Data packed = pack_chunks_into_data(accum, chunk_width, phv->arena);
                     if (lvalue && packed.data_len != lvalue->fd_len) {
                         LOG(WARNING) << off << "   sum_block output width (" << packed.data_len
                                      << ") mismatches field width " << lvalue->fd_len;
@@ -535,57 +554,7 @@ public:
             }
         } else {
             LOG(INFO) << off << "   get operand: ";
-            return get_op_val_any(etn->opt, phv, action_paras);
-        }
-    }
-
-    static void modify_field_with_data(Parameter para, Data data, PHV * phv) {
-        int internal_offset = para.val.field.internal_offset; 
-        int fd_len = para.val.field.fd_len; 
-        auto hi = phv->parsed_headers[para.val.field.hdr_id];
-
-        int begin_bit = hi->hdr_offset + internal_offset;
-        int end_bit = begin_bit + fd_len - 1;
-
-        int begin_byte = begin_bit / 8, end_byte = end_bit / 8;
-
-        int byte_len = end_byte - begin_byte + 1;
-        auto span_byte = new uint8_t[byte_len]{0};
-
-        auto new_data = new uint8_t[byte_len];
-        memset(new_data, 0, byte_len * sizeof(uint8_t));
-        int data_len = ceil(data.data_len * 1.0 / 8);
-        if(data_len < byte_len) {
-            memcpy(new_data+1, data.val, byte_len-1);
-        } else if(data_len == byte_len) {
-            memcpy(new_data, data.val, byte_len);
-        } else{
-            memcpy(new_data, data.val+data_len-byte_len, byte_len);
-        }
-
-        int right_empty = (end_bit / 8 + 1) * 8 - end_bit - 1;
-
-        for(int i = byte_len - 1; i >= 1; i--) {
-            span_byte[i] += (new_data[i] << right_empty);
-            span_byte[i-1] += (new_data[i] >> (8 - right_empty));
-        }
-        span_byte[0] += (new_data[0] << right_empty);
-
-        auto bitmap = new uint8_t[byte_len]{0};
-        int left_empty = begin_bit % 8;
-
-        for(int i = 0; i < left_empty; i++) {
-            bitmap[0] += ( 1 << (7 - i) );
-        }
-
-        for(int i = 0; i < right_empty; i++) {
-            bitmap[byte_len-1] += (1 << i);
-        }
-
-        int idx = 0;
-        for(int i = begin_byte; i <= end_byte; i++) {
-            phv->packet[i] = (phv->packet[i] & bitmap[idx]) + span_byte[idx];
-            idx++;
+            return get_op_val_any(etn->opt, etn->acc, phv, action_paras);
         }
     }
 
@@ -604,6 +573,9 @@ struct Action {
     std::vector<ActionParam*> action_paras;
     std::vector<int> action_para_lens;
 
+    // some primitive keeps state across packets, set by Executor::insert_action
+    bool stateful = false;
+
     Action() = default;
 
     void set_action_para_lens(std::vector<int> para_lens) {
@@ -611,7 +583,30 @@ struct Action {
     }
 
     void set_action_paras(uint8_t * value) {
+        // kept past any packet, so the parameters are copied out of the scratch arena
+        Arena scratch;
+        std::vector<ActionParam*> decoded;
+        decode_action_paras(value, scratch, decoded);
+        for(auto ap : action_paras) {
+            delete[] ap->val;
+            delete ap;
+        }
         action_paras.clear();
+        for(auto ap : decoded) {
+            int byte_len = (int)ceil(ap->action_para_len * 1.0 / 8);
+            auto data = new ActionParam{ap->action_para_len, new uint8_t[byte_len]};
+            memcpy(data->val, ap->val, byte_len);
+            action_paras.push_back(data);
+        }
+    }
+
+    /**
+     * decode the parameters of one hit from the matched SRAM value into paras.
+     * parameters and their values are allocated from arena (the packet's), so concurrent packets
+     * hitting the same action never share parameter storage and nothing has to be freed
+     */
+    void decode_action_paras(const uint8_t * value, Arena & arena, std::vector<ActionParam*> & paras) const {
+        paras.clear();
         LOG(INFO) << "      action param num is: " << para_num;
         int cur_offset = 16;
         LOG(INFO) << "      param: ";
@@ -629,7 +624,7 @@ struct Action {
             int byte_end = (para_end / 8) - (right_offset == 0 ? 1 : 0);
 
             int new_len = byte_end - byte_start + 1;
-            auto * value_new = new uint8_t[byte_end - byte_start + 1];
+            auto value_new = arena.alloc_bytes(new_len);
             memcpy(value_new, value + byte_start, byte_end - byte_start + 1);
             value_new[0] = (uint8_t(value_new[0] << left_offset) >> left_offset);
             value_new[new_len - 1] = right_offset == 0 ? value_new[new_len - 1] :
@@ -640,11 +635,10 @@ struct Action {
                 LOG(INFO) << "              " <<(int)value_new[k];
             }
 
-            auto data = new ActionParam();
+            auto data = arena.make<ActionParam>();
             data->action_para_len = action_para_lens[i];
             int byte_len = (int)ceil(data->action_para_len * 1.0 / 8);
-            data->val = new uint8_t[byte_len];
-            memset(data->val, 0, sizeof(uint8_t) * byte_len);
+            data->val = arena.alloc_zeroed(byte_len);
 
             int idx = new_len - 1;
 
@@ -663,7 +657,7 @@ struct Action {
             for(int k = 0; k < byte_len; k++) {
                 LOG(INFO) << "              " <<(int)data->val[k];
             }
-            action_paras.push_back(data);
+            paras.push_back(data);
             cur_offset = para_end;
         }
         LOG(INFO) << "      set action paras end! ";
@@ -695,10 +689,17 @@ struct Action {
     }
 
     void execute(PHV * phv) {
+        execute(phv, action_paras);
+    }
+
+    void execute(PHV * phv, const std::vector<ActionParam*> & paras) const {
         LOG(INFO) << "Primitive num: " << prims.size();
+        if(stateful) {
+            phv->flow_uncacheable = true;
+        }
         for(auto it : prims) {
             LOG(INFO)<< "The type of lvalue of primitive: " << (int)it->lvalue->fd_type << std::endl;
-            it->run(phv, action_paras);
+            it->run(phv, paras);
         }
         LOG(INFO) << "Primitive execute end!";
     }
@@ -707,17 +708,39 @@ struct Action {
 class Executor {
 public:
 
-    Action * _actions[EXECUTOR_ACTION_NUM];
+    // shared with the copies of this executor a config transaction makes, see Pipeline::copy_processor.
+    // the packet path only dereferences them, the counts change on the config side
+    std::shared_ptr<Action> _actions[EXECUTOR_ACTION_NUM];
     Executor() {
 
     }
 
+    Executor(const Executor &) = delete;
+    Executor & operator=(const Executor &) = delete;
+
+    static void free_action(Action * ac) {
+        ac->del();
+        delete ac;
+    }
+
+    // the same actions as other, not copies: their state carries over to this executor
+    void copy_from(const Executor & other) {
+        for(int i = 0; i < EXECUTOR_ACTION_NUM; i++) {
+            _actions[i] = other._actions[i];
+        }
+    }
+
     void insert_action(Action *ac, int action_id) {
-        _actions[action_id] = ac;
+        ac->stateful = false;
+        for(auto prim : ac->prims) {
+            prim->compile();
+            ac->stateful = ac->stateful || prim->stateful();
+        }
+        _actions[action_id] = std::shared_ptr<Action>(ac, free_action);
     }
 
     void execute_miss_action(int action_id, PHV * phv) {
-        Action * action = _actions[action_id];
+        Action * action = _actions[action_id].get();
         action->execute(phv);
     }
 
@@ -725,33 +748,41 @@ public:
         LOG(INFO) << "  Executor...";
         int32_t action_id = phv->next_action_id;
         LOG(INFO) << "      action_id: " << action_id;
-        auto action = _actions[action_id];
-        action->set_action_paras(phv->match_value);
-        action->execute(phv);
+        if(action_id < 0 || action_id >= EXECUTOR_ACTION_NUM || _actions[action_id] == nullptr) {
+            LOG(ERROR) << "      no action installed at " << action_id;
+            return;
+        }
+        Action * action = _actions[action_id].get();
+        // decoded per packet: Action is shared by every worker running this processor
+        action->decode_action_paras(phv->match_value, phv->arena, phv->action_paras);
+        action->execute(phv, phv->action_paras);
     }
 
     void execute_action(int action_id, PHV * phv) {
-        Action * action = _actions[action_id];
+        Action * action = _actions[action_id].get();
         action->execute(phv);
     }
 
     void set_action_para_value(uint8_t * value) {
         int action_id = uint32_t(value[1]) + ((uint32_t)value[0] << 8);
-        auto action = _actions[action_id];
+        Action * action = _actions[action_id].get();
         action->set_action_paras(value);
     }
 
-    void del_action(int action_id) {
-        _actions[action_id]->del();
-        delete _actions[action_id];
+    // the action is deleted once no executor holds it any more; false if there was none
+    bool del_action(int action_id) {
+        if(action_id < 0 || action_id >= EXECUTOR_ACTION_NUM) {
+            LOG(ERROR) << "del_action: invalid action id " << action_id;
+            return false;
+        }
+        bool had = _actions[action_id] != nullptr;
+        _actions[action_id] = nullptr;
+        return had;
     }
 
     void clear_action() {
-        for(int i = 0; i < EXECUTOR_ACTION_NUM; i++) {
-            if(_actions[i] != nullptr) {
-                _actions[i]->del();
-                delete _actions[i];
-            }
+        for(auto & ac : _actions) {
+            ac = nullptr;
         }
     }
 };
@@ -0,0 +1,210 @@
+//
+// Bit field reads and writes on the PHV, compiled once per FieldInfo.
+//
+
+#ifndef RECONF_SWITCH_IPSA_FIELD_ACCESS_H
+#define RECONF_SWITCH_IPSA_FIELD_ACCESS_H
+
+#include <cstdint>
+#include <cstring>
+#include <endian.h>
+
+#include "defs.h"
+
+// widest run of bits one 64-bit load covers wherever in a byte it starts
+const static int FIELD_CHUNK_BITS = 56;
+
+/**
+ * big-endian 64-bit load at byte; bytes at or past limit read as zero, so a load
+ * near the end of the frame or the metadata area never touches memory beyond it
+ */
+static inline uint64_t load_be64(const uint8_t * buf, uint32_t byte, uint32_t limit) {
+    uint64_t w = 0;
+    if(byte + 8 <= limit) {
+        memcpy(&w, buf + byte, 8);
+    } else if(byte < limit) {
+        memcpy(&w, buf + byte, limit - byte);
+    }
+    return be64toh(w);
+}
+
+static inline void store_be64(uint8_t * buf, uint32_t byte, uint32_t limit, uint64_t w) {
+    w = htobe64(w);
+    if(byte + 8 <= limit) {
+        memcpy(buf + byte, &w, 8);
+    } else if(byte < limit) {
+        memcpy(buf + byte, &w, limit - byte);
+    }
+}
+
+// len (1..FIELD_CHUNK_BITS) bits starting at bit, right aligned
+static inline uint64_t read_bits(const uint8_t * buf, uint32_t limit, uint32_t bit, int len) {
+    return (load_be64(buf, bit >> 3, limit) << (bit & 7)) >> (64 - len);
+}
+
+static inline void write_bits(uint8_t * buf, uint32_t limit, uint32_t bit, int len, uint64_t value) {
+    int shift = 64 - len - (int)(bit & 7);
+    uint64_t mask = (~0ULL >> (64 - len)) << shift;
+    uint64_t w = load_be64(buf, bit >> 3, limit);
+    w = (w & ~mask) | ((value << shift) & mask);
+    store_be64(buf, bit >> 3, limit, w);
+}
+
+/**
+ * one field of the PHV. everything that depends only on the FieldInfo is worked out at
+ * construction, when the config is pushed; per packet only the header offset is added.
+ * fields wider than FIELD_CHUNK_BITS are handled in FIELD_CHUNK_BITS pieces.
+ */
+struct FieldAccessor {
+    uint8_t hdr_id = 0;
+    FieldType fd_type = FieldType::FIELD;
+    uint16_t internal_offset = 0;
+    uint16_t fd_len = 0;
+    uint16_t byte_len = 0;
+    // bits of padding behind the value when it is left aligned in byte_len bytes
+    uint8_t tail_pad = 0;
+    // fits in a single load/store
+    bool single = false;
+
+    FieldAccessor() = default;
+
+    template <typename Field>
+    explicit FieldAccessor(const Field & fd)
+            : hdr_id(fd.hdr_id), fd_type(fd.fd_type), internal_offset(fd.internal_offset), fd_len(fd.fd_len) {
+        byte_len = (fd_len + 7) / 8;
+        tail_pad = byte_len * 8 - fd_len;
+        single = fd_len > 0 && fd_len <= FIELD_CHUNK_BITS;
+    }
+
+    uint32_t begin_bit(const PHV * phv) const {
+        return phv->parsed_headers[hdr_id].hdr_offset + internal_offset;
+    }
+
+    uint32_t limit(const PHV * phv) const {
+        return phv->hdr_limit(hdr_id);
+    }
+
+    // the low 64 bits of the field
+    uint64_t read(const PHV * phv) const {
+        if(fd_type == FieldType::VALID) {
+            return phv->valid_bitmap[hdr_id];
+        }
+        const uint8_t * base = phv->hdr_base(hdr_id);
+        uint32_t lim = limit(phv);
+        uint32_t bit = begin_bit(phv);
+        if(single) {
+            return read_bits(base, lim, bit, fd_len);
+        }
+        if(fd_len == 0) {
+            return 0;
+        }
+        uint32_t end = bit + fd_len;
+        int hi_len = fd_len > 64 ? 32 : fd_len - 32;
+        uint64_t hi = read_bits(base, lim, end - 32 - hi_len, hi_len);
+        return (hi << 32) | read_bits(base, lim, end - 32, 32);
+    }
+
+    // byte_len big-endian bytes, value in the low fd_len bits (the Data layout)
+    void read_right(const PHV * phv, uint8_t * out) const {
+        memset(out, 0, byte_len);
+        if(fd_type == FieldType::VALID) {
+            out[byte_len - 1] = phv->valid_bitmap[hdr_id];
+            return;
+        }
+        const uint8_t * base = phv->hdr_base(hdr_id);
+        uint32_t lim = limit(phv);
+        uint32_t bit = begin_bit(phv);
+        int done = 0;
+        while(done < fd_len) {
+            int len = fd_len - done < FIELD_CHUNK_BITS ? fd_len - done : FIELD_CHUNK_BITS;
+            uint64_t v = read_bits(base, lim, bit + fd_len - done - len, len);
+            write_bits(out, byte_len, byte_len * 8 - done - len, len, v);
+            done += len;
+        }
+    }
+
+    // byte_len big-endian bytes, value in the high fd_len bits (the match key layout)
+    void read_left(const PHV * phv, uint8_t * out) const {
+        memset(out, 0, byte_len);
+        if(fd_type == FieldType::VALID) {
+            out[0] = phv->valid_bitmap[hdr_id] << 7;
+            return;
+        }
+        const uint8_t * base = phv->hdr_base(hdr_id);
+        uint32_t lim = limit(phv);
+        uint32_t bit = begin_bit(phv);
+        int done = 0;
+        while(done < fd_len) {
+            int len = fd_len - done < FIELD_CHUNK_BITS ? fd_len - done : FIELD_CHUNK_BITS;
+            write_bits(out, byte_len, done, len, read_bits(base, lim, bit + done, len));
+            done += len;
+        }
+    }
+
+    // bits the field takes in a packed match key; a validity bit is one whatever its fd_len
+    int key_bits() const {
+        return fd_type == FieldType::VALID ? 1 : fd_len;
+    }
+
+    // copy the field's key_bits() bits to bit dst of key, key_bytes long
+    void pack(const PHV * phv, uint8_t * key, uint32_t key_bytes, uint32_t dst) const {
+        if(fd_type == FieldType::VALID) {
+            write_bits(key, key_bytes, dst, 1, phv->valid_bitmap[hdr_id] & 1);
+            return;
+        }
+        const uint8_t * base = phv->hdr_base(hdr_id);
+        uint32_t lim = limit(phv);
+        uint32_t bit = begin_bit(phv);
+        int done = 0;
+        while(done < fd_len) {
+            int len = fd_len - done < FIELD_CHUNK_BITS ? fd_len - done : FIELD_CHUNK_BITS;
+            write_bits(key, key_bytes, dst + done, len, read_bits(base, lim, bit + done, len));
+            done += len;
+        }
+    }
+
+    // store the low fd_len bits of value
+    void write(PHV * phv, uint64_t value) const {
+        uint8_t * base = phv->hdr_base(hdr_id);
+        uint32_t lim = limit(phv);
+        uint32_t bit = begin_bit(phv);
+        if(single) {
+            write_bits(base, lim, bit, fd_len, value);
+            return;
+        }
+        int done = 0;
+        while(done < fd_len) {
+            int len = fd_len - done < 32 ? fd_len - done : 32;
+            uint64_t v = done < 64 ? value >> done : 0;
+            write_bits(base, lim, bit + fd_len - done - len, len, v);
+            done += len;
+        }
+    }
+
+    /**
+     * store a Data style value (val_bits right aligned in big-endian bytes): its low fd_len bits,
+     * zero extended if the value is narrower than the field
+     */
+    void write_right(PHV * phv, const uint8_t * val, int val_bits) const {
+        uint8_t * base = phv->hdr_base(hdr_id);
+        uint32_t lim = limit(phv);
+        uint32_t bit = begin_bit(phv);
+        int val_bytes = (val_bits + 7) / 8;
+        int val_end = val_bytes * 8;
+        int done = 0;
+        while(done < fd_len) {
+            int len = fd_len - done < FIELD_CHUNK_BITS ? fd_len - done : FIELD_CHUNK_BITS;
+            // bits of the chunk that the value actually has, the rest are zero
+            int avail = val_bits - done;
+            uint64_t v = 0;
+            if(avail > 0) {
+                int take = avail < len ? avail : len;
+                v = read_bits(val, val_bytes, val_end - done - take, take);
+            }
+            write_bits(base, lim, bit + fd_len - done - len, len, v);
+            done += len;
+        }
+    }
+};
+
+#endif //RECONF_SWITCH_IPSA_FIELD_ACCESS_H
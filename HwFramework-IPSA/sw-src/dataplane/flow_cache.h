@@ -0,0 +1,268 @@
+//
+// Microflow cache: replays the pipeline's result for packets of a flow already seen.
+//
+
+#ifndef RECONF_SWITCH_IPSA_FLOW_CACHE_H
+#define RECONF_SWITCH_IPSA_FLOW_CACHE_H
+
+#include <algorithm>
+#include <vector>
+
+#include "defs.h"
+#include "global.h"
+#include "field_access.h"
+#include "flow_hash.h"
+#include "../util/MurmurHash3.h"
+
+const static int FLOW_CACHE_WAYS = 4;
+// frame bytes a cached flow may rewrite, and how many of them an entry keeps
+const static int FLOW_PATCH_LEN = 128;
+const static int FLOW_PATCH_MAX = 32;
+// 5-tuple, IPv4 header length, ingress port
+const static int FLOW_CACHE_KEY_LEN = FLOW_TUPLE_LEN + 3;
+
+/**
+ * the frame bits the pipeline wrote while a packet is recorded. writes only mark their bits, the
+ * values are read back from the frame when the pipeline is done, so the last write wins.
+ * metadata is not tracked here, the cache keeps a copy of all of it.
+ * reads are checked against the bits the cache key fixes: a result that depends on any other frame
+ * bit (IP ID, TTL, total length, TCP flags, ...) may differ between packets of a flow, so it is not cached
+ */
+struct FlowPatch {
+    uint8_t mask[FLOW_PATCH_LEN];
+    // frame bits that are equal in every packet with the cache key, set by FlowCache::lookup
+    uint8_t key_mask[FLOW_PATCH_LEN];
+    bool overflow = false;
+    // a read of a frame bit outside the key and not written before, or a header cut off by the frame's end
+    bool unkeyed = false;
+    // frame bytes the parser found headers in, a shorter packet may parse differently
+    uint32_t parsed_len = 0;
+
+    void clear() {
+        memset(mask, 0, sizeof(mask));
+        memset(key_mask, 0, sizeof(key_mask));
+        overflow = false;
+        unkeyed = false;
+        parsed_len = 0;
+    }
+
+    void note(const PHV * phv, const FieldAccessor & acc) {
+        if((phv->meta_headers >> acc.hdr_id) & 1) {
+            return;
+        }
+        uint32_t begin = acc.begin_bit(phv);
+        uint32_t end = std::min<uint32_t>(begin + acc.fd_len, phv->packet_len * 8);
+        if(end > (uint32_t) FLOW_PATCH_LEN * 8) {
+            overflow = true;
+            return;
+        }
+        for(uint32_t b = begin; b < end; b++) {
+            mask[b >> 3] |= 0x80 >> (b & 7);
+        }
+    }
+
+    /**
+     * a read of the field. metadata starts out the same for every packet of a flow, and bits this packet
+     * wrote hold what the recorded writes put there, so only frame bits outside both count
+     */
+    void note_read(const PHV * phv, const FieldAccessor & acc) {
+        if(acc.fd_type == FieldType::VALID || ((phv->meta_headers >> acc.hdr_id) & 1)) {
+            return;
+        }
+        uint32_t begin = acc.begin_bit(phv);
+        uint32_t end = begin + acc.fd_len;
+        if(end > phv->packet_len * 8 || end > (uint32_t) FLOW_PATCH_LEN * 8) {
+            unkeyed = true;
+            return;
+        }
+        for(uint32_t b = begin; b < end; b++) {
+            if(((key_mask[b >> 3] | mask[b >> 3]) & (0x80 >> (b & 7))) == 0) {
+                unkeyed = true;
+                return;
+            }
+        }
+    }
+
+    // the parser took a header ending at bit end, or found it cut off
+    void note_parsed(uint32_t end, bool truncated) {
+        if(truncated) {
+            unkeyed = true;
+        } else {
+            parsed_len = std::max(parsed_len, (end + 7) / 8);
+        }
+    }
+};
+
+struct FlowCacheEntry {
+    bool valid = false;
+    uint64_t epoch = 0;
+    uint8_t key[FLOW_CACHE_KEY_LEN]{};
+    // shortest frame the recorded parse holds for
+    uint32_t min_len = 0;
+    uint8_t meta[META_LEN]{};
+    int patch_num = 0;
+    uint8_t patch_off[FLOW_PATCH_MAX]{};
+    uint8_t patch_mask[FLOW_PATCH_MAX]{};
+    uint8_t patch_val[FLOW_PATCH_MAX]{};
+};
+
+/**
+ * exact match cache over the 5-tuple, IPv4 header length and ingress port, set associative. an entry
+ * holds what the pipeline left behind for the first packet of a flow: the frame bytes it rewrote and
+ * the whole metadata area (egress port, inference output); later packets of the flow get those and
+ * skip Pipeline::execute. a packet is only cached if the pipeline read no frame bits but the key's
+ * (see FlowPatch::note_read), so the tables, gateways and actions saw the same values any packet of
+ * the flow would show them. the IPv4 checksum is recomputed after a replay like after the pipeline.
+ * entries are stamped with the config epoch pinned to the packet along with its pipeline, so any
+ * config change invalidates them, and a packet that ran a stateful action is never cached.
+ * a cache belongs to one thread; with workers each keeps its own, a flow always lands on the same one
+ */
+class FlowCache {
+    std::vector<FlowCacheEntry> entries;
+    uint32_t set_mask = 0;
+    uint32_t evict = 0;
+
+    // the packet being recorded, between lookup and finish
+    FlowPatch patch;
+    bool recording = false;
+    uint8_t cur_key[FLOW_CACHE_KEY_LEN]{};
+    uint32_t cur_hash = 0;
+    uint64_t cur_epoch = 0;
+
+    // false if the packet is not TCP/UDP over IPv4
+    static bool make_key(const PHV * phv, uint8_t * key) {
+        if(flow_key(phv->packet, phv->packet_len, key) != FLOW_TUPLE_LEN) {
+            return false;
+        }
+        key[FLOW_TUPLE_LEN] = phv->packet[sizeof(ether_header)] & 0x0f;
+        key[FLOW_TUPLE_LEN + 1] = (uint8_t)(phv->ig_if >> 8);
+        key[FLOW_TUPLE_LEN + 2] = (uint8_t) phv->ig_if;
+        return true;
+    }
+
+    // frame bits make_key fixes: the EtherType, IHL, the fragment bits (zero, or there are no ports),
+    // protocol, addresses and ports. all lie in the first 78 bytes
+    static void set_key_mask(const PHV * phv, uint8_t * key_mask) {
+        const int ip = sizeof(ether_header);
+        const int l4 = ip + (phv->packet[ip] & 0x0f) * 4;
+        memset(key_mask + ip - 2, 0xff, 2);
+        key_mask[ip] |= 0x0f;
+        key_mask[ip + 6] |= 0x3f;
+        key_mask[ip + 7] = 0xff;
+        key_mask[ip + 9] = 0xff;
+        memset(key_mask + ip + 12, 0xff, 8);
+        memset(key_mask + l4, 0xff, 4);
+    }
+
+    FlowCacheEntry * find(const uint8_t * key, uint32_t hash) {
+        auto set = &entries[(hash & set_mask) * FLOW_CACHE_WAYS];
+        for(int w = 0; w < FLOW_CACHE_WAYS; w++) {
+            if(set[w].valid && memcmp(set[w].key, key, FLOW_CACHE_KEY_LEN) == 0) {
+                return &set[w];
+            }
+        }
+        return nullptr;
+    }
+
+    // way for a new entry: the flow's old one, an empty or stale way, else round robin
+    FlowCacheEntry * victim(const uint8_t * key, uint32_t hash, uint64_t epoch) {
+        auto old = find(key, hash);
+        if(old != nullptr) {
+            return old;
+        }
+        auto set = &entries[(hash & set_mask) * FLOW_CACHE_WAYS];
+        for(int w = 0; w < FLOW_CACHE_WAYS; w++) {
+            if(!set[w].valid || set[w].epoch != epoch) {
+                return &set[w];
+            }
+        }
+        return &set[evict++ % FLOW_CACHE_WAYS];
+    }
+
+public:
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t bypassed = 0;
+
+    // capacity in entries, rounded up to a power of two sets
+    explicit FlowCache(int capacity) {
+        uint32_t sets = 1;
+        while(sets * FLOW_CACHE_WAYS < (uint32_t) capacity) {
+            sets <<= 1;
+        }
+        entries.resize(sets * FLOW_CACHE_WAYS);
+        set_mask = sets - 1;
+    }
+
+    /**
+     * replay the packet's flow if it is cached under the current epoch.
+     * otherwise, when the packet may be cached, start recording it: the pipeline must run and
+     * finish be called after it
+     * @return true if the packet is done and the pipeline must be skipped
+     */
+    bool lookup(PHV * phv) {
+        recording = false;
+        if(!make_key(phv, cur_key)) {
+            bypassed++;
+            return false;
+        }
+        MurmurHash3_x86_32(cur_key, FLOW_CACHE_KEY_LEN, 0, &cur_hash);
+        cur_epoch = phv->config_epoch;
+
+        auto e = find(cur_key, cur_hash);
+        if(e != nullptr && e->epoch == cur_epoch && phv->packet_len >= e->min_len) {
+            memcpy(phv->meta, e->meta, META_LEN);
+            for(int i = 0; i < e->patch_num; i++) {
+                if(e->patch_off[i] < phv->packet_len) {
+                    auto & b = phv->packet[e->patch_off[i]];
+                    b = (uint8_t)((b & ~e->patch_mask[i]) | e->patch_val[i]);
+                }
+            }
+            hits++;
+            return true;
+        }
+
+        misses++;
+        patch.clear();
+        set_key_mask(phv, patch.key_mask);
+        phv->flow_patch = &patch;
+        recording = true;
+        return false;
+    }
+
+    // store what the pipeline did to the packet lookup started recording
+    void finish(PHV * phv) {
+        phv->flow_patch = nullptr;
+        if(!recording) {
+            return;
+        }
+        recording = false;
+        if(phv->flow_uncacheable || patch.overflow || patch.unkeyed) {
+            bypassed++;
+            return;
+        }
+
+        FlowCacheEntry rec;
+        for(int i = 0; i < FLOW_PATCH_LEN; i++) {
+            if(patch.mask[i] == 0) {
+                continue;
+            }
+            if(rec.patch_num == FLOW_PATCH_MAX) {
+                bypassed++;
+                return;
+            }
+            rec.patch_off[rec.patch_num] = (uint8_t) i;
+            rec.patch_mask[rec.patch_num] = patch.mask[i];
+            rec.patch_val[rec.patch_num] = phv->packet[i] & patch.mask[i];
+            rec.patch_num++;
+        }
+        rec.valid = true;
+        rec.epoch = cur_epoch;
+        rec.min_len = patch.parsed_len;
+        memcpy(rec.key, cur_key, FLOW_CACHE_KEY_LEN);
+        memcpy(rec.meta, phv->meta, META_LEN);
+        *victim(cur_key, cur_hash, cur_epoch) = rec;
+    }
+};
+
+#endif //RECONF_SWITCH_IPSA_FLOW_CACHE_H
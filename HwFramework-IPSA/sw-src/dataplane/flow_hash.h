@@ -0,0 +1,39 @@
+//
+// Flow key of a packet: the IPv4 5-tuple the flow cache looks packets up by.
+//
+
+#ifndef RECONF_SWITCH_IPSA_FLOW_HASH_H
+#define RECONF_SWITCH_IPSA_FLOW_HASH_H
+
+#include "defs.h"
+
+const static int FLOW_TUPLE_LEN = 13;
+
+/**
+ * the IPv4 5-tuple of pkt into key: addresses and protocol, then the ports for TCP/UDP.
+ * @return FLOW_TUPLE_LEN, 9 for other protocols and fragments (so all fragments of a datagram
+ * agree), 0 if pkt is not IPv4
+ */
+static inline int flow_key(InputBuffer pkt, uint32_t len, uint8_t * key) {
+    int key_len = 0;
+
+    if(len >= sizeof(ether_header) + sizeof(iphdr)
+            && ntohs(((const ether_header *) pkt)->ether_type) == ETHERTYPE_IP) {
+        auto ip_hdr = (const iphdr *) (pkt + sizeof(ether_header));
+        memcpy(key, &ip_hdr->saddr, 4);
+        memcpy(key + 4, &ip_hdr->daddr, 4);
+        key[8] = ip_hdr->protocol;
+        key_len = 9;
+
+        size_t ihl = (size_t) ip_hdr->ihl * 4;
+        bool fragment = (ntohs(ip_hdr->frag_off) & 0x3fff) != 0; // MF or a fragment offset
+        if((ip_hdr->protocol == IPPROTO_TCP || ip_hdr->protocol == IPPROTO_UDP) && !fragment
+                && ihl >= sizeof(iphdr) && len >= sizeof(ether_header) + ihl + 4) {
+            memcpy(key + 9, pkt + sizeof(ether_header) + ihl, 4);
+            key_len = FLOW_TUPLE_LEN;
+        }
+    }
+    return key_len;
+}
+
+#endif //RECONF_SWITCH_IPSA_FLOW_HASH_H
@@ -6,6 +6,8 @@
 #define RECONF_SWITCH_IPSA_GATEWAY_H
 
 #include "defs.h"
+#include "field_access.h"
+#include "flow_cache.h"
 #include <unordered_map>
 
 // determine matching which table, if none, bypass this stage and goto next stage;
@@ -25,6 +27,84 @@ struct RelationExp {
     RelationCode relation;
 };
 
+/**
+ * a relation operand as the gateway evaluates it: constants decoded once, fields bound to an accessor
+ */
+struct GateOperand {
+    enum class Kind : uint8_t {
+        CONSTANT, FIELD, VALID, HIT, MISS
+    };
+    Kind kind = Kind::CONSTANT;
+    uint32_t constant = 0;
+    FieldAccessor acc;
+
+    GateOperand() = default;
+
+    explicit GateOperand(const GateParam & param) {
+        if(param.type == ParameterType::FIELD) {
+            switch(param.field.fd_type) {
+                case FieldType::VALID : kind = Kind::VALID; break;
+                case FieldType::HIT : kind = Kind::HIT; break;
+                case FieldType::MISS : kind = Kind::MISS; break;
+                default : kind = Kind::FIELD; break;
+            }
+            acc = FieldAccessor(param.field);
+        } else if(param.type == ParameterType::CONSTANT) {
+            // low 32 bits of the big-endian constant
+            int len = param.constant_data.data_len;
+            int byte_len = len / 8 + (len % 8 == 0 ? 0 : 1);
+            for(int i = byte_len - 4 > 0 ? byte_len - 4 : 0; i < byte_len; i++) {
+                constant = (constant << 8) | param.constant_data.val[i];
+            }
+        }
+    }
+
+    uint32_t value(const PHV * phv) const {
+        switch(kind) {
+            case Kind::FIELD : {
+                if(phv->flow_patch != nullptr) {
+                    phv->flow_patch->note_read(phv, acc);
+                }
+                return (uint32_t) acc.read(phv);
+            }
+            case Kind::VALID : return phv->valid_bitmap[acc.hdr_id];
+            case Kind::HIT : return phv->hit;
+            case Kind::MISS : return ~(uint32_t)phv->hit;
+            default : return constant;
+        }
+    }
+};
+
+/**
+ * a relation compiled for evaluation. the comparison of the two operands is folded into an
+ * index (0: <, 1: ==, 2: >) and truth holds the relation's answer for each, so no branch on the code
+ */
+struct GateRelation {
+    GateOperand op1;
+    GateOperand op2;
+    uint8_t truth = 0;
+
+    GateRelation() = default;
+
+    explicit GateRelation(const RelationExp & exp) : op1(exp.param1), op2(exp.param2) {
+        switch(exp.relation) {
+            case RelationCode::GT : truth = 0b100; break;
+            case RelationCode::GTE : truth = 0b110; break;
+            case RelationCode::LT : truth = 0b001; break;
+            case RelationCode::LTE : truth = 0b011; break;
+            case RelationCode::EQ : truth = 0b010; break;
+            case RelationCode::NEQ : truth = 0b101; break;
+        }
+    }
+
+    uint8_t eval(const PHV * phv) const {
+        uint32_t a = op1.value(phv);
+        uint32_t b = op2.value(phv);
+        int cmp = ((a > b) << 1) | (a == b);
+        return (truth >> cmp) & 1;
+    }
+};
+
 //enum class LogicCode {
 //    AND, OR, NOT
 //};
@@ -32,20 +112,49 @@ struct RelationExp {
 class Gateway {
     // relation
     // logic
-    uint8_t bitmap;
     GateEntry default_entry;
 //    RelationExp exps[8];
     std::vector<RelationExp*> exps;
     // bitmap->matcher_id, if id == 100, bypass and goto next
     std::unordered_map<uint8_t, GateEntry> res_next;
 
+    // what execute reads, compiled from the above whenever they change
+    std::vector<GateRelation> rels;
+    GateEntry res_tbl[256]{};
+
+    void rebuild_res_tbl() {
+        for(auto & ge : res_tbl) {
+            ge = default_entry;
+        }
+        for(auto & it : res_next) {
+            res_tbl[it.first] = it.second;
+        }
+    }
+
 //    std::unordered_map<uint8_t, int> res_next_proc;
 //    std::unordered_map<uint8_t, int> res_next_matcher;
 //    std::unordered_map<uint8_t, int> res_next_action;
 
 public:
-    Gateway() {
-        bitmap = 0;
+    Gateway() = default;
+
+    Gateway(const Gateway &) = delete;
+    Gateway & operator=(const Gateway &) = delete;
+
+    ~Gateway() {
+        for(auto exp : exps) {
+            delete exp;
+        }
+    }
+
+    void copy_from(const Gateway & other) {
+        clear();
+        for(auto exp : other.exps) {
+            insert_exp(new RelationExp(*exp));
+        }
+        default_entry = other.default_entry;
+        res_next = other.res_next;
+        rebuild_res_tbl();
     }
 
     void set_default_entry (GateEntry ge) {
@@ -53,20 +162,31 @@ public:
         LOG(INFO) << "      type (stage, matcher): " << (int)ge.type;
         LOG(INFO) << "      value: " << ge.val;
         this->default_entry = ge;
+        rebuild_res_tbl();
     }
 
     void clear_default_entry () {
         this->default_entry = {};
+        rebuild_res_tbl();
     }
 
     void insert_exp(RelationExp * exp) {
+        if(exps.size() >= 8) {
+            LOG(WARNING) << "Gateway supports 8 relations, ignoring the rest";
+            return;
+        }
         exps.push_back(exp);
+        rels.emplace_back(*exp);
     }
 
     // clear all
     void clear() {
         this->default_entry = {};
+        for(auto exp : exps) {
+            delete exp;
+        }
         exps.clear();
+        rels.clear();
         res_next.clear();
         clear_default_entry();
 //        res_next_proc.clear();
@@ -80,6 +200,7 @@ public:
         LOG(INFO) << "      type(table, stage): " << (int)type;
         LOG(INFO) << "      value: " << (int)val;
         res_next[key] = GateEntry{type, val};
+        res_tbl[key] = GateEntry{type, val};
 //        res_next_proc[key] = proc_value;
 //        res_next_matcher[key] = matcher_value;
 //        res_next_action[key] = action_value;
@@ -87,137 +208,23 @@ public:
 
     void clear_res_next() {
         res_next.clear();
+        rebuild_res_tbl();
 //        res_next_proc.clear();
 //        res_next_matcher.clear();
 //        res_next_action.clear();
     }
 
-    static uint32_t get_value(GateParam param, PHV * phv) {
-        uint32_t res = 0;
-        LOG(INFO) << "              param type(const, header, field):" << (int)param.type;
-        switch(param.type) {
-            case ParameterType::FIELD : {
-                LOG(INFO) << "                  field type(field, valid, hit, miss): " << (int)param.field.fd_type;
-                switch(param.field.fd_type) {
-                    case FieldType::VALID : {
-                        res = phv->valid_bitmap[param.field.hdr_id];
-                        LOG(INFO) << "                  value: " << res;
-                        return res;
-                    }
-                    case FieldType::HIT : {
-                        res = phv->hit;
-                        return res;
-                    }
-                    case FieldType::MISS : {
-                        res = ~(phv->hit);
-                        return res;
-                    }
-                    default:
-                        break;
-                }
-                auto hi = phv->parsed_headers[param.field.hdr_id];
-                int begin = hi->hdr_offset + param.field.internal_offset;
-                int end = begin + param.field.fd_len;
-
-                int begin_offset = begin % 8;
-                int end_offset = end % 8;
-
-                int byte_start = begin / 8;
-                int byte_end = end / 8 - (end_offset == 0 ? 1 : 0);
-
-                int temp = end_offset == 0 ? 8 : end_offset;
-
-                int offset = 0;
-                if(byte_start == byte_end) {
-                    uint8_t mid = uint8_t(phv->packet[byte_start] << begin_offset) >> begin_offset;
-                    mid = mid >> (8 - temp);
-                    res += mid;
-                } else {
-                    for(int i = byte_end; i >= byte_start; i--) {
-                        if(i == byte_end){
-                            res += (phv->packet[i] >> (8 - temp));
-                            offset += temp;
-                            continue;
-                        }
-                        if(i == byte_start) {
-                            res += uint32_t(uint8_t(phv->packet[i] << begin_offset) >> begin_offset) << offset;
-                            continue;
-                        }
-                        if(i != byte_end && i != byte_start){
-                            res += (uint32_t)phv->packet[i] << offset;
-                            offset += 8;
-                        }
-                    }
-                }
-
-                break;
-            }
-            case ParameterType::CONSTANT : {
-                int len = param.constant_data.data_len;
-                int byte_len = len / 8 + (len % 8 == 0 ? 0 : 1);
-                uint8_t * data = param.constant_data.val;
-                for(int i = 0; i < byte_len; i++) {
-                    LOG(INFO) << "                  val[" << i << "]: " << (int)data[i];
-                }
-                int offset = 0;
-                for(int i = byte_len - 1; i >= 0; i--) {
-                    res += ((uint32_t)data[i] << offset);
-                    offset += 8;
-                }
-                LOG(INFO) << "                  value: " << res;
-            }
-            default:
-                break;
-        }
-        return res;
-    }
-
-    void execute(PHV * phv) {
+    // read-only on the gateway itself: the relation bitmap is per packet
+    void execute(PHV * phv) const {
         LOG(INFO) << "  Gateway:";
-        for(int i = 0; i < exps.size(); i++) {
-            LOG(INFO) << "      expr " << i;
-            LOG(INFO) << "          left: ";
-            uint32_t res1 = get_value(exps[i]->param1, phv);
-            LOG(INFO) << "          right: ";
-            uint32_t res2 = get_value(exps[i]->param2, phv);
-            LOG(INFO) << "          relation(> >= < <= == !=): " << (int)exps[i]->relation;
-            switch(exps[i]->relation) {
-                case RelationCode::GT : {
-                    bitmap += uint8_t(uint8_t(res1 > res2) << i);
-                    break;
-                }
-                case RelationCode::GTE : {
-                    bitmap += uint8_t(uint8_t(res1 >= res2) << i);
-                    break;
-                }
-                case RelationCode::LT : {
-                    bitmap += uint8_t(uint8_t(res1 < res2) << i);
-                    break;
-                }
-                case RelationCode::LTE : {
-                    bitmap += uint8_t(uint8_t(res1 <= res2) << i);
-                    break;
-                }
-                case RelationCode::EQ : {
-                    bitmap += uint8_t(uint8_t(res1 == res2) << i);
-                    break;
-                }
-                case RelationCode::NEQ : {
-                    bitmap += uint8_t(uint8_t(res1 != res2) << i);
-                    break;
-                }
-                default:
-                    break;
-            }
+        uint8_t bitmap = 0;
+        for(size_t i = 0; i < rels.size(); i++) {
+            bitmap |= uint8_t(rels[i].eval(phv) << i);
         }
         LOG(INFO) << "      bitmap is: " << (int)bitmap;
         // determine the matcher_id or next_stage_id
 //        std::cout << (int)bitmap << std::endl;
-        if(res_next.find(bitmap)== res_next.end()) {
-            phv->next_op = this->default_entry;
-        } else {
-            phv->next_op = res_next[bitmap];
-        }
+        phv->next_op = res_tbl[bitmap];
         LOG(INFO) << "      next_op: ";
         LOG(INFO) << "          type(table, stage): " << (int)phv->next_op.type;
         LOG(INFO) << "          value: " << (int)phv->next_op.val;
@@ -226,7 +233,6 @@ public:
 //        phv->next_action_id = res_next_action[bitmap];
 //        std::cout << phv->next_proc_id << std::endl;
 //        std::cout << phv->next_matcher_id << std::endl;
-        bitmap = 0;
     }
 
 };
@@ -5,6 +5,7 @@
 #ifndef RECONF_SWITCH_IPSA_GLOBAL_H
 #define RECONF_SWITCH_IPSA_GLOBAL_H
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
@@ -135,12 +136,24 @@ struct Global {
     int num_if;
     Sram * srams[SRAM_NUM_ALL];
     Tcam * tcams[TCAM_NUM_ALL];
+    // bumped after every config change, flow cache entries of an older epoch are stale
+    std::atomic<uint64_t> config_epoch{0};
 
     Global(){};
 };
 
 extern Global glb;
 
+/**
+ * the SRAM and TCAM blocks of one cluster, apart from the physical ones in glb. a processor that a config
+ * transaction replaces gets its own, so its tables are filled while the processor it replaces still
+ * serves packets from the old blocks
+ */
+struct ClusterMemory {
+    Sram srams[SRAM_NUM_PER_CLUSTER];
+    Tcam tcams[TCAM_NUM_PER_CLUSTER];
+};
+
 //struct ActionParam {
 //    int action_para_len;
 ////    bool if_sign;
@@ -0,0 +1,203 @@
+//
+// Longest prefix match over the rows of an LPM table.
+//
+
+#ifndef RECONF_SWITCH_IPSA_LPM_TRIE_H
+#define RECONF_SWITCH_IPSA_LPM_TRIE_H
+
+#include <algorithm>
+#include <vector>
+
+#include "defs.h"
+
+/**
+ * multibit trie, one key byte per level. a prefix of length L lives in the node at depth (L - 1) / 8
+ * and is expanded over the 2^(8 - r) slots its last r bits cover there; each slot keeps the longest
+ * prefix of its node covering it. a lookup walks one node per key byte, remembering the last slot
+ * that had a prefix, so it costs at most key length byte steps whatever the number of prefixes.
+ * the rows themselves (key, mask, value) stay in the TCAM/SRAM slices, only the index lives here.
+ */
+class LpmTrie {
+    struct Prefix {
+        uint8_t base; // first slot covered
+        uint8_t bits; // prefix bits within this node, 0 (root only, the default route) to 8
+        int row;
+    };
+
+    struct Node {
+        int row[256];
+        int8_t bits[256]; // bits of the prefix in row[], -1 if none
+        int child[256];
+        std::vector<Prefix> prefixes;
+
+        Node() {
+            for(int i = 0; i < 256; i++) {
+                row[i] = -1;
+                bits[i] = -1;
+                child[i] = -1;
+            }
+        }
+    };
+
+    int key_len = 0;
+    std::vector<Node> nodes;
+
+    // node of the prefix, created on the way if create; -1 if missing
+    int prefix_node(const uint8_t * key, int plen, bool create) {
+        int depth = plen == 0 ? 0 : (plen - 1) / 8;
+        int n = 0;
+        for(int d = 0; d < depth; d++) {
+            int next = nodes[n].child[key[d]];
+            if(next < 0) {
+                if(!create) {
+                    return -1;
+                }
+                next = (int) nodes.size();
+                nodes.emplace_back();
+                nodes[n].child[key[d]] = next;
+            }
+            n = next;
+        }
+        return n;
+    }
+
+    static void prefix_in_node(const uint8_t * key, int plen, uint8_t & base, uint8_t & bits) {
+        int depth = plen == 0 ? 0 : (plen - 1) / 8;
+        bits = (uint8_t)(plen - depth * 8);
+        uint8_t m = bits == 0 ? 0 : (uint8_t)(0xff << (8 - bits));
+        base = key[depth] & m;
+    }
+
+    void refresh(Node & node, uint8_t base, uint8_t bits) {
+        int span = 1 << (8 - bits);
+        for(int s = base; s < base + span; s++) {
+            node.row[s] = -1;
+            node.bits[s] = -1;
+        }
+        for(auto & p : node.prefixes) {
+            int pspan = 1 << (8 - p.bits);
+            int lo = std::max<int>(p.base, base), hi = std::min(p.base + pspan, base + span);
+            for(int s = lo; s < hi; s++) {
+                if(p.bits > node.bits[s]) {
+                    node.row[s] = p.row;
+                    node.bits[s] = p.bits;
+                }
+            }
+        }
+    }
+
+public:
+    LpmTrie() {
+        reset(0);
+    }
+
+    void reset(int _key_len) {
+        key_len = _key_len;
+        nodes.clear();
+        nodes.emplace_back();
+    }
+
+    int get_key_len() const {
+        return key_len;
+    }
+
+    bool empty() const {
+        return nodes.size() == 1 && nodes[0].prefixes.empty();
+    }
+
+    // prefix length of mask, -1 if it is not a prefix
+    static int prefix_len(const uint8_t * mask, int len) {
+        int plen = 0;
+        int i = 0;
+        for(; i < len && mask[i] == 0xff; i++) {
+            plen += 8;
+        }
+        if(i < len) {
+            uint8_t m = mask[i];
+            while(m & 0x80) {
+                plen++;
+                m <<= 1;
+            }
+            if(m != 0) {
+                return -1;
+            }
+            for(i++; i < len; i++) {
+                if(mask[i] != 0) {
+                    return -1;
+                }
+            }
+        }
+        return plen;
+    }
+
+    // row of exactly this prefix, -1 if it is not installed
+    int find(const uint8_t * key, int plen) {
+        int n = prefix_node(key, plen, false);
+        if(n < 0) {
+            return -1;
+        }
+        uint8_t base, bits;
+        prefix_in_node(key, plen, base, bits);
+        for(auto & p : nodes[n].prefixes) {
+            if(p.base == base && p.bits == bits) {
+                return p.row;
+            }
+        }
+        return -1;
+    }
+
+    // install key/plen at row, replacing the row of the same prefix if there is one
+    void insert(const uint8_t * key, int plen, int row) {
+        int n = prefix_node(key, plen, true);
+        uint8_t base, bits;
+        prefix_in_node(key, plen, base, bits);
+        auto & node = nodes[n];
+        bool found = false;
+        for(auto & p : node.prefixes) {
+            if(p.base == base && p.bits == bits) {
+                p.row = row;
+                found = true;
+            }
+        }
+        if(!found) {
+            node.prefixes.push_back(Prefix{base, bits, row});
+        }
+        refresh(node, base, bits);
+    }
+
+    // row the prefix had, -1 if it was not installed
+    int remove(const uint8_t * key, int plen) {
+        int n = prefix_node(key, plen, false);
+        if(n < 0) {
+            return -1;
+        }
+        uint8_t base, bits;
+        prefix_in_node(key, plen, base, bits);
+        auto & node = nodes[n];
+        for(size_t i = 0; i < node.prefixes.size(); i++) {
+            if(node.prefixes[i].base == base && node.prefixes[i].bits == bits) {
+                int row = node.prefixes[i].row;
+                node.prefixes.erase(node.prefixes.begin() + i);
+                refresh(node, base, bits);
+                return row;
+            }
+        }
+        return -1;
+    }
+
+    // row of the longest prefix of key (key_len bytes), -1 if none
+    int lookup(const uint8_t * key) const {
+        int best = -1;
+        int n = 0;
+        for(int d = 0; d < key_len && n >= 0; d++) {
+            auto & node = nodes[n];
+            if(node.row[key[d]] >= 0) {
+                best = node.row[key[d]];
+            }
+            n = node.child[key[d]];
+        }
+        return best;
+    }
+};
+
+#endif //RECONF_SWITCH_IPSA_LPM_TRIE_H
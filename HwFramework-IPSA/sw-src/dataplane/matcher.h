@@ -167,7 +167,7 @@ public:
 
     KeyInfo* get_field(FieldInfo * fd, PHV * phv) {
         // All of the keys should be aligned forward, otherwise it is resource-consuming and error-prone, though it is complex work
-        LEN hdr_offset = phv->parsed_headers[fd->hdr_id]->hdr_offset;
+        LEN hdr_offset = phv->parsed_headers[fd->hdr_id].hdr_offset;
 
         int begin = (hdr_offset + fd->internal_offset) / 8;
         int end = (hdr_offset + fd->internal_offset + fd->fd_len) / 8; // + ((fd->internal_offset + fd->fd_len) % 8 == 0 ? 0 : 1);
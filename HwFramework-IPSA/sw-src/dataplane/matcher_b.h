@@ -157,7 +157,7 @@ public:
     }
 
     static KeyInfo * get_field(FieldInfo * fd, PHV * phv) {
-        LEN hdr_offset = phv->parsed_headers[fd->hdr_id]->hdr_offset;
+        LEN hdr_offset = phv->parsed_headers[fd->hdr_id].hdr_offset;
 
         int begin_idx = hdr_offset + fd->internal_offset;
         int end_idx = begin_idx + fd->fd_len - 1;
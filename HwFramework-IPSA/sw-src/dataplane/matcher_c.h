@@ -6,9 +6,17 @@
 #define RECONF_SWITCH_IPSA_MATCHER_B_H
 
 #include "global.h"
+#include "field_access.h"
+#include "flow_cache.h"
+#include "tuple_space.h"
+#include "lpm_trie.h"
+#include "ternary_scan.h"
+#include "table_seqlock.h"
+#include "../util/MurmurHash3.h"
 
 #include <utility>
 #include <vector>
+#include <algorithm>
 #include <functional>
 #include <unordered_map>
 
@@ -29,6 +37,73 @@ enum class MatchType {
     EXACT, TERNARY, LPM
 };
 
+// rows per bucket of the exact match table; a key may sit in any row of either of its two buckets
+const static int EXACT_BUCKET_WAYS = 4;
+// entries kept aside when cuckoo displacement finds no free row
+const static int EXACT_STASH_SIZE = 8;
+// rows visited by the displacement search before the insert goes to the stash
+const static int EXACT_MAX_SEARCH = 512;
+const static uint32_t EXACT_HASH_SEED1 = 0x9747b28c;
+const static uint32_t EXACT_HASH_SEED2 = 0x5bd1e995;
+// a ternary lookup scans all rows instead of probing the tuples once rows * key words is at most this many
+// times the number of tuples; one hash probe costs about as much as scanning 64 row words with AVX2
+const static int TERNARY_SCAN_RATIO = 64;
+// longest packed match key, every slice of a cluster, plus a word of zero padding for the ternary scan
+const static int MATCH_KEY_MAX = SRAM_NUM_PER_CLUSTER * SRAM_WIDTH / 8 + 8;
+
+// one instruction of a compiled key builder: put the field at dst_bit of the packed key
+struct KeyStep {
+    FieldAccessor acc;
+    uint32_t dst_bit;
+};
+
+/**
+ * which rows of a table hold an entry. a row is in use while its tag equals the current generation, so
+ * emptying the table is one increment however many rows it has; the memory behind the rows is not
+ * touched, a row is rewritten whole when it is next taken
+ */
+class RowTags {
+    std::vector<uint32_t> tags;
+    uint32_t gen = 1;
+    int rows = 0;
+
+public:
+    // forget every row and size the table to n rows
+    void reset(int n) {
+        if(++gen == 0) {
+            // wrapped, tags of the old generations could come back to life
+            std::fill(tags.begin(), tags.end(), 0);
+            gen = 1;
+        }
+        if((int) tags.size() < n) {
+            tags.resize(n, 0);
+        }
+        rows = n;
+    }
+
+    int size() const {
+        return rows;
+    }
+
+    bool used(int row) const {
+        return tags[row] == gen;
+    }
+
+    void set(int row) {
+        tags[row] = gen;
+    }
+
+    void clear(int row) {
+        tags[row] = 0;
+    }
+};
+
+struct ExactTableStats {
+    int occupancy = 0; // entries, stash included
+    int capacity = 0; // rows over all configured slices
+    int stash_used = 0;
+};
+
 class MatcherThread {
 public:
     Sram * sram[SRAM_NUM_PER_CLUSTER];
@@ -60,9 +135,34 @@ public:
     int proc_id;
     MatchType match_type = MatchType::EXACT;
     std::vector<FieldInfo*> fdInfos;
+    // compiled from fdInfos by set_field_info, builds the packed match key of a packet
+    std::vector<KeyStep> key_prog;
 
     int tcam_idx = 0;
 
+    // exact match: two-choice, EXACT_BUCKET_WAYS-way cuckoo hashing over the rows of all key slices.
+    // row r lives in slice r / SRAM rows, at that row of each of the slice's key and value SRAMs
+    RowTags row_used;
+    int exact_entries = 0;
+    // bytes of the key that are hashed and compared, the match key length once fields are set
+    int match_key_len = 0;
+    struct StashEntry {
+        std::vector<uint8_t> key;
+        std::vector<uint8_t> value;
+    };
+    std::vector<StashEntry> stash;
+
+    // ternary and lpm: row i is the i-th entry installed, its key and mask in the TCAM slices, value in the
+    // SRAM ones. tss indexes ternary rows by install order, lpm indexes lpm rows by prefix length
+    TupleSpace tss;
+    TernaryScan tscan; // the same ternary rows, packed for a linear scan when masks are too many for tss
+    LpmTrie lpm;
+    // ternary and lpm rows holding an entry. a deleted lpm row goes to tcam_free for the next new prefix.
+    // the install order is a ternary row's priority, so its free rows are only taken back by
+    // compact_tcam_rows() once the slices run out, or at the tail right away
+    RowTags tcam_used;
+    std::vector<int> tcam_free;
+
     // no condition satisfied: default processor
     // action: goto
 //    int miss_action_id = -1;
@@ -70,19 +170,59 @@ public:
 //    int hit_act_id = -1;
     int miss_act_id = -1;
 
-    MatcherThread(int _proc_id) {
+    // entry inserts, modifies and deletes against the lookups of the packet threads
+    TableSeqLock entry_lock;
+
+    // the blocks sram and tcam point into; nullptr for the cluster's physical blocks in glb
+    std::shared_ptr<ClusterMemory> mem;
+
+    MatcherThread(int _proc_id, std::shared_ptr<ClusterMemory> _mem = nullptr) : mem(std::move(_mem)) {
         this->proc_id = _proc_id;
         this->no_table = true;
+        bind_memory();
+
+        depth.sram_slice_depth = 0;
+        key_width.sram_slice_key_width = 0;
+    }
+
+    // point sram and tcam at the blocks the tables live in
+    void bind_memory() {
+        int cluster = proc_id / PROC_NUM_PER_CLUSTER;
         for(int i = 0; i < SRAM_NUM_PER_CLUSTER; i++) {
-            sram[i] = glb.srams[proc_id / PROC_NUM_PER_CLUSTER * SRAM_IDX_BASE + i];
+            sram[i] = mem != nullptr ? &mem->srams[i] : glb.srams[cluster * SRAM_IDX_BASE + i];
         }
-
         for(int i = 0; i < TCAM_NUM_PER_CLUSTER; i++) {
-            tcam[i] = glb.tcams[proc_id / PROC_NUM_PER_CLUSTER * TCAM_IDX_BASE + i];
+            tcam[i] = mem != nullptr ? &mem->tcams[i] : glb.tcams[cluster * TCAM_IDX_BASE + i];
         }
+    }
 
-        depth.sram_slice_depth = 0;
-        key_width.sram_slice_key_width = 0;
+    /**
+     * other's config and the indexes of its entries; the rows themselves are copied with the memory, see
+     * Matcher::copy_from. sram, tcam and mem stay as they are
+     */
+    void copy_from(const MatcherThread & other) {
+        action_proc_map = other.action_proc_map;
+        no_table = other.no_table;
+        key_config = other.key_config;
+        memcpy(sram_value_config, other.sram_value_config, sizeof(sram_value_config));
+        key_width = other.key_width;
+        sram_slice_value_width = other.sram_slice_value_width;
+        depth = other.depth;
+        proc_id = other.proc_id;
+        match_type = other.match_type;
+        fdInfos = other.fdInfos;
+        key_prog = other.key_prog;
+        tcam_idx = other.tcam_idx;
+        row_used = other.row_used;
+        exact_entries = other.exact_entries;
+        match_key_len = other.match_key_len;
+        stash = other.stash;
+        tss = other.tss;
+        tscan.copy_from(other.tscan);
+        lpm = other.lpm;
+        tcam_used = other.tcam_used;
+        tcam_free = other.tcam_free;
+        miss_act_id = other.miss_act_id;
     }
 
     void set_action_proc_map(const std::unordered_map<int, int>& _action_proc_map) {
@@ -103,27 +243,15 @@ public:
 //        std::cout << "set_mem_config in 8" << std::endl;
         LOG(INFO) << "  clear fd_infos";
         fdInfos.clear();
+        key_prog.clear();
+        match_key_len = 0;
         LOG(INFO) << "  clear action_proc_map";
         action_proc_map.clear();
         miss_act_id = -1;
 //        hit_act_id = -1;
 
         if(match_type == MatchType::EXACT) {
-            // clear key sram
-//            std::cout << "sram_slice_key_width: " << key_width.sram_slice_key_width << std::endl;
-//            std::cout << "depth.sram_slice_depth: " << depth.sram_slice_depth << std::endl;
-            for(int i = 0; i < key_width.sram_slice_key_width * depth.sram_slice_depth; i++) {
-                memset(sram[key_config.sram_key_config[i]]->tbl, 0, PHYSICAL_SRAM_CAPACITY / 8 * sizeof(uint8_t));
-            }
-            LOG(INFO) << "  key sram cleared";
-            // clear value sram
-//            std::cout << "sram_slice_value_width: " << sram_slice_value_width << std::endl;
-//            std::cout << "depth.sram_slice_depth: " << depth.sram_slice_depth << std::endl;
-
-            for(int i = 0; i < sram_slice_value_width * depth.sram_slice_depth; i++) {
-                memset(sram[sram_value_config[i]]->tbl, 0, PHYSICAL_SRAM_CAPACITY / 8 * sizeof(uint8_t));
-            }
-            LOG(INFO) << "  value sram cleared";
+            // the key and value srams keep their old rows, row_used no longer counts them
             memset(key_config.sram_key_config, 0, SRAM_NUM_PER_CLUSTER * sizeof(uint8_t));
             LOG(INFO) << "  key config cleared";
             memset(sram_value_config, 0, SRAM_NUM_PER_CLUSTER * sizeof(uint8_t));
@@ -131,26 +259,23 @@ public:
             key_width.sram_slice_key_width = 0;
             sram_slice_value_width = 0;
             depth.sram_slice_depth = 0;
+            row_used.reset(0);
+            exact_entries = 0;
+            stash.clear();
         } else {
-            // clear key tcam
-            for(int i = 0; i < key_width.tcam_slice_key_width * depth.tcam_slice_depth; i++) {
-                memset(tcam[key_config.tcam_key_config[i]]->tbl, 0, PHYSICAL_TCAM_CAPACITY / 8 * sizeof(uint8_t));
-            }
-            // clear key mask
-            for(int i = 0; i < key_width.tcam_slice_key_width * depth.tcam_slice_depth; i++) {
-                memset(tcam[key_config.tcam_key_config[i]]->mask, 0, PHYSICAL_TCAM_CAPACITY / 8 * sizeof(uint8_t));
-            }
-            // clear value sram
-            for(int i = 0; i < sram_slice_value_width * depth.tcam_slice_depth; i++) {
-                memset(sram[sram_value_config[i]]->tbl, 0, PHYSICAL_TCAM_CAPACITY / 8 * sizeof(uint8_t));
-            }
+            // likewise the key/mask tcams and value srams, tcam_used no longer counts their rows
             memset(key_config.tcam_key_config, 0, TCAM_NUM_PER_CLUSTER * sizeof(uint8_t));
             memset(sram_value_config, 0, TCAM_NUM_PER_CLUSTER * sizeof(uint8_t));
 
             key_width.tcam_slice_key_width = 0;
             sram_slice_value_width = 0;
             depth.tcam_slice_depth = 0;
+            tcam_used.reset(0);
             tcam_idx = 0;
+            tss.reset(0);
+            tscan.reset(0);
+            lpm.reset(0);
+            tcam_free.clear();
         }
     }
 
@@ -185,10 +310,11 @@ public:
                 LOG(INFO) << "      " << (int)_value_config[i];
             }
 
-            // pointer to the global memory every time
-            for(int i = 0; i < SRAM_NUM_PER_CLUSTER; i++) {
-                sram[i] = glb.srams[proc_id / PROC_NUM_PER_CLUSTER * SRAM_IDX_BASE + i];
-            }
+            bind_memory();
+
+            row_used.reset(_depth * (1 << SRAM_DEPTH));
+            exact_entries = 0;
+            stash.clear();
         } else {
             key_width.tcam_slice_key_width = _key_width;
             sram_slice_value_width = _value_width;
@@ -201,13 +327,13 @@ public:
                 sram_value_config[i] = _value_config[i];
             }
 
-            for(int i = 0; i < TCAM_NUM_PER_CLUSTER; i++) {
-                tcam[i] = glb.tcams[proc_id / PROC_NUM_PER_CLUSTER * TCAM_IDX_BASE + i];
-            }
-
-            for(int i = 0; i < SRAM_NUM_PER_CLUSTER; i++) {
-                sram[i] = glb.srams[proc_id / PROC_NUM_PER_CLUSTER * SRAM_IDX_BASE + i];
-            }
+            bind_memory();
+            tcam_used.reset(_depth * (1 << TCAM_DEPTH));
+            tcam_idx = 0;
+            tss.reset(0);
+            tscan.reset(0);
+            lpm.reset(0);
+            tcam_free.clear();
         }
     }
 
@@ -221,99 +347,491 @@ public:
 
     void set_field_info(std::vector<FieldInfo*> _fdInfos) {
         fdInfos = std::move(_fdInfos);
+        key_prog.clear();
+        int key_bits = 0;
         LOG(INFO) << "      in matcher field: ";
         for(auto it : fdInfos){
+            FieldAccessor acc(*it);
+            if(key_bits + acc.key_bits() > (MATCH_KEY_MAX - 8) * 8) {
+                LOG(ERROR) << "          match key longer than " << MATCH_KEY_MAX - 8 << " bytes, field dropped";
+                break;
+            }
+            key_prog.push_back(KeyStep{acc, (uint32_t) key_bits});
+            key_bits += acc.key_bits();
             LOG(INFO) << "          header id: " << (int)it->hdr_id;
             LOG(INFO) << "          internal offset: " << (int)it->internal_offset;
             LOG(INFO) << "          field length: " << (int)it->fd_len;
             LOG(INFO) << "          field type: " << (int)it->fd_type;
         }
+        match_key_len = (key_bits + 7) / 8;
 //        std::cout << "set field info ok!" << std::endl;
     }
 
-    // key should be aligned to SRAM width
-    void insert_sram_entry(uint8_t * key, uint8_t * value, int key_byte_len, int value_byte_len) {
-        LOG(INFO) << "Insert SRAM entry: ";
-        LOG(INFO) << "  key_byte_len: " << key_byte_len;
-        LOG(INFO) << "  key: ";
-        uint16_t key_sum = 0;
-        for(int i = 0; i < key_byte_len; i++) {
-            key_sum += key[i];
-            LOG(INFO) << "      " << (int)key[i];
+    /*********** exact match table ************/
+    int exact_rows() const {
+        return (int) row_used.size();
+    }
+
+    int match_key_bytes(int key_byte_len) const {
+        int len = match_key_len > 0 ? std::min(match_key_len, key_byte_len) : key_byte_len;
+        int width = match_type == MatchType::EXACT ? SRAM_WIDTH : TCAM_WIDTH;
+        return std::min(len, key_width.sram_slice_key_width * width / 8);
+    }
+
+    void exact_buckets(const uint8_t * key, int len, int & b1, int & b2) const {
+        int buckets = exact_rows() / EXACT_BUCKET_WAYS;
+        uint32_t h1 = 0, h2 = 0;
+        MurmurHash3_x86_32(key, len, EXACT_HASH_SEED1, &h1);
+        MurmurHash3_x86_32(key, len, EXACT_HASH_SEED2, &h2);
+        b1 = (int)(h1 % buckets);
+        b2 = (int)(h2 % buckets);
+        if(b2 == b1 && buckets > 1) {
+            b2 = (b1 + 1) % buckets;
         }
-        int slice_idx = key_sum % depth.sram_slice_depth;
-        int idx = key_sum % (1 << SRAM_DEPTH);
-        LOG(INFO) << "  key index is: " << idx;
+    }
 
-        LOG(INFO) << "  value_byte_len: " << value_byte_len;
-        LOG(INFO) << "  value: ";
-        for(int i = 0; i < value_byte_len; i++) {
-            LOG(INFO) << "      " << (int)value[i];
+    uint8_t * key_row(int row, int i) const {
+        int slice = row >> SRAM_DEPTH;
+        int r = row & ((1 << SRAM_DEPTH) - 1);
+        return sram[key_config.sram_key_config[slice + depth.sram_slice_depth * i]]->tbl + r * SRAM_WIDTH / 8;
+    }
+
+    uint8_t * value_row(int row, int i) const {
+        int slice = row >> SRAM_DEPTH;
+        int r = row & ((1 << SRAM_DEPTH) - 1);
+        return sram[sram_value_config[slice + depth.sram_slice_depth * i]]->tbl + r * SRAM_WIDTH / 8;
+    }
+
+    // the key is stored left aligned over the key SRAMs of the row's slice
+    bool row_key_equals(int row, const uint8_t * key, int len) const {
+        for(int i = 0; len > 0; i++, len -= SRAM_WIDTH / 8) {
+            if(memcmp(key_row(row, i), key + i * SRAM_WIDTH / 8, std::min(len, SRAM_WIDTH / 8)) != 0) {
+                return false;
+            }
         }
+        return true;
+    }
 
-        // determine the sram key sequence
-        auto sram_key_seq = new uint8_t[key_width.sram_slice_key_width];
-        auto sram_value_seq = new uint8_t[sram_slice_value_width];
-        for(int i = 0; i < key_width.sram_slice_key_width; i++) {
-            sram_key_seq[i] = key_config.sram_key_config[slice_idx + depth.sram_slice_depth * i];
+    void read_row_key(int row, uint8_t * key, int len) const {
+        for(int i = 0; len > 0; i++, len -= SRAM_WIDTH / 8) {
+            memcpy(key + i * SRAM_WIDTH / 8, key_row(row, i), std::min(len, SRAM_WIDTH / 8));
         }
+    }
+
+    // the value of an exact, ternary or lpm row, left aligned over its value SRAMs
+    void write_value(int row, const uint8_t * value, int value_byte_len) {
         for(int i = 0; i < sram_slice_value_width; i++) {
-            sram_value_seq[i] = sram_value_config[slice_idx + depth.sram_slice_depth * i];
+            int offset = std::max(0, std::min(value_byte_len - i * SRAM_WIDTH / 8, SRAM_WIDTH / 8));
+            memset(value_row(row, i), 0, SRAM_WIDTH / 8);
+            memcpy(value_row(row, i), value + i * SRAM_WIDTH / 8, offset);
         }
+    }
+
+    void write_row(int row, const uint8_t * key, int key_byte_len, const uint8_t * value, int value_byte_len) {
+        for(int i = 0; i < key_width.sram_slice_key_width; i++) {
+            int offset = std::max(0, std::min(key_byte_len - i * SRAM_WIDTH / 8, SRAM_WIDTH / 8));
+            memset(key_row(row, i), 0, SRAM_WIDTH / 8);
+            memcpy(key_row(row, i), key + i * SRAM_WIDTH / 8, offset);
+        }
+        write_value(row, value, value_byte_len);
+        row_used.set(row);
+    }
 
-        // key should be SRAM_WIDTH-aligned
-        // should be right-aligned?
+    void clear_row(int row) {
         for(int i = 0; i < key_width.sram_slice_key_width; i++) {
-            int offset = (key_byte_len - i * SRAM_WIDTH / 8) >= SRAM_WIDTH / 8 ? SRAM_WIDTH / 8 : (key_byte_len - i * SRAM_WIDTH / 8);
-            // assign the entry at the left of the SRAM
-            memcpy(sram[sram_key_seq[i]]->tbl + (idx * SRAM_WIDTH / 8), key + i * SRAM_WIDTH / 8 , offset);
-            // assign the entry at the right of the SRAM
-//            memcpy(sram[sram_key_seq[i]]->tbl + (idx * SRAM_WIDTH / 8) + (SRAM_WIDTH / 8 - offset), key + i * SRAM_WIDTH / 8 , offset);
+            memset(key_row(row, i), 0, SRAM_WIDTH / 8);
+        }
+        for(int i = 0; i < sram_slice_value_width; i++) {
+            memset(value_row(row, i), 0, SRAM_WIDTH / 8);
         }
+        row_used.clear(row);
+    }
 
+    void move_row(int from, int to) {
+        for(int i = 0; i < key_width.sram_slice_key_width; i++) {
+            memcpy(key_row(to, i), key_row(from, i), SRAM_WIDTH / 8);
+        }
         for(int i = 0; i < sram_slice_value_width; i++) {
-            int offset = (value_byte_len - i * SRAM_WIDTH / 8) >= SRAM_WIDTH / 8 ? SRAM_WIDTH / 8 : (value_byte_len - i * SRAM_WIDTH / 8);
-            memcpy(sram[sram_value_seq[i]]->tbl + (idx * SRAM_WIDTH / 8), value + i * SRAM_WIDTH / 8 , offset);
-            LOG(INFO) << "  sram value: ";
-            for(int j = 0; j < sram_slice_value_width * SRAM_WIDTH / 8; j++) {
-                LOG(INFO) << "      " << (int)sram[sram_value_seq[i]]->tbl[(idx * SRAM_WIDTH / 8) + j];
+            memcpy(value_row(to, i), value_row(from, i), SRAM_WIDTH / 8);
+        }
+        row_used.set(to);
+        row_used.clear(from);
+    }
+
+    // row holding key, -1 if it is not in the buckets
+    int exact_find(const uint8_t * key, int len) const {
+        int b[2];
+        exact_buckets(key, len, b[0], b[1]);
+        for(int bucket : b) {
+            for(int w = 0; w < EXACT_BUCKET_WAYS; w++) {
+                int row = bucket * EXACT_BUCKET_WAYS + w;
+                if(row_used.used(row) && row_key_equals(row, key, len)) {
+                    return row;
+                }
             }
-//            memcpy(sram[sram_value_seq[i]]->tbl + (idx * SRAM_WIDTH / 8) + (SRAM_WIDTH / 8 - offset), value + i * SRAM_WIDTH / 8 , offset);
         }
+        return -1;
     }
 
-    void insert_tcam_entry(uint8_t * key, uint8_t * mask, uint8_t * value, int key_byte_len, int value_byte_len) {
-        uint16_t key_sum = 0;
-        for(int i = 0; i < key_byte_len; i++) {
-            key_sum += key[i];
+    int exact_stash_find(const uint8_t * key, int len) const {
+        for(size_t i = 0; i < stash.size(); i++) {
+            if(memcmp(stash[i].key.data(), key, len) == 0) {
+                return (int) i;
+            }
         }
-        int slice_idx = key_sum % depth.tcam_slice_depth;
-        int idx = tcam_idx;
+        return -1;
+    }
 
-        // determine the sram key sequence
-        auto tcam_key_seq = new uint8_t[key_width.tcam_slice_key_width];
-        auto sram_value_seq = new uint8_t[sram_slice_value_width];
+    /**
+     * a free row for key, making one by moving entries to their other bucket if needed. breadth first
+     * over the displacement graph, so nothing moves unless a complete path to a free row was found
+     */
+    int exact_make_room(const uint8_t * key, int len) {
+        struct Step {
+            int row;
+            int parent;
+        };
+        std::vector<Step> steps;
+        int b[2];
+        exact_buckets(key, len, b[0], b[1]);
+        for(int bucket : b) {
+            for(int w = 0; w < EXACT_BUCKET_WAYS; w++) {
+                int row = bucket * EXACT_BUCKET_WAYS + w;
+                if(!row_used.used(row)) {
+                    return row;
+                }
+                steps.push_back(Step{row, -1});
+            }
+        }
+        std::vector<uint8_t> victim(len);
+        for(size_t i = 0; i < steps.size() && steps.size() < (size_t)EXACT_MAX_SEARCH; i++) {
+            int row = steps[i].row;
+            read_row_key(row, victim.data(), len);
+            int vb1, vb2;
+            exact_buckets(victim.data(), len, vb1, vb2);
+            int alt = row / EXACT_BUCKET_WAYS == vb1 ? vb2 : vb1;
+            for(int w = 0; w < EXACT_BUCKET_WAYS; w++) {
+                int to = alt * EXACT_BUCKET_WAYS + w;
+                if(!row_used.used(to)) {
+                    // shift every entry on the path one step along, freeing the first row
+                    for(int j = (int)i; j != -1; j = steps[j].parent) {
+                        move_row(steps[j].row, to);
+                        to = steps[j].row;
+                    }
+                    return to;
+                }
+                steps.push_back(Step{to, (int)i});
+            }
+        }
+        return -1;
+    }
+
+    // stash values are kept as wide as the value slices, so a hit can hand out the entry itself
+    void set_stash_value(StashEntry & e, const uint8_t * value, int value_byte_len) const {
+        e.value.assign(sram_slice_value_width * SRAM_WIDTH / 8, 0);
+        memcpy(e.value.data(), value, std::min<size_t>(value_byte_len, e.value.size()));
+    }
+
+    // not under entry_lock, the counts may be a moment old
+    ExactTableStats exact_stats() const {
+        ExactTableStats st;
+        st.occupancy = exact_entries;
+        st.capacity = exact_rows();
+        st.stash_used = (int) stash.size();
+        return st;
+    }
+
+    // key should be aligned to SRAM width; false if the table and its stash are full
+    bool insert_sram_entry(uint8_t * key, uint8_t * value, int key_byte_len, int value_byte_len) {
+        TableWriteGuard guard(entry_lock);
+        LOG(INFO) << "Insert SRAM entry: ";
+        LOG(INFO) << "  key_byte_len: " << key_byte_len;
+        LOG(INFO) << "  value_byte_len: " << value_byte_len;
+        if(exact_rows() == 0) {
+            LOG(ERROR) << "  no sram configured for the table";
+            return false;
+        }
+        int len = match_key_bytes(key_byte_len);
+
+        int row = exact_find(key, len);
+        if(row >= 0) {
+            LOG(INFO) << "  update at row " << row;
+            write_row(row, key, key_byte_len, value, value_byte_len);
+            return true;
+        }
+        int si = exact_stash_find(key, len);
+        if(si >= 0) {
+            LOG(INFO) << "  update in stash " << si;
+            set_stash_value(stash[si], value, value_byte_len);
+            return true;
+        }
+
+        row = exact_make_room(key, len);
+        if(row >= 0) {
+            LOG(INFO) << "  insert at row " << row;
+            write_row(row, key, key_byte_len, value, value_byte_len);
+        } else if(stash.size() < (size_t)EXACT_STASH_SIZE) {
+            LOG(INFO) << "  insert in stash " << stash.size();
+            StashEntry e;
+            e.key.assign(key, key + len);
+            set_stash_value(e, value, value_byte_len);
+            stash.push_back(std::move(e));
+        } else {
+            LOG(WARNING) << "Exact match table full, " << exact_entries << " entries in " << exact_rows() << " rows";
+            return false;
+        }
+        exact_entries++;
+        return true;
+    }
+
+    // false if key is not in the table
+    bool modify_sram_entry(const uint8_t * key, const uint8_t * value, int key_byte_len, int value_byte_len) {
+        TableWriteGuard guard(entry_lock);
+        if(exact_rows() == 0) {
+            return false;
+        }
+        int len = match_key_bytes(key_byte_len);
+        int row = exact_find(key, len);
+        if(row >= 0) {
+            write_value(row, value, value_byte_len);
+            return true;
+        }
+        int si = exact_stash_find(key, len);
+        if(si >= 0) {
+            set_stash_value(stash[si], value, value_byte_len);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * only the entry's own row is cleared. a stash entry that may live in the freed row is moved
+     * there, so the stash drains as the table empties. false if key is not in the table
+     */
+    bool delete_sram_entry(const uint8_t * key, int key_byte_len) {
+        TableWriteGuard guard(entry_lock);
+        if(exact_rows() == 0) {
+            return false;
+        }
+        int len = match_key_bytes(key_byte_len);
+        int row = exact_find(key, len);
+        if(row >= 0) {
+            clear_row(row);
+            exact_entries--;
+            for(size_t i = 0; i < stash.size(); i++) {
+                int b1, b2;
+                exact_buckets(stash[i].key.data(), (int) stash[i].key.size(), b1, b2);
+                if(row / EXACT_BUCKET_WAYS == b1 || row / EXACT_BUCKET_WAYS == b2) {
+                    LOG(INFO) << "  stash entry " << i << " moved to row " << row;
+                    write_row(row, stash[i].key.data(), (int) stash[i].key.size(),
+                              stash[i].value.data(), (int) stash[i].value.size());
+                    stash.erase(stash.begin() + i);
+                    break;
+                }
+            }
+            return true;
+        }
+        int si = exact_stash_find(key, len);
+        if(si >= 0) {
+            stash.erase(stash.begin() + si);
+            exact_entries--;
+            return true;
+        }
+        return false;
+    }
+
+    /*********** ternary table ************/
+    uint8_t * tcam_key_row(int row, int i) const {
+        int slice = row >> TCAM_DEPTH;
+        int r = row & ((1 << TCAM_DEPTH) - 1);
+        return tcam[key_config.tcam_key_config[slice + depth.tcam_slice_depth * i]]->tbl + r * TCAM_WIDTH / 8;
+    }
+
+    uint8_t * tcam_mask_row(int row, int i) const {
+        int slice = row >> TCAM_DEPTH;
+        int r = row & ((1 << TCAM_DEPTH) - 1);
+        return tcam[key_config.tcam_key_config[slice + depth.tcam_slice_depth * i]]->mask + r * TCAM_WIDTH / 8;
+    }
+
+    void clear_tcam_row(int row) {
         for(int i = 0; i < key_width.tcam_slice_key_width; i++) {
-            tcam_key_seq[i] = key_config.tcam_key_config[slice_idx + depth.tcam_slice_depth * i];
+            memset(tcam_key_row(row, i), 0, TCAM_WIDTH / 8);
+            memset(tcam_mask_row(row, i), 0, TCAM_WIDTH / 8);
         }
         for(int i = 0; i < sram_slice_value_width; i++) {
-            sram_value_seq[i] = sram_value_config[slice_idx + depth.tcam_slice_depth * i];
+            memset(value_row(row, i), 0, SRAM_WIDTH / 8);
         }
+    }
 
-        // key should be SRAM_WIDTH-aligned
-        // should be right-aligned?
-        for(int i = 0; i < key_width.tcam_slice_key_width; i++) {
-            int offset = (key_byte_len - i * TCAM_WIDTH / 8) >= TCAM_WIDTH / 8 ? TCAM_WIDTH / 8 : (key_byte_len - i * TCAM_WIDTH / 8);
-            // assign the entry at the left of the SRAM
-            memcpy(tcam[tcam_key_seq[i]]->tbl + (idx * TCAM_WIDTH / 8), key + i * TCAM_WIDTH / 8 , offset);
-            memcpy(tcam[tcam_key_seq[i]]->mask + (idx * TCAM_WIDTH / 8), mask + i * TCAM_WIDTH / 8 , offset);
+    void read_tcam_row(int row, uint8_t * key, uint8_t * mask, int len) const {
+        for(int i = 0; len > 0; i++, len -= TCAM_WIDTH / 8) {
+            memcpy(key + i * TCAM_WIDTH / 8, tcam_key_row(row, i), std::min(len, TCAM_WIDTH / 8));
+            memcpy(mask + i * TCAM_WIDTH / 8, tcam_mask_row(row, i), std::min(len, TCAM_WIDTH / 8));
         }
+    }
 
+    void move_tcam_row(int from, int to) {
+        for(int i = 0; i < key_width.tcam_slice_key_width; i++) {
+            memcpy(tcam_key_row(to, i), tcam_key_row(from, i), TCAM_WIDTH / 8);
+            memcpy(tcam_mask_row(to, i), tcam_mask_row(from, i), TCAM_WIDTH / 8);
+        }
         for(int i = 0; i < sram_slice_value_width; i++) {
-            int offset = (value_byte_len - i * SRAM_WIDTH / 8) >= SRAM_WIDTH / 8 ? SRAM_WIDTH / 8 : (value_byte_len - i * SRAM_WIDTH / 8);
-            memcpy(sram[sram_value_seq[i]]->tbl + (idx * SRAM_WIDTH / 8), value + i * SRAM_WIDTH / 8 , offset);
+            memcpy(value_row(to, i), value_row(from, i), SRAM_WIDTH / 8);
+        }
+        clear_tcam_row(from);
+        tcam_used.set(to);
+        tcam_used.clear(from);
+    }
+
+    /**
+     * ternary only: slide the live rows down over the free ones, keeping their order, and index them
+     * again at their new rows. afterwards every free row is past tcam_idx
+     */
+    void compact_tcam_rows() {
+        int len = tss.get_key_len();
+        tss.reset(len);
+        tscan.reset(len);
+        std::vector<uint8_t> key(len), mask(len);
+        int to = 0;
+        for(int from = 0; from < tcam_idx; from++) {
+            if(!tcam_used.used(from)) {
+                continue;
+            }
+            if(from != to) {
+                move_tcam_row(from, to);
+            }
+            read_tcam_row(to, key.data(), mask.data(), len);
+            tscan.set_row(to, key.data(), mask.data(), len);
+            tss.insert(to, key.data(), mask.data());
+            to++;
+        }
+        LOG(INFO) << "Ternary table compacted, " << tcam_idx - to << " free rows reclaimed";
+        tcam_idx = to;
+    }
+
+    // row of the entry installed with exactly key/mask (len bytes), -1 if none
+    int tcam_find(const uint8_t * key, const uint8_t * mask, int len) {
+        if(match_type == MatchType::LPM) {
+            int plen = LpmTrie::prefix_len(mask, len);
+            if(plen < 0 || lpm.get_key_len() != len) {
+                return -1;
+            }
+            return lpm.find(key, plen);
+        }
+        if(tss.get_key_len() != len) {
+            return -1;
         }
-        tcam_idx++;
+        return tss.find(key, mask);
+    }
+
+    /**
+     * entries take rows in install order. ternary: an earlier entry wins over a later one; lpm: the longest
+     * prefix wins and reinstalling a prefix overwrites its row. false if the slices are full, the key length
+     * differs from the table's or, for lpm, the mask is not a prefix; nothing is written then
+     */
+    bool insert_tcam_entry(uint8_t * key, uint8_t * mask, uint8_t * value, int key_byte_len, int value_byte_len) {
+        TableWriteGuard guard(entry_lock);
+        int len = match_key_bytes(key_byte_len);
+        int plen = -1;
+        int row = tcam_idx;
+        bool reused = false;
+        if(match_type == MatchType::LPM) {
+            plen = LpmTrie::prefix_len(mask, len);
+            if(plen < 0) {
+                LOG(ERROR) << "LPM entry mask is not a prefix";
+                return false;
+            }
+            if(lpm.empty()) {
+                lpm.reset(len);
+            } else if(lpm.get_key_len() != len) {
+                LOG(ERROR) << "LPM entry key length " << len << " differs from the table's " << lpm.get_key_len();
+                return false;
+            }
+            int old = lpm.find(key, plen);
+            if(old >= 0) {
+                row = old;
+            } else if(!tcam_free.empty()) {
+                row = tcam_free.back();
+                reused = true;
+            }
+        } else if(tcam_idx == 0) {
+            tss.reset(len);
+            tscan.reset(len);
+        } else if(tss.get_key_len() != len) {
+            LOG(ERROR) << "Ternary entry key length " << len << " differs from the table's " << tss.get_key_len();
+            return false;
+        } else if(row >= depth.tcam_slice_depth * (1 << TCAM_DEPTH)) {
+            compact_tcam_rows();
+            row = tcam_idx;
+        }
+        if(row >= depth.tcam_slice_depth * (1 << TCAM_DEPTH)) {
+            LOG(WARNING) << "Ternary table full, " << row << " entries";
+            return false;
+        }
+
+        for(int i = 0; i < key_width.tcam_slice_key_width; i++) {
+            int offset = std::max(0, std::min(key_byte_len - i * TCAM_WIDTH / 8, TCAM_WIDTH / 8));
+            // assign the entry at the left of the TCAM, the rest of the row may hold an old table's bytes
+            memset(tcam_key_row(row, i), 0, TCAM_WIDTH / 8);
+            memset(tcam_mask_row(row, i), 0, TCAM_WIDTH / 8);
+            memcpy(tcam_key_row(row, i), key + i * TCAM_WIDTH / 8, offset);
+            memcpy(tcam_mask_row(row, i), mask + i * TCAM_WIDTH / 8, offset);
+        }
+        write_value(row, value, value_byte_len);
+        tcam_used.set(row);
+        if(reused) {
+            tcam_free.pop_back();
+        } else if(row == tcam_idx) {
+            tcam_idx++;
+        }
+
+        if(match_type == MatchType::LPM) {
+            lpm.insert(key, plen, row);
+            return true;
+        }
+        tscan.set_row(row, key, mask, len);
+        if(!tss.insert(row, key, mask)) {
+            LOG(WARNING) << "Ternary entry at row " << row << " has key bits outside its mask, it never matches";
+        }
+        return true;
+    }
+
+    // false if no entry was installed with exactly key/mask
+    bool modify_tcam_entry(const uint8_t * key, const uint8_t * mask, const uint8_t * value, int key_byte_len,
+                           int value_byte_len) {
+        TableWriteGuard guard(entry_lock);
+        int row = tcam_find(key, mask, match_key_bytes(key_byte_len));
+        if(row < 0) {
+            return false;
+        }
+        write_value(row, value, value_byte_len);
+        return true;
+    }
+
+    // only the entry's own row is cleared; false if no entry was installed with exactly key/mask
+    bool delete_tcam_entry(const uint8_t * key, const uint8_t * mask, int key_byte_len) {
+        TableWriteGuard guard(entry_lock);
+        int len = match_key_bytes(key_byte_len);
+        int row = tcam_find(key, mask, len);
+        if(row < 0) {
+            return false;
+        }
+        if(match_type == MatchType::LPM) {
+            lpm.remove(key, LpmTrie::prefix_len(mask, len));
+            tcam_free.push_back(row);
+        } else {
+            tss.remove(row, key, mask);
+            tscan.clear_row(row);
+        }
+        clear_tcam_row(row);
+        tcam_used.clear(row);
+        if(match_type != MatchType::LPM) {
+            while(tcam_idx > 0 && !tcam_used.used(tcam_idx - 1)) {
+                tcam_idx--;
+            }
+            tscan.truncate(tcam_idx);
+        }
+        return true;
     }
 
 //    void print_entry(int sram_idx) {
@@ -363,236 +881,100 @@ public:
 //        }
 //    }
 
-    static KeyInfo * get_field(FieldInfo * fd, PHV * phv) {
-        if(fd->fd_type == FieldType::VALID) {
-            auto field = new uint8_t[1];
-            field[0] = (phv->valid_bitmap[fd->hdr_id] << 7);
-            LOG(INFO) << "          value: " << (int)field[0];
-            auto keyInfo = new KeyInfo(7, field, 1, 1);
-            return keyInfo;
-        }
-
-        LEN hdr_offset = phv->parsed_headers[fd->hdr_id]->hdr_offset;
-
-        int begin_idx = hdr_offset + fd->internal_offset;
-        int end_idx = begin_idx + fd->fd_len - 1;
-
-        int begin_byte = begin_idx / 8, end_byte = end_idx / 8;
-        int left_empty = begin_idx % 8, right_empty = (end_idx + 1) % 8 == 0 ? 0 : (8 - (end_idx + 1) % 8);
-
-        int byte_len = ceil(fd->fd_len * 1.0 / 8);
-
-        auto field = new uint8_t[byte_len];
-
-        if(left_empty + right_empty >= 8) {
-            field[byte_len - 1] = (phv->packet[begin_byte + byte_len - 1] << left_empty) + (phv->packet[begin_byte + byte_len] >> (8 - left_empty));
-        } else {
-            field[byte_len - 1] = (phv->packet[begin_byte + byte_len - 1] << left_empty);
-        }
-
-        for(int i = 0; i < byte_len - 1; i++) {
-            field[i] = (phv->packet[begin_byte + i] << left_empty) + (phv->packet[begin_byte + i + 1] >> (8 - left_empty));
-        }
-
-        LOG(INFO) << "          value: ";
-        for(int i = 0; i < byte_len; i++) {
-            LOG(INFO) << "              " << (int)field[i];
-        }
-
-        int empty_len = fd->fd_len % 8 == 0 ? 0 : (8 - fd->fd_len % 8);
-
-        field[byte_len - 1] = field[byte_len - 1] >> empty_len << empty_len;
-
-        auto keyInfo = new KeyInfo(empty_len, field, byte_len, fd->fd_len);
-        return keyInfo;
+    // per thread, since every worker runs the same MatcherThread: the match key, then the tuple space scratch
+    static uint8_t * key_scratch() {
+        static thread_local uint8_t buf[2 * MATCH_KEY_MAX];
+        return buf;
     }
 
-    static uint8_t *combine_to_single_key(const std::vector<KeyInfo*>& keyInfos, LEN fd_len_sum) {
-
-        LOG(INFO) << "      combine to single key:";
-        int len = fd_len_sum / 8 + ((fd_len_sum % 8) > 0);
-        LOG(INFO) << "      all key bit length is: " << fd_len_sum;
-        LOG(INFO) << "      all key byte length is: " << len;
-        auto match_key = (uint8_t*)malloc(len * sizeof(uint8_t));
-        memset(match_key, 0, sizeof(uint8_t) * len);
-
-        int cur_idx = 0;
-        int cur_bit_left = 8;
-
-        for(auto ki : keyInfos) {
-            auto fd = ki->field;
-            for(int i = 0 ; i < ki->byte_len; i++) {
-                if(i < ki->byte_len - 1) {
-                    match_key[cur_idx] = match_key[cur_idx] + (fd[i] >> (8 - cur_bit_left));
-
-                    if(cur_bit_left < 8) {
-                        match_key[cur_idx + 1] = (fd[i] << cur_bit_left);
-                    }
-                    cur_idx += 1;
-                } else {
-                    match_key[cur_idx] = match_key[cur_idx] + (fd[i] >> (8 - cur_bit_left));
-                    if(cur_bit_left > ki->tail_offset) {
-                        cur_bit_left = cur_bit_left - ki->tail_offset;
-                    } else if(cur_bit_left == ki->tail_offset) {
-                        cur_bit_left = 8;
-                        cur_idx += 1;
-                    } else {
-                        match_key[cur_idx + 1] = (fd[i] << cur_bit_left);
-                        cur_bit_left = 8 - ki->tail_offset + cur_bit_left;
-                        cur_idx += 1;
-                    }
-                }
-            }
-        }
-
-        for(int i = 0; i < len; i++){
-            LOG(INFO) << "         " << (int)match_key[i];
+    // value of row, copied into arena: once the lookup is over an update may rewrite the row
+    const uint8_t * row_value(int row, Arena & arena) const {
+        auto out = arena.alloc_bytes(sram_slice_value_width * SRAM_WIDTH / 8);
+        for(int i = 0; i < sram_slice_value_width; i++) {
+            memcpy(out + i * SRAM_WIDTH / 8, value_row(row, i), SRAM_WIDTH / 8);
         }
-
-        // used to assign the entry at the right
-//        int right_shift = fd_len_sum % 8 == 0 ? 0 : (8 - fd_len_sum % 8);
-//        for(int i = len - 1; i > 0; i--) {
-//            match_key[i] = (match_key[i] >> right_shift) + (match_key[i-1] << (8 - right_shift));
-//        }
-//        match_key[0] = match_key[0] >> right_shift;
-
-        return match_key;
+        return out;
     }
 
-    void get_match_res(const uint8_t * match_key, LEN key_len, uint8_t * out_key, uint8_t * out_value, int &hit) { //, uint8_t * out_key, uint8_t * out_value
+    /**
+     * look match_key up, byte_len bytes zero padded to a whole word in a MATCH_KEY_MAX buffer
+     * @return the matched value, sram_slice_value_width slices long; nullptr on a miss
+     */
+    const uint8_t * get_match_res(uint8_t * match_key, int byte_len, Arena & arena) {
         if(match_type == MatchType::EXACT) {
-            int byte_len = key_len / 8 + ((key_len % 8) > 0);
-            uint16_t key_sum = 0;
-            for (int i = 0; i < byte_len; i++) {
-                key_sum += match_key[i];
-            }
-            auto sram_key_seq = new uint8_t[key_width.sram_slice_key_width];
-            auto sram_value_seq = new uint8_t[sram_slice_value_width];
-            int base = key_sum % depth.sram_slice_depth;
-
-            for (int i = 0; i < key_width.sram_slice_key_width; i++) {
-                sram_key_seq[i] = key_config.sram_key_config[base + depth.sram_slice_depth * i];
-            }
-
-            for (int i = 0; i < sram_slice_value_width; i++) {
-                sram_value_seq[i] = sram_value_config[base + depth.sram_slice_depth * i];
-            }
-
-            int idx = key_sum % (1 << SRAM_DEPTH);
-            LOG(INFO) << "          locate the sram entry at " << idx;
-
-            for (int i = 0; i < key_width.sram_slice_key_width; i++) {
-                memcpy(out_key + i * SRAM_WIDTH / 8, sram[sram_key_seq[i]]->tbl + (idx * SRAM_WIDTH / 8),
-                       SRAM_WIDTH / 8);
-            }
-
-            LOG(INFO) << "         out key:";
-            for(int i = 0; i < key_width.sram_slice_key_width * SRAM_WIDTH / 8; i ++) {
-                LOG(INFO) << "              " << (int) out_key[i];
-            }
-
-            for (int i = 0; i < sram_slice_value_width; i++) {
-                memcpy(out_value + i * SRAM_WIDTH / 8, sram[sram_value_seq[i]]->tbl + (idx * SRAM_WIDTH / 8),
-                       SRAM_WIDTH / 8);
+            int key_byte_len = key_width.sram_slice_key_width * SRAM_WIDTH / 8;
+            int len = std::min(byte_len, key_byte_len);
+            if(exact_rows() == 0) {
+                return nullptr;
             }
 
-            LOG(INFO) << "         out value:";
-            for(int i = 0; i < sram_slice_value_width * SRAM_WIDTH / 8; i ++) {
-                LOG(INFO) << "           " << (int) out_value[i];
+            int row = exact_find(match_key, len);
+            if(row >= 0) {
+                LOG(INFO) << "          locate the sram entry at " << row;
+                return row_value(row, arena);
             }
-
-            for(int i = 0; i < byte_len; i++) {
-                if(match_key[i] != out_key[i]) {
-                    hit = 0;
-                    LOG(INFO) << "         miss! " << hit;
-                    return;
+            if(!stash.empty()) {
+                int si = exact_stash_find(match_key, len);
+                if(si >= 0) {
+                    LOG(INFO) << "          locate the entry in stash " << si;
+                    auto out = arena.alloc_bytes(stash[si].value.size());
+                    memcpy(out, stash[si].value.data(), stash[si].value.size());
+                    return out;
                 }
             }
-            hit = 1;
-            LOG(INFO) << "         hit! " << hit;
-        } else {
-            int byte_len = key_len / 8 + ((key_len % 8) > 0);
-            uint16_t key_sum = 0;
-            for (int i = 0; i < byte_len; i++) {
-                key_sum += match_key[i];
-            }
-            int base = key_sum % depth.sram_slice_depth;
-            auto tcam_key_seq = new uint8_t[key_width.tcam_slice_key_width];
-            auto sram_value_seq = new uint8_t[sram_slice_value_width];
-            for (int i = 0; i < key_width.tcam_slice_key_width; i++) {
-                tcam_key_seq[i] = key_config.tcam_key_config[base + depth.tcam_slice_depth * i];
-            }
-
-            for (int i = 0; i < sram_slice_value_width; i++) {
-                sram_value_seq[i] = sram_value_config[base + depth.tcam_slice_depth * i];
-            }
-
-            auto tmp_key = new uint8_t[key_width.tcam_slice_key_width * TCAM_WIDTH / 8];
-            auto tmp_mask = new uint8_t[key_width.tcam_slice_key_width * TCAM_WIDTH / 8];
-            for(int i = 0; i < (1 << TCAM_DEPTH); i++) {
-                for(int j = 0; j < key_width.tcam_slice_key_width; j++){
-                    memcpy(tmp_key + j * TCAM_WIDTH / 8, tcam[tcam_key_seq[j]]->tbl + (i * TCAM_WIDTH / 8), TCAM_WIDTH / 8);
-                    memcpy(tmp_mask + j * TCAM_WIDTH / 8, tcam[tcam_key_seq[j]]->mask + (i * TCAM_WIDTH / 8), TCAM_WIDTH / 8);
-                }
-                int flag = 0;
-                for(int k = 0; k < byte_len; k++) {
-                    if((match_key[k] & tmp_mask[k]) != tmp_key[k]) {
-                        flag = 1;
-                        break;
-                    }
-                }
-                if(flag == 0) {
-                    for (int l = 0; l < key_width.tcam_slice_key_width; l++) {
-                        memcpy(out_key + l * TCAM_WIDTH / 8, tcam[tcam_key_seq[l]]->tbl + (i * TCAM_WIDTH / 8),
-                               TCAM_WIDTH / 8);
-                    }
+            return nullptr;
+        }
 
-                    for (int l = 0; l < sram_slice_value_width; l++) {
-                        memcpy(out_value + l * SRAM_WIDTH / 8, sram[sram_value_seq[l]]->tbl + (i * SRAM_WIDTH / 8),
-                               SRAM_WIDTH / 8);
-                    }
-                    hit = 1;
-                    break;
-                } else {
-                    continue;
-                }
-            }
+        bool is_lpm = match_type == MatchType::LPM;
+        int len = is_lpm ? lpm.get_key_len() : tss.get_key_len();
+        if(len == 0) {
+            return nullptr;
+        }
+        // the rules are compared over len bytes, and the scan reads on to a whole word
+        int padded = (len + 7) / 8 * 8;
+        if(padded > byte_len) {
+            memset(match_key + byte_len, 0, padded - byte_len);
+        }
+        int row;
+        if(is_lpm) {
+            row = lpm.lookup(match_key);
+        } else if(tscan.row_num() * tscan.word_num() <= (int) tss.tuple_num() * TERNARY_SCAN_RATIO) {
+            row = tscan.lookup(match_key);
+        } else {
+            row = tss.lookup(match_key, key_scratch() + MATCH_KEY_MAX);
         }
+        if(row < 0) {
+            return nullptr;
+        }
+        LOG(INFO) << "          locate the tcam entry at " << row;
+        return row_value(row, arena);
     }
 
-    void generate_match_key_and_match(PHV * phv) { // std::vector<FieldInfo*> fdInfos,
-        std::vector<KeyInfo*> keyInfos;
-        LEN fd_len_sum = 0;
-        LOG(INFO) << "      matching fields: ";
-        LOG(INFO) << "      matching field num: " << fdInfos.size();
-        for (auto fi : fdInfos) {
-            LOG(INFO) << "          field: ";
-            LOG(INFO) << "              header id: " << (int)fi->hdr_id;
-            LOG(INFO) << "              field internal offset: " << (int)fi->internal_offset;
-            LOG(INFO) << "              field length: " << (int)fi->fd_len;
-            LOG(INFO) << "              field type(field, valid, hit, miss): " << (int)fi->fd_type;
-            keyInfos.push_back(get_field(fi, phv));
-            fd_len_sum += fi->fd_len;
+    // runs the key program into this thread's scratch; only a hit's value is allocated
+    void generate_match_key_and_match(PHV * phv) {
+        uint8_t * key = key_scratch();
+        int byte_len = match_key_len;
+        memset(key, 0, (byte_len + 7) / 8 * 8);
+        LOG(INFO) << "      matching field num: " << key_prog.size();
+        for(const auto & step : key_prog) {
+            step.acc.pack(phv, key, MATCH_KEY_MAX, step.dst_bit);
+            if(phv->flow_patch != nullptr) {
+                phv->flow_patch->note_read(phv, step.acc);
+            }
         }
-        int byte_len = fd_len_sum / 8 + ((fd_len_sum % 8) > 0);
-        uint8_t * match_key = combine_to_single_key(keyInfos, fd_len_sum);
-
-        int key_byte_len = ((match_type == MatchType::EXACT) ? key_width.sram_slice_key_width * SRAM_WIDTH / 8
-                                                                : key_width.tcam_slice_key_width * TCAM_WIDTH / 8);
-        int value_byte_len = sram_slice_value_width * SRAM_WIDTH / 8;
-
-        auto out_key = new uint8_t[key_byte_len];
-        auto out_value = new uint8_t[value_byte_len]; // here to optimize
 
-        int hit = 0;
-
-        get_match_res(match_key, fd_len_sum, out_key, out_value, hit); // here
-        if(hit == 1) {
+        const uint8_t * value;
+        {
+            TableReadGuard guard(entry_lock);
+            value = get_match_res(key, byte_len, phv->arena);
+        }
+        LOG(INFO) << "         " << (value != nullptr ? "hit! " : "miss! ");
+        if(value != nullptr) {
             phv->hit = true;
-            phv->match_value = out_value;
-            phv->match_value_len = value_byte_len;
+            phv->match_value = value;
+            phv->match_value_len = sram_slice_value_width * SRAM_WIDTH / 8;
 
-            phv->next_action_id = (uint32_t(out_value[1])) + ((uint32_t)out_value[0] << 8);
+            phv->next_action_id = (uint32_t(value[1])) + ((uint32_t)value[0] << 8);
             LOG(INFO) << "      phv->match_value_len: " << phv->match_value_len;
             LOG(INFO) << "      phv->next_action_id: " << phv->next_action_id;
         } else {
@@ -611,10 +993,33 @@ public:
 
     // hash on key to determine which srams should be used
 
-    Matcher(int _proc_id) {
+    Matcher(int _proc_id, const std::shared_ptr<ClusterMemory> & mem = nullptr) {
         this->proc_id = _proc_id;
         for(int i = 0; i < MATCHER_THREAD_NUM; i++) {
-            mts[i] = new MatcherThread(_proc_id);
+            mts[i] = new MatcherThread(_proc_id, mem);
+        }
+    }
+
+    Matcher(const Matcher &) = delete;
+    Matcher & operator=(const Matcher &) = delete;
+
+    ~Matcher() {
+        for(auto mt : mts) {
+            delete mt;
+        }
+    }
+
+    // other's tables, entries included. this matcher must have memory of its own, other's blocks are copied in
+    void copy_from(const Matcher & other) {
+        auto & mt = *mts[0];
+        for(int i = 0; i < SRAM_NUM_PER_CLUSTER; i++) {
+            *mt.sram[i] = *other.mts[0]->sram[i];
+        }
+        for(int i = 0; i < TCAM_NUM_PER_CLUSTER; i++) {
+            *mt.tcam[i] = *other.mts[0]->tcam[i];
+        }
+        for(int i = 0; i < MATCHER_THREAD_NUM; i++) {
+            mts[i]->copy_from(*other.mts[i]);
         }
     }
 
@@ -622,12 +1027,29 @@ public:
 //        this->hit_miss_bitmap[idx] = value;
 //    }
 
-    void insert_sram_entry(int matcher_id, uint8_t * key, uint8_t * value, int key_byte_len, int value_byte_len) {
-        mts[matcher_id]->insert_sram_entry(key, value, key_byte_len, value_byte_len);
+    bool insert_sram_entry(int matcher_id, uint8_t * key, uint8_t * value, int key_byte_len, int value_byte_len) {
+        return mts[matcher_id]->insert_sram_entry(key, value, key_byte_len, value_byte_len);
+    }
+
+    bool insert_tcam_entry(int matcher_id, uint8_t * key, uint8_t * mask, uint8_t * value, int key_byte_len, int value_byte_len) {
+        return mts[matcher_id]->insert_tcam_entry(key, mask, value, key_byte_len, value_byte_len);
+    }
+
+    bool modify_sram_entry(int matcher_id, const uint8_t * key, const uint8_t * value, int key_byte_len, int value_byte_len) {
+        return mts[matcher_id]->modify_sram_entry(key, value, key_byte_len, value_byte_len);
+    }
+
+    bool delete_sram_entry(int matcher_id, const uint8_t * key, int key_byte_len) {
+        return mts[matcher_id]->delete_sram_entry(key, key_byte_len);
+    }
+
+    bool modify_tcam_entry(int matcher_id, const uint8_t * key, const uint8_t * mask, const uint8_t * value,
+                           int key_byte_len, int value_byte_len) {
+        return mts[matcher_id]->modify_tcam_entry(key, mask, value, key_byte_len, value_byte_len);
     }
 
-    void insert_tcam_entry(int matcher_id, uint8_t * key, uint8_t * mask, uint8_t * value, int key_byte_len, int value_byte_len) {
-        mts[matcher_id]->insert_tcam_entry(key, mask, value, key_byte_len, value_byte_len);
+    bool delete_tcam_entry(int matcher_id, const uint8_t * key, const uint8_t * mask, int key_byte_len) {
+        return mts[matcher_id]->delete_tcam_entry(key, mask, key_byte_len);
     }
 
     void set_fd_info(int matcher_id, std::vector<FieldInfo*> _fdInfos) {
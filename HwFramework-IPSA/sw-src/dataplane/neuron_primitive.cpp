@@ -26,7 +26,7 @@ int64_t arithmetic_right_shift(int64_t value, uint32_t shift) {
     return -static_cast<int64_t>(shifted);
 }
 
-Data make_zero_data(uint32_t bit_length) {
+Data make_zero_data(uint32_t bit_length, Arena& arena) {
     Data zero{};
     zero.data_len = static_cast<int>(bit_length);
     int byte_len = static_cast<int>(std::ceil(bit_length / 8.0));
@@ -34,8 +34,7 @@ Data make_zero_data(uint32_t bit_length) {
         zero.val = nullptr;
         return zero;
     }
-    zero.val = new uint8_t[byte_len];
-    std::memset(zero.val, 0, byte_len);
+    zero.val = arena.alloc_zeroed(byte_len);
     return zero;
 }
 
@@ -104,17 +103,16 @@ bool decode_value_vector(const Data& data,
     return true;
 }
 
-Data pack_unsigned_values(const std::vector<uint64_t>& values, uint32_t bitwidth) {
+Data pack_unsigned_values(const std::vector<uint64_t>& values, uint32_t bitwidth, Arena& arena) {
     if (values.empty()) {
-        return make_zero_data(0);
+        return make_zero_data(0, arena);
     }
 
     const uint32_t total_bits = bitwidth * static_cast<uint32_t>(values.size());
     Data packed{};
     packed.data_len = static_cast<int>(total_bits);
     const int byte_len = static_cast<int>(std::ceil(total_bits / 8.0));
-    packed.val = new uint8_t[byte_len];
-    std::memset(packed.val, 0, byte_len);
+    packed.val = arena.alloc_zeroed(byte_len);
 
     for (size_t idx = 0; idx < values.size(); ++idx) {
         uint64_t value = values[idx];
@@ -231,72 +229,79 @@ bool SigmoidTableManager::load_table(int32_t min_input,
         }
     }
 
+    auto table = std::make_shared<SigmoidTable>();
+    table->min_input = min_input;
+    table->max_input = max_input;
+    table->value_bitwidth = value_bitwidth;
+    table->input_multiplier = input_multiplier;
+    table->values = values;
+
     std::lock_guard<std::mutex> lock(mutex_);
-    min_input_ = min_input;
-    max_input_ = max_input;
-    value_bitwidth_ = value_bitwidth;
-    input_multiplier_ = input_multiplier;
-    table_ = values;
+    std::atomic_store(&table_, std::shared_ptr<const SigmoidTable>(std::move(table)));
     return true;
 }
 
 void SigmoidTableManager::clear() {
     std::lock_guard<std::mutex> lock(mutex_);
-    table_.clear();
-    min_input_ = 0;
-    max_input_ = -1;
-    value_bitwidth_ = 0;
+    std::atomic_store(&table_, std::shared_ptr<const SigmoidTable>());
+}
+
+std::shared_ptr<const SigmoidTable> SigmoidTableManager::snapshot() const {
+    return std::atomic_load(&table_);
 }
 
 bool SigmoidTableManager::is_loaded() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return !table_.empty();
+    return snapshot() != nullptr;
+}
+
+uint32_t SigmoidTable::lookup(int32_t input) const {
+    long double scaled = static_cast<long double>(input) * static_cast<long double>(input_multiplier);
+    int64_t scaled_int = static_cast<int64_t>(std::llround(scaled));
+    if (scaled_int < static_cast<int64_t>(min_input)) {
+        scaled_int = min_input;
+    } else if (scaled_int > static_cast<int64_t>(max_input)) {
+        scaled_int = max_input;
+    }
+    size_t idx = static_cast<size_t>(scaled_int - min_input);
+    return values[idx];
 }
 
 uint32_t SigmoidTableManager::lookup(int32_t input) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (table_.empty()) {
+    auto table = snapshot();
+    if (table == nullptr) {
         LOG(ERROR) << "Sigmoid table: lookup attempted before load.";
         return 0;
     }
-    long double scaled = static_cast<long double>(input) * static_cast<long double>(input_multiplier_);
-    int64_t scaled_int = static_cast<int64_t>(std::llround(scaled));
-    if (scaled_int < static_cast<int64_t>(min_input_)) {
-        scaled_int = min_input_;
-    } else if (scaled_int > static_cast<int64_t>(max_input_)) {
-        scaled_int = max_input_;
-    }
-    size_t idx = static_cast<size_t>(scaled_int - min_input_);
-    return table_[idx];
+    return table->lookup(input);
 }
 
 uint32_t SigmoidTableManager::value_bitwidth() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return value_bitwidth_;
+    auto table = snapshot();
+    return table == nullptr ? 0 : table->value_bitwidth;
 }
 
 uint32_t SigmoidTableManager::input_multiplier() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return input_multiplier_;
+    auto table = snapshot();
+    return table == nullptr ? 1 : table->input_multiplier;
 }
 
-Data apply_sigmoid_lookup(const Data& input, uint32_t desired_bitwidth) {
-    auto &manager = SigmoidTableManager::instance();
-    if (!manager.is_loaded()) {
+Data apply_sigmoid_lookup(const Data& input, uint32_t desired_bitwidth, Arena& arena) {
+    auto table = SigmoidTableManager::instance().snapshot();
+    if (table == nullptr) {
         LOG(ERROR) << "Sigmoid table: not loaded.";
-        return make_zero_data(desired_bitwidth == 0 ? 32 : desired_bitwidth);
+        return make_zero_data(desired_bitwidth == 0 ? 32 : desired_bitwidth, arena);
     }
 
     const uint32_t bit_len = static_cast<uint32_t>(input.data_len == 0 ? 32 : input.data_len);
     const int64_t raw = extract_bits(input.val, 0, bit_len, true, bit_len);
-    uint32_t width = desired_bitwidth == 0 ? manager.value_bitwidth() : desired_bitwidth;
+    uint32_t width = desired_bitwidth == 0 ? table->value_bitwidth : desired_bitwidth;
     if (width == 0 || width > 32) {
         width = 32;
     }
-    uint32_t lut_val = manager.lookup(static_cast<int32_t>(raw));
-    uint32_t value = rescale_value(lut_val, manager.value_bitwidth(), width);
+    uint32_t lut_val = table->lookup(static_cast<int32_t>(raw));
+    uint32_t value = rescale_value(lut_val, table->value_bitwidth, width);
     std::vector<uint64_t> packed{value};
-    return pack_unsigned_values(packed, width);
+    return pack_unsigned_values(packed, width, arena);
 }
 
 bool NeuronPrimitiveManager::upsert_context(const NeuronPrimitiveContext& ctx) {
@@ -317,33 +322,40 @@ bool NeuronPrimitiveManager::upsert_context(const NeuronPrimitiveContext& ctx) {
     }
 
     std::lock_guard<std::mutex> lock(mutex_);
-    contexts_[ctx.context_id] = ctx;
+    auto next = std::make_shared<ContextMap>(*std::atomic_load(&contexts_));
+    (*next)[ctx.context_id] = std::make_shared<const NeuronPrimitiveContext>(ctx);
+    std::atomic_store(&contexts_, std::shared_ptr<const ContextMap>(std::move(next)));
     return true;
 }
 
-const NeuronPrimitiveContext* NeuronPrimitiveManager::get_context(uint16_t context_id) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = contexts_.find(context_id);
-    if (it == contexts_.end()) {
+std::shared_ptr<const NeuronPrimitiveContext> NeuronPrimitiveManager::get_context(uint16_t context_id) const {
+    auto contexts = std::atomic_load(&contexts_);
+    auto it = contexts->find(context_id);
+    if (it == contexts->end()) {
         return nullptr;
     }
-    return &it->second;
+    return it->second;
 }
 
 bool NeuronPrimitiveManager::erase_context(uint16_t context_id) {
     std::lock_guard<std::mutex> lock(mutex_);
-    return contexts_.erase(context_id) > 0;
+    auto next = std::make_shared<ContextMap>(*std::atomic_load(&contexts_));
+    if (next->erase(context_id) == 0) {
+        return false;
+    }
+    std::atomic_store(&contexts_, std::shared_ptr<const ContextMap>(std::move(next)));
+    return true;
 }
 
 void NeuronPrimitiveManager::clear() {
     std::lock_guard<std::mutex> lock(mutex_);
-    contexts_.clear();
+    std::atomic_store(&contexts_, std::shared_ptr<const ContextMap>(std::make_shared<ContextMap>()));
 }
 
-Data execute_neuron_primitive(const NeuronPrimitiveContext& ctx, const Data& features) {
+Data execute_neuron_primitive(const NeuronPrimitiveContext& ctx, const Data& features, Arena& arena) {
     if (ctx.num_inputs == 0 || ctx.num_neurons == 0) {
         LOG(ERROR) << "Neuron primitive: invalid context dimensions.";
-        return make_zero_data(32);
+        return make_zero_data(32, arena);
     }
     const uint32_t out_width = kFixedPointBitwidth;
     if (ctx.output_bitwidth != kFixedPointBitwidth && ctx.output_bitwidth != 0) {
@@ -355,7 +367,7 @@ Data execute_neuron_primitive(const NeuronPrimitiveContext& ctx, const Data& fea
     if (ctx.weights.size() != ctx.num_inputs * ctx.num_neurons ||
         ctx.biases.size() != ctx.num_neurons) {
         LOG(ERROR) << "Neuron primitive: context weight/bias mismatch.";
-        return make_zero_data(32);
+        return make_zero_data(32, arena);
     }
 
     const uint32_t input_bitwidth = kFixedPointBitwidth;
@@ -372,7 +384,7 @@ Data execute_neuron_primitive(const NeuronPrimitiveContext& ctx, const Data& fea
                               ctx.inputs_are_signed,
                               input_vector)) {
         LOG(ERROR) << "Neuron primitive: unable to decode input vector.";
-        return make_zero_data(ctx.num_neurons * out_width);
+        return make_zero_data(ctx.num_neurons * out_width, arena);
     }
 
     std::vector<int64_t> mac_outputs(ctx.num_neurons, 0);
@@ -395,18 +407,18 @@ Data execute_neuron_primitive(const NeuronPrimitiveContext& ctx, const Data& fea
 
     switch (activation) {
         case ActivationFunction::SIGMOID: {
-            auto &sigmoid_mgr = SigmoidTableManager::instance();
-            if (!sigmoid_mgr.is_loaded()) {
+            auto sigmoid_table = SigmoidTableManager::instance().snapshot();
+            if (sigmoid_table == nullptr) {
                 LOG(ERROR) << "Neuron primitive: sigmoid activation requested but "
                               "no lookup table is loaded.";
-                return make_zero_data(ctx.num_neurons * pack_width);
+                return make_zero_data(ctx.num_neurons * pack_width, arena);
             }
-            uint32_t table_width = sigmoid_mgr.value_bitwidth();
+            uint32_t table_width = sigmoid_table->value_bitwidth;
             for (uint32_t i = 0; i < ctx.num_neurons; ++i) {
                 int64_t shifted_value = arithmetic_right_shift(mac_outputs[i], kNeuronCoeffShift);
                 shifted_value = arithmetic_right_shift(shifted_value, ctx.output_shift);
                 int32_t scaled_input = static_cast<int32_t>(shifted_value);
-                uint32_t lookup_value = sigmoid_mgr.lookup(scaled_input);
+                uint32_t lookup_value = sigmoid_table->lookup(scaled_input);
                 encoded_outputs.push_back(
                     rescale_value(lookup_value, table_width, pack_width));
             }
@@ -434,5 +446,5 @@ Data execute_neuron_primitive(const NeuronPrimitiveContext& ctx, const Data& fea
         }
     }
 
-    return pack_unsigned_values(encoded_outputs, pack_width);
+    return pack_unsigned_values(encoded_outputs, pack_width, arena);
 }
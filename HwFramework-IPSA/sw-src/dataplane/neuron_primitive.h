@@ -2,6 +2,7 @@
 #define RECONF_SWITCH_IPSA_NEURON_PRIMITIVE_H
 
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -30,30 +31,50 @@ struct NeuronPrimitiveContext {
     ActivationFunction activation = ActivationFunction::NONE;
 };
 
+// Packet workers read contexts concurrently with control-plane updates. Writers copy the map,
+// modify the copy and publish it; readers load the current map and keep the context alive
+// through the returned shared_ptr, so they never take the writer lock.
 class NeuronPrimitiveManager {
 public:
     static NeuronPrimitiveManager& instance();
 
     bool upsert_context(const NeuronPrimitiveContext& ctx);
-    const NeuronPrimitiveContext* get_context(uint16_t context_id) const;
+    std::shared_ptr<const NeuronPrimitiveContext> get_context(uint16_t context_id) const;
     bool erase_context(uint16_t context_id);
     void clear();
 
 private:
-    NeuronPrimitiveManager() = default;
+    typedef std::unordered_map<uint16_t, std::shared_ptr<const NeuronPrimitiveContext>> ContextMap;
+
+    NeuronPrimitiveManager() : contexts_(std::make_shared<ContextMap>()) {}
     NeuronPrimitiveManager(const NeuronPrimitiveManager&) = delete;
     NeuronPrimitiveManager& operator=(const NeuronPrimitiveManager&) = delete;
 
-    mutable std::mutex mutex_;
-    std::unordered_map<uint16_t, NeuronPrimitiveContext> contexts_;
+    // serialises writers only
+    std::mutex mutex_;
+    std::shared_ptr<const ContextMap> contexts_;
 };
 
-Data execute_neuron_primitive(const NeuronPrimitiveContext& ctx, const Data& features);
+Data execute_neuron_primitive(const NeuronPrimitiveContext& ctx, const Data& features, Arena& arena);
+
+struct SigmoidTable {
+    int32_t min_input = 0;
+    int32_t max_input = -1;
+    uint32_t value_bitwidth = 0;
+    uint32_t input_multiplier = 1;
+    std::vector<uint32_t> values;
+
+    uint32_t lookup(int32_t input) const;
+};
 
+// published the same way as the neuron contexts: a reload swaps in a new table
 class SigmoidTableManager {
 public:
     static SigmoidTableManager& instance();
 
+    // the current table, or nullptr if none is loaded; one snapshot gives consistent width and values
+    std::shared_ptr<const SigmoidTable> snapshot() const;
+
     bool load_table(int32_t min_input,
                     int32_t max_input,
                     uint32_t value_bitwidth,
@@ -71,15 +92,11 @@ private:
     SigmoidTableManager(const SigmoidTableManager&) = delete;
     SigmoidTableManager& operator=(const SigmoidTableManager&) = delete;
 
-    mutable std::mutex mutex_;
-    int32_t min_input_ = 0;
-    int32_t max_input_ = -1;
-    uint32_t value_bitwidth_ = 0;
-    uint32_t input_multiplier_ = 1;
-    std::vector<uint32_t> table_;
+    std::mutex mutex_;
+    std::shared_ptr<const SigmoidTable> table_;
 };
 
-Data apply_sigmoid_lookup(const Data& input, uint32_t desired_bitwidth);
+Data apply_sigmoid_lookup(const Data& input, uint32_t desired_bitwidth, Arena& arena);
 
 
 #endif // RECONF_SWITCH_IPSA_NEURON_PRIMITIVE_H
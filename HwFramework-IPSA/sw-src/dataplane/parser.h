@@ -10,8 +10,11 @@
 #include <vector>
 #include <string>
 #include <iostream>
+#include <algorithm>
 
 #include "global.h"
+#include "field_access.h"
+#include "flow_cache.h"
 
 //#define TEST
 
@@ -19,6 +22,8 @@ struct ParserTcamEntry {
     uint8_t state;
     uint32_t entry;
     uint32_t mask;
+    bool in_use; // unused slots never match
+    uint32_t seq; // install order, breaks ties between equally specific masks
 };
 
 struct ParserSramEntry { // 24 + 8 + 24 * (1,2,3,4) = 51, 75, 99, 123
@@ -27,6 +32,7 @@ struct ParserSramEntry { // 24 + 8 + 24 * (1,2,3,4) = 51, 75, 99, 123
     uint8_t next_state;
     uint8_t trans_fd_num; //
     FieldInfo* trans_fds[4]; // 24 * 4
+    FieldAccessor trans_accs[4]; // compiled from trans_fds whenever the entry is modified
     uint8_t miss_act; // 0 is accept, 1 is drop , go to next state
 
     ParserSramEntry() {
@@ -34,6 +40,27 @@ struct ParserSramEntry { // 24 + 8 + 24 * (1,2,3,4) = 51, 75, 99, 123
             trans_fd = new FieldInfo();
         }
     }
+
+    ParserSramEntry(const ParserSramEntry &) = delete;
+    ParserSramEntry & operator=(const ParserSramEntry &) = delete;
+
+    void copy_from(const ParserSramEntry & other) {
+        hdr_id = other.hdr_id;
+        hdr_len = other.hdr_len;
+        next_state = other.next_state;
+        trans_fd_num = other.trans_fd_num;
+        for(int i = 0; i < 4; i++) {
+            *trans_fds[i] = *other.trans_fds[i];
+            trans_accs[i] = other.trans_accs[i];
+        }
+        miss_act = other.miss_act;
+    }
+
+    ~ParserSramEntry() {
+        for(auto trans_fd : trans_fds) {
+            delete trans_fd;
+        }
+    }
 };
 
 
@@ -43,6 +70,12 @@ struct ParserStage {
     ParserTcamEntry* ps_trans_tbl[256]{};
     ParserSramEntry* ps_act_tbl[256]{};
 
+    // slots in use grouped by state: those of state s are state_order[state_begin[s]..state_begin[s + 1]),
+    // most specific mask first, then in install order. rebuilt on every modify and clear
+    uint8_t state_order[256]{};
+    uint16_t state_begin[257]{};
+    uint32_t next_seq = 0;
+
     ParserStage() {
         for(int i = 0; i < 256; i++) {
             ps_trans_tbl[i] = new ParserTcamEntry();
@@ -50,6 +83,28 @@ struct ParserStage {
             ps_trans_tbl[i]->mask = 0xffffffff;
             ps_act_tbl[i] = new ParserSramEntry();
         }
+        rebuild_index();
+    }
+
+    ParserStage(const ParserStage &) = delete;
+    ParserStage & operator=(const ParserStage &) = delete;
+
+    ~ParserStage() {
+        for(int i = 0; i < 256; i++) {
+            delete ps_trans_tbl[i];
+            delete ps_act_tbl[i];
+        }
+    }
+
+    void copy_from(const ParserStage & other) {
+        stage_level = other.stage_level;
+        for(int i = 0; i < 256; i++) {
+            *ps_trans_tbl[i] = *other.ps_trans_tbl[i];
+            ps_act_tbl[i]->copy_from(*other.ps_act_tbl[i]);
+        }
+        memcpy(state_order, other.state_order, sizeof(state_order));
+        memcpy(state_begin, other.state_begin, sizeof(state_begin));
+        next_seq = other.next_seq;
     }
 
     void clear() {
@@ -59,9 +114,71 @@ struct ParserStage {
             ps_trans_tbl[i]->mask = 0xffffffff;
             for(int j = 0; j < 4; j++) {
                 memset(ps_act_tbl[i]->trans_fds[j], 0, sizeof(FieldInfo));
+                ps_act_tbl[i]->trans_accs[j] = FieldAccessor();
             }
             memset(ps_act_tbl[i], 0, 5);
         }
+        next_seq = 0;
+        rebuild_index();
+    }
+
+    /**
+     * slot for (state, entry, mask): the slot already holding that key if any, so a modify overwrites it,
+     * otherwise the first free slot from hint on. hint is the slot the control plane's key hash picks,
+     * probing past it keeps two different keys hashing alike from overwriting each other
+     */
+    uint8_t find_slot(uint8_t state, uint32_t entry, uint32_t mask, uint8_t hint) const {
+        for(int i = 0; i < 256; i++) {
+            auto t = ps_trans_tbl[i];
+            if(t->in_use && t->state == state && t->entry == entry && t->mask == mask) {
+                return i;
+            }
+        }
+        for(int i = 0; i < 256; i++) {
+            auto idx = (uint8_t)(hint + i);
+            if(!ps_trans_tbl[idx]->in_use) {
+                return idx;
+            }
+        }
+        LOG(WARNING) << "Parser table full, overwriting entry " << (int)hint;
+        return hint;
+    }
+
+    void install_trans(uint8_t idx, uint8_t state, uint32_t entry, uint32_t mask) {
+        auto t = ps_trans_tbl[idx];
+        if(!(t->in_use && t->state == state && t->entry == entry && t->mask == mask)) {
+            t->seq = next_seq++;
+        }
+        t->state = state;
+        t->entry = entry;
+        t->mask = mask;
+        t->in_use = true;
+    }
+
+    void rebuild_index() {
+        uint8_t slots[256];
+        int cnt = 0;
+        for(int i = 0; i < 256; i++) {
+            if(ps_trans_tbl[i]->in_use) {
+                slots[cnt++] = i;
+            }
+        }
+        std::sort(slots, slots + cnt, [this](uint8_t a, uint8_t b) {
+            auto ta = ps_trans_tbl[a], tb = ps_trans_tbl[b];
+            if(ta->state != tb->state) return ta->state < tb->state;
+            int pa = __builtin_popcount(ta->mask), pb = __builtin_popcount(tb->mask);
+            if(pa != pb) return pa > pb;
+            return ta->seq < tb->seq;
+        });
+        int pos = 0;
+        for(int s = 0; s < 256; s++) {
+            state_begin[s] = pos;
+            while(pos < cnt && ps_trans_tbl[slots[pos]]->state == s) {
+                state_order[pos] = slots[pos];
+                pos++;
+            }
+        }
+        state_begin[256] = pos;
     }
 
     void modify_trans_act(const uint8_t key[], const uint8_t value[]) {
@@ -78,9 +195,11 @@ struct ParserStage {
             idx = 255;
         }
 
-        ps_trans_tbl[idx]->state = key[0]; // first 8-bit
-        ps_trans_tbl[idx]->entry = uint32_t(key[1] << 24) + uint32_t(key[2] << 16) + uint32_t(key[3] << 8) + key[4]; // last 32 bits for match key.
-        ps_trans_tbl[idx]->mask = (key[5] << 24) + (key[6] << 16) + (key[7] << 8) + key[8];
+        uint8_t state = key[0]; // first 8-bit
+        uint32_t entry = (uint32_t(key[1]) << 24) + (uint32_t(key[2]) << 16) + (uint32_t(key[3]) << 8) + key[4]; // last 32 bits for match key.
+        uint32_t mask = (uint32_t(key[5]) << 24) + (uint32_t(key[6]) << 16) + (uint32_t(key[7]) << 8) + key[8];
+        idx = find_slot(state, entry, mask, idx);
+        install_trans(idx, state, entry, mask);
 
 
         // hdr_id(8), hdr_len(16), next_state(8), transition field num(8)
@@ -100,7 +219,9 @@ struct ParserStage {
             ps_act_tbl[idx]->trans_fds[i]->internal_offset = (value[6 + i * 6] << 8) + value[7 + i * 6]; // 16-bit
             ps_act_tbl[idx]->trans_fds[i]->fd_len = (value[8 + i * 6] << 8) + value[9 + i * 6]; // 16-bit
             ps_act_tbl[idx]->trans_fds[i]->fd_type = ((value[10 + i * 6] == 0) ? FieldType::FIELD : FieldType::VALID);
+            ps_act_tbl[idx]->trans_accs[i] = FieldAccessor(*ps_act_tbl[idx]->trans_fds[i]);
         }
+        rebuild_index();
     }
 
     void modify_trans_entry(uint8_t state, uint32_t entry, uint32_t mask, uint8_t hdr_id, uint16_t hdr_len,
@@ -118,6 +239,7 @@ struct ParserStage {
         if(flag == 0) {
             idx = 255 - state;
         }
+        idx = find_slot(state, entry, mask, idx);
 
         LOG(INFO) << "Mod parser entry at: " << (int)idx;
         LOG(INFO) << "  state: " << (int)state;
@@ -131,9 +253,7 @@ struct ParserStage {
 //        LOG(INFO) << "  transition fields: ";
 
 
-        ps_trans_tbl[idx]->state = state; // first 8-bit
-        ps_trans_tbl[idx]->entry = entry;
-        ps_trans_tbl[idx]->mask = mask;
+        install_trans(idx, state, entry, mask);
 
         ps_act_tbl[idx]->hdr_id = hdr_id;
         ps_act_tbl[idx]->hdr_len = hdr_len;
@@ -147,134 +267,111 @@ struct ParserStage {
             ps_act_tbl[idx]->trans_fds[i]->internal_offset = trans_fds[i]->internal_offset; // 16-bit
             ps_act_tbl[idx]->trans_fds[i]->fd_len = trans_fds[i]->fd_len; // 16-bit
             ps_act_tbl[idx]->trans_fds[i]->fd_type = trans_fds[i]->fd_type;
+            ps_act_tbl[idx]->trans_accs[i] = FieldAccessor(*ps_act_tbl[idx]->trans_fds[i]);
 //            LOG(INFO) << "      idx: " << (int)i;
 //            LOG(INFO) << "      header_id: " << (int)trans_fds[i]->hdr_id;
 //            LOG(INFO) << "      field_internal_offset: " << (int)trans_fds[i]->internal_offset;
 //            LOG(INFO) << "      field_length: " << (int)trans_fds[i]->fd_len;
 //            LOG(INFO) << "      field_type: " << (int)trans_fds[i]->fd_type;
         }
+        rebuild_index();
     }
+};
 
-    static uint32_t get_field_int(PHV * phv, FieldInfo * trans_fd/*uint8_t hdr_id, LEN internal_offset, LEN len*/) {
-//        uint8_t hdr_id = sram_entry->trans_fds[i]->hdr_id;
-        uint8_t hdr_id = trans_fd->hdr_id;
-        if (trans_fd->fd_type == FieldType::VALID) {
-            return phv->valid_bitmap[hdr_id];
-        }
-
-        uint16_t internal_offset = trans_fd->internal_offset;
-        uint16_t len = trans_fd->fd_len;
-        auto header = phv->parsed_headers[hdr_id];
-
-        int begin_idx = header->hdr_offset + internal_offset;
-        int end_idx = begin_idx + len - 1;
-
-        int left_empty = begin_idx % 8;
-        int right_empy = (end_idx + 1) % 8 == 0 ? 0 : (8 - (end_idx + 1) % 8);
-
-        int begin_byte = begin_idx / 8, end_byte = end_idx / 8;
+/**
+ * one outcome of a parser transition: the header it extracts, where it goes next, and how to build
+ * the key for the next level. copied out of ParserSramEntry when the graph is compiled
+ */
+struct ParserArc {
+    uint8_t hdr_id;
+    uint16_t hdr_len;
+    uint8_t next_state;
+    uint8_t miss_act;
+    uint8_t trans_fd_num;
+    FieldAccessor trans_accs[4];
+};
 
-        uint8_t left_mask = 0, right_mask = 0;
-        for(int j = 0; j < 8 - left_empty; j++) {
-            left_mask += (1 << j);
-        }
+// a run of transitions sharing one mask, keys sorted for binary search
+struct ParserArcGroup {
+    uint32_t mask;
+    int key_begin;
+    int key_end;
+};
 
-        for(int j = 0; j < 8 - right_empy; j++) {
-            right_mask += (1 << (7 - j));
-        }
+struct ParserNode {
+    int group_begin = 0;
+    int group_end = 0;
+};
 
-        uint32_t res = 0;
-        int cur_off = 0;
-        for(int j = end_byte; j >= begin_byte; j--) {
-            if(j == end_byte) {
-                res += (phv->packet[j] >> right_empy);
-                cur_off += (8 - right_empy);
-            } else if(j == begin_byte) {
-                res += ( (uint32_t)(phv->packet[j] & left_mask) << cur_off );
-            } else {
-                res += (phv->packet[j] << cur_off);
-                cur_off += 8;
+/**
+ * the parser levels flattened into one state machine. node (level, state) lists the mask groups of the
+ * level's transitions for that state in priority order, most specific mask first; the first group holding
+ * key & mask wins. built from the ParserStages whenever the parser config changes
+ */
+struct ParserGraph {
+    ParserNode nodes[PARSER_LEVEL_NUM][256];
+    std::vector<ParserArcGroup> groups;
+    std::vector<std::pair<uint32_t, int>> keys; // (entry, index into arcs)
+    std::vector<ParserArc> arcs;
+
+    void compile(const ParserStage * levels, int level_num) {
+        groups.clear();
+        keys.clear();
+        arcs.clear();
+        for(int l = 0; l < PARSER_LEVEL_NUM; l++) {
+            for(int st = 0; st < 256; st++) {
+                auto & node = nodes[l][st];
+                node.group_begin = node.group_end = (int)groups.size();
+                if(l >= level_num) {
+                    continue;
+                }
+                auto & stage = levels[l];
+                for(int i = stage.state_begin[st]; i < stage.state_begin[st + 1]; i++) {
+                    auto t = stage.ps_trans_tbl[stage.state_order[i]];
+                    auto a = stage.ps_act_tbl[stage.state_order[i]];
+                    if(groups.size() == (size_t)node.group_begin || groups.back().mask != t->mask) {
+                        groups.push_back(ParserArcGroup{t->mask, (int)keys.size(), (int)keys.size()});
+                    }
+                    ParserArc arc{a->hdr_id, a->hdr_len, a->next_state, a->miss_act, a->trans_fd_num, {}};
+                    for(int j = 0; j < a->trans_fd_num; j++) {
+                        arc.trans_accs[j] = a->trans_accs[j];
+                    }
+                    keys.emplace_back(t->entry, (int)arcs.size());
+                    arcs.push_back(arc);
+                    groups.back().key_end = (int)keys.size();
+                }
+                node.group_end = (int)groups.size();
             }
         }
-        return res;
+        // within a group a key appears once, the first installed one (stable sort keeps it in front)
+        for(auto & g : groups) {
+            std::stable_sort(keys.begin() + g.key_begin, keys.begin() + g.key_end,
+                             [](const std::pair<uint32_t, int> & x, const std::pair<uint32_t, int> & y) {
+                                 return x.first < y.first;
+                             });
+        }
     }
 
-    void parse(PHV * phv) {
-        int sram_index = -1;
-        for(int i = 0; i < 256; i++) {
-            if((ps_trans_tbl[i]->state == phv->cur_state) &&
-                            (ps_trans_tbl[i]->entry == (phv->cur_trans_key & ps_trans_tbl[i]->mask))) {
-                sram_index = i;
-//                phv->tcam_miss = false;
-                break;
-            }
-        }
-        LOG(INFO) << "          parser entry index: " << sram_index;
+    // no transition out of state at this level, every lookup there misses
+    bool dead_end(int level, uint8_t state) const {
+        auto & node = nodes[level][state];
+        return node.group_begin == node.group_end;
+    }
 
-        if(sram_index == -1) {
-            if(phv->miss_act == 0) {
-                LOG(INFO) << "          accept directly";
-                return;
-            } else if (phv->miss_act == 1){
-                LOG(INFO) << "          drop directly";
-                phv->next_proc_id = -1;
-//                phv->drop = 1;
-                // modify egress port to 0;
-                drop_packet(phv);
-                return;
-            } else {
-                LOG(INFO) << "          accept directly";
-                return;
-//                sram_index = 255 - phv->cur_state; // point to default entry
+    const ParserArc * lookup(int level, uint8_t state, uint32_t key) const {
+        auto & node = nodes[level][state];
+        for(int g = node.group_begin; g < node.group_end; g++) {
+            auto & grp = groups[g];
+            uint32_t k = key & grp.mask;
+            auto it = std::lower_bound(keys.begin() + grp.key_begin, keys.begin() + grp.key_end, k,
+                                       [](const std::pair<uint32_t, int> & x, uint32_t v) {
+                                           return x.first < v;
+                                       });
+            if(it != keys.begin() + grp.key_end && it->first == k) {
+                return &arcs[it->second];
             }
         }
-
-        auto sram_entry = ps_act_tbl[sram_index];
-        auto hdr = phv->parsed_headers[sram_entry->hdr_id];
-
-        phv->valid_bitmap[sram_entry->hdr_id] = 1;
-
-        hdr->hdr_id = sram_entry->hdr_id;
-        hdr->hdr_len = sram_entry->hdr_len;
-        hdr->hdr_offset = phv->cur_offset;
-
-        LOG(INFO) << "          parsed header id: " << (int)hdr->hdr_id;
-        LOG(INFO) << "          parsed header length: " << (int)hdr->hdr_len;
-        LOG(INFO) << "          parsed header offset: " << (int)hdr->hdr_offset;
-
-        phv->bitmap += 1 << (31 - hdr->hdr_id);
-        phv->cur_offset += sram_entry->hdr_len;
-        phv->cur_state = sram_entry->next_state;
-        phv->miss_act = sram_entry->miss_act;
-
-        if(phv->miss_act == 0) {
-            LOG(INFO) << "          accept directly";
-            return;
-        } else if (phv->miss_act == 1){
-            LOG(INFO) << "          drop directly";
-            phv->next_proc_id = -1;
-            drop_packet(phv);
-            return;
-        }
-
-        int _trans_fd_num = sram_entry->trans_fd_num;
-        uint32_t _trans_key = 0;
-
-        for(int i = 0; i < _trans_fd_num; i++) {
-            uint32_t res = get_field_int(phv, sram_entry->trans_fds[i] /*, sram_entry->trans_fds[i]->hdr_id,
-                            sram_entry->trans_fds[i]->internal_offset, sram_entry->trans_fds[i]->fd_len*/);
-            _trans_key += (_trans_key << sram_entry->trans_fds[i]->fd_len) + res;
-        }
-        phv->cur_trans_key = _trans_key;
-
-#ifdef TEST
-        std::cout << "----------------------------" << std::endl;
-        std::cout << "hdr_id: " << (int) hdr->hdr_id << std::endl;
-        std::cout << "hdr_len: " << (int) hdr->hdr_len << std::endl;
-        std::cout << "hdr_offset: " << (int) hdr->hdr_offset << std::endl;
-        std::cout << "cur_state: " << (int) phv->cur_state << std::endl;
-        std::cout << "cur_trans_key: " << (int) phv->cur_trans_key << std::endl;
-#endif
+        return nullptr;
     }
 };
 
@@ -282,16 +379,40 @@ class Parser {
     int needed_parser_level = 0;
     ParserStage * parser_levels;
     int if_work = 0;
+    ParserGraph graph;
+
+    // recompile after any change to the levels, the tables are only read through graph
+    void rebuild() {
+        graph.compile(parser_levels, needed_parser_level);
+    }
 
 public:
     Parser() {
-        parser_levels = new ParserStage[4];
+        parser_levels = new ParserStage[PARSER_LEVEL_NUM];
+        rebuild();
+    }
+
+    Parser(const Parser &) = delete;
+    Parser & operator=(const Parser &) = delete;
+
+    ~Parser() {
+        delete[] parser_levels;
+    }
+
+    void copy_from(const Parser & other) {
+        needed_parser_level = other.needed_parser_level;
+        if_work = other.if_work;
+        for(int i = 0; i < PARSER_LEVEL_NUM; i++) {
+            parser_levels[i].copy_from(other.parser_levels[i]);
+        }
+        graph = other.graph;
     }
 
     void init_parser_level(int parser_level) {
         LOG(INFO) << "Parser level initiated: " << parser_level;
         needed_parser_level = parser_level;
         if_work = 1;
+        rebuild();
     }
 
     void clear() {
@@ -300,16 +421,19 @@ public:
         }
         needed_parser_level = 0;
         if_work = 0;
+        rebuild();
     }
 
-    void modify_parser_entry(int level, uint8_t key[], uint8_t value[]) const {
+    void modify_parser_entry(int level, uint8_t key[], uint8_t value[]) {
         parser_levels[level].modify_trans_act(key, value);
+        rebuild();
     }
 
     void modify_parser_entry_direct(int level, uint8_t state, uint32_t entry, uint32_t mask, uint8_t hdr_id, uint8_t hdr_len,
                             uint8_t next_state, uint8_t trans_fd_num, std::vector<FieldInfo*> trans_fds, uint8_t miss_act) {
         parser_levels[level].modify_trans_entry(state, entry, mask, hdr_id, hdr_len,
                                 next_state, trans_fd_num, std::move(trans_fds), miss_act);
+        rebuild();
     }
 
     void parse(PHV * phv) const {
@@ -319,15 +443,101 @@ public:
         }
         LOG(INFO) << "  Parsing:";
         if(needed_parser_level == 0) return;
-        for(int i = 0; i < needed_parser_level; i++) {
+        // the parse goes on from where an earlier processor left it. a level with no transition out of
+        // the current state would miss and change nothing, so leading ones are not run. a state the
+        // graph loops back into (stacked VLAN/MPLS) has transitions and is parsed again.
+        // on a miss with miss_act 1 the level drops the packet, so then every level runs
+        int first = 0;
+        while(first < needed_parser_level && phv->miss_act != 1 && graph.dead_end(first, (uint8_t) phv->cur_state)) {
+            first++;
+        }
+        if(first == needed_parser_level) {
+            LOG(INFO) << "  nothing left to parse";
+            return;
+        }
+        for(int i = first; i < needed_parser_level; i++) {
             LOG(INFO) << "  parsed by level " << i;
-            parser_levels[i].parse(phv);
+            step(i, phv);
             if(phv->next_proc_id == -1) {
                 return;
             }
         }
 //        std::cout << phv->bitmap << std::endl;
     }
+
+private:
+    // one transition of the compiled graph at the given level
+    void step(int level, PHV * phv) const {
+        auto arc = graph.lookup(level, (uint8_t) phv->cur_state, phv->cur_trans_key);
+
+        if(arc == nullptr) {
+            if(phv->miss_act == 1) {
+                LOG(INFO) << "          drop directly";
+                phv->next_proc_id = -1;
+                // modify egress port to 0;
+                drop_packet(phv);
+            } else {
+                LOG(INFO) << "          accept directly";
+            }
+            return;
+        }
+
+        // the frame is not padded, a header running past its end is left unparsed
+        bool truncated = phv->cur_offset + arc->hdr_len > phv->packet_len * 8;
+        if(phv->flow_patch != nullptr) {
+            phv->flow_patch->note_parsed(phv->cur_offset + arc->hdr_len, truncated);
+        }
+        if(truncated) {
+            LOG(INFO) << "          truncated header " << (int)arc->hdr_id << ", accept directly";
+            phv->miss_act = 0;
+            return;
+        }
+        auto hdr = &phv->parsed_headers[arc->hdr_id];
+
+        phv->valid_bitmap[arc->hdr_id] = 1;
+
+        hdr->hdr_id = arc->hdr_id;
+        hdr->hdr_len = arc->hdr_len;
+        hdr->hdr_offset = phv->cur_offset;
+
+        LOG(INFO) << "          parsed header id: " << (int)hdr->hdr_id;
+        LOG(INFO) << "          parsed header length: " << (int)hdr->hdr_len;
+        LOG(INFO) << "          parsed header offset: " << (int)hdr->hdr_offset;
+
+        phv->bitmap += 1 << (31 - hdr->hdr_id);
+        phv->cur_offset += arc->hdr_len;
+        phv->cur_state = arc->next_state;
+        phv->miss_act = arc->miss_act;
+
+        if(phv->miss_act == 0) {
+            LOG(INFO) << "          accept directly";
+            return;
+        } else if (phv->miss_act == 1){
+            LOG(INFO) << "          drop directly";
+            phv->next_proc_id = -1;
+            drop_packet(phv);
+            return;
+        }
+
+        uint32_t _trans_key = 0;
+        for(int i = 0; i < arc->trans_fd_num; i++) {
+            auto res = (uint32_t) arc->trans_accs[i].read(phv);
+            if(phv->flow_patch != nullptr) {
+                phv->flow_patch->note_read(phv, arc->trans_accs[i]);
+            }
+            _trans_key += (_trans_key << arc->trans_accs[i].fd_len) + res;
+        }
+        phv->cur_trans_key = _trans_key;
+
+#ifdef TEST
+        std::cout << "----------------------------" << std::endl;
+        std::cout << "hdr_id: " << (int) hdr->hdr_id << std::endl;
+        std::cout << "hdr_len: " << (int) hdr->hdr_len << std::endl;
+        std::cout << "hdr_offset: " << (int) hdr->hdr_offset << std::endl;
+        std::cout << "cur_state: " << (int) phv->cur_state << std::endl;
+        std::cout << "cur_trans_key: " << (int) phv->cur_trans_key << std::endl;
+#endif
+    }
 };
 
 
@@ -0,0 +1,56 @@
+//
+// Recycled PHVs, so the data path never allocates them per packet.
+//
+
+#ifndef RECONF_SWITCH_IPSA_PHV_POOL_H
+#define RECONF_SWITCH_IPSA_PHV_POOL_H
+
+#include <vector>
+
+#include "defs.h"
+
+// not thread-safe: acquire and release must happen on the same (receive) thread
+class PhvPool {
+    std::vector<PHV*> free_list;
+    size_t total = 0;
+
+public:
+    explicit PhvPool(size_t size) {
+        free_list.reserve(size);
+        for(size_t i = 0; i < size; i++) {
+            free_list.push_back(new PHV());
+        }
+        total = size;
+    }
+
+    PhvPool(const PhvPool &) = delete;
+    PhvPool & operator=(const PhvPool &) = delete;
+
+    ~PhvPool() {
+        for(auto phv : free_list) {
+            delete phv;
+        }
+    }
+
+    PHV * acquire() {
+        if(free_list.empty()) {
+            total++;
+            LOG_EVERY_N(WARNING, 1024) << "PHV pool exhausted, grown to " << total;
+            return new PHV();
+        }
+        PHV * phv = free_list.back();
+        free_list.pop_back();
+        return phv;
+    }
+
+    void release(PHV * phv) {
+        phv->reset();
+        free_list.push_back(phv);
+    }
+
+    size_t available() const {
+        return free_list.size();
+    }
+};
+
+#endif //RECONF_SWITCH_IPSA_PHV_POOL_H
@@ -6,55 +6,254 @@
 #define RECONF_SWITCH_IPSA_PHYSICAL_LAYER_H
 
 #include <pcap/pcap.h>
+#include <vector>
+#include <sys/epoll.h>
 
 #include "global.h"
 #include "defs.h"
+#include "tpacket_ring.h"
+
+// PCAP: libpcap, one copy per received frame; TPACKET: AF_PACKET mmap'd rings, frames read in place
+enum class IoBackend {
+    PCAP, TPACKET
+};
 
 class PhysicalLayer{
 public:
+    IoBackend backend;
     pcap_t * pcap_handle[8]{};
+    TpacketRing * rings[8]{};
+
+    // pcap reuses its buffer on every pcap_next, so frames of a burst are copied into one slot each
+    std::vector<uint8_t> pcap_frames;
+
+    // one epoll set over every interface fd, used once the receiver stops spinning
+    int epfd = -1;
+    int rx_spin;
+    // interface polled first by the next recv_burst, rotated so no port is always served last
+    int rr_next = 0;
+
+    /**
+     * fanout_group >= 0 puts the socket of interface i into AF_PACKET fanout group fanout_group + i,
+     * so several PhysicalLayers can share the ports, each seeing its own share of the flows
+     */
+    explicit PhysicalLayer(IoBackend _backend = IoBackend::PCAP, int _rx_spin = RX_SPIN_DEFAULT,
+                           int fanout_group = -1)
+            : backend(_backend), rx_spin(_rx_spin) {
+        if(backend == IoBackend::PCAP) {
+            pcap_frames.resize((size_t) PKT_BURST_MAX * MAX_FRAME_LEN);
+        }
 
-    PhysicalLayer() {
         if(glb.if_names.empty()) {
             throw std::runtime_error("No interface specified.");
         }
 
-        char error_buffer[256];
-        for(int i = 0; i < glb.num_if; i++) {
-            pcap_handle[i] = pcap_open_live(glb.if_names[i].c_str(), BUFSIZ, 1, 1, error_buffer);
-            if(pcap_handle[i] == nullptr) {
-                throw std::runtime_error("interface " + glb.if_names[i] + " not found or permission denied.");
-            }
-            pcap_setnonblock(pcap_handle[i], 1, error_buffer);
+        try {
+            open_interfaces(fanout_group);
+        } catch(...) {
+            release();
+            throw;
         }
     }
 
+    PhysicalLayer(const PhysicalLayer &) = delete;
+    PhysicalLayer & operator=(const PhysicalLayer &) = delete;
+
+    ~PhysicalLayer() {
+        release();
+    }
+
     static uint64_t get_ticks() {
         struct timespec tp = {0};
         clock_gettime(CLOCK_MONOTONIC, &tp);
         return (uint64_t) tp.tv_sec * 1000 + (uint64_t) tp.tv_nsec / 1000000;
     }
 
+    /**
+     * receive up to n frames without copying them: with TPACKET the frames point into the RX rings,
+     * with PCAP into pcap_frames. They stay valid until the next receive call.
+     * waits up to timeout ms (forever if negative) for the first frame, then only takes what is ready.
+     * @return number of frames received
+     */
+    int recv_burst(Buffer frames[], uint32_t lens[], int if_indices[], int n, int64_t timeout) {
+        uint64_t begin = get_ticks();
+        if(n > PKT_BURST_MAX) {
+            n = PKT_BURST_MAX;
+        }
+
+        if(backend == IoBackend::TPACKET) {
+            for(int i = 0; i < glb.num_if; i++) {
+                rings[i]->release_consumed();
+            }
+        }
+
+        int cnt = 0;
+        int spins = 0;
+        int start = rr_next;
+        rr_next = (rr_next + 1) % glb.num_if;
+        while(true) {
+            // round robin, at most one frame per interface per pass
+            bool got = false;
+            for(int k = 0; k < glb.num_if && cnt < n; k++) {
+                int if_index = (start + k) % glb.num_if;
+                uint32_t len = recv_one(if_index, cnt, frames[cnt]);
+                if(len) {
+                    lens[cnt] = len;
+                    if_indices[cnt] = if_index;
+                    cnt++;
+                    got = true;
+                }
+            }
+            if(cnt == n || (cnt > 0 && !got)) {
+                return cnt;
+            }
+            if(cnt > 0) {
+                continue;
+            }
+
+            int64_t wait_ms = -1;
+            if(timeout >= 0) {
+                uint64_t now = get_ticks();
+                if(now >= begin + (uint64_t) timeout) {
+                    return 0;
+                }
+                wait_ms = (int64_t) (begin + timeout - now);
+            }
+            // spin while traffic is likely to arrive soon, sleep once the ports have been idle for a while
+            if(epfd < 0 || ++spins < rx_spin) {
+                continue;
+            }
+            spins = 0;
+            epoll_event events[8];
+            epoll_wait(epfd, events, 8, (int) wait_ms);
+        }
+    }
+
+    uint64_t recv_packet_ref(Buffer & frame, int64_t timeout, int &if_index) {
+        uint32_t len = 0;
+        if(recv_burst(&frame, &len, &if_index, 1, timeout) == 0) {
+            return 0;
+        }
+        return len;
+    }
+
     uint64_t recv_packet(Buffer buffer, int64_t timeout, int &if_index) {
-        int64_t begin = get_ticks();
-        if_index = 0;
+        Buffer frame;
+        uint64_t len = recv_packet_ref(frame, timeout, if_index);
+        if(len) {
+            memcpy(buffer, frame, len);
+        }
+        return len;
+    }
 
-        // round robin
-        do {
-            struct pcap_pkthdr hdr;
-            InputBuffer packet = pcap_next(pcap_handle[if_index], &hdr);
-            if (packet) {
-                memcpy(buffer, packet, hdr.caplen);
-                return hdr.caplen;
+    /**
+     * queue one frame for transmission; the buffer may be reused as soon as this returns.
+     * with TPACKET nothing leaves the interface until flush_tx()
+     */
+    int queue_packet(int if_index, InputBuffer buffer, uint32_t len) {
+        if(backend == IoBackend::TPACKET) {
+            if(!rings[if_index]->send_frame(buffer, len)) {
+                return -1;
             }
-            if_index = (if_index + 1) % glb.num_if;
-        } while(get_ticks() < (uint64_t) (begin + timeout) || timeout < 0);
-        return 0;
+            return (int) len;
+        }
+        return pcap_inject(pcap_handle[if_index], buffer, len);
+    }
+
+    // one kick per interface for everything queued since the last flush
+    void flush_tx() {
+        if(backend == IoBackend::TPACKET) {
+            for(int i = 0; i < glb.num_if; i++) {
+                rings[i]->flush();
+            }
+        }
+    }
+
+    /**
+     * @return number of frames queued on if_index, all of them flushed before returning
+     */
+    int send_burst(int if_index, Buffer pkts[], uint32_t lens[], int n) {
+        int sent = 0;
+        for(int i = 0; i < n; i++) {
+            if(queue_packet(if_index, pkts[i], lens[i]) >= 0) {
+                sent++;
+            }
+        }
+        flush_tx();
+        return sent;
     }
 
     int send_packet(int if_index, Buffer buffer, uint32_t len) {
-        std::cout<< ">>>>>> in here" <<std::endl;
-        return pcap_inject(pcap_handle[if_index], buffer, len);
+        int ret = queue_packet(if_index, buffer, len);
+        flush_tx();
+        return ret;
+    }
+
+private:
+    void open_interfaces(int fanout_group) {
+        char error_buffer[256];
+        for(int i = 0; i < glb.num_if; i++) {
+            if(backend == IoBackend::TPACKET) {
+                rings[i] = new TpacketRing(glb.if_names[i]);
+                if(fanout_group >= 0) {
+                    rings[i]->join_fanout((uint16_t) (fanout_group + i));
+                }
+                continue;
+            }
+            pcap_handle[i] = pcap_open_live(glb.if_names[i].c_str(), MAX_FRAME_LEN, 1, 1, error_buffer);
+            if(pcap_handle[i] == nullptr) {
+                throw std::runtime_error("interface " + glb.if_names[i] + " not found or permission denied.");
+            }
+            pcap_setnonblock(pcap_handle[i], 1, error_buffer);
+            // on linux the selectable fd is pcap's own AF_PACKET socket, already bound to the port
+            if(fanout_group >= 0 && !join_packet_fanout(pcap_get_selectable_fd(pcap_handle[i]),
+                                                        (uint16_t) (fanout_group + i))) {
+                throw std::runtime_error("interface " + glb.if_names[i] + ": PACKET_FANOUT: " + strerror(errno));
+            }
+        }
+
+        epfd = epoll_create1(0);
+        for(int i = 0; i < glb.num_if && epfd >= 0; i++) {
+            int fd = backend == IoBackend::TPACKET ? rings[i]->fd() : pcap_get_selectable_fd(pcap_handle[i]);
+            epoll_event ev{};
+            ev.events = EPOLLIN;
+            ev.data.u32 = i;
+            if(fd < 0 || epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+                LOG(WARNING) << "interface " << glb.if_names[i] << " is not pollable, receiver will busy poll";
+                close(epfd);
+                epfd = -1;
+            }
+        }
+    }
+
+    // also undoes a constructor that threw halfway
+    void release() {
+        if(epfd >= 0) {
+            close(epfd);
+            epfd = -1;
+        }
+        for(int i = 0; i < 8; i++) {
+            delete rings[i];
+            rings[i] = nullptr;
+            if(pcap_handle[i] != nullptr) {
+                pcap_close(pcap_handle[i]);
+                pcap_handle[i] = nullptr;
+            }
+        }
+    }
+
+    uint32_t recv_one(int if_index, int slot, Buffer & frame) {
+        if(backend == IoBackend::TPACKET) {
+            return rings[if_index]->next_frame(frame);
+        }
+        struct pcap_pkthdr hdr;
+        InputBuffer packet = pcap_next(pcap_handle[if_index], &hdr);
+        if(packet == nullptr) {
+            return 0;
+        }
+        frame = pcap_frames.data() + (size_t) slot * MAX_FRAME_LEN;
+        memcpy(frame, packet, hdr.caplen);
+        return hdr.caplen;
     }
 };
 
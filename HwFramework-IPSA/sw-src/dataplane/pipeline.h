@@ -5,12 +5,14 @@
 #ifndef RECONF_SWITCH_IPSA_PIPELINE_H
 #define RECONF_SWITCH_IPSA_PIPELINE_H
 
+#include <memory>
 #include <utility>
 
 #include "processor.h"
 
 class Pipeline {
-    std::vector<Processor*> procs;
+    // shared with the other pipelines built from this one, see PipelineHandle
+    std::vector<std::shared_ptr<Processor>> procs;
     int proc_num{};
 
     std::vector<HeaderInfo*> meta_infos;
@@ -21,12 +23,25 @@ public:
     Pipeline(int _proc_num) {
         proc_num = _proc_num;
         for(int i = 0; i < proc_num; i++) {
-            auto proc = new Processor();
+            auto proc = std::make_shared<Processor>();
             proc->set_proc_id(i);
             procs.push_back(proc);
         }
     }
 
+    // same processors and metadata
+    Pipeline(const Pipeline & other) : procs(other.procs), proc_num(other.proc_num), meta_infos(other.meta_infos) {}
+
+    Pipeline & operator=(const Pipeline &) = delete;
+
+    // a copy of processor proc_id in its place, entries and memory included; pipelines sharing the old
+    // one keep it. changes to the copy never reach the old one, which packets may still be running
+    void copy_processor(int proc_id) {
+        auto proc = std::make_shared<Processor>();
+        proc->copy_from(*procs[proc_id]);
+        procs[proc_id] = proc;
+    }
+
     void execute(PHV * phv) {
         while(true) {
             int cur_proc_id = phv->next_proc_id;
@@ -42,6 +57,18 @@ public:
         }
     }
 
+    // run the packet for as long as it stays on processors [first, last]; one stage of the stage-pipelined mode
+    void execute_range(PHV * phv, int first, int last) {
+        while(phv->next_proc_id >= first && phv->next_proc_id <= last) {
+            LOG(INFO) << "Packet processed by processor " << phv->next_proc_id;
+            procs[phv->next_proc_id]->process_packet(phv);
+        }
+    }
+
+    int get_proc_num() const {
+        return proc_num;
+    }
+
     void set_metadata_header(std::vector<HeaderInfo*> _meta_infos) {
         meta_infos.clear();
         LOG(INFO) << "Print Metadata Init: " ;
@@ -154,28 +181,89 @@ public:
         procs[proc_id]->set_no_table(matcher_id, _no_table);
     }
 
-    void insert_sram_entry(int proc_id, int idx, uint8_t * key, uint8_t * value, int key_byte_len, int value_byte_len) {
+    // false if the arguments are invalid or the table is full; stats, if given, gets the table's occupancy
+    bool insert_sram_entry(int proc_id, int idx, uint8_t * key, uint8_t * value, int key_byte_len, int value_byte_len,
+                           ExactTableStats * stats = nullptr) {
         if (proc_id < 0 || proc_id >= (int)procs.size()) {
             LOG(ERROR) << "insert_sram_entry: invalid proc_id " << proc_id;
-            return;
+            return false;
         }
         if (idx < 0 || idx >= 16) {  // MATCHER_THREAD_NUM = 16
             LOG(ERROR) << "insert_sram_entry: invalid idx " << idx << " for processor " << proc_id;
-            return;
+            return false;
+        }
+        auto mt = procs[proc_id]->matcher->mts[idx];
+        bool ok = mt->insert_sram_entry(key, value, key_byte_len, value_byte_len);
+        if(stats != nullptr) {
+            *stats = mt->exact_stats();
         }
-        procs[proc_id]->matcher->mts[idx]->insert_sram_entry(key, value, key_byte_len, value_byte_len);
+        return ok;
     }
 
-    void insert_tcam_entry(int proc_id, int idx, uint8_t * key, uint8_t * mask, uint8_t * value, int key_byte_len, int value_byte_len) {
+    bool insert_tcam_entry(int proc_id, int idx, uint8_t * key, uint8_t * mask, uint8_t * value, int key_byte_len, int value_byte_len) {
         if (proc_id < 0 || proc_id >= (int)procs.size()) {
             LOG(ERROR) << "insert_tcam_entry: invalid proc_id " << proc_id;
-            return;
+            return false;
         }
         if (idx < 0 || idx >= 16) {  // MATCHER_THREAD_NUM = 16
             LOG(ERROR) << "insert_tcam_entry: invalid idx " << idx << " for processor " << proc_id;
-            return;
+            return false;
+        }
+        return procs[proc_id]->matcher->mts[idx]->insert_tcam_entry(key, mask, value, key_byte_len, value_byte_len);
+    }
+
+    bool modify_sram_entry(int proc_id, int idx, const uint8_t * key, const uint8_t * value, int key_byte_len,
+                           int value_byte_len) {
+        if (proc_id < 0 || proc_id >= (int)procs.size()) {
+            LOG(ERROR) << "modify_sram_entry: invalid proc_id " << proc_id;
+            return false;
+        }
+        if (idx < 0 || idx >= 16) {  // MATCHER_THREAD_NUM = 16
+            LOG(ERROR) << "modify_sram_entry: invalid idx " << idx << " for processor " << proc_id;
+            return false;
+        }
+        return procs[proc_id]->modify_sram_entry(idx, key, value, key_byte_len, value_byte_len);
+    }
+
+    bool delete_sram_entry(int proc_id, int idx, const uint8_t * key, int key_byte_len, ExactTableStats * stats = nullptr) {
+        if (proc_id < 0 || proc_id >= (int)procs.size()) {
+            LOG(ERROR) << "delete_sram_entry: invalid proc_id " << proc_id;
+            return false;
+        }
+        if (idx < 0 || idx >= 16) {  // MATCHER_THREAD_NUM = 16
+            LOG(ERROR) << "delete_sram_entry: invalid idx " << idx << " for processor " << proc_id;
+            return false;
+        }
+        bool ok = procs[proc_id]->delete_sram_entry(idx, key, key_byte_len);
+        if(stats != nullptr) {
+            *stats = procs[proc_id]->matcher->mts[idx]->exact_stats();
+        }
+        return ok;
+    }
+
+    bool modify_tcam_entry(int proc_id, int idx, const uint8_t * key, const uint8_t * mask, const uint8_t * value,
+                           int key_byte_len, int value_byte_len) {
+        if (proc_id < 0 || proc_id >= (int)procs.size()) {
+            LOG(ERROR) << "modify_tcam_entry: invalid proc_id " << proc_id;
+            return false;
+        }
+        if (idx < 0 || idx >= 16) {  // MATCHER_THREAD_NUM = 16
+            LOG(ERROR) << "modify_tcam_entry: invalid idx " << idx << " for processor " << proc_id;
+            return false;
+        }
+        return procs[proc_id]->modify_tcam_entry(idx, key, mask, value, key_byte_len, value_byte_len);
+    }
+
+    bool delete_tcam_entry(int proc_id, int idx, const uint8_t * key, const uint8_t * mask, int key_byte_len) {
+        if (proc_id < 0 || proc_id >= (int)procs.size()) {
+            LOG(ERROR) << "delete_tcam_entry: invalid proc_id " << proc_id;
+            return false;
+        }
+        if (idx < 0 || idx >= 16) {  // MATCHER_THREAD_NUM = 16
+            LOG(ERROR) << "delete_tcam_entry: invalid idx " << idx << " for processor " << proc_id;
+            return false;
         }
-        procs[proc_id]->matcher->mts[idx]->insert_tcam_entry(key, mask, value, key_byte_len, value_byte_len);
+        return procs[proc_id]->delete_tcam_entry(idx, key, mask, key_byte_len);
     }
 
     void set_field_infos(int proc_id, int idx, std::vector<FieldInfo*> _fdInfos) {
@@ -221,8 +309,9 @@ public:
         procs[proc_id]->exe->insert_action(ac, action_id);
     }
 
-    void del_action(int proc_id, int action_id) {
-        procs[proc_id]->del_action(action_id);
+    // the action stays alive as long as a processor still holds it, see Executor
+    bool del_action(int proc_id, int action_id) {
+        return procs[proc_id]->del_action(action_id);
     }
 
     void clear_action(int proc_id) {
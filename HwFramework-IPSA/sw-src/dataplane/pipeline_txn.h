@@ -0,0 +1,155 @@
+//
+// The live pipeline, the shadow a config transaction builds next to it, and the pipelines packets still run on.
+//
+
+#ifndef RECONF_SWITCH_IPSA_PIPELINE_TXN_H
+#define RECONF_SWITCH_IPSA_PIPELINE_TXN_H
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "global.h"
+#include "pipeline.h"
+
+// how often the server deletes the pipelines packets have let go of
+const static int PIPELINE_RECLAIM_INTERVAL_MS = 100;
+
+// what a packet is pinned to on the receive thread: the live pipeline and the config epoch it came with
+struct PipelinePin {
+    uint64_t epoch = 0;
+    std::shared_ptr<Pipeline> pipe;
+};
+
+/**
+ * owner of every pipeline packets may run on. the receive thread pins the live pipeline to each burst
+ * and keeps the pin until the burst's packets are done, so each runs one config from its first processor
+ * to its last.
+ * a transaction builds the next config in a shadow pipeline that shares the live processors until the
+ * transaction first configures one; that one is replaced by a copy in the shadow, table entries included,
+ * with SRAM and TCAM blocks of its own. commit publishes the shadow with one atomic swap.
+ * unpublished pipelines are kept until no pin holds them. processors and actions are shared between
+ * pipelines through shared_ptr, so each goes with the last pipeline holding it. reclaim runs on every
+ * config call and, so the last ones go even when the controller stays quiet, every
+ * PIPELINE_RECLAIM_INTERVAL_MS from the server.
+ * the config side is not thread-safe, the server serializes it
+ */
+class PipelineHandle {
+    std::shared_ptr<Pipeline> live; // only through std::atomic_load/atomic_store
+    std::shared_ptr<Pipeline> shadow;
+    // processors of the shadow already replaced
+    std::vector<bool> replaced;
+    std::deque<std::shared_ptr<Pipeline>> unpublished;
+
+    void publish(std::shared_ptr<Pipeline> next) {
+        unpublished.push_back(std::atomic_load(&live));
+        std::atomic_store(&live, std::move(next));
+        reclaim();
+    }
+
+    Pipeline * live_pipeline() const {
+        // the config thread is the only one storing live, the pointer stays valid while it runs
+        return std::atomic_load(&live).get();
+    }
+
+public:
+    explicit PipelineHandle(Pipeline * pipe) {
+        std::atomic_store(&live, std::shared_ptr<Pipeline>(pipe));
+    }
+
+    PipelineHandle(const PipelineHandle &) = delete;
+    PipelineHandle & operator=(const PipelineHandle &) = delete;
+
+    // packet side, once per burst. the epoch is read first: a pin never pairs a new epoch with an old pipeline
+    PipelinePin pin() const {
+        PipelinePin p;
+        p.epoch = glb.config_epoch.load(std::memory_order_acquire);
+        p.pipe = std::atomic_load(&live);
+        return p;
+    }
+
+    bool in_transaction() const {
+        return shadow != nullptr;
+    }
+
+    bool begin() {
+        reclaim();
+        if(shadow != nullptr) {
+            LOG(WARNING) << "begin config: a transaction is already open";
+            return false;
+        }
+        shadow = std::make_shared<Pipeline>(*live_pipeline());
+        replaced.assign(shadow->get_proc_num(), false);
+        return true;
+    }
+
+    bool commit() {
+        if(shadow == nullptr) {
+            LOG(WARNING) << "commit config: no transaction is open";
+            return false;
+        }
+        publish(std::move(shadow));
+        shadow = nullptr;
+        replaced.clear();
+        return true;
+    }
+
+    bool abort() {
+        if(shadow == nullptr) {
+            return false;
+        }
+        // no packet ever saw the shadow
+        shadow = nullptr;
+        replaced.clear();
+        reclaim();
+        return true;
+    }
+
+    // where a config call for processor proc_id goes: the live pipeline, or the shadow of the open transaction
+    Pipeline * config_target(int proc_id) {
+        if(shadow == nullptr) {
+            return live_pipeline();
+        }
+        if(proc_id >= 0 && proc_id < (int) replaced.size() && !replaced[proc_id]) {
+            shadow->copy_processor(proc_id);
+            replaced[proc_id] = true;
+        }
+        return shadow.get();
+    }
+
+    // where a pipeline-wide config call goes
+    Pipeline * pipeline_target() {
+        return shadow != nullptr ? shadow.get() : live_pipeline();
+    }
+
+    /**
+     * where table entries for processor proc_id go: the shadow once the open transaction has copied the
+     * processor, so they are in place when it is published; the copy has memory of its own, so they do
+     * not touch the rows of the processor packets still run on. the live pipeline otherwise
+     */
+    Pipeline * entry_target(int proc_id) {
+        if(shadow != nullptr && proc_id >= 0 && proc_id < (int) replaced.size() && replaced[proc_id]) {
+            return shadow.get();
+        }
+        return live_pipeline();
+    }
+
+    // delete the unpublished pipelines no pin holds any more
+    void reclaim() {
+        for(auto it = unpublished.begin(); it != unpublished.end();) {
+            if(it->use_count() == 1) {
+                std::atomic_thread_fence(std::memory_order_acquire);
+                it = unpublished.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    size_t unpublished_num() const {
+        return unpublished.size();
+    }
+};
+
+#endif //RECONF_SWITCH_IPSA_PIPELINE_TXN_H
@@ -25,12 +25,39 @@ public:
         proc_id = 0;
         parser = new Parser();
         gateway = new Gateway();
+        matcher = nullptr;
         exe = new Executor();
     }
 
-    void set_proc_id(int _proc_id){
+    Processor(const Processor &) = delete;
+    Processor & operator=(const Processor &) = delete;
+
+    ~Processor() {
+        delete parser;
+        delete gateway;
+        delete matcher;
+        delete exe;
+    }
+
+    // mem: own SRAM and TCAM blocks for the tables, else the cluster's physical ones
+    void set_proc_id(int _proc_id, const std::shared_ptr<ClusterMemory> & mem = nullptr){
         proc_id = _proc_id;
-        matcher = new Matcher(_proc_id);
+        matcher = new Matcher(_proc_id, mem);
+    }
+
+    /**
+     * become a copy of other: config, table entries and the memory they sit in. the tables get SRAM and
+     * TCAM blocks of their own, so entries written here never reach rows other is still looked up in.
+     * the actions are shared with other
+     */
+    void copy_from(const Processor & other) {
+        proc_id = other.proc_id;
+        parser->copy_from(*other.parser);
+        gateway->copy_from(*other.gateway);
+        delete matcher;
+        matcher = new Matcher(proc_id, std::make_shared<ClusterMemory>());
+        matcher->copy_from(*other.matcher);
+        exe->copy_from(*other.exe);
     }
 
     void process_packet(PHV * phv) const{
@@ -64,7 +91,10 @@ public:
         for(auto it : matcher->mts[phv->next_op.val]->action_proc_map) {
             LOG(INFO) << "          " << it.first << " : " << it.second;
         }
-        phv->next_proc_id = matcher->mts[phv->next_op.val]->action_proc_map[phv->next_action_id];
+        // find, not operator[]: workers share the map and must not insert into it
+        auto & action_proc_map = matcher->mts[phv->next_op.val]->action_proc_map;
+        auto next_proc = action_proc_map.find(phv->next_action_id);
+        phv->next_proc_id = next_proc == action_proc_map.end() ? 0 : next_proc->second;
         LOG(INFO) << "      phv->next_proc_id: " << phv->next_proc_id;
         exe->execute(phv);
 
@@ -199,12 +229,29 @@ public:
         matcher->mts[idx]->set_mem_config(key_width, value_width, depth, key_config, value_config);
     }
 
-    void insert_sram_entry(int idx, uint8_t * key, uint8_t * value, int key_byte_len, int value_byte_len) const {
-        matcher->mts[idx]->insert_sram_entry(key, value, key_byte_len, value_byte_len);
+    bool insert_sram_entry(int idx, uint8_t * key, uint8_t * value, int key_byte_len, int value_byte_len) const {
+        return matcher->mts[idx]->insert_sram_entry(key, value, key_byte_len, value_byte_len);
+    }
+
+    bool insert_tcam_entry(int idx, uint8_t * key, uint8_t * mask, uint8_t * value, int key_byte_len, int value_byte_len) const {
+        return matcher->mts[idx]->insert_tcam_entry(key, mask, value, key_byte_len, value_byte_len);
+    }
+
+    bool modify_sram_entry(int idx, const uint8_t * key, const uint8_t * value, int key_byte_len, int value_byte_len) const {
+        return matcher->modify_sram_entry(idx, key, value, key_byte_len, value_byte_len);
+    }
+
+    bool delete_sram_entry(int idx, const uint8_t * key, int key_byte_len) const {
+        return matcher->delete_sram_entry(idx, key, key_byte_len);
+    }
+
+    bool modify_tcam_entry(int idx, const uint8_t * key, const uint8_t * mask, const uint8_t * value, int key_byte_len,
+                           int value_byte_len) const {
+        return matcher->modify_tcam_entry(idx, key, mask, value, key_byte_len, value_byte_len);
     }
 
-    void insert_tcam_entry(int idx, uint8_t * key, uint8_t * mask, uint8_t * value, int key_byte_len, int value_byte_len) const {
-        matcher->mts[idx]->insert_tcam_entry(key, mask, value, key_byte_len, value_byte_len);
+    bool delete_tcam_entry(int idx, const uint8_t * key, const uint8_t * mask, int key_byte_len) const {
+        return matcher->delete_tcam_entry(idx, key, mask, key_byte_len);
     }
 
     void set_field_infos(int idx, std::vector<FieldInfo*> _fdInfos) const {
@@ -238,8 +285,8 @@ public:
         exe->insert_action(ac, action_id);
     }
 
-    void del_action(int action_id) const {
-        exe->del_action(action_id);
+    bool del_action(int action_id) const {
+        return exe->del_action(action_id);
     }
 
     void clear_action() const {
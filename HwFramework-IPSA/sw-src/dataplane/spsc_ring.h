@@ -0,0 +1,94 @@
+//
+// Bounded lock-free single-producer/single-consumer ring.
+//
+
+#ifndef RECONF_SWITCH_IPSA_SPSC_RING_H
+#define RECONF_SWITCH_IPSA_SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// exactly one thread may push and exactly one thread may pop; capacity is rounded up to a power of two
+template <typename T>
+class SpscRing {
+    std::vector<T> slots;
+    size_t mask;
+
+    // written by the consumer, read by the producer
+    alignas(64) std::atomic<size_t> head{0};
+    // written by the producer, read by the consumer
+    alignas(64) std::atomic<size_t> tail{0};
+
+    // each side's last view of the other index, refreshed only when the ring looks full / empty
+    alignas(64) size_t head_cache = 0;
+    alignas(64) size_t tail_cache = 0;
+
+public:
+    explicit SpscRing(size_t capacity) {
+        size_t cap = 1;
+        while(cap < capacity) {
+            cap <<= 1;
+        }
+        slots.resize(cap);
+        mask = cap - 1;
+    }
+
+    SpscRing(const SpscRing &) = delete;
+    SpscRing & operator=(const SpscRing &) = delete;
+
+    // plain operator new only guarantees max_align_t before C++17, the indices need their own cache lines
+    static void * operator new(size_t size) {
+        size_t align = alignof(SpscRing);
+        void * p = aligned_alloc(align, (size + align - 1) / align * align);
+        if(p == nullptr) {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+
+    static void operator delete(void * p) {
+        free(p);
+    }
+
+    size_t capacity() const {
+        return mask + 1;
+    }
+
+    // producer side
+    bool push(const T & item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if(t - head_cache > mask) {
+            head_cache = head.load(std::memory_order_acquire);
+            if(t - head_cache > mask) {
+                return false;
+            }
+        }
+        slots[t & mask] = item;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumer side
+    bool pop(T & item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if(h == tail_cache) {
+            tail_cache = tail.load(std::memory_order_acquire);
+            if(h == tail_cache) {
+                return false;
+            }
+        }
+        item = slots[h & mask];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // approximate unless called from the producer or consumer thread
+    size_t size() const {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+};
+
+#endif //RECONF_SWITCH_IPSA_SPSC_RING_H
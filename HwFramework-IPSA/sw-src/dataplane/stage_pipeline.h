@@ -0,0 +1,220 @@
+//
+// Stage-pipelined execution: processors split into groups, one thread per group,
+// PHVs handed between groups over SPSC rings.
+//
+
+#ifndef RECONF_SWITCH_IPSA_STAGE_PIPELINE_H
+#define RECONF_SWITCH_IPSA_STAGE_PIPELINE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <thread>
+#include <vector>
+
+#include "pipeline.h"
+#include "spsc_ring.h"
+
+struct StageJob {
+    PHV * phv;
+    uint32_t len;
+    // given up on by a stuck stage, the receive thread releases it without emitting
+    bool dropped = false;
+};
+
+// jobs one stage may hold back while the rings it forwards to are full
+const static int STAGE_BACKLOG_MAX = WORKER_RING_SIZE;
+// passes with a full backlog and nothing moving before the stage drops its oldest job
+const static int STAGE_DROP_PASSES = 4096;
+
+/**
+ * Every (producer, consumer) pair gets its own ring, so each ring stays single-producer/single-consumer:
+ * rings[from][to], where index num_stages stands for the receive thread as producer and for the exit
+ * back to it as consumer. A stage runs its processors until phv->next_proc_id leaves its range and then
+ * forwards the PHV to the stage owning that processor. A full downstream ring does not stop the stage
+ * from draining its own inputs, since a processor graph that jumps backwards can make that ring wait on
+ * them: the job is parked in the stage's backlog and handed on once there is room. Only a full backlog
+ * stalls the stage, and one that stays stuck drops its oldest job. Stalls and drops are counted per stage.
+ */
+class StagePipeline {
+    struct StageStats {
+        std::atomic<uint64_t> processed{0};
+        std::atomic<uint64_t> stalls{0};
+        std::atomic<uint64_t> dropped{0};
+    };
+
+    // owned by one stage thread, one FIFO per destination so the jobs of a flow keep their order
+    struct Backlog {
+        std::vector<std::deque<StageJob>> to;
+        int size = 0;
+    };
+
+    int num_stages;
+    std::vector<int> stage_first;
+    std::vector<int> stage_last;
+    // processor id -> stage
+    std::vector<int> stage_of;
+
+    std::vector<std::vector<SpscRing<StageJob>*>> rings;
+    std::vector<StageStats*> stats;
+    // receive-thread side
+    int exit_cursor = 0;
+
+    int dest_of(const PHV * phv) const {
+        int proc_id = phv->next_proc_id;
+        if(proc_id < 0 || proc_id >= (int)stage_of.size()) {
+            return num_stages;
+        }
+        return stage_of[proc_id];
+    }
+
+    void forward(int from, const StageJob & job, Backlog & backlog) {
+        int dest = dest_of(job.phv);
+        if(backlog.to[dest].empty() && rings[from][dest]->push(job)) {
+            return;
+        }
+        stats[from]->stalls.fetch_add(1, std::memory_order_relaxed);
+        backlog.to[dest].push_back(job);
+        backlog.size++;
+    }
+
+    // hand on what fits, oldest first. @return whether any job left the backlog
+    bool flush(int from, Backlog & backlog) {
+        bool moved = false;
+        for(int dest = 0; dest <= num_stages && backlog.size > 0; dest++) {
+            auto & queue = backlog.to[dest];
+            while(!queue.empty() && rings[from][dest]->push(queue.front())) {
+                queue.pop_front();
+                backlog.size--;
+                moved = true;
+            }
+        }
+        return moved;
+    }
+
+    // the oldest job waiting for a stage goes to the exit instead; the exit ring always drains
+    void drop_oldest(int from, Backlog & backlog) {
+        for(int dest = 0; dest < num_stages; dest++) {
+            auto & queue = backlog.to[dest];
+            if(queue.empty()) {
+                continue;
+            }
+            StageJob job = queue.front();
+            queue.pop_front();
+            job.dropped = true;
+            backlog.to[num_stages].push_back(job);
+            stats[from]->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    void stage_loop(int stage) {
+        int idle = 0;
+        int stuck = 0;
+        int cursor = 0;
+        Backlog backlog;
+        backlog.to.resize(num_stages + 1);
+        while(true) {
+            bool moved = backlog.size > 0 && flush(stage, backlog);
+            StageJob job{};
+            bool got = false;
+            // round robin over the upstream rings, for as long as the backlog has room
+            for(int k = 0; k <= num_stages && !got && backlog.size < STAGE_BACKLOG_MAX; k++) {
+                int from = (cursor + k) % (num_stages + 1);
+                if(rings[from][stage]->pop(job)) {
+                    got = true;
+                    cursor = from + 1;
+                }
+            }
+            if(got) {
+                idle = 0;
+                stuck = 0;
+                job.phv->pipe->execute_range(job.phv, stage_first[stage], stage_last[stage]);
+                stats[stage]->processed.fetch_add(1, std::memory_order_relaxed);
+                forward(stage, job, backlog);
+                continue;
+            }
+            if(backlog.size > 0) {
+                if(moved || backlog.size < STAGE_BACKLOG_MAX) {
+                    stuck = 0;
+                } else if(++stuck > STAGE_DROP_PASSES) {
+                    drop_oldest(stage, backlog);
+                    stuck = 0;
+                }
+                std::this_thread::yield();
+                continue;
+            }
+            if(++idle > RX_SPIN_DEFAULT) {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+    }
+
+public:
+    // every PHV brings its own pipeline, only the processor count is fixed up front
+    StagePipeline(int proc_num, int _num_stages) {
+        num_stages = std::max(1, std::min(_num_stages, proc_num));
+
+        // contiguous groups, the first proc_num % num_stages stages take one extra processor
+        int first = 0;
+        for(int s = 0; s < num_stages; s++) {
+            int count = proc_num / num_stages + (s < proc_num % num_stages ? 1 : 0);
+            stage_first.push_back(first);
+            stage_last.push_back(first + count - 1);
+            for(int i = 0; i < count; i++) {
+                stage_of.push_back(s);
+            }
+            first += count;
+            stats.push_back(new StageStats());
+        }
+
+        rings.resize(num_stages + 1);
+        for(int from = 0; from <= num_stages; from++) {
+            for(int to = 0; to <= num_stages; to++) {
+                rings[from].push_back(new SpscRing<StageJob>(WORKER_RING_SIZE));
+            }
+        }
+    }
+
+    void start() {
+        for(int s = 0; s < num_stages; s++) {
+            LOG(INFO) << "Stage " << s << " runs processors " << stage_first[s] << " to " << stage_last[s];
+            std::thread(&StagePipeline::stage_loop, this, s).detach();
+        }
+    }
+
+    int get_num_stages() const {
+        return num_stages;
+    }
+
+    /**
+     * receive thread only: hand a fresh PHV to the stage owning phv->next_proc_id
+     * @return false if that stage is backed up and the packet was not taken
+     */
+    bool inject(const StageJob & job) {
+        return rings[num_stages][dest_of(job.phv)]->push(job);
+    }
+
+    // receive thread only: take one PHV that left the pipeline
+    bool poll_exit(StageJob & job) {
+        for(int k = 0; k <= num_stages; k++) {
+            int from = (exit_cursor + k) % (num_stages + 1);
+            if(rings[from][num_stages]->pop(job)) {
+                exit_cursor = from + 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void log_stats() const {
+        for(int s = 0; s < num_stages; s++) {
+            LOG(INFO) << "Stage " << s << ": processed " << stats[s]->processed.load(std::memory_order_relaxed)
+                      << ", stalled " << stats[s]->stalls.load(std::memory_order_relaxed)
+                      << ", dropped " << stats[s]->dropped.load(std::memory_order_relaxed);
+        }
+    }
+};
+
+#endif //RECONF_SWITCH_IPSA_STAGE_PIPELINE_H
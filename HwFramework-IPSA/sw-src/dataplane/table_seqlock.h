@@ -0,0 +1,126 @@
+//
+// Keeps table updates from the config thread apart from packet lookups, without locks on the lookup side.
+//
+
+#ifndef RECONF_SWITCH_IPSA_TABLE_SEQLOCK_H
+#define RECONF_SWITCH_IPSA_TABLE_SEQLOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <immintrin.h>
+
+#include <glog/logging.h>
+
+// threads that may ever look a table up: receive thread, workers, stage threads
+const static int TABLE_READER_MAX = 256;
+
+// the table a thread is looking up, nullptr between lookups; a cache line each, readers never share one
+struct alignas(64) TableReaderSlot {
+    std::atomic<const void *> table{nullptr};
+};
+
+/**
+ * seqlock of one match table. seq is odd while an update is being written. a lookup publishes the
+ * table in its thread's slot before it reads seq, and steps back while seq is odd; an update makes seq
+ * odd and then waits until no slot names the table. so an update has the table to itself: lookups
+ * never see a torn row, and the update may also grow or free the index structures a lookup walks,
+ * which a read-then-validate seqlock could not allow. a lookup stores to its own slot only, it never
+ * writes a line other threads read on the fast path. updates are serialized among themselves by a mutex
+ */
+class TableSeqLock {
+    std::atomic<uint32_t> seq{0};
+    std::mutex update_mu;
+
+    static TableReaderSlot * slots() {
+        static TableReaderSlot all[TABLE_READER_MAX];
+        return all;
+    }
+
+    static std::atomic<int> & slot_num() {
+        static std::atomic<int> num{0};
+        return num;
+    }
+
+    // handed out on the thread's first lookup and kept for its lifetime
+    static TableReaderSlot * my_slot() {
+        static thread_local TableReaderSlot * mine = nullptr;
+        if(mine == nullptr) {
+            int i = slot_num().fetch_add(1);
+            if(i >= TABLE_READER_MAX) {
+                LOG(FATAL) << "more than " << TABLE_READER_MAX << " threads look tables up";
+            }
+            mine = &slots()[i];
+        }
+        return mine;
+    }
+
+public:
+    void read_begin() {
+        auto slot = my_slot();
+        while(true) {
+            slot->table.store(this, std::memory_order_seq_cst);
+            if((seq.load(std::memory_order_seq_cst) & 1) == 0) {
+                return;
+            }
+            slot->table.store(nullptr, std::memory_order_release);
+            while(seq.load(std::memory_order_acquire) & 1) {
+                _mm_pause();
+            }
+        }
+    }
+
+    void read_end() {
+        my_slot()->table.store(nullptr, std::memory_order_release);
+    }
+
+    void write_begin() {
+        update_mu.lock();
+        seq.fetch_add(1, std::memory_order_seq_cst);
+        int num = std::min(slot_num().load(std::memory_order_seq_cst), TABLE_READER_MAX);
+        for(int i = 0; i < num; i++) {
+            while(slots()[i].table.load(std::memory_order_seq_cst) == this) {
+                _mm_pause();
+            }
+        }
+    }
+
+    void write_end() {
+        seq.fetch_add(1, std::memory_order_release);
+        update_mu.unlock();
+    }
+};
+
+class TableReadGuard {
+    TableSeqLock & lock;
+
+public:
+    explicit TableReadGuard(TableSeqLock & _lock) : lock(_lock) {
+        lock.read_begin();
+    }
+
+    ~TableReadGuard() {
+        lock.read_end();
+    }
+
+    TableReadGuard(const TableReadGuard &) = delete;
+    TableReadGuard & operator=(const TableReadGuard &) = delete;
+};
+
+class TableWriteGuard {
+    TableSeqLock & lock;
+
+public:
+    explicit TableWriteGuard(TableSeqLock & _lock) : lock(_lock) {
+        lock.write_begin();
+    }
+
+    ~TableWriteGuard() {
+        lock.write_end();
+    }
+
+    TableWriteGuard(const TableWriteGuard &) = delete;
+    TableWriteGuard & operator=(const TableWriteGuard &) = delete;
+};
+
+#endif //RECONF_SWITCH_IPSA_TABLE_SEQLOCK_H
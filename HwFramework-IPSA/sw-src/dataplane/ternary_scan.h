@@ -0,0 +1,181 @@
+//
+// Brute-force ternary match over packed rows, AVX2 when the CPU has it.
+//
+
+#ifndef RECONF_SWITCH_IPSA_TERNARY_SCAN_H
+#define RECONF_SWITCH_IPSA_TERNARY_SCAN_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <immintrin.h>
+
+/**
+ * the rows of a ternary table laid out for a linear scan: column w holds 64-bit word w of every row's key
+ * (and mask), 32-byte aligned and padded to a multiple of 4 rows, so one 256-bit load covers 4 rows.
+ * a row matches when (query & mask) == key in every word; the first matching row wins, as in a TCAM.
+ * AVX2 is picked at run time, the build does not need -mavx2.
+ */
+class TernaryScan {
+    int words = 0;
+    int rows = 0;
+    int cap = 0;
+    uint64_t * keys = nullptr; // words columns of cap entries
+    uint64_t * masks = nullptr;
+    bool use_avx2 = false;
+
+    void grow(int need) {
+        int new_cap = cap == 0 ? 64 : cap;
+        while(new_cap < need) {
+            new_cap *= 2;
+        }
+        size_t bytes = (size_t) new_cap * words * sizeof(uint64_t);
+        auto k = (uint64_t *) aligned_alloc(32, bytes);
+        auto m = (uint64_t *) aligned_alloc(32, bytes);
+        // padding rows have key ~0 under mask 0, they never match
+        for(int i = 0; i < new_cap * words; i++) {
+            k[i] = ~0ULL;
+        }
+        memset(m, 0, bytes);
+        for(int w = 0; w < words && rows > 0; w++) {
+            memcpy(k + (size_t) w * new_cap, keys + (size_t) w * cap, rows * sizeof(uint64_t));
+            memcpy(m + (size_t) w * new_cap, masks + (size_t) w * cap, rows * sizeof(uint64_t));
+        }
+        free(keys);
+        free(masks);
+        keys = k;
+        masks = m;
+        cap = new_cap;
+    }
+
+    int scan_scalar(const uint64_t * q) const {
+        for(int r = 0; r < rows; r++) {
+            bool match = true;
+            for(int w = 0; w < words && match; w++) {
+                match = (q[w] & masks[(size_t) w * cap + r]) == keys[(size_t) w * cap + r];
+            }
+            if(match) {
+                return r;
+            }
+        }
+        return -1;
+    }
+
+    __attribute__((target("avx2")))
+    int scan_avx2(const uint64_t * q) const {
+        for(int r = 0; r < rows; r += 4) {
+            __m256i eq = _mm256_set1_epi64x(-1);
+            for(int w = 0; w < words; w++) {
+                __m256i qw = _mm256_set1_epi64x((long long) q[w]);
+                __m256i m = _mm256_load_si256((const __m256i *) (masks + (size_t) w * cap + r));
+                __m256i k = _mm256_load_si256((const __m256i *) (keys + (size_t) w * cap + r));
+                eq = _mm256_and_si256(eq, _mm256_cmpeq_epi64(_mm256_and_si256(qw, m), k));
+            }
+            int hits = _mm256_movemask_pd(_mm256_castsi256_pd(eq));
+            if(hits != 0) {
+                return r + __builtin_ctz(hits);
+            }
+        }
+        return -1;
+    }
+
+public:
+    TernaryScan() {
+        use_avx2 = __builtin_cpu_supports("avx2");
+    }
+
+    TernaryScan(const TernaryScan &) = delete;
+    TernaryScan & operator=(const TernaryScan &) = delete;
+
+    ~TernaryScan() {
+        free(keys);
+        free(masks);
+    }
+
+    void copy_from(const TernaryScan & other) {
+        reset(0);
+        words = other.words;
+        rows = other.rows;
+        cap = other.cap;
+        if(cap > 0) {
+            size_t bytes = (size_t) cap * words * sizeof(uint64_t);
+            keys = (uint64_t *) aligned_alloc(32, bytes);
+            masks = (uint64_t *) aligned_alloc(32, bytes);
+            memcpy(keys, other.keys, bytes);
+            memcpy(masks, other.masks, bytes);
+        }
+    }
+
+    // key bytes per row, rounded up to whole words
+    void reset(int key_len) {
+        free(keys);
+        free(masks);
+        keys = masks = nullptr;
+        words = (key_len + 7) / 8;
+        rows = 0;
+        cap = 0;
+    }
+
+    int row_num() const {
+        return rows;
+    }
+
+    int word_num() const {
+        return words;
+    }
+
+    // write row (key_len bytes of key and mask, as given to reset), growing the table up to it
+    void set_row(int row, const uint8_t * key, const uint8_t * mask, int key_len) {
+        if(words == 0) {
+            return;
+        }
+        if(row >= cap) {
+            grow(row + 1);
+        }
+        for(int w = 0; w < words; w++) {
+            uint64_t k = 0, m = 0;
+            int n = key_len - w * 8 < 8 ? key_len - w * 8 : 8;
+            memcpy(&k, key + w * 8, n);
+            memcpy(&m, mask + w * 8, n);
+            keys[(size_t) w * cap + row] = k;
+            masks[(size_t) w * cap + row] = m;
+        }
+        for(int r = rows; r < row; r++) {
+            // rows skipped over stay unmatchable
+            for(int w = 0; w < words; w++) {
+                keys[(size_t) w * cap + r] = ~0ULL;
+                masks[(size_t) w * cap + r] = 0;
+            }
+        }
+        if(row >= rows) {
+            rows = row + 1;
+        }
+    }
+
+    // make row unmatchable, the rows behind it keep their places
+    void clear_row(int row) {
+        if(row < 0 || row >= rows) {
+            return;
+        }
+        for(int w = 0; w < words; w++) {
+            keys[(size_t) w * cap + row] = ~0ULL;
+            masks[(size_t) w * cap + row] = 0;
+        }
+    }
+
+    // drop the rows from n on, they were all cleared
+    void truncate(int n) {
+        if(n < rows) {
+            rows = n;
+        }
+    }
+
+    // first row matching q, words * 8 bytes zero padded past the key; -1 if none
+    int lookup(const uint8_t * q_bytes) const {
+        uint64_t q[words > 0 ? words : 1];
+        memcpy(q, q_bytes, words * sizeof(uint64_t));
+        return use_avx2 ? scan_avx2(q) : scan_scalar(q);
+    }
+};
+
+#endif //RECONF_SWITCH_IPSA_TERNARY_SCAN_H
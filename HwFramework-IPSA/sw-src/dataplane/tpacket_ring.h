@@ -0,0 +1,278 @@
+//
+// AF_PACKET TPACKET_V3 mmap'd rings, one RX ring and one TX ring per interface.
+//
+
+#ifndef RECONF_SWITCH_IPSA_TPACKET_RING_H
+#define RECONF_SWITCH_IPSA_TPACKET_RING_H
+
+#include <string>
+#include <stdexcept>
+
+#include <sys/socket.h>
+#include <sys/mman.h>
+#include <poll.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <linux/if_packet.h>
+#include <linux/if_ether.h>
+
+#include "defs.h"
+
+// RX: variable-length frames packed into blocks that the kernel retires after
+// TPACKET_RX_RETIRE_TOV ms even when not full, so latency stays bounded at low load.
+const static int TPACKET_RX_BLOCK_SIZE = 1 << 18;
+const static int TPACKET_RX_BLOCK_NUM = 64;
+const static int TPACKET_RX_FRAME_SIZE = 2048;
+const static int TPACKET_RX_RETIRE_TOV = 1;
+
+// TX: fixed-size slots, each holding one outgoing frame; sized for MAX_FRAME_LEN jumbo frames.
+const static int TPACKET_TX_BLOCK_SIZE = 1 << 18;
+const static int TPACKET_TX_BLOCK_NUM = 64;
+const static int TPACKET_TX_FRAME_SIZE = 1 << 14;
+
+/**
+ * add an AF_PACKET socket to fanout group, hashed by flow: the kernel hands every flow of the
+ * port to one socket of the group, so its packets stay in order. the socket must be bound
+ * @return false if the kernel refused, errno tells why
+ */
+static inline bool join_packet_fanout(int fd, uint16_t group) {
+    int arg = group | (PACKET_FANOUT_HASH << 16);
+    return setsockopt(fd, SOL_PACKET, PACKET_FANOUT, &arg, sizeof(arg)) == 0;
+}
+
+class TpacketRing {
+    std::string if_name;
+    int sock = -1;
+
+    uint8_t * map = nullptr;
+    size_t map_len = 0;
+
+    tpacket_req3 rx_req{};
+    uint8_t * rx_ring = nullptr;
+    unsigned rx_block_idx = 0;
+    tpacket3_hdr * rx_hdr = nullptr;  // next frame inside the current block
+    uint32_t rx_frames_left = 0;
+    // blocks whose last frame has been handed out, they may still back frames the caller holds.
+    // the block being read is not among them until its last frame is out
+    unsigned rx_release_idx = 0;
+    unsigned rx_pending_release = 0;
+
+    tpacket_req3 tx_req{};
+    uint8_t * tx_ring = nullptr;
+    unsigned tx_frame_idx = 0;
+    unsigned tx_frame_num = 0;
+    unsigned tx_pending = 0;
+
+    tpacket_block_desc * rx_block(unsigned idx) const {
+        return (tpacket_block_desc *) (rx_ring + (size_t) idx * rx_req.tp_block_size);
+    }
+
+    tpacket3_hdr * tx_frame(unsigned idx) const {
+        return (tpacket3_hdr *) (tx_ring + (size_t) idx * tx_req.tp_frame_size);
+    }
+
+    void fail(const std::string & what) {
+        int err = errno;
+        if(map != nullptr) {
+            munmap(map, map_len);
+            map = nullptr;
+        }
+        if(sock >= 0) {
+            close(sock);
+            sock = -1;
+        }
+        throw std::runtime_error("tpacket " + if_name + ": " + what + ": " + strerror(err));
+    }
+
+public:
+    explicit TpacketRing(const std::string & _if_name) : if_name(_if_name) {
+        sock = socket(AF_PACKET, SOCK_RAW, htons(ETH_P_ALL));
+        if(sock < 0) {
+            fail("socket");
+        }
+
+        int version = TPACKET_V3;
+        if(setsockopt(sock, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) < 0) {
+            fail("PACKET_VERSION");
+        }
+
+        // frames are handed to the NIC directly, the kernel qdisc only adds latency here
+        int bypass = 1;
+        setsockopt(sock, SOL_PACKET, PACKET_QDISC_BYPASS, &bypass, sizeof(bypass));
+
+        rx_req.tp_block_size = TPACKET_RX_BLOCK_SIZE;
+        rx_req.tp_block_nr = TPACKET_RX_BLOCK_NUM;
+        rx_req.tp_frame_size = TPACKET_RX_FRAME_SIZE;
+        rx_req.tp_frame_nr = (TPACKET_RX_BLOCK_SIZE / TPACKET_RX_FRAME_SIZE) * TPACKET_RX_BLOCK_NUM;
+        rx_req.tp_retire_blk_tov = TPACKET_RX_RETIRE_TOV;
+        if(setsockopt(sock, SOL_PACKET, PACKET_RX_RING, &rx_req, sizeof(rx_req)) < 0) {
+            fail("PACKET_RX_RING");
+        }
+
+        tx_req.tp_block_size = TPACKET_TX_BLOCK_SIZE;
+        tx_req.tp_block_nr = TPACKET_TX_BLOCK_NUM;
+        tx_req.tp_frame_size = TPACKET_TX_FRAME_SIZE;
+        tx_req.tp_frame_nr = (TPACKET_TX_BLOCK_SIZE / TPACKET_TX_FRAME_SIZE) * TPACKET_TX_BLOCK_NUM;
+        if(setsockopt(sock, SOL_PACKET, PACKET_TX_RING, &tx_req, sizeof(tx_req)) < 0) {
+            fail("PACKET_TX_RING");
+        }
+        tx_frame_num = tx_req.tp_frame_nr;
+
+        size_t rx_len = (size_t) rx_req.tp_block_size * rx_req.tp_block_nr;
+        size_t tx_len = (size_t) tx_req.tp_block_size * tx_req.tp_block_nr;
+        map_len = rx_len + tx_len;
+        // the kernel lays the RX ring out first and the TX ring right after it
+        void * addr = mmap(nullptr, map_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, sock, 0);
+        if(addr == MAP_FAILED) {
+            fail("mmap");
+        }
+        map = (uint8_t *) addr;
+        rx_ring = map;
+        tx_ring = map + rx_len;
+
+        sockaddr_ll sll{};
+        sll.sll_family = AF_PACKET;
+        sll.sll_protocol = htons(ETH_P_ALL);
+        sll.sll_ifindex = (int) if_nametoindex(if_name.c_str());
+        if(sll.sll_ifindex == 0) {
+            fail("interface not found");
+        }
+        if(bind(sock, (sockaddr *) &sll, sizeof(sll)) < 0) {
+            fail("bind");
+        }
+
+        packet_mreq mreq{};
+        mreq.mr_ifindex = sll.sll_ifindex;
+        mreq.mr_type = PACKET_MR_PROMISC;
+        if(setsockopt(sock, SOL_PACKET, PACKET_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
+            fail("PACKET_MR_PROMISC");
+        }
+
+        LOG(INFO) << "tpacket ring on " << if_name << ": rx " << rx_len << " bytes, tx "
+                  << tx_frame_num << " frames";
+    }
+
+    TpacketRing(const TpacketRing &) = delete;
+    TpacketRing & operator=(const TpacketRing &) = delete;
+
+    ~TpacketRing() {
+        if(map != nullptr) {
+            munmap(map, map_len);
+        }
+        if(sock >= 0) {
+            close(sock);
+        }
+    }
+
+    int fd() const {
+        return sock;
+    }
+
+    void join_fanout(uint16_t group) {
+        if(!join_packet_fanout(sock, group)) {
+            fail("PACKET_FANOUT");
+        }
+    }
+
+    /**
+     * hand every fully read block back to the kernel; frames returned by next_frame()
+     * before this call must not be touched afterwards. a partly read block stays with us
+     */
+    void release_consumed() {
+        while(rx_pending_release > 0) {
+            auto desc = rx_block(rx_release_idx);
+            __sync_synchronize();
+            desc->hdr.bh1.block_status = TP_STATUS_KERNEL;
+            rx_release_idx = (rx_release_idx + 1) % rx_req.tp_block_nr;
+            rx_pending_release--;
+        }
+    }
+
+    /**
+     * return the next received frame in place in the ring, or 0 if none is ready.
+     * the frame stays valid until release_consumed() is called.
+     */
+    uint32_t next_frame(Buffer & frame) {
+        while(true) {
+            if(rx_frames_left == 0) {
+                // every block is waiting for release_consumed(), nothing more to read
+                if(rx_pending_release == rx_req.tp_block_nr) {
+                    return 0;
+                }
+                auto desc = rx_block(rx_block_idx);
+                if((desc->hdr.bh1.block_status & TP_STATUS_USER) == 0) {
+                    return 0;
+                }
+                __sync_synchronize();
+                rx_frames_left = desc->hdr.bh1.num_pkts;
+                rx_hdr = (tpacket3_hdr *) ((uint8_t *) desc + desc->hdr.bh1.offset_to_first_pkt);
+                rx_block_idx = (rx_block_idx + 1) % rx_req.tp_block_nr;
+                if(rx_frames_left == 0) {
+                    rx_pending_release++;
+                    continue;
+                }
+            }
+
+            auto hdr = rx_hdr;
+            rx_frames_left--;
+            rx_hdr = (tpacket3_hdr *) ((uint8_t *) hdr + hdr->tp_next_offset);
+            if(rx_frames_left == 0) {
+                rx_pending_release++;
+            }
+
+            // our own transmissions show up as outgoing frames on the same socket
+            auto sll = (sockaddr_ll *) ((uint8_t *) hdr + TPACKET_ALIGN(sizeof(tpacket3_hdr)));
+            if(sll->sll_pkttype == PACKET_OUTGOING) {
+                continue;
+            }
+
+            frame = (uint8_t *) hdr + hdr->tp_mac;
+            return hdr->tp_snaplen;
+        }
+    }
+
+    /**
+     * copy one frame into the next free TX slot; nothing is sent until flush()
+     * @return false if the ring is full or the frame does not fit in a slot
+     */
+    bool send_frame(InputBuffer buffer, uint32_t len) {
+        uint32_t data_off = TPACKET3_HDRLEN - sizeof(sockaddr_ll);
+        if(len + data_off > (uint32_t) tx_req.tp_frame_size) {
+            LOG(ERROR) << "tpacket " << if_name << ": frame of " << len << " bytes exceeds tx slot";
+            return false;
+        }
+
+        auto hdr = tx_frame(tx_frame_idx);
+        if(hdr->tp_status != TP_STATUS_AVAILABLE) {
+            // let the kernel drain what is queued and give it one chance to free a slot
+            flush();
+            pollfd pfd{sock, POLLOUT, 0};
+            poll(&pfd, 1, 1);
+            if(hdr->tp_status != TP_STATUS_AVAILABLE) {
+                return false;
+            }
+        }
+
+        memcpy((uint8_t *) hdr + data_off, buffer, len);
+        hdr->tp_len = len;
+        hdr->tp_snaplen = len;
+        hdr->tp_next_offset = 0;
+        __sync_synchronize();
+        hdr->tp_status = TP_STATUS_SEND_REQUEST;
+
+        tx_frame_idx = (tx_frame_idx + 1) % tx_frame_num;
+        tx_pending++;
+        return true;
+    }
+
+    // one syscall pushes every frame queued by send_frame() since the last flush
+    int flush() {
+        if(tx_pending == 0) {
+            return 0;
+        }
+        tx_pending = 0;
+        return (int) send(sock, nullptr, 0, MSG_DONTWAIT);
+    }
+};
+
+#endif //RECONF_SWITCH_IPSA_TPACKET_RING_H
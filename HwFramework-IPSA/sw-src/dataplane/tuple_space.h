@@ -0,0 +1,168 @@
+//
+// Tuple space search over the rows of a ternary table.
+//
+
+#ifndef RECONF_SWITCH_IPSA_TUPLE_SPACE_H
+#define RECONF_SWITCH_IPSA_TUPLE_SPACE_H
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "defs.h"
+#include "../util/MurmurHash3.h"
+
+/**
+ * index of ternary rules by mask. rules sharing a mask form a tuple, and within a tuple the masked key
+ * is hashed, so a lookup costs one hash probe per distinct mask. a lower row is a higher priority,
+ * which is the order the rows are installed in; tuples are visited best row first and the search
+ * stops once no remaining tuple can beat the match found so far.
+ * the rows themselves (key, mask, value) stay in the TCAM/SRAM slices, only the index lives here.
+ */
+class TupleSpace {
+    struct Tuple {
+        std::vector<uint8_t> mask;
+        int min_row;
+        // hash of the masked key -> rows, ascending
+        std::unordered_map<uint32_t, std::vector<int>> buckets;
+    };
+
+    int key_len = 0;
+    std::vector<Tuple> tuples;
+    // masked key of every indexed row, key_len bytes each
+    std::vector<uint8_t> row_keys;
+
+    uint32_t hash(const uint8_t * masked) const {
+        uint32_t h = 0;
+        MurmurHash3_x86_32(masked, key_len, 0, &h);
+        return h;
+    }
+
+public:
+    // key bytes compared; rules and lookups are cut to this length
+    void reset(int _key_len) {
+        key_len = _key_len;
+        tuples.clear();
+        row_keys.clear();
+    }
+
+    int get_key_len() const {
+        return key_len;
+    }
+
+    size_t tuple_num() const {
+        return tuples.size();
+    }
+
+    /**
+     * index row for key/mask. a rule with key bits outside its mask can never match and is not indexed,
+     * false in that case
+     */
+    bool insert(int row, const uint8_t * key, const uint8_t * mask) {
+        for(int i = 0; i < key_len; i++) {
+            if(key[i] & ~mask[i]) {
+                return false;
+            }
+        }
+        if(row_keys.size() < (size_t)(row + 1) * key_len) {
+            row_keys.resize((size_t)(row + 1) * key_len);
+        }
+        memcpy(row_keys.data() + (size_t)row * key_len, key, key_len);
+
+        auto t = std::find_if(tuples.begin(), tuples.end(), [&](const Tuple & tp) {
+            return memcmp(tp.mask.data(), mask, key_len) == 0;
+        });
+        if(t == tuples.end()) {
+            tuples.push_back(Tuple{std::vector<uint8_t>(mask, mask + key_len), row, {}});
+            t = tuples.end() - 1;
+        }
+        auto & rows = t->buckets[hash(key)];
+        rows.insert(std::upper_bound(rows.begin(), rows.end(), row), row);
+        if(row < t->min_row) {
+            t->min_row = row;
+        }
+        std::stable_sort(tuples.begin(), tuples.end(), [](const Tuple & a, const Tuple & b) {
+            return a.min_row < b.min_row;
+        });
+        return true;
+    }
+
+    // lowest indexed row with exactly this key and mask, -1 if none
+    int find(const uint8_t * key, const uint8_t * mask) const {
+        for(auto & t : tuples) {
+            if(memcmp(t.mask.data(), mask, key_len) != 0) {
+                continue;
+            }
+            auto it = t.buckets.find(hash(key));
+            if(it == t.buckets.end()) {
+                return -1;
+            }
+            for(int row : it->second) {
+                if(memcmp(row_keys.data() + (size_t)row * key_len, key, key_len) == 0) {
+                    return row;
+                }
+            }
+            return -1;
+        }
+        return -1;
+    }
+
+    /**
+     * drop row, indexed under key/mask. a tuple keeps its min_row until it empties; a stale (too low)
+     * min_row only makes lookups visit it earlier, it never skips a match
+     */
+    void remove(int row, const uint8_t * key, const uint8_t * mask) {
+        for(size_t i = 0; i < tuples.size(); i++) {
+            auto & t = tuples[i];
+            if(memcmp(t.mask.data(), mask, key_len) != 0) {
+                continue;
+            }
+            auto it = t.buckets.find(hash(key));
+            if(it == t.buckets.end()) {
+                return;
+            }
+            auto & rows = it->second;
+            auto r = std::lower_bound(rows.begin(), rows.end(), row);
+            if(r == rows.end() || *r != row) {
+                return;
+            }
+            rows.erase(r);
+            if(rows.empty()) {
+                t.buckets.erase(it);
+            }
+            if(t.buckets.empty()) {
+                tuples.erase(tuples.begin() + i);
+            }
+            return;
+        }
+    }
+
+    // best (lowest) row matching key, -1 if none. scratch holds key_len bytes
+    int lookup(const uint8_t * key, uint8_t * scratch) const {
+        int best = -1;
+        for(auto & t : tuples) {
+            if(best >= 0 && best < t.min_row) {
+                break;
+            }
+            for(int i = 0; i < key_len; i++) {
+                scratch[i] = key[i] & t.mask[i];
+            }
+            auto it = t.buckets.find(hash(scratch));
+            if(it == t.buckets.end()) {
+                continue;
+            }
+            for(int row : it->second) {
+                if(best >= 0 && row >= best) {
+                    break;
+                }
+                if(memcmp(row_keys.data() + (size_t)row * key_len, scratch, key_len) == 0) {
+                    best = row;
+                    break;
+                }
+            }
+        }
+        return best;
+    }
+};
+
+#endif //RECONF_SWITCH_IPSA_TUPLE_SPACE_H
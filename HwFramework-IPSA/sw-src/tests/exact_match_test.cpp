@@ -0,0 +1,127 @@
+//
+// Randomized check of the cuckoo hash exact match table against a plain map: inserts, modifies and
+// deletes over a key space larger than the table, so the stash and the full table are exercised too.
+//
+
+#include <cstdio>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "dataplane/global.h"
+#include "dataplane/matcher_c.h"
+
+#include <glog/logging.h>
+
+const static int KEY_LEN = 8;
+const static int VALUE_LEN = SRAM_WIDTH / 8;
+const static int KEY_SPACE = 1500;
+const static int OP_NUM = 300000;
+// two-choice buckets of 4 with a stash should fill past this before refusing a key
+const static double MIN_LOAD = 0.9;
+
+typedef std::vector<uint8_t> Bytes;
+
+static Bytes make_key(int k) {
+    Bytes key(MATCH_KEY_MAX, 0);
+    for(int i = 0; i < KEY_LEN; i++) {
+        key[i] = (uint8_t) ((k * 2654435761u) >> (i * 4));
+    }
+    key[KEY_LEN - 1] = (uint8_t) k;
+    key[KEY_LEN - 2] = (uint8_t) (k >> 8);
+    return key;
+}
+
+static bool lookup_equals(MatcherThread & mt, Bytes key, const std::map<int, Bytes> & ref, int k) {
+    Arena arena;
+    auto value = mt.get_match_res(key.data(), KEY_LEN, arena);
+    auto it = ref.find(k);
+    if(it == ref.end()) {
+        return value == nullptr;
+    }
+    return value != nullptr && memcmp(value, it->second.data(), VALUE_LEN) == 0;
+}
+
+int main() {
+    FLAGS_minloglevel = 2;
+    init_mem();
+
+    MatcherThread mt(0);
+    mt.init_match_type(MatchType::EXACT);
+    uint8_t key_config[] = {0};
+    uint8_t value_config[] = {1};
+    mt.set_mem_config(1, 1, 1, key_config, value_config);
+
+    std::mt19937 rng(7);
+    std::map<int, Bytes> ref;
+    int failures = 0, full = 0;
+    for(int op = 0; op < OP_NUM && failures < 10; op++) {
+        int k = (int) (rng() % KEY_SPACE);
+        Bytes key = make_key(k);
+        Bytes value(VALUE_LEN);
+        for(auto & b : value) {
+            b = (uint8_t) rng();
+        }
+        bool present = ref.count(k) > 0;
+        switch(rng() % 4) {
+            case 0 :
+            case 1 : {
+                bool ok = mt.insert_sram_entry(key.data(), value.data(), KEY_LEN, VALUE_LEN);
+                if(ok) {
+                    ref[k] = value;
+                } else if(present) {
+                    fprintf(stderr, "op %d: insert over existing key %d failed\n", op, k);
+                    failures++;
+                } else if(ref.size() < MIN_LOAD * mt.exact_stats().capacity) {
+                    fprintf(stderr, "op %d: insert refused with only %zu of %d rows used\n", op, ref.size(),
+                            mt.exact_stats().capacity);
+                    failures++;
+                } else {
+                    full++;
+                }
+                break;
+            }
+            case 2 : {
+                bool ok = mt.modify_sram_entry(key.data(), value.data(), KEY_LEN, VALUE_LEN);
+                if(ok != present) {
+                    fprintf(stderr, "op %d: modify of key %d returned %d\n", op, k, ok);
+                    failures++;
+                }
+                if(ok) {
+                    ref[k] = value;
+                }
+                break;
+            }
+            default : {
+                bool ok = mt.delete_sram_entry(key.data(), KEY_LEN);
+                if(ok != present) {
+                    fprintf(stderr, "op %d: delete of key %d returned %d\n", op, k, ok);
+                    failures++;
+                }
+                ref.erase(k);
+                break;
+            }
+        }
+        if(!lookup_equals(mt, key, ref, k)) {
+            fprintf(stderr, "op %d: lookup of key %d disagrees with the map\n", op, k);
+            failures++;
+        }
+        if(op % 10000 == 0) {
+            for(int j = 0; j < KEY_SPACE; j++) {
+                if(!lookup_equals(mt, make_key(j), ref, j)) {
+                    fprintf(stderr, "op %d: full check, key %d disagrees with the map\n", op, j);
+                    failures++;
+                    break;
+                }
+            }
+            if(mt.exact_stats().occupancy != (int) ref.size()) {
+                fprintf(stderr, "op %d: occupancy %d, map holds %zu\n", op, mt.exact_stats().occupancy, ref.size());
+                failures++;
+            }
+        }
+    }
+
+    printf("exact match: %d ops, %zu entries at the end, %d inserts refused as full, %d failures\n",
+           OP_NUM, ref.size(), full, failures);
+    return failures == 0 ? 0 : 1;
+}
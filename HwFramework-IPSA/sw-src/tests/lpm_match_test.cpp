@@ -0,0 +1,139 @@
+//
+// Randomized check of an LPM table against a longest-prefix search over the live prefixes.
+// Prefixes nest heavily, are reinstalled, modified and deleted, and the table is kept near its
+// TCAM slice's size, so deleted rows are handed to new prefixes.
+//
+
+#include <cstdio>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "dataplane/global.h"
+#include "dataplane/matcher_c.h"
+
+#include <glog/logging.h>
+
+const static int KEY_LEN = 4;
+const static int VALUE_LEN = SRAM_WIDTH / 8;
+const static int ROWS = 1 << TCAM_DEPTH;
+const static int OP_NUM = 60000;
+const static int QUERY_NUM = 4;
+
+typedef std::vector<uint8_t> Bytes;
+// (prefix length, masked key) -> value
+typedef std::map<std::pair<int, uint32_t>, Bytes> RefTable;
+
+static uint32_t prefix_mask(int plen) {
+    return plen == 0 ? 0 : 0xffffffffu << (32 - plen);
+}
+
+static Bytes to_bytes(uint32_t v) {
+    Bytes b(MATCH_KEY_MAX, 0);
+    for(int i = 0; i < KEY_LEN; i++) {
+        b[i] = (uint8_t) (v >> (24 - 8 * i));
+    }
+    return b;
+}
+
+// bytes drawn from a small set, so prefixes nest and queries hit them
+static uint32_t random_addr(std::mt19937 & rng) {
+    static const uint8_t bytes[] = {0x00, 0x0a, 0x80, 0xc0, 0xff};
+    uint32_t v = 0;
+    for(int i = 0; i < KEY_LEN; i++) {
+        v = (v << 8) | bytes[rng() % sizeof(bytes)];
+    }
+    return v ^ (rng() % 4 == 0 ? (uint32_t) rng() & 0x0f0f : 0);
+}
+
+static const Bytes * ref_lookup(const RefTable & ref, uint32_t q) {
+    for(int plen = 32; plen >= 0; plen--) {
+        auto it = ref.find(std::make_pair(plen, q & prefix_mask(plen)));
+        if(it != ref.end()) {
+            return &it->second;
+        }
+    }
+    return nullptr;
+}
+
+int main() {
+    FLAGS_minloglevel = 2;
+    init_mem();
+
+    MatcherThread mt(0);
+    mt.init_match_type(MatchType::LPM);
+    uint8_t key_config[] = {0};
+    uint8_t value_config[] = {0};
+    mt.set_mem_config(1, 1, 1, key_config, value_config);
+
+    std::mt19937 rng(5);
+    RefTable ref;
+    std::vector<std::pair<int, uint32_t>> live;
+    int failures = 0;
+    for(int op = 0; op < OP_NUM && failures < 10; op++) {
+        int plen = (int) (rng() % 33);
+        uint32_t addr = random_addr(rng) & prefix_mask(plen);
+        int dice = (int) (rng() % 8);
+        if(dice >= 5 && !live.empty()) {
+            // an installed prefix
+            auto p = live[rng() % live.size()];
+            plen = p.first;
+            addr = p.second;
+        }
+        auto id = std::make_pair(plen, addr);
+        bool present = ref.count(id) > 0;
+        Bytes key = to_bytes(addr), mask = to_bytes(prefix_mask(plen)), value(VALUE_LEN);
+        for(auto & b : value) {
+            b = (uint8_t) rng();
+        }
+
+        if(dice < 5) {
+            bool ok = mt.insert_tcam_entry(key.data(), mask.data(), value.data(), KEY_LEN, VALUE_LEN);
+            if(ok != (present || (int) ref.size() < ROWS)) {
+                fprintf(stderr, "op %d: insert of /%d returned %d with %zu prefixes\n", op, plen, ok, ref.size());
+                failures++;
+            }
+            if(ok) {
+                if(!present) {
+                    live.push_back(id);
+                }
+                ref[id] = value;
+            }
+        } else if(dice == 5) {
+            bool ok = mt.modify_tcam_entry(key.data(), mask.data(), value.data(), KEY_LEN, VALUE_LEN);
+            if(ok != present) {
+                fprintf(stderr, "op %d: modify of /%d returned %d\n", op, plen, ok);
+                failures++;
+            }
+            if(ok) {
+                ref[id] = value;
+            }
+        } else {
+            bool ok = mt.delete_tcam_entry(key.data(), mask.data(), KEY_LEN);
+            if(ok != present) {
+                fprintf(stderr, "op %d: delete of /%d returned %d\n", op, plen, ok);
+                failures++;
+            }
+            if(present) {
+                ref.erase(id);
+                live.erase(std::find(live.begin(), live.end(), id));
+            }
+        }
+
+        for(int q = 0; q < QUERY_NUM; q++) {
+            uint32_t addr_q = random_addr(rng);
+            Bytes query = to_bytes(addr_q);
+            Arena arena;
+            auto got = mt.get_match_res(query.data(), KEY_LEN, arena);
+            auto want = ref_lookup(ref, addr_q);
+            if((got == nullptr) != (want == nullptr) || (got != nullptr && memcmp(got, want->data(), VALUE_LEN) != 0)) {
+                fprintf(stderr, "op %d: lookup of %08x disagrees with the longest prefix search\n", op, addr_q);
+                failures++;
+                break;
+            }
+        }
+    }
+
+    printf("lpm match: %d ops, %zu prefixes at the end, %d failures\n", OP_NUM, ref.size(), failures);
+    return failures == 0 ? 0 : 1;
+}
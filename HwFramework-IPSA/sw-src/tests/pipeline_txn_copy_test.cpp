@@ -0,0 +1,120 @@
+//
+// Config transactions on a configured processor: the first config call on it copies parser, gateway,
+// table entries and actions into the shadow, so a partial change keeps everything else, and neither
+// the change nor later table writes reach a pipeline packets may still run on.
+//
+
+#include <cstdio>
+
+#include "dataplane/global.h"
+#include "dataplane/pipeline_txn.h"
+#include "dataplane/phv_pool.h"
+
+#include <glog/logging.h>
+
+const static int HDR_ID = 1;
+const static int KEY_LEN = 4;
+const static int VALUE_LEN = SRAM_WIDTH / 8;
+const static int HIT_ACT = 1;
+const static int MISS_ACT = 2;
+const static int NEW_MISS_ACT = 3;
+
+static int failures = 0;
+
+static void expect(bool cond, const char * what) {
+    if(!cond) {
+        fprintf(stderr, "failed: %s\n", what);
+        failures++;
+    }
+}
+
+static bool insert_key(Pipeline * pipe, uint8_t k) {
+    uint8_t key[MATCH_KEY_MAX]{0x0a, 0, 0, k};
+    uint8_t value[VALUE_LEN]{0, HIT_ACT};
+    return pipe->insert_sram_entry(0, 0, key, value, KEY_LEN, VALUE_LEN);
+}
+
+/**
+ * processor 0 parses HDR_ID, its gateway always goes to table 0, an exact table on the first
+ * KEY_LEN bytes of the header. keys 0a:00:00:01 and 0a:00:00:02 hit HIT_ACT, everything else
+ * misses to MISS_ACT, both leave the pipeline
+ */
+static Pipeline * build() {
+    auto pipe = new Pipeline(1);
+    pipe->init_parser_level(0, 1);
+    pipe->modify_parser_entry_direct(0, 0, 0, 0, 0, HDR_ID, 112, 0, 0, {}, 0);
+    pipe->set_default_entry(0, GateEntryType::TABLE, 0);
+
+    uint8_t key_config[] = {0};
+    uint8_t value_config[] = {1};
+    pipe->init_match_type(0, 0, MatchType::EXACT);
+    pipe->set_mem_config(0, 0, 1, 1, 1, key_config, value_config);
+    pipe->set_field_infos(0, 0, {new FieldInfo{HDR_ID, 0, KEY_LEN * 8, FieldType::FIELD}});
+    pipe->set_action_proc_map(0, 0, {{HIT_ACT, -1}, {MISS_ACT, -1}, {NEW_MISS_ACT, -1}});
+    pipe->set_miss_act_id(0, 0, MISS_ACT);
+    for(int act : {HIT_ACT, MISS_ACT, NEW_MISS_ACT}) {
+        pipe->insert_action(0, new Action(), act);
+    }
+    insert_key(pipe, 1);
+    insert_key(pipe, 2);
+    return pipe;
+}
+
+// the action a frame carrying key 0a:00:00:k ends with on pipe, -1 if it did not get to the table
+static int run(PhvPool & pool, Pipeline * pipe, uint8_t k) {
+    uint8_t frame[64]{0x0a, 0, 0, k};
+    PHV * phv = pool.acquire();
+    phv->pipe = pipe;
+    phv->attach(frame, sizeof(frame));
+    pipe->execute(phv);
+    int act = phv->valid_bitmap[HDR_ID] && phv->next_proc_id == -1 ? phv->next_action_id : -1;
+    pool.release(phv);
+    return act;
+}
+
+int main() {
+    FLAGS_minloglevel = 2;
+    init_mem();
+
+    PipelineHandle handle(build());
+    PhvPool pool(PHV_POOL_SIZE);
+    PipelinePin first = handle.pin();
+    expect(run(pool, first.pipe.get(), 1) == HIT_ACT, "configured pipeline hits key 1");
+    expect(run(pool, first.pipe.get(), 9) == MISS_ACT, "configured pipeline misses key 9");
+
+    // a partial change: only the miss action, parser, gateway, entries and actions must survive it
+    handle.begin();
+    handle.config_target(0)->set_miss_act_id(0, 0, NEW_MISS_ACT);
+    expect(run(pool, handle.pin().pipe.get(), 9) == MISS_ACT, "uncommitted change is not live");
+    handle.commit();
+    PipelinePin second = handle.pin();
+    expect(second.pipe != first.pipe, "commit publishes a new pipeline");
+    expect(run(pool, second.pipe.get(), 1) == HIT_ACT, "entries survive a partial change");
+    expect(run(pool, second.pipe.get(), 2) == HIT_ACT, "every entry survives a partial change");
+    expect(run(pool, second.pipe.get(), 9) == NEW_MISS_ACT, "partial change is live after commit");
+    expect(run(pool, first.pipe.get(), 9) == MISS_ACT, "pinned pipeline keeps the old config");
+
+    // once the transaction has copied the processor, its table writes and action deletes go to the copy
+    handle.begin();
+    expect(handle.config_target(0)->del_action(0, MISS_ACT), "delete a copied action");
+    expect(insert_key(handle.entry_target(0), 3), "insert into the shadow");
+    expect(run(pool, second.pipe.get(), 3) == NEW_MISS_ACT, "shadow entry is not live");
+    handle.commit();
+    expect(run(pool, handle.pin().pipe.get(), 3) == HIT_ACT, "shadow entry is live after commit");
+    expect(run(pool, second.pipe.get(), 3) == NEW_MISS_ACT, "pinned pipeline keeps its entries");
+    expect(run(pool, first.pipe.get(), 1) == HIT_ACT, "oldest pinned pipeline still runs");
+
+    // an aborted change leaves the live pipeline as it was
+    handle.begin();
+    handle.config_target(0)->clear_parser(0);
+    handle.abort();
+    expect(run(pool, handle.pin().pipe.get(), 1) == HIT_ACT, "abort drops the change");
+
+    first = PipelinePin();
+    second = PipelinePin();
+    handle.reclaim();
+    expect(handle.unpublished_num() == 0, "unpinned pipelines are reclaimed");
+
+    printf("pipeline transaction copy: %d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
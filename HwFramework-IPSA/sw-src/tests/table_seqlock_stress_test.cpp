@@ -0,0 +1,189 @@
+//
+// Concurrent check of the table seqlock: reader threads look an exact and a ternary table up the way
+// the datapath does, while a writer inserts, modifies and deletes entries. Every value carries its key
+// and a version in each byte, so a lookup that saw a row halfway through an update is caught. Keys
+// that are never deleted must be found by every lookup, also while ternary rows are being compacted.
+//
+
+#include <atomic>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "dataplane/global.h"
+#include "dataplane/matcher_c.h"
+
+#include <glog/logging.h>
+
+const static int KEY_LEN = 4;
+const static int VALUE_LEN = SRAM_WIDTH / 8;
+const static int KEY_NUM = 600;
+const static int READER_NUM = 3;
+const static int WRITE_OPS = 20000;
+
+typedef std::vector<uint8_t> Bytes;
+
+struct Table {
+    const char * name;
+    MatcherThread * mt;
+    bool ternary;
+    std::atomic<uint64_t> lookups{0};
+};
+
+static std::atomic<int> failures{0};
+
+static Bytes make_key(int k) {
+    Bytes key(MATCH_KEY_MAX, 0);
+    key[0] = 0x0a;
+    key[1] = (uint8_t) (k >> 16);
+    key[2] = (uint8_t) (k >> 8);
+    key[3] = (uint8_t) k;
+    return key;
+}
+
+// byte 0 is the version, every other byte follows from it and the key
+static uint8_t value_byte(int k, uint8_t version, int i) {
+    return (uint8_t) (k * 31 + version * (i + 1) + i);
+}
+
+static Bytes make_value(int k, uint8_t version) {
+    Bytes value(VALUE_LEN);
+    value[0] = version;
+    for(int i = 1; i < VALUE_LEN; i++) {
+        value[i] = value_byte(k, version, i);
+    }
+    return value;
+}
+
+// every third key is installed before the readers start and only ever modified
+static bool stable(int k) {
+    return k % 3 == 0;
+}
+
+static bool insert(Table & t, int k, const Bytes & value) {
+    Bytes key = make_key(k), mask(MATCH_KEY_MAX, 0xff);
+    Bytes v = value;
+    return t.ternary ? t.mt->insert_tcam_entry(key.data(), mask.data(), v.data(), KEY_LEN, VALUE_LEN)
+                     : t.mt->insert_sram_entry(key.data(), v.data(), KEY_LEN, VALUE_LEN);
+}
+
+static bool modify(Table & t, int k, const Bytes & value) {
+    Bytes key = make_key(k), mask(MATCH_KEY_MAX, 0xff);
+    return t.ternary ? t.mt->modify_tcam_entry(key.data(), mask.data(), value.data(), KEY_LEN, VALUE_LEN)
+                     : t.mt->modify_sram_entry(key.data(), value.data(), KEY_LEN, VALUE_LEN);
+}
+
+static bool erase(Table & t, int k) {
+    Bytes key = make_key(k), mask(MATCH_KEY_MAX, 0xff);
+    return t.ternary ? t.mt->delete_tcam_entry(key.data(), mask.data(), KEY_LEN)
+                     : t.mt->delete_sram_entry(key.data(), KEY_LEN);
+}
+
+// one lookup as MatcherThread::generate_match_key_and_match does it
+static void read_one(Table & t, int k, Arena & arena) {
+    Bytes key = make_key(k);
+    const uint8_t * value;
+    {
+        TableReadGuard guard(t.mt->entry_lock);
+        value = t.mt->get_match_res(key.data(), KEY_LEN, arena);
+    }
+    t.lookups++;
+    if(value == nullptr) {
+        if(stable(k)) {
+            fprintf(stderr, "%s: key %d is installed but was not found\n", t.name, k);
+            failures++;
+        }
+        return;
+    }
+    for(int i = 1; i < VALUE_LEN; i++) {
+        if(value[i] != value_byte(k, value[0], i)) {
+            fprintf(stderr, "%s: key %d read a torn value (byte %d)\n", t.name, k, i);
+            failures++;
+            return;
+        }
+    }
+}
+
+int main() {
+    FLAGS_minloglevel = 2;
+    init_mem();
+
+    // different clusters, so the two tables share no memory slice
+    MatcherThread exact(0), ternary(PROC_NUM_PER_CLUSTER);
+    exact.init_match_type(MatchType::EXACT);
+    ternary.init_match_type(MatchType::TERNARY);
+    uint8_t key_config[] = {0};
+    uint8_t value_config[] = {1};
+    exact.set_mem_config(1, 1, 1, key_config, value_config);
+    ternary.set_mem_config(1, 1, 1, key_config, value_config);
+
+    Table tables[2];
+    tables[0].name = "exact";
+    tables[0].mt = &exact;
+    tables[0].ternary = false;
+    tables[1].name = "ternary";
+    tables[1].mt = &ternary;
+    tables[1].ternary = true;
+
+    std::vector<int> version(2 * KEY_NUM, -1);
+    for(int t = 0; t < 2; t++) {
+        for(int k = 0; k < KEY_NUM; k += 3) {
+            if(!insert(tables[t], k, make_value(k, 0))) {
+                fprintf(stderr, "%s: installing key %d failed\n", tables[t].name, k);
+                return 1;
+            }
+            version[t * KEY_NUM + k] = 0;
+        }
+    }
+
+    std::atomic<bool> done{false};
+    std::vector<std::thread> readers;
+    for(int r = 0; r < READER_NUM; r++) {
+        readers.emplace_back([&, r] {
+            std::mt19937 rng(100 + r);
+            Arena arena;
+            while(!done.load(std::memory_order_relaxed)) {
+                for(int i = 0; i < 64; i++) {
+                    read_one(tables[rng() % 2], (int) (rng() % KEY_NUM), arena);
+                }
+                arena.reset();
+            }
+        });
+    }
+
+    // churn: stable keys get new versions, the others come and go. the ternary table deletes in the
+    // middle and installs at the tail, so it runs out of rows and compacts again and again
+    std::mt19937 rng(7);
+    for(int op = 0; op < WRITE_OPS && failures == 0; op++) {
+        int t = (int) (rng() % 2), k = (int) (rng() % KEY_NUM);
+        int & ver = version[t * KEY_NUM + k];
+        uint8_t next = (uint8_t) (ver + 1);
+        bool ok;
+        if(ver < 0) {
+            ok = insert(tables[t], k, make_value(k, next));
+            ver = next;
+        } else if(stable(k) || rng() % 2 == 0) {
+            ok = modify(tables[t], k, make_value(k, next));
+            ver = next;
+        } else {
+            ok = erase(tables[t], k);
+            ver = -1;
+        }
+        if(!ok) {
+            fprintf(stderr, "op %d: %s update of key %d failed\n", op, tables[t].name, k);
+            failures++;
+        }
+        if(op % 32 == 0) {
+            std::this_thread::yield();
+        }
+    }
+    done = true;
+    for(auto & r : readers) {
+        r.join();
+    }
+
+    printf("table seqlock stress: %d updates, %lu exact and %lu ternary lookups, %d failures\n", WRITE_OPS,
+           (unsigned long) tables[0].lookups.load(), (unsigned long) tables[1].lookups.load(), failures.load());
+    return failures == 0 ? 0 : 1;
+}
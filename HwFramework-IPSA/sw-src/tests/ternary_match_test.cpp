@@ -0,0 +1,152 @@
+//
+// Randomized check of a ternary table against a first-match scan over the live entries in install
+// order. Inserts and deletes churn a table about as large as its TCAM slice, so rows freed in the
+// middle have to be reused, and inserts with the wrong key length must leave nothing behind.
+// Both the tuple space index and the linear scan are checked, whichever one lookups dispatch to.
+//
+
+#include <cstdio>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "dataplane/global.h"
+#include "dataplane/matcher_c.h"
+
+#include <glog/logging.h>
+
+const static int KEY_LEN = 4;
+const static int VALUE_LEN = SRAM_WIDTH / 8;
+const static int ROWS = 1 << TCAM_DEPTH;
+const static int OP_NUM = 30000;
+const static int QUERY_NUM = 4;
+
+typedef std::vector<uint8_t> Bytes;
+
+struct RefEntry {
+    Bytes key;
+    Bytes mask;
+    Bytes value;
+};
+
+// live entries, oldest first: the first one matching wins
+static const RefEntry * ref_lookup(const std::list<RefEntry> & ref, const uint8_t * q) {
+    for(auto & e : ref) {
+        bool match = true;
+        for(int i = 0; i < KEY_LEN && match; i++) {
+            match = (q[i] & e.mask[i]) == e.key[i];
+        }
+        if(match) {
+            return &e;
+        }
+    }
+    return nullptr;
+}
+
+static Bytes random_mask(std::mt19937 & rng) {
+    // a handful of masks, so tuples are few and rules overlap a lot
+    static const uint32_t masks[] = {0xffffffff, 0xffffff00, 0xffff0000, 0xff00ff00, 0x0000ffff, 0xf0f0f0f0, 0};
+    uint32_t m = masks[rng() % (sizeof(masks) / sizeof(masks[0]))];
+    Bytes mask(MATCH_KEY_MAX, 0);
+    for(int i = 0; i < KEY_LEN; i++) {
+        mask[i] = (uint8_t) (m >> (24 - 8 * i));
+    }
+    return mask;
+}
+
+// bytes drawn from a small alphabet, so random queries hit rules
+static Bytes random_bytes(std::mt19937 & rng, int len) {
+    Bytes b(MATCH_KEY_MAX, 0);
+    for(int i = 0; i < len; i++) {
+        b[i] = (uint8_t) (rng() % 4);
+    }
+    return b;
+}
+
+int main() {
+    FLAGS_minloglevel = 2;
+    init_mem();
+
+    MatcherThread mt(0);
+    mt.init_match_type(MatchType::TERNARY);
+    uint8_t key_config[] = {0};
+    uint8_t value_config[] = {0};
+    mt.set_mem_config(1, 1, 1, key_config, value_config);
+
+    const char * lookup_names[] = {"get_match_res", "tscan", "tss"};
+    Bytes scratch(MATCH_KEY_MAX);
+    std::mt19937 rng(11);
+    std::list<RefEntry> ref;
+    int failures = 0, refused_len = 0;
+    for(int op = 0; op < OP_NUM && failures < 10; op++) {
+        int dice = (int) (rng() % 16);
+        if(dice < 8) {
+            RefEntry e;
+            e.mask = random_mask(rng);
+            e.key = random_bytes(rng, KEY_LEN);
+            for(int i = 0; i < KEY_LEN; i++) {
+                e.key[i] &= e.mask[i];
+            }
+            e.value = random_bytes(rng, VALUE_LEN);
+            bool ok = mt.insert_tcam_entry(e.key.data(), e.mask.data(), e.value.data(), KEY_LEN, VALUE_LEN);
+            if(ok != ((int) ref.size() < ROWS)) {
+                fprintf(stderr, "op %d: insert returned %d with %zu of %d rows live\n", op, ok, ref.size(), ROWS);
+                failures++;
+            }
+            if(ok) {
+                ref.push_back(e);
+            }
+        } else if(dice < 15) {
+            if(ref.empty()) {
+                continue;
+            }
+            auto it = ref.begin();
+            std::advance(it, rng() % ref.size());
+            // the table deletes the oldest entry with this key and mask, so must the reference
+            for(auto first = ref.begin(); first != it; ++first) {
+                if(first->key == it->key && first->mask == it->mask) {
+                    it = first;
+                    break;
+                }
+            }
+            if(!mt.delete_tcam_entry(it->key.data(), it->mask.data(), KEY_LEN)) {
+                fprintf(stderr, "op %d: delete of a live entry failed\n", op);
+                failures++;
+            }
+            ref.erase(it);
+        } else {
+            // another key length than the table's, refused without touching a row
+            Bytes key = random_bytes(rng, 2), mask = random_mask(rng), value = random_bytes(rng, VALUE_LEN);
+            if(!ref.empty() && mt.insert_tcam_entry(key.data(), mask.data(), value.data(), 2, VALUE_LEN)) {
+                fprintf(stderr, "op %d: insert with a 2-byte key accepted\n", op);
+                failures++;
+            }
+            refused_len++;
+        }
+
+        for(int q = 0; q < QUERY_NUM; q++) {
+            Bytes query = random_bytes(rng, KEY_LEN);
+            auto want = ref_lookup(ref, query.data());
+            // get_match_res picks one of tscan and tss by table shape, so each is also checked on its own
+            Arena arena;
+            const uint8_t * got[3];
+            got[0] = mt.get_match_res(query.data(), KEY_LEN, arena);
+            int scan_row = mt.tss.get_key_len() == 0 ? -1 : mt.tscan.lookup(query.data());
+            got[1] = scan_row < 0 ? nullptr : mt.row_value(scan_row, arena);
+            int tss_row = mt.tss.get_key_len() == 0 ? -1 : mt.tss.lookup(query.data(), scratch.data());
+            got[2] = tss_row < 0 ? nullptr : mt.row_value(tss_row, arena);
+            for(int k = 0; k < 3; k++) {
+                if((got[k] == nullptr) != (want == nullptr)
+                        || (got[k] != nullptr && memcmp(got[k], want->value.data(), VALUE_LEN) != 0)) {
+                    fprintf(stderr, "op %d: %s disagrees with the first-match scan (%s)\n", op, lookup_names[k],
+                            want == nullptr ? "want miss" : "want hit");
+                    failures++;
+                }
+            }
+        }
+    }
+
+    printf("ternary match: %d ops, %zu entries at the end, %d wrong-length inserts, %d failures\n",
+           OP_NUM, ref.size(), refused_len, failures);
+    return failures == 0 ? 0 : 1;
+}